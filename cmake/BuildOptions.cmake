@@ -2,3 +2,8 @@ option(BUILD_TESTS
     "Build unit tests for the enviornment alert system application."
     OFF
 )
+
+option(BUILD_SIM
+    "Build the Linux simulation of the environment alert system application, which runs on a virtual clock."
+    OFF
+)
@@ -1,9 +1,12 @@
 #include <stddef.h>
+#include <stdint.h>
 
 #include "alert_condition.h"
 #include "eas_assert.h"
 #include "config.h"
 #include "variable_requirement_evaluator.h"
+#include "variable_requirement.h"
+#include "util.h"
 
 #ifndef CONFIG_ALERT_CONDITION_MAX_NUM_INSTANCES
 #define CONFIG_ALERT_CONDITION_MAX_NUM_INSTANCES 1
@@ -13,102 +16,500 @@
 #define CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS 1
 #endif
 
+/* One alert condition with the maximum number of variable requirements fits into the pool by default */
+#ifndef CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS
+#define CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS
+#endif
+
+/* Every variable requirement can be a band requirement by default */
+#ifndef CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_BAND_REQUIREMENTS
+#define CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_BAND_REQUIREMENTS                                                         \
+    CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS
+#endif
+
+#ifndef CONFIG_ALERT_CONDITION_MAX_EXPRESSION_DEPTH
+#define CONFIG_ALERT_CONDITION_MAX_EXPRESSION_DEPTH 1
+#endif
+
+/** Used instead of an entry index to signal that there is no entry. */
+#define NO_ENTRY UINT16_MAX
+
+/* A jump target is either the index of the next entry to test, or the result of the alert condition. The two highest
+ * bits tell the kind of the target. While the alert condition is being built, the lower bits of targets that are not
+ * known yet link the jumps that should end up at the same place into a list. */
+#define TARGET_KIND_MASK ((uint16_t)0xC000U)
+#define TARGET_KIND_ENTRY ((uint16_t)0x0000U)
+#define TARGET_KIND_TRUE ((uint16_t)0x4000U)
+#define TARGET_KIND_FALSE ((uint16_t)0x8000U)
+#define TARGET_LINK_MASK ((uint16_t)0x3FFFU)
+/** Used instead of a jump to signal that there is no jump - the end of a list of jumps. */
+#define NO_JUMP TARGET_LINK_MASK
+/** Finish the evaluation with result true */
+#define TARGET_TRUE (TARGET_KIND_TRUE | NO_JUMP)
+/** Finish the evaluation with result false */
+#define TARGET_FALSE (TARGET_KIND_FALSE | NO_JUMP)
+
+/* Entries are indexed with uint16_t, and NO_ENTRY is not a valid index */
+EAS_STATIC_ASSERT(CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS < NO_ENTRY);
+/* Every entry has two jumps, and jumps are identified by values below NO_JUMP */
+EAS_STATIC_ASSERT((2 * CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS) <= NO_JUMP);
+/* The number of operands of an expression, and the number of satisfied variable requirements in an ORed requirement
+ * are stored as uint8_t */
+EAS_STATIC_ASSERT(CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS <= UINT8_MAX);
+
 /**
- * @brief Variable requirements array size.
+ * @brief One variable requirement of an alert condition.
  *
- * Each AND in the condition is represented as a NULL pointer in the array. The array needs to fit at most
- * CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS variable requirements. The worst case scenario in terms of
- * storage is when we have CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS requirements, and each of them is
- * separated by an AND - NULL pointer.
+ * Entries of all alert conditions are taken from one shared pool, so memory is reserved for the total number of
+ * variable requirements in the system, rather than for the maximum number of variable requirements in every alert
+ * condition. The entries of an alert condition form a singly linked list, in the order in which the variable
+ * requirements were added. Free entries form a singly linked list as well.
+ *
+ * Every entry is also one instruction of the compiled alert condition: test the latest known result of the variable
+ * requirement, and jump to one of the two targets. Besides the variable requirement, an entry takes 8 bytes, so 12
+ * bytes on the nRF52840.
+ */
+typedef struct AlertConditionEntry {
+    VariableRequirement variable_requirement;
+    /** Index of the next entry in the list, or NO_ENTRY if this is the last entry. */
+    uint16_t next;
+    /** Where to continue the evaluation if the result of the variable requirement is true. */
+    uint16_t target_if_true;
+    /** Where to continue the evaluation if the result of the variable requirement is false. */
+    uint16_t target_if_false;
+    /** Number of variable requirements with result true in the ORed requirement that this entry starts. Only used if
+     * is_first_in_ored_requirement is true, and the alert condition has no expressions. */
+    uint8_t num_satisfied_in_ored_requirement;
+    /** Latest known result of the variable requirement. */
+    bool result : 1;
+    /** True if this variable requirement is the first one in its ORed requirement. The ORed requirement consists of
+     * this entry and all entries that follow it, up to the next entry that starts an ORed requirement. Only used if the
+     * alert condition has no expressions. */
+    bool is_first_in_ored_requirement : 1;
+} AlertConditionEntry;
+
+/* The pool is sized for every variable requirement in the system, so entries must stay small */
+EAS_STATIC_ASSERT(sizeof(AlertConditionEntry) <= (sizeof(VariableRequirement) + 8));
+
+/**
+ * @brief List of jumps that should end up at the same target.
  *
- * In that case, we would have (CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS - 1) NULL pointers
- * and CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS variable requirements. Hence, array size should be
- * (CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS + (CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS - 1))
- * to always be able to store CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS variable requirements.
+ * A jump is identified by (2 * entry index) for the target_if_true jump of an entry, and by (2 * entry index + 1) for
+ * its target_if_false jump. The target of every jump in the list holds the next jump in the list.
  */
-#define ALERT_CONDITION_VARIABLE_REQUIREMENTS_ARRAY_SIZE                                                               \
-    (CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS + (CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS - 1))
+typedef struct JumpList {
+    uint16_t first;
+    uint16_t last;
+} JumpList;
 
+/**
+ * @brief Alert condition.
+ *
+ * The alert condition is compiled into its entries as variable requirements are added: the targets of every entry
+ * lead either to the entry that decides the result next, or to the result itself. Evaluating the alert condition
+ * follows the targets from the first entry, so operands of AND and OR are skipped as soon as the result of the
+ * expression is known, and the number of tested entries never exceeds the number of variable requirements.
+ *
+ * Most alert conditions have no expressions - they are ANDed ORed requirements of variable requirements. For them, the
+ * alert condition also keeps the number of satisfied variable requirements in every ORed requirement, and the number of
+ * ORed requirements that are not satisfied, so the result is known without following the targets. The condition is
+ * satisfied when there are no unsatisfied ORed requirements.
+ *
+ * When the result of one variable requirement changes, only its entry, and the counters of its ORed requirement if the
+ * condition has no expressions, are updated - the other variable requirements are neither evaluated nor modified.
+ */
 struct AlertConditionStruct {
-    VariableRequirement variable_requirements[ALERT_CONDITION_VARIABLE_REQUIREMENTS_ARRAY_SIZE];
-    /** Number of variable requirements currently in the alert condition. This excludes the ANDs (NULL pointers), only
-     * counts real variable requirements. */
-    size_t num_requirements;
-    /** Equal to the sum of num_requirements and the number of ANDs (NULL pointers in variable_requirements array).
-     * Always equal to the current number of elements in the variable_requirements array. */
-    size_t num_items_in_reqs_array;
+    /** Index of the first entry of this alert condition, or NO_ENTRY if the condition has no variable requirements. The
+     * evaluation starts at this entry. */
+    uint16_t first_entry;
+    /** Index of the last entry of this alert condition. Only valid if first_entry is not NO_ENTRY. */
+    uint16_t last_entry;
+    /** Number of variable requirements currently in the alert condition. */
+    uint8_t num_requirements;
+    /** Number of band requirements among the variable requirements of the alert condition. */
+    uint8_t num_band_requirements;
+    /** Number of ORed requirements that have no variable requirements with result true. Only used if has_expressions
+     * is false. */
+    uint8_t num_unsatisfied_ored_requirements;
+    /** True if an expression was begun since the alert condition was created or reset. The result of the alert
+     * condition is then found by following the targets of the entries. */
+    bool has_expressions;
     bool insert_and_before_next_requirement;
+    /** Jumps that are taken when the current ORed requirement is satisfied. They finish the evaluation with result true
+     * until the next ORed requirement is added. */
+    JumpList ored_requirement_true_jumps;
+    /** Jumps that are taken when the last operand of the current ORed requirement is not satisfied. They finish the
+     * evaluation with result false until the next operand is added to the ORed requirement. */
+    JumpList ored_requirement_false_jumps;
 };
 
+/**
+ * @brief Expression that is being added to an alert condition.
+ *
+ * Started by @ref alert_condition_begin_expression, and added to the enclosing expression, or to the current ORed
+ * requirement, by @ref alert_condition_end_expression.
+ */
+typedef struct ExpressionFrame {
+    AlertConditionOperator expression_operator;
+    uint8_t num_operands;
+    /** Jumps that are taken when the operands added so far make the expression true, and that are not resolved yet. */
+    JumpList true_jumps;
+    /** Jumps that are taken when the operands added so far make the expression false, and that are not resolved yet. */
+    JumpList false_jumps;
+} ExpressionFrame;
+
 static struct AlertConditionStruct instances[CONFIG_ALERT_CONDITION_MAX_NUM_INSTANCES];
 static size_t instance_idx = 0;
 
+/** Entries of all alert conditions. */
+static AlertConditionEntry entries[CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS];
+/** Index of the first free entry, or NO_ENTRY if all entries are in use. */
+static uint16_t first_free_entry = NO_ENTRY;
+static size_t num_free_entries = 0;
+/** Number of band requirements that can still be added to all alert conditions. */
+static size_t num_free_band_requirements = 0;
+
+/* Open expressions are only needed while an alert condition is being populated, and alert conditions are populated one
+ * at a time, so all alert conditions share the memory for them. Beginning an expression or adding a variable
+ * requirement asserts if another alert condition has open expressions. */
+static ExpressionFrame expression_frames[CONFIG_ALERT_CONDITION_MAX_EXPRESSION_DEPTH];
+static size_t num_expression_frames = 0;
+/** Alert condition that the open expressions belong to. Only valid if num_expression_frames is not 0. */
+static AlertCondition expression_condition = NULL;
+/** Jumps to the first entry of the operand that is being added. Resolved as soon as that entry is added. */
+static JumpList jumps_to_next_entry = {.first = NO_JUMP, .last = NO_JUMP};
+
+/**
+ * @brief Put all entries into the list of free entries.
+ *
+ * Done when the first alert condition is created, since no entries can be used before that.
+ */
+static void initialize_entries()
+{
+    for (size_t i = 0; i < CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS; i++) {
+        entries[i].next = (i + 1 < CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS) ? (uint16_t)(i + 1)
+                                                                                                 : NO_ENTRY;
+    }
+    first_free_entry = 0;
+    num_free_entries = CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS;
+    num_free_band_requirements = CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_BAND_REQUIREMENTS;
+}
+
+/**
+ * @brief Append a variable requirement to the list of entries of an alert condition.
+ *
+ * @param self Alert condition instance returned by @ref alert_condition_create.
+ * @param variable_requirement Variable requirement to append.
+ *
+ * @return uint16_t Index of the appended entry.
+ */
+static uint16_t append_entry(AlertCondition self, VariableRequirement variable_requirement)
+{
+    /* Asserting because the pool is sized for the total number of variable requirements in the system. Callers that add
+     * variable requirements on request of a user should check alert_condition_get_num_free_variable_requirements
+     * first. */
+    EAS_ASSERT(first_free_entry != NO_ENTRY);
+    uint16_t entry_idx = first_free_entry;
+    AlertConditionEntry *const entry = &entries[entry_idx];
+    first_free_entry = entry->next;
+    num_free_entries--;
+
+    entry->variable_requirement = variable_requirement;
+    entry->next = NO_ENTRY;
+    entry->target_if_true = TARGET_TRUE;
+    entry->target_if_false = TARGET_FALSE;
+    entry->num_satisfied_in_ored_requirement = 0;
+    /* Until its result is reported, a variable requirement is considered not satisfied */
+    entry->result = false;
+    entry->is_first_in_ored_requirement = false;
+
+    if (self->first_entry == NO_ENTRY) {
+        self->first_entry = entry_idx;
+    } else {
+        entries[self->last_entry].next = entry_idx;
+    }
+    self->last_entry = entry_idx;
+    return entry_idx;
+}
+
+/**
+ * @brief Get the target of a jump.
+ *
+ * @param jump Jump.
+ *
+ * @return uint16_t* Target of the jump.
+ */
+static uint16_t *get_jump_target(uint16_t jump)
+{
+    AlertConditionEntry *const entry = &entries[jump >> 1];
+    return (jump & 1U) ? &entry->target_if_false : &entry->target_if_true;
+}
+
+/**
+ * @brief Create an empty list of jumps.
+ *
+ * @return JumpList Empty list.
+ */
+static JumpList create_empty_jump_list()
+{
+    JumpList jump_list = {.first = NO_JUMP, .last = NO_JUMP};
+    return jump_list;
+}
+
+/**
+ * @brief Create a list that consists of one jump.
+ *
+ * @param jump Jump.
+ *
+ * @return JumpList List with @p jump.
+ */
+static JumpList create_jump_list(uint16_t jump)
+{
+    JumpList jump_list = {.first = jump, .last = jump};
+    return jump_list;
+}
+
+/**
+ * @brief Append all jumps of one list to another list.
+ *
+ * @param jump_list List to append to.
+ * @param other_jump_list List to append.
+ *
+ * @return JumpList List that consists of the jumps of both lists.
+ */
+static JumpList merge_jump_lists(JumpList jump_list, JumpList other_jump_list)
+{
+    if (jump_list.first == NO_JUMP) {
+        return other_jump_list;
+    }
+    if (other_jump_list.first != NO_JUMP) {
+        uint16_t *const last_target = get_jump_target(jump_list.last);
+        *last_target = (uint16_t)((*last_target & TARGET_KIND_MASK) | other_jump_list.first);
+        jump_list.last = other_jump_list.last;
+    }
+    return jump_list;
+}
+
+/**
+ * @brief Make all jumps in the list finish the evaluation with the given result, until they are resolved.
+ *
+ * The jumps stay in the list.
+ *
+ * @param jump_list Jumps.
+ * @param kind TARGET_KIND_TRUE or TARGET_KIND_FALSE.
+ */
+static void set_jump_list_kind(JumpList jump_list, uint16_t kind)
+{
+    for (uint16_t jump = jump_list.first; jump != NO_JUMP;) {
+        uint16_t *const target = get_jump_target(jump);
+        jump = *target & TARGET_LINK_MASK;
+        *target = (uint16_t)(kind | jump);
+    }
+}
+
+/**
+ * @brief Make all jumps in the list continue the evaluation at the given entry.
+ *
+ * @param jump_list Jumps. The list is no longer valid after this function returns.
+ * @param entry_idx Index of the entry.
+ */
+static void resolve_jump_list(JumpList jump_list, uint16_t entry_idx)
+{
+    for (uint16_t jump = jump_list.first; jump != NO_JUMP;) {
+        uint16_t *const target = get_jump_target(jump);
+        jump = *target & TARGET_LINK_MASK;
+        *target = entry_idx;
+    }
+}
+
+/**
+ * @brief Check whether an alert condition has open expressions.
+ *
+ * @param self Alert condition instance returned by @ref alert_condition_create.
+ *
+ * @return true @p self has expressions that were begun, but not ended.
+ * @return false @p self has no open expressions.
+ */
+static bool has_open_expressions(AlertCondition self)
+{
+    return (num_expression_frames > 0) && (expression_condition == self);
+}
+
 /**
- * @brief Add a variable requirement to the self->variable_requirements array.
+ * @brief Prepare adding an operand - a variable requirement or an expression.
+ *
+ * Collects the jumps that lead to the operand into jumps_to_next_entry. They are resolved once the first entry of the
+ * operand is added.
  *
  * @param self Alert condition instance returned by @ref alert_condition_create.
- * @param variable_requirement Variable requirement to add to the list. It is allowed to be NULL - a NULL variable
- * requirement in the array represents a logial AND in the alert condition.
  */
-static void add_requirement_to_list(AlertCondition self, VariableRequirement variable_requirement)
+static void start_operand(AlertCondition self)
 {
-    EAS_ASSERT(self->num_items_in_reqs_array < ALERT_CONDITION_VARIABLE_REQUIREMENTS_ARRAY_SIZE);
-    self->variable_requirements[self->num_items_in_reqs_array++] = variable_requirement;
+    /* Only one alert condition can have open expressions at a time */
+    bool is_other_condition_populated = (num_expression_frames > 0) && (expression_condition != self);
+    EAS_ASSERT(!is_other_condition_populated);
+
+    if (num_expression_frames > 0) {
+        ExpressionFrame *const frame = &expression_frames[num_expression_frames - 1];
+        bool is_not_with_multiple_operands =
+            (frame->expression_operator == ALERT_CONDITION_OPERATOR_NOT) && (frame->num_operands > 0);
+        EAS_ASSERT(!is_not_with_multiple_operands);
+        if (frame->num_operands > 0) {
+            if (frame->expression_operator == ALERT_CONDITION_OPERATOR_AND) {
+                /* All previous operands are true - the result depends on this operand */
+                jumps_to_next_entry = merge_jump_lists(jumps_to_next_entry, frame->true_jumps);
+                frame->true_jumps = create_empty_jump_list();
+            } else {
+                /* All previous operands are false - the result depends on this operand */
+                jumps_to_next_entry = merge_jump_lists(jumps_to_next_entry, frame->false_jumps);
+                frame->false_jumps = create_empty_jump_list();
+            }
+        }
+        frame->num_operands++;
+        return;
+    }
+
+    if (self->first_entry != NO_ENTRY) {
+        if (self->insert_and_before_next_requirement) {
+            /* The previous ORed requirement is satisfied - the result depends on the new ORed requirement. The false
+             * jumps of the previous ORed requirement keep finishing the evaluation with result false. */
+            jumps_to_next_entry = merge_jump_lists(jumps_to_next_entry, self->ored_requirement_true_jumps);
+            self->ored_requirement_true_jumps = create_empty_jump_list();
+        } else {
+            /* All previous operands of the ORed requirement are false - the result depends on this operand */
+            jumps_to_next_entry = merge_jump_lists(jumps_to_next_entry, self->ored_requirement_false_jumps);
+        }
+        self->ored_requirement_false_jumps = create_empty_jump_list();
+    }
+    /* The first variable requirement always starts an ORed requirement. Starting a new ORed requirement before it has
+     * no effect. */
+    self->insert_and_before_next_requirement = false;
 }
 
 /**
- * @brief Evaluate a ORed variable requirement.
+ * @brief Add a fully added operand to the enclosing expression, or to the current ORed requirement.
  *
- * @param[in] self Alert condition instance returned by @ref alert_condition_create.
- * @param[in] start_idx Index for the self->variable_requirements array. Should point to the first variable requirement
- * of the ORed variable requirement that needs to be evaluated.
- * @param[out] end_idx This function writes to this parameter the index of the first variable requirement after the one
- * at @p start_idx that is not a part of this ORed requirement. There are two options:
- *   - This ORed variable requirement is not the last one in the alert condition. This means that there is a NULL
- * variable requirement in the array between this ORed variable requirement and the next one. In this case, @p end_idx
- * contains the index of that NULL variable requirement.
- *   - This ORed variable requirement is the last one in the alert condition. In that case, @p end_idx is set to
- * self->num_items_in_reqs_array, because self->num_items_in_reqs_array is the next index after the index of the last
- * variable requirement that is a part of this ORed requirement.
+ * @param self Alert condition instance returned by @ref alert_condition_create.
+ * @param true_jumps Unresolved jumps of the operand that are taken when the operand is true.
+ * @param false_jumps Unresolved jumps of the operand that are taken when the operand is false.
+ */
+static void complete_operand(AlertCondition self, JumpList true_jumps, JumpList false_jumps)
+{
+    if (num_expression_frames > 0) {
+        ExpressionFrame *const frame = &expression_frames[num_expression_frames - 1];
+        switch (frame->expression_operator) {
+        case ALERT_CONDITION_OPERATOR_AND:
+            /* If the operand is true, the next operand decides. If it is false, the expression is false. */
+            frame->true_jumps = true_jumps;
+            frame->false_jumps = merge_jump_lists(frame->false_jumps, false_jumps);
+            break;
+        case ALERT_CONDITION_OPERATOR_OR:
+            frame->true_jumps = merge_jump_lists(frame->true_jumps, true_jumps);
+            frame->false_jumps = false_jumps;
+            break;
+        default:
+            /* NOT - swapping the jumps negates the operand */
+            frame->true_jumps = false_jumps;
+            frame->false_jumps = true_jumps;
+            break;
+        }
+        return;
+    }
+
+    /* Operand of the current ORed requirement. Until more variable requirements are added, it finishes the
+     * evaluation. */
+    set_jump_list_kind(true_jumps, TARGET_KIND_TRUE);
+    set_jump_list_kind(false_jumps, TARGET_KIND_FALSE);
+    self->ored_requirement_true_jumps = merge_jump_lists(self->ored_requirement_true_jumps, true_jumps);
+    self->ored_requirement_false_jumps = false_jumps;
+}
+
+/**
+ * @brief Store a new result of a variable requirement and update the counters of the alert condition.
  *
- * @return true The ORed variable requirement evaluated to true.
- * @return false The ORed variable requirement evaluated to false.
+ * @param self Alert condition instance returned by @ref alert_condition_create.
+ * @param entry Entry of the variable requirement.
+ * @param ored_req_entry First entry of the ORed requirement that the variable requirement is a part of. Only used if
+ * the alert condition has no expressions.
+ * @param result New result of the variable requirement.
  */
-static bool evaluate_ored_requirement(AlertCondition self, size_t start_idx, size_t *end_idx)
+static void update_requirement_result(AlertCondition self, AlertConditionEntry *const entry,
+                                      AlertConditionEntry *const ored_req_entry, bool result)
 {
-    bool req_result = false;
-    size_t req_idx = start_idx;
+    if (entry->result == result) {
+        /* Counters already account for this result */
+        return;
+    }
+    entry->result = result;
 
-    /* The ORed requirement ends in two cases: we reached the end of the whole condition, or we reached a logical AND
-     * (represented as NULL). */
-    while ((req_idx < self->num_items_in_reqs_array) && (self->variable_requirements[req_idx] != NULL)) {
-        /* An ORed requirement is a list of variable requirements that are ORed: (req OR req OR req ...). If one of them
-         * already evaluated to true, we already know hat the whole ORed condition is true. It is then not necessary to
-         * actually evaluate subsequent conditions. We still stay in the loop to reach the end of the ORed condition to
-         * set end_idx to the correct value. */
-        if (!req_result) {
-            req_result = variable_requirement_evaluator_evaluate(self->variable_requirements[req_idx]);
+    if (self->has_expressions) {
+        /* The result is found by following the targets of the entries */
+        return;
+    }
+    if (result) {
+        if (ored_req_entry->num_satisfied_in_ored_requirement == 0) {
+            /* The first satisfied variable requirement in this ORed requirement makes the ORed requirement satisfied */
+            self->num_unsatisfied_ored_requirements--;
+        }
+        ored_req_entry->num_satisfied_in_ored_requirement++;
+    } else {
+        ored_req_entry->num_satisfied_in_ored_requirement--;
+        if (ored_req_entry->num_satisfied_in_ored_requirement == 0) {
+            /* The last satisfied variable requirement in this ORed requirement is no longer satisfied */
+            self->num_unsatisfied_ored_requirements++;
         }
-        req_idx++;
     }
+}
 
-    /* This assert fires if the loop body was never entered. This happens if start_idx points to a logical AND or is out
-     * of bounds. */
-    EAS_ASSERT(req_idx != start_idx);
+/**
+ * @brief Follow the targets of the entries, starting from the first entry, until the result is reached.
+ *
+ * @param self Alert condition instance returned by @ref alert_condition_create. Must have variable requirements.
+ *
+ * @return bool Result of the alert condition.
+ */
+static bool run(AlertCondition self)
+{
+    uint16_t target = self->first_entry;
+    while ((target & TARGET_KIND_MASK) == TARGET_KIND_ENTRY) {
+        const AlertConditionEntry *const entry = &entries[target];
+        target = entry->result ? entry->target_if_true : entry->target_if_false;
+    }
+    return ((target & TARGET_KIND_MASK) == TARGET_KIND_TRUE);
+}
 
-    *end_idx = req_idx;
-    return req_result;
+/**
+ * @brief Get the result of the alert condition from the latest known results of its variable requirements.
+ *
+ * @param self Alert condition instance returned by @ref alert_condition_create. Must have variable requirements.
+ *
+ * @return bool Result of the alert condition.
+ */
+static bool get_result(AlertCondition self)
+{
+    if (self->has_expressions) {
+        return run(self);
+    }
+    return (self->num_unsatisfied_ored_requirements == 0);
 }
 
 AlertCondition alert_condition_create()
 {
     EAS_ASSERT(instance_idx < CONFIG_ALERT_CONDITION_MAX_NUM_INSTANCES);
+    if (instance_idx == 0) {
+        initialize_entries();
+    }
     struct AlertConditionStruct *instance = &instances[instance_idx];
     instance_idx++;
 
+    instance->first_entry = NO_ENTRY;
     instance->num_requirements = 0;
-    instance->num_items_in_reqs_array = 0;
+    instance->num_band_requirements = 0;
+    instance->num_unsatisfied_ored_requirements = 0;
+    instance->has_expressions = false;
     instance->insert_and_before_next_requirement = false;
+    instance->ored_requirement_true_jumps = create_empty_jump_list();
+    instance->ored_requirement_false_jumps = create_empty_jump_list();
     return instance;
 }
 
@@ -119,53 +520,128 @@ void alert_condition_add_variable_requirement(AlertCondition self, VariableRequi
     bool is_num_allowed_requirements_exceeded =
         (self->num_requirements >= CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS);
     EAS_ASSERT(!is_num_allowed_requirements_exceeded);
+    /* Band requirements take two entries in a variable requirement list, and variable requirement lists are sized for
+     * CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_BAND_REQUIREMENTS of them. Callers that add variable requirements on request
+     * of a user should check alert_condition_get_num_free_band_requirements first. */
+    bool is_band = variable_requirement_is_band_operator(variable_requirement_get_operator(variable_requirement));
+    bool is_band_budget_exceeded = is_band && (num_free_band_requirements == 0);
+    EAS_ASSERT(!is_band_budget_exceeded);
 
-    if (self->insert_and_before_next_requirement) {
-        /* Do not add NULL to the array as the first element - it is already clear that the first element is a start of
-         * a new ORed requirement. */
-        if (self->num_requirements > 0) {
-            /* NULL represents logical AND in the list of requirements */
-            add_requirement_to_list(self, NULL);
-        }
-        self->insert_and_before_next_requirement = false;
+    /* The first variable requirement always starts an ORed requirement. Starting a new ORed requirement before it has
+     * no effect. */
+    bool is_first_in_ored_requirement = (self->num_requirements == 0) || self->insert_and_before_next_requirement;
+    start_operand(self);
+    uint16_t entry_idx = append_entry(self, variable_requirement);
+    if (!self->has_expressions && is_first_in_ored_requirement) {
+        entries[entry_idx].is_first_in_ored_requirement = true;
+        /* A new ORed requirement starts with no satisfied variable requirements */
+        self->num_unsatisfied_ored_requirements++;
     }
-    add_requirement_to_list(self, variable_requirement);
+    resolve_jump_list(jumps_to_next_entry, entry_idx);
+    jumps_to_next_entry = create_empty_jump_list();
+    /* The variable requirement is an operand by itself */
+    JumpList true_jumps = create_jump_list((uint16_t)(2 * entry_idx));
+    JumpList false_jumps = create_jump_list((uint16_t)(2 * entry_idx + 1));
+    complete_operand(self, true_jumps, false_jumps);
     self->num_requirements++;
+    if (is_band) {
+        self->num_band_requirements++;
+        num_free_band_requirements--;
+    }
 }
 
 void alert_condition_start_new_ored_requirement(AlertCondition self)
 {
     EAS_ASSERT(self);
+    EAS_ASSERT(!has_open_expressions(self));
     self->insert_and_before_next_requirement = true;
 }
 
-bool alert_condition_evaluate(AlertCondition self)
+void alert_condition_begin_expression(AlertCondition self, AlertConditionOperator expression_operator)
 {
     EAS_ASSERT(self);
-    EAS_ASSERT(self->num_items_in_reqs_array > 0);
+    bool is_valid_operator = (expression_operator == ALERT_CONDITION_OPERATOR_AND) ||
+                             (expression_operator == ALERT_CONDITION_OPERATOR_OR) ||
+                             (expression_operator == ALERT_CONDITION_OPERATOR_NOT);
+    EAS_ASSERT(is_valid_operator);
+    bool is_max_expression_depth_exceeded = (num_expression_frames >= CONFIG_ALERT_CONDITION_MAX_EXPRESSION_DEPTH);
+    EAS_ASSERT(!is_max_expression_depth_exceeded);
+
+    start_operand(self);
+    ExpressionFrame *const frame = &expression_frames[num_expression_frames];
+    num_expression_frames++;
+    expression_condition = self;
+    /* The counters of ORed requirements can not represent expressions, so they are not used from now on */
+    self->has_expressions = true;
 
-    bool ored_req_result;
-    size_t req_idx = 0;
+    frame->expression_operator = expression_operator;
+    frame->num_operands = 0;
+    frame->true_jumps = create_empty_jump_list();
+    frame->false_jumps = create_empty_jump_list();
+}
+
+void alert_condition_end_expression(AlertCondition self)
+{
+    EAS_ASSERT(self);
+    EAS_ASSERT(has_open_expressions(self));
+    num_expression_frames--;
+    const ExpressionFrame *const frame = &expression_frames[num_expression_frames];
+    bool has_operands = (frame->num_operands > 0);
+    EAS_ASSERT(has_operands);
+
+    complete_operand(self, frame->true_jumps, frame->false_jumps);
+}
+
+bool alert_condition_evaluate(AlertCondition self)
+{
+    EAS_ASSERT(self);
+    EAS_ASSERT(self->num_requirements > 0);
+    EAS_ASSERT(!has_open_expressions(self));
 
-    while (req_idx < self->num_items_in_reqs_array) {
-        ored_req_result = evaluate_ored_requirement(self, req_idx, &req_idx);
-        if (!ored_req_result) {
-            /* Condition is a list of ORed requirements that are ANDed: (ORed req) AND (ORed req) AND (ORed req) ...
-            If one of ORed requirements evaluates to false, we already know that the whole condition is false. */
-            return false;
+    AlertConditionEntry *ored_req_entry = NULL;
+    for (uint16_t i = self->first_entry; i != NO_ENTRY; i = entries[i].next) {
+        AlertConditionEntry *const entry = &entries[i];
+        if (entry->is_first_in_ored_requirement) {
+            ored_req_entry = entry;
         }
+        /* Every variable requirement is evaluated, even if the result of the condition does not depend on it. This way,
+         * the entries hold the results of all variable requirements, and subsequent result changes can be reported
+         * using alert_condition_set_variable_requirement_result. */
+        bool req_result = variable_requirement_evaluator_evaluate(entry->variable_requirement);
+        update_requirement_result(self, entry, ored_req_entry, req_result);
+    }
 
-        /* evaluate_ored_requirement set req_idx to the index of the first condition that was not a part of the ORed
-         * requirement. Now, req_idx is either pointing at an AND (represented as NULL), or it is equal to
-         * self->num_items_in_reqs_array (if it was the last ORed requirement in the condition). We increment req_idx by
-         * 1 to skip over the AND (NULL), so that in the next iteration we are pointing to the first requirement of the
-         * next ORed requirement. If req_idx is already equal to self->num_items_in_reqs_array, then incrementing it by
-         * 1 will not matter - the while loop condition will evaluate to false regardless and we will exit the loop. */
-        req_idx++;
+    return get_result(self);
+}
+
+void alert_condition_set_variable_requirement_result(AlertCondition self, VariableRequirement variable_requirement,
+                                                     bool result)
+{
+    EAS_ASSERT(self);
+    EAS_ASSERT(variable_requirement);
+
+    AlertConditionEntry *ored_req_entry = NULL;
+    for (uint16_t i = self->first_entry; i != NO_ENTRY; i = entries[i].next) {
+        AlertConditionEntry *const entry = &entries[i];
+        if (entry->is_first_in_ored_requirement) {
+            ored_req_entry = entry;
+        }
+        if (entry->variable_requirement == variable_requirement) {
+            update_requirement_result(self, entry, ored_req_entry, result);
+            return;
+        }
     }
 
-    /* All ORed requirements evaluated to true -> condition evaluates to true */
-    return true;
+    /* Variable requirement is not a part of this alert condition */
+    EAS_ASSERT(false);
+}
+
+bool alert_condition_get_result(AlertCondition self)
+{
+    EAS_ASSERT(self);
+    EAS_ASSERT(self->num_requirements > 0);
+    EAS_ASSERT(!has_open_expressions(self));
+    return get_result(self);
 }
 
 void alert_condition_for_each(AlertCondition self, AlertConditionForEachCb cb)
@@ -173,11 +649,8 @@ void alert_condition_for_each(AlertCondition self, AlertConditionForEachCb cb)
     EAS_ASSERT(self);
     EAS_ASSERT(cb);
 
-    for (size_t i = 0; i < self->num_items_in_reqs_array; i++) {
-        /* Skip the logical ANDs - represented by NULL pointers */
-        if (self->variable_requirements[i] != NULL) {
-            cb(self->variable_requirements[i]);
-        }
+    for (uint16_t i = self->first_entry; i != NO_ENTRY; i = entries[i].next) {
+        cb(entries[i].variable_requirement);
     }
 }
 
@@ -185,7 +658,49 @@ void alert_condition_reset(AlertCondition self)
 {
     EAS_ASSERT(self);
 
-    self->num_items_in_reqs_array = 0;
+    if (self->first_entry != NO_ENTRY) {
+        /* Return all entries to the pool at once */
+        entries[self->last_entry].next = first_free_entry;
+        first_free_entry = self->first_entry;
+        num_free_entries += self->num_requirements;
+        num_free_band_requirements += self->num_band_requirements;
+    }
+    if (has_open_expressions(self)) {
+        /* Drop the expressions that were not ended */
+        num_expression_frames = 0;
+        jumps_to_next_entry = create_empty_jump_list();
+    }
+    self->first_entry = NO_ENTRY;
     self->num_requirements = 0;
+    self->num_band_requirements = 0;
+    self->num_unsatisfied_ored_requirements = 0;
+    self->has_expressions = false;
     self->insert_and_before_next_requirement = false;
+    self->ored_requirement_true_jumps = create_empty_jump_list();
+    self->ored_requirement_false_jumps = create_empty_jump_list();
+}
+
+size_t alert_condition_get_num_free_variable_requirements()
+{
+    return num_free_entries;
+}
+
+size_t alert_condition_get_max_total_num_variable_requirements()
+{
+    return CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS;
+}
+
+size_t alert_condition_get_num_free_band_requirements()
+{
+    return num_free_band_requirements;
+}
+
+size_t alert_condition_get_max_total_num_band_requirements()
+{
+    return CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_BAND_REQUIREMENTS;
+}
+
+size_t alert_condition_get_max_expression_depth()
+{
+    return CONFIG_ALERT_CONDITION_MAX_EXPRESSION_DEPTH;
 }
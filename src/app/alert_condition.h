@@ -7,6 +7,7 @@ extern "C"
 #endif
 
 #include <stdbool.h>
+#include <stddef.h>
 
 #include "alert_condition_defs.h"
 #include "variable_requirement_defs.h"
@@ -55,18 +56,41 @@ extern "C"
  * after all variable requirements have been added to the condition - such calls have no effect on the evaluation
  * result.
  *
- * Note that it is not possible to directly add a condition that has OR operators that take precedence over AND, for
- * example:
+ * An operand of an ORed requirement can also be an expression with AND, OR and NOT operators, which can be nested. This
+ * way, conditions that have OR operators that take precedence over AND do not have to be converted to the form above
+ * first, which can multiply the number of variable requirements. For example:
  * ```
- *   (req_1 AND req_2) OR (req_3 AND req_4)
+ *   (req_1 AND req_2) OR req_3
  * ```
  *
- * The good news is is that such logical expressions can always be converted to equivalent expressions that have AND
- * operators that take precedence over OR operators. Those expressions can then be directly represetned by this module.
- * Here is an example conversion to a logical expression that can be represented by this module directly:
+ * An expression is added by calling @ref alert_condition_begin_expression, then adding its operands, and then calling
+ * @ref alert_condition_end_expression. The operands are variable requirements and nested expressions:
  * ```
- *   ((req_1 AND req_2) OR (req_3 AND req_4)) <=> ((req_1 AND req_2) OR req_3) AND ((req_1 AND req_2) OR req_4) <=>
- *   (req_1 OR req_3) AND (req_2 OR req_3) AND (req_1 OR req_4) AND (req_2 or req_4)
+ * alert_condition_begin_expression(alert_condition, ALERT_CONDITION_OPERATOR_AND);
+ * alert_condition_add_variable_requirement(alert_condition, req_1);
+ * alert_condition_add_variable_requirement(alert_condition, req_2);
+ * alert_condition_end_expression(alert_condition);
+ * // Second operand of the ORed requirement
+ * alert_condition_add_variable_requirement(alert_condition, req_3);
+ * ```
+ *
+ * The alert condition is compiled while variable requirements and expressions are added. Every variable requirement
+ * knows which variable requirement decides the result next, depending on its own result, so operands of AND and OR
+ * expressions are skipped as soon as the result of the expression is known. An alert condition without expressions
+ * counts the satisfied variable requirements of every ORed requirement instead, so its result is known without
+ * visiting any variable requirement.
+ *
+ * @ref alert_condition_evaluate evaluates every variable requirement in the alert condition. After that, the alert
+ * condition does not need to be fully evaluated again. When the result of one of its variable requirements changes,
+ * the new result can be reported using @ref alert_condition_set_variable_requirement_result. The alert condition keeps
+ * the latest known result of every variable requirement, so the new result of the whole condition is available from
+ * @ref alert_condition_get_result without evaluating any other variable requirements:
+ * ```
+ * bool req_3_result = variable_requirement_evaluate(req_3);
+ * if (variable_requirement_is_result_changed(req_3)) {
+ *     alert_condition_set_variable_requirement_result(alert_condition, req_3, req_3_result);
+ *     bool evaluation_result = alert_condition_get_result(alert_condition);
+ * }
  * ```
  *
  * @ref alert_condition_for_each can be used when a certain action needs to be performed for every variable requirement
@@ -77,6 +101,16 @@ extern "C"
  * alert_condition_reset.
  */
 
+/** Operator of an expression in an alert condition. */
+typedef enum AlertConditionOperator {
+    /** True if all operands are true. */
+    ALERT_CONDITION_OPERATOR_AND,
+    /** True if at least one operand is true. */
+    ALERT_CONDITION_OPERATOR_OR,
+    /** True if its only operand is false. */
+    ALERT_CONDITION_OPERATOR_NOT,
+} AlertConditionOperator;
+
 /**
  * @brief Defines callback type to execute for each variable requirement as a part of @ref alert_condition_for_each.
  *
@@ -97,7 +131,10 @@ AlertCondition alert_condition_create();
  * @brief Add a variable requirement to the alert condition.
  *
  * Raises an assert if CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS variable requirements are already added to
- * the alert condition.
+ * the alert condition, or if all CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS variable requirements that
+ * are shared by all alert conditions are in use. Also raises an assert if @p variable_requirement is a band requirement,
+ * and all alert conditions together already hold CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_BAND_REQUIREMENTS band
+ * requirements.
  *
  * @param self Alert condition instance returned by @ref alert_condition_create.
  * @param variable_requirement Variable requirement to add to the condition.
@@ -108,21 +145,80 @@ void alert_condition_add_variable_requirement(AlertCondition self, VariableRequi
  * @brief Singal that the next variable requirement added to the condition should belong to a new ORed requirement.
  *
  * @param self Alert condition instance returned by @ref alert_condition_create.
+ *
+ * @note Fires an assert if the condition has open expressions.
  */
 void alert_condition_start_new_ored_requirement(AlertCondition self);
 
+/**
+ * @brief Begin an expression.
+ *
+ * The expression is an operand of the enclosing expression, or of the current ORed requirement if there is no
+ * enclosing expression. Variable requirements and expressions added until the matching @ref
+ * alert_condition_end_expression are the operands of this expression.
+ *
+ * Only one alert condition can have expressions that were begun, but not ended, at a time. Raises an assert if
+ * CONFIG_ALERT_CONDITION_MAX_EXPRESSION_DEPTH expressions are already open, or if this is the second operand of a NOT
+ * expression.
+ *
+ * @param self Alert condition instance returned by @ref alert_condition_create.
+ * @param expression_operator Operator of the expression.
+ */
+void alert_condition_begin_expression(AlertCondition self, AlertConditionOperator expression_operator);
+
+/**
+ * @brief End the expression that was begun last.
+ *
+ * Raises an assert if there is no open expression, or if the expression has no operands.
+ *
+ * @param self Alert condition instance returned by @ref alert_condition_create.
+ */
+void alert_condition_end_expression(AlertCondition self);
+
 /**
  * @brief Evaluate the alert condition.
  *
+ * Evaluates every variable requirement in the alert condition, and stores their results. The stored results are used by
+ * @ref alert_condition_get_result.
+ *
  * @param self Alert condition instance returned by @ref alert_condition_create.
  *
  * @return true Alert condition evaluted to true.
  * @return false Alert condition evaluted to false.
  *
- * @note Fires an assert if the condition contains no variable requirements.
+ * @note Fires an assert if the condition contains no variable requirements, or if it has open expressions.
  */
 bool alert_condition_evaluate(AlertCondition self);
 
+/**
+ * @brief Report a new result of a variable requirement that is a part of the alert condition.
+ *
+ * Updates the result of the alert condition without evaluating any of its variable requirements. Reporting the same
+ * result as the one already stored for this variable requirement has no effect.
+ *
+ * Before the result of a variable requirement is reported for the first time, either with this function or by @ref
+ * alert_condition_evaluate, the variable requirement is considered not satisfied.
+ *
+ * @param self Alert condition instance returned by @ref alert_condition_create.
+ * @param variable_requirement Variable requirement whose result changed. Fires an assert if it was not added to this
+ * alert condition.
+ * @param result New result of @p variable_requirement.
+ */
+void alert_condition_set_variable_requirement_result(AlertCondition self, VariableRequirement variable_requirement,
+                                                     bool result);
+
+/**
+ * @brief Get the result of the alert condition based on the stored results of its variable requirements.
+ *
+ * @param self Alert condition instance returned by @ref alert_condition_create.
+ *
+ * @return true Alert condition is satisfied.
+ * @return false Alert condition is not satisfied.
+ *
+ * @note Fires an assert if the condition contains no variable requirements, or if it has open expressions.
+ */
+bool alert_condition_get_result(AlertCondition self);
+
 /**
  * @brief Execute a callback for each variable requirement currently in the alert condition.
  *
@@ -134,12 +230,54 @@ void alert_condition_for_each(AlertCondition self, AlertConditionForEachCb cb);
 /**
  * @brief Restore the alert condition as if the instance was just created.
  *
- * Removes all variable requirements from the alert condition.
+ * Removes all variable requirements from the alert condition, and drops its open expressions.
  *
  * @param self Alert condition instance returned by @ref alert_condition_create.
  */
 void alert_condition_reset(AlertCondition self);
 
+/**
+ * @brief Get the number of variable requirements that can still be added to alert conditions.
+ *
+ * Storage for variable requirements is shared by all alert conditions. Variable requirements removed from an alert
+ * condition by @ref alert_condition_reset can be added to any alert condition again.
+ *
+ * @return size_t Number of variable requirements that can be added, in total, to all alert conditions.
+ */
+size_t alert_condition_get_num_free_variable_requirements();
+
+/**
+ * @brief Get the maximum number of variable requirements that all alert conditions can hold together.
+ *
+ * @return size_t CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS.
+ */
+size_t alert_condition_get_max_total_num_variable_requirements();
+
+/**
+ * @brief Get the number of band requirements that can still be added to alert conditions.
+ *
+ * A band requirement takes two entries in a variable requirement list. Variable requirement lists reserve extra entries
+ * for CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_BAND_REQUIREMENTS band requirements, rather than for every variable
+ * requirement being a band requirement, so alert conditions keep track of how many band requirements are in use.
+ *
+ * @return size_t Number of band requirements that can be added, in total, to all alert conditions.
+ */
+size_t alert_condition_get_num_free_band_requirements();
+
+/**
+ * @brief Get the maximum number of band requirements that all alert conditions can hold together.
+ *
+ * @return size_t CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_BAND_REQUIREMENTS.
+ */
+size_t alert_condition_get_max_total_num_band_requirements();
+
+/**
+ * @brief Get the maximum number of expressions that can be open at the same time in an alert condition.
+ *
+ * @return size_t CONFIG_ALERT_CONDITION_MAX_EXPRESSION_DEPTH.
+ */
+size_t alert_condition_get_max_expression_depth();
+
 #ifdef __cplusplus
 }
 #endif
@@ -2,6 +2,7 @@
 
 #include "alert_conditions.h"
 #include "alert_condition.h"
+#include "alert_slots.h"
 #include "eas_assert.h"
 #include "config.h"
 
@@ -25,14 +26,26 @@ void alert_conditions_create_instances()
     }
 }
 
-AlertCondition alert_conditions_get_alert_condition(uint8_t alert_id)
+AlertCondition alert_conditions_get_alert_condition(uint16_t alert_id)
 {
-    bool is_valid_alert_id = (alert_id < CONFIG_ALERT_CONDITIONS_NUM_INSTANCES_TO_CREATE);
+    size_t slot = alert_slots_get_slot(alert_id);
+    bool is_valid_alert_id = (slot < CONFIG_ALERT_CONDITIONS_NUM_INSTANCES_TO_CREATE);
     EAS_ASSERT(is_valid_alert_id);
-    AlertCondition alert_condition = alert_condition_instances[alert_id];
+    AlertCondition alert_condition = alert_condition_instances[slot];
     /* This assert will fail if alert_conditions_create_instances has not been called yet. Since
      * the alert_condition_instances array is a static global, it is guaranteed to be initialized to 0.*/
     EAS_ASSERT(alert_condition);
 
     return alert_condition;
 }
+
+AlertCondition alert_conditions_get_alert_condition_in_slot(size_t slot)
+{
+    bool is_valid_slot = (slot < CONFIG_ALERT_CONDITIONS_NUM_INSTANCES_TO_CREATE);
+    EAS_ASSERT(is_valid_slot);
+    AlertCondition alert_condition = alert_condition_instances[slot];
+    /* Fails if alert_conditions_create_instances has not been called yet */
+    EAS_ASSERT(alert_condition);
+
+    return alert_condition;
+}
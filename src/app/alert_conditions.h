@@ -6,6 +6,7 @@ extern "C"
 {
 #endif
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "alert_condition_defs.h"
@@ -43,10 +44,25 @@ void alert_conditions_create_instances();
  *
  * @return AlertCondition Alert condition instance for the alert with id @p alert_id.
  *
- * @note Fires an assert if alert_id >= CONFIG_ALERT_CONDITIONS_NUM_INSTANCES_TO_CREATE is passed.
+ * @note Fires an assert if @p alert_id has no slot in the alert slots module.
  * @note Fires an assert if called before @ref alert_conditions_create_instances.
  */
-AlertCondition alert_conditions_get_alert_condition(uint8_t alert_id);
+AlertCondition alert_conditions_get_alert_condition(uint16_t alert_id);
+
+/**
+ * @brief Get alert condition instance in an alert slot.
+ *
+ * Same as @ref alert_conditions_get_alert_condition, but for callers that already know the slot of the alert. Avoids
+ * looking up the alert id in the alert slots module again.
+ *
+ * @param slot Slot of the alert, as returned by @ref alert_slots_get_slot.
+ *
+ * @return AlertCondition Alert condition instance for the alert with slot @p slot.
+ *
+ * @note Fires an assert if @p slot is not a valid slot.
+ * @note Fires an assert if called before @ref alert_conditions_create_instances.
+ */
+AlertCondition alert_conditions_get_alert_condition_in_slot(size_t slot);
 
 #ifdef __cplusplus
 }
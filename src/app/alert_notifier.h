@@ -32,7 +32,7 @@ extern "C"
  * @param is_raised If true, execute notifications that the alert is raised. Otherwise, execute notifications that the
  * alert is silenced.
  */
-void alert_notifier_notify(uint8_t alert_id, bool is_raised);
+void alert_notifier_notify(uint16_t alert_id, bool is_raised);
 
 #ifdef __cplusplus
 }
@@ -2,7 +2,7 @@
 
 #include "alert_raiser.h"
 #include "alert_notifier.h"
-#include "eas_timer.h"
+#include "utils/timer_wheel.h"
 #include "eas_assert.h"
 #include "config.h"
 
@@ -11,13 +11,13 @@
 #endif
 
 struct AlertRaiserStruct {
-    EasTimer warmup_timer;
+    TimerWheelTimer warmup_timer;
     uint32_t warmup_period_ms;
     bool is_warmup_timer_running;
-    EasTimer cooldown_timer;
+    TimerWheelTimer cooldown_timer;
     uint32_t cooldown_period_ms;
     bool is_cooldown_timer_running;
-    uint8_t alert_id;
+    uint16_t alert_id;
     bool is_alert_raised;
     bool is_alert_set;
 };
@@ -59,7 +59,7 @@ static void start_warmup_timer(AlertRaiser self)
 {
     EAS_ASSERT(self);
 
-    eas_timer_start(self->warmup_timer);
+    timer_wheel_timer_start(self->warmup_timer);
     self->is_warmup_timer_running = true;
 }
 
@@ -67,7 +67,7 @@ static void start_cooldown_timer(AlertRaiser self)
 {
     EAS_ASSERT(self);
 
-    eas_timer_start(self->cooldown_timer);
+    timer_wheel_timer_start(self->cooldown_timer);
     self->is_cooldown_timer_running = true;
 }
 
@@ -75,7 +75,7 @@ static void stop_warmup_timer(AlertRaiser self)
 {
     EAS_ASSERT(self);
 
-    eas_timer_stop(self->warmup_timer);
+    timer_wheel_timer_stop(self->warmup_timer);
     self->is_warmup_timer_running = false;
 }
 
@@ -83,7 +83,7 @@ static void stop_cooldown_timer(AlertRaiser self)
 {
     EAS_ASSERT(self);
 
-    eas_timer_stop(self->cooldown_timer);
+    timer_wheel_timer_stop(self->cooldown_timer);
     self->is_cooldown_timer_running = false;
 }
 
@@ -93,10 +93,10 @@ AlertRaiser alert_raiser_create()
     struct AlertRaiserStruct *instance = &instances[instance_idx];
     instance_idx++;
 
-    instance->warmup_timer = eas_timer_create(0, EAS_TIMER_ONE_SHOT, warmup_period_expired_cb, instance);
+    instance->warmup_timer = timer_wheel_timer_create(0, warmup_period_expired_cb, instance);
     instance->warmup_period_ms = 0;
     instance->is_warmup_timer_running = false;
-    instance->cooldown_timer = eas_timer_create(0, EAS_TIMER_ONE_SHOT, cooldown_period_expired_cb, instance);
+    instance->cooldown_timer = timer_wheel_timer_create(0, cooldown_period_expired_cb, instance);
     instance->cooldown_period_ms = 0;
     instance->is_cooldown_timer_running = false;
     instance->alert_id = 0;
@@ -106,16 +106,16 @@ AlertRaiser alert_raiser_create()
     return instance;
 }
 
-void alert_raiser_set_alert(AlertRaiser self, uint8_t alert_id, uint32_t warmup_period_ms, uint32_t cooldown_period_ms)
+void alert_raiser_set_alert(AlertRaiser self, uint16_t alert_id, uint32_t warmup_period_ms, uint32_t cooldown_period_ms)
 {
     EAS_ASSERT(self);
     EAS_ASSERT(!self->is_alert_set);
 
     if (warmup_period_ms > 0) {
-        eas_timer_set_period(self->warmup_timer, warmup_period_ms);
+        timer_wheel_timer_set_period(self->warmup_timer, warmup_period_ms);
     }
     if (cooldown_period_ms > 0) {
-        eas_timer_set_period(self->cooldown_timer, cooldown_period_ms);
+        timer_wheel_timer_set_period(self->cooldown_timer, cooldown_period_ms);
     }
 
     self->warmup_period_ms = warmup_period_ms;
@@ -95,7 +95,8 @@ AlertRaiser alert_raiser_create();
  * @warning If this function is called when an alert is already set, this function fires an assert. Call @ref
  * alert_raiser_unset_alert first to unset the old alert, and then call this function to set the new one.
  */
-void alert_raiser_set_alert(AlertRaiser self, uint8_t alert_id, uint32_t warmup_period_ms, uint32_t cooldown_period_ms);
+void alert_raiser_set_alert(AlertRaiser self, uint16_t alert_id, uint32_t warmup_period_ms,
+                            uint32_t cooldown_period_ms);
 
 /**
  * @brief Unset alert.
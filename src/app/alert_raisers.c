@@ -2,6 +2,7 @@
 
 #include "alert_raisers.h"
 #include "alert_raiser.h"
+#include "alert_slots.h"
 #include "eas_assert.h"
 #include "config.h"
 
@@ -25,14 +26,26 @@ void alert_raisers_create_instances()
     }
 }
 
-AlertRaiser alert_raisers_get_alert_raiser(uint8_t alert_id)
+AlertRaiser alert_raisers_get_alert_raiser(uint16_t alert_id)
 {
-    bool is_valid_alert_id = (alert_id < CONFIG_ALERT_RAISERS_NUM_INSTANCES_TO_CREATE);
+    size_t slot = alert_slots_get_slot(alert_id);
+    bool is_valid_alert_id = (slot < CONFIG_ALERT_RAISERS_NUM_INSTANCES_TO_CREATE);
     EAS_ASSERT(is_valid_alert_id);
-    AlertRaiser alert_raiser = alert_raiser_instances[alert_id];
+    AlertRaiser alert_raiser = alert_raiser_instances[slot];
     /* This assert will fail if alert_raisers_create_instances has not been called yet. Since
      * the alert_raiser_instances array is a static global, it is guaranteed to be initialized to 0.*/
     EAS_ASSERT(alert_raiser);
 
     return alert_raiser;
 }
+
+AlertRaiser alert_raisers_get_alert_raiser_in_slot(size_t slot)
+{
+    bool is_valid_slot = (slot < CONFIG_ALERT_RAISERS_NUM_INSTANCES_TO_CREATE);
+    EAS_ASSERT(is_valid_slot);
+    AlertRaiser alert_raiser = alert_raiser_instances[slot];
+    /* Fails if alert_raisers_create_instances has not been called yet */
+    EAS_ASSERT(alert_raiser);
+
+    return alert_raiser;
+}
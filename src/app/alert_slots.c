@@ -0,0 +1,124 @@
+#include <string.h>
+
+#include "alert_slots.h"
+#include "eas_assert.h"
+#include "util.h"
+#include "config.h"
+
+#ifndef CONFIG_ALERT_SLOTS_NUM_SLOTS
+#define CONFIG_ALERT_SLOTS_NUM_SLOTS 1
+#endif
+
+/* Slots are stored as uint16_t */
+EAS_STATIC_ASSERT(CONFIG_ALERT_SLOTS_NUM_SLOTS <= UINT16_MAX);
+
+/** Alert ids that have a slot, in ascending order */
+static uint16_t alert_ids[CONFIG_ALERT_SLOTS_NUM_SLOTS];
+/** slots[i] is the slot of alert_ids[i] */
+static uint16_t slots[CONFIG_ALERT_SLOTS_NUM_SLOTS];
+static size_t num_alert_ids = 0;
+
+/** Stack of free slots. Elements [0, num_free_slots) are valid. */
+static uint16_t free_slots[CONFIG_ALERT_SLOTS_NUM_SLOTS];
+static size_t num_free_slots = 0;
+static bool is_initialized = false;
+
+/**
+ * @brief Put all slots on the stack of free slots, if it has not been done yet.
+ */
+static void initialize_free_slots()
+{
+    if (is_initialized) {
+        return;
+    }
+    /* Pushed in reverse, so that slots are assigned in ascending order starting from 0 */
+    for (size_t i = 0; i < CONFIG_ALERT_SLOTS_NUM_SLOTS; i++) {
+        free_slots[i] = (uint16_t)(CONFIG_ALERT_SLOTS_NUM_SLOTS - 1 - i);
+    }
+    num_free_slots = CONFIG_ALERT_SLOTS_NUM_SLOTS;
+    is_initialized = true;
+}
+
+/**
+ * @brief Find the index in alert_ids at which an alert id is, or should be inserted.
+ *
+ * @param alert_id Alert id.
+ *
+ * @return size_t Index of the first element in alert_ids that is >= @p alert_id, num_alert_ids if there is none.
+ */
+static size_t find_idx(uint16_t alert_id)
+{
+    size_t low = 0;
+    size_t high = num_alert_ids;
+    while (low < high) {
+        size_t mid = low + ((high - low) / 2);
+        if (alert_ids[mid] < alert_id) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+bool alert_slots_add(uint16_t alert_id)
+{
+    initialize_free_slots();
+
+    size_t idx = find_idx(alert_id);
+    bool has_slot = ((idx < num_alert_ids) && (alert_ids[idx] == alert_id));
+    EAS_ASSERT(!has_slot);
+    if (num_free_slots == 0) {
+        return false;
+    }
+
+    /* Keep alert ids sorted */
+    size_t num_to_move = num_alert_ids - idx;
+    memmove(&alert_ids[idx + 1], &alert_ids[idx], num_to_move * sizeof(alert_ids[0]));
+    memmove(&slots[idx + 1], &slots[idx], num_to_move * sizeof(slots[0]));
+    num_free_slots--;
+    alert_ids[idx] = alert_id;
+    slots[idx] = free_slots[num_free_slots];
+    num_alert_ids++;
+    return true;
+}
+
+void alert_slots_remove(uint16_t alert_id)
+{
+    size_t idx = find_idx(alert_id);
+    bool has_slot = ((idx < num_alert_ids) && (alert_ids[idx] == alert_id));
+    EAS_ASSERT(has_slot);
+
+    free_slots[num_free_slots] = slots[idx];
+    num_free_slots++;
+    size_t num_to_move = num_alert_ids - idx - 1;
+    memmove(&alert_ids[idx], &alert_ids[idx + 1], num_to_move * sizeof(alert_ids[0]));
+    memmove(&slots[idx], &slots[idx + 1], num_to_move * sizeof(slots[0]));
+    num_alert_ids--;
+}
+
+size_t alert_slots_get_slot(uint16_t alert_id)
+{
+    size_t idx = find_idx(alert_id);
+    if ((idx < num_alert_ids) && (alert_ids[idx] == alert_id)) {
+        return slots[idx];
+    }
+    return ALERT_SLOTS_NO_SLOT;
+}
+
+size_t alert_slots_get_num_alert_ids()
+{
+    return num_alert_ids;
+}
+
+uint16_t alert_slots_get_alert_id(size_t idx)
+{
+    EAS_ASSERT(idx < num_alert_ids);
+    return alert_ids[idx];
+}
+
+void alert_slots_reset()
+{
+    num_alert_ids = 0;
+    is_initialized = false;
+}
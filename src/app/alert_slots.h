@@ -0,0 +1,101 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_APP_ALERT_SLOTS_H
+#define ENV_ALERT_SYSTEM_SRC_APP_ALERT_SLOTS_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Maps alert ids of the alerts in the system to slots.
+ *
+ * Alert ids are chosen by clients and can be anywhere in the uint16_t range. Per-alert data, such as alert raiser and
+ * alert condition instances, is stored in arrays with CONFIG_ALERT_SLOTS_NUM_SLOTS elements - one for each alert that
+ * can be in the system at the same time. This module assigns each added alert a slot - an index into these arrays - so
+ * that no memory is reserved for alert ids that are not used.
+ *
+ * Alert ids are kept in a sorted array, so looking up the slot of an alert id is a binary search.
+ *
+ * # Usage
+ * ```
+ * // Assign a slot to alert id 1000 when the alert is added
+ * alert_slots_add(1000);
+ * // Look up the slot of the alert
+ * size_t slot = alert_slots_get_slot(1000);
+ * // Free the slot when the alert is removed
+ * alert_slots_remove(1000);
+ * ```
+ */
+
+/** Returned by @ref alert_slots_get_slot for alert ids that have no slot */
+#define ALERT_SLOTS_NO_SLOT SIZE_MAX
+
+/**
+ * @brief Assign a free slot to an alert id.
+ *
+ * @param alert_id Alert id. Must not have a slot yet.
+ *
+ * @return true Slot assigned.
+ * @return false All CONFIG_ALERT_SLOTS_NUM_SLOTS slots are occupied. Nothing is done.
+ *
+ * @note Fires an assert if @p alert_id already has a slot.
+ */
+bool alert_slots_add(uint16_t alert_id);
+
+/**
+ * @brief Free the slot of an alert id.
+ *
+ * The slot can be assigned to another alert id afterwards.
+ *
+ * @param alert_id Alert id.
+ *
+ * @note Fires an assert if @p alert_id has no slot.
+ */
+void alert_slots_remove(uint16_t alert_id);
+
+/**
+ * @brief Get the slot of an alert id.
+ *
+ * @param alert_id Alert id.
+ *
+ * @return size_t Slot of @p alert_id, in the range [0, CONFIG_ALERT_SLOTS_NUM_SLOTS). ALERT_SLOTS_NO_SLOT if @p
+ * alert_id has no slot.
+ */
+size_t alert_slots_get_slot(uint16_t alert_id);
+
+/**
+ * @brief Get the number of alert ids that have a slot.
+ *
+ * @return size_t Number of alert ids that have a slot.
+ */
+size_t alert_slots_get_num_alert_ids();
+
+/**
+ * @brief Get an alert id that has a slot.
+ *
+ * Together with @ref alert_slots_get_num_alert_ids, allows to iterate over all alert ids that have a slot, in ascending
+ * order. Adding or removing alert ids changes the indices of the other alert ids. Iterating from the last index to the
+ * first allows to remove the alert id at the current index while iterating.
+ *
+ * @param idx Index of the alert id, in the range [0, @ref alert_slots_get_num_alert_ids()).
+ *
+ * @return uint16_t Alert id with index @p idx.
+ */
+uint16_t alert_slots_get_alert_id(size_t idx);
+
+/**
+ * @brief Reset the state of this module to the initial state.
+ *
+ * After a call to this function, no alert id has a slot.
+ */
+void alert_slots_reset();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_APP_ALERT_SLOTS_H */
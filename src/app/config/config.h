@@ -23,9 +23,15 @@
 #define CONFIG_ALERT_CONDITION_MAX_NUM_INSTANCES
 #define CONFIG_ALERT_RAISER_MAX_NUM_INSTANCES
 #define CONFIG_EAS_TIMER_MAX_NUM_INSTANCES
+#define CONFIG_TIMER_WHEEL_MAX_NUM_TIMERS
 #define CONFIG_OPS_QUEUE_MAX_NUM_INSTANCES
+#define CONFIG_INIT_GRAPH_MAX_NUM_INSTANCES
 #define CONFIG_EAS_RING_BUF_MAX_NUM_INSTANCES
 
+/** Maximal number of pending operations of one ops queue instance, i.e. maximal num_ops - 1 passed to ops_queue_create.
+ * Every ops queue instance reserves a priority for this many pending operations. */
+#define CONFIG_OPS_QUEUE_MAX_NUM_PENDING_OPS
+
 /** Maximal size of one variable requirement in bytes. We have different variable requirement types - e.g.
  * TemperatureVariableRequirement, PressureVariableRequirement, and so on. Each of these types might have a different
  * size, because the sizes of data types such as Temperature and Pressure can be different. This config defines the size
@@ -43,45 +49,87 @@
  * likely, should be set to CONFIG_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION. */
 #define CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS
 
+/** Maximal number of variable requirements in all alert conditions together. Storage for variable requirements is
+ * shared by all alert conditions, so it is sized by this config rather than by the maximal number of variable
+ * requirements in every alert condition. Should be set to CONFIG_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS. */
+#define CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS
+
+/** Maximal number of band requirements in all alert conditions together. Alert conditions keep track of the number of
+ * band requirements in use, so that alerts can be checked against this budget before they are added. Should be set to
+ * CONFIG_MAX_TOTAL_NUM_BAND_REQUIREMENTS. */
+#define CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_BAND_REQUIREMENTS
+
 /** Message transceiver converts "add alert" message payload to structured data. This defines how many variable
  * conditions can be stored in the alert condition of the alert to be added. Most likely, should be set to
  * CONFIG_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION. */
 #define CONFIG_MSG_TRANSCEIVER_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION
 
+/** Maximal allowed nesting depth of AND, OR and NOT expressions in one alert condition. An alert condition without
+ * expressions has depth 0. */
+#define CONFIG_MAX_ALERT_CONDITION_EXPRESSION_DEPTH
+
+/** Maximal nesting depth of expressions in one alert condition - config for the alert_condition module. Defines how
+ * many expressions can be open at the same time while an alert condition is populated. Memory for open expressions is
+ * shared by all alert conditions, so only one alert condition can have open expressions at a time. Should be set to
+ * CONFIG_MAX_ALERT_CONDITION_EXPRESSION_DEPTH. */
+#define CONFIG_ALERT_CONDITION_MAX_EXPRESSION_DEPTH
+
+/** Maximal nesting depth of expressions in the alert condition of an alert received by the message transceiver. Alerts
+ * with deeper expressions are rejected. Should be set to CONFIG_MAX_ALERT_CONDITION_EXPRESSION_DEPTH. */
+#define CONFIG_MSG_TRANSCEIVER_MAX_EXPRESSION_DEPTH
+
 /** Maximal number of alerts that can be registered in the system at the same time. */
 #define CONFIG_MAX_NUM_ALERTS
 
-/** Defines how many variable requirements the system should be able to store simultaneously. Should be set to the
- * maximal number of allowed alerts times the maximal number of variable requirement per alert, i.e.
- * (CONFIG_MAX_NUM_ALERTS * CONFIG_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION). */
+/** Defines how many variable requirements the system should be able to store simultaneously. Setting it to the maximal
+ * number of allowed alerts times the maximal number of variable requirement per alert, i.e.
+ * (CONFIG_MAX_NUM_ALERTS * CONFIG_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION), guarantees that every valid alert
+ * can be added. It can be set lower to support more alerts with fewer variable requirements each - alerts whose
+ * variable requirements do not fit anymore are then not added. */
 #define CONFIG_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS
 
+/** Defines how many of the variable requirements that the system stores can be band requirements at the same time. A
+ * band requirement takes two entries in a variable requirement list, so every list reserves this many entries on top
+ * of CONFIG_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS. Setting it to CONFIG_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS guarantees
+ * that every valid alert can be added. It can be set lower to save memory - alerts whose band requirements do not fit
+ * anymore are then not added. */
+#define CONFIG_MAX_TOTAL_NUM_BAND_REQUIREMENTS
+
 /** Maximum number of variable requirements that can be simultaneously allocated by the variable requirement allocator.
  * Should be set to CONFIG_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS. */
 #define CONFIG_VARIABLE_REQUIREMENT_ALLOCATOR_NUM_REQUIREMENTS
 
+/** Maximum number of entries that one variable requirement list can hold. Every list reserves memory for this many
+ * entries. A requirement takes one entry, a band requirement takes two - one for each of its requirement values.
+ * Should be set to (CONFIG_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS + CONFIG_MAX_TOTAL_NUM_BAND_REQUIREMENTS), because in
+ * the worst case all variable requirements of all alerts are for the same variable, and all band requirements are
+ * among them. An entry takes 12 bytes on 32-bit targets, in addition to the variable requirement allocator block. */
+#define CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_REQUIREMENTS
+
+/** Defines how many alerts can have a slot in the AlertSlots module at the same time. Set to CONFIG_MAX_NUM_ALERTS. */
+#define CONFIG_ALERT_SLOTS_NUM_SLOTS
+
 /** Defines how many AlertCondition instances the AlertConditions module creates. Set to CONFIG_MAX_NUM_ALERTS. */
 #define CONFIG_ALERT_CONDITIONS_NUM_INSTANCES_TO_CREATE
 
 /** Defines how many AlertRaiser instances the AlertRaisers module creates. Set to CONFIG_MAX_NUM_ALERTS. */
 #define CONFIG_ALERT_RAISERS_NUM_INSTANCES_TO_CREATE
 
-/** Defines the highest valid alert ID. Set to (CONFIG_MAX_NUM_ALERTS - 1). */
+/** Defines the highest valid alert ID. Alert ids do not have to be contiguous, since the AlertSlots module maps them to
+ * slots. Set to UINT16_MAX, or lower to restrict the alert ids that clients can use. */
 #define CONFIG_ALERT_VALIDATOR_MAX_ALLOWED_ALERT_ID
 
 /**
- * @brief Defines the valid alert ids for which a connectivity notification can be sent.
+ * @brief Defines the number of alert slots for which a connectivity notification can be sent.
  *
- * The valid alert ids are from 0 to CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS - 1, both including. Set to
- * CONFIG_MAX_NUM_ALERTS.
+ * Alert ids are mapped to slots by the AlertSlots module. Set to CONFIG_ALERT_SLOTS_NUM_SLOTS.
  */
 #define CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS
 
 /**
- * @brief Defines the valid alert ids for which a led notification can be sent.
+ * @brief Defines the number of alert slots for which a led notification can be sent.
  *
- * The valid alert ids are from 0 to CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS - 1, both including. Set to
- * CONFIG_MAX_NUM_ALERTS.
+ * Alert ids are mapped to slots by the AlertSlots module. Set to CONFIG_ALERT_SLOTS_NUM_SLOTS.
  */
 #define CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS
 
@@ -122,31 +170,115 @@
 #define CONFIG_LED_MANAGER_IGNORE_TIMER_MARGIN_MS
 
 /**
- * @brief Defines the number of alert status change messages that can be in the process of being sent at the same time.
+ * @brief Defines the number of messages that can be in the process of being sent at the same time.
+ *
+ * Message transceiver is an asynchronous interface. The user calls one of the msg_transceiver_send_* functions, and
+ * gets notified when the message is sent via a callback. Every message occupies one message slot until it is sent, no
+ * matter its kind, so several messages can be in the progress of being sent at the same time.
  *
- * Message transceiver is an asynchronous interface. The user calls @ref
- * msg_transceiver_send_alert_status_change_message, and gets notified when the message is sent via a callback. The user
- * can call @ref msg_transceiver_send_alert_status_change_message many times in quick succession, which would mean that
- * several "alert status change" messages are now in the progress of being sent.
+ * If a message is sent when all slots that its kind of message may use are occupied, that message will fail to get
+ * sent.
+ */
+#define CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS
+
+/**
+ * @brief Defines how many of the CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS message slots are reserved for "alert status
+ * change" and "alert status changes" messages.
  *
- * If @ref msg_transceiver_send_alert_status_change_message is called when the maximum allowed number of alert status
- * change messages is already in the process of being sent, that message will fail to get sent.
+ * Stats and sample history messages only get a slot while more than this number of slots is free, so a stats report
+ * or a sample history read-out can never make an alert status change fail to get sent. Must be <=
+ * CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS.
  */
-#define CONFIG_MSG_TRANSCEIVER_MAX_NUM_CONCURRENT_ALERT_STATUS_CHANGE_MESSAGES
+#define CONFIG_MSG_TRANSCEIVER_NUM_RESERVED_MESSAGE_SLOTS
 
-/** Defines the buffer size in bytes of the internal ring buffer used in the message queue for the central event queue.
+/**
+ * @brief Maximum number of alert status change records in one "alert status changes" message.
+ *
+ * Alert status changes that happen while handling one event are reported together in one "alert status changes"
+ * message. The message consists of 2 header bytes and 3 bytes per record, and it should fit into a single notification
+ * of the underlying connectivity medium. If more alert status changes happen while handling one event, they are split
+ * into several messages.
  */
-#define CONFIG_CENTRAL_EVENT_QUEUE_MESSAGE_QUEUE_BUF_SIZE
+#define CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERT_STATUS_CHANGES_IN_MESSAGE
 
-/** Maximum number of linked list nodes that can be simultaneously allocated by the linked list node allocator.
- * Should be set to (CONFIG_MAX_NUM_ALERTS + CONFIG_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS). We need CONFIG_MAX_NUM_ALERTS
- * nodes for LedManager - one node for each added LedNotification. We also need nodes
- * CONFIG_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS for variable requirements. */
+/**
+ * @brief Maximum number of alerts in one "replace all alerts" message.
+ *
+ * Message transceiver stores all alerts of a "replace all alerts" message before passing them on, so this defines the
+ * size of that storage. Should be set to CONFIG_MAX_NUM_ALERTS, so that a device can be provisioned with all of its
+ * alerts in one message.
+ */
+#define CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERTS_IN_REPLACE_ALL_ALERTS_MESSAGE
+
+/** Defines the number of events that can be in the central event queue at the same time. Every slot can hold any event,
+ * so this is independent of the event types. The highest number of slots that were occupied at the same time is
+ * reported in the "event queue stats" message, which can be used to size the queue from data. */
+#define CONFIG_CENTRAL_EVENT_QUEUE_NUM_SLOTS
+
+/** Set to 1 to coalesce sensor samples in the central event queue, 0 to handle every sample. Defaults to 0.
+ *
+ * If set to 1, each variable has a mailbox that holds only its latest sample. When the event queue falls behind, a new
+ * sample overwrites the one that has not been handled yet, so at most one sample per variable waits in the queue, and
+ * stale samples are never evaluated. Multi samples have one more mailbox, which holds the latest sample of every
+ * variable they contain. */
+#define CONFIG_CENTRAL_EVENT_QUEUE_COALESCE_SAMPLES
+
+/** Maximum number of linked list nodes that can be simultaneously allocated by the linked list node allocator. The
+ * application does not use linked lists, so this can be set to 1. */
 #define CONFIG_LINKED_LIST_NODE_ALLOCATOR_NUM_NODES
 
-/** Maximum number of led notifications that can be simultaneously allocated by the led notification allocator. Should
- * be set to CONFIG_MAX_NUM_ALERTS. LedManager is the only module that allocates led notifications, and it can allocate
- * at most one for each alert. */
-#define CONFIG_LED_NOTIFICATION_ALLOCATOR_NUM_NOTIFICATIONS
+/** Tick of the timer wheel in ms. Timer wheel timers expire at most this much later than their period elapses. The
+ * EasTimer that drives the timer wheel only expires on ticks on which timer wheel timers expire, so smaller values give
+ * more precise warmup and cooldown periods, at the cost of fewer timers sharing one EasTimer expiry. */
+#define CONFIG_TIMER_WHEEL_TICK_MS
+
+/** Number of slots in the timer wheel. One revolution of the wheel takes CONFIG_TIMER_WHEEL_NUM_SLOTS *
+ * CONFIG_TIMER_WHEEL_TICK_MS. Timers with longer periods are still supported. More slots use more RAM, but spread the
+ * timers more evenly across the slots. */
+#define CONFIG_TIMER_WHEEL_NUM_SLOTS
+
+/** Size of one sample history block in bytes, at most 256. Sample history is read out one block at a time, and every
+ * block starts with the current values of all variables, so larger blocks have less overhead. Must be large enough for
+ * the block time and one record of each variable - 44 bytes. */
+#define CONFIG_SAMPLE_HISTORY_BLOCK_SIZE
+
+/** Number of full blocks that sample history stores. Once all of them are full, the oldest block is discarded whenever
+ * a new block is stored. Sample history uses one eas_ring_buf instance to store the blocks. */
+#define CONFIG_SAMPLE_HISTORY_NUM_BLOCKS
+
+/** Minimum time in ms between two recorded samples of the same variable. Samples within this time of the last recorded
+ * sample of their variable are not recorded. Bounds the rate at which sample history fills up, however noisy the
+ * samples are. 0 records every sample that changes its value by the minimum change. */
+#define CONFIG_SAMPLE_HISTORY_MIN_INTERVAL_MS
+
+/** Minimum change of each variable that sample history records, in units of that variable. Samples that differ from
+ * the last recorded value by less are not recorded. Values larger than the sensor noise keep noise out of the history.
+ * 1 records every change. */
+#define CONFIG_SAMPLE_HISTORY_TEMPERATURE_MIN_CHANGE
+#define CONFIG_SAMPLE_HISTORY_PRESSURE_MIN_CHANGE
+#define CONFIG_SAMPLE_HISTORY_HUMIDITY_MIN_CHANGE
+#define CONFIG_SAMPLE_HISTORY_LIGHT_INTENSITY_MIN_CHANGE
+
+/** Minimum and maximum readout period of the temperature sensor in ms, and the maximum rate of change of temperature in
+ * Temperature units per second. The readout period is the time it takes temperature to reach the nearest requirement
+ * value at the maximum rate of change, limited to [min, max]. If max is equal to min, the readout period is fixed. */
+#define CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MIN_PERIOD_MS
+#define CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_PERIOD_MS
+#define CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_RATE_OF_CHANGE
+
+/** Same as the temperature sensor readout period configs, for pressure. */
+#define CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MIN_PERIOD_MS
+#define CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MAX_PERIOD_MS
+#define CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MAX_RATE_OF_CHANGE
+
+/** Same as the temperature sensor readout period configs, for humidity. */
+#define CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MIN_PERIOD_MS
+#define CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MAX_PERIOD_MS
+#define CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MAX_RATE_OF_CHANGE
+
+/** Same as the temperature sensor readout period configs, for light intensity. */
+#define CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MIN_PERIOD_MS
+#define CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MAX_PERIOD_MS
+#define CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MAX_RATE_OF_CHANGE
 
 #endif /* ENV_ALERT_SYSTEM_SRC_APP_CONFIG_CONFIG_H */
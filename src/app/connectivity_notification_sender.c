@@ -1,11 +1,36 @@
+#include <stddef.h>
+
 #include "connectivity_notification_sender.h"
 #include "msg_transceiver.h"
 #include "eas_log.h"
 
 EAS_LOG_ENABLE_IN_FILE();
 
-void connectivity_notification_sender_send(uint8_t alert_id, bool is_raised)
+/* Notifications that are not sent yet, in the order in which they were requested */
+static MsgTransceiverAlertStatusChange pending_changes[CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERT_STATUS_CHANGES_IN_MESSAGE];
+static size_t num_pending_changes = 0;
+
+void connectivity_notification_sender_send(uint16_t alert_id, bool is_raised)
 {
     EAS_LOG_INF("Sending connectivity notification for alert id %u, raised: %d", alert_id, is_raised);
-    msg_transceiver_send_alert_status_change_message(alert_id, is_raised, NULL, NULL);
+    if (num_pending_changes == CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERT_STATUS_CHANGES_IN_MESSAGE) {
+        /* One message cannot hold more changes. Send the ones collected so far and start collecting again. */
+        connectivity_notification_sender_flush();
+    }
+    pending_changes[num_pending_changes].alert_id = alert_id;
+    pending_changes[num_pending_changes].is_raised = is_raised;
+    num_pending_changes++;
+}
+
+void connectivity_notification_sender_flush()
+{
+    if (num_pending_changes == 1) {
+        /* Use the single alert status change message, so that clients that only understand that message keep receiving
+         * notifications whenever only one alert changes status */
+        msg_transceiver_send_alert_status_change_message(pending_changes[0].alert_id, pending_changes[0].is_raised,
+                                                         NULL, NULL);
+    } else if (num_pending_changes > 1) {
+        msg_transceiver_send_alert_status_changes_message(pending_changes, num_pending_changes, NULL, NULL);
+    }
+    num_pending_changes = 0;
 }
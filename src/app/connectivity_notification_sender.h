@@ -16,13 +16,21 @@ extern "C"
  *
  * ConnectivityNotifier calls this function whenever a notification that an alert is raised/silenced needs to be sent
  * via connectivity. This abstract interface guarantees that such a notification is sent whenever this function is
- * called.
+ * called, at the latest when @ref connectivity_notification_sender_flush is called next.
  *
  * @param alert_id Alert id of the alert to be raised or silenced.
  * @param is_raised If true, sends a notification that the alert is raised. Otherwise, sends a notification that the
  * alert is silenced.
  */
-void connectivity_notification_sender_send(uint8_t alert_id, bool is_raised);
+void connectivity_notification_sender_send(uint16_t alert_id, bool is_raised);
+
+/**
+ * @brief Send all connectivity notifications that are not sent yet.
+ *
+ * Notifications passed to @ref connectivity_notification_sender_send can be held back, so that notifications produced
+ * while handling one event are sent together. This function should be called once handling of an event is complete.
+ */
+void connectivity_notification_sender_flush();
 
 #ifdef __cplusplus
 }
@@ -1,5 +1,8 @@
+#include <stddef.h>
+
 #include "connectivity_notifier.h"
 #include "connectivity_notification_sender.h"
+#include "alert_slots.h"
 #include "config.h"
 #include "eas_assert.h"
 
@@ -9,30 +12,42 @@
 
 static bool enabled_notifications[CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS];
 
-static bool is_valid_alert_id(uint8_t alert_id)
+/**
+ * @brief Get the slot of an alert id.
+ *
+ * @param alert_id Alert id.
+ *
+ * @return size_t Slot of @p alert_id, used as an index into the per-alert arrays of this module.
+ *
+ * @note Fires an assert if @p alert_id has no slot.
+ */
+static size_t get_slot(uint16_t alert_id)
 {
-    return (alert_id < CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS);
+    size_t slot = alert_slots_get_slot(alert_id);
+    bool is_valid_alert_id = (slot < CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS);
+    EAS_ASSERT(is_valid_alert_id);
+    return slot;
 }
 
-void connectivity_notifier_enable_notifications(uint8_t alert_id)
+void connectivity_notifier_enable_notifications(uint16_t alert_id)
 {
-    EAS_ASSERT(is_valid_alert_id(alert_id));
+    size_t slot = get_slot(alert_id);
 
-    enabled_notifications[alert_id] = true;
+    enabled_notifications[slot] = true;
 }
 
-void connectivity_notifier_disable_notifications(uint8_t alert_id)
+void connectivity_notifier_disable_notifications(uint16_t alert_id)
 {
-    EAS_ASSERT(is_valid_alert_id(alert_id));
+    size_t slot = get_slot(alert_id);
 
-    enabled_notifications[alert_id] = false;
+    enabled_notifications[slot] = false;
 }
 
-void connectivity_notifier_notify(uint8_t alert_id, bool is_raised)
+void connectivity_notifier_notify(uint16_t alert_id, bool is_raised)
 {
-    EAS_ASSERT(is_valid_alert_id(alert_id));
+    size_t slot = get_slot(alert_id);
 
-    if (enabled_notifications[alert_id]) {
+    if (enabled_notifications[slot]) {
         connectivity_notification_sender_send(alert_id, is_raised);
     }
 }
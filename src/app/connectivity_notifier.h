@@ -22,6 +22,8 @@ extern "C"
  * Connectivity notifications can be enabled for an alert by calling @ref connectivity_notifier_enable_notifications
  * with the alert id of the alert. Similarly, connectivity notifications can be disabled for an alert by calling @ref
  * connectivity_notifier_disable_notifications with the alert id of the alert.
+ *
+ * All functions of this module fire an assert if the alert id has no slot in the alert slots module.
  */
 
 /**
@@ -32,7 +34,7 @@ extern "C"
  *
  * @param alert_id Alert id.
  */
-void connectivity_notifier_enable_notifications(uint8_t alert_id);
+void connectivity_notifier_enable_notifications(uint16_t alert_id);
 
 /**
  * @brief Disable connectivity notifications for an alert.
@@ -42,7 +44,7 @@ void connectivity_notifier_enable_notifications(uint8_t alert_id);
  *
  * @param alert_id Alert id.
  */
-void connectivity_notifier_disable_notifications(uint8_t alert_id);
+void connectivity_notifier_disable_notifications(uint16_t alert_id);
 
 /**
  * @brief Send a connectivity notification for an alert if the notifications are enabled.
@@ -55,7 +57,7 @@ void connectivity_notifier_disable_notifications(uint8_t alert_id);
  * @param is_raised If true, sends a notification that the alert is raised. Otherwise, sends a notification that the
  * alert is silenced. This only applies if connectivity notifications are currently enabled for this alert.
  */
-void connectivity_notifier_notify(uint8_t alert_id, bool is_raised);
+void connectivity_notifier_notify(uint16_t alert_id, bool is_raised);
 
 #ifdef __cplusplus
 }
@@ -7,6 +7,7 @@
 #include "connectivity_notifier.h"
 #include "led_notifier.h"
 #include "alert_conditions.h"
+#include "alert_slots.h"
 #include "alert_condition.h"
 #include "temperature_requirement.h"
 #include "pressure_requirement.h"
@@ -18,6 +19,8 @@
 #include "light_intensity_requirement_list.h"
 #include "alert_evaluation_readiness.h"
 #include "alert_validator.h"
+#include "alert_remover.h"
+#include "sensor_readout_scheduler.h"
 #include "eas_log.h"
 
 EAS_LOG_ENABLE_IN_FILE();
@@ -80,30 +83,70 @@ map_msg_transceiver_operator_to_variable_requirement_operator(MsgTransceiverRequ
         return VARIABLE_REQUIREMENT_OPERATOR_GEQ;
     case MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_LEQ:
         return VARIABLE_REQUIREMENT_OPERATOR_LEQ;
+    case MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_INSIDE:
+        return VARIABLE_REQUIREMENT_OPERATOR_INSIDE;
+    case MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_OUTSIDE:
+        return VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE;
     default:
         EAS_ASSERT(0);
         return VARIABLE_REQUIREMENT_OPERATOR_GEQ;
     }
 }
 
-void alert_adder_add_alert(const MsgTransceiverAlert *const alert, void *user_data)
+/**
+ * @brief Map expression operator from message transceiver to expression operator from alert condition module.
+ *
+ * @param expression_operator Message transceiver expression operator. Use one of the values from
+ * @ref MsgTransceiverExpressionOperator.
+ *
+ * @return AlertConditionOperator Corresponding expression operator from alert condition module. If
+ * @p expression_operator is invalid, an assert is raised.
+ */
+static AlertConditionOperator map_msg_transceiver_expression_operator_to_alert_condition_operator(
+    uint8_t expression_operator)
 {
-    EAS_ASSERT(alert);
-
-    EAS_LOG_INF("Adding alert: id %u, warmup %u, cooldown %u, connectivity notification %u, led notification %u",
-                alert->alert_id, alert->warmup_period, alert->cooldown_period, alert->notification_type.connectivity,
-                alert->notification_type.led);
+    switch (expression_operator) {
+    case MSG_TRANSCEIVER_EXPRESSION_OPERATOR_AND:
+        return ALERT_CONDITION_OPERATOR_AND;
+    case MSG_TRANSCEIVER_EXPRESSION_OPERATOR_OR:
+        return ALERT_CONDITION_OPERATOR_OR;
+    case MSG_TRANSCEIVER_EXPRESSION_OPERATOR_NOT:
+        return ALERT_CONDITION_OPERATOR_NOT;
+    default:
+        EAS_ASSERT(0);
+        return ALERT_CONDITION_OPERATOR_AND;
+    }
+}
 
-    /* Do not add an invalid alert */
-    if (!alert_validator_is_alert_valid(alert)) {
-        return;
+/**
+ * @brief Count the band requirements in the alert condition of an alert.
+ *
+ * @param alert Alert. Must be valid.
+ *
+ * @return size_t Number of variable requirements of @p alert with a band operator.
+ */
+static size_t count_band_requirements(const MsgTransceiverAlert *const alert)
+{
+    size_t num_band_requirements = 0;
+    for (size_t i = 0; i < alert->alert_condition.num_variable_requirements; i++) {
+        VariableRequirementOperator operator = map_msg_transceiver_operator_to_variable_requirement_operator(
+            alert->alert_condition.variable_requirements[i].operator);
+        if (variable_requirement_is_band_operator(operator)) {
+            num_band_requirements++;
+        }
     }
+    return num_band_requirements;
+}
 
+/**
+ * @brief Install an alert in the system, without evaluating its alert condition.
+ *
+ * @param alert Alert to install. Must be valid, and its alert id must have just been assigned a slot in the alert slots
+ * module.
+ */
+static void install_alert(const MsgTransceiverAlert *const alert)
+{
     AlertRaiser alert_raiser = alert_raisers_get_alert_raiser(alert->alert_id);
-    if (alert_raiser_is_alert_set(alert_raiser)) {
-        /* Alert id for which we are trying to add the alert is already occupied - cannot add alert */
-        return;
-    }
 
     /* Enable required notifications for the alert*/
     if (alert->notification_type.connectivity) {
@@ -115,7 +158,7 @@ void alert_adder_add_alert(const MsgTransceiverAlert *const alert, void *user_da
         led_notifier_enable_notifications(alert->alert_id, led_color, led_pattern);
     }
 
-    /* Already checked above that an alert is not set for this alert raiser, so it is safe to call this function. */
+    /* The caller guarantees that an alert is not set for this alert raiser, so it is safe to call this function. */
     alert_raiser_set_alert(alert_raiser, alert->alert_id, alert->warmup_period, alert->cooldown_period);
 
     /* Populate alert condition */
@@ -126,28 +169,61 @@ void alert_adder_add_alert(const MsgTransceiverAlert *const alert, void *user_da
             &(alert->alert_condition.variable_requirements[i]);
         VariableRequirementOperator operator =
             map_msg_transceiver_operator_to_variable_requirement_operator(variable_requirement->operator);
+        /* Band requirements carry both bounds of the band in one variable requirement */
+        bool is_band = variable_requirement_is_band_operator(operator);
+        const ConstraintValue *const lower = &(variable_requirement->constraint_value);
+        const ConstraintValue *const upper = &(variable_requirement->upper_constraint_value);
+
+        /* Expressions that begin with this variable requirement, from the outermost one */
+        for (size_t j = 0; j < variable_requirement->num_begun_expressions; j++) {
+            alert_condition_begin_expression(alert_condition,
+                                             map_msg_transceiver_expression_operator_to_alert_condition_operator(
+                                                 variable_requirement->begun_expression_operators[j]));
+        }
 
         /* Create a new variable requirement instance and add it to the list of variable requirements of that type */
         VariableRequirement new_variable_requirement = NULL;
         switch (variable_requirement->variable_identifier) {
         case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_TEMPERATURE:
-            new_variable_requirement = temperature_requirement_create(
-                alert->alert_id, operator, (Temperature)variable_requirement->constraint_value.temperature);
+            if (is_band) {
+                new_variable_requirement = temperature_requirement_create_band(
+                    alert->alert_id, operator, (Temperature)lower->temperature, (Temperature)upper->temperature);
+            } else {
+                new_variable_requirement =
+                    temperature_requirement_create(alert->alert_id, operator, (Temperature)lower->temperature);
+            }
             temperature_requirement_list_add(new_variable_requirement);
             break;
         case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_PRESSURE:
-            new_variable_requirement = pressure_requirement_create(
-                alert->alert_id, operator, (Pressure)variable_requirement->constraint_value.pressure);
+            if (is_band) {
+                new_variable_requirement = pressure_requirement_create_band(
+                    alert->alert_id, operator, (Pressure)lower->pressure, (Pressure)upper->pressure);
+            } else {
+                new_variable_requirement =
+                    pressure_requirement_create(alert->alert_id, operator, (Pressure)lower->pressure);
+            }
             pressure_requirement_list_add(new_variable_requirement);
             break;
         case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_HUMIDITY:
-            new_variable_requirement = humidity_requirement_create(
-                alert->alert_id, operator, (Humidity)variable_requirement->constraint_value.humidity);
+            if (is_band) {
+                new_variable_requirement = humidity_requirement_create_band(
+                    alert->alert_id, operator, (Humidity)lower->humidity, (Humidity)upper->humidity);
+            } else {
+                new_variable_requirement =
+                    humidity_requirement_create(alert->alert_id, operator, (Humidity)lower->humidity);
+            }
             humidity_requirement_list_add(new_variable_requirement);
             break;
         case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_LIGHT_INTENSITY:
-            new_variable_requirement = light_intensity_requirement_create(
-                alert->alert_id, operator, (LightIntensity)variable_requirement->constraint_value.light_intensity);
+            if (is_band) {
+                new_variable_requirement =
+                    light_intensity_requirement_create_band(alert->alert_id, operator,
+                                                            (LightIntensity)lower->light_intensity,
+                                                            (LightIntensity)upper->light_intensity);
+            } else {
+                new_variable_requirement = light_intensity_requirement_create(alert->alert_id, operator,
+                                                                              (LightIntensity)lower->light_intensity);
+            }
             light_intensity_requirement_list_add(new_variable_requirement);
             break;
         default:
@@ -158,6 +234,9 @@ void alert_adder_add_alert(const MsgTransceiverAlert *const alert, void *user_da
 
         /* Add variable requirement to the alert condition for this alert */
         alert_condition_add_variable_requirement(alert_condition, new_variable_requirement);
+        for (size_t j = 0; j < variable_requirement->num_ended_expressions; j++) {
+            alert_condition_end_expression(alert_condition);
+        }
         if (variable_requirement->is_last_in_ored_requirement) {
             /* This will always be called after the last variable requirement is added to the alert condition. There is
              * no harm in doing that, even though it is not necessary. */
@@ -165,9 +244,107 @@ void alert_adder_add_alert(const MsgTransceiverAlert *const alert, void *user_da
         }
     }
 
-    /* If alert condition is satisfied, the alert should be raised immediately */
+    /* New requirement values can be close to the current values of their variables */
+    sensor_readout_scheduler_reset();
+}
+
+/**
+ * @brief Evaluate the alert condition of an installed alert, and pass the result to its alert raiser.
+ *
+ * Does nothing if alerts cannot be evaluated yet. In that case, the alert is going to be evaluated together with all
+ * other alerts once the alert evaluation readiness is reached.
+ *
+ * @param alert_id Alert id of the installed alert.
+ */
+static void evaluate_alert(uint16_t alert_id)
+{
     if (alert_evaluation_readiness_is_ready()) {
+        AlertCondition alert_condition = alert_conditions_get_alert_condition(alert_id);
         bool eval_result = alert_condition_evaluate(alert_condition);
-        alert_raiser_set_alert_condition_result(alert_raiser, eval_result);
+        alert_raiser_set_alert_condition_result(alert_raisers_get_alert_raiser(alert_id), eval_result);
+    }
+}
+
+void alert_adder_add_alert(const MsgTransceiverAlert *const alert, void *user_data)
+{
+    EAS_ASSERT(alert);
+
+    EAS_LOG_INF("Adding alert: id %u, warmup %u, cooldown %u, connectivity notification %u, led notification %u",
+                alert->alert_id, alert->warmup_period, alert->cooldown_period, alert->notification_type.connectivity,
+                alert->notification_type.led);
+
+    /* Do not add an invalid alert */
+    if (!alert_validator_is_alert_valid(alert)) {
+        return;
+    }
+
+    if (alert_slots_get_slot(alert->alert_id) != ALERT_SLOTS_NO_SLOT) {
+        /* Alert id for which we are trying to add the alert is already occupied - cannot add alert */
+        return;
+    }
+
+    if (alert->alert_condition.num_variable_requirements > alert_condition_get_num_free_variable_requirements()) {
+        /* Variable requirements of the alerts that are already in the system leave no room for this alert */
+        return;
+    }
+
+    if (count_band_requirements(alert) > alert_condition_get_num_free_band_requirements()) {
+        /* Variable requirement lists only have room for a limited number of band requirements */
+        return;
+    }
+
+    if (!alert_slots_add(alert->alert_id)) {
+        /* The system already holds the maximum number of alerts */
+        return;
+    }
+
+    install_alert(alert);
+
+    /* If alert condition is satisfied, the alert should be raised immediately */
+    evaluate_alert(alert->alert_id);
+}
+
+void alert_adder_replace_all_alerts(const MsgTransceiverAlert *const alerts, size_t num_alerts, void *user_data)
+{
+    EAS_ASSERT(alerts || (num_alerts == 0));
+
+    EAS_LOG_INF("Replacing all alerts with %u alerts", (unsigned int)num_alerts);
+
+    /* Validate the whole set before changing anything, so that either all alerts are replaced, or none are. The system
+     * is sized for the maximum number of alerts, but not necessarily for the maximum number of variable requirements in
+     * all of them, so a valid set fits into the system only if the total number of its variable requirements does. */
+    if (!alert_validator_are_alerts_valid(alerts, num_alerts)) {
+        return;
+    }
+    size_t total_num_variable_requirements = 0;
+    size_t total_num_band_requirements = 0;
+    for (size_t i = 0; i < num_alerts; i++) {
+        total_num_variable_requirements += alerts[i].alert_condition.num_variable_requirements;
+        total_num_band_requirements += count_band_requirements(&alerts[i]);
+    }
+    if (total_num_variable_requirements > alert_condition_get_max_total_num_variable_requirements()) {
+        return;
+    }
+    if (total_num_band_requirements > alert_condition_get_max_total_num_band_requirements()) {
+        return;
+    }
+
+    /* Iterated backwards, since removing an alert removes its alert id from the alert slots */
+    for (size_t i = alert_slots_get_num_alert_ids(); i > 0; i--) {
+        alert_remover_remove_alert(alert_slots_get_alert_id(i - 1), NULL);
+    }
+
+    for (size_t i = 0; i < num_alerts; i++) {
+        /* All slots are free at this point, and a replace all alerts message cannot hold more alerts than there are
+         * slots */
+        bool is_slot_added = alert_slots_add(alerts[i].alert_id);
+        EAS_ASSERT(is_slot_added);
+        install_alert(&alerts[i]);
+    }
+
+    /* Evaluate only once all alerts are installed. All resulting alert status changes are reported together, once the
+     * event that delivered the message has been handled. */
+    for (size_t i = 0; i < num_alerts; i++) {
+        evaluate_alert(alerts[i].alert_id);
     }
 }
@@ -7,6 +7,7 @@ extern "C"
 #endif
 
 #include <stdint.h>
+#include <stddef.h>
 
 #include "msg_transceiver.h"
 
@@ -14,7 +15,8 @@ extern "C"
  * @brief Add an alert to the system.
  *
  * This function should be called whenever a "add alert" message is received via the connection interface.
- * Does nothing if the alert is invalid, or if an alert with the specified alert id already exists in the system.
+ * Does nothing if the alert is invalid, if an alert with the specified alert id already exists in the system, or if
+ * there is not enough room left for the variable requirements or for the band requirements of the alert.
  *
  * @param alert Alert to add.
  * @param user_data User data. Unused, added to the function signature so that this function can be registered as a "add
@@ -22,6 +24,22 @@ extern "C"
  */
 void alert_adder_add_alert(const MsgTransceiverAlert *const alert, void *user_data);
 
+/**
+ * @brief Replace all alerts in the system with a set of alerts.
+ *
+ * This function should be called whenever a "replace all alerts" message is received via the connection interface.
+ * The set is validated as a whole. If the set is invalid, or if the variable requirements or the band requirements of
+ * all of its alerts do not fit into the system together, does nothing - alerts currently in the system stay in place.
+ * Otherwise, all alerts currently in the system are removed, all alerts from the set are installed, and only then the
+ * alert conditions of the installed alerts are evaluated.
+ *
+ * @param alerts Alerts to install. Can be NULL if @p num_alerts is 0.
+ * @param num_alerts Number of alerts in @p alerts. If 0, all alerts are removed from the system.
+ * @param user_data User data. Unused, added to the function signature so that this function can be registered as a
+ * "replace all alerts" callback with the msg_transceiver module.
+ */
+void alert_adder_replace_all_alerts(const MsgTransceiverAlert *const alerts, size_t num_alerts, void *user_data);
+
 #ifdef __cplusplus
 }
 #endif
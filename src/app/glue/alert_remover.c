@@ -9,6 +9,7 @@
 #include "humidity_requirement_list.h"
 #include "light_intensity_requirement_list.h"
 #include "alert_conditions.h"
+#include "alert_slots.h"
 #include "alert_condition.h"
 #include "variable_requirement.h"
 
@@ -17,19 +18,20 @@ static void destroy_variable_requirement(VariableRequirement variable_requiremen
     variable_requirement_destroy(variable_requirement);
 }
 
-void alert_remover_remove_alert(uint8_t alert_id, void *user_data)
+void alert_remover_remove_alert(uint16_t alert_id, void *user_data)
 {
     /* Do not attempt to remove an alert with an invalid id */
     if (!alert_validator_is_alert_id_valid(alert_id)) {
         return;
     }
 
-    AlertRaiser alert_raiser = alert_raisers_get_alert_raiser(alert_id);
-    if (!alert_raiser_is_alert_set(alert_raiser)) {
+    if (alert_slots_get_slot(alert_id) == ALERT_SLOTS_NO_SLOT) {
         /* Alert with this id does not exist - nothing to remove */
         return;
     }
 
+    AlertRaiser alert_raiser = alert_raisers_get_alert_raiser(alert_id);
+
     /* If the alert to be removed is currently raised, we do not want to send a connectivity notification that it is now
      * silenced, because the alert is being removed anyway. This is why we disable connectivity notifications for this
      * alert before doing anything else. */
@@ -55,4 +57,7 @@ void alert_remover_remove_alert(uint8_t alert_id, void *user_data)
     /* Not strictly necessary, since this is called by alert_adder before adding anything to the alert condition, but it
      * is nice to clean everything up here as soon as the alert gets removed. */
     alert_condition_reset(alert_condition);
+
+    /* Freed last, since all of the modules above look up the data of the alert by its slot */
+    alert_slots_remove(alert_id);
 }
@@ -18,7 +18,7 @@ extern "C"
  * @param user_data User data. Unused, added to the function signature so that this function can be registered as a
  * "remove alert" callback with the msg_transceiver module.
  */
-void alert_remover_remove_alert(uint8_t alert_id, void *user_data);
+void alert_remover_remove_alert(uint16_t alert_id, void *user_data);
 
 #ifdef __cplusplus
 }
@@ -1,4 +1,7 @@
+#include <stdint.h>
+
 #include "alert_validator.h"
+#include "alert_condition.h"
 #include "config.h"
 #include "eas_assert.h"
 
@@ -84,6 +87,20 @@ static bool is_valid_variable_identifier(uint8_t variable_identifier)
     // clang-format on
 }
 
+/**
+ * @brief Check whether variable requirement operator is a band operator.
+ *
+ * @param operator Operator. Use values from enum @ref MsgTransceiverRequirementOperator.
+ *
+ * @return true Operator is INSIDE or OUTSIDE - the variable requirement has an upper constraint value.
+ * @return false Operator is not a band operator.
+ */
+static bool is_band_operator(uint8_t operator)
+{
+    return (operator == MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_INSIDE) ||
+           (operator == MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_OUTSIDE);
+}
+
 /**
  * @brief Check whether variable requirement operator is valid.
  *
@@ -95,7 +112,7 @@ static bool is_valid_variable_identifier(uint8_t variable_identifier)
 static bool is_valid_operator(uint8_t operator)
 {
     return (operator == MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_GEQ) ||
-           (operator == MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_LEQ);
+           (operator == MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_LEQ) || is_band_operator(operator);
 }
 
 /**
@@ -133,6 +150,118 @@ static bool is_valid_constraint_value(uint8_t variable_identifier, ConstraintVal
     return is_valid;
 }
 
+/**
+ * @brief Check that the upper constraint value of a band is within range, and above the lower constraint value.
+ *
+ * @param variable_identifier Variable identifier.
+ * @param constraint_value Lower constraint value of the band. Must be valid.
+ * @param upper_constraint_value Upper constraint value of the band.
+ *
+ * @return true The band is valid.
+ * @return false The upper constraint value is outside of the allowed range for the variable, or it is not above the
+ * lower constraint value.
+ */
+static bool is_valid_band(uint8_t variable_identifier, ConstraintValue constraint_value,
+                          ConstraintValue upper_constraint_value)
+{
+    if (!is_valid_constraint_value(variable_identifier, upper_constraint_value)) {
+        return false;
+    }
+    switch (variable_identifier) {
+    case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_TEMPERATURE:
+        return (constraint_value.temperature < upper_constraint_value.temperature);
+    case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_PRESSURE:
+        return (constraint_value.pressure < upper_constraint_value.pressure);
+    case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_HUMIDITY:
+        return (constraint_value.humidity < upper_constraint_value.humidity);
+    default:
+        return (constraint_value.light_intensity < upper_constraint_value.light_intensity);
+    }
+}
+
+/**
+ * @brief Check whether expression operator is valid.
+ *
+ * @param expression_operator Expression operator. Use values from enum @ref MsgTransceiverExpressionOperator.
+ *
+ * @return true Expression operator is valid.
+ * @return false Expression operator is invalid.
+ */
+static bool is_valid_expression_operator(uint8_t expression_operator)
+{
+    // clang-format off
+    return (
+        (expression_operator == MSG_TRANSCEIVER_EXPRESSION_OPERATOR_AND)
+        || (expression_operator == MSG_TRANSCEIVER_EXPRESSION_OPERATOR_OR)
+        || (expression_operator == MSG_TRANSCEIVER_EXPRESSION_OPERATOR_NOT)
+    );
+    // clang-format on
+}
+
+/**
+ * @brief Check whether the expressions in an alert condition are valid.
+ *
+ * Expressions are valid if all of their operators are valid, no more than the maximum number of expressions supported
+ * by the alert condition module are open at the same time, every expression has at least one operand, NOT expressions
+ * have exactly one operand, and every expression ends in the ORed requirement in which it begins.
+ *
+ * @param alert_condition Alert condition.
+ *
+ * @return true Expressions are valid. This is also the case if the alert condition has no expressions.
+ * @return false Expressions are invalid.
+ */
+static bool are_expressions_valid(const MsgTransceiverAlertCondition *const alert_condition)
+{
+    /* Operator and number of operands of every open expression, from the outermost one */
+    uint8_t expression_operators[CONFIG_MSG_TRANSCEIVER_MAX_EXPRESSION_DEPTH];
+    size_t num_operands[CONFIG_MSG_TRANSCEIVER_MAX_EXPRESSION_DEPTH];
+    size_t depth = 0;
+
+    for (size_t i = 0; i < alert_condition->num_variable_requirements; i++) {
+        const MsgTransceiverVariableRequirement *const requirement = &(alert_condition->variable_requirements[i]);
+        if (requirement->num_begun_expressions > CONFIG_MSG_TRANSCEIVER_MAX_EXPRESSION_DEPTH) {
+            return false;
+        }
+        for (size_t j = 0; j < requirement->num_begun_expressions; j++) {
+            uint8_t expression_operator = requirement->begun_expression_operators[j];
+            if ((depth >= CONFIG_MSG_TRANSCEIVER_MAX_EXPRESSION_DEPTH) ||
+                (depth >= alert_condition_get_max_expression_depth()) ||
+                !is_valid_expression_operator(expression_operator)) {
+                return false;
+            }
+            /* An expression is an operand of the expression it is nested in */
+            if (depth > 0) {
+                num_operands[depth - 1]++;
+            }
+            expression_operators[depth] = expression_operator;
+            num_operands[depth] = 0;
+            depth++;
+        }
+
+        if (depth > 0) {
+            num_operands[depth - 1]++;
+        }
+
+        if (requirement->num_ended_expressions > depth) {
+            return false;
+        }
+        for (size_t j = 0; j < requirement->num_ended_expressions; j++) {
+            depth--;
+            /* Every ended expression has at least the operand that ends it, so only NOT needs to be checked */
+            bool is_not_expression = (expression_operators[depth] == MSG_TRANSCEIVER_EXPRESSION_OPERATOR_NOT);
+            if (is_not_expression && (num_operands[depth] != 1)) {
+                return false;
+            }
+        }
+
+        if (requirement->is_last_in_ored_requirement && (depth != 0)) {
+            return false;
+        }
+    }
+
+    return (depth == 0);
+}
+
 /**
  * @brief Check whether alert condition is valid.
  *
@@ -164,6 +293,13 @@ static bool is_alert_condition_valid(const MsgTransceiverAlertCondition *const a
             all_constraint_values_valid = false;
             break;
         }
+        if (is_band_operator(alert_condition->variable_requirements[i].operator) &&
+            !is_valid_band(alert_condition->variable_requirements[i].variable_identifier,
+                           alert_condition->variable_requirements[i].constraint_value,
+                           alert_condition->variable_requirements[i].upper_constraint_value)) {
+            all_constraint_values_valid = false;
+            break;
+        }
     }
 
     size_t last_requirement_index = alert_condition->num_variable_requirements - 1;
@@ -171,12 +307,18 @@ static bool is_alert_condition_valid(const MsgTransceiverAlertCondition *const a
         (alert_condition->variable_requirements[last_requirement_index].is_last_in_ored_requirement == true);
 
     return (valid_num_variable_requirements && all_variable_identifiers_valid && all_operators_valid &&
-            all_constraint_values_valid && last_requirement_is_last_in_ored_requirement);
+            all_constraint_values_valid && last_requirement_is_last_in_ored_requirement &&
+            are_expressions_valid(alert_condition));
 }
 
-bool alert_validator_is_alert_id_valid(uint8_t alert_id)
+bool alert_validator_is_alert_id_valid(uint16_t alert_id)
 {
+#if CONFIG_ALERT_VALIDATOR_MAX_ALLOWED_ALERT_ID < UINT16_MAX
     return (alert_id <= CONFIG_ALERT_VALIDATOR_MAX_ALLOWED_ALERT_ID);
+#else
+    /* Every uint16_t is an allowed alert id */
+    return true;
+#endif
 }
 
 bool alert_validator_is_alert_valid(const MsgTransceiverAlert *const alert)
@@ -196,3 +338,21 @@ bool alert_validator_is_alert_valid(const MsgTransceiverAlert *const alert)
     );
     // clang-format on
 }
+
+bool alert_validator_are_alerts_valid(const MsgTransceiverAlert *const alerts, size_t num_alerts)
+{
+    EAS_ASSERT(alerts || (num_alerts == 0));
+
+    for (size_t i = 0; i < num_alerts; i++) {
+        if (!alert_validator_is_alert_valid(&alerts[i])) {
+            return false;
+        }
+        for (size_t j = 0; j < i; j++) {
+            if (alerts[j].alert_id == alerts[i].alert_id) {
+                /* Two alerts with the same id cannot both be added */
+                return false;
+            }
+        }
+    }
+    return true;
+}
@@ -7,6 +7,7 @@ extern "C"
 #endif
 
 #include <stdbool.h>
+#include <stddef.h>
 
 #include "msg_transceiver.h"
 
@@ -14,7 +15,8 @@ extern "C"
  * @brief Validates whether an alert is valid.
  *
  * This module is designed specifically to be used by alert_adder and alert_remover modules. alert_adder should validate
- * the alert before attempting to add it to the system. alert_remover should validate the alert id of the alert to be
+ * the alert before attempting to add it to the system, or the whole set of alerts before replacing all alerts with
+ * it. alert_remover should validate the alert id of the alert to be
  * removed before attempting to remove it from the system.
  */
 
@@ -30,6 +32,19 @@ extern "C"
  */
 bool alert_validator_is_alert_valid(const MsgTransceiverAlert *const alert);
 
+/**
+ * @brief Check whether a set of alerts is valid as a whole.
+ *
+ * The set is valid if every alert in it is valid, and no two alerts have the same alert id. An empty set is valid.
+ *
+ * @param alerts Alerts to validate. Can be NULL if @p num_alerts is 0.
+ * @param num_alerts Number of alerts in @p alerts.
+ *
+ * @return true All alerts are valid, and their alert ids are unique.
+ * @return false At least one alert is invalid, or at least two alerts have the same alert id.
+ */
+bool alert_validator_are_alerts_valid(const MsgTransceiverAlert *const alerts, size_t num_alerts);
+
 /**
  * @brief Check whether alert id is valid.
  *
@@ -38,7 +53,7 @@ bool alert_validator_is_alert_valid(const MsgTransceiverAlert *const alert);
  * @return true Alert id is valid.
  * @return false Alert id is invalid.
  */
-bool alert_validator_is_alert_id_valid(uint8_t alert_id);
+bool alert_validator_is_alert_id_valid(uint16_t alert_id);
 
 #ifdef __cplusplus
 }
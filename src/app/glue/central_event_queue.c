@@ -1,22 +1,25 @@
 #include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
 
 #include "central_event_queue.h"
-#include "osal/eas_message_queue.h"
+#include "osal/eas_slot_queue.h"
 #include "osal/eas_thread.h"
 #include "eas_assert.h"
-#include "util.h"
+#include "eas_current_time.h"
 #include "new_sample_handler.h"
 #include "config.h"
 #include "init_handler.h"
+#include "connectivity_notification_sender.h"
 
-#ifndef CONFIG_CENTRAL_EVENT_QUEUE_MESSAGE_QUEUE_BUF_SIZE
-#define CONFIG_CENTRAL_EVENT_QUEUE_MESSAGE_QUEUE_BUF_SIZE 1024
+#ifndef CONFIG_CENTRAL_EVENT_QUEUE_NUM_SLOTS
+#define CONFIG_CENTRAL_EVENT_QUEUE_NUM_SLOTS 1
 #endif
 
-typedef struct CentralEventQueue {
-    EasMessageQueue message_queue;
-    uint8_t message_queue_buf[CONFIG_CENTRAL_EVENT_QUEUE_MESSAGE_QUEUE_BUF_SIZE];
-} CentralEventQueue;
+/* Opt-in, disabled by default */
+#ifndef CONFIG_CENTRAL_EVENT_QUEUE_COALESCE_SAMPLES
+#define CONFIG_CENTRAL_EVENT_QUEUE_COALESCE_SAMPLES 0
+#endif
 
 /** Unique event identifiers. This is the first byte of every event message to signal what kind of event it is. */
 typedef enum EventId {
@@ -30,6 +33,18 @@ typedef enum EventId {
        callback are also a part of the payload. */
     EVENT_ID_VOID_CB_WITH_USER_DATA,
     EVENT_ID_VOID_CB_WITH_UINT8,
+    /** Used instead of the "new sample" events if samples are coalesced. These events have no payload, the handlers
+     * take the latest sample from the variable's mailbox. */
+    EVENT_ID_TEMPERATURE_MAILBOX_UPDATED,
+    EVENT_ID_PRESSURE_MAILBOX_UPDATED,
+    EVENT_ID_HUMIDITY_MAILBOX_UPDATED,
+    EVENT_ID_LIGHT_INTENSITY_MAILBOX_UPDATED,
+    /** Samples of several variables that were read out together */
+    EVENT_ID_NEW_MULTI_SAMPLE,
+    /** Used instead of the "new multi sample" event if samples are coalesced */
+    EVENT_ID_MULTI_SAMPLE_MAILBOX_UPDATED,
+    /** Number of event ids, not a valid event id */
+    EVENT_ID_COUNT,
 } EventId;
 
 /** Abstract event class that includes only event id. Events that have payload should put this struct as the first field
@@ -58,6 +73,11 @@ typedef struct NewLightIntensitySampleEvent {
     LightIntensity sample;
 } NewLightIntensitySampleEvent;
 
+typedef struct NewMultiSampleEvent {
+    Event event;
+    MultiSample multi_sample;
+} NewMultiSampleEvent;
+
 typedef struct VoidCbWithUserDataEvent {
     Event event;
     CentralEventQueueVoidCbWithUserData cb;
@@ -70,16 +90,61 @@ typedef struct VoidCbWithUint8Event {
     uint8_t param_uint8;
 } VoidCbWithUint8Event;
 
-/* Wrapping in an enum, so that the value is a constant, and we can declare an array of this size */
-enum {
-    CENTRAL_EVENT_QUEUE_MAX_MESSAGE_SIZE =
-        MAX7(sizeof(Event), sizeof(NewTemperatureSampleEvent), sizeof(NewPressureSampleEvent),
-             sizeof(NewHumiditySampleEvent), sizeof(NewLightIntensitySampleEvent), sizeof(VoidCbWithUserDataEvent),
-             sizeof(VoidCbWithUint8Event))
-};
+/** One slot of the event queue. Every event is written to and handled directly from a slot, so a slot needs to be large
+ * enough and aligned for every event type. */
+typedef union EventSlot {
+    Event event;
+    NewTemperatureSampleEvent new_temperature_sample_event;
+    NewPressureSampleEvent new_pressure_sample_event;
+    NewHumiditySampleEvent new_humidity_sample_event;
+    NewLightIntensitySampleEvent new_light_intensity_sample_event;
+    NewMultiSampleEvent new_multi_sample_event;
+    VoidCbWithUserDataEvent void_cb_with_user_data_event;
+    VoidCbWithUint8Event void_cb_with_uint8_event;
+} EventSlot;
+
+typedef struct CentralEventQueue {
+    EasSlotQueue slot_queue;
+    EventSlot slots[CONFIG_CENTRAL_EVENT_QUEUE_NUM_SLOTS];
+    /** Handling statistics, indexed by event id. Only accessed from the event queue thread. */
+    CentralEventQueueEventStats event_stats[EVENT_ID_COUNT];
+} CentralEventQueue;
+
+/** Latest-value mailbox for the samples of one variable, used if CONFIG_CENTRAL_EVENT_QUEUE_COALESCE_SAMPLES is 1.
+ *
+ * A new sample overwrites the previous one, so at most one sample per variable is waiting to be handled. A "mailbox
+ * updated" event is only submitted if there is not one in the queue already. If the event queue falls behind, samples
+ * that got overwritten before they were handled are skipped instead of being handled one by one.
+ *
+ * Every sample type fits into 32 bits, so all mailboxes store the sample as uint32_t. */
+typedef struct SampleMailbox {
+    atomic_uint_least32_t sample;
+    atomic_bool is_updated_event_pending;
+} SampleMailbox;
+
+/** Latest-value mailbox for multi samples, used if CONFIG_CENTRAL_EVENT_QUEUE_COALESCE_SAMPLES is 1.
+ *
+ * Works like SampleMailbox, but a multi sample only overwrites the samples of its own variables. Samples of the other
+ * variables that are waiting to be handled are kept, and all waiting samples are handled together as one multi sample.
+ */
+typedef struct MultiSampleMailbox {
+    atomic_uint_least32_t temperature;
+    atomic_uint_least32_t pressure;
+    atomic_uint_least32_t humidity;
+    atomic_uint_least32_t light_intensity;
+    /** Bitmask of MULTI_SAMPLE_<variable> bits of the variables whose samples are waiting to be handled */
+    atomic_uint_least8_t variables;
+    atomic_bool is_updated_event_pending;
+} MultiSampleMailbox;
 
 static CentralEventQueue self;
 
+static SampleMailbox temperature_mailbox;
+static SampleMailbox pressure_mailbox;
+static SampleMailbox humidity_mailbox;
+static SampleMailbox light_intensity_mailbox;
+static MultiSampleMailbox multi_sample_mailbox;
+
 static void handle_init_event()
 {
     init_handler_handle_init_event();
@@ -114,6 +179,75 @@ static void handle_new_light_intensity_sample_event(const NewLightIntensitySampl
     new_sample_handler_light_intensity(event->sample);
 }
 
+static void handle_new_multi_sample_event(const NewMultiSampleEvent *const event)
+{
+    EAS_ASSERT(event);
+    new_sample_handler_multi_sample(&(event->multi_sample));
+}
+
+/**
+ * @brief Take the latest sample from a mailbox.
+ *
+ * The pending flag is cleared before the sample is read. A sample posted after this point submits a new "mailbox
+ * updated" event, so it is never missed - at worst, it is handled twice.
+ *
+ * @param mailbox Mailbox.
+ *
+ * @return uint32_t Latest sample.
+ */
+static uint32_t take_sample_from_mailbox(SampleMailbox *const mailbox)
+{
+    atomic_store(&(mailbox->is_updated_event_pending), false);
+    return (uint32_t)atomic_load(&(mailbox->sample));
+}
+
+static void handle_temperature_mailbox_updated_event()
+{
+    /* Temperature is signed. It is stored as its two's complement uint16_t representation, see
+     * central_event_queue_submit_new_temperature_sample_event. */
+    new_sample_handler_temperature((Temperature)(uint16_t)take_sample_from_mailbox(&temperature_mailbox));
+}
+
+static void handle_pressure_mailbox_updated_event()
+{
+    new_sample_handler_pressure((Pressure)take_sample_from_mailbox(&pressure_mailbox));
+}
+
+static void handle_humidity_mailbox_updated_event()
+{
+    new_sample_handler_humidity((Humidity)take_sample_from_mailbox(&humidity_mailbox));
+}
+
+static void handle_light_intensity_mailbox_updated_event()
+{
+    new_sample_handler_light_intensity((LightIntensity)take_sample_from_mailbox(&light_intensity_mailbox));
+}
+
+static void handle_multi_sample_mailbox_updated_event()
+{
+    /* Same order as in take_sample_from_mailbox - the pending flag is cleared before the samples are taken */
+    atomic_store(&(multi_sample_mailbox.is_updated_event_pending), false);
+    MultiSample multi_sample = {.variables = (uint8_t)atomic_exchange(&(multi_sample_mailbox.variables), 0)};
+    if (multi_sample.variables == 0) {
+        /* The samples were posted after the previous event cleared the pending flag, and that event handled them */
+        return;
+    }
+    if (multi_sample.variables & MULTI_SAMPLE_TEMPERATURE) {
+        /* Stored as two's complement uint16_t representation, see post_multi_sample_to_mailbox */
+        multi_sample.temperature = (Temperature)(uint16_t)atomic_load(&(multi_sample_mailbox.temperature));
+    }
+    if (multi_sample.variables & MULTI_SAMPLE_PRESSURE) {
+        multi_sample.pressure = (Pressure)atomic_load(&(multi_sample_mailbox.pressure));
+    }
+    if (multi_sample.variables & MULTI_SAMPLE_HUMIDITY) {
+        multi_sample.humidity = (Humidity)atomic_load(&(multi_sample_mailbox.humidity));
+    }
+    if (multi_sample.variables & MULTI_SAMPLE_LIGHT_INTENSITY) {
+        multi_sample.light_intensity = (LightIntensity)atomic_load(&(multi_sample_mailbox.light_intensity));
+    }
+    new_sample_handler_multi_sample(&multi_sample);
+}
+
 /**
  * @brief Handle "void cb with user data" event by invoking the callback.
  *
@@ -138,165 +272,296 @@ static void handle_void_cb_with_uint8_event(const VoidCbWithUint8Event *const ev
     event->cb(event->param_uint8);
 }
 
+/**
+ * @brief Update handling statistics of an event id with one handled event.
+ *
+ * @param event_id Id of the handled event.
+ * @param handler_cycles Number of cycles it took to handle the event.
+ */
+static void record_handled_event(uint8_t event_id, uint32_t handler_cycles)
+{
+    EAS_ASSERT(event_id < EVENT_ID_COUNT);
+    CentralEventQueueEventStats *const stats = &(self.event_stats[event_id]);
+    stats->num_handled++;
+    stats->total_handler_cycles += handler_cycles;
+    if (handler_cycles > stats->max_handler_cycles) {
+        stats->max_handler_cycles = handler_cycles;
+    }
+}
+
 /**
  * @brief Central event queue thread run function.
  *
- * Blocks on the event message queue. When a message is received, pops it from the queue and calls the corresponding
- * event handler.
+ * Blocks on the event slot queue. When an event is committed to the queue, calls the corresponding event handler with
+ * the event in its slot, and releases the slot once the handler returns. Connectivity notifications produced by the
+ * event handler are flushed once it returns.
+ *
+ * The time it takes to handle the event, including the flush, is recorded in the handling statistics of the event id.
  */
 static void central_event_queue_thread_run()
 {
-    static uint8_t message[CENTRAL_EVENT_QUEUE_MAX_MESSAGE_SIZE];
     while (1) {
-        /* This blocks until a message is pushed to the message queue */
-        size_t message_size = eas_message_queue_pop(self.message_queue, (uint8_t *const)&message);
-        /* Received a new message! */
-        const Event *const generic_event = (const Event *const)message;
-        switch (generic_event->id) {
-        case EVENT_ID_INIT: {
-            EAS_ASSERT(message_size == sizeof(Event));
+        /* This blocks until an event is committed to the queue */
+        const EventSlot *const slot = (const EventSlot *const)eas_slot_queue_get(self.slot_queue);
+        /* Received a new event! */
+        uint32_t handler_start_cycles = eas_current_time_get_cycles();
+        /* The slot cannot be accessed once it is released */
+        uint8_t event_id = slot->event.id;
+        switch (event_id) {
+        case EVENT_ID_INIT:
             handle_init_event();
             break;
-        }
-        case EVENT_ID_INIT_PART_2: {
-            EAS_ASSERT(message_size == sizeof(Event));
+        case EVENT_ID_INIT_PART_2:
             handle_init_part_2_event();
             break;
-        }
-        case EVENT_ID_NEW_TEMPERATURE_SAMPLE: {
-            EAS_ASSERT(message_size == sizeof(NewTemperatureSampleEvent));
-            const NewTemperatureSampleEvent *const event = (const NewTemperatureSampleEvent *const)message;
-            handle_new_temperature_sample_event(event);
+        case EVENT_ID_NEW_TEMPERATURE_SAMPLE:
+            handle_new_temperature_sample_event(&(slot->new_temperature_sample_event));
             break;
-        }
-        case EVENT_ID_NEW_PRESSURE_SAMPLE: {
-            EAS_ASSERT(message_size == sizeof(NewPressureSampleEvent));
-            const NewPressureSampleEvent *const event = (const NewPressureSampleEvent *const)message;
-            handle_new_pressure_sample_event(event);
+        case EVENT_ID_NEW_PRESSURE_SAMPLE:
+            handle_new_pressure_sample_event(&(slot->new_pressure_sample_event));
             break;
-        }
-        case EVENT_ID_NEW_HUMIDITY_SAMPLE: {
-            EAS_ASSERT(message_size == sizeof(NewHumiditySampleEvent));
-            const NewHumiditySampleEvent *const event = (const NewHumiditySampleEvent *const)message;
-            handle_new_humidity_sample_event(event);
+        case EVENT_ID_NEW_HUMIDITY_SAMPLE:
+            handle_new_humidity_sample_event(&(slot->new_humidity_sample_event));
             break;
-        }
-        case EVENT_ID_NEW_LIGHT_INTENSITY_SAMPLE: {
-            EAS_ASSERT(message_size == sizeof(NewLightIntensitySampleEvent));
-            const NewLightIntensitySampleEvent *const event = (const NewLightIntensitySampleEvent *const)message;
-            handle_new_light_intensity_sample_event(event);
+        case EVENT_ID_NEW_LIGHT_INTENSITY_SAMPLE:
+            handle_new_light_intensity_sample_event(&(slot->new_light_intensity_sample_event));
             break;
-        }
-        case EVENT_ID_VOID_CB_WITH_USER_DATA: {
-            EAS_ASSERT(message_size == sizeof(VoidCbWithUserDataEvent));
-            const VoidCbWithUserDataEvent *const event = (const VoidCbWithUserDataEvent *const)message;
-            handle_void_cb_with_user_data_event(event);
+        case EVENT_ID_NEW_MULTI_SAMPLE:
+            handle_new_multi_sample_event(&(slot->new_multi_sample_event));
             break;
-        }
-        case EVENT_ID_VOID_CB_WITH_UINT8: {
-            EAS_ASSERT(message_size == sizeof(VoidCbWithUint8Event));
-            const VoidCbWithUint8Event *const event = (const VoidCbWithUint8Event *const)message;
-            handle_void_cb_with_uint8_event(event);
+        case EVENT_ID_VOID_CB_WITH_USER_DATA:
+            handle_void_cb_with_user_data_event(&(slot->void_cb_with_user_data_event));
+            break;
+        case EVENT_ID_VOID_CB_WITH_UINT8:
+            handle_void_cb_with_uint8_event(&(slot->void_cb_with_uint8_event));
+            break;
+        case EVENT_ID_TEMPERATURE_MAILBOX_UPDATED:
+            handle_temperature_mailbox_updated_event();
+            break;
+        case EVENT_ID_PRESSURE_MAILBOX_UPDATED:
+            handle_pressure_mailbox_updated_event();
+            break;
+        case EVENT_ID_HUMIDITY_MAILBOX_UPDATED:
+            handle_humidity_mailbox_updated_event();
+            break;
+        case EVENT_ID_LIGHT_INTENSITY_MAILBOX_UPDATED:
+            handle_light_intensity_mailbox_updated_event();
+            break;
+        case EVENT_ID_MULTI_SAMPLE_MAILBOX_UPDATED:
+            handle_multi_sample_mailbox_updated_event();
             break;
-        }
         default:
             EAS_ASSERT(0); // Invalid event id
             break;
         }
+        /* The handler is done with the event, the slot can be reused by producers */
+        eas_slot_queue_release(self.slot_queue);
+        /* Alert status changes caused by this event are sent together, as one connectivity notification */
+        connectivity_notification_sender_flush();
+        /* Unsigned subtraction handles cycle counter wraparound */
+        record_handled_event(event_id, eas_current_time_get_cycles() - handler_start_cycles);
+    }
+}
+
+/**
+ * @brief Reserve a slot in the event queue for a new event.
+ *
+ * The event is written directly to the returned slot, and then submitted by calling @ref commit_event_slot.
+ *
+ * @return EventSlot* Reserved slot.
+ */
+static EventSlot *reserve_event_slot()
+{
+    EventSlot *slot = (EventSlot *)eas_slot_queue_reserve(self.slot_queue);
+    /* Asserting because our system is designed in a way that there should always be a free slot in the event queue. If
+     * all slots are occupied, something went wrong. */
+    EAS_ASSERT(slot);
+    return slot;
+}
+
+/**
+ * @brief Submit an event written to a slot returned by @ref reserve_event_slot.
+ *
+ * @param slot Slot that contains the event.
+ */
+static void commit_event_slot(EventSlot *const slot)
+{
+    eas_slot_queue_commit(self.slot_queue, slot);
+}
+
+/**
+ * @brief Post a sample to a mailbox, and submit a "mailbox updated" event if one is not pending already.
+ *
+ * @param mailbox Mailbox.
+ * @param sample Sample converted to uint32_t.
+ * @param updated_event_id Id of the "mailbox updated" event for this mailbox.
+ */
+static void post_sample_to_mailbox(SampleMailbox *const mailbox, uint32_t sample, EventId updated_event_id)
+{
+    atomic_store(&(mailbox->sample), sample);
+    bool was_updated_event_pending = atomic_exchange(&(mailbox->is_updated_event_pending), true);
+    if (!was_updated_event_pending) {
+        EventSlot *slot = reserve_event_slot();
+        slot->event.id = updated_event_id;
+        commit_event_slot(slot);
     }
 }
 
 /**
- * @brief Push event to the event queue.
+ * @brief Post a multi sample to the multi sample mailbox, and submit a "mailbox updated" event if one is not pending
+ * already.
  *
- * @param event Event bytes. Should be a pointer the Event data type that corresponds to the event being pushed.
- * @param event_size Number of event bytes. Should be sizeof(<event_being_pushed>Event).
+ * @param multi_sample Multi sample.
  */
-static void push_event_to_queue(const uint8_t *const event, size_t event_size)
+static void post_multi_sample_to_mailbox(const MultiSample *const multi_sample)
 {
-    /* Asserting because our system is designed in a way that there should always be space in the message queue. If it
-     * got full, something went wrong. */
-    EAS_ASSERT(eas_message_queue_push(self.message_queue, event, event_size));
+    if (multi_sample->variables & MULTI_SAMPLE_TEMPERATURE) {
+        atomic_store(&(multi_sample_mailbox.temperature), (uint16_t)multi_sample->temperature);
+    }
+    if (multi_sample->variables & MULTI_SAMPLE_PRESSURE) {
+        atomic_store(&(multi_sample_mailbox.pressure), multi_sample->pressure);
+    }
+    if (multi_sample->variables & MULTI_SAMPLE_HUMIDITY) {
+        atomic_store(&(multi_sample_mailbox.humidity), multi_sample->humidity);
+    }
+    if (multi_sample->variables & MULTI_SAMPLE_LIGHT_INTENSITY) {
+        atomic_store(&(multi_sample_mailbox.light_intensity), multi_sample->light_intensity);
+    }
+    /* Samples are stored before their variables are marked, so the samples of marked variables are always valid */
+    atomic_fetch_or(&(multi_sample_mailbox.variables), multi_sample->variables);
+    bool was_updated_event_pending = atomic_exchange(&(multi_sample_mailbox.is_updated_event_pending), true);
+    if (!was_updated_event_pending) {
+        EventSlot *slot = reserve_event_slot();
+        slot->event.id = EVENT_ID_MULTI_SAMPLE_MAILBOX_UPDATED;
+        commit_event_slot(slot);
+    }
 }
 
 void central_event_queue_init()
 {
-    self.message_queue =
-        eas_message_queue_create(self.message_queue_buf, CONFIG_CENTRAL_EVENT_QUEUE_MESSAGE_QUEUE_BUF_SIZE,
-                                 CENTRAL_EVENT_QUEUE_MAX_MESSAGE_SIZE);
+    self.slot_queue =
+        eas_slot_queue_create((uint8_t *)self.slots, sizeof(EventSlot), CONFIG_CENTRAL_EVENT_QUEUE_NUM_SLOTS);
     eas_thread_create(central_event_queue_thread_run);
 }
 
+uint8_t central_event_queue_get_num_event_ids()
+{
+    return EVENT_ID_COUNT;
+}
+
+void central_event_queue_get_event_stats(uint8_t event_id, CentralEventQueueEventStats *const stats)
+{
+    EAS_ASSERT(event_id < EVENT_ID_COUNT);
+    EAS_ASSERT(stats);
+    *stats = self.event_stats[event_id];
+}
+
+size_t central_event_queue_get_num_slots()
+{
+    return CONFIG_CENTRAL_EVENT_QUEUE_NUM_SLOTS;
+}
+
+size_t central_event_queue_get_high_watermark()
+{
+    return eas_slot_queue_get_high_watermark(self.slot_queue);
+}
+
 void central_event_queue_submit_init_event()
 {
-    Event event = {
-        .id = EVENT_ID_INIT,
-    };
-    push_event_to_queue((const uint8_t *const)&event, sizeof(Event));
+    EventSlot *slot = reserve_event_slot();
+    slot->event.id = EVENT_ID_INIT;
+    commit_event_slot(slot);
 }
 
 void central_event_queue_submit_init_part_2_event()
 {
-    Event event = {
-        .id = EVENT_ID_INIT_PART_2,
-    };
-    push_event_to_queue((const uint8_t *const)&event, sizeof(Event));
+    EventSlot *slot = reserve_event_slot();
+    slot->event.id = EVENT_ID_INIT_PART_2;
+    commit_event_slot(slot);
 }
 
 void central_event_queue_submit_new_temperature_sample_event(Temperature temperature)
 {
-    NewTemperatureSampleEvent event = {
-        .event.id = EVENT_ID_NEW_TEMPERATURE_SAMPLE,
-        .sample = temperature,
-    };
-    push_event_to_queue((const uint8_t *const)&event, sizeof(NewTemperatureSampleEvent));
+    if (CONFIG_CENTRAL_EVENT_QUEUE_COALESCE_SAMPLES) {
+        post_sample_to_mailbox(&temperature_mailbox, (uint16_t)temperature, EVENT_ID_TEMPERATURE_MAILBOX_UPDATED);
+        return;
+    }
+
+    EventSlot *slot = reserve_event_slot();
+    slot->new_temperature_sample_event.event.id = EVENT_ID_NEW_TEMPERATURE_SAMPLE;
+    slot->new_temperature_sample_event.sample = temperature;
+    commit_event_slot(slot);
 }
 
 void central_event_queue_submit_new_pressure_sample_event(Pressure pressure)
 {
-    NewPressureSampleEvent event = {
-        .event.id = EVENT_ID_NEW_PRESSURE_SAMPLE,
-        .sample = pressure,
-    };
-    push_event_to_queue((const uint8_t *const)&event, sizeof(NewPressureSampleEvent));
+    if (CONFIG_CENTRAL_EVENT_QUEUE_COALESCE_SAMPLES) {
+        post_sample_to_mailbox(&pressure_mailbox, pressure, EVENT_ID_PRESSURE_MAILBOX_UPDATED);
+        return;
+    }
+
+    EventSlot *slot = reserve_event_slot();
+    slot->new_pressure_sample_event.event.id = EVENT_ID_NEW_PRESSURE_SAMPLE;
+    slot->new_pressure_sample_event.sample = pressure;
+    commit_event_slot(slot);
 }
 
 void central_event_queue_submit_new_humidity_sample_event(Humidity humidity)
 {
-    NewHumiditySampleEvent event = {
-        .event.id = EVENT_ID_NEW_HUMIDITY_SAMPLE,
-        .sample = humidity,
-    };
-    push_event_to_queue((const uint8_t *const)&event, sizeof(NewHumiditySampleEvent));
+    if (CONFIG_CENTRAL_EVENT_QUEUE_COALESCE_SAMPLES) {
+        post_sample_to_mailbox(&humidity_mailbox, humidity, EVENT_ID_HUMIDITY_MAILBOX_UPDATED);
+        return;
+    }
+
+    EventSlot *slot = reserve_event_slot();
+    slot->new_humidity_sample_event.event.id = EVENT_ID_NEW_HUMIDITY_SAMPLE;
+    slot->new_humidity_sample_event.sample = humidity;
+    commit_event_slot(slot);
 }
 
 void central_event_queue_submit_new_light_intensity_sample_event(LightIntensity light_intensity)
 {
-    NewLightIntensitySampleEvent event = {
-        .event.id = EVENT_ID_NEW_LIGHT_INTENSITY_SAMPLE,
-        .sample = light_intensity,
-    };
-    push_event_to_queue((const uint8_t *const)&event, sizeof(NewLightIntensitySampleEvent));
+    if (CONFIG_CENTRAL_EVENT_QUEUE_COALESCE_SAMPLES) {
+        post_sample_to_mailbox(&light_intensity_mailbox, light_intensity, EVENT_ID_LIGHT_INTENSITY_MAILBOX_UPDATED);
+        return;
+    }
+
+    EventSlot *slot = reserve_event_slot();
+    slot->new_light_intensity_sample_event.event.id = EVENT_ID_NEW_LIGHT_INTENSITY_SAMPLE;
+    slot->new_light_intensity_sample_event.sample = light_intensity;
+    commit_event_slot(slot);
+}
+
+void central_event_queue_submit_new_multi_sample_event(const MultiSample *const multi_sample)
+{
+    EAS_ASSERT(multi_sample);
+    if (CONFIG_CENTRAL_EVENT_QUEUE_COALESCE_SAMPLES) {
+        post_multi_sample_to_mailbox(multi_sample);
+        return;
+    }
+
+    EventSlot *slot = reserve_event_slot();
+    slot->new_multi_sample_event.event.id = EVENT_ID_NEW_MULTI_SAMPLE;
+    slot->new_multi_sample_event.multi_sample = *multi_sample;
+    commit_event_slot(slot);
 }
 
 void central_event_queue_submit_void_cb_with_user_data_event(CentralEventQueueVoidCbWithUserData cb, void *user_data)
 {
     EAS_ASSERT(cb);
-    VoidCbWithUserDataEvent event = {
-        .event.id = EVENT_ID_VOID_CB_WITH_USER_DATA,
-        .cb = cb,
-        .user_data = user_data,
-    };
-    push_event_to_queue((const uint8_t *const)&event, sizeof(VoidCbWithUserDataEvent));
+    EventSlot *slot = reserve_event_slot();
+    slot->void_cb_with_user_data_event.event.id = EVENT_ID_VOID_CB_WITH_USER_DATA;
+    slot->void_cb_with_user_data_event.cb = cb;
+    slot->void_cb_with_user_data_event.user_data = user_data;
+    commit_event_slot(slot);
 }
 
 void central_event_queue_submit_void_cb_with_uint8_event(CentralEventQueueVoidCbWithUint8 cb, uint8_t param_uint8)
 {
     EAS_ASSERT(cb);
-    VoidCbWithUint8Event event = {
-        .event.id = EVENT_ID_VOID_CB_WITH_UINT8,
-        .cb = cb,
-        .param_uint8 = param_uint8,
-    };
-    push_event_to_queue((const uint8_t *const)&event, sizeof(VoidCbWithUint8Event));
+    EventSlot *slot = reserve_event_slot();
+    slot->void_cb_with_uint8_event.event.id = EVENT_ID_VOID_CB_WITH_UINT8;
+    slot->void_cb_with_uint8_event.cb = cb;
+    slot->void_cb_with_uint8_event.param_uint8 = param_uint8;
+    commit_event_slot(slot);
 }
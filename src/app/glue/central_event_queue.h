@@ -7,26 +7,47 @@ extern "C"
 #endif
 
 #include <stdint.h>
+#include <stddef.h>
 
 #include "temperature.h"
 #include "pressure.h"
 #include "humidity.h"
 #include "light_intensity.h"
+#include "multi_sample.h"
 
 /**
  * @brief Central event queue for event processing.
  *
- * The event queue consists of a thread and a message queue. The thread is blocked on receiving messages from the
- * message queue. Once a message is pushed to the message queue, the thread gets unblocked, pops the message from the
- * queue and handles the event encoded in the message.
+ * The event queue consists of a thread and a queue of fixed-size event slots. The thread is blocked on getting an event
+ * from the slot queue. Once an event is committed to the slot queue, the thread gets unblocked, handles the event
+ * directly from its slot, and releases the slot.
  *
  * This event queue is the central place in the system where all the blocking happens. If you are working on a new
  * module and feel the need to introduce some kind of blocking (e.g. on a synchronization primitive, or sleep), use this
  * event queue instead. Blocking is not allowed in any other part of the application.
  *
  * All of the "submit_<event_name>_event" public functions push an event to the event queue and return immediately.
+ *
+ * If CONFIG_CENTRAL_EVENT_QUEUE_COALESCE_SAMPLES is 1, new sample events are coalesced: if a new sample of a variable
+ * is submitted before the previous sample of that variable has been handled, only the new sample is handled. Multi
+ * sample events are coalesced the same way: multi samples submitted before the previous one has been handled are
+ * merged, keeping the latest sample of every variable, and handled as one multi sample.
+ *
+ * The event queue keeps statistics that help to size the queue and find slow event handlers: the number of handled
+ * events, total and maximum handling time for each event id, and the highest number of slots that were occupied at the
+ * same time.
  */
 
+/** Handling statistics of one event id. Handling times are measured in cycles of the hardware cycle counter. */
+typedef struct CentralEventQueueEventStats {
+    /** Number of handled events */
+    uint32_t num_handled;
+    /** Sum of the handling times of all handled events */
+    uint64_t total_handler_cycles;
+    /** Longest handling time of a single event */
+    uint32_t max_handler_cycles;
+} CentralEventQueueEventStats;
+
 /**
  * @brief Callback type definition for a function without return value and one void* parameter.
  *
@@ -52,11 +73,47 @@ typedef void (*CentralEventQueueVoidCbWithUint8)(uint8_t param_uint8);
 /**
  * @brief Initialize central event queue.
  *
- * Creates the message queue and the thread. The thread is immediately started. This function should be called on system
+ * Creates the slot queue and the thread. The thread is immediately started. This function should be called on system
  * startup.
  */
 void central_event_queue_init();
 
+/**
+ * @brief Get the number of event ids.
+ *
+ * Event ids are in the range [0, number of event ids).
+ *
+ * @return uint8_t Number of event ids.
+ */
+uint8_t central_event_queue_get_num_event_ids();
+
+/**
+ * @brief Get handling statistics of an event id.
+ *
+ * Must be called from the event queue thread, i.e. from an event handler.
+ *
+ * @param event_id Event id. Must be smaller than the value returned by @ref central_event_queue_get_num_event_ids.
+ * @param[out] stats Handling statistics are written to this parameter.
+ */
+void central_event_queue_get_event_stats(uint8_t event_id, CentralEventQueueEventStats *const stats);
+
+/**
+ * @brief Get the number of slots in the event queue.
+ *
+ * @return size_t Number of slots.
+ */
+size_t central_event_queue_get_num_slots();
+
+/**
+ * @brief Get the highest number of slots that were occupied at the same time since the event queue was initialized.
+ *
+ * A high-watermark that gets close to the number of slots means that the event queue is at risk of running out of
+ * slots. A high-watermark that stays far below it means that the event queue could be made smaller.
+ *
+ * @return size_t High-watermark.
+ */
+size_t central_event_queue_get_high_watermark();
+
 /**
  * @brief Submit init event to the event queue.
  */
@@ -95,6 +152,16 @@ void central_event_queue_submit_new_humidity_sample_event(Humidity humidity);
  */
 void central_event_queue_submit_new_light_intensity_sample_event(LightIntensity light_intensity);
 
+/**
+ * @brief Submit new multi sample event to the event queue.
+ *
+ * All samples in @p multi_sample are handled by one event, so that they update the current values of their variables
+ * together.
+ *
+ * @param multi_sample New samples. Copied to the event, so it does not need to persist after this call.
+ */
+void central_event_queue_submit_new_multi_sample_event(const MultiSample *const multi_sample);
+
 /**
  * @brief Submit void cb with user data event to the event queue.
  *
@@ -12,6 +12,10 @@
  * context/thread. Our application has one central event queue with a dedicated thread - this is the context from which
  * all application logic is executed. @p cb is executed from this context as well.
  *
+ * EasTimer only calls this function for the first of the timer expiries that are pending, and @p cb executes the
+ * callbacks of all pending expiries. Every call submits one event, so the number of events that timers occupy in the
+ * central event queue stays bounded, however many timers expire at the same time.
+ *
  * @param cb Callback to execute.
  * @param user_data User data to pass to the callback.
  */
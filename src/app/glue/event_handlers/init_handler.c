@@ -3,11 +3,14 @@
 #include "alert_raisers.h"
 #include "alert_adder.h"
 #include "alert_remover.h"
+#include "stats_reporter.h"
+#include "sample_history_reporter.h"
 #include "msg_transceiver.h"
 #include "eas_timer.h"
 #include "eas_timer_callback_executor.h"
 #include "hw_platform.h"
 #include "new_sample_callbacks.h"
+#include "sensor_readout_scheduler.h"
 #include "central_event_queue.h"
 #include "eas_log.h"
 
@@ -56,6 +59,8 @@ void init_handler_handle_init_part_2_event()
     hw_platform_get_pressure_sensor()->register_new_sample_cb(new_sample_callback_pressure, NULL);
     hw_platform_get_humidity_sensor()->register_new_sample_cb(new_sample_callback_humidity, NULL);
     hw_platform_get_light_intensity_sensor()->register_new_sample_cb(new_sample_callback_light_intensity, NULL);
+    hw_platform_register_new_multi_sample_cb(new_sample_callback_multi_sample, NULL);
+    sensor_readout_scheduler_reset();
     hw_platform_get_temperature_sensor()->start();
     hw_platform_get_pressure_sensor()->start();
     hw_platform_get_humidity_sensor()->start();
@@ -66,4 +71,7 @@ void init_handler_handle_init_part_2_event()
     msg_transceiver_init();
     msg_transceiver_set_add_alert_cb(alert_adder_add_alert, NULL);
     msg_transceiver_set_remove_alert_cb(alert_remover_remove_alert, NULL);
+    msg_transceiver_set_replace_all_alerts_cb(alert_adder_replace_all_alerts, NULL);
+    msg_transceiver_set_get_stats_cb(stats_reporter_report_stats, NULL);
+    msg_transceiver_set_get_sample_history_cb(sample_history_reporter_report_sample_history, NULL);
 }
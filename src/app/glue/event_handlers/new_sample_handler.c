@@ -1,3 +1,6 @@
+#include <stddef.h>
+#include <stdint.h>
+
 #include "new_sample_handler.h"
 #include "alert_evaluation_readiness.h"
 #include "current_temperature.h"
@@ -8,72 +11,226 @@
 #include "pressure_requirement_list.h"
 #include "humidity_requirement_list.h"
 #include "light_intensity_requirement_list.h"
-#include "variable_requirement.h"
 #include "alert_conditions.h"
 #include "alert_condition.h"
 #include "alert_raisers.h"
 #include "alert_raiser.h"
+#include "alert_slots.h"
+#include "sample_history.h"
+#include "sensor_readout_scheduler.h"
 #include "eas_assert.h"
 #include "eas_log.h"
 #include "eas_current_time.h"
 #include "utils/eas_time.h"
+#include "config.h"
 
 EAS_LOG_ENABLE_IN_FILE();
 
+#ifndef CONFIG_ALERT_SLOTS_NUM_SLOTS
+#define CONFIG_ALERT_SLOTS_NUM_SLOTS 1
+#endif
+
 /** Defines how often new samples are logged. */
 #define NEW_SAMPLE_LOG_PERIOD_MS 15000
 
+#define NUM_BITS_IN_DIRTY_SLOTS_WORD 32
+#define NUM_DIRTY_SLOTS_WORDS                                                                                          \
+    ((CONFIG_ALERT_SLOTS_NUM_SLOTS + NUM_BITS_IN_DIRTY_SLOTS_WORD - 1) / NUM_BITS_IN_DIRTY_SLOTS_WORD)
+
 /**
- * @brief Evaluate variable requirement and if its result changed, also evaluate the alert condition it is a part of.
+ * @brief Bitmap of alert slots of alerts whose alert condition result might have changed while handling the current
+ * sample.
+ *
+ * Alert raisers are only updated after all variable requirements affected by the sample have been evaluated. Otherwise,
+ * an alert raiser could receive an intermediate alert condition result. For example, the condition "temperature >= 20
+ * AND temperature <= 25" is not satisfied when temperature changes from 19 to 26, but it would appear satisfied after
+ * only the first of its two requirements has been updated.
+ *
+ * An alert is marked only once, no matter how many of its variable requirements changed, so its alert condition result
+ * is passed to its alert raiser once per sample.
+ */
+static uint32_t dirty_slots[NUM_DIRTY_SLOTS_WORDS];
+
+/**
+ * @brief Report a changed variable requirement result to its alert condition.
+ *
+ * Callback to execute for every variable requirement whose result changed during evaluation by a variable requirement
+ * list. The alert raiser is not updated here - the slot of the alert is marked in dirty_slots instead, see @ref
+ * update_pending_alert_raisers.
  *
- * Callback to execute for every variable requirement in a variable requirement list.
+ * @param variable_requirement Variable requirement whose result changed.
+ * @param alert_id Alert id of the alert to which @p variable_requirement belongs.
+ * @param result New result of @p variable_requirement.
+ */
+static void handle_variable_requirement_result_change(VariableRequirement variable_requirement, uint16_t alert_id,
+                                                      bool result)
+{
+    size_t slot = alert_slots_get_slot(alert_id);
+    bool is_valid_alert_id = (slot < CONFIG_ALERT_SLOTS_NUM_SLOTS);
+    EAS_ASSERT(is_valid_alert_id);
+    AlertCondition alert_condition = alert_conditions_get_alert_condition_in_slot(slot);
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirement, result);
+
+    dirty_slots[slot / NUM_BITS_IN_DIRTY_SLOTS_WORD] |= ((uint32_t)1 << (slot % NUM_BITS_IN_DIRTY_SLOTS_WORD));
+}
+
+/**
+ * @brief Pass the alert condition results of all alerts marked in dirty_slots to their alert raisers, and clear
+ * dirty_slots.
  *
- * @param variable_requirement Variable requirement to evaluate.
+ * Must be called after all variable requirements affected by a sample have been evaluated.
  */
-static void evaluate_variable_requirement(VariableRequirement variable_requirement)
+static void update_pending_alert_raisers()
 {
-    /* Do not care about return value, evaluate is called to trigger result update, so that we can check whether
-     * result changed */
-    variable_requirement_evaluate(variable_requirement);
-    if (variable_requirement_is_result_changed(variable_requirement)) {
-        uint8_t alert_id = variable_requirement_get_alert_id(variable_requirement);
-        AlertCondition alert_condition = alert_conditions_get_alert_condition(alert_id);
-        bool condition_result = alert_condition_evaluate(alert_condition);
-        AlertRaiser alert_raiser = alert_raisers_get_alert_raiser(alert_id);
-        alert_raiser_set_alert_condition_result(alert_raiser, condition_result);
+    for (size_t word_idx = 0; word_idx < NUM_DIRTY_SLOTS_WORDS; word_idx++) {
+        uint32_t word = dirty_slots[word_idx];
+        dirty_slots[word_idx] = 0;
+        /* Stops as soon as there are no more dirty slots in the word, usually only a few alerts are dirty */
+        for (size_t bit = 0; word != 0; bit++, word >>= 1) {
+            if (!(word & 1)) {
+                continue;
+            }
+            size_t slot = (word_idx * NUM_BITS_IN_DIRTY_SLOTS_WORD) + bit;
+            AlertCondition alert_condition = alert_conditions_get_alert_condition_in_slot(slot);
+            AlertRaiser alert_raiser = alert_raisers_get_alert_raiser_in_slot(slot);
+            alert_raiser_set_alert_condition_result(alert_raiser, alert_condition_get_result(alert_condition));
+        }
     }
 }
 
 /**
  * @brief Callback to execute when the current temperature value has changed.
+ *
+ * Only the temperature requirements with requirement values between the previous and the current temperature value are
+ * evaluated. The results of all other temperature requirements could not have changed.
+ *
+ * @param previous_sample Pointer to the previous temperature value, should point to data of type Temperature.
+ * @param sample Pointer to the current temperature value, should point to data of type Temperature.
  */
-static void handle_temperature_value_change()
+static void handle_temperature_value_change(const void *const previous_sample, const void *const sample)
 {
-    temperature_requirement_list_for_each(evaluate_variable_requirement);
+    EAS_ASSERT(previous_sample);
+    EAS_ASSERT(sample);
+    const Temperature *const previous_temperature = (const Temperature *const)previous_sample;
+    const Temperature *const temperature = (const Temperature *const)sample;
+    temperature_requirement_list_evaluate_in_range(*previous_temperature, *temperature,
+                                                   handle_variable_requirement_result_change);
 }
 
 /**
  * @brief Callback to execute when the current pressure value has changed.
+ *
+ * Only the pressure requirements with requirement values between the previous and the current pressure value are
+ * evaluated. The results of all other pressure requirements could not have changed.
+ *
+ * @param previous_sample Pointer to the previous pressure value, should point to data of type Pressure.
+ * @param sample Pointer to the current pressure value, should point to data of type Pressure.
  */
-static void handle_pressure_value_change()
+static void handle_pressure_value_change(const void *const previous_sample, const void *const sample)
 {
-    pressure_requirement_list_for_each(evaluate_variable_requirement);
+    EAS_ASSERT(previous_sample);
+    EAS_ASSERT(sample);
+    const Pressure *const previous_pressure = (const Pressure *const)previous_sample;
+    const Pressure *const pressure = (const Pressure *const)sample;
+    pressure_requirement_list_evaluate_in_range(*previous_pressure, *pressure,
+                                                handle_variable_requirement_result_change);
 }
 
 /**
  * @brief Callback to execute when the current humidity value has changed.
+ *
+ * Only the humidity requirements with requirement values between the previous and the current humidity value are
+ * evaluated. The results of all other humidity requirements could not have changed.
+ *
+ * @param previous_sample Pointer to the previous humidity value, should point to data of type Humidity.
+ * @param sample Pointer to the current humidity value, should point to data of type Humidity.
  */
-static void handle_humidity_value_change()
+static void handle_humidity_value_change(const void *const previous_sample, const void *const sample)
 {
-    humidity_requirement_list_for_each(evaluate_variable_requirement);
+    EAS_ASSERT(previous_sample);
+    EAS_ASSERT(sample);
+    const Humidity *const previous_humidity = (const Humidity *const)previous_sample;
+    const Humidity *const humidity = (const Humidity *const)sample;
+    humidity_requirement_list_evaluate_in_range(*previous_humidity, *humidity,
+                                                handle_variable_requirement_result_change);
 }
 
 /**
  * @brief Callback to execute when the current light intensity value has changed.
+ *
+ * Only the light intensity requirements with requirement values between the previous and the current light intensity
+ * value are evaluated. The results of all other light intensity requirements could not have changed.
+ *
+ * @param previous_sample Pointer to the previous light intensity value, should point to data of type LightIntensity.
+ * @param sample Pointer to the current light intensity value, should point to data of type LightIntensity.
+ */
+static void handle_light_intensity_value_change(const void *const previous_sample, const void *const sample)
+{
+    EAS_ASSERT(previous_sample);
+    EAS_ASSERT(sample);
+    const LightIntensity *const previous_light_intensity = (const LightIntensity *const)previous_sample;
+    const LightIntensity *const light_intensity = (const LightIntensity *const)sample;
+    light_intensity_requirement_list_evaluate_in_range(*previous_light_intensity, *light_intensity,
+                                                       handle_variable_requirement_result_change);
+}
+
+/**
+ * @brief Evaluate all variable requirements of all variables.
+ */
+static void evaluate_all_variable_requirements()
+{
+    temperature_requirement_list_evaluate(current_temperature_get(), handle_variable_requirement_result_change);
+    pressure_requirement_list_evaluate(current_pressure_get(), handle_variable_requirement_result_change);
+    humidity_requirement_list_evaluate(current_humidity_get(), handle_variable_requirement_result_change);
+    light_intensity_requirement_list_evaluate(current_light_intensity_get(), handle_variable_requirement_result_change);
+}
+
+/**
+ * @brief Callback implementation to get current temperature value.
+ *
+ * @param[out] sample Current temperature value is written here, should point to data of type Temperature.
+ */
+static void get_current_temperature_value(void *const sample)
+{
+    EAS_ASSERT(sample);
+    Temperature *const temperature = (Temperature *const)sample;
+    *temperature = current_temperature_get();
+}
+
+/**
+ * @brief Callback implementation to get current pressure value.
+ *
+ * @param[out] sample Current pressure value is written here, should point to data of type Pressure.
  */
-static void handle_light_intensity_value_change()
+static void get_current_pressure_value(void *const sample)
 {
-    light_intensity_requirement_list_for_each(evaluate_variable_requirement);
+    EAS_ASSERT(sample);
+    Pressure *const pressure = (Pressure *const)sample;
+    *pressure = current_pressure_get();
+}
+
+/**
+ * @brief Callback implementation to get current humidity value.
+ *
+ * @param[out] sample Current humidity value is written here, should point to data of type Humidity.
+ */
+static void get_current_humidity_value(void *const sample)
+{
+    EAS_ASSERT(sample);
+    Humidity *const humidity = (Humidity *const)sample;
+    *humidity = current_humidity_get();
+}
+
+/**
+ * @brief Callback implementation to get current light intensity value.
+ *
+ * @param[out] sample Current light intensity value is written here, should point to data of type LightIntensity.
+ */
+static void get_current_light_intensity_value(void *const sample)
+{
+    EAS_ASSERT(sample);
+    LightIntensity *const light_intensity = (LightIntensity *const)sample;
+    *light_intensity = current_light_intensity_get();
 }
 
 /**
@@ -124,54 +281,6 @@ static void set_current_light_intensity_value(const void *const sample)
     current_light_intensity_set(*light_intensity);
 }
 
-/**
- * @brief Generic new sample handler.
- *
- * @param sample Pointer to the sample value. This pointer will be passed to the @p set_current_sample_value callback
- * function as a parameter. This pointer is not used for anything else.
- * @param notify_alert_evaluation_readiness The implementation of this callback should notify the alert evaluation
- * readiness module that a sample of this variable type has been received. The caller of this function knows the exact
- * variable for which this generic handler is being invoked.
- * @param set_current_sample_value This callback should set the new sample value to the current_<variable name> module.
- * @p sample is passed as a parameter to this callback function.
- * @param handle_sample_value_change The implementation of this callback function should update the alert condition
- * result of all alert conditions that contain a variable requirement of this variable type.
- * @param is_value_changed The implementation of this function should return true if the current value of that variable
- * changed with this sample, and false otherwise. @p set_current_sample_value is called before calling this function, so
- * this function should be simply current_<variable_name>_is_changed.
- */
-static void new_sample_handler(const void *const sample, void (*notify_alert_evaluation_readiness)(),
-                               void (*set_current_sample_value)(const void *const sample),
-                               void (*handle_sample_value_change)(), bool (*is_value_changed)())
-{
-    EAS_ASSERT(sample);
-    EAS_ASSERT(notify_alert_evaluation_readiness);
-    EAS_ASSERT(set_current_sample_value);
-    EAS_ASSERT(handle_sample_value_change);
-    EAS_ASSERT(is_value_changed);
-
-    bool is_ready_before = alert_evaluation_readiness_is_ready();
-    notify_alert_evaluation_readiness();
-    bool is_ready_after = alert_evaluation_readiness_is_ready();
-    set_current_sample_value(sample);
-
-    if (!is_ready_after) {
-        /* Samples of some variables have not been received yet - cannot evaluate alert conditions */
-        return;
-    }
-
-    if (!is_ready_before && is_ready_after) {
-        /* This is the sample that makes alert_evaluation_readiness ready to start evaluating alert conditions. Evaluate
-         * ALL variable requirements and alert conditions, not only the ones for this variable. */
-        handle_temperature_value_change();
-        handle_pressure_value_change();
-        handle_humidity_value_change();
-        handle_light_intensity_value_change();
-    } else if (is_value_changed()) {
-        handle_sample_value_change();
-    }
-}
-
 /**
  * @brief Check whether a new sample must be logged.
  *
@@ -187,51 +296,213 @@ static bool should_log_new_sample(EasTime last_sample_time)
                                       eas_time_offset_into_future(last_sample_time, NEW_SAMPLE_LOG_PERIOD_MS));
 }
 
-void new_sample_handler_temperature(Temperature temperature)
+/**
+ * @brief Callback implementation to record a new temperature sample.
+ *
+ * @param sample Pointer to temperature sample, should point to data of type Temperature.
+ */
+static void record_temperature_sample(const void *const sample)
 {
+    EAS_ASSERT(sample);
+    const Temperature temperature = *(const Temperature *const)sample;
     static EasTime last_sample_time = 0;
     if (should_log_new_sample(last_sample_time)) {
         last_sample_time = eas_current_time_get();
         EAS_LOG_INF("New temperature sample %d", temperature);
     }
-
-    new_sample_handler(&temperature, alert_evaluation_readiness_notify_received_temperature_sample,
-                       set_current_temperature_value, handle_temperature_value_change, current_temperature_is_changed);
+    sample_history_record_temperature(temperature);
+    sensor_readout_scheduler_schedule_temperature(temperature);
 }
 
-void new_sample_handler_pressure(Pressure pressure)
+/**
+ * @brief Callback implementation to record a new pressure sample.
+ *
+ * @param sample Pointer to pressure sample, should point to data of type Pressure.
+ */
+static void record_pressure_sample(const void *const sample)
 {
+    EAS_ASSERT(sample);
+    const Pressure pressure = *(const Pressure *const)sample;
     static EasTime last_sample_time = 0;
     if (should_log_new_sample(last_sample_time)) {
         last_sample_time = eas_current_time_get();
         EAS_LOG_INF("New pressure sample %d", pressure);
     }
-
-    new_sample_handler(&pressure, alert_evaluation_readiness_notify_received_pressure_sample,
-                       set_current_pressure_value, handle_pressure_value_change, current_pressure_is_changed);
+    sample_history_record_pressure(pressure);
+    sensor_readout_scheduler_schedule_pressure(pressure);
 }
 
-void new_sample_handler_humidity(Humidity humidity)
+/**
+ * @brief Callback implementation to record a new humidity sample.
+ *
+ * @param sample Pointer to humidity sample, should point to data of type Humidity.
+ */
+static void record_humidity_sample(const void *const sample)
 {
+    EAS_ASSERT(sample);
+    const Humidity humidity = *(const Humidity *const)sample;
     static EasTime last_sample_time = 0;
     if (should_log_new_sample(last_sample_time)) {
         last_sample_time = eas_current_time_get();
         EAS_LOG_INF("New humidity sample %d", humidity);
     }
-
-    new_sample_handler(&humidity, alert_evaluation_readiness_notify_received_humidity_sample,
-                       set_current_humidity_value, handle_humidity_value_change, current_humidity_is_changed);
+    sample_history_record_humidity(humidity);
+    sensor_readout_scheduler_schedule_humidity(humidity);
 }
 
-void new_sample_handler_light_intensity(LightIntensity light_intensity)
+/**
+ * @brief Callback implementation to record a new light intensity sample.
+ *
+ * @param sample Pointer to light intensity sample, should point to data of type LightIntensity.
+ */
+static void record_light_intensity_sample(const void *const sample)
 {
+    EAS_ASSERT(sample);
+    const LightIntensity light_intensity = *(const LightIntensity *const)sample;
     static EasTime last_sample_time = 0;
     if (should_log_new_sample(last_sample_time)) {
         last_sample_time = eas_current_time_get();
         EAS_LOG_INF("New light intensity sample %d", light_intensity);
     }
+    sample_history_record_light_intensity(light_intensity);
+    sensor_readout_scheduler_schedule_light_intensity(light_intensity);
+}
+
+/** Callbacks that handle the samples of one variable. */
+typedef struct VariableSampleHandler {
+    /** MULTI_SAMPLE_<variable> bit of the variable. */
+    uint8_t variable;
+    /** Offset of the sample of the variable in MultiSample. */
+    size_t sample_offset;
+    /** Logs the sample, records it in the sample history and schedules the next readout of the variable. */
+    void (*record_sample)(const void *const sample);
+    /** Notifies the alert evaluation readiness module that a sample of this variable has been received. */
+    void (*notify_alert_evaluation_readiness)();
+    /** Writes the current value of this variable, obtained from the current_<variable name> module, to the buffer
+     * passed as a parameter. Only called once the samples of all variables have been received. */
+    void (*get_current_sample_value)(void *const sample);
+    /** Sets the new sample value to the current_<variable name> module. */
+    void (*set_current_sample_value)(const void *const sample);
+    /** Updates the alert condition results of all alert conditions that contain a variable requirement of this variable
+     * whose result could have changed. The previous and the current value of the variable are passed as parameters. */
+    void (*handle_sample_value_change)(const void *const previous_sample, const void *const sample);
+    /** Returns true if the current value of the variable changed with the last call to set_current_sample_value. */
+    bool (*is_value_changed)();
+} VariableSampleHandler;
+
+static const VariableSampleHandler variable_sample_handlers[] = {
+    {
+        .variable = MULTI_SAMPLE_TEMPERATURE,
+        .sample_offset = offsetof(MultiSample, temperature),
+        .record_sample = record_temperature_sample,
+        .notify_alert_evaluation_readiness = alert_evaluation_readiness_notify_received_temperature_sample,
+        .get_current_sample_value = get_current_temperature_value,
+        .set_current_sample_value = set_current_temperature_value,
+        .handle_sample_value_change = handle_temperature_value_change,
+        .is_value_changed = current_temperature_is_changed,
+    },
+    {
+        .variable = MULTI_SAMPLE_PRESSURE,
+        .sample_offset = offsetof(MultiSample, pressure),
+        .record_sample = record_pressure_sample,
+        .notify_alert_evaluation_readiness = alert_evaluation_readiness_notify_received_pressure_sample,
+        .get_current_sample_value = get_current_pressure_value,
+        .set_current_sample_value = set_current_pressure_value,
+        .handle_sample_value_change = handle_pressure_value_change,
+        .is_value_changed = current_pressure_is_changed,
+    },
+    {
+        .variable = MULTI_SAMPLE_HUMIDITY,
+        .sample_offset = offsetof(MultiSample, humidity),
+        .record_sample = record_humidity_sample,
+        .notify_alert_evaluation_readiness = alert_evaluation_readiness_notify_received_humidity_sample,
+        .get_current_sample_value = get_current_humidity_value,
+        .set_current_sample_value = set_current_humidity_value,
+        .handle_sample_value_change = handle_humidity_value_change,
+        .is_value_changed = current_humidity_is_changed,
+    },
+    {
+        .variable = MULTI_SAMPLE_LIGHT_INTENSITY,
+        .sample_offset = offsetof(MultiSample, light_intensity),
+        .record_sample = record_light_intensity_sample,
+        .notify_alert_evaluation_readiness = alert_evaluation_readiness_notify_received_light_intensity_sample,
+        .get_current_sample_value = get_current_light_intensity_value,
+        .set_current_sample_value = set_current_light_intensity_value,
+        .handle_sample_value_change = handle_light_intensity_value_change,
+        .is_value_changed = current_light_intensity_is_changed,
+    },
+};
+
+#define NUM_VARIABLE_SAMPLE_HANDLERS (sizeof(variable_sample_handlers) / sizeof(variable_sample_handlers[0]))
+
+void new_sample_handler_multi_sample(const MultiSample *const multi_sample)
+{
+    EAS_ASSERT(multi_sample);
+    bool is_valid_variables = (multi_sample->variables != 0);
+    EAS_ASSERT(is_valid_variables);
+
+    /* Values of the variables before they are overwritten by the samples */
+    MultiSample previous_sample;
+    bool is_ready_before = alert_evaluation_readiness_is_ready();
+    for (size_t i = 0; i < NUM_VARIABLE_SAMPLE_HANDLERS; i++) {
+        const VariableSampleHandler *const handler = &variable_sample_handlers[i];
+        if (!(multi_sample->variables & handler->variable)) {
+            continue;
+        }
+        const void *const sample = (const uint8_t *)multi_sample + handler->sample_offset;
+        handler->record_sample(sample);
+        if (is_ready_before) {
+            /* Samples of all variables have been received, so the current value of this variable is available */
+            handler->get_current_sample_value((uint8_t *)&previous_sample + handler->sample_offset);
+        }
+        handler->notify_alert_evaluation_readiness();
+        handler->set_current_sample_value(sample);
+    }
+    bool is_ready_after = alert_evaluation_readiness_is_ready();
+
+    if (!is_ready_after) {
+        /* Samples of some variables have not been received yet - cannot evaluate alert conditions */
+        return;
+    }
 
-    new_sample_handler(&light_intensity, alert_evaluation_readiness_notify_received_light_intensity_sample,
-                       set_current_light_intensity_value, handle_light_intensity_value_change,
-                       current_light_intensity_is_changed);
+    if (!is_ready_before) {
+        /* These are the samples that make alert_evaluation_readiness ready to start evaluating alert conditions.
+         * Evaluate ALL variable requirements and alert conditions, not only the ones for these variables. */
+        evaluate_all_variable_requirements();
+    } else {
+        /* All variables are updated before any alert raiser is, so that alerts that depend on several of these
+         * variables never see some of them with their new values and others with their previous values */
+        for (size_t i = 0; i < NUM_VARIABLE_SAMPLE_HANDLERS; i++) {
+            const VariableSampleHandler *const handler = &variable_sample_handlers[i];
+            if ((multi_sample->variables & handler->variable) && handler->is_value_changed()) {
+                handler->handle_sample_value_change((const uint8_t *)&previous_sample + handler->sample_offset,
+                                                    (const uint8_t *)multi_sample + handler->sample_offset);
+            }
+        }
+    }
+    update_pending_alert_raisers();
+}
+
+void new_sample_handler_temperature(Temperature temperature)
+{
+    MultiSample multi_sample = {.variables = MULTI_SAMPLE_TEMPERATURE, .temperature = temperature};
+    new_sample_handler_multi_sample(&multi_sample);
+}
+
+void new_sample_handler_pressure(Pressure pressure)
+{
+    MultiSample multi_sample = {.variables = MULTI_SAMPLE_PRESSURE, .pressure = pressure};
+    new_sample_handler_multi_sample(&multi_sample);
+}
+
+void new_sample_handler_humidity(Humidity humidity)
+{
+    MultiSample multi_sample = {.variables = MULTI_SAMPLE_HUMIDITY, .humidity = humidity};
+    new_sample_handler_multi_sample(&multi_sample);
+}
+
+void new_sample_handler_light_intensity(LightIntensity light_intensity)
+{
+    MultiSample multi_sample = {.variables = MULTI_SAMPLE_LIGHT_INTENSITY, .light_intensity = light_intensity};
+    new_sample_handler_multi_sample(&multi_sample);
 }
@@ -10,6 +10,7 @@ extern "C"
 #include "pressure.h"
 #include "humidity.h"
 #include "light_intensity.h"
+#include "multi_sample.h"
 
 /**
  * @brief Event handlers that handle new sample events.
@@ -45,6 +46,17 @@ void new_sample_handler_humidity(Humidity humidity);
  */
 void new_sample_handler_light_intensity(LightIntensity light_intensity);
 
+/**
+ * @brief Handles a "new multi sample" event.
+ *
+ * The current values of all variables in @p multi_sample are updated first, and then all affected alert conditions are
+ * evaluated in one pass. An alert condition that contains requirements of several of these variables is evaluated
+ * once, and only with the new values of all of them.
+ *
+ * @param multi_sample Sample values. Must contain the sample of at least one variable.
+ */
+void new_sample_handler_multi_sample(const MultiSample *const multi_sample);
+
 #ifdef __cplusplus
 }
 #endif
@@ -20,3 +20,8 @@ void new_sample_callback_light_intensity(LightIntensity sample, void *user_data)
 {
     central_event_queue_submit_new_light_intensity_sample_event(sample);
 }
+
+void new_sample_callback_multi_sample(const MultiSample *const multi_sample, void *user_data)
+{
+    central_event_queue_submit_new_multi_sample_event(multi_sample);
+}
@@ -10,6 +10,7 @@ extern "C"
 #include "pressure.h"
 #include "humidity.h"
 #include "light_intensity.h"
+#include "multi_sample.h"
 
 /**
  * @brief Callbacks to execute whenever a new sample is received from HAL.
@@ -45,6 +46,14 @@ void new_sample_callback_humidity(Humidity sample, void *user_data);
  */
 void new_sample_callback_light_intensity(LightIntensity sample, void *user_data);
 
+/**
+ * @brief Callback to execute when samples of several variables that were read out together are received from the
+ * hardware.
+ *
+ * @param multi_sample Samples.
+ */
+void new_sample_callback_multi_sample(const MultiSample *const multi_sample, void *user_data);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,105 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "sample_history_reporter.h"
+#include "sample_history.h"
+#include "central_event_queue.h"
+#include "msg_transceiver.h"
+#include "eas_assert.h"
+#include "config.h"
+
+#ifndef CONFIG_SAMPLE_HISTORY_BLOCK_SIZE
+#define CONFIG_SAMPLE_HISTORY_BLOCK_SIZE 64
+#endif
+
+static bool is_read_out_in_progress = false;
+/** Block that is being sent. Valid only if has_block is true. */
+static uint8_t block[CONFIG_SAMPLE_HISTORY_BLOCK_SIZE];
+static size_t block_num_bytes = 0;
+static bool has_block = false;
+/** Index of the block that is being sent within the current read-out */
+static uint16_t block_index = 0;
+/** Offset of the next fragment of the block that is going to be sent */
+static size_t offset = 0;
+
+static void message_sent_cb(bool result, void *user_data);
+
+/**
+ * @brief Get the number of bytes in the fragment of the block that starts at offset.
+ */
+static size_t get_fragment_num_bytes()
+{
+    size_t num_remaining_bytes = block_num_bytes - offset;
+    return (num_remaining_bytes < MSG_TRANSCEIVER_SAMPLE_HISTORY_MAX_NUM_BYTES_IN_MESSAGE)
+               ? num_remaining_bytes
+               : MSG_TRANSCEIVER_SAMPLE_HISTORY_MAX_NUM_BYTES_IN_MESSAGE;
+}
+
+/**
+ * @brief Send the fragment of the block that starts at offset, or the message that ends the read-out if there are no
+ * more blocks.
+ */
+static void send_fragment()
+{
+    MsgTransceiverSampleHistoryFragment fragment = {
+        .block_index = block_index,
+        .offset = (uint8_t)offset,
+        .bytes = has_block ? &block[offset] : NULL,
+        .num_bytes = has_block ? (uint8_t)get_fragment_num_bytes() : 0,
+    };
+    msg_transceiver_send_sample_history_message(&fragment, message_sent_cb, NULL);
+}
+
+/**
+ * @brief Send the next message of the read-out, or finish the read-out if all messages have been sent.
+ *
+ * @param result 1 if the previous message of the read-out was sent successfully, 0 otherwise.
+ */
+static void send_next_message(uint8_t result)
+{
+    if (!result || !has_block) {
+        /* Failed to send, or the message that ends the read-out has been sent */
+        is_read_out_in_progress = false;
+        return;
+    }
+
+    offset += get_fragment_num_bytes();
+    if (offset >= block_num_bytes) {
+        block_index++;
+        offset = 0;
+        has_block = sample_history_pop_block(block, &block_num_bytes);
+    }
+    send_fragment();
+}
+
+/**
+ * @brief Executed by msg_transceiver once a message of the read-out has been sent.
+ *
+ * This can be executed outside of the central event queue thread, so the next message is sent from an event handler.
+ *
+ * @param result True if the message was sent successfully, false otherwise.
+ * @param user_data User data, unused.
+ */
+static void message_sent_cb(bool result, void *user_data)
+{
+    central_event_queue_submit_void_cb_with_uint8_event(send_next_message, result ? 1 : 0);
+}
+
+void sample_history_reporter_report_sample_history(void *user_data)
+{
+    /* Offsets of fragments within a block must fit into one byte */
+    EAS_ASSERT(CONFIG_SAMPLE_HISTORY_BLOCK_SIZE <= 256);
+
+    if (is_read_out_in_progress) {
+        return;
+    }
+    is_read_out_in_progress = true;
+    block_index = 0;
+    /* Start from the beginning of the block that failed to send during the previous read-out, if there is one */
+    offset = 0;
+    if (!has_block) {
+        has_block = sample_history_pop_block(block, &block_num_bytes);
+    }
+    send_fragment();
+}
@@ -0,0 +1,32 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_APP_GLUE_SAMPLE_HISTORY_REPORTER_H
+#define ENV_ALERT_SYSTEM_SRC_APP_GLUE_SAMPLE_HISTORY_REPORTER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Read out the sample history.
+ *
+ * This function should be called whenever a "get sample history" message is received via the connection interface.
+ * Removes the sample history blocks from the sample_history module one by one, oldest first, and sends each block as
+ * "sample history" messages of up to MSG_TRANSCEIVER_SAMPLE_HISTORY_MAX_NUM_BYTES_IN_MESSAGE bytes. Once the sample
+ * history is empty, sends a "sample history" message without fragment bytes to end the read-out.
+ *
+ * The messages are sent one by one - the next message is sent once the previous one has been sent, so that the
+ * read-out occupies only one message slot of msg_transceiver at a time. If a message fails to send, the read-out stops.
+ * The block that was being sent is kept, and sent first during the next read-out.
+ *
+ * Does nothing if a read-out is already in progress.
+ *
+ * @param user_data User data. Unused, added to the function signature so that this function can be registered as a
+ * "get sample history" callback with the msg_transceiver module.
+ */
+void sample_history_reporter_report_sample_history(void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_APP_GLUE_SAMPLE_HISTORY_REPORTER_H */
@@ -0,0 +1,137 @@
+#include <stdint.h>
+
+#include "sensor_readout_scheduler.h"
+#include "temperature_requirement_list.h"
+#include "pressure_requirement_list.h"
+#include "humidity_requirement_list.h"
+#include "light_intensity_requirement_list.h"
+#include "hw_platform.h"
+#include "eas_assert.h"
+#include "config.h"
+
+/* By default, the readout periods are fixed - the maximum readout period is equal to the minimum one */
+
+#ifndef CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MIN_PERIOD_MS
+#define CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MIN_PERIOD_MS 250
+#endif
+
+#ifndef CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_PERIOD_MS
+#define CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_PERIOD_MS                                                      \
+    CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MIN_PERIOD_MS
+#endif
+
+#ifndef CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_RATE_OF_CHANGE
+#define CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_RATE_OF_CHANGE 1
+#endif
+
+#ifndef CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MIN_PERIOD_MS
+#define CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MIN_PERIOD_MS 1000
+#endif
+
+#ifndef CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MAX_PERIOD_MS
+#define CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MAX_PERIOD_MS CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MIN_PERIOD_MS
+#endif
+
+#ifndef CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MAX_RATE_OF_CHANGE
+#define CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MAX_RATE_OF_CHANGE 1
+#endif
+
+#ifndef CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MIN_PERIOD_MS
+#define CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MIN_PERIOD_MS 250
+#endif
+
+#ifndef CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MAX_PERIOD_MS
+#define CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MAX_PERIOD_MS CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MIN_PERIOD_MS
+#endif
+
+#ifndef CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MAX_RATE_OF_CHANGE
+#define CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MAX_RATE_OF_CHANGE 1
+#endif
+
+#ifndef CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MIN_PERIOD_MS
+#define CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MIN_PERIOD_MS 1000
+#endif
+
+#ifndef CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MAX_PERIOD_MS
+#define CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MAX_PERIOD_MS                                                  \
+    CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MIN_PERIOD_MS
+#endif
+
+#ifndef CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MAX_RATE_OF_CHANGE
+#define CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MAX_RATE_OF_CHANGE 1
+#endif
+
+#define MS_IN_S 1000
+
+/**
+ * @brief Compute the readout period of a sensor.
+ *
+ * @param distance Distance from the current value to the nearest requirement value.
+ * @param min_period_ms Minimum readout period.
+ * @param max_period_ms Maximum readout period.
+ * @param max_rate_of_change Maximum rate of change of the variable, in units of the variable per second.
+ *
+ * @return uint32_t Time in ms during which the variable cannot reach the nearest requirement value, limited to
+ * [@p min_period_ms, @p max_period_ms].
+ */
+static uint32_t get_readout_period(VariableRequirementThreshold distance, uint32_t min_period_ms,
+                                   uint32_t max_period_ms, uint32_t max_rate_of_change)
+{
+    EAS_ASSERT(min_period_ms > 0);
+    EAS_ASSERT(min_period_ms <= max_period_ms);
+    EAS_ASSERT(max_rate_of_change > 0);
+    EAS_ASSERT(distance >= 0);
+
+    /* Checked first, so that the multiplication below cannot overflow */
+    uint64_t max_period_distance = ((uint64_t)max_period_ms * max_rate_of_change) / MS_IN_S;
+    if ((uint64_t)distance >= max_period_distance) {
+        return max_period_ms;
+    }
+    uint64_t period_ms = ((uint64_t)distance * MS_IN_S) / max_rate_of_change;
+    return (period_ms > min_period_ms) ? (uint32_t)period_ms : min_period_ms;
+}
+
+void sensor_readout_scheduler_schedule_temperature(Temperature temperature)
+{
+    uint32_t period_ms = get_readout_period(temperature_requirement_list_get_distance_to_nearest(temperature),
+                                            CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MIN_PERIOD_MS,
+                                            CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_PERIOD_MS,
+                                            CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_RATE_OF_CHANGE);
+    hw_platform_get_temperature_sensor()->set_readout_period(period_ms);
+}
+
+void sensor_readout_scheduler_schedule_pressure(Pressure pressure)
+{
+    uint32_t period_ms = get_readout_period(pressure_requirement_list_get_distance_to_nearest(pressure),
+                                            CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MIN_PERIOD_MS,
+                                            CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MAX_PERIOD_MS,
+                                            CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MAX_RATE_OF_CHANGE);
+    hw_platform_get_pressure_sensor()->set_readout_period(period_ms);
+}
+
+void sensor_readout_scheduler_schedule_humidity(Humidity humidity)
+{
+    uint32_t period_ms = get_readout_period(humidity_requirement_list_get_distance_to_nearest(humidity),
+                                            CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MIN_PERIOD_MS,
+                                            CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MAX_PERIOD_MS,
+                                            CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MAX_RATE_OF_CHANGE);
+    hw_platform_get_humidity_sensor()->set_readout_period(period_ms);
+}
+
+void sensor_readout_scheduler_schedule_light_intensity(LightIntensity light_intensity)
+{
+    uint32_t period_ms = get_readout_period(light_intensity_requirement_list_get_distance_to_nearest(light_intensity),
+                                            CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MIN_PERIOD_MS,
+                                            CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MAX_PERIOD_MS,
+                                            CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MAX_RATE_OF_CHANGE);
+    hw_platform_get_light_intensity_sensor()->set_readout_period(period_ms);
+}
+
+void sensor_readout_scheduler_reset()
+{
+    hw_platform_get_temperature_sensor()->set_readout_period(CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MIN_PERIOD_MS);
+    hw_platform_get_pressure_sensor()->set_readout_period(CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MIN_PERIOD_MS);
+    hw_platform_get_humidity_sensor()->set_readout_period(CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MIN_PERIOD_MS);
+    hw_platform_get_light_intensity_sensor()->set_readout_period(
+        CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MIN_PERIOD_MS);
+}
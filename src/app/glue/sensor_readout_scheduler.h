@@ -0,0 +1,67 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_APP_GLUE_SENSOR_READOUT_SCHEDULER_H
+#define ENV_ALERT_SYSTEM_SRC_APP_GLUE_SENSOR_READOUT_SCHEDULER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "temperature.h"
+#include "pressure.h"
+#include "humidity.h"
+#include "light_intensity.h"
+
+/**
+ * @brief Adapts the readout period of every sensor to the distance from the current value to the nearest requirement
+ * value of that variable.
+ *
+ * A variable cannot change by more than its maximum rate of change per second. If the current value is d units away
+ * from the nearest requirement value, no requirement result can change during the next d / (maximum rate of change)
+ * seconds, so the sensor does not need to be read out before then. The readout period is set to that time, limited to
+ * the minimum and maximum readout period of the variable. As the value approaches a requirement value, the period
+ * shrinks to the minimum readout period, so changes near requirement values are detected as quickly as they would be
+ * with a fixed minimum readout period.
+ */
+
+/**
+ * @brief Schedule the temperature sensor readouts after a new temperature sample.
+ *
+ * @param temperature Temperature sample.
+ */
+void sensor_readout_scheduler_schedule_temperature(Temperature temperature);
+
+/**
+ * @brief Schedule the pressure sensor readouts after a new pressure sample.
+ *
+ * @param pressure Pressure sample.
+ */
+void sensor_readout_scheduler_schedule_pressure(Pressure pressure);
+
+/**
+ * @brief Schedule the humidity sensor readouts after a new humidity sample.
+ *
+ * @param humidity Humidity sample.
+ */
+void sensor_readout_scheduler_schedule_humidity(Humidity humidity);
+
+/**
+ * @brief Schedule the light intensity sensor readouts after a new light intensity sample.
+ *
+ * @param light_intensity Light intensity sample.
+ */
+void sensor_readout_scheduler_schedule_light_intensity(LightIntensity light_intensity);
+
+/**
+ * @brief Set the readout periods of all sensors to their minimum readout periods.
+ *
+ * Must be called whenever variable requirements are added, since a new requirement value can be closer to the current
+ * value than the ones that the readout periods were scheduled for. The next sample of every variable schedules its
+ * readout period again.
+ */
+void sensor_readout_scheduler_reset();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_APP_GLUE_SENSOR_READOUT_SCHEDULER_H */
@@ -0,0 +1,65 @@
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "stats_reporter.h"
+#include "central_event_queue.h"
+#include "msg_transceiver.h"
+
+static bool is_report_in_progress = false;
+/** Event id whose "event stats" message is going to be sent next */
+static uint8_t next_event_id = 0;
+
+static void message_sent_cb(bool result, void *user_data);
+
+/**
+ * @brief Send the next message of the report, or finish the report if all messages have been sent.
+ *
+ * @param result 1 if the previous message of the report was sent successfully, 0 otherwise.
+ */
+static void send_next_message(uint8_t result)
+{
+    if (!result || (next_event_id >= central_event_queue_get_num_event_ids())) {
+        is_report_in_progress = false;
+        return;
+    }
+
+    CentralEventQueueEventStats event_stats;
+    central_event_queue_get_event_stats(next_event_id, &event_stats);
+    MsgTransceiverEventStats stats = {
+        .event_id = next_event_id,
+        .num_handled = event_stats.num_handled,
+        .total_handler_cycles = event_stats.total_handler_cycles,
+        .max_handler_cycles = event_stats.max_handler_cycles,
+    };
+    next_event_id++;
+    msg_transceiver_send_event_stats_message(&stats, message_sent_cb, NULL);
+}
+
+/**
+ * @brief Executed by msg_transceiver once a message of the report has been sent.
+ *
+ * This can be executed outside of the central event queue thread, so the next message is sent from an event handler.
+ *
+ * @param result True if the message was sent successfully, false otherwise.
+ * @param user_data User data, unused.
+ */
+static void message_sent_cb(bool result, void *user_data)
+{
+    central_event_queue_submit_void_cb_with_uint8_event(send_next_message, result ? 1 : 0);
+}
+
+void stats_reporter_report_stats(void *user_data)
+{
+    if (is_report_in_progress) {
+        return;
+    }
+    is_report_in_progress = true;
+    next_event_id = 0;
+
+    MsgTransceiverEventQueueStats stats = {
+        .num_slots = (uint8_t)central_event_queue_get_num_slots(),
+        .high_watermark = (uint8_t)central_event_queue_get_high_watermark(),
+        .num_event_ids = central_event_queue_get_num_event_ids(),
+    };
+    msg_transceiver_send_event_queue_stats_message(&stats, message_sent_cb, NULL);
+}
@@ -0,0 +1,28 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_APP_GLUE_STATS_REPORTER_H
+#define ENV_ALERT_SYSTEM_SRC_APP_GLUE_STATS_REPORTER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Report central event queue statistics.
+ *
+ * This function should be called whenever a "get stats" message is received via the connection interface. Sends an
+ * "event queue stats" message, followed by an "event stats" message for every event id. The messages are sent one by
+ * one - the next message is sent once the previous one has been sent, so that the report occupies only one message
+ * slot of msg_transceiver at a time. If a message fails to send, the rest of the report is dropped.
+ *
+ * Does nothing if a report is already in progress.
+ *
+ * @param user_data User data. Unused, added to the function signature so that this function can be registered as a
+ * "get stats" callback with the msg_transceiver module.
+ */
+void stats_reporter_report_stats(void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_APP_GLUE_STATS_REPORTER_H */
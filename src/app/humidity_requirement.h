@@ -24,13 +24,31 @@ extern "C"
  * requirement evaluates to true iff the current humidity is less than or equal to @p value.
  *
  * @param alert_id Alert id of the alert to which this humidity requirement belongs.
- * @param operator Use one of the values from @ref VariableRequirementOperator. Variable requirement operator to use
- * when evaluating the requirement.
+ * @param operator VARIABLE_REQUIREMENT_OPERATOR_GEQ or VARIABLE_REQUIREMENT_OPERATOR_LEQ. Variable requirement operator
+ * to use when evaluating the requirement. Band requirements are created by @ref humidity_requirement_create_band.
  * @param value Humidity requirement value.
  *
  * @return VariableRequirement Created instance of humidity requirement.
  */
-VariableRequirement humidity_requirement_create(uint8_t alert_id, uint8_t operator, Humidity value);
+VariableRequirement humidity_requirement_create(uint16_t alert_id, uint8_t operator, Humidity value);
+
+/**
+ * @brief Create a humidity band requirement instance.
+ *
+ * If operator is VARIABLE_REQUIREMENT_OPERATOR_INSIDE, the variable requirement evaluates to true iff the current
+ * humidity is greater than or equal to @p lower_value and less than or equal to @p upper_value. If the operator is
+ * VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE, the variable requirement evaluates to true iff the current humidity is less
+ * than @p lower_value or greater than @p upper_value.
+ *
+ * @param alert_id Alert id of the alert to which this humidity requirement belongs.
+ * @param operator VARIABLE_REQUIREMENT_OPERATOR_INSIDE or VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE.
+ * @param lower_value Lower humidity requirement value.
+ * @param upper_value Upper humidity requirement value. Must be greater than @p lower_value.
+ *
+ * @return VariableRequirement Created instance of humidity requirement.
+ */
+VariableRequirement humidity_requirement_create_band(uint16_t alert_id, uint8_t operator, Humidity lower_value,
+                                                     Humidity upper_value);
 
 #ifdef __cplusplus
 }
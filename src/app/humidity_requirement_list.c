@@ -24,7 +24,23 @@ void humidity_requirement_list_for_each(VariableRequirementListForEachCb cb)
     variable_requirement_list_for_each(get_instance(), cb);
 }
 
-void humidity_requirement_list_remove_all_for_alert(uint8_t alert_id)
+void humidity_requirement_list_evaluate(Humidity value, VariableRequirementListResultChangedCb cb)
+{
+    variable_requirement_list_evaluate(get_instance(), value, cb);
+}
+
+void humidity_requirement_list_evaluate_in_range(Humidity previous_value, Humidity value,
+                                                 VariableRequirementListResultChangedCb cb)
+{
+    variable_requirement_list_evaluate_in_range(get_instance(), previous_value, value, cb);
+}
+
+VariableRequirementThreshold humidity_requirement_list_get_distance_to_nearest(Humidity value)
+{
+    return variable_requirement_list_get_distance_to_nearest(get_instance(), value);
+}
+
+void humidity_requirement_list_remove_all_for_alert(uint16_t alert_id)
 {
     variable_requirement_list_remove_all_for_alert(get_instance(), alert_id);
 }
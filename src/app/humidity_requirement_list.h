@@ -8,6 +8,7 @@ extern "C"
 
 #include <stdint.h>
 
+#include "humidity.h"
 #include "variable_requirement_list_defs.h"
 
 /**
@@ -31,12 +32,47 @@ void humidity_requirement_list_add(VariableRequirement humidity_requirement);
  */
 void humidity_requirement_list_for_each(VariableRequirementListForEachCb cb);
 
+/**
+ * @brief Evaluate all humidity requirements for a humidity value.
+ *
+ * @param value Current humidity value.
+ * @param cb Callback to execute for each humidity requirement whose result changed, see @ref
+ * variable_requirement_list_evaluate.
+ *
+ * @note Fires an assert if @p cb is NULL.
+ */
+void humidity_requirement_list_evaluate(Humidity value, VariableRequirementListResultChangedCb cb);
+
+/**
+ * @brief Evaluate the humidity requirements whose results could have been changed by a humidity change.
+ *
+ * Only the humidity requirements with requirement values between @p previous_value and @p value are evaluated.
+ *
+ * @param previous_value Previous humidity value.
+ * @param value Current humidity value.
+ * @param cb Callback to execute for each humidity requirement whose result changed, see @ref
+ * variable_requirement_list_evaluate_in_range.
+ *
+ * @note Fires an assert if @p cb is NULL.
+ */
+void humidity_requirement_list_evaluate_in_range(Humidity previous_value, Humidity value,
+                                                 VariableRequirementListResultChangedCb cb);
+
+/**
+ * @brief Get the distance from a humidity value to the nearest requirement value of a humidity requirement.
+ *
+ * @param value Current humidity value.
+ *
+ * @return VariableRequirementThreshold Distance, see @ref variable_requirement_list_get_distance_to_nearest.
+ */
+VariableRequirementThreshold humidity_requirement_list_get_distance_to_nearest(Humidity value);
+
 /**
  * @brief Remove all humidity requirements from the list that belong to a specific alert.
  *
  * @param alert_id All humidity requirements that belong to the alert with this id are removed from the list.
  */
-void humidity_requirement_list_remove_all_for_alert(uint8_t alert_id);
+void humidity_requirement_list_remove_all_for_alert(uint16_t alert_id);
 
 #ifdef __cplusplus
 }
@@ -1,12 +1,10 @@
 #include <stddef.h>
 #include <stdbool.h>
+#include <stdint.h>
 
-#include "led_manager_private.h"
 #include "led_manager.h"
 #include "eas_timer.h"
-#include "utils/linked_list.h"
 #include "config.h"
-#include "led_notification_allocator.h"
 #include "eas_assert.h"
 #include "utils/eas_time.h"
 #include "eas_current_time.h"
@@ -25,107 +23,82 @@ EAS_STATIC_ASSERT(LED_MANAGER_NOTIFICATION_DURATION_MS != 0);
 /** Ensure LED_MANAGER_IGNORE_TIMER_PERIOD_MS is not negative */
 EAS_STATIC_ASSERT(CONFIG_LED_MANAGER_IGNORE_TIMER_MARGIN_MS <= LED_MANAGER_NOTIFICATION_DURATION_MS);
 
-static size_t num_notifications = 0;
-/** Points to the LedNotification that is currently being displayed. Should always point to a LedNotification element
- * currently in the linked list of notifications. NULL if the LED is turned off. */
-static const LedNotification *displayed_notification = NULL;
-static void *iterator = NULL;
-static const LedNotification *removed_notification = NULL;
-static const LedNotification *next_notification_after_removed = NULL;
+/* Must be updated if colors or patterns are added to led_defs.h */
+#define LED_MANAGER_NUM_LED_COLORS (LED_COLOR_BLUE + 1)
+#define LED_MANAGER_NUM_LED_PATTERNS (LED_PATTERN_ALERT + 1)
+
+/** Every (color, pattern) pair is one notification slot. Slot of a notification is led_color * num patterns +
+ * led_pattern, which is also the order in which notifications are displayed. */
+#define LED_MANAGER_NUM_SLOTS (LED_MANAGER_NUM_LED_COLORS * LED_MANAGER_NUM_LED_PATTERNS)
+
+/** Active slots are kept in a uint8_t bitmap */
+EAS_STATIC_ASSERT(LED_MANAGER_NUM_SLOTS <= 8);
+
+/** Value of displayed_slot when the led is turned off */
+#define LED_MANAGER_NO_SLOT UINT8_MAX
+
+/** How many times each notification has been added and not yet removed. The notification is displayed while its count
+ * is > 0. */
+static uint16_t slot_counts[LED_MANAGER_NUM_SLOTS];
+/** Bit i is set if slot_counts[i] > 0 */
+static uint8_t active_slots = 0;
+/** Number of bits set in active_slots, i.e. number of distinct notifications that are being displayed */
+static size_t num_active_slots = 0;
+/** Slot of the notification that is currently being displayed. LED_MANAGER_NO_SLOT if the led is turned off. */
+static uint8_t displayed_slot = LED_MANAGER_NO_SLOT;
 static EasTime ignore_timer_before_time = 0;
 static bool is_timer_running = false;
 
 /**
- * @brief Get linked list instance of led notifications.
+ * @brief Get the slot of a notification.
  *
- * @return LinkedList Linked list instance.
- */
-static LinkedList get_linked_list_instance()
-{
-    static LinkedList instance;
-    static bool is_created = false;
-    if (!is_created) {
-        instance = linked_list_create();
-        is_created = true;
-    }
-    return instance;
-}
-
-/**
- * @brief Reset notification iterator.
+ * @param led_color Led notification color.
+ * @param led_pattern Led notification pattern.
  *
- * After a call to this function, the iteration over the notification linked list will start from the beginning of the
- * list. The next call to @ref advance_notification_iterator will return the first notification in the notification
- * linked list.
+ * @return uint8_t Slot of the notification.
  */
-static void reset_notification_iterator()
+static uint8_t get_slot(LedColor led_color, LedPattern led_pattern)
 {
-    iterator = linked_list_iterator_init(get_linked_list_instance());
+    bool is_valid_notification =
+        ((led_color < LED_MANAGER_NUM_LED_COLORS) && (led_pattern < LED_MANAGER_NUM_LED_PATTERNS));
+    EAS_ASSERT(is_valid_notification);
+    return (uint8_t)((led_color * LED_MANAGER_NUM_LED_PATTERNS) + led_pattern);
 }
 
 /**
- * @brief Advances notification list iterator to point to the next notification.
+ * @brief Get the next active slot after @p slot, wrapping around after the last slot.
  *
- * If before calling this function the iterator is pointing to the last notification in the list, this function will
- * wrap around and return the first notifiction in the list.
+ * If @p slot is the only active slot, returns @p slot.
  *
- * If there is only one notification in the list, this function will always return that one notification.
+ * @param slot Slot to start the search after.
  *
- * @pre Linked list iterator has been reset by calling @ref reset_notification_iterator.
- * @pre There is at least one element present in the linked list.
+ * @pre At least one slot is active.
  *
- * @return LedNotification * The notification that the now advanced iterator points to.
+ * @return uint8_t Next active slot.
  */
-static LedNotification *advance_notification_iterator()
+static uint8_t get_next_active_slot(uint8_t slot)
 {
-    LedNotification *next_notification = NULL;
-    bool element_valid = linked_list_iterator_next(&iterator, (void **)&next_notification);
-    if (!element_valid) {
-        iterator = linked_list_iterator_init(get_linked_list_instance());
-        element_valid = linked_list_iterator_next(&iterator, (void **)&next_notification);
-        EAS_ASSERT(element_valid);
+    EAS_ASSERT(active_slots);
+    for (size_t i = 1; i <= LED_MANAGER_NUM_SLOTS; i++) {
+        uint8_t candidate = (uint8_t)((slot + i) % LED_MANAGER_NUM_SLOTS);
+        if (active_slots & (1U << candidate)) {
+            return candidate;
+        }
     }
-    return next_notification;
+    /* Unreachable, since at least one slot is active */
+    EAS_ASSERT(false);
+    return slot;
 }
 
 /**
- * @brief Reset the iterator and iterate until the requested notification.
- *
- * After a call to this function, a subsequent call to @ref advance_notification_iterator will return the next
- * notification in the list after @p led_notification.
- *
- * @param led_notification Led notification to iterate until.
- *
- * @warning Fires an assert if @p led_notification is not present in the notification list. This function is only
- * allowed to be called if the caller is sure that @p led_notification is present in the list.
- */
-static void reset_iterator_and_iterate_until(const LedNotification *led_notification)
-{
-    EAS_ASSERT(led_notification);
-
-    reset_notification_iterator();
-    LedNotification *current_notification = NULL;
-    bool element_valid;
-    do {
-        element_valid = linked_list_iterator_next(&iterator, (void **)&current_notification);
-    } while ((current_notification != led_notification) && element_valid);
-    /* If element is invalid here, this means that we reached the end of the list and did not find the requested
-     * notification. This should never happen. */
-    EAS_ASSERT(element_valid);
-}
-
-/**
- * @brief Set the led to display the color and pattern of the notification.
- *
- * @param led_notification Notification to display.
+ * @brief Set the led to display the color and pattern of the notification in @p slot.
  *
- * @warning @p led_notification must always point to a led notification element that is currently present in the linked
- * list of notifications. It must not point to any stack-allocated LedNotifications.
+ * @param slot Slot of the notification to display.
  */
-static void display_notification(const LedNotification *led_notification)
+static void display_slot(uint8_t slot)
 {
-    displayed_notification = led_notification;
-    led_setter_set(led_notification->led_color, led_notification->led_pattern);
+    displayed_slot = slot;
+    led_setter_set((LedColor)(slot / LED_MANAGER_NUM_LED_PATTERNS), (LedPattern)(slot % LED_MANAGER_NUM_LED_PATTERNS));
 }
 
 /**
@@ -133,21 +106,10 @@ static void display_notification(const LedNotification *led_notification)
  */
 static void turn_off_led()
 {
-    displayed_notification = NULL;
+    displayed_slot = LED_MANAGER_NO_SLOT;
     led_setter_turn_off();
 }
 
-/**
- * @brief Displays the next led notification in the list.
- *
- * If the current notification is the last one in the list, displays the first notification in the list.
- */
-static void display_next_notification()
-{
-    LedNotification *notification_to_display = advance_notification_iterator();
-    display_notification(notification_to_display);
-}
-
 /**
  * @brief Notification timer expiry callback.
  *
@@ -169,7 +131,7 @@ static void notification_timer_cb(void *user_data)
      * callback is ignored. */
     EasTime current_time = eas_current_time_get();
     if (is_timer_running && eas_time_is_equal_or_after(current_time, ignore_timer_before_time)) {
-        display_next_notification();
+        display_slot(get_next_active_slot(displayed_slot));
     }
 }
 
@@ -190,132 +152,6 @@ static EasTimer get_timer_instance()
     return instance;
 }
 
-/**
- * @brief Add a led notification to the list of led notifications to be displayed.
- *
- * @param led_notification Led notification to add to the list.
- *
- * @note @p led_notification should not contain the address of a stack-allocated variable. It should point to memory
- * that will be valid at least until the led notification is removed from the list.
- */
-static void add_notification_to_list(LedNotification *led_notification)
-{
-    linked_list_append(get_linked_list_instance(), led_notification);
-    num_notifications++;
-}
-
-/**
- * @brief Remove condition callback passed to linked list remove function.
- *
- * The return value of this function determines whether the notification is removed from the list.
- *
- * @param element Linked list element (led notification) for which this callback is called.
- * @param user_data User data. This contains a pointer to the led notification that should be removed.
- *
- * @return true @p element and led notification in @p user_data have the same color and pattern, so @p element should be
- * removed from the list.
- * @return false @p element and led notification in @p user_data have different color or pattern, so @p element should
- * not be removed from the list.
- */
-static bool remove_condition_cb(void *element, void *user_data)
-{
-    EAS_ASSERT(element);
-    EAS_ASSERT(user_data);
-
-    const LedNotification *current_notif = (const LedNotification *)element;
-    const LedNotification *notif_to_remove = (const LedNotification *)user_data;
-
-    bool should_remove = ((current_notif->led_color == notif_to_remove->led_color) &&
-                          (current_notif->led_pattern == notif_to_remove->led_pattern));
-    return should_remove;
-}
-
-/**
- * @brief Frees the memory of the LedNotification list element.
- *
- * This function is passed as a callback to the remove function of the linked list to be executed before the element is
- * removed from the list.
- *
- * @param element Linked list element that is about to be removed from the list.
- * @param user_data Callback user data.
- */
-static void free_led_notification(void *element, void *user_data)
-{
-    EAS_ASSERT(element);
-
-    led_notification_allocator_free((LedNotification *)element);
-}
-
-/**
- * @brief Iterates through the list and saves the notification to be removed and the one after it.
- *
- * This function is passed as a callback to the remove function of the linked list to be executed before the element is
- * removed from the list.
- *
- * @param element Linked list element that is about to be removed from the list.
- * @param user_data Callback user data.
- *
- * @warning This function should only be passed as a callback to the remove function from the linked list module if
- * there are at least 2 elements present in the list. This is because the purpose of this function is to save two
- * notifications - the one that is being removed and the one that is in the list right after it.
- */
-static void find_next_notification_after_removed_and_free(void *element, void *user_data)
-{
-    EAS_ASSERT(element);
-
-    LedNotification *led_notification_to_remove = (LedNotification *)element;
-    /* Save the notification to be removed, so that we can later check if we removed the notification that was being
-     * displayed. */
-    removed_notification = led_notification_to_remove;
-
-    /* We need to find the next notification in the list after the removed one. Iterate until the notification
-     * that is about to be removed. */
-    reset_iterator_and_iterate_until(led_notification_to_remove);
-
-    /* Advance the iterator once more to get the next notification after the one to be removed. */
-    next_notification_after_removed = advance_notification_iterator();
-
-    /* This assert will fire if there is only one element in the list. This is not allowed, since we want to save the
-     * notification to be removed and the one right after it in the list. */
-    EAS_ASSERT(led_notification_to_remove != next_notification_after_removed);
-
-    /* Free the memory of the notification about to be removed. */
-    led_notification_allocator_free(led_notification_to_remove);
-}
-
-/**
- * @brief Remove a notification from the list of notifications.
- *
- * If there are several notifications in the list with color @p led_color and pattern @p led_pattern, removes only the
- * first such notification.
- *
- * @param led_color Led notification color.
- * @param led_pattern Led notification pattern.
- * @param pre_remove_cb Linked list pre remove callback to execute before removing the notification from the linked list
- * of notifications.
- *
- * @return true Notification was found and removed.
- * @return false Notification was not found in the list, nothing is done.
- */
-static bool remove_notification_from_list(LedColor led_color, LedPattern led_pattern,
-                                          LinkedListPreRemoveCb pre_remove_cb)
-{
-    LedNotification led_notification_to_remove = {.led_color = led_color, .led_pattern = led_pattern};
-
-    /* Remove at most one element. It can be the case that there are several notification with the same color and
-     * pattern. Here we want to remove only the first occurrence. */
-    size_t num_removed = linked_list_remove_on_condition_with_limit(get_linked_list_instance(), 1, remove_condition_cb,
-                                                                    &led_notification_to_remove, pre_remove_cb, NULL);
-    EAS_ASSERT(num_removed <= 1);
-
-    if (num_removed == 1) {
-        num_notifications--;
-        return true;
-    } else { /* num_removed == 0 */
-        return false;
-    }
-}
-
 /** Start notification timer. */
 static void start_notification_timer()
 {
@@ -334,79 +170,58 @@ static void stop_notification_timer()
 
 void led_manager_add_notification(LedColor led_color, LedPattern led_pattern)
 {
-    LedNotification *led_notification = led_notification_allocator_alloc();
-    EAS_ASSERT(led_notification);
-
-    led_notification->led_color = led_color;
-    led_notification->led_pattern = led_pattern;
-    add_notification_to_list(led_notification);
-    /* To ensure the if below covers all possibilities */
-    EAS_ASSERT(num_notifications > 0);
+    uint8_t slot = get_slot(led_color, led_pattern);
+    EAS_ASSERT(slot_counts[slot] < UINT16_MAX);
+    slot_counts[slot]++;
+    if (slot_counts[slot] > 1) {
+        /* This notification is already being displayed */
+        return;
+    }
 
-    if (num_notifications == 1) {
+    active_slots |= (uint8_t)(1U << slot);
+    num_active_slots++;
+    if (num_active_slots == 1) {
         /* This is the only notification - set the led immediately */
-        display_notification(led_notification);
-    } else if (num_notifications == 2) {
+        display_slot(slot);
+    } else if (num_active_slots == 2) {
         /* This is the second notification. Need to start alternating between displaying the two notifications. */
-        reset_notification_iterator();
-        /* We advance the iterator to point to the first notification, but we do not display it, because it is
-         * already being displayed. When the timer expires, the iterator will advance to the second notification, and
-         * the led will display the second notification. */
-        /* Ignore return value - we only need to advance the iterator */
-        advance_notification_iterator();
         start_notification_timer();
-    } else {
-        /* There were already 2 or more notifications in the list before this one was added. The switching between
-         * different notifications was already ongoing. Since we added an element to the linked list of notifications,
-         * we need to reset the iterator, as per linked list docs. Set the iterator to point to the currently displayed
-         * notification - exactly as it was before adding this notification. */
-        reset_iterator_and_iterate_until(displayed_notification);
     }
+    /* If there were already 2 or more notifications, the switching between them is already ongoing. The new
+     * notification is displayed once the switching reaches its slot. */
 }
 
 bool led_manager_remove_notification(LedColor led_color, LedPattern led_pattern)
 {
-    if (num_notifications == 0) {
+    uint8_t slot = get_slot(led_color, led_pattern);
+    if (slot_counts[slot] == 0) {
         return false;
     }
 
-    /* If there are 2 or more notifications, we need to save the removed notification and the one after it, so that we
-     * know which notification to display after removal. However, if there is only one notification, and it is being
-     * removed, this is not necessary, as all we need to do after it is removed is to turn off the led. */
-    LinkedListPreRemoveCb pre_remove_cb =
-        (num_notifications >= 2) ? find_next_notification_after_removed_and_free : free_led_notification;
-    bool is_removed = remove_notification_from_list(led_color, led_pattern, pre_remove_cb);
-    if (!is_removed) {
-        return false;
+    slot_counts[slot]--;
+    if (slot_counts[slot] > 0) {
+        /* The notification has been added more times than removed, so it is still displayed */
+        return true;
     }
 
-    if (num_notifications == 0) {
+    active_slots &= (uint8_t)~(1U << slot);
+    num_active_slots--;
+    if (num_active_slots == 0) {
         /* The last notification was removed. Turn off the led - no notifications to display. */
         turn_off_led();
-    } else if (num_notifications == 1) {
-        /* There were 2 notifications in the list, and now there is only one. If we were already displaying the
-         * notification that is left, we do not need to do anything. However, if we were displaying the notification we
-         * just removed, we need to set the led to the notification that is left. */
-        if (displayed_notification != next_notification_after_removed) {
-            display_notification(next_notification_after_removed);
+    } else if (num_active_slots == 1) {
+        /* If we were displaying the notification we just removed, we need to set the led to the notification that is
+         * left. */
+        if (displayed_slot == slot) {
+            display_slot(get_next_active_slot(slot));
         }
-
-        /* Since there is only one notification left, we need to stop switching between notification. */
+        /* Since there is only one notification left, we need to stop switching between notifications. */
         stop_notification_timer();
-    } else {
-        if (displayed_notification == removed_notification) {
-            /* We removed the notification that was being displayed. We need to start displaying the notification after
-             * the one that was removed. */
-            reset_iterator_and_iterate_until(next_notification_after_removed);
-            display_notification(next_notification_after_removed);
-            /* Restart the timer so that we display the notification for the full period. */
-            start_notification_timer();
-        } else {
-            /* We removed a notification that was not being displayed. Since we removed an element from the list, we
-             * need to reset the iterator and iterate until the currently displayed notification. This way, the next
-             * time the timer expires, we switch to displaying the next notification. */
-            reset_iterator_and_iterate_until(displayed_notification);
-        }
+    } else if (displayed_slot == slot) {
+        /* We removed the notification that was being displayed. Display the next one, and restart the timer so that it
+         * is displayed for the full period. */
+        display_slot(get_next_active_slot(slot));
+        start_notification_timer();
     }
     return true;
 }
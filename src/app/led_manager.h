@@ -17,10 +17,11 @@ extern "C"
  * notifications. Each notification is displayed for CONFIG_LED_MANAGER_NOTIFICATION_DURATION_SECONDS seconds before
  * switching to the next notification.
  *
- * It is allowed to add several notifications with the same color and pattern. They will be treated as separate
- * notifications. Imagine that there are several notifications with the same color and pattern, and @ref
- * led_manager_remove_notification is called for these color and pattern. Only one notification with these color and
- * pattern is removed, the other notifications are not removed and will still be displayed.
+ * Notifications are displayed in a fixed order of their color and pattern, not in the order in which they were added.
+ *
+ * It is allowed to add several notifications with the same color and pattern. They are displayed as one notification,
+ * which stays displayed until @ref led_manager_remove_notification is called for these color and pattern as many times
+ * as the notification was added.
  *
  * This module expects the following configs to be defined in config.h:
  *   - CONFIG_LED_MANAGER_NOTIFICATION_DURATION_SECONDS - for how long each notification is displayed.
@@ -42,8 +43,8 @@ void led_manager_add_notification(LedColor led_color, LedPattern led_pattern);
  * @param led_color Led color of the notification to remove.
  * @param led_pattern Led pattern of the notification to remove.
  *
- * @return true Successfully found and removed a led notification with @p led_color and @p led_pattern. If there were
- * several notifications with these color and pattern, only one of them was removed.
+ * @return true Successfully found and removed a led notification with @p led_color and @p led_pattern. If the
+ * notification was added several times, it is still displayed until it is removed as many times as it was added.
  * @return false There are no notifications with these color and pattern. Nothing is done.
  */
 bool led_manager_remove_notification(LedColor led_color, LedPattern led_pattern);
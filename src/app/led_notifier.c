@@ -1,5 +1,8 @@
+#include <stddef.h>
+
 #include "led_notifier.h"
 #include "led_notification_executor.h"
+#include "alert_slots.h"
 #include "config.h"
 #include "eas_assert.h"
 
@@ -18,33 +21,45 @@ typedef struct AlertLedNotification {
 
 static AlertLedNotification alert_led_notifications[CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS];
 
-static bool is_valid_alert_id(uint8_t alert_id)
+/**
+ * @brief Get the slot of an alert id.
+ *
+ * @param alert_id Alert id.
+ *
+ * @return size_t Slot of @p alert_id, used as an index into the per-alert arrays of this module.
+ *
+ * @note Fires an assert if @p alert_id has no slot.
+ */
+static size_t get_slot(uint16_t alert_id)
 {
-    return (alert_id < CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS);
+    size_t slot = alert_slots_get_slot(alert_id);
+    bool is_valid_alert_id = (slot < CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS);
+    EAS_ASSERT(is_valid_alert_id);
+    return slot;
 }
 
-void led_notifier_enable_notifications(uint8_t alert_id, LedColor led_color, LedPattern led_pattern)
+void led_notifier_enable_notifications(uint16_t alert_id, LedColor led_color, LedPattern led_pattern)
 {
-    EAS_ASSERT(is_valid_alert_id(alert_id));
+    size_t slot = get_slot(alert_id);
 
-    alert_led_notifications[alert_id].led_color = led_color;
-    alert_led_notifications[alert_id].led_pattern = led_pattern;
-    alert_led_notifications[alert_id].is_enabled = true;
+    alert_led_notifications[slot].led_color = led_color;
+    alert_led_notifications[slot].led_pattern = led_pattern;
+    alert_led_notifications[slot].is_enabled = true;
 }
 
-void led_notifier_disable_notifications(uint8_t alert_id)
+void led_notifier_disable_notifications(uint16_t alert_id)
 {
-    EAS_ASSERT(is_valid_alert_id(alert_id));
+    size_t slot = get_slot(alert_id);
 
-    alert_led_notifications[alert_id].is_enabled = false;
+    alert_led_notifications[slot].is_enabled = false;
 }
 
-void led_notifier_notify(uint8_t alert_id, bool is_raised)
+void led_notifier_notify(uint16_t alert_id, bool is_raised)
 {
-    EAS_ASSERT(is_valid_alert_id(alert_id));
+    size_t slot = get_slot(alert_id);
 
-    if (alert_led_notifications[alert_id].is_enabled) {
-        led_notification_executor_execute(alert_led_notifications[alert_id].led_color,
-                                          alert_led_notifications[alert_id].led_pattern, is_raised);
+    if (alert_led_notifications[slot].is_enabled) {
+        led_notification_executor_execute(alert_led_notifications[slot].led_color,
+                                          alert_led_notifications[slot].led_pattern, is_raised);
     }
 }
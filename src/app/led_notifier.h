@@ -24,6 +24,8 @@ extern "C"
  * Led notifications can be enabled for an alert by calling @ref led_notifier_enable_notifications with the alert id of
  * the alert. Similarly, led notifications can be disabled for an alert by calling @ref
  * led_notifier_disable_notifications with the alert id of the alert.
+ *
+ * All functions of this module fire an assert if the alert id has no slot in the alert slots module.
  */
 
 /**
@@ -36,7 +38,7 @@ extern "C"
  * @param led_color Color to use for the led notification.
  * @param led_pattern Pattern to use for the led notification.
  */
-void led_notifier_enable_notifications(uint8_t alert_id, LedColor led_color, LedPattern led_pattern);
+void led_notifier_enable_notifications(uint16_t alert_id, LedColor led_color, LedPattern led_pattern);
 
 /**
  * @brief Disable led notifications for an alert.
@@ -46,7 +48,7 @@ void led_notifier_enable_notifications(uint8_t alert_id, LedColor led_color, Led
  *
  * @param alert_id Alert id.
  */
-void led_notifier_disable_notifications(uint8_t alert_id);
+void led_notifier_disable_notifications(uint16_t alert_id);
 
 /**
  * @brief Execute a led notification for an alert if the notifications are enabled.
@@ -62,7 +64,7 @@ void led_notifier_disable_notifications(uint8_t alert_id);
  * @param is_raised If true, starts displaying the led notification for this alert. Otherwise, stops displaying the led
  * notification for this alert. This only applies if led notifications are currently enabled for this alert.
  */
-void led_notifier_notify(uint8_t alert_id, bool is_raised);
+void led_notifier_notify(uint16_t alert_id, bool is_raised);
 
 #ifdef __cplusplus
 }
@@ -24,13 +24,32 @@ extern "C"
  * variable requirement evaluates to true iff the current light intensity is less than or equal to @p value.
  *
  * @param alert_id Alert id of the alert to which this light intensity requirement belongs.
- * @param operator Use one of the values from @ref VariableRequirementOperator. Variable requirement operator to use
- * when evaluating the requirement.
+ * @param operator VARIABLE_REQUIREMENT_OPERATOR_GEQ or VARIABLE_REQUIREMENT_OPERATOR_LEQ. Variable requirement operator
+ * to use when evaluating the requirement. Band requirements are created by @ref
+ * light_intensity_requirement_create_band.
  * @param value Light intensity requirement value.
  *
  * @return VariableRequirement Created instance of light intensity requirement.
  */
-VariableRequirement light_intensity_requirement_create(uint8_t alert_id, uint8_t operator, LightIntensity value);
+VariableRequirement light_intensity_requirement_create(uint16_t alert_id, uint8_t operator, LightIntensity value);
+
+/**
+ * @brief Create a light intensity band requirement instance.
+ *
+ * If operator is VARIABLE_REQUIREMENT_OPERATOR_INSIDE, the variable requirement evaluates to true iff the current
+ * light intensity is greater than or equal to @p lower_value and less than or equal to @p upper_value. If the operator
+ * is VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE, the variable requirement evaluates to true iff the current light intensity
+ * is less than @p lower_value or greater than @p upper_value.
+ *
+ * @param alert_id Alert id of the alert to which this light intensity requirement belongs.
+ * @param operator VARIABLE_REQUIREMENT_OPERATOR_INSIDE or VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE.
+ * @param lower_value Lower light intensity requirement value.
+ * @param upper_value Upper light intensity requirement value. Must be greater than @p lower_value.
+ *
+ * @return VariableRequirement Created instance of light intensity requirement.
+ */
+VariableRequirement light_intensity_requirement_create_band(uint16_t alert_id, uint8_t operator,
+                                                            LightIntensity lower_value, LightIntensity upper_value);
 
 #ifdef __cplusplus
 }
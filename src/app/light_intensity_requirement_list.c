@@ -24,7 +24,23 @@ void light_intensity_requirement_list_for_each(VariableRequirementListForEachCb
     variable_requirement_list_for_each(get_instance(), cb);
 }
 
-void light_intensity_requirement_list_remove_all_for_alert(uint8_t alert_id)
+void light_intensity_requirement_list_evaluate(LightIntensity value, VariableRequirementListResultChangedCb cb)
+{
+    variable_requirement_list_evaluate(get_instance(), value, cb);
+}
+
+void light_intensity_requirement_list_evaluate_in_range(LightIntensity previous_value, LightIntensity value,
+                                                        VariableRequirementListResultChangedCb cb)
+{
+    variable_requirement_list_evaluate_in_range(get_instance(), previous_value, value, cb);
+}
+
+VariableRequirementThreshold light_intensity_requirement_list_get_distance_to_nearest(LightIntensity value)
+{
+    return variable_requirement_list_get_distance_to_nearest(get_instance(), value);
+}
+
+void light_intensity_requirement_list_remove_all_for_alert(uint16_t alert_id)
 {
     variable_requirement_list_remove_all_for_alert(get_instance(), alert_id);
 }
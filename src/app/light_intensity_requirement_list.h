@@ -8,6 +8,7 @@ extern "C"
 
 #include <stdint.h>
 
+#include "light_intensity.h"
 #include "variable_requirement_list_defs.h"
 
 /**
@@ -31,12 +32,47 @@ void light_intensity_requirement_list_add(VariableRequirement light_intensity_re
  */
 void light_intensity_requirement_list_for_each(VariableRequirementListForEachCb cb);
 
+/**
+ * @brief Evaluate all light intensity requirements for a light intensity value.
+ *
+ * @param value Current light intensity value.
+ * @param cb Callback to execute for each light intensity requirement whose result changed, see @ref
+ * variable_requirement_list_evaluate.
+ *
+ * @note Fires an assert if @p cb is NULL.
+ */
+void light_intensity_requirement_list_evaluate(LightIntensity value, VariableRequirementListResultChangedCb cb);
+
+/**
+ * @brief Evaluate the light intensity requirements whose results could have been changed by a light intensity change.
+ *
+ * Only the light intensity requirements with requirement values between @p previous_value and @p value are evaluated.
+ *
+ * @param previous_value Previous light intensity value.
+ * @param value Current light intensity value.
+ * @param cb Callback to execute for each light intensity requirement whose result changed, see @ref
+ * variable_requirement_list_evaluate_in_range.
+ *
+ * @note Fires an assert if @p cb is NULL.
+ */
+void light_intensity_requirement_list_evaluate_in_range(LightIntensity previous_value, LightIntensity value,
+                                                        VariableRequirementListResultChangedCb cb);
+
+/**
+ * @brief Get the distance from a light intensity value to the nearest light intensity requirement value.
+ *
+ * @param value Current light intensity value.
+ *
+ * @return VariableRequirementThreshold Distance, see @ref variable_requirement_list_get_distance_to_nearest.
+ */
+VariableRequirementThreshold light_intensity_requirement_list_get_distance_to_nearest(LightIntensity value);
+
 /**
  * @brief Remove all light intensity requirements from the list that belong to a specific alert.
  *
  * @param alert_id All light intensity requirements that belong to the alert with this id are removed from the list.
  */
-void light_intensity_requirement_list_remove_all_for_alert(uint8_t alert_id);
+void light_intensity_requirement_list_remove_all_for_alert(uint16_t alert_id);
 
 #ifdef __cplusplus
 }
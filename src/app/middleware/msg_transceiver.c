@@ -1,38 +1,140 @@
+#include <string.h>
+
 #include "msg_transceiver.h"
 #include "hw_platform.h"
 #include "eas_assert.h"
+#include "util.h"
+
+#ifndef CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS
+#define CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS 1
+#endif
 
-#ifndef CONFIG_MSG_TRANSCEIVER_MAX_NUM_CONCURRENT_ALERT_STATUS_CHANGE_MESSAGES
-#define CONFIG_MSG_TRANSCEIVER_MAX_NUM_CONCURRENT_ALERT_STATUS_CHANGE_MESSAGES 1
+#ifndef CONFIG_MSG_TRANSCEIVER_NUM_RESERVED_MESSAGE_SLOTS
+#define CONFIG_MSG_TRANSCEIVER_NUM_RESERVED_MESSAGE_SLOTS 0
 #endif
 
-/* Convenience macro */
-#define MSG_TRANSCEIVER_NUM_MSG_SLOTS CONFIG_MSG_TRANSCEIVER_MAX_NUM_CONCURRENT_ALERT_STATUS_CHANGE_MESSAGES
+EAS_STATIC_ASSERT(CONFIG_MSG_TRANSCEIVER_NUM_RESERVED_MESSAGE_SLOTS <= CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS);
 
 #define MSG_TRANSCEIVER_MESSAGE_ID_ALERT_STATUS_CHANGE 0
 #define MSG_TRANSCEIVER_MESSAGE_ID_REMOVE_ALERT 1
 #define MSG_TRANSCEIVER_MESSAGE_ID_ADD_ALERT 2
-
-typedef struct AlertStatusChangeMessageSlot {
+#define MSG_TRANSCEIVER_MESSAGE_ID_ALERT_STATUS_CHANGES 3
+#define MSG_TRANSCEIVER_MESSAGE_ID_GET_STATS 4
+#define MSG_TRANSCEIVER_MESSAGE_ID_EVENT_QUEUE_STATS 5
+#define MSG_TRANSCEIVER_MESSAGE_ID_EVENT_STATS 6
+#define MSG_TRANSCEIVER_MESSAGE_ID_REPLACE_ALL_ALERTS 7
+#define MSG_TRANSCEIVER_MESSAGE_ID_GET_SAMPLE_HISTORY 8
+#define MSG_TRANSCEIVER_MESSAGE_ID_SAMPLE_HISTORY 9
+#define MSG_TRANSCEIVER_MESSAGE_ID_ADD_ALERT_CONTINUATION 10
+
+/* "Alert status change" message: message id, alert id (2 bytes), status byte */
+#define MSG_TRANSCEIVER_ALERT_STATUS_CHANGE_MESSAGE_NUM_BYTES 4
+
+/* "Alert status changes" message: message id, number of records, then alert id (2 bytes) and status byte for each
+ * record */
+#define MSG_TRANSCEIVER_ALERT_STATUS_CHANGES_MESSAGE_MAX_NUM_BYTES                                                     \
+    (2 + (3 * CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERT_STATUS_CHANGES_IN_MESSAGE))
+
+/* "Event queue stats" message: message id, number of slots, high-watermark, number of event ids */
+#define MSG_TRANSCEIVER_EVENT_QUEUE_STATS_MESSAGE_NUM_BYTES 4
+
+/* "Event stats" message: message id, event id, number of handled events (4 bytes), total handler cycles (8 bytes), max
+ * handler cycles (4 bytes). Fits into a single BLE notification with the default ATT MTU. */
+#define MSG_TRANSCEIVER_EVENT_STATS_MESSAGE_NUM_BYTES 18
+
+/* "Sample history" message: message id, block index (2 bytes), offset, then the fragment bytes */
+#define MSG_TRANSCEIVER_SAMPLE_HISTORY_MESSAGE_HEADER_NUM_BYTES 4
+#define MSG_TRANSCEIVER_SAMPLE_HISTORY_MESSAGE_MAX_NUM_BYTES                                                           \
+    (MSG_TRANSCEIVER_SAMPLE_HISTORY_MESSAGE_HEADER_NUM_BYTES + MSG_TRANSCEIVER_SAMPLE_HISTORY_MAX_NUM_BYTES_IN_MESSAGE)
+
+/* An operand of an ORed requirement or of an expression starts either with a variable identifier, or with this bit
+ * together with the operator of an expression */
+#define MSG_TRANSCEIVER_EXPRESSION_MARKER ((uint8_t)0x80U)
+
+/** Maximum number of bytes of one field of an alert payload */
+#define MSG_TRANSCEIVER_ALERT_MAX_FIELD_NUM_BYTES 4
+
+/** Field of the alert payload that an alert parser expects next, or the result of parsing. Fields are listed in the
+ * order in which they appear in the payload. */
+typedef enum AlertParserState {
+    ALERT_PARSER_STATE_ALERT_ID,
+    ALERT_PARSER_STATE_WARMUP_PERIOD,
+    ALERT_PARSER_STATE_COOLDOWN_PERIOD,
+    ALERT_PARSER_STATE_NOTIFICATION_TYPE,
+    ALERT_PARSER_STATE_LED_COLOR,
+    ALERT_PARSER_STATE_LED_PATTERN,
+    ALERT_PARSER_STATE_NUM_ORED_REQUIREMENTS,
+    ALERT_PARSER_STATE_NUM_VARIABLE_REQUIREMENTS_IN_ORED_REQUIREMENT,
+    /** Variable identifier of a variable requirement, or expression marker and operator of an expression */
+    ALERT_PARSER_STATE_OPERAND,
+    /** Number of operands of an AND or OR expression */
+    ALERT_PARSER_STATE_NUM_OPERANDS_IN_EXPRESSION,
+    ALERT_PARSER_STATE_OPERATOR,
+    ALERT_PARSER_STATE_CONSTRAINT_VALUE,
+    /** Upper bound of the band, only present for band operators */
+    ALERT_PARSER_STATE_UPPER_CONSTRAINT_VALUE,
+    /** The whole alert has been parsed */
+    ALERT_PARSER_STATE_COMPLETE,
+    /** The payload structure is invalid */
+    ALERT_PARSER_STATE_FAILED,
+} AlertParserState;
+
+/** Resumable parser of an alert payload. The payload can be fed to the parser in fragments of any size, and the alert
+ * is built in place as its fields are parsed. */
+typedef struct AlertParser {
+    AlertParserState state;
+    /** Alert that is being parsed */
+    MsgTransceiverAlert *alert;
+    /** Bytes of the expected field that have been received so far, in case the field is split between fragments */
+    uint8_t field_bytes[MSG_TRANSCEIVER_ALERT_MAX_FIELD_NUM_BYTES];
+    size_t num_field_bytes;
+    /** Number of ORed requirements after the current one */
+    uint8_t num_remaining_ored_requirements;
+    /** Number of operands that have not been parsed yet - of the current ORed requirement at index 0, and of the open
+     * expression at depth i at index i */
+    uint8_t num_remaining_operands[CONFIG_MSG_TRANSCEIVER_MAX_EXPRESSION_DEPTH + 1];
+    /** Number of open expressions */
+    uint8_t expression_depth;
+} AlertParser;
+
+/** Holds the sent callback of a message while the message is being transmitted */
+typedef struct MessageSlot {
     bool is_occupied;
     MsgTransceiverMessageSentCb cb;
     void *cb_user_data;
-} AlertStatusChangeMessageSlot;
+} MessageSlot;
 
 static bool initialized = false;
 static MsgTransceiverRemoveAlertCb remove_alert_cb = NULL;
 static void *remove_alert_cb_user_data = NULL;
 static MsgTransceiverAddAlertCb add_alert_cb = NULL;
 static void *add_alert_cb_user_data = NULL;
-
-static AlertStatusChangeMessageSlot message_slots[MSG_TRANSCEIVER_NUM_MSG_SLOTS];
+static MsgTransceiverGetStatsCb get_stats_cb = NULL;
+static void *get_stats_cb_user_data = NULL;
+static MsgTransceiverReplaceAllAlertsCb replace_all_alerts_cb = NULL;
+static void *replace_all_alerts_cb_user_data = NULL;
+static MsgTransceiverGetSampleHistoryCb get_sample_history_cb = NULL;
+static void *get_sample_history_cb_user_data = NULL;
+
+/* Alert of an "add alert" message. Not on the stack, since it is built from several messages if it does not fit into
+ * one. */
+static MsgTransceiverAlert add_alert_alert;
+static AlertParser add_alert_parser;
+/* True from receiving an "add alert" message until its alert is complete or turns out to be invalid */
+static bool is_add_alert_in_progress = false;
+
+/* Alerts of a "replace all alerts" message. Not on the stack, since it can get large. */
+static MsgTransceiverAlert
+    replace_all_alerts_alerts[CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERTS_IN_REPLACE_ALL_ALERTS_MESSAGE];
+
+static MessageSlot message_slots[CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS];
 
 /**
  * @brief Make all message slots unoccupied and clear all callbacks and user data.
  */
 static void reset_message_slots()
 {
-    for (size_t i = 0; i < MSG_TRANSCEIVER_NUM_MSG_SLOTS; i++) {
+    for (size_t i = 0; i < CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS; i++) {
         message_slots[i].cb = NULL;
         message_slots[i].cb_user_data = NULL;
         message_slots[i].is_occupied = false;
@@ -49,10 +151,10 @@ static void transmit_complete_cb(bool result, void *user_data)
 {
     EAS_ASSERT(user_data);
 
-    AlertStatusChangeMessageSlot *const slot = (AlertStatusChangeMessageSlot *)user_data;
+    MessageSlot *const slot = (MessageSlot *)user_data;
     EAS_ASSERT(slot);
     if (!slot->is_occupied) {
-        /* Interface got deinitialized since the call to msg_transceiver_send_alert_status_change_message for this
+        /* Interface got deinitialized since the call to msg_transceiver_send_alert_status_change(s)_message for this
          * message */
         return;
     }
@@ -63,23 +165,40 @@ static void transmit_complete_cb(bool result, void *user_data)
 }
 
 /**
- * @brief Handle receiving a "remove alert" message.
+ * @brief Convert an integer of type uint16_t to two bytes in little endian.
  *
- * @param bytes Received bytes excluding the first message id byte.
- * @param num_bytes Number of bytes in the @p bytes array.
+ * @param value Integer to convert.
+ * @param[out] bytes The resulting two bytes are written to this address.
  */
-static void handle_remove_alert_message(const uint8_t *const bytes, size_t num_bytes)
+static void uint16_to_two_little_endian_bytes(uint16_t value, uint8_t *const bytes)
 {
-    EAS_ASSERT(bytes);
+    bytes[0] = (uint8_t)(value & 0xFF);
+    bytes[1] = (uint8_t)(value >> 8);
+}
 
-    /* There should be exactly one byte in the payload - alert id */
-    if (num_bytes != 1) {
-        return;
+/**
+ * @brief Convert an integer of type uint32_t to four bytes in little endian.
+ *
+ * @param value Integer to convert.
+ * @param[out] bytes The resulting four bytes are written to this address.
+ */
+static void uint32_to_four_little_endian_bytes(uint32_t value, uint8_t *const bytes)
+{
+    for (size_t i = 0; i < 4; i++) {
+        bytes[i] = (uint8_t)(value >> (8 * i));
     }
+}
 
-    uint8_t alert_id = bytes[0];
-    if (remove_alert_cb) {
-        remove_alert_cb(alert_id, remove_alert_cb_user_data);
+/**
+ * @brief Convert an integer of type uint64_t to eight bytes in little endian.
+ *
+ * @param value Integer to convert.
+ * @param[out] bytes The resulting eight bytes are written to this address.
+ */
+static void uint64_to_eight_little_endian_bytes(uint64_t value, uint8_t *const bytes)
+{
+    for (size_t i = 0; i < 8; i++) {
+        bytes[i] = (uint8_t)(value >> (8 * i));
     }
 }
 
@@ -108,6 +227,67 @@ static uint16_t two_little_endian_bytes_to_uint16(const uint8_t *const bytes)
     return (((uint16_t)(bytes[0])) | (((uint16_t)(bytes[1])) << 8));
 }
 
+/**
+ * @brief Handle receiving a "remove alert" message.
+ *
+ * @param bytes Received bytes excluding the first message id byte.
+ * @param num_bytes Number of bytes in the @p bytes array.
+ */
+static void handle_remove_alert_message(const uint8_t *const bytes, size_t num_bytes)
+{
+    EAS_ASSERT(bytes);
+
+    /* There should be exactly two bytes in the payload - alert id */
+    if (num_bytes != 2) {
+        return;
+    }
+
+    uint16_t alert_id = two_little_endian_bytes_to_uint16(bytes);
+    if (remove_alert_cb) {
+        remove_alert_cb(alert_id, remove_alert_cb_user_data);
+    }
+}
+
+/**
+ * @brief Handle receiving a "get stats" message.
+ *
+ * @param bytes Received bytes excluding the first message id byte.
+ * @param num_bytes Number of bytes in the @p bytes array.
+ */
+static void handle_get_stats_message(const uint8_t *const bytes, size_t num_bytes)
+{
+    EAS_ASSERT(bytes);
+
+    /* "Get stats" message has no payload */
+    if (num_bytes != 0) {
+        return;
+    }
+
+    if (get_stats_cb) {
+        get_stats_cb(get_stats_cb_user_data);
+    }
+}
+
+/**
+ * @brief Handle receiving a "get sample history" message.
+ *
+ * @param bytes Received bytes excluding the first message id byte.
+ * @param num_bytes Number of bytes in the @p bytes array.
+ */
+static void handle_get_sample_history_message(const uint8_t *const bytes, size_t num_bytes)
+{
+    EAS_ASSERT(bytes);
+
+    /* "Get sample history" message has no payload */
+    if (num_bytes != 0) {
+        return;
+    }
+
+    if (get_sample_history_cb) {
+        get_sample_history_cb(get_sample_history_cb_user_data);
+    }
+}
+
 /**
  * @brief Check if a number of bytes is available in an array.
  *
@@ -139,400 +319,375 @@ static bool is_x_bytes_available(size_t desired_num_available_bytes, size_t tota
 }
 
 /**
- * @brief Parse alert id.
+ * @brief Get the number of bytes of the field that an alert parser expects next.
  *
- * @param bytes Array of bytes that contains the alert id.
- * @param num_bytes Total number of bytes in @p bytes array.
- * @param index Index in @p bytes array that points to the first byte of the alert id payload.
- * @param[out] alert_id If true is returned, the resulting alert id is written to this parameter.
+ * @param parser Alert parser.
  *
- * @return true Successfully parsed alert id.
- * @return false Failed to parse alert id, because there are not enough available bytes in the payload.
+ * @return size_t Number of bytes of the field.
  */
-static bool parse_alert_id(const uint8_t *const bytes, size_t num_bytes, size_t *const index, uint8_t *const alert_id)
+static size_t alert_parser_get_field_num_bytes(const AlertParser *const parser)
 {
-    if (!is_x_bytes_available(1, num_bytes, *index)) {
-        /* No bytes left */
-        return false;
+    switch (parser->state) {
+    case ALERT_PARSER_STATE_ALERT_ID:
+        return 2;
+    case ALERT_PARSER_STATE_WARMUP_PERIOD:
+    case ALERT_PARSER_STATE_COOLDOWN_PERIOD:
+        return 4;
+    case ALERT_PARSER_STATE_CONSTRAINT_VALUE:
+    case ALERT_PARSER_STATE_UPPER_CONSTRAINT_VALUE: {
+        const MsgTransceiverAlertCondition *const alert_condition = &(parser->alert->alert_condition);
+        uint8_t variable_identifier =
+            alert_condition->variable_requirements[alert_condition->num_variable_requirements].variable_identifier;
+        return (variable_identifier == MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_LIGHT_INTENSITY) ? 4 : 2;
+    }
+    default:
+        return 1;
     }
-
-    *alert_id = bytes[(*index)++];
-    return true;
 }
 
 /**
- * @brief Parse warmup period.
+ * @brief Start parsing the next variable requirement of the current ORed requirement or expression.
  *
- * @param bytes Array of bytes that contains the warmup period.
- * @param num_bytes Total number of bytes in @p bytes array.
- * @param index Index in @p bytes array that points to the first byte of the warmup period payload.
- * @param[out] warmup_period If true is returned, the resulting warmup period is written to this parameter.
+ * @param parser Alert parser.
  *
- * @return true Successfully parsed warmup period.
- * @return false Failed to parse warmup period, because there are not enough available bytes in the payload.
+ * @return AlertParserState Next state of the parser - failed if the maximum number of variable requirements in an
+ * alert condition would be exceeded.
  */
-static bool parse_warmup_period(const uint8_t *const bytes, size_t num_bytes, size_t *const index,
-                                uint32_t *const warmup_period)
+static AlertParserState alert_parser_start_variable_requirement(AlertParser *const parser)
 {
-    if (!is_x_bytes_available(4, num_bytes, *index)) {
-        return false;
-    }
-    *warmup_period = four_little_endian_bytes_to_uint32(&bytes[*index]);
-    *index += 4;
-    return true;
+    MsgTransceiverAlertCondition *const alert_condition = &(parser->alert->alert_condition);
+    if (alert_condition->num_variable_requirements >=
+        CONFIG_MSG_TRANSCEIVER_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION) {
+        /* Max allowed number of variable requirements is exceeded */
+        return ALERT_PARSER_STATE_FAILED;
+    }
+    /* Expressions can begin before the variable requirement */
+    alert_condition->variable_requirements[alert_condition->num_variable_requirements].num_begun_expressions = 0;
+    return ALERT_PARSER_STATE_OPERAND;
 }
 
 /**
- * @brief Parse cooldown period.
+ * @brief Start parsing the next ORed requirement, if there is one left.
  *
- * @param bytes Array of bytes that contains the cooldown period.
- * @param num_bytes Total number of bytes in @p bytes array.
- * @param index Index in @p bytes array that points to the first byte of the cooldown period payload.
- * @param[out] cooldown_period If true is returned, the resulting cooldown period is written to this parameter.
+ * @param parser Alert parser.
  *
- * @return true Successfully parsed cooldown period.
- * @return false Failed to parse cooldown period, because there are not enough available bytes in the payload.
+ * @return AlertParserState Next state of the parser - complete if all ORed requirements have been parsed.
  */
-static bool parse_cooldown_period(const uint8_t *const bytes, size_t num_bytes, size_t *const index,
-                                  uint32_t *const cooldown_period)
+static AlertParserState alert_parser_start_ored_requirement(AlertParser *const parser)
 {
-    if (!is_x_bytes_available(4, num_bytes, *index)) {
-        return false;
+    if (parser->num_remaining_ored_requirements == 0) {
+        return ALERT_PARSER_STATE_COMPLETE;
     }
-    *cooldown_period = four_little_endian_bytes_to_uint32(&bytes[*index]);
-    *index += 4;
-    return true;
+    parser->num_remaining_ored_requirements--;
+    return ALERT_PARSER_STATE_NUM_VARIABLE_REQUIREMENTS_IN_ORED_REQUIREMENT;
 }
 
 /**
- * @brief Parse notification type.
+ * @brief Parse a constraint value.
  *
- * @param bytes Array of bytes that contains the notification type.
- * @param num_bytes Total number of bytes in @p bytes array.
- * @param index Index in @p bytes array that points to the first byte of the notification type payload.
- * @param[out] notification_type If true is returned, the resulting notification type is written to this parameter.
+ * @param variable_identifier Variable identifier of the variable requirement that the constraint value belongs to.
+ * @param bytes Bytes of the constraint value. The number of bytes depends on @p variable_identifier.
  *
- * @return true Successfully parsed notification type.
- * @return false Failed to parse notification type, because there are not enough available bytes in the payload or
- * because invalid bits are set in the payload.
+ * @return ConstraintValue Parsed constraint value.
  */
-static bool parse_notification_type(const uint8_t *const bytes, size_t num_bytes, size_t *const index,
-                                    NotificationType *const notification_type)
+static ConstraintValue parse_constraint_value(uint8_t variable_identifier, const uint8_t *const bytes)
 {
-    if (!is_x_bytes_available(1, num_bytes, *index)) {
-        return false;
+    ConstraintValue constraint_value;
+    switch (variable_identifier) {
+    case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_TEMPERATURE: {
+        /* Store the two bytes in a variable */
+        uint16_t value_unsigned = two_little_endian_bytes_to_uint16(bytes);
+        /* Interpret the two bytes as a two-byte signed integer */
+        int16_t *value_signed_p = (int16_t *)&value_unsigned;
+        constraint_value.temperature = *value_signed_p;
+        break;
     }
-    /* Only bits 0 and 1 are allowed to be set */
-    if (bytes[*index] > 0x3) {
-        return false;
+    case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_PRESSURE:
+        constraint_value.pressure = two_little_endian_bytes_to_uint16(bytes);
+        break;
+    case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_HUMIDITY:
+        constraint_value.humidity = two_little_endian_bytes_to_uint16(bytes);
+        break;
+    default:
+        constraint_value.light_intensity = four_little_endian_bytes_to_uint32(bytes);
+        break;
     }
-
-    notification_type->connectivity = (bytes[*index] & ((uint8_t)0x1U)) ? 1 : 0;
-    notification_type->led = (bytes[*index] & ((uint8_t)0x2U)) ? 1 : 0;
-    (*index)++;
-    return true;
+    return constraint_value;
 }
 
 /**
- * @brief Parse led color.
+ * @brief Complete the variable requirement that is being parsed, once all of its fields are parsed.
  *
- * @param bytes Array of bytes that contains the led color.
- * @param num_bytes Total number of bytes in @p bytes array.
- * @param index Index in @p bytes array that points to the first byte of the led color payload.
- * @param[out] led_color If true is returned, the resulting led color is written to this parameter.
+ * @param parser Alert parser.
  *
- * @return true Successfully parsed led color.
- * @return false Failed to parse led color, because there are not enough available bytes in the payload.
+ * @return AlertParserState Next state of the parser.
  */
-static bool parse_led_color(const uint8_t *const bytes, size_t num_bytes, size_t *const index, uint8_t *const led_color)
+static AlertParserState alert_parser_complete_variable_requirement(AlertParser *const parser)
 {
-    if (!is_x_bytes_available(1, num_bytes, *index)) {
-        return false;
-    }
-    *led_color = bytes[(*index)++];
-    return true;
+    MsgTransceiverAlertCondition *const alert_condition = &(parser->alert->alert_condition);
+    MsgTransceiverVariableRequirement *const requirement =
+        &(alert_condition->variable_requirements[alert_condition->num_variable_requirements]);
+    alert_condition->num_variable_requirements++;
+
+    parser->num_remaining_operands[parser->expression_depth]--;
+    requirement->num_ended_expressions = 0;
+    while ((parser->expression_depth > 0) && (parser->num_remaining_operands[parser->expression_depth] == 0)) {
+        /* All operands of the expression are parsed, which completes an operand of the enclosing expression or ORed
+         * requirement */
+        parser->expression_depth--;
+        parser->num_remaining_operands[parser->expression_depth]--;
+        requirement->num_ended_expressions++;
+    }
+    requirement->is_last_in_ored_requirement = (parser->num_remaining_operands[0] == 0);
+    if (requirement->is_last_in_ored_requirement) {
+        return alert_parser_start_ored_requirement(parser);
+    }
+    return alert_parser_start_variable_requirement(parser);
 }
 
 /**
- * @brief Parse led pattern.
+ * @brief Write a fully received field to the alert that is being parsed.
  *
- * @param bytes Array of bytes that contains the led pattern.
- * @param num_bytes Total number of bytes in @p bytes array.
- * @param index Index in @p bytes array that points to the first byte of the led pattern payload.
- * @param[out] led_pattern If true is returned, the resulting led pattern is written to this parameter.
+ * @param parser Alert parser. All bytes of the field it expects are in parser->field_bytes.
  *
- * @return true Successfully parsed led pattern.
- * @return false Failed to parse led pattern, because there are not enough available bytes in the payload.
+ * @return AlertParserState Next state of the parser - failed if the field is invalid.
  */
-static bool parse_led_pattern(const uint8_t *const bytes, size_t num_bytes, size_t *const index,
-                              uint8_t *const led_pattern)
+static AlertParserState alert_parser_parse_field(AlertParser *const parser)
 {
-    if (!is_x_bytes_available(1, num_bytes, *index)) {
-        return false;
+    MsgTransceiverAlert *const alert = parser->alert;
+    MsgTransceiverAlertCondition *const alert_condition = &(alert->alert_condition);
+    /* Variable requirement that is being parsed, only valid in the variable requirement states */
+    MsgTransceiverVariableRequirement *const requirement =
+        &(alert_condition->variable_requirements[alert_condition->num_variable_requirements]);
+    const uint8_t *const bytes = parser->field_bytes;
+
+    switch (parser->state) {
+    case ALERT_PARSER_STATE_ALERT_ID:
+        alert->alert_id = two_little_endian_bytes_to_uint16(bytes);
+        return ALERT_PARSER_STATE_WARMUP_PERIOD;
+    case ALERT_PARSER_STATE_WARMUP_PERIOD:
+        alert->warmup_period = four_little_endian_bytes_to_uint32(bytes);
+        return ALERT_PARSER_STATE_COOLDOWN_PERIOD;
+    case ALERT_PARSER_STATE_COOLDOWN_PERIOD:
+        alert->cooldown_period = four_little_endian_bytes_to_uint32(bytes);
+        return ALERT_PARSER_STATE_NOTIFICATION_TYPE;
+    case ALERT_PARSER_STATE_NOTIFICATION_TYPE:
+        /* Only bits 0 and 1 are allowed to be set */
+        if (bytes[0] > 0x3) {
+            return ALERT_PARSER_STATE_FAILED;
+        }
+        alert->notification_type.connectivity = (bytes[0] & ((uint8_t)0x1U)) ? 1 : 0;
+        alert->notification_type.led = (bytes[0] & ((uint8_t)0x2U)) ? 1 : 0;
+        /* Led color and pattern are only present if led notifications are enabled */
+        return alert->notification_type.led ? ALERT_PARSER_STATE_LED_COLOR : ALERT_PARSER_STATE_NUM_ORED_REQUIREMENTS;
+    case ALERT_PARSER_STATE_LED_COLOR:
+        alert->led_color = bytes[0];
+        return ALERT_PARSER_STATE_LED_PATTERN;
+    case ALERT_PARSER_STATE_LED_PATTERN:
+        alert->led_pattern = bytes[0];
+        return ALERT_PARSER_STATE_NUM_ORED_REQUIREMENTS;
+    case ALERT_PARSER_STATE_NUM_ORED_REQUIREMENTS:
+        parser->num_remaining_ored_requirements = bytes[0];
+        return alert_parser_start_ored_requirement(parser);
+    case ALERT_PARSER_STATE_NUM_VARIABLE_REQUIREMENTS_IN_ORED_REQUIREMENT:
+        parser->num_remaining_operands[0] = bytes[0];
+        parser->expression_depth = 0;
+        if (parser->num_remaining_operands[0] == 0) {
+            return alert_parser_start_ored_requirement(parser);
+        }
+        return alert_parser_start_variable_requirement(parser);
+    case ALERT_PARSER_STATE_OPERAND:
+        if (bytes[0] & MSG_TRANSCEIVER_EXPRESSION_MARKER) {
+            uint8_t expression_operator = bytes[0] & ((uint8_t)~MSG_TRANSCEIVER_EXPRESSION_MARKER);
+            if ((expression_operator > MSG_TRANSCEIVER_EXPRESSION_OPERATOR_NOT) ||
+                (parser->expression_depth >= CONFIG_MSG_TRANSCEIVER_MAX_EXPRESSION_DEPTH)) {
+                /* Invalid operator, or max allowed expression depth is exceeded */
+                return ALERT_PARSER_STATE_FAILED;
+            }
+            requirement->begun_expression_operators[requirement->num_begun_expressions] = expression_operator;
+            requirement->num_begun_expressions++;
+            parser->expression_depth++;
+            if (expression_operator == MSG_TRANSCEIVER_EXPRESSION_OPERATOR_NOT) {
+                /* NOT has one operand, so the number of operands is not in the payload */
+                parser->num_remaining_operands[parser->expression_depth] = 1;
+                return ALERT_PARSER_STATE_OPERAND;
+            }
+            return ALERT_PARSER_STATE_NUM_OPERANDS_IN_EXPRESSION;
+        }
+        if (bytes[0] > MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_LIGHT_INTENSITY) {
+            /* Invalid variable identifier */
+            return ALERT_PARSER_STATE_FAILED;
+        }
+        requirement->variable_identifier = bytes[0];
+        return ALERT_PARSER_STATE_OPERATOR;
+    case ALERT_PARSER_STATE_NUM_OPERANDS_IN_EXPRESSION:
+        if (bytes[0] == 0) {
+            /* An expression without operands has no result */
+            return ALERT_PARSER_STATE_FAILED;
+        }
+        parser->num_remaining_operands[parser->expression_depth] = bytes[0];
+        return ALERT_PARSER_STATE_OPERAND;
+    case ALERT_PARSER_STATE_OPERATOR:
+        requirement->operator = bytes[0];
+        return ALERT_PARSER_STATE_CONSTRAINT_VALUE;
+    case ALERT_PARSER_STATE_CONSTRAINT_VALUE:
+        requirement->constraint_value = parse_constraint_value(requirement->variable_identifier, bytes);
+        if ((requirement->operator == MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_INSIDE) ||
+            (requirement->operator == MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_OUTSIDE)) {
+            /* Band operators have an upper bound as well */
+            return ALERT_PARSER_STATE_UPPER_CONSTRAINT_VALUE;
+        }
+        return alert_parser_complete_variable_requirement(parser);
+    case ALERT_PARSER_STATE_UPPER_CONSTRAINT_VALUE:
+        requirement->upper_constraint_value = parse_constraint_value(requirement->variable_identifier, bytes);
+        return alert_parser_complete_variable_requirement(parser);
+    default:
+        EAS_ASSERT(0); // No field is expected in the complete and failed states
+        return ALERT_PARSER_STATE_FAILED;
     }
-    *led_pattern = bytes[(*index)++];
-    return true;
 }
 
 /**
- * @brief Parse temperature constraint value.
+ * @brief Start parsing an alert.
  *
- * @param bytes Array of bytes that contains the temperature constraint value.
- * @param num_bytes Total number of bytes in @p bytes array.
- * @param index Index in @p bytes array that points to the first byte of the temperature constraint value payload.
- * @param[out] constraint_value If true is returned, the resulting temperature constraint value is written to this
- * parameter.
- *
- * @return true Successfully parsed temperature constraint value.
- * @return false Failed to parse temperature constraint value, because there are not enough available bytes in the
- * payload.
+ * @param parser Alert parser.
+ * @param alert The alert is written to this address while it is being parsed. Must stay valid until the parser reaches
+ * the complete or failed state.
  */
-static bool parse_temperature_constraint_value(const uint8_t *const bytes, size_t num_bytes, size_t *const index,
-                                               MsgTransceiverTemperature *const constraint_value)
+static void alert_parser_start(AlertParser *const parser, MsgTransceiverAlert *const alert)
 {
-    if (!is_x_bytes_available(2, num_bytes, *index)) {
-        return false;
-    }
-    /* Store the two bytes in a variable */
-    uint16_t value_unsigned = two_little_endian_bytes_to_uint16(&bytes[*index]);
-    /* Interpret the two bytes as a two-byte signed integer */
-    int16_t *value_signed_p = (int16_t *)&value_unsigned;
-    /* Assign the two-byte signed integer as the temperature constraint value */
-    *constraint_value = *value_signed_p;
-    *index += 2;
-    return true;
+    parser->state = ALERT_PARSER_STATE_ALERT_ID;
+    parser->alert = alert;
+    parser->num_field_bytes = 0;
+    /* Incremented whenever a variable requirement is parsed */
+    alert->alert_condition.num_variable_requirements = 0;
 }
 
 /**
- * @brief Parse pressure constraint value.
- *
- * @param bytes Array of bytes that contains the pressure constraint value.
- * @param num_bytes Total number of bytes in @p bytes array.
- * @param index Index in @p bytes array that points to the first byte of the pressure constraint value payload.
- * @param[out] constraint_value If true is returned, the resulting pressure constraint value is written to this
- * parameter.
+ * @brief Parse the next fragment of an alert payload.
  *
- * @return true Successfully parsed pressure constraint value.
- * @return false Failed to parse pressure constraint value, because there are not enough available bytes in the
- * payload.
- */
-static bool parse_pressure_constraint_value(const uint8_t *const bytes, size_t num_bytes, size_t *const index,
-                                            MsgTransceiverPressure *const constraint_value)
-{
-    if (!is_x_bytes_available(2, num_bytes, *index)) {
-        return false;
-    }
-    *constraint_value = two_little_endian_bytes_to_uint16(&bytes[*index]);
-    *index += 2;
-    return true;
-}
-
-/**
- * @brief Parse humidity constraint value.
+ * Consumes bytes until the alert is complete, the payload turns out to be invalid, or all bytes are consumed. A field
+ * that is split between two fragments is kept in the parser until its remaining bytes arrive, so the payload never has
+ * to be reassembled.
  *
- * @param bytes Array of bytes that contains the humidity constraint value.
- * @param num_bytes Total number of bytes in @p bytes array.
- * @param index Index in @p bytes array that points to the first byte of the humidity constraint value payload.
- * @param[out] constraint_value If true is returned, the resulting humidity constraint value is written to this
- * parameter.
+ * @param parser Alert parser, started by @ref alert_parser_start.
+ * @param bytes Fragment.
+ * @param num_bytes Number of bytes in @p bytes.
  *
- * @return true Successfully parsed humidity constraint value.
- * @return false Failed to parse humidity constraint value, because there are not enough available bytes in the
- * payload.
+ * @return size_t Number of consumed bytes. Less than @p num_bytes if the parser reached the complete or failed state
+ * before the end of the fragment.
  */
-static bool parse_humidity_constraint_value(const uint8_t *const bytes, size_t num_bytes, size_t *const index,
-                                            MsgTransceiverHumidity *const constraint_value)
+static size_t alert_parser_feed(AlertParser *const parser, const uint8_t *const bytes, size_t num_bytes)
 {
-    if (!is_x_bytes_available(2, num_bytes, *index)) {
-        return false;
+    size_t index = 0;
+    while ((parser->state != ALERT_PARSER_STATE_COMPLETE) && (parser->state != ALERT_PARSER_STATE_FAILED) &&
+           (index < num_bytes)) {
+        size_t field_num_bytes = alert_parser_get_field_num_bytes(parser);
+        size_t num_missing_bytes = field_num_bytes - parser->num_field_bytes;
+        size_t num_available_bytes = num_bytes - index;
+        size_t num_bytes_to_copy = (num_available_bytes < num_missing_bytes) ? num_available_bytes : num_missing_bytes;
+        memcpy(&parser->field_bytes[parser->num_field_bytes], &bytes[index], num_bytes_to_copy);
+        parser->num_field_bytes += num_bytes_to_copy;
+        index += num_bytes_to_copy;
+
+        if (parser->num_field_bytes == field_num_bytes) {
+            parser->state = alert_parser_parse_field(parser);
+            parser->num_field_bytes = 0;
+        }
     }
-    *constraint_value = two_little_endian_bytes_to_uint16(&bytes[*index]);
-    *index += 2;
-    return true;
+    return index;
 }
 
 /**
- * @brief Parse light intensity constraint value.
+ * @brief Parse a fragment of the alert of an "add alert" message.
  *
- * @param bytes Array of bytes that contains the light intensity constraint value.
- * @param num_bytes Total number of bytes in @p bytes array.
- * @param index Index in @p bytes array that points to the first byte of the light intensity constraint value payload.
- * @param[out] constraint_value If true is returned, the resulting light intensity constraint value is written to this
- * parameter.
+ * Calls the set "add alert" callback once the alert is complete, if the payload structure is valid. If the payload
+ * structure is invalid, drops the alert, and ignores "add alert continuation" messages until the next "add alert"
+ * message.
  *
- * @return true Successfully parsed light intensity constraint value.
- * @return false Failed to parse light intensity constraint value, because there are not enough available bytes in the
- * payload.
+ * @param bytes Fragment.
+ * @param num_bytes Number of bytes in the @p bytes array.
  */
-static bool parse_light_intensity_constraint_value(const uint8_t *const bytes, size_t num_bytes, size_t *const index,
-                                                   MsgTransceiverLightIntensity *const constraint_value)
+static void parse_add_alert_fragment(const uint8_t *const bytes, size_t num_bytes)
 {
-    if (!is_x_bytes_available(4, num_bytes, *index)) {
-        return false;
+    size_t num_consumed_bytes = alert_parser_feed(&add_alert_parser, bytes, num_bytes);
+    if (add_alert_parser.state == ALERT_PARSER_STATE_FAILED) {
+        is_add_alert_in_progress = false;
+        return;
+    }
+    if (add_alert_parser.state != ALERT_PARSER_STATE_COMPLETE) {
+        /* The rest of the alert is in "add alert continuation" messages */
+        return;
     }
-    *constraint_value = four_little_endian_bytes_to_uint32(&bytes[*index]);
-    *index += 4;
-    return true;
-}
 
-/**
- * @brief Parse variable requirement.
- *
- * @param bytes Array of bytes that contains the variable requirement.
- * @param num_bytes Total number of bytes in @p bytes array.
- * @param index Index in @p bytes array that points to the first byte of the variable requirement payload.
- * @param[out] requirement If true is returned, the resulting variable requirement is written to this parameter.
- *
- * @return true Successfully parsed variable requirement.
- * @return false Failed to parse variable requirement, because there are not enough available bytes in the payload, or
- * the variable identifier is invalid.
- *
- * @note This function does NOT populate the is_last_in_ored_requirement field in @p requirement, because this function
- * does not know whether this variable requirement is the last one in an ORed requirement.
- */
-static bool parse_variable_requirement(const uint8_t *const bytes, size_t num_bytes, size_t *const index,
-                                       MsgTransceiverVariableRequirement *const requirement)
-{
-    if (!is_x_bytes_available(2, num_bytes, *index)) {
-        return false;
+    is_add_alert_in_progress = false;
+    /* There are extra bytes that were not parsed -> too many bytes, invalid payload structure */
+    if (num_consumed_bytes != num_bytes) {
+        return;
     }
-    requirement->variable_identifier = bytes[(*index)++];
-    requirement->operator = bytes[(*index)++];
-    switch (requirement->variable_identifier) {
-    case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_TEMPERATURE:
-        if (!parse_temperature_constraint_value(bytes, num_bytes, index, &requirement->constraint_value.temperature)) {
-            return false;
-        }
-        break;
-    case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_PRESSURE:
-        if (!parse_pressure_constraint_value(bytes, num_bytes, index, &requirement->constraint_value.pressure)) {
-            return false;
-        }
-        break;
-    case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_HUMIDITY:
-        if (!parse_humidity_constraint_value(bytes, num_bytes, index, &requirement->constraint_value.humidity)) {
-            return false;
-        }
-        break;
-    case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_LIGHT_INTENSITY:
-        if (!parse_light_intensity_constraint_value(bytes, num_bytes, index,
-                                                    &requirement->constraint_value.light_intensity)) {
-            return false;
-        }
-        break;
-    default:
-        /* Invalid variable identifier */
-        return false;
-        break;
+
+    if (add_alert_cb) {
+        add_alert_cb(&add_alert_alert, add_alert_cb_user_data);
     }
-    return true;
 }
 
 /**
- * @brief Parse ORed requirement.
- *
- * @param bytes Array of bytes that contains the ORed requirement.
- * @param num_bytes Total number of bytes in @p bytes array.
- * @param index Index in @p bytes array that points to the first byte of the ORed requirement payload.
- * @param alert_condition If true is returned, writes all variable requirements to this alert condition, starting
- * at index alert_condition->num_variable_requirements. Increments alert_condition->num_variable_requirements for every
- * added variable requirement.
- *
- * @return true Successfully parsed ORed requirement.
- * @return false Failed to parse ORed requirement, because there are not enough available bytes in the payload, or the
- * payload structure is invalid, or there maximum number of allowed variable requirements in an alert condition is
- * exceeded.
+ * @brief Handle receiving a "add alert" message.
+ *
+ * Starts parsing a new alert. If an alert from a previous "add alert" message is still incomplete, it is dropped.
+ *
+ * @param bytes Received bytes excluding the first message id byte.
+ * @param num_bytes Number of bytes in the @p bytes array.
  */
-static bool parse_ored_requirement(const uint8_t *const bytes, size_t num_bytes, size_t *const index,
-                                   MsgTransceiverAlertCondition *const alert_condition)
+static void handle_add_alert_message(const uint8_t *const bytes, size_t num_bytes)
 {
-    if (!is_x_bytes_available(1, num_bytes, *index)) {
-        return false;
-    }
-    size_t num_variable_requirements_in_ored_requirement = bytes[(*index)++];
-    for (size_t i = 0; i < num_variable_requirements_in_ored_requirement; i++) {
-        if (alert_condition->num_variable_requirements >=
-            CONFIG_MSG_TRANSCEIVER_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION) {
-            /* Max allowed number of variable requirements is exceeded */
-            return false;
-        }
-
-        MsgTransceiverVariableRequirement *const requirement =
-            &(alert_condition->variable_requirements[alert_condition->num_variable_requirements]);
-        if (!parse_variable_requirement(bytes, num_bytes, index, requirement)) {
-            return false;
-        }
-        requirement->is_last_in_ored_requirement = (i == (num_variable_requirements_in_ored_requirement - 1));
-        alert_condition->num_variable_requirements++;
-    }
-    return true;
+    alert_parser_start(&add_alert_parser, &add_alert_alert);
+    is_add_alert_in_progress = true;
+    parse_add_alert_fragment(bytes, num_bytes);
 }
 
 /**
- * @brief Parse number of ORed requirements.
+ * @brief Handle receiving a "add alert continuation" message.
  *
- * @param bytes Array of bytes that contains the number of ORed requirements.
- * @param num_bytes Total number of bytes in @p bytes array.
- * @param index Index in @p bytes array that points to the first byte of the number of ORed requirements payload.
- * @param[out] num_ored_requirements If true is returned, the resulting number of ORed requirements is written to this
- * parameter.
+ * Continues parsing the alert of the last "add alert" message. Does nothing if there is no incomplete alert.
  *
- * @return true Successfully parsed number of ORed requirements.
- * @return false Failed to parse number of ORed requirements, because there are not enough available bytes in the
- * payload.
+ * @param bytes Received bytes excluding the first message id byte.
+ * @param num_bytes Number of bytes in the @p bytes array.
  */
-static bool parse_num_ored_requirements(const uint8_t *const bytes, size_t num_bytes, size_t *const index,
-                                        uint8_t *const num_ored_requirements)
+static void handle_add_alert_continuation_message(const uint8_t *const bytes, size_t num_bytes)
 {
-    if (!is_x_bytes_available(1, num_bytes, *index)) {
-        return false;
+    if (!is_add_alert_in_progress) {
+        return;
     }
-    *num_ored_requirements = bytes[(*index)++];
-    return true;
+    parse_add_alert_fragment(bytes, num_bytes);
 }
 
 /**
- * @brief Handle receiving a "add alert" message.
+ * @brief Handle receiving a "replace all alerts" message.
  *
- * Calls the set "add alert" callback, if payload structure is valid. If payload structure is invalid, does nothing.
+ * Calls the set "replace all alerts" callback, if payload structure of the whole message is valid. If payload
+ * structure is invalid, does nothing - not even for the alerts that were parsed successfully.
  *
  * @param bytes Received bytes excluding the first message id byte.
  * @param num_bytes Number of bytes in the @p bytes array.
  */
-static void handle_add_alert_message(const uint8_t *const bytes, size_t num_bytes)
+static void handle_replace_all_alerts_message(const uint8_t *const bytes, size_t num_bytes)
 {
-    MsgTransceiverAlert alert;
     size_t index = 0;
-    if (!parse_alert_id(bytes, num_bytes, &index, &alert.alert_id)) {
-        return;
-    }
-    if (!parse_warmup_period(bytes, num_bytes, &index, &alert.warmup_period)) {
-        return;
-    }
-    if (!parse_cooldown_period(bytes, num_bytes, &index, &alert.cooldown_period)) {
-        return;
-    }
-    if (!parse_notification_type(bytes, num_bytes, &index, &alert.notification_type)) {
+    if (!is_x_bytes_available(1, num_bytes, index)) {
         return;
     }
-    if (alert.notification_type.led) {
-        if (!parse_led_color(bytes, num_bytes, &index, &alert.led_color)) {
-            return;
-        }
-        if (!parse_led_pattern(bytes, num_bytes, &index, &alert.led_pattern)) {
-            return;
-        }
-    }
-
-    uint8_t num_ored_requirements = 0;
-    if (!parse_num_ored_requirements(bytes, num_bytes, &index, &num_ored_requirements)) {
+    size_t num_alerts = bytes[index++];
+    if (num_alerts > CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERTS_IN_REPLACE_ALL_ALERTS_MESSAGE) {
         return;
     }
 
-    /* parse_ored_requirement will increment this field whenever it adds a variable requirement to alert condition */
-    alert.alert_condition.num_variable_requirements = 0;
-    for (size_t i = 0; i < num_ored_requirements; i++) {
-        if (!parse_ored_requirement(bytes, num_bytes, &index, &alert.alert_condition)) {
+    AlertParser parser;
+    for (size_t i = 0; i < num_alerts; i++) {
+        alert_parser_start(&parser, &replace_all_alerts_alerts[i]);
+        index += alert_parser_feed(&parser, &bytes[index], num_bytes - index);
+        if (parser.state != ALERT_PARSER_STATE_COMPLETE) {
+            /* Invalid alert, or the message ended before the alert */
             return;
         }
     }
@@ -542,25 +697,82 @@ static void handle_add_alert_message(const uint8_t *const bytes, size_t num_byte
         return;
     }
 
-    if (add_alert_cb) {
-        add_alert_cb(&alert, add_alert_cb_user_data);
+    if (replace_all_alerts_cb) {
+        replace_all_alerts_cb(replace_all_alerts_alerts, num_alerts, replace_all_alerts_cb_user_data);
     }
 }
 
 /**
- * @brief Find empty "alert status change" message slot.
+ * @brief Find empty message slot.
+ *
+ * The last CONFIG_MSG_TRANSCEIVER_NUM_RESERVED_MESSAGE_SLOTS empty slots are only handed out to alert status change
+ * messages, so that other messages cannot hold back alert status changes.
+ *
+ * @param is_alert_status_change True if the slot is for an "alert status change(s)" message.
  *
- * @return AlertStatusChangeMessageSlot* Pointer to the free slot. NULL if there are no free slots.
+ * @return MessageSlot* Pointer to the free slot. NULL if there are no free slots for this kind of message.
  */
-static AlertStatusChangeMessageSlot *find_empty_message_slot()
+static MessageSlot *find_empty_message_slot(bool is_alert_status_change)
 {
-    for (size_t i = 0; i < MSG_TRANSCEIVER_NUM_MSG_SLOTS; i++) {
+    MessageSlot *empty_slot = NULL;
+    size_t num_empty_slots = 0;
+    for (size_t i = 0; i < CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS; i++) {
         if (!message_slots[i].is_occupied) {
-            return &(message_slots[i]);
+            if (empty_slot == NULL) {
+                empty_slot = &(message_slots[i]);
+            }
+            num_empty_slots++;
         }
     }
-    /* No free slots */
-    return NULL;
+    if (!is_alert_status_change && (num_empty_slots <= CONFIG_MSG_TRANSCEIVER_NUM_RESERVED_MESSAGE_SLOTS)) {
+        /* Only reserved slots are left */
+        return NULL;
+    }
+    return empty_slot;
+}
+
+/**
+ * @brief Check whether an "alert status changes" message can hold a number of records.
+ *
+ * @param num_changes Number of alert status change records.
+ *
+ * @return true The records fit into one message.
+ * @return false There are too many records for one message.
+ */
+static bool is_valid_num_alert_status_changes(size_t num_changes)
+{
+    return (num_changes <= CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERT_STATUS_CHANGES_IN_MESSAGE);
+}
+
+/**
+ * @brief Transmit a message.
+ *
+ * Occupies a message slot until the transmission is complete. If there is no free slot for this kind of message, the
+ * message is not transmitted, and @p cb is executed right away with result false.
+ *
+ * @param bytes Message bytes, including the message id.
+ * @param num_bytes Number of bytes in @p bytes.
+ * @param is_alert_status_change True if this is an "alert status change(s)" message, which may use reserved slots.
+ * @param cb Callback to execute once the message is sent.
+ * @param user_data User data to pass to @p cb as a parameter.
+ */
+static void transmit_message(const uint8_t *const bytes, size_t num_bytes, bool is_alert_status_change,
+                             MsgTransceiverMessageSentCb cb, void *user_data)
+{
+    /* Store cb and user_data so that we can execute it from inside transmit_complete_cb */
+    MessageSlot *slot = find_empty_message_slot(is_alert_status_change);
+    if (slot == NULL) {
+        /* All slots are full, failed to send message */
+        if (cb) {
+            cb(false, user_data);
+        }
+        return;
+    }
+    slot->cb = cb;
+    slot->cb_user_data = user_data;
+    slot->is_occupied = true;
+
+    hw_platform_get_transceiver()->transmit(bytes, num_bytes, transmit_complete_cb, (void *)slot);
 }
 
 /**
@@ -585,6 +797,18 @@ static void receive_cb(const uint8_t *bytes, size_t num_bytes, void *user_data)
     case MSG_TRANSCEIVER_MESSAGE_ID_ADD_ALERT:
         handle_add_alert_message(&bytes[1], num_bytes - 1);
         break;
+    case MSG_TRANSCEIVER_MESSAGE_ID_ADD_ALERT_CONTINUATION:
+        handle_add_alert_continuation_message(&bytes[1], num_bytes - 1);
+        break;
+    case MSG_TRANSCEIVER_MESSAGE_ID_GET_STATS:
+        handle_get_stats_message(&bytes[1], num_bytes - 1);
+        break;
+    case MSG_TRANSCEIVER_MESSAGE_ID_REPLACE_ALL_ALERTS:
+        handle_replace_all_alerts_message(&bytes[1], num_bytes - 1);
+        break;
+    case MSG_TRANSCEIVER_MESSAGE_ID_GET_SAMPLE_HISTORY:
+        handle_get_sample_history_message(&bytes[1], num_bytes - 1);
+        break;
     default:
         /* Invalid message id */
         break;
@@ -600,29 +824,85 @@ void msg_transceiver_init()
     initialized = true;
 }
 
-void msg_transceiver_send_alert_status_change_message(uint8_t alert_id, bool is_raised, MsgTransceiverMessageSentCb cb,
+void msg_transceiver_send_alert_status_change_message(uint16_t alert_id, bool is_raised, MsgTransceiverMessageSentCb cb,
                                                       void *user_data)
 {
     EAS_ASSERT(initialized);
 
-    /* Store cb and user_data so that we can execute it from inside transmit_complete_cb */
-    AlertStatusChangeMessageSlot *slot = find_empty_message_slot();
-    if (slot == NULL) {
-        /* All slots are full, failed to send message */
-        if (cb) {
-            cb(false, user_data);
-        }
-        return;
-    }
-    slot->cb = cb;
-    slot->cb_user_data = user_data;
-    slot->is_occupied = true;
-
-    uint8_t bytes[3];
+    uint8_t bytes[MSG_TRANSCEIVER_ALERT_STATUS_CHANGE_MESSAGE_NUM_BYTES];
     bytes[0] = MSG_TRANSCEIVER_MESSAGE_ID_ALERT_STATUS_CHANGE;
-    bytes[1] = alert_id;
-    bytes[2] = is_raised ? 0x1 : 0x0;
-    hw_platform_get_transceiver()->transmit(bytes, 3, transmit_complete_cb, (void *)slot);
+    uint16_to_two_little_endian_bytes(alert_id, &bytes[1]);
+    bytes[3] = is_raised ? 0x1 : 0x0;
+    transmit_message(bytes, MSG_TRANSCEIVER_ALERT_STATUS_CHANGE_MESSAGE_NUM_BYTES, true, cb, user_data);
+}
+
+void msg_transceiver_send_alert_status_changes_message(const MsgTransceiverAlertStatusChange *const changes,
+                                                       size_t num_changes, MsgTransceiverMessageSentCb cb,
+                                                       void *user_data)
+{
+    EAS_ASSERT(initialized);
+    EAS_ASSERT(changes);
+    EAS_ASSERT(num_changes > 0);
+    EAS_ASSERT(is_valid_num_alert_status_changes(num_changes));
+
+    uint8_t bytes[MSG_TRANSCEIVER_ALERT_STATUS_CHANGES_MESSAGE_MAX_NUM_BYTES];
+    size_t num_bytes = 0;
+    bytes[num_bytes++] = MSG_TRANSCEIVER_MESSAGE_ID_ALERT_STATUS_CHANGES;
+    bytes[num_bytes++] = (uint8_t)num_changes;
+    for (size_t i = 0; i < num_changes; i++) {
+        uint16_to_two_little_endian_bytes(changes[i].alert_id, &bytes[num_bytes]);
+        num_bytes += 2;
+        bytes[num_bytes++] = changes[i].is_raised ? 0x1 : 0x0;
+    }
+    transmit_message(bytes, num_bytes, true, cb, user_data);
+}
+
+void msg_transceiver_send_event_queue_stats_message(const MsgTransceiverEventQueueStats *const stats,
+                                                    MsgTransceiverMessageSentCb cb, void *user_data)
+{
+    EAS_ASSERT(initialized);
+    EAS_ASSERT(stats);
+
+    uint8_t bytes[MSG_TRANSCEIVER_EVENT_QUEUE_STATS_MESSAGE_NUM_BYTES];
+    bytes[0] = MSG_TRANSCEIVER_MESSAGE_ID_EVENT_QUEUE_STATS;
+    bytes[1] = stats->num_slots;
+    bytes[2] = stats->high_watermark;
+    bytes[3] = stats->num_event_ids;
+    transmit_message(bytes, MSG_TRANSCEIVER_EVENT_QUEUE_STATS_MESSAGE_NUM_BYTES, false, cb, user_data);
+}
+
+void msg_transceiver_send_event_stats_message(const MsgTransceiverEventStats *const stats,
+                                              MsgTransceiverMessageSentCb cb, void *user_data)
+{
+    EAS_ASSERT(initialized);
+    EAS_ASSERT(stats);
+
+    uint8_t bytes[MSG_TRANSCEIVER_EVENT_STATS_MESSAGE_NUM_BYTES];
+    bytes[0] = MSG_TRANSCEIVER_MESSAGE_ID_EVENT_STATS;
+    bytes[1] = stats->event_id;
+    uint32_to_four_little_endian_bytes(stats->num_handled, &bytes[2]);
+    uint64_to_eight_little_endian_bytes(stats->total_handler_cycles, &bytes[6]);
+    uint32_to_four_little_endian_bytes(stats->max_handler_cycles, &bytes[14]);
+    transmit_message(bytes, MSG_TRANSCEIVER_EVENT_STATS_MESSAGE_NUM_BYTES, false, cb, user_data);
+}
+
+void msg_transceiver_send_sample_history_message(const MsgTransceiverSampleHistoryFragment *const fragment,
+                                                 MsgTransceiverMessageSentCb cb, void *user_data)
+{
+    EAS_ASSERT(initialized);
+    EAS_ASSERT(fragment);
+    EAS_ASSERT(fragment->num_bytes <= MSG_TRANSCEIVER_SAMPLE_HISTORY_MAX_NUM_BYTES_IN_MESSAGE);
+    EAS_ASSERT(fragment->bytes || (fragment->num_bytes == 0));
+
+    uint8_t bytes[MSG_TRANSCEIVER_SAMPLE_HISTORY_MESSAGE_MAX_NUM_BYTES];
+    bytes[0] = MSG_TRANSCEIVER_MESSAGE_ID_SAMPLE_HISTORY;
+    uint16_to_two_little_endian_bytes(fragment->block_index, &bytes[1]);
+    bytes[3] = fragment->offset;
+    if (fragment->num_bytes > 0) {
+        memcpy(&bytes[MSG_TRANSCEIVER_SAMPLE_HISTORY_MESSAGE_HEADER_NUM_BYTES], fragment->bytes, fragment->num_bytes);
+    }
+    transmit_message(bytes, MSG_TRANSCEIVER_SAMPLE_HISTORY_MESSAGE_HEADER_NUM_BYTES + fragment->num_bytes, false, cb,
+                     user_data);
 }
 
 void msg_transceiver_set_add_alert_cb(MsgTransceiverAddAlertCb cb, void *user_data)
@@ -643,6 +923,33 @@ void msg_transceiver_set_remove_alert_cb(MsgTransceiverRemoveAlertCb cb, void *u
     remove_alert_cb_user_data = user_data;
 }
 
+void msg_transceiver_set_get_stats_cb(MsgTransceiverGetStatsCb cb, void *user_data)
+{
+    EAS_ASSERT(initialized);
+    EAS_ASSERT(cb);
+
+    get_stats_cb = cb;
+    get_stats_cb_user_data = user_data;
+}
+
+void msg_transceiver_set_replace_all_alerts_cb(MsgTransceiverReplaceAllAlertsCb cb, void *user_data)
+{
+    EAS_ASSERT(initialized);
+    EAS_ASSERT(cb);
+
+    replace_all_alerts_cb = cb;
+    replace_all_alerts_cb_user_data = user_data;
+}
+
+void msg_transceiver_set_get_sample_history_cb(MsgTransceiverGetSampleHistoryCb cb, void *user_data)
+{
+    EAS_ASSERT(initialized);
+    EAS_ASSERT(cb);
+
+    get_sample_history_cb = cb;
+    get_sample_history_cb_user_data = user_data;
+}
+
 void msg_transceiver_deinit()
 {
     if (!initialized) {
@@ -653,8 +960,11 @@ void msg_transceiver_deinit()
     reset_message_slots();
     remove_alert_cb = NULL;
     add_alert_cb = NULL;
-    /* No need to clear user data for add and remove alert cbs, since it will get reset anyway when the new add/remove
-     * alert callback is set */
+    get_stats_cb = NULL;
+    replace_all_alerts_cb = NULL;
+    get_sample_history_cb = NULL;
+    is_add_alert_in_progress = false;
+    /* No need to clear user data for the callbacks, since it will get reset anyway when the new callback is set */
     hw_platform_get_transceiver()->unset_receive_cb();
     initialized = false;
 }
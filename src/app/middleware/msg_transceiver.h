@@ -22,6 +22,11 @@ extern "C"
  * Whenever an application protocol message needs to be sent, this module converts structured data into raw bytes and
  * transmits the bytes.
  *
+ * An "add alert" message whose alert does not fit into one write can be continued by "add alert continuation"
+ * messages. Their payload is the next bytes of the alert payload. The alert is parsed as the fragments arrive, and the
+ * "add alert" callback is executed once the last field of the alert has been received. A new "add alert" message drops
+ * an incomplete alert, and "add alert continuation" messages are ignored if there is no incomplete alert.
+ *
  * # Usage
  *
  * ```
@@ -30,9 +35,26 @@ extern "C"
  * // Register callbacks to execute whenever "add alert" and "remove alert" messages are received
  * msg_transceiver_set_add_alert_cb(add_alert_cb, add_alert_cb_user_data);
  * msg_transceiver_set_remove_alert_cb(remove_alert_cb, remove_alert_cb_user_data);
+ * // Register callback to execute whenever a "replace all alerts" message is received
+ * msg_transceiver_set_replace_all_alerts_cb(replace_all_alerts_cb, replace_all_alerts_cb_user_data);
+ * // Register callback to execute whenever a "get stats" message is received
+ * msg_transceiver_set_get_stats_cb(get_stats_cb, get_stats_cb_user_data);
+ * // Register callback to execute whenever a "get sample history" message is received
+ * msg_transceiver_set_get_sample_history_cb(get_sample_history_cb, get_sample_history_cb_user_data);
  *
  * // Send "alert status change" message whenever needed
  * msg_transceiver_send_alert_status_change_message(alert_id, is_raised, cb, user_data);
+ * // Or report several alert status changes in a single "alert status changes" message
+ * msg_transceiver_send_alert_status_changes_message(changes, num_changes, cb, user_data);
+ *
+ * // Respond to a "get stats" message with an "event queue stats" message, followed by an "event stats" message for
+ * // each event id
+ * msg_transceiver_send_event_queue_stats_message(&event_queue_stats, cb, user_data);
+ * msg_transceiver_send_event_stats_message(&event_stats, cb, user_data);
+ *
+ * // Respond to a "get sample history" message with "sample history" messages, one for each fragment of each sample
+ * // history block, followed by a "sample history" message without fragment bytes that ends the read-out
+ * msg_transceiver_send_sample_history_message(&fragment, cb, user_data);
  * ```
  */
 
@@ -40,6 +62,22 @@ extern "C"
 #define CONFIG_MSG_TRANSCEIVER_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION 1
 #endif
 
+#ifndef CONFIG_MSG_TRANSCEIVER_MAX_EXPRESSION_DEPTH
+#define CONFIG_MSG_TRANSCEIVER_MAX_EXPRESSION_DEPTH 1
+#endif
+
+#ifndef CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERTS_IN_REPLACE_ALL_ALERTS_MESSAGE
+#define CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERTS_IN_REPLACE_ALL_ALERTS_MESSAGE 1
+#endif
+
+#ifndef CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERT_STATUS_CHANGES_IN_MESSAGE
+#define CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERT_STATUS_CHANGES_IN_MESSAGE 1
+#endif
+
+/** Maximum number of sample history block bytes in one "sample history" message. The message then fits into a single
+ * BLE notification with the default ATT MTU. */
+#define MSG_TRANSCEIVER_SAMPLE_HISTORY_MAX_NUM_BYTES_IN_MESSAGE 16
+
 /* Some type names are prepended with MsgTransceiver to avoid conflicts with type names defined in other modules. */
 
 typedef struct NotificationType {
@@ -65,11 +103,32 @@ typedef enum MsgTransceiverVariableIdentifier {
     MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_LIGHT_INTENSITY = 3,
 } MsgTransceiverVariableIdentifier;
 
+/**
+ * @brief Operator of a variable requirement.
+ *
+ * In the alert payload, the operator of a variable requirement is followed by its constraint value. INSIDE and OUTSIDE
+ * are band operators - they are followed by two constraint values, the lower and then the upper bound of the band.
+ */
 typedef enum MsgTransceiverRequirementOperator {
     MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_GEQ = 0,
     MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_LEQ = 1,
+    MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_INSIDE = 2,
+    MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_OUTSIDE = 3,
 } MsgTransceiverRequirementOperator;
 
+/**
+ * @brief Operator of an expression in an alert condition.
+ *
+ * In the alert payload, an operand that is an expression starts with a byte that has bit 7 set and the operator in the
+ * lower bits. AND and OR are followed by a byte with the number of their operands, which must not be 0, and NOT always
+ * has one operand. The operands follow, and each of them is a variable requirement or another expression.
+ */
+typedef enum MsgTransceiverExpressionOperator {
+    MSG_TRANSCEIVER_EXPRESSION_OPERATOR_AND = 0,
+    MSG_TRANSCEIVER_EXPRESSION_OPERATOR_OR = 1,
+    MSG_TRANSCEIVER_EXPRESSION_OPERATOR_NOT = 2,
+} MsgTransceiverExpressionOperator;
+
 typedef int16_t MsgTransceiverTemperature;
 typedef uint16_t MsgTransceiverPressure;
 typedef uint16_t MsgTransceiverHumidity;
@@ -87,8 +146,11 @@ typedef struct MsgTransceiverVariableRequirement {
     uint8_t variable_identifier;
     /**< Should contain values of type enum MsgTransceiverRequirementOperator */
     uint8_t operator;
-    /**< variable_identifier field defines which of the union fields should be accessed */
+    /**< variable_identifier field defines which of the union fields should be accessed. For band operators, this is the
+     * lower bound of the band. */
     ConstraintValue constraint_value;
+    /**< Upper bound of the band, only valid for band operators. Accessed the same way as constraint_value. */
+    ConstraintValue upper_constraint_value;
     /** True if it is the last variable requirement in an ORed requirement. An array of type
      * MsgTransceiverVariableRequirement represents an alert condition. If we iterate through the array sequentially,
      * variable requirements that have this field set to true mark the end of an ORed requirement. Each variable
@@ -97,6 +159,13 @@ typedef struct MsgTransceiverVariableRequirement {
      * field set to true, or until the beginning of the array. The last variable requirement in the array is always
      * the last one in an ORed requirement, so it should always have this field set to true. */
     bool is_last_in_ored_requirement;
+    /** Number of expressions that begin right before this variable requirement. */
+    uint8_t num_begun_expressions;
+    /**< Operators of the expressions that begin right before this variable requirement, the outermost one first. Should
+     * contain values of type enum MsgTransceiverExpressionOperator. */
+    uint8_t begun_expression_operators[CONFIG_MSG_TRANSCEIVER_MAX_EXPRESSION_DEPTH];
+    /** Number of expressions that end right after this variable requirement. */
+    uint8_t num_ended_expressions;
 } MsgTransceiverVariableRequirement;
 
 typedef struct MsgTransceiverAlertCondition {
@@ -110,13 +179,18 @@ typedef struct MsgTransceiverAlertCondition {
      * last variable requirement in the array is always the last one in an ORed requirement, so it should always have
      * that field set to true. In other words, there is a logical AND (or the end of the array) after every variable
      * requirement that has that field set to true.
+     *
+     * Operands of an ORed requirement can also be AND, OR and NOT expressions of variable requirements, which can be
+     * nested. An expression begins before its first variable requirement, and ends after its last one, which is
+     * described by the num_begun_expressions and num_ended_expressions fields. For example, the ORed requirement
+     * "(req_0 AND req_1) OR req_2" has one expression that begins before req_0 and ends after req_1.
      */
     MsgTransceiverVariableRequirement
         variable_requirements[CONFIG_MSG_TRANSCEIVER_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION];
 } MsgTransceiverAlertCondition;
 
 typedef struct MsgTransceiverAlert {
-    uint8_t alert_id;
+    uint16_t alert_id;
     uint32_t warmup_period;
     uint32_t cooldown_period;
     NotificationType notification_type;
@@ -129,6 +203,46 @@ typedef struct MsgTransceiverAlert {
     MsgTransceiverAlertCondition alert_condition;
 } MsgTransceiverAlert;
 
+/** One record of an "alert status changes" message. */
+typedef struct MsgTransceiverAlertStatusChange {
+    uint16_t alert_id;
+    /** True if alert status changed to "raised", false if alert status changed to "silenced". */
+    bool is_raised;
+} MsgTransceiverAlertStatusChange;
+
+/** Payload of an "event queue stats" message. */
+typedef struct MsgTransceiverEventQueueStats {
+    /** Number of slots in the event queue */
+    uint8_t num_slots;
+    /** Highest number of event queue slots that were occupied at the same time */
+    uint8_t high_watermark;
+    /** Number of event ids. "Event stats" messages are sent for event ids in the range [0, num_event_ids). */
+    uint8_t num_event_ids;
+} MsgTransceiverEventQueueStats;
+
+/** Payload of an "event stats" message - event handling statistics of one event id. */
+typedef struct MsgTransceiverEventStats {
+    uint8_t event_id;
+    /** Number of handled events with this event id */
+    uint32_t num_handled;
+    /** Sum of the handling times of all handled events with this event id, in cycles */
+    uint64_t total_handler_cycles;
+    /** Longest handling time of a single event with this event id, in cycles */
+    uint32_t max_handler_cycles;
+} MsgTransceiverEventStats;
+
+/** Payload of a "sample history" message - a fragment of a sample history block. */
+typedef struct MsgTransceiverSampleHistoryFragment {
+    /** Index of the block in the read-out, starting from 0. If num_bytes is 0, number of blocks in the read-out. */
+    uint16_t block_index;
+    /** Offset of the fragment bytes in the block */
+    uint8_t offset;
+    /** Fragment bytes. Can be NULL if num_bytes is 0. */
+    const uint8_t *bytes;
+    /** Number of fragment bytes, at most MSG_TRANSCEIVER_SAMPLE_HISTORY_MAX_NUM_BYTES_IN_MESSAGE. 0 ends read-out. */
+    uint8_t num_bytes;
+} MsgTransceiverSampleHistoryFragment;
+
 /**
  * @brief Defines callback type to execute when a message has been sent.
  *
@@ -140,6 +254,9 @@ typedef void (*MsgTransceiverMessageSentCb)(bool result, void *user_data);
 /**
  * @brief Defines callback type to execute when a "add alert" message is received.
  *
+ * If the alert is split between an "add alert" message and "add alert continuation" messages, the callback is executed
+ * once the last fragment of the alert is received.
+ *
  * @param alert Alert to add.
  * @param user_data User data.
  */
@@ -151,7 +268,31 @@ typedef void (*MsgTransceiverAddAlertCb)(const MsgTransceiverAlert *const alert,
  * @param alert_id Id of alert to remove.
  * @param user_data User data.
  */
-typedef void (*MsgTransceiverRemoveAlertCb)(uint8_t alert_id, void *user_data);
+typedef void (*MsgTransceiverRemoveAlertCb)(uint16_t alert_id, void *user_data);
+
+/**
+ * @brief Defines callback type to execute when a "replace all alerts" message is received.
+ *
+ * @param alerts Alerts that should replace all alerts currently in the system. Only valid during the callback.
+ * @param num_alerts Number of alerts in @p alerts. Can be 0, which means that all alerts should be removed.
+ * @param user_data User data.
+ */
+typedef void (*MsgTransceiverReplaceAllAlertsCb)(const MsgTransceiverAlert *const alerts, size_t num_alerts,
+                                                 void *user_data);
+
+/**
+ * @brief Defines callback type to execute when a "get stats" message is received.
+ *
+ * @param user_data User data.
+ */
+typedef void (*MsgTransceiverGetStatsCb)(void *user_data);
+
+/**
+ * @brief Defines callback type to execute when a "get sample history" message is received.
+ *
+ * @param user_data User data.
+ */
+typedef void (*MsgTransceiverGetSampleHistoryCb)(void *user_data);
 
 /**
  * @brief Initialize message transceiver module.
@@ -171,9 +312,73 @@ void msg_transceiver_init();
  * @param cb Callback to execute once the message is sent.
  * @param user_data User data to pass to @p cb as a parameter.
  */
-void msg_transceiver_send_alert_status_change_message(uint8_t alert_id, bool is_raised, MsgTransceiverMessageSentCb cb,
+void msg_transceiver_send_alert_status_change_message(uint16_t alert_id, bool is_raised, MsgTransceiverMessageSentCb cb,
                                                       void *user_data);
 
+/**
+ * @brief Send alert status changes message.
+ *
+ * Reports status changes of several alerts in one message, so that they are transmitted as a single notification. The
+ * records are transmitted in the order in which they appear in @p changes.
+ *
+ * Occupies one message slot, same as @ref msg_transceiver_send_alert_status_change_message, and may use the slots
+ * reserved by CONFIG_MSG_TRANSCEIVER_NUM_RESERVED_MESSAGE_SLOTS.
+ *
+ * @pre Module has been initialized by calling @ref msg_transceiver_init.
+ *
+ * @param changes Alert status change records. The records are copied, so this array does not need to stay valid after
+ * this function returns.
+ * @param num_changes Number of records in @p changes. Must be > 0 and <=
+ * CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERT_STATUS_CHANGES_IN_MESSAGE.
+ * @param cb Callback to execute once the message is sent.
+ * @param user_data User data to pass to @p cb as a parameter.
+ */
+void msg_transceiver_send_alert_status_changes_message(const MsgTransceiverAlertStatusChange *const changes,
+                                                       size_t num_changes, MsgTransceiverMessageSentCb cb,
+                                                       void *user_data);
+
+/**
+ * @brief Send event queue stats message.
+ *
+ * Occupies one message slot, but never one of the slots reserved by CONFIG_MSG_TRANSCEIVER_NUM_RESERVED_MESSAGE_SLOTS.
+ *
+ * @pre Module has been initialized by calling @ref msg_transceiver_init.
+ *
+ * @param stats Stats to send. Copied, so this does not need to stay valid after this function returns.
+ * @param cb Callback to execute once the message is sent.
+ * @param user_data User data to pass to @p cb as a parameter.
+ */
+void msg_transceiver_send_event_queue_stats_message(const MsgTransceiverEventQueueStats *const stats,
+                                                    MsgTransceiverMessageSentCb cb, void *user_data);
+
+/**
+ * @brief Send event stats message.
+ *
+ * Occupies one message slot, but never one of the slots reserved by CONFIG_MSG_TRANSCEIVER_NUM_RESERVED_MESSAGE_SLOTS.
+ *
+ * @pre Module has been initialized by calling @ref msg_transceiver_init.
+ *
+ * @param stats Stats to send. Copied, so this does not need to stay valid after this function returns.
+ * @param cb Callback to execute once the message is sent.
+ * @param user_data User data to pass to @p cb as a parameter.
+ */
+void msg_transceiver_send_event_stats_message(const MsgTransceiverEventStats *const stats,
+                                              MsgTransceiverMessageSentCb cb, void *user_data);
+
+/**
+ * @brief Send sample history message.
+ *
+ * Occupies one message slot, but never one of the slots reserved by CONFIG_MSG_TRANSCEIVER_NUM_RESERVED_MESSAGE_SLOTS.
+ *
+ * @pre Module has been initialized by calling @ref msg_transceiver_init.
+ *
+ * @param fragment Fragment to send. Copied, so this does not need to stay valid after this function returns.
+ * @param cb Callback to execute once the message is sent.
+ * @param user_data User data to pass to @p cb as a parameter.
+ */
+void msg_transceiver_send_sample_history_message(const MsgTransceiverSampleHistoryFragment *const fragment,
+                                                 MsgTransceiverMessageSentCb cb, void *user_data);
+
 /**
  * @brief Set callback to execute whenever a "add alert" message is received.
  *
@@ -194,6 +399,36 @@ void msg_transceiver_set_add_alert_cb(MsgTransceiverAddAlertCb cb, void *user_da
  */
 void msg_transceiver_set_remove_alert_cb(MsgTransceiverRemoveAlertCb cb, void *user_data);
 
+/**
+ * @brief Set callback to execute whenever a "replace all alerts" message is received.
+ *
+ * @pre Module has been initialized by calling @ref msg_transceiver_init.
+ *
+ * @param cb Callback to execute.
+ * @param user_data User data to pass to @p cb as a parameter.
+ */
+void msg_transceiver_set_replace_all_alerts_cb(MsgTransceiverReplaceAllAlertsCb cb, void *user_data);
+
+/**
+ * @brief Set callback to execute whenever a "get stats" message is received.
+ *
+ * @pre Module has been initialized by calling @ref msg_transceiver_init.
+ *
+ * @param cb Callback to execute.
+ * @param user_data User data to pass to @p cb as a parameter.
+ */
+void msg_transceiver_set_get_stats_cb(MsgTransceiverGetStatsCb cb, void *user_data);
+
+/**
+ * @brief Set callback to execute whenever a "get sample history" message is received.
+ *
+ * @pre Module has been initialized by calling @ref msg_transceiver_init.
+ *
+ * @param cb Callback to execute.
+ * @param user_data User data to pass to @p cb as a parameter.
+ */
+void msg_transceiver_set_get_sample_history_cb(MsgTransceiverGetSampleHistoryCb cb, void *user_data);
+
 /**
  * @brief Deinitialize message transceiver module.
  *
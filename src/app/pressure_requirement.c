@@ -15,6 +15,8 @@ typedef struct PressureRequirementStruct *PressureRequirement;
 struct PressureRequirementStruct {
     VariableRequirementStruct base;
     Pressure value;
+    /** Upper requirement value of a band requirement. Equal to value for all other requirements. */
+    Pressure upper_value;
 };
 
 EAS_STATIC_ASSERT(sizeof(struct PressureRequirementStruct) <= CONFIG_VARIABLE_REQUIREMENT_MAX_SIZE);
@@ -22,10 +24,14 @@ EAS_STATIC_ASSERT(sizeof(struct PressureRequirementStruct) <= CONFIG_VARIABLE_RE
 // Forward declarations of interface functions to define the interface.
 static bool evaluate(VariableRequirement base);
 static void destroy(VariableRequirement base);
+static VariableRequirementThreshold get_threshold(VariableRequirement base);
+static VariableRequirementThreshold get_upper_threshold(VariableRequirement base);
 
 static VariableRequirementInterfaceStruct interface = {
     .evaluate = evaluate,
     .destroy = destroy,
+    .get_threshold = get_threshold,
+    .get_upper_threshold = get_upper_threshold,
 };
 
 /**
@@ -49,6 +55,12 @@ static bool evaluate(VariableRequirement base)
     case VARIABLE_REQUIREMENT_OPERATOR_LEQ:
         result = (current_pressure <= self->value);
         break;
+    case VARIABLE_REQUIREMENT_OPERATOR_INSIDE:
+        result = (current_pressure >= self->value) && (current_pressure <= self->upper_value);
+        break;
+    case VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE:
+        result = (current_pressure < self->value) || (current_pressure > self->upper_value);
+        break;
     default:
         /* Invalid operator */
         EAS_ASSERT(false);
@@ -68,12 +80,61 @@ static void destroy(VariableRequirement base)
     variable_requirement_allocator_free(base);
 }
 
-VariableRequirement pressure_requirement_create(uint8_t alert_id, uint8_t operator, Pressure value)
+/**
+ * @brief Get requirement value of a pressure variable requirement.
+ *
+ * @param base Pressure requirement instance returned by @ref pressure_requirement_create.
+ *
+ * @return VariableRequirementThreshold Requirement value passed to @ref pressure_requirement_create, or lower
+ * requirement value passed to @ref pressure_requirement_create_band.
+ */
+static VariableRequirementThreshold get_threshold(VariableRequirement base)
+{
+    PressureRequirement self = (PressureRequirement)base;
+    return (VariableRequirementThreshold)self->value;
+}
+
+/**
+ * @brief Get upper requirement value of a pressure band requirement.
+ *
+ * @param base Pressure requirement instance returned by @ref pressure_requirement_create_band.
+ *
+ * @return VariableRequirementThreshold Upper requirement value passed to @ref pressure_requirement_create_band.
+ */
+static VariableRequirementThreshold get_upper_threshold(VariableRequirement base)
 {
+    PressureRequirement self = (PressureRequirement)base;
+    return (VariableRequirementThreshold)self->upper_value;
+}
+
+VariableRequirement pressure_requirement_create(uint16_t alert_id, uint8_t operator, Pressure value)
+{
+    /* Band requirements have two requirement values */
+    bool is_band_operator = variable_requirement_is_band_operator(operator);
+    EAS_ASSERT(!is_band_operator);
+
     PressureRequirement self = variable_requirement_allocator_alloc();
     EAS_ASSERT(self);
     variable_requirement_create((VariableRequirement)self, &interface, operator, alert_id);
 
     self->value = value;
+    self->upper_value = value;
+    return (VariableRequirement)self;
+}
+
+VariableRequirement pressure_requirement_create_band(uint16_t alert_id, uint8_t operator, Pressure lower_value,
+                                                     Pressure upper_value)
+{
+    bool is_band_operator = variable_requirement_is_band_operator(operator);
+    EAS_ASSERT(is_band_operator);
+    bool is_valid_band = (lower_value < upper_value);
+    EAS_ASSERT(is_valid_band);
+
+    PressureRequirement self = variable_requirement_allocator_alloc();
+    EAS_ASSERT(self);
+    variable_requirement_create((VariableRequirement)self, &interface, operator, alert_id);
+
+    self->value = lower_value;
+    self->upper_value = upper_value;
     return (VariableRequirement)self;
 }
@@ -8,6 +8,7 @@ extern "C"
 
 #include <stdint.h>
 
+#include "pressure.h"
 #include "variable_requirement_list_defs.h"
 
 /**
@@ -31,12 +32,47 @@ void pressure_requirement_list_add(VariableRequirement pressure_requirement);
  */
 void pressure_requirement_list_for_each(VariableRequirementListForEachCb cb);
 
+/**
+ * @brief Evaluate all pressure requirements for a pressure value.
+ *
+ * @param value Current pressure value.
+ * @param cb Callback to execute for each pressure requirement whose result changed, see @ref
+ * variable_requirement_list_evaluate.
+ *
+ * @note Fires an assert if @p cb is NULL.
+ */
+void pressure_requirement_list_evaluate(Pressure value, VariableRequirementListResultChangedCb cb);
+
+/**
+ * @brief Evaluate the pressure requirements whose results could have been changed by a pressure change.
+ *
+ * Only the pressure requirements with requirement values between @p previous_value and @p value are evaluated.
+ *
+ * @param previous_value Previous pressure value.
+ * @param value Current pressure value.
+ * @param cb Callback to execute for each pressure requirement whose result changed, see @ref
+ * variable_requirement_list_evaluate_in_range.
+ *
+ * @note Fires an assert if @p cb is NULL.
+ */
+void pressure_requirement_list_evaluate_in_range(Pressure previous_value, Pressure value,
+                                                 VariableRequirementListResultChangedCb cb);
+
+/**
+ * @brief Get the distance from a pressure value to the nearest requirement value of a pressure requirement.
+ *
+ * @param value Current pressure value.
+ *
+ * @return VariableRequirementThreshold Distance, see @ref variable_requirement_list_get_distance_to_nearest.
+ */
+VariableRequirementThreshold pressure_requirement_list_get_distance_to_nearest(Pressure value);
+
 /**
  * @brief Remove all pressure requirements from the list that belong to a specific alert.
  *
  * @param alert_id All pressure requirements that belong to the alert with this id are removed from the list.
  */
-void pressure_requirement_list_remove_all_for_alert(uint8_t alert_id);
+void pressure_requirement_list_remove_all_for_alert(uint16_t alert_id);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,320 @@
+#include <string.h>
+
+#include "sample_history.h"
+#include "eas_ring_buf.h"
+#include "eas_current_time.h"
+#include "eas_assert.h"
+#include "config.h"
+#include "util.h"
+
+#ifndef CONFIG_SAMPLE_HISTORY_BLOCK_SIZE
+#define CONFIG_SAMPLE_HISTORY_BLOCK_SIZE 64
+#endif
+
+#ifndef CONFIG_SAMPLE_HISTORY_NUM_BLOCKS
+#define CONFIG_SAMPLE_HISTORY_NUM_BLOCKS 1
+#endif
+
+#ifndef CONFIG_SAMPLE_HISTORY_MIN_INTERVAL_MS
+#define CONFIG_SAMPLE_HISTORY_MIN_INTERVAL_MS 0
+#endif
+
+#ifndef CONFIG_SAMPLE_HISTORY_TEMPERATURE_MIN_CHANGE
+#define CONFIG_SAMPLE_HISTORY_TEMPERATURE_MIN_CHANGE 1
+#endif
+
+#ifndef CONFIG_SAMPLE_HISTORY_PRESSURE_MIN_CHANGE
+#define CONFIG_SAMPLE_HISTORY_PRESSURE_MIN_CHANGE 1
+#endif
+
+#ifndef CONFIG_SAMPLE_HISTORY_HUMIDITY_MIN_CHANGE
+#define CONFIG_SAMPLE_HISTORY_HUMIDITY_MIN_CHANGE 1
+#endif
+
+#ifndef CONFIG_SAMPLE_HISTORY_LIGHT_INTENSITY_MIN_CHANGE
+#define CONFIG_SAMPLE_HISTORY_LIGHT_INTENSITY_MIN_CHANGE 1
+#endif
+
+/* Block time at the start of every block */
+#define SAMPLE_HISTORY_BLOCK_TIME_NUM_BYTES 4
+/* Number of low bits of the first varint of a record that hold the variable */
+#define SAMPLE_HISTORY_VARIABLE_NUM_BITS 2
+/* Elapsed time and variable take up to 34 bits, value difference up to 33 bits. 7 bits per varint byte. */
+#define SAMPLE_HISTORY_RECORD_MAX_NUM_BYTES 10
+
+typedef enum {
+    SAMPLE_HISTORY_VARIABLE_TEMPERATURE = 0,
+    SAMPLE_HISTORY_VARIABLE_PRESSURE = 1,
+    SAMPLE_HISTORY_VARIABLE_HUMIDITY = 2,
+    SAMPLE_HISTORY_VARIABLE_LIGHT_INTENSITY = 3,
+    SAMPLE_HISTORY_NUM_VARIABLES,
+} SampleHistoryVariable;
+
+/* A smaller minimum change would record samples with unchanged values */
+EAS_STATIC_ASSERT(CONFIG_SAMPLE_HISTORY_TEMPERATURE_MIN_CHANGE >= 1);
+EAS_STATIC_ASSERT(CONFIG_SAMPLE_HISTORY_PRESSURE_MIN_CHANGE >= 1);
+EAS_STATIC_ASSERT(CONFIG_SAMPLE_HISTORY_HUMIDITY_MIN_CHANGE >= 1);
+EAS_STATIC_ASSERT(CONFIG_SAMPLE_HISTORY_LIGHT_INTENSITY_MIN_CHANGE >= 1);
+
+/* Every block must fit the block time, records for the values of all other variables, and one more record */
+#define SAMPLE_HISTORY_BLOCK_MIN_SIZE                                                                                  \
+    (SAMPLE_HISTORY_BLOCK_TIME_NUM_BYTES + (SAMPLE_HISTORY_NUM_VARIABLES * SAMPLE_HISTORY_RECORD_MAX_NUM_BYTES))
+
+typedef struct SampleHistoryBlock {
+    uint8_t bytes[CONFIG_SAMPLE_HISTORY_BLOCK_SIZE];
+    size_t num_bytes;
+} SampleHistoryBlock;
+
+/* Full blocks, oldest first */
+static SampleHistoryBlock blocks_buf[CONFIG_SAMPLE_HISTORY_NUM_BLOCKS];
+/* Used to pop blocks out of the ring buffer. Not on the stack, since it can get large. */
+static SampleHistoryBlock popped_block;
+
+/** Block that samples are currently recorded into. No block has been started if num_bytes is 0. */
+static SampleHistoryBlock current_block;
+/** Time of the last record in current_block */
+static EasTime current_block_last_record_time;
+/** Value of the last record of each variable in current_block. 0 if there are no records of that variable. */
+static int64_t current_block_values[SAMPLE_HISTORY_NUM_VARIABLES];
+
+/** Last recorded value of each variable, and the time at which it was recorded. Valid only if is_value_recorded is true
+ * for that variable. */
+static int64_t values[SAMPLE_HISTORY_NUM_VARIABLES];
+static EasTime value_times[SAMPLE_HISTORY_NUM_VARIABLES];
+static bool is_value_recorded[SAMPLE_HISTORY_NUM_VARIABLES];
+
+/** Smallest difference from the last recorded value of each variable that is recorded */
+static const int64_t min_changes[SAMPLE_HISTORY_NUM_VARIABLES] = {
+    [SAMPLE_HISTORY_VARIABLE_TEMPERATURE] = CONFIG_SAMPLE_HISTORY_TEMPERATURE_MIN_CHANGE,
+    [SAMPLE_HISTORY_VARIABLE_PRESSURE] = CONFIG_SAMPLE_HISTORY_PRESSURE_MIN_CHANGE,
+    [SAMPLE_HISTORY_VARIABLE_HUMIDITY] = CONFIG_SAMPLE_HISTORY_HUMIDITY_MIN_CHANGE,
+    [SAMPLE_HISTORY_VARIABLE_LIGHT_INTENSITY] = CONFIG_SAMPLE_HISTORY_LIGHT_INTENSITY_MIN_CHANGE,
+};
+
+static EasRingBuf get_ring_buf()
+{
+    static EasRingBuf ring_buf;
+    static bool is_created = false;
+    if (!is_created) {
+        ring_buf = eas_ring_buf_create(sizeof(SampleHistoryBlock), CONFIG_SAMPLE_HISTORY_NUM_BLOCKS, blocks_buf);
+        is_created = true;
+    }
+    return ring_buf;
+}
+
+/**
+ * @brief Encode an unsigned integer as a varint (LEB128).
+ *
+ * @param value Value to encode.
+ * @param[out] bytes The varint is written here.
+ *
+ * @return size_t Number of bytes written to @p bytes.
+ */
+static size_t encode_varint(uint64_t value, uint8_t *const bytes)
+{
+    size_t num_bytes = 0;
+    while (value >= 0x80) {
+        bytes[num_bytes++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    bytes[num_bytes++] = (uint8_t)value;
+    return num_bytes;
+}
+
+/**
+ * @brief Map a signed integer to an unsigned one, so that integers with small absolute values have small varints.
+ *
+ * 0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3, and so on.
+ */
+static uint64_t zigzag_encode(int64_t value)
+{
+    return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+/**
+ * @brief Encode a record relative to the last records of current_block.
+ *
+ * @param variable Variable of the sample.
+ * @param value Sample value.
+ * @param time Sample time.
+ * @param[out] record The record is written here. Must have space for SAMPLE_HISTORY_RECORD_MAX_NUM_BYTES bytes.
+ *
+ * @return size_t Number of bytes in the record.
+ */
+static size_t encode_record(SampleHistoryVariable variable, int64_t value, EasTime time, uint8_t *const record)
+{
+    /* EasTime wraps around, and the difference is still correct then */
+    EasTime elapsed_time = time - current_block_last_record_time;
+    uint64_t tag = ((uint64_t)elapsed_time << SAMPLE_HISTORY_VARIABLE_NUM_BITS) | (uint64_t)variable;
+    size_t num_bytes = encode_varint(tag, record);
+    num_bytes += encode_varint(zigzag_encode(value - current_block_values[variable]), &record[num_bytes]);
+    return num_bytes;
+}
+
+/**
+ * @brief Append a record to current_block.
+ *
+ * @param variable Variable of the sample.
+ * @param value Sample value.
+ * @param time Sample time.
+ *
+ * @return true The record was appended.
+ * @return false There is not enough space left in current_block for the record.
+ */
+static bool append_record(SampleHistoryVariable variable, int64_t value, EasTime time)
+{
+    uint8_t record[SAMPLE_HISTORY_RECORD_MAX_NUM_BYTES];
+    size_t num_bytes = encode_record(variable, value, time, record);
+    if (num_bytes > (CONFIG_SAMPLE_HISTORY_BLOCK_SIZE - current_block.num_bytes)) {
+        return false;
+    }
+    memcpy(&current_block.bytes[current_block.num_bytes], record, num_bytes);
+    current_block.num_bytes += num_bytes;
+    current_block_last_record_time = time;
+    current_block_values[variable] = value;
+    return true;
+}
+
+/**
+ * @brief Start a new current_block.
+ *
+ * Writes the block time and records for the last recorded values of all variables except @p variable.
+ *
+ * @param variable Variable of the sample that is recorded next. Its record is not written here.
+ * @param time Block time.
+ */
+static void start_block(SampleHistoryVariable variable, EasTime time)
+{
+    EAS_ASSERT(CONFIG_SAMPLE_HISTORY_BLOCK_SIZE >= SAMPLE_HISTORY_BLOCK_MIN_SIZE);
+
+    for (size_t i = 0; i < SAMPLE_HISTORY_BLOCK_TIME_NUM_BYTES; i++) {
+        current_block.bytes[i] = (uint8_t)(time >> (8 * i));
+    }
+    current_block.num_bytes = SAMPLE_HISTORY_BLOCK_TIME_NUM_BYTES;
+    current_block_last_record_time = time;
+    memset(current_block_values, 0, sizeof(current_block_values));
+
+    for (size_t i = 0; i < SAMPLE_HISTORY_NUM_VARIABLES; i++) {
+        if ((i != (size_t)variable) && is_value_recorded[i]) {
+            bool appended = append_record((SampleHistoryVariable)i, values[i], time);
+            EAS_ASSERT(appended);
+        }
+    }
+}
+
+/**
+ * @brief Move current_block to the ring buffer of full blocks.
+ *
+ * Discards the oldest block if the ring buffer is full.
+ */
+static void store_current_block()
+{
+    EasRingBuf ring_buf = get_ring_buf();
+    if (!eas_ring_buf_push(ring_buf, &current_block)) {
+        bool popped = eas_ring_buf_pop(ring_buf, &popped_block);
+        EAS_ASSERT(popped);
+        bool pushed = eas_ring_buf_push(ring_buf, &current_block);
+        EAS_ASSERT(pushed);
+    }
+    current_block.num_bytes = 0;
+}
+
+/**
+ * @brief Check whether a sample should be recorded.
+ *
+ * @param variable Variable of the sample.
+ * @param value Sample value.
+ * @param time Sample time.
+ *
+ * @return true No value of @p variable has been recorded yet, or @p value differs from the last recorded value by at
+ * least the minimum change of @p variable, and at least CONFIG_SAMPLE_HISTORY_MIN_INTERVAL_MS passed since it was
+ * recorded.
+ * @return false Otherwise.
+ */
+static bool is_recorded(SampleHistoryVariable variable, int64_t value, EasTime time)
+{
+    if (!is_value_recorded[variable]) {
+        return true;
+    }
+    int64_t change = (value > values[variable]) ? (value - values[variable]) : (values[variable] - value);
+    /* EasTime wraps around, and the difference is still correct then */
+    EasTime elapsed_time = time - value_times[variable];
+    return (change >= min_changes[variable]) && (elapsed_time >= CONFIG_SAMPLE_HISTORY_MIN_INTERVAL_MS);
+}
+
+/**
+ * @brief Record a sample, unless it is too close to the last recorded sample of the same variable.
+ *
+ * @param variable Variable of the sample.
+ * @param value Sample value.
+ */
+static void record(SampleHistoryVariable variable, int64_t value)
+{
+    EasTime time = eas_current_time_get();
+    if (!is_recorded(variable, value, time)) {
+        return;
+    }
+
+    if (current_block.num_bytes == 0) {
+        start_block(variable, time);
+    }
+    if (!append_record(variable, value, time)) {
+        store_current_block();
+        start_block(variable, time);
+        bool appended = append_record(variable, value, time);
+        EAS_ASSERT(appended);
+    }
+    values[variable] = value;
+    value_times[variable] = time;
+    is_value_recorded[variable] = true;
+}
+
+void sample_history_record_temperature(Temperature temperature)
+{
+    record(SAMPLE_HISTORY_VARIABLE_TEMPERATURE, temperature);
+}
+
+void sample_history_record_pressure(Pressure pressure)
+{
+    record(SAMPLE_HISTORY_VARIABLE_PRESSURE, pressure);
+}
+
+void sample_history_record_humidity(Humidity humidity)
+{
+    record(SAMPLE_HISTORY_VARIABLE_HUMIDITY, humidity);
+}
+
+void sample_history_record_light_intensity(LightIntensity light_intensity)
+{
+    record(SAMPLE_HISTORY_VARIABLE_LIGHT_INTENSITY, light_intensity);
+}
+
+bool sample_history_pop_block(uint8_t *const block, size_t *const num_bytes)
+{
+    EAS_ASSERT(block);
+    EAS_ASSERT(num_bytes);
+
+    const SampleHistoryBlock *source = NULL;
+    if (eas_ring_buf_pop(get_ring_buf(), &popped_block)) {
+        source = &popped_block;
+    } else if (current_block.num_bytes > 0) {
+        source = &current_block;
+    } else {
+        return false;
+    }
+    memcpy(block, source->bytes, source->num_bytes);
+    *num_bytes = source->num_bytes;
+    if (source == &current_block) {
+        /* The next recorded sample starts a new block */
+        current_block.num_bytes = 0;
+    }
+    return true;
+}
+
+void sample_history_clear()
+{
+    while (eas_ring_buf_pop(get_ring_buf(), &popped_block)) {
+    }
+    current_block.num_bytes = 0;
+    memset(is_value_recorded, 0, sizeof(is_value_recorded));
+}
@@ -0,0 +1,92 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_APP_SAMPLE_HISTORY_H
+#define ENV_ALERT_SYSTEM_SRC_APP_SAMPLE_HISTORY_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "temperature.h"
+#include "pressure.h"
+#include "humidity.h"
+#include "light_intensity.h"
+
+/**
+ * @brief Keeps a compressed history of recent samples of all variables.
+ *
+ * Samples are recorded into blocks of CONFIG_SAMPLE_HISTORY_BLOCK_SIZE bytes. A sample is only recorded if its value
+ * differs from the last recorded value of its variable by at least the minimum change of that variable, and
+ * CONFIG_SAMPLE_HISTORY_MIN_INTERVAL_MS has passed since that value was recorded. The value of a variable stays the
+ * same until the next record, so recorded values lag behind by at most the minimum change, except for changes within
+ * the minimum interval, which show up on the first sample after it. Full blocks are stored in a ring buffer of
+ * CONFIG_SAMPLE_HISTORY_NUM_BLOCKS blocks. When the ring buffer is full, the oldest block is discarded to make room for
+ * the new one.
+ *
+ * Each block can be decoded on its own:
+ * - Bytes 0-3: time of the first record in the block, EasTime in little endian.
+ * - Followed by records, one for each recorded sample. A record consists of two varints (LEB128):
+ *   - (time elapsed since the previous record in the block, in ms) << 2 | variable. Variable: 0 - temperature, 1 -
+ *     pressure, 2 - humidity, 3 - light intensity. For the first record, time elapsed since the block time.
+ *   - Zigzag-encoded difference between the value and the previous value of the same variable in the block. For the
+ *     first record of a variable in the block, the difference from 0.
+ *
+ * Each block starts with records for the current values of all variables that have been recorded before, so that the
+ * values of all variables are known from the start of the block.
+ */
+
+/**
+ * @brief Record a temperature sample.
+ *
+ * @param temperature Temperature sample. The sample is recorded at the current time.
+ */
+void sample_history_record_temperature(Temperature temperature);
+
+/**
+ * @brief Record a pressure sample.
+ *
+ * @param pressure Pressure sample. The sample is recorded at the current time.
+ */
+void sample_history_record_pressure(Pressure pressure);
+
+/**
+ * @brief Record a humidity sample.
+ *
+ * @param humidity Humidity sample. The sample is recorded at the current time.
+ */
+void sample_history_record_humidity(Humidity humidity);
+
+/**
+ * @brief Record a light intensity sample.
+ *
+ * @param light_intensity Light intensity sample. The sample is recorded at the current time.
+ */
+void sample_history_record_light_intensity(LightIntensity light_intensity);
+
+/**
+ * @brief Remove the oldest block from the sample history.
+ *
+ * Once all full blocks have been removed, the block that samples are currently recorded into is removed as well, even
+ * if it is not full yet. The next recorded sample then starts a new block.
+ *
+ * @param[out] block The block is written here. Must have space for CONFIG_SAMPLE_HISTORY_BLOCK_SIZE bytes.
+ * @param[out] num_bytes Number of bytes in the block is written here.
+ *
+ * @return true A block was removed and written to @p block.
+ * @return false Sample history is empty.
+ */
+bool sample_history_pop_block(uint8_t *const block, size_t *const num_bytes);
+
+/**
+ * @brief Discard all recorded samples.
+ */
+void sample_history_clear();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_APP_SAMPLE_HISTORY_H */
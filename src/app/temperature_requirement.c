@@ -15,6 +15,8 @@ typedef struct TemperatureRequirementStruct *TemperatureRequirement;
 struct TemperatureRequirementStruct {
     VariableRequirementStruct base;
     Temperature value;
+    /** Upper requirement value of a band requirement. Equal to value for all other requirements. */
+    Temperature upper_value;
 };
 
 EAS_STATIC_ASSERT(sizeof(struct TemperatureRequirementStruct) <= CONFIG_VARIABLE_REQUIREMENT_MAX_SIZE);
@@ -22,10 +24,14 @@ EAS_STATIC_ASSERT(sizeof(struct TemperatureRequirementStruct) <= CONFIG_VARIABLE
 // Forward declarations of interface functions to define the interface.
 static bool evaluate(VariableRequirement base);
 static void destroy(VariableRequirement base);
+static VariableRequirementThreshold get_threshold(VariableRequirement base);
+static VariableRequirementThreshold get_upper_threshold(VariableRequirement base);
 
 static VariableRequirementInterfaceStruct interface = {
     .evaluate = evaluate,
     .destroy = destroy,
+    .get_threshold = get_threshold,
+    .get_upper_threshold = get_upper_threshold,
 };
 
 /**
@@ -49,6 +55,12 @@ static bool evaluate(VariableRequirement base)
     case VARIABLE_REQUIREMENT_OPERATOR_LEQ:
         result = (current_temperature <= self->value);
         break;
+    case VARIABLE_REQUIREMENT_OPERATOR_INSIDE:
+        result = (current_temperature >= self->value) && (current_temperature <= self->upper_value);
+        break;
+    case VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE:
+        result = (current_temperature < self->value) || (current_temperature > self->upper_value);
+        break;
     default:
         /* Invalid operator */
         EAS_ASSERT(false);
@@ -68,12 +80,61 @@ static void destroy(VariableRequirement base)
     variable_requirement_allocator_free(base);
 }
 
-VariableRequirement temperature_requirement_create(uint8_t alert_id, uint8_t operator, Temperature value)
+/**
+ * @brief Get requirement value of a temperature variable requirement.
+ *
+ * @param base Temperature requirement instance returned by @ref temperature_requirement_create.
+ *
+ * @return VariableRequirementThreshold Requirement value passed to @ref temperature_requirement_create, or lower
+ * requirement value passed to @ref temperature_requirement_create_band.
+ */
+static VariableRequirementThreshold get_threshold(VariableRequirement base)
+{
+    TemperatureRequirement self = (TemperatureRequirement)base;
+    return (VariableRequirementThreshold)self->value;
+}
+
+/**
+ * @brief Get upper requirement value of a temperature band requirement.
+ *
+ * @param base Temperature requirement instance returned by @ref temperature_requirement_create_band.
+ *
+ * @return VariableRequirementThreshold Upper requirement value passed to @ref temperature_requirement_create_band.
+ */
+static VariableRequirementThreshold get_upper_threshold(VariableRequirement base)
 {
+    TemperatureRequirement self = (TemperatureRequirement)base;
+    return (VariableRequirementThreshold)self->upper_value;
+}
+
+VariableRequirement temperature_requirement_create(uint16_t alert_id, uint8_t operator, Temperature value)
+{
+    /* Band requirements have two requirement values */
+    bool is_band_operator = variable_requirement_is_band_operator(operator);
+    EAS_ASSERT(!is_band_operator);
+
     TemperatureRequirement self = variable_requirement_allocator_alloc();
     EAS_ASSERT(self);
     variable_requirement_create((VariableRequirement)self, &interface, operator, alert_id);
 
     self->value = value;
+    self->upper_value = value;
+    return (VariableRequirement)self;
+}
+
+VariableRequirement temperature_requirement_create_band(uint16_t alert_id, uint8_t operator, Temperature lower_value,
+                                                        Temperature upper_value)
+{
+    bool is_band_operator = variable_requirement_is_band_operator(operator);
+    EAS_ASSERT(is_band_operator);
+    bool is_valid_band = (lower_value < upper_value);
+    EAS_ASSERT(is_valid_band);
+
+    TemperatureRequirement self = variable_requirement_allocator_alloc();
+    EAS_ASSERT(self);
+    variable_requirement_create((VariableRequirement)self, &interface, operator, alert_id);
+
+    self->value = lower_value;
+    self->upper_value = upper_value;
     return (VariableRequirement)self;
 }
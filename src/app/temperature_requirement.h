@@ -24,13 +24,31 @@ extern "C"
  * requirement evaluates to true iff the current temperature is less than or equal to @p value.
  *
  * @param alert_id Alert id of the alert to which this temperature requirement belongs.
- * @param operator Use one of the values from @ref VariableRequirementOperator. Variable requirement operator to use
- * when evaluating the requirement.
+ * @param operator VARIABLE_REQUIREMENT_OPERATOR_GEQ or VARIABLE_REQUIREMENT_OPERATOR_LEQ. Variable requirement operator
+ * to use when evaluating the requirement. Band requirements are created by @ref temperature_requirement_create_band.
  * @param value Temperature requirement value.
  *
  * @return VariableRequirement Created instance of temperature requirement.
  */
-VariableRequirement temperature_requirement_create(uint8_t alert_id, uint8_t operator, Temperature value);
+VariableRequirement temperature_requirement_create(uint16_t alert_id, uint8_t operator, Temperature value);
+
+/**
+ * @brief Create a temperature band requirement instance.
+ *
+ * If operator is VARIABLE_REQUIREMENT_OPERATOR_INSIDE, the variable requirement evaluates to true iff the current
+ * temperature is greater than or equal to @p lower_value and less than or equal to @p upper_value. If the operator is
+ * VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE, the variable requirement evaluates to true iff the current temperature is less
+ * than @p lower_value or greater than @p upper_value.
+ *
+ * @param alert_id Alert id of the alert to which this temperature requirement belongs.
+ * @param operator VARIABLE_REQUIREMENT_OPERATOR_INSIDE or VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE.
+ * @param lower_value Lower temperature requirement value.
+ * @param upper_value Upper temperature requirement value. Must be greater than @p lower_value.
+ *
+ * @return VariableRequirement Created instance of temperature requirement.
+ */
+VariableRequirement temperature_requirement_create_band(uint16_t alert_id, uint8_t operator, Temperature lower_value,
+                                                        Temperature upper_value);
 
 #ifdef __cplusplus
 }
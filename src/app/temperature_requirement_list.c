@@ -24,7 +24,23 @@ void temperature_requirement_list_for_each(VariableRequirementListForEachCb cb)
     variable_requirement_list_for_each(get_instance(), cb);
 }
 
-void temperature_requirement_list_remove_all_for_alert(uint8_t alert_id)
+void temperature_requirement_list_evaluate(Temperature value, VariableRequirementListResultChangedCb cb)
+{
+    variable_requirement_list_evaluate(get_instance(), value, cb);
+}
+
+void temperature_requirement_list_evaluate_in_range(Temperature previous_value, Temperature value,
+                                                    VariableRequirementListResultChangedCb cb)
+{
+    variable_requirement_list_evaluate_in_range(get_instance(), previous_value, value, cb);
+}
+
+VariableRequirementThreshold temperature_requirement_list_get_distance_to_nearest(Temperature value)
+{
+    return variable_requirement_list_get_distance_to_nearest(get_instance(), value);
+}
+
+void temperature_requirement_list_remove_all_for_alert(uint16_t alert_id)
 {
     variable_requirement_list_remove_all_for_alert(get_instance(), alert_id);
 }
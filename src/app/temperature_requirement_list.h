@@ -8,6 +8,7 @@ extern "C"
 
 #include <stdint.h>
 
+#include "temperature.h"
 #include "variable_requirement_list_defs.h"
 
 /**
@@ -31,12 +32,47 @@ void temperature_requirement_list_add(VariableRequirement temperature_requiremen
  */
 void temperature_requirement_list_for_each(VariableRequirementListForEachCb cb);
 
+/**
+ * @brief Evaluate all temperature requirements for a temperature value.
+ *
+ * @param value Current temperature value.
+ * @param cb Callback to execute for each temperature requirement whose result changed, see @ref
+ * variable_requirement_list_evaluate.
+ *
+ * @note Fires an assert if @p cb is NULL.
+ */
+void temperature_requirement_list_evaluate(Temperature value, VariableRequirementListResultChangedCb cb);
+
+/**
+ * @brief Evaluate the temperature requirements whose results could have been changed by a temperature change.
+ *
+ * Only the temperature requirements with requirement values between @p previous_value and @p value are evaluated.
+ *
+ * @param previous_value Previous temperature value.
+ * @param value Current temperature value.
+ * @param cb Callback to execute for each temperature requirement whose result changed, see @ref
+ * variable_requirement_list_evaluate_in_range.
+ *
+ * @note Fires an assert if @p cb is NULL.
+ */
+void temperature_requirement_list_evaluate_in_range(Temperature previous_value, Temperature value,
+                                                    VariableRequirementListResultChangedCb cb);
+
+/**
+ * @brief Get the distance from a temperature value to the nearest requirement value of a temperature requirement.
+ *
+ * @param value Current temperature value.
+ *
+ * @return VariableRequirementThreshold Distance, see @ref variable_requirement_list_get_distance_to_nearest.
+ */
+VariableRequirementThreshold temperature_requirement_list_get_distance_to_nearest(Temperature value);
+
 /**
  * @brief Remove all temperature requirements from the list that belong to a specific alert.
  *
  * @param alert_id All temperature requirements that belong to the alert with this id are removed from the list.
  */
-void temperature_requirement_list_remove_all_for_alert(uint8_t alert_id);
+void temperature_requirement_list_remove_all_for_alert(uint16_t alert_id);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,340 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "utils/timer_wheel.h"
+#include "utils/eas_time.h"
+#include "eas_timer.h"
+#include "eas_current_time.h"
+#include "config.h"
+#include "eas_assert.h"
+
+#ifndef CONFIG_TIMER_WHEEL_MAX_NUM_TIMERS
+#define CONFIG_TIMER_WHEEL_MAX_NUM_TIMERS 1
+#endif
+
+#ifndef CONFIG_TIMER_WHEEL_NUM_SLOTS
+#define CONFIG_TIMER_WHEEL_NUM_SLOTS 1
+#endif
+
+#ifndef CONFIG_TIMER_WHEEL_TICK_MS
+#define CONFIG_TIMER_WHEEL_TICK_MS 100
+#endif
+
+struct TimerWheelTimerStruct {
+    uint32_t period_ms;
+    TimerWheelTimerCb cb;
+    void *user_data;
+    /* Fields below are only valid while the timer is running */
+    EasTime deadline;
+    size_t slot;
+    struct TimerWheelTimerStruct *next;
+    struct TimerWheelTimerStruct *prev;
+    bool is_running;
+};
+
+static struct TimerWheelTimerStruct instances[CONFIG_TIMER_WHEEL_MAX_NUM_TIMERS];
+static size_t instance_idx = 0;
+
+/** Each slot is a doubly linked list of running timers. A timer is placed into the slot that is processed on the first
+ * tick after its deadline. Timers with deadlines more than one wheel revolution away share slots with timers from
+ * earlier revolutions, so expiry is always decided by comparing the deadline to the current time. */
+static TimerWheelTimer slots[CONFIG_TIMER_WHEEL_NUM_SLOTS];
+/** Slot that was processed on the last tick. */
+static size_t current_slot = 0;
+/** Time at which current_slot was due to be processed. */
+static EasTime current_slot_time = 0;
+/** Time at which the tick timer expires next. Only valid while timers are running. */
+static EasTime next_tick_time = 0;
+static size_t num_running_timers = 0;
+/** True while tick_timer_cb processes slots. The tick timer is scheduled once all expired timers are processed. */
+static bool is_processing_slots = false;
+
+static void tick_timer_cb(void *user_data);
+
+/**
+ * @brief Get tick timer instance. The tick timer is a one-shot timer that advances the wheel on the first tick on which
+ * a running timer expires.
+ *
+ * @return EasTimer Timer instance.
+ */
+static EasTimer get_tick_timer_instance()
+{
+    static EasTimer instance;
+    static bool is_created = false;
+    if (!is_created) {
+        instance = eas_timer_create(CONFIG_TIMER_WHEEL_TICK_MS, EAS_TIMER_ONE_SHOT, tick_timer_cb, NULL);
+        is_created = true;
+    }
+    return instance;
+}
+
+/**
+ * @brief Compute number of ticks from current slot time until a deadline, rounded up.
+ *
+ * Rounding up ensures that the slot the timer is placed into is not processed before the deadline.
+ *
+ * @param deadline Deadline that is after current slot time.
+ *
+ * @return size_t Number of ticks, at least 1.
+ */
+static size_t get_num_ticks_until(EasTime deadline)
+{
+    EasTime ms_until_deadline = deadline - current_slot_time;
+    size_t num_ticks = (ms_until_deadline / CONFIG_TIMER_WHEEL_TICK_MS) +
+                       (((ms_until_deadline % CONFIG_TIMER_WHEEL_TICK_MS) != 0) ? 1 : 0);
+    return (num_ticks > 0) ? num_ticks : 1;
+}
+
+/**
+ * @brief Start the tick timer so that it expires on a tick.
+ *
+ * @param num_ticks Number of ticks from current slot time until the tick on which the tick timer should expire.
+ */
+static void schedule_tick(size_t num_ticks)
+{
+    EasTime tick_time = eas_time_offset_into_future(current_slot_time, num_ticks * CONFIG_TIMER_WHEEL_TICK_MS);
+    /* The tick is always in the future. After slots are processed, current slot time is less than a tick in the past.
+     * When a timer is started, its tick is at or after its deadline. */
+    uint32_t period_ms = tick_time - eas_current_time_get();
+
+    EasTimer tick_timer = get_tick_timer_instance();
+    /* The period of a running timer must not be changed */
+    eas_timer_stop(tick_timer);
+    eas_timer_set_period(tick_timer, period_ms);
+    eas_timer_start(tick_timer);
+    next_tick_time = tick_time;
+}
+
+/**
+ * @brief Compute number of ticks from current slot time until the first tick on which a running timer expires.
+ *
+ * Slots are searched in the order in which they are processed, so the search usually ends at the first non-empty slot.
+ * Only if no timer expires during the next revolution of the wheel, the earliest deadline of all timers is used.
+ *
+ * @return size_t Number of ticks, at least 1. Must only be called while timers are running.
+ */
+static size_t get_num_ticks_until_next_expiry()
+{
+    EasTime earliest_deadline = 0;
+    bool is_earliest_deadline_found = false;
+    for (size_t i = 1; i <= CONFIG_TIMER_WHEEL_NUM_SLOTS; i++) {
+        size_t slot = (current_slot + i) % CONFIG_TIMER_WHEEL_NUM_SLOTS;
+        EasTime slot_time = eas_time_offset_into_future(current_slot_time, i * CONFIG_TIMER_WHEEL_TICK_MS);
+        for (TimerWheelTimer timer = slots[slot]; timer != NULL; timer = timer->next) {
+            if (eas_time_is_equal_or_after(slot_time, timer->deadline)) {
+                /* Expires when this slot is processed */
+                return i;
+            }
+            if (!is_earliest_deadline_found || !eas_time_is_equal_or_after(timer->deadline, earliest_deadline)) {
+                earliest_deadline = timer->deadline;
+                is_earliest_deadline_found = true;
+            }
+        }
+    }
+    /* All timers expire in later revolutions */
+    return get_num_ticks_until(earliest_deadline);
+}
+
+/**
+ * @brief Place a timer into the slot that is processed on the first tick at or after its deadline.
+ *
+ * @param timer Timer with deadline set.
+ */
+static void insert_into_slot(TimerWheelTimer timer)
+{
+    size_t num_ticks = get_num_ticks_until(timer->deadline);
+    size_t slot = (current_slot + (num_ticks % CONFIG_TIMER_WHEEL_NUM_SLOTS)) % CONFIG_TIMER_WHEEL_NUM_SLOTS;
+
+    timer->slot = slot;
+    timer->prev = NULL;
+    timer->next = slots[slot];
+    if (slots[slot]) {
+        slots[slot]->prev = timer;
+    }
+    slots[slot] = timer;
+}
+
+/**
+ * @brief Unlink a timer from the slot it is placed into.
+ *
+ * @param timer Timer that is placed into a slot.
+ */
+static void remove_from_slot(TimerWheelTimer timer)
+{
+    if (timer->prev) {
+        timer->prev->next = timer->next;
+    } else {
+        slots[timer->slot] = timer->next;
+    }
+    if (timer->next) {
+        timer->next->prev = timer->prev;
+    }
+    timer->next = NULL;
+    timer->prev = NULL;
+}
+
+/**
+ * @brief Remove a running timer from the wheel.
+ *
+ * @param timer Running timer.
+ * @param stop_tick_timer_if_idle If true, the tick timer is stopped if this was the last running timer.
+ */
+static void remove_running_timer(TimerWheelTimer timer, bool stop_tick_timer_if_idle)
+{
+    remove_from_slot(timer);
+    timer->is_running = false;
+    num_running_timers--;
+    if (stop_tick_timer_if_idle && (num_running_timers == 0)) {
+        eas_timer_stop(get_tick_timer_instance());
+    }
+}
+
+/**
+ * @brief Find a timer in a slot whose deadline has passed.
+ *
+ * @param slot Slot index.
+ * @param current_time Current time.
+ *
+ * @return TimerWheelTimer Expired timer, or NULL if no timer in the slot has expired.
+ */
+static TimerWheelTimer find_expired_timer(size_t slot, EasTime current_time)
+{
+    for (TimerWheelTimer timer = slots[slot]; timer != NULL; timer = timer->next) {
+        if (eas_time_is_equal_or_after(current_time, timer->deadline)) {
+            return timer;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Execute callbacks of all expired timers in a slot.
+ *
+ * Callbacks are allowed to start and stop timers, so the slot is searched again after every callback.
+ *
+ * @param slot Slot index.
+ * @param current_time Current time.
+ */
+static void process_slot(size_t slot, EasTime current_time)
+{
+    TimerWheelTimer timer = find_expired_timer(slot, current_time);
+    while (timer) {
+        remove_running_timer(timer, false);
+        timer->cb(timer->user_data);
+        timer = find_expired_timer(slot, current_time);
+    }
+}
+
+/**
+ * @brief Tick timer callback. Advances the wheel, executes callbacks of all expired timers, and schedules the tick on
+ * which the next timer expires.
+ *
+ * @param user_data User data, unused.
+ */
+static void tick_timer_cb(void *user_data)
+{
+    /* The tick timer callback can still get executed after the tick timer has been stopped or restarted. Ticks are only
+     * relevant while timers are running, and an early tick only schedules the next tick again. */
+    if (num_running_timers == 0) {
+        return;
+    }
+
+    /* Ticks can be processed late, or not at all, if the system is busy. Advance the wheel by all ticks that elapsed
+     * since the last processed one. Processing more than one revolution worth of slots is never necessary, since every
+     * slot is visited during one revolution. */
+    EasTime current_time = eas_current_time_get();
+    size_t num_elapsed_ticks = (current_time - current_slot_time) / CONFIG_TIMER_WHEEL_TICK_MS;
+    size_t num_slots_to_process =
+        (num_elapsed_ticks < CONFIG_TIMER_WHEEL_NUM_SLOTS) ? num_elapsed_ticks : CONFIG_TIMER_WHEEL_NUM_SLOTS;
+
+    /* Advance the wheel before executing callbacks, so that timers started from the callbacks are placed relative to
+     * the current time. */
+    current_slot = (current_slot + (num_elapsed_ticks % CONFIG_TIMER_WHEEL_NUM_SLOTS)) % CONFIG_TIMER_WHEEL_NUM_SLOTS;
+    current_slot_time = eas_time_offset_into_future(current_slot_time, num_elapsed_ticks * CONFIG_TIMER_WHEEL_TICK_MS);
+
+    /* Process slots in the order in which they became due, ending with the current slot */
+    size_t first_slot_to_process =
+        (current_slot + CONFIG_TIMER_WHEEL_NUM_SLOTS + 1 - num_slots_to_process) % CONFIG_TIMER_WHEEL_NUM_SLOTS;
+    is_processing_slots = true;
+    for (size_t i = 0; i < num_slots_to_process; i++) {
+        process_slot((first_slot_to_process + i) % CONFIG_TIMER_WHEEL_NUM_SLOTS, current_time);
+    }
+    is_processing_slots = false;
+
+    /* The tick timer is a one-shot timer, so it is not running anymore unless a callback stopped the last timer */
+    if (num_running_timers > 0) {
+        schedule_tick(get_num_ticks_until_next_expiry());
+    }
+}
+
+TimerWheelTimer timer_wheel_timer_create(uint32_t period_ms, TimerWheelTimerCb cb, void *user_data)
+{
+    /* The only way to notify the caller about timer expiry is via cb, so it does not make sense to create a timer
+     * without a defined cb. */
+    EAS_ASSERT(cb);
+
+    EAS_ASSERT(instance_idx < CONFIG_TIMER_WHEEL_MAX_NUM_TIMERS);
+    struct TimerWheelTimerStruct *instance = &instances[instance_idx];
+    instance_idx++;
+
+    instance->period_ms = period_ms;
+    instance->cb = cb;
+    instance->user_data = user_data;
+    instance->deadline = 0;
+    instance->slot = 0;
+    instance->next = NULL;
+    instance->prev = NULL;
+    instance->is_running = false;
+    return instance;
+}
+
+void timer_wheel_timer_set_period(TimerWheelTimer self, uint32_t period_ms)
+{
+    EAS_ASSERT(self);
+
+    self->period_ms = period_ms;
+}
+
+void timer_wheel_timer_start(TimerWheelTimer self)
+{
+    EAS_ASSERT(self);
+    EAS_ASSERT(self->period_ms > 0);
+
+    if (self->is_running) {
+        /* Restarting. The tick timer is not stopped, since this timer is started again right away. */
+        remove_running_timer(self, false);
+    }
+
+    EasTime current_time = eas_current_time_get();
+    bool is_idle = (num_running_timers == 0) && !is_processing_slots;
+    if (is_idle) {
+        /* No tick is scheduled. Ticks are counted from now. */
+        current_slot_time = current_time;
+    }
+
+    self->deadline = eas_time_offset_into_future(current_time, self->period_ms);
+    insert_into_slot(self);
+    self->is_running = true;
+    num_running_timers++;
+
+    if (is_processing_slots) {
+        /* The tick is scheduled once all expired timers are processed */
+        return;
+    }
+    size_t num_ticks = get_num_ticks_until(self->deadline);
+    EasTime tick_time = eas_time_offset_into_future(current_slot_time, num_ticks * CONFIG_TIMER_WHEEL_TICK_MS);
+    if (is_idle || !eas_time_is_equal_or_after(tick_time, next_tick_time)) {
+        /* This timer expires before the scheduled tick */
+        schedule_tick(num_ticks);
+    }
+}
+
+void timer_wheel_timer_stop(TimerWheelTimer self)
+{
+    EAS_ASSERT(self);
+
+    if (self->is_running) {
+        remove_running_timer(self, true);
+    }
+}
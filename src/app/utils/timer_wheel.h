@@ -0,0 +1,92 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_APP_UTILS_TIMER_WHEEL_H
+#define ENV_ALERT_SYSTEM_SRC_APP_UTILS_TIMER_WHEEL_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+/**
+ * @brief Multiplexes many one-shot timers onto a single one-shot EasTimer.
+ *
+ * Timer wheel timers are stored in a hashed timer wheel: an array of CONFIG_TIMER_WHEEL_NUM_SLOTS slots, where each
+ * slot is a list of timers. Slots are processed on ticks, which are CONFIG_TIMER_WHEEL_TICK_MS apart. Only the timers
+ * in the processed slots are checked for expiry, regardless of how many timers are running.
+ *
+ * The EasTimer does not expire on every tick. It is started for the first tick on which a running timer expires, so
+ * ticks with nothing to expire cost nothing, and a timer with a long period costs a single EasTimer expiry. The
+ * EasTimer only runs while at least one timer wheel timer is running.
+ *
+ * A timer never expires before its period elapses. It expires within one tick after its period elapses, as long as
+ * ticks are processed on time. Periods that are not a multiple of the tick are effectively rounded up to the next tick.
+ *
+ * Timer callbacks are executed from the tick EasTimer callback, in the same context as every other EasTimer callback.
+ * Once a timer is stopped, its callback is never executed for the stopped run.
+ *
+ * Usage:
+ * @code
+ * TimerWheelTimer timer = timer_wheel_timer_create(1000, timer_cb, NULL);
+ * timer_wheel_timer_start(timer);
+ * // timer_cb is executed after 1000 ms, unless timer_wheel_timer_stop(timer) is called before that
+ * @endcode
+ */
+
+typedef struct TimerWheelTimerStruct *TimerWheelTimer;
+
+/**
+ * @brief Timer wheel timer expiry callback.
+ *
+ * @param user_data User data passed to @ref timer_wheel_timer_create.
+ */
+typedef void (*TimerWheelTimerCb)(void *user_data);
+
+/**
+ * @brief Create a one-shot timer wheel timer.
+ *
+ * @param period_ms Timer period in ms. Can be set to 0 here, but must be set to a value > 0 using
+ * @ref timer_wheel_timer_set_period before the timer is started.
+ * @param cb Callback to execute when the timer expires. Must not be NULL.
+ * @param user_data User data to pass to @p cb.
+ *
+ * @return TimerWheelTimer Created timer instance.
+ */
+TimerWheelTimer timer_wheel_timer_create(uint32_t period_ms, TimerWheelTimerCb cb, void *user_data);
+
+/**
+ * @brief Set timer period.
+ *
+ * If the timer is running, the new period takes effect the next time the timer is started.
+ *
+ * @param self Timer instance returned by @ref timer_wheel_timer_create.
+ * @param period_ms New period in ms.
+ */
+void timer_wheel_timer_set_period(TimerWheelTimer self, uint32_t period_ms);
+
+/**
+ * @brief Start timer.
+ *
+ * The timer expires once the period elapses from the time this function is called. If the timer is already running, it
+ * is restarted.
+ *
+ * The period must be > 0 and must not exceed 2147483647 ms, see @ref eas_time_is_equal_or_after.
+ *
+ * @param self Timer instance returned by @ref timer_wheel_timer_create.
+ */
+void timer_wheel_timer_start(TimerWheelTimer self);
+
+/**
+ * @brief Stop timer.
+ *
+ * Does nothing if the timer is not running.
+ *
+ * @param self Timer instance returned by @ref timer_wheel_timer_create.
+ */
+void timer_wheel_timer_stop(TimerWheelTimer self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_APP_UTILS_TIMER_WHEEL_H */
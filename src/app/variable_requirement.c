@@ -17,13 +17,16 @@ static bool is_valid_operator(uint8_t operator)
 }
 
 void variable_requirement_create(VariableRequirement self, VariableRequirementInterfaceStruct *vtable, uint8_t operator,
-                                 uint8_t alert_id)
+                                 uint16_t alert_id)
 {
     EAS_ASSERT(self);
     EAS_ASSERT(vtable);
     EAS_ASSERT(vtable->evaluate);
     EAS_ASSERT(vtable->destroy);
+    EAS_ASSERT(vtable->get_threshold);
     EAS_ASSERT(is_valid_operator(operator));
+    bool has_upper_threshold = (!variable_requirement_is_band_operator(operator) || vtable->get_upper_threshold);
+    EAS_ASSERT(has_upper_threshold);
 
     self->vtable = vtable;
     self->operator = operator;
@@ -65,12 +68,43 @@ bool variable_requirement_is_result_changed(VariableRequirement self)
     return self->is_result_changed;
 }
 
-uint8_t variable_requirement_get_alert_id(VariableRequirement self)
+uint16_t variable_requirement_get_alert_id(VariableRequirement self)
 {
     EAS_ASSERT(self);
     return self->alert_id;
 }
 
+uint8_t variable_requirement_get_operator(VariableRequirement self)
+{
+    EAS_ASSERT(self);
+    return self->operator;
+}
+
+VariableRequirementThreshold variable_requirement_get_threshold(VariableRequirement self)
+{
+    EAS_ASSERT(self);
+    EAS_ASSERT(self->vtable);
+    EAS_ASSERT(self->vtable->get_threshold);
+    return self->vtable->get_threshold(self);
+}
+
+VariableRequirementThreshold variable_requirement_get_upper_threshold(VariableRequirement self)
+{
+    EAS_ASSERT(self);
+    if (!variable_requirement_is_band_operator(self->operator)) {
+        return variable_requirement_get_threshold(self);
+    }
+    EAS_ASSERT(self->vtable);
+    EAS_ASSERT(self->vtable->get_upper_threshold);
+    return self->vtable->get_upper_threshold(self);
+}
+
+bool variable_requirement_is_band_operator(uint8_t requirement_operator)
+{
+    return (requirement_operator == VARIABLE_REQUIREMENT_OPERATOR_INSIDE) ||
+           (requirement_operator == VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE);
+}
+
 void variable_requirement_destroy(VariableRequirement self)
 {
     EAS_ASSERT(self);
@@ -17,6 +17,10 @@ typedef enum VariableRequirementOperator {
     VARIABLE_REQUIREMENT_OPERATOR_GEQ,
     /// Less than or equal to.
     VARIABLE_REQUIREMENT_OPERATOR_LEQ,
+    /// Greater than or equal to the lower requirement value, and less than or equal to the upper requirement value.
+    VARIABLE_REQUIREMENT_OPERATOR_INSIDE,
+    /// Less than the lower requirement value, or greater than the upper requirement value.
+    VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE,
 
     /// Invalid operator - do not use.
     VARIABLE_REQUIREMENT_OPERATOR_INVALID,
@@ -30,6 +34,11 @@ typedef enum VariableRequirementOperator {
  * An example variable requirement is "temperature >= 25". This requirement would evaluate to true if current
  * temperature value >= 25. If the current temperature value is < 25, this requirement would evaluate to false.
  *
+ * Band requirements use the VARIABLE_REQUIREMENT_OPERATOR_INSIDE or VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE operator, and
+ * have two requirement values - a lower and an upper one. For example, "temperature inside [18, 24]" evaluates to true
+ * if 18 <= current temperature value <= 24. One band requirement replaces two requirements, such as "temperature >= 18"
+ * and "temperature <= 24" in the same ORed requirement of an alert condition.
+ *
  * Subclasses of this class represent variable requirements of specific variables - e.g. temperature, pressure, etc.
  * This class represents a generic variable requirement - it does not know which specific variable the requirement is
  * about. Subclasses implement their own evaluate() function - that function is called in the implementation of @ref
@@ -67,7 +76,7 @@ typedef enum VariableRequirementOperator {
  * bool is_result_changed = variable_requirement_is_result_changed(temperature_requirement);
  *
  * // Get alert id
- * uint8_t alert_id = variable_requirement_get_alert_id(temperature_requirement);
+ * uint16_t alert_id = variable_requirement_get_alert_id(temperature_requirement);
  *
  * // Destroy variable requirement
  * variable_requirement_destroy(temperature_requirement);
@@ -75,14 +84,17 @@ typedef enum VariableRequirementOperator {
  *
  * # How to create a subclass
  *
- * 1. Define a evaluate() function, a destroy() function, and define an interface (vtable) that contains a pointer to
- * these functions. This vtable will be passed as an argument to the variable_requirement_create() call which happens
- * inside the create() function of the subclass.
+ * 1. Define a evaluate() function, a destroy() function, a get_threshold() function, and define an interface (vtable)
+ * that contains a pointer to these functions. This vtable will be passed as an argument to the
+ * variable_requirement_create() call which happens inside the create() function of the subclass.
  * ```
  * static bool evaluate(VariableRequirement base);
+ * static void destroy(VariableRequirement base);
+ * static VariableRequirementThreshold get_threshold(VariableRequirement base);
  * static VariableRequirementInterfaceStruct interface = {
  *     .evaluate = evaluate,
  *     .destroy = destroy,
+ *     .get_threshold = get_threshold,
  * };
  *
  * static bool evaluate(VariableRequirement base)
@@ -94,11 +106,23 @@ typedef enum VariableRequirementOperator {
  * {
  *     // destroy() implementation of the subclass
  * }
+ *
+ * static VariableRequirementThreshold get_threshold(VariableRequirement base)
+ * {
+ *     // Return the requirement value, converted to VariableRequirementThreshold
+ * }
  * ```
  *
  * The destroy() function should free the memory that is allocated during a call to the create() function of the
  * subclass. See step 4.1 below for more details.
  *
+ * The get_threshold() function should return the requirement value. Variable requirement lists use it to keep the
+ * requirements ordered by their requirement values.
+ *
+ * Subclasses that support band requirements also define a get_upper_threshold() function that returns the upper
+ * requirement value, and set it in the vtable. get_threshold() returns the lower requirement value of a band
+ * requirement.
+ *
  * 2. Define the subclass struct. The purpose of this struct is to hold all of the private members defined in
  * VariableRequirementStruct, as well as the requirement value. Example struct definition:
  * ```
@@ -129,7 +153,7 @@ typedef enum VariableRequirementOperator {
  *
  * Example create() function of the subclass:
  * ```
- * VariableRequirement my_requirement_create(uint8_t alert_id, uint8_t operator, MyValueType requirement_value)
+ * VariableRequirement my_requirement_create(uint16_t alert_id, uint8_t operator, MyValueType requirement_value)
  * {
  *     MyRequirement self = variable_requirement_allocator_alloc();
  *     variable_requirement_create((VariableRequirement)self, &interface, operator, alert_id);
@@ -174,7 +198,57 @@ bool variable_requirement_is_result_changed(VariableRequirement self);
  *
  * @return uint8_t Alert id.
  */
-uint8_t variable_requirement_get_alert_id(VariableRequirement self);
+uint16_t variable_requirement_get_alert_id(VariableRequirement self);
+
+/**
+ * @brief Get operator of this variable requirement.
+ *
+ * @param self Variable requirement instance returned by the create() function of one of the subclasses of
+ * VariableRequirement.
+ *
+ * @return uint8_t One of the values from @ref VariableRequirementOperator.
+ */
+uint8_t variable_requirement_get_operator(VariableRequirement self);
+
+/**
+ * @brief Get requirement value of this variable requirement.
+ *
+ * For the requirement "temperature >= 25", this function returns 25. The requirement value is the boundary at which
+ * the evaluation result of the requirement can change - the result can only change if the variable value moves across
+ * the requirement value.
+ *
+ * For band requirements, this function returns the lower requirement value.
+ *
+ * @param self Variable requirement instance returned by the create() function of one of the subclasses of
+ * VariableRequirement.
+ *
+ * @return VariableRequirementThreshold Requirement value, converted to VariableRequirementThreshold.
+ */
+VariableRequirementThreshold variable_requirement_get_threshold(VariableRequirement self);
+
+/**
+ * @brief Get upper requirement value of this variable requirement.
+ *
+ * For the band requirement "temperature inside [18, 24]", this function returns 24. For requirements that are not band
+ * requirements, this function returns the same value as @ref variable_requirement_get_threshold.
+ *
+ * @param self Variable requirement instance returned by the create() function of one of the subclasses of
+ * VariableRequirement.
+ *
+ * @return VariableRequirementThreshold Upper requirement value, converted to VariableRequirementThreshold.
+ */
+VariableRequirementThreshold variable_requirement_get_upper_threshold(VariableRequirement self);
+
+/**
+ * @brief Check whether a variable requirement operator is a band operator.
+ *
+ * @param requirement_operator Use one of the values from @ref VariableRequirementOperator.
+ *
+ * @return true @p requirement_operator is VARIABLE_REQUIREMENT_OPERATOR_INSIDE or
+ * VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE.
+ * @return false Otherwise.
+ */
+bool variable_requirement_is_band_operator(uint8_t requirement_operator);
 
 /**
  * @brief Destroy variable requirement.
@@ -6,6 +6,8 @@ extern "C"
 {
 #endif
 
+#include <stdint.h>
+
 /**
  * @brief Variable requirement public definitions.
  *
@@ -18,6 +20,17 @@ extern "C"
 
 typedef struct VariableRequirementStruct *VariableRequirement;
 
+/**
+ * @brief Requirement value of a variable requirement, widened to a type that can represent the requirement values of
+ * all variables.
+ *
+ * Variables use different data types for their values - e.g. Temperature is int16_t, while LightIntensity is uint32_t.
+ * Every one of them can be converted to int64_t without changing its value or its ordering relative to other values of
+ * the same variable. This allows generic modules, such as variable_requirement_list, to order variable requirements by
+ * their requirement values without knowing which variable they belong to.
+ */
+typedef int64_t VariableRequirementThreshold;
+
 #ifdef __cplusplus
 }
 #endif
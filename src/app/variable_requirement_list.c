@@ -1,8 +1,10 @@
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <string.h>
 
 #include "variable_requirement_list.h"
 #include "variable_requirement.h"
-#include "utils/linked_list.h"
 #include "config.h"
 #include "eas_assert.h"
 
@@ -10,49 +12,261 @@
 #define CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_INSTANCES 1
 #endif
 
+#ifndef CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_REQUIREMENTS
+#define CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_REQUIREMENTS 1
+#endif
+
+/** Result of a requirement that has not been evaluated by the list yet. */
+#define RESULT_NONE 0
+/** Result of a requirement whose latest evaluation by the list returned false. */
+#define RESULT_FALSE 1
+/** Result of a requirement whose latest evaluation by the list returned true. */
+#define RESULT_TRUE 2
+
+#define THRESHOLD_MIN INT64_MIN
+#define THRESHOLD_MAX INT64_MAX
+
+/**
+ * @brief Requirement value as stored in the list.
+ *
+ * Narrower than VariableRequirementThreshold to save memory. Requirement values of all variables fit into it -
+ * LightIntensity is the only variable with 32-bit values, and its requirement values are far below INT32_MAX.
+ */
+typedef int32_t StoredThreshold;
+
+/**
+ * @brief Variable requirements, sorted in ascending order of their requirement values.
+ *
+ * Keeping the requirements sorted allows @ref variable_requirement_list_evaluate_in_range to find the requirements in
+ * range using binary search, and then only evaluate the requirements in range. Requirements with equal requirement
+ * values are kept in the order in which they were added.
+ *
+ * The list is stored as a struct of arrays. Element i of every array belongs to the same requirement. Requirement
+ * values, operators and alert ids are copied from the requirement when it is added - they never change during the
+ * lifetime of a requirement. Searching and evaluating only touches these arrays, so that the requirements are evaluated
+ * in a tight loop over contiguous memory. The requirement instances still hold the same fields, so the copies cost 7
+ * bytes per entry on top of the pointer to the requirement.
+ *
+ * A band requirement (@ref VARIABLE_REQUIREMENT_OPERATOR_INSIDE or @ref VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE) takes
+ * two entries, one at its lower and one at its upper requirement value, because its result can change when the value
+ * crosses either of them. Both entries point to the same requirement and always hold the same result.
+ *
+ * The list also keeps the quiet range of the value of its latest evaluation - the range of values that contains no
+ * requirement values. A value change that stays within the quiet range cannot change the result of any requirement, so
+ * sensor noise around a value does not cost a search through the list. The quiet range is always exact - a change that
+ * crosses a requirement value always leaves it.
+ */
 typedef struct VariableRequirementListStruct {
-    LinkedList linked_list;
+    VariableRequirement requirements[CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_REQUIREMENTS];
+    StoredThreshold thresholds[CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_REQUIREMENTS];
+    /** Uses values from @ref VariableRequirementOperator, defined as uint8_t to save memory. */
+    uint8_t operators[CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_REQUIREMENTS];
+    uint16_t alert_ids[CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_REQUIREMENTS];
+    /** Result of the latest evaluation by the list - RESULT_NONE, RESULT_FALSE or RESULT_TRUE. */
+    uint8_t results[CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_REQUIREMENTS];
+    size_t num_requirements;
+    /** Inclusive bounds of the quiet range. Valid only if is_quiet_range_valid is true. */
+    VariableRequirementThreshold quiet_range_low;
+    VariableRequirementThreshold quiet_range_high;
+    bool is_quiet_range_valid;
 } VariableRequirementListStruct;
 
 static struct VariableRequirementListStruct instances[CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_INSTANCES];
 static size_t instance_idx = 0;
 
 /**
- * @brief Callback to be passed to linked_list_for_each.
+ * @brief Check whether the list is full.
  *
- * Executes a callback for each variable requirement.
+ * @param self Variable requirement list instance.
  *
- * @param element linked_list_remove_on_condition passes the current list element to this parameter. In our case, it is
- * the VariableRequirement instance.
- * @param user_data Function pointer to a callback to execute for each variable requirement.
+ * @return true The list already contains the maximum number of requirements, no more requirements can be added.
+ * @return false More requirements can be added to the list.
  */
-static void linked_list_for_each_cb(void *element, void *user_data)
+static bool is_full(VariableRequirementList self)
 {
-    VariableRequirementListForEachCb cb = (VariableRequirementListForEachCb)user_data;
-    VariableRequirement variable_requirement = (VariableRequirement)element;
-    EAS_ASSERT(cb);
+    return (self->num_requirements >= CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_REQUIREMENTS);
+}
 
-    cb(variable_requirement);
+/**
+ * @brief Find index of the first requirement in the list that has requirement value above or equal to a threshold.
+ *
+ * @param self Variable requirement list instance.
+ * @param threshold Threshold to compare requirement values against.
+ * @param include_equal If true, requirements with requirement value equal to @p threshold are treated as being above
+ * the threshold - the index of the first requirement with requirement value >= @p threshold is returned. If false, the
+ * index of the first requirement with requirement value > @p threshold is returned.
+ *
+ * @return size_t Index of the first requirement that satisfies the condition. If there is no such requirement, the
+ * number of requirements in the list is returned.
+ */
+static size_t find_first_above(VariableRequirementList self, VariableRequirementThreshold threshold, bool include_equal)
+{
+    size_t low = 0;
+    size_t high = self->num_requirements;
+    while (low < high) {
+        size_t mid = low + ((high - low) / 2);
+        VariableRequirementThreshold mid_threshold = (VariableRequirementThreshold)self->thresholds[mid];
+        bool is_above = include_equal ? (mid_threshold >= threshold) : (mid_threshold > threshold);
+        if (is_above) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return low;
 }
 
 /**
- * @brief Callback to be passed to linked_list_remove_on_condition.
+ * @brief Move requirements to make room for a new requirement, or to close the gap after removed requirements.
  *
- * @param element linked_list_remove_on_condition passes the current list element to this parameter. In our case, it is
- * the VariableRequirement instance.
- * @param user_data Pointer to alert id - for all variable requirements with this alert id, this function needs to
- * return true.
+ * @param self Variable requirement list instance.
+ * @param dst_idx Index to move the requirements to.
+ * @param src_idx Index of the first requirement to move.
+ * @param num Number of requirements to move.
+ */
+static void move_requirements(VariableRequirementList self, size_t dst_idx, size_t src_idx, size_t num)
+{
+    memmove(&self->requirements[dst_idx], &self->requirements[src_idx], num * sizeof(self->requirements[0]));
+    memmove(&self->thresholds[dst_idx], &self->thresholds[src_idx], num * sizeof(self->thresholds[0]));
+    memmove(&self->operators[dst_idx], &self->operators[src_idx], num * sizeof(self->operators[0]));
+    memmove(&self->alert_ids[dst_idx], &self->alert_ids[src_idx], num * sizeof(self->alert_ids[0]));
+    memmove(&self->results[dst_idx], &self->results[src_idx], num * sizeof(self->results[0]));
+}
+
+/**
+ * @brief Check whether an entry is the upper entry of a band requirement.
+ *
+ * @param self Variable requirement list instance.
+ * @param idx Index of the entry.
  *
- * @return true @p element has alert id equal to alert id passed as @p user_data.
- * @return false @p element has alert id that is NOT equal to alert id passed as @p user_data.
+ * @return true The entry is the entry at the upper requirement value of a band requirement.
+ * @return false Otherwise.
  */
-static bool requirement_has_alert_id(void *element, void *user_data)
+static bool is_upper_band_entry(VariableRequirementList self, size_t idx)
 {
-    VariableRequirement variable_requirement = (VariableRequirement)element;
-    uint8_t *alert_id = (uint8_t *)user_data;
-    EAS_ASSERT(alert_id);
+    return variable_requirement_is_band_operator(self->operators[idx]) &&
+           (self->thresholds[idx] != variable_requirement_get_threshold(self->requirements[idx]));
+}
 
-    return (variable_requirement_get_alert_id(variable_requirement) == (*alert_id));
+/**
+ * @brief Find the other entry of a band requirement.
+ *
+ * @param self Variable requirement list instance.
+ * @param idx Index of one of the two entries of a band requirement.
+ *
+ * @return size_t Index of the entry at the other requirement value of the same band requirement.
+ */
+static size_t find_other_band_entry(VariableRequirementList self, size_t idx)
+{
+    VariableRequirement requirement = self->requirements[idx];
+    VariableRequirementThreshold other_threshold = is_upper_band_entry(self, idx)
+                                                       ? variable_requirement_get_threshold(requirement)
+                                                       : variable_requirement_get_upper_threshold(requirement);
+    /* Entries with equal requirement values are next to each other */
+    size_t other_idx = find_first_above(self, other_threshold, true);
+    while ((other_idx < self->num_requirements) && (self->requirements[other_idx] != requirement)) {
+        other_idx++;
+    }
+    bool is_other_entry_found = (other_idx < self->num_requirements);
+    EAS_ASSERT(is_other_entry_found);
+    return other_idx;
+}
+
+/**
+ * @brief Evaluate a band requirement.
+ *
+ * @param requirement Band requirement.
+ * @param operator @ref VARIABLE_REQUIREMENT_OPERATOR_INSIDE or @ref VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE.
+ * @param value Current value of the variable.
+ *
+ * @return bool Result of the band requirement for @p value.
+ */
+static bool evaluate_band(VariableRequirement requirement, uint8_t operator, VariableRequirementThreshold value)
+{
+    bool is_inside = (value >= variable_requirement_get_threshold(requirement)) &&
+                     (value <= variable_requirement_get_upper_threshold(requirement));
+    return (operator == VARIABLE_REQUIREMENT_OPERATOR_INSIDE) ? is_inside : !is_inside;
+}
+
+/**
+ * @brief Evaluate the requirements at indices [begin, end) and execute a callback for the ones whose result changed.
+ *
+ * GEQ and LEQ requirements are evaluated from the arrays of the list only. Band requirements need both requirement
+ * values, so they are evaluated from the requirement instance. When the result of a band requirement changes, the
+ * result stored in its other entry is updated as well, so that the callback is executed once per change.
+ *
+ * @param self Variable requirement list instance.
+ * @param begin Index of the first requirement to evaluate.
+ * @param end Index one past the last requirement to evaluate.
+ * @param value Current value of the variable.
+ * @param cb Callback to execute for each requirement whose result changed.
+ */
+static void evaluate_requirements(VariableRequirementList self, size_t begin, size_t end,
+                                  VariableRequirementThreshold value, VariableRequirementListResultChangedCb cb)
+{
+    for (size_t i = begin; i < end; i++) {
+        uint8_t operator = self->operators[i];
+        /* Operators of requirements are always valid, so every other operator is a band operator */
+        bool is_band =
+            (operator != VARIABLE_REQUIREMENT_OPERATOR_GEQ) && (operator != VARIABLE_REQUIREMENT_OPERATOR_LEQ);
+        bool result;
+        if (is_band) {
+            result = evaluate_band(self->requirements[i], operator, value);
+        } else {
+            /* Both comparisons are computed and combined with bitwise operators, so that selecting the comparison by
+             * the operator does not branch */
+            bool is_geq = (operator == VARIABLE_REQUIREMENT_OPERATOR_GEQ);
+            VariableRequirementThreshold threshold = (VariableRequirementThreshold)self->thresholds[i];
+            result = (is_geq & (value >= threshold)) | (!is_geq & (value <= threshold));
+        }
+        uint8_t new_result = result ? RESULT_TRUE : RESULT_FALSE;
+        if (new_result != self->results[i]) {
+            self->results[i] = new_result;
+            if (is_band) {
+                self->results[find_other_band_entry(self, i)] = new_result;
+            }
+            cb(self->requirements[i], self->alert_ids[i], result);
+        }
+    }
+}
+
+/**
+ * @brief Set the quiet range to the largest range of values around a value that contains no requirement values.
+ *
+ * If @p value is equal to a requirement value, the quiet range only contains @p value.
+ *
+ * @param self Variable requirement list instance.
+ * @param value Value of the latest evaluation.
+ */
+static void update_quiet_range(VariableRequirementList self, VariableRequirementThreshold value)
+{
+    size_t idx = find_first_above(self, value, true);
+    bool is_value_in_list = (idx < self->num_requirements) && (self->thresholds[idx] == value);
+    if (is_value_in_list) {
+        self->quiet_range_low = value;
+        self->quiet_range_high = value;
+    } else {
+        /* thresholds[idx - 1] < value < thresholds[idx], so neither bound can overflow */
+        self->quiet_range_low =
+            (idx > 0) ? ((VariableRequirementThreshold)self->thresholds[idx - 1] + 1) : THRESHOLD_MIN;
+        self->quiet_range_high =
+            (idx < self->num_requirements) ? ((VariableRequirementThreshold)self->thresholds[idx] - 1) : THRESHOLD_MAX;
+    }
+    self->is_quiet_range_valid = true;
+}
+
+/**
+ * @brief Check whether a value is within the quiet range.
+ *
+ * @param self Variable requirement list instance.
+ * @param value Value to check.
+ *
+ * @return true The quiet range is valid and contains @p value.
+ * @return false Otherwise.
+ */
+static bool is_in_quiet_range(VariableRequirementList self, VariableRequirementThreshold value)
+{
+    return self->is_quiet_range_valid && (value >= self->quiet_range_low) && (value <= self->quiet_range_high);
 }
 
 VariableRequirementList variable_requirement_list_create()
@@ -61,25 +275,124 @@ VariableRequirementList variable_requirement_list_create()
     struct VariableRequirementListStruct *instance = &instances[instance_idx];
     instance_idx++;
 
-    instance->linked_list = linked_list_create();
+    instance->num_requirements = 0;
+    instance->is_quiet_range_valid = false;
     return instance;
 }
 
+/**
+ * @brief Insert an entry for a requirement, keeping the list sorted.
+ *
+ * @param self Variable requirement list instance. Must not be full.
+ * @param variable_requirement Variable requirement.
+ * @param threshold Requirement value at which to insert the entry.
+ */
+static void insert_entry(VariableRequirementList self, VariableRequirement variable_requirement,
+                         VariableRequirementThreshold threshold)
+{
+    bool is_threshold_storable = (threshold >= INT32_MIN) && (threshold <= INT32_MAX);
+    EAS_ASSERT(is_threshold_storable);
+
+    /* Insert after all requirements with requirement value <= the new requirement value. */
+    size_t idx = find_first_above(self, threshold, false);
+    move_requirements(self, idx + 1, idx, self->num_requirements - idx);
+    self->requirements[idx] = variable_requirement;
+    self->thresholds[idx] = (StoredThreshold)threshold;
+    self->operators[idx] = variable_requirement_get_operator(variable_requirement);
+    self->alert_ids[idx] = variable_requirement_get_alert_id(variable_requirement);
+    self->results[idx] = RESULT_NONE;
+    self->num_requirements++;
+}
+
 void variable_requirement_list_add(VariableRequirementList self, VariableRequirement variable_requirement)
 {
     EAS_ASSERT(self);
-    linked_list_prepend(self->linked_list, variable_requirement);
+    EAS_ASSERT(variable_requirement);
+    EAS_ASSERT(!is_full(self));
+
+    bool is_band = variable_requirement_is_band_operator(variable_requirement_get_operator(variable_requirement));
+    if (is_band) {
+        bool has_room_for_upper_entry =
+            ((self->num_requirements + 1) < CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_REQUIREMENTS);
+        EAS_ASSERT(has_room_for_upper_entry);
+    }
+
+    insert_entry(self, variable_requirement, variable_requirement_get_threshold(variable_requirement));
+    if (is_band) {
+        insert_entry(self, variable_requirement, variable_requirement_get_upper_threshold(variable_requirement));
+    }
+    /* The new requirement value might be within the quiet range */
+    self->is_quiet_range_valid = false;
 }
 
 void variable_requirement_list_for_each(VariableRequirementList self, VariableRequirementListForEachCb cb)
 {
     EAS_ASSERT(self);
     EAS_ASSERT(cb);
-    linked_list_for_each(self->linked_list, linked_list_for_each_cb, cb);
+    for (size_t i = 0; i < self->num_requirements; i++) {
+        /* Band requirements are visited at their lower entry only */
+        if (!is_upper_band_entry(self, i)) {
+            cb(self->requirements[i]);
+        }
+    }
+}
+
+void variable_requirement_list_evaluate(VariableRequirementList self, VariableRequirementThreshold value,
+                                        VariableRequirementListResultChangedCb cb)
+{
+    EAS_ASSERT(self);
+    EAS_ASSERT(cb);
+    evaluate_requirements(self, 0, self->num_requirements, value, cb);
+    update_quiet_range(self, value);
+}
+
+void variable_requirement_list_evaluate_in_range(VariableRequirementList self,
+                                                 VariableRequirementThreshold previous_value,
+                                                 VariableRequirementThreshold value,
+                                                 VariableRequirementListResultChangedCb cb)
+{
+    EAS_ASSERT(self);
+    EAS_ASSERT(cb);
+    if (is_in_quiet_range(self, previous_value) && is_in_quiet_range(self, value)) {
+        /* There are no requirement values between previous_value and value */
+        return;
+    }
+    VariableRequirementThreshold low = (previous_value < value) ? previous_value : value;
+    VariableRequirementThreshold high = (previous_value < value) ? value : previous_value;
+
+    size_t begin = find_first_above(self, low, true);
+    size_t end = find_first_above(self, high, false);
+    evaluate_requirements(self, begin, end, value, cb);
+    update_quiet_range(self, value);
+}
+
+VariableRequirementThreshold variable_requirement_list_get_distance_to_nearest(VariableRequirementList self,
+                                                                               VariableRequirementThreshold value)
+{
+    EAS_ASSERT(self);
+    VariableRequirementThreshold distance = THRESHOLD_MAX;
+    size_t idx = find_first_above(self, value, true);
+    if (idx < self->num_requirements) {
+        distance = self->thresholds[idx] - value;
+    }
+    if ((idx > 0) && ((value - self->thresholds[idx - 1]) < distance)) {
+        distance = value - self->thresholds[idx - 1];
+    }
+    return distance;
 }
 
-void variable_requirement_list_remove_all_for_alert(VariableRequirementList self, uint8_t alert_id)
+void variable_requirement_list_remove_all_for_alert(VariableRequirementList self, uint16_t alert_id)
 {
     EAS_ASSERT(self);
-    linked_list_remove_on_condition(self->linked_list, requirement_has_alert_id, &alert_id);
+    /* Compact the array in place. Relative order of the remaining requirements does not change, so the list stays
+     * sorted. */
+    size_t num_kept = 0;
+    for (size_t i = 0; i < self->num_requirements; i++) {
+        if (self->alert_ids[i] != alert_id) {
+            move_requirements(self, num_kept, i, 1);
+            num_kept++;
+        }
+    }
+    self->num_requirements = num_kept;
+    /* Removing requirement values can only widen the quiet range, so it stays valid */
 }
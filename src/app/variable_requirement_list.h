@@ -13,6 +13,25 @@ extern "C"
 
 /**
  * @brief Variable requirement list.
+ *
+ * Requirements in the list are kept ordered by their requirement values (see @ref variable_requirement_get_threshold).
+ * The result of a variable requirement can only change when the variable value moves across its requirement value.
+ * When the variable value changes from A to B, @ref variable_requirement_list_evaluate_in_range only evaluates the
+ * requirements with requirement values between A and B, instead of evaluating every requirement in the list.
+ *
+ * The list is a packed table: the requirement value, operator and alert id of every requirement are copied into
+ * contiguous arrays when the requirement is added, next to the latest result of the requirement. This allows @ref
+ * variable_requirement_list_evaluate and @ref variable_requirement_list_evaluate_in_range to evaluate requirements in a
+ * tight loop over these arrays, without accessing the variable requirement instances. The instances are only passed to
+ * the callbacks.
+ *
+ * The copies trade memory for speed. The instances keep their own requirement value, operator and alert id, and every
+ * entry of the list takes another 12 bytes on 32-bit targets, so the list does not save memory compared to a list of
+ * pointers to the instances.
+ *
+ * A band requirement takes two entries of the list, one at each of its two requirement values. It is evaluated from
+ * its instance, because its result depends on both requirement values, and the result changed callback is still
+ * executed once for every change of its result.
  */
 typedef struct VariableRequirementListStruct *VariableRequirementList;
 
@@ -28,6 +47,9 @@ VariableRequirementList variable_requirement_list_create();
  *
  * @param self Variable requirement list instance returned by @ref variable_requirement_list_create.
  * @param variable_requirement Variable requirement to add to the list.
+ *
+ * @note Fires an assert if the list has no room for the requirement. Every requirement takes one of the
+ * CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_REQUIREMENTS entries of the list, band requirements take two.
  */
 void variable_requirement_list_add(VariableRequirementList self, VariableRequirement variable_requirement);
 
@@ -42,13 +64,70 @@ void variable_requirement_list_add(VariableRequirementList self, VariableRequire
  */
 void variable_requirement_list_for_each(VariableRequirementList self, VariableRequirementListForEachCb cb);
 
+/**
+ * @brief Evaluate all variable requirements in the list for a variable value.
+ *
+ * The result of every requirement is compared to the result of its previous evaluation by the list. @p cb is only
+ * executed for the requirements whose result changed, and for the requirements that are evaluated by the list for the
+ * first time.
+ *
+ * @param self Variable requirement list instance returned by @ref variable_requirement_list_create.
+ * @param value Current value of the variable, converted to VariableRequirementThreshold.
+ * @param cb Callback to execute for each variable requirement whose result changed.
+ *
+ * @note Fires an assert if @p cb is NULL.
+ */
+void variable_requirement_list_evaluate(VariableRequirementList self, VariableRequirementThreshold value,
+                                        VariableRequirementListResultChangedCb cb);
+
+/**
+ * @brief Evaluate the variable requirements whose requirement values lie between the previous and the current variable
+ * value.
+ *
+ * Same as @ref variable_requirement_list_evaluate, but only the requirements whose requirement values lie between
+ * @p previous_value and @p value are evaluated. Both bounds are inclusive, and they can be passed in any order. The
+ * results of all other requirements could not have changed because of this value change. A band requirement is
+ * evaluated if either of its requirement values is in range, and @p cb is executed at most once for it.
+ *
+ * Finding the requirements in range takes O(log n), where n is the number of requirements in the list.
+ *
+ * If there are no requirement values between @p previous_value and the value of the latest evaluation, and between
+ * @p value and the value of the latest evaluation, returns without searching the list. This makes sensor noise around
+ * a value cheap, while every change that crosses a requirement value is still evaluated.
+ *
+ * @param self Variable requirement list instance returned by @ref variable_requirement_list_create.
+ * @param previous_value Previous value of the variable, converted to VariableRequirementThreshold.
+ * @param value Current value of the variable, converted to VariableRequirementThreshold.
+ * @param cb Callback to execute for each variable requirement whose result changed.
+ *
+ * @note Fires an assert if @p cb is NULL.
+ */
+void variable_requirement_list_evaluate_in_range(VariableRequirementList self,
+                                                 VariableRequirementThreshold previous_value,
+                                                 VariableRequirementThreshold value,
+                                                 VariableRequirementListResultChangedCb cb);
+
+/**
+ * @brief Get the distance from a value to the nearest requirement value in the list.
+ *
+ * No requirement result can change before the variable value has moved by at least this distance.
+ *
+ * @param self Variable requirement list instance returned by @ref variable_requirement_list_create.
+ * @param value Value of the variable, converted to VariableRequirementThreshold.
+ *
+ * @return VariableRequirementThreshold Smallest absolute difference between @p value and a requirement value in the
+ * list. INT64_MAX if the list is empty.
+ */
+VariableRequirementThreshold variable_requirement_list_get_distance_to_nearest(VariableRequirementList self,
+                                                                               VariableRequirementThreshold value);
+
 /**
  * @brief Remove all variable requirements from the list that belong to a specific alert.
  *
  * @param self Variable requirement list instance returned by @ref variable_requirement_list_create.
  * @param alert_id All variable requirements that belong to this alert are removed from the list.
  */
-void variable_requirement_list_remove_all_for_alert(VariableRequirementList self, uint8_t alert_id);
+void variable_requirement_list_remove_all_for_alert(VariableRequirementList self, uint16_t alert_id);
 
 #ifdef __cplusplus
 }
@@ -6,13 +6,16 @@ extern "C"
 {
 #endif
 
+#include <stdbool.h>
+#include <stdint.h>
+
 #include "variable_requirement_defs.h"
 
 /**
  * @brief Variable requirement list public definitions.
  *
- * The for each callback definition present here so that wrapper modules for one instance of VariableRequirementList,
- * such as TemperatureRequirementList, could use this definition as well in their public API.
+ * The callback definitions are present here so that wrapper modules for one instance of VariableRequirementList,
+ * such as TemperatureRequirementList, could use these definitions as well in their public API.
  *
  * This is a separate header so that the wrapper modules do not have to include the whole variable_requirement_list.h
  * file in their public .h file.
@@ -27,6 +30,20 @@ extern "C"
  */
 typedef void (*VariableRequirementListForEachCb)(VariableRequirement variable_requirement);
 
+/**
+ * @brief Defines callback type to execute for each variable requirement whose result changed during evaluation.
+ *
+ * @ref variable_requirement_list_evaluate and @ref variable_requirement_list_evaluate_in_range execute this callback
+ * for each evaluated variable requirement whose result is different from the result of its previous evaluation by the
+ * list, or that has been evaluated by the list for the first time.
+ *
+ * @param variable_requirement Variable requirement instance whose result changed.
+ * @param alert_id Alert id of the alert to which @p variable_requirement belongs.
+ * @param result New result of @p variable_requirement.
+ */
+typedef void (*VariableRequirementListResultChangedCb)(VariableRequirement variable_requirement, uint16_t alert_id,
+                                                       bool result);
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,15 +14,20 @@ extern "C"
 typedef struct VariableRequirementInterfaceStruct {
     bool (*evaluate)(VariableRequirement);
     void (*destroy)(VariableRequirement);
+    VariableRequirementThreshold (*get_threshold)(VariableRequirement);
+    /** Only required for band requirements, can be NULL if the subclass does not create band requirements. */
+    VariableRequirementThreshold (*get_upper_threshold)(VariableRequirement);
 } VariableRequirementInterfaceStruct;
 
 typedef struct VariableRequirementStruct {
     VariableRequirementInterfaceStruct *vtable;
     uint8_t operator; /**! Uses values from @ref VariableRequirementOperator, defined as uint8_t to save memory. */
-    uint8_t alert_id;
-    bool evaluate_has_been_called;
-    bool is_result_changed;
-    bool previous_evaluation_result;
+    /* Flags are bit-fields that share one byte with each other, so that the whole struct takes 8 bytes on 32-bit
+     * targets. Every variable requirement instance is one allocator block, so this is paid once per requirement. */
+    bool evaluate_has_been_called : 1;
+    bool is_result_changed : 1;
+    bool previous_evaluation_result : 1;
+    uint16_t alert_id;
 } VariableRequirementStruct;
 
 /**
@@ -45,7 +50,7 @@ typedef struct VariableRequirementStruct {
  * @param alert_id Alert id - identifies alert that this variable requirement is a part of.
  */
 void variable_requirement_create(VariableRequirement self, VariableRequirementInterfaceStruct *vtable, uint8_t operator,
-                                 uint8_t alert_id);
+                                 uint16_t alert_id);
 
 #ifdef __cplusplus
 }
@@ -6,6 +6,8 @@ extern "C"
 {
 #endif
 
+#include <stdint.h>
+
 #include "humidity.h"
 
 /**
@@ -39,6 +41,16 @@ typedef struct {
      * This function must only be called once. If this function is called for the second time, an assert is raised.
      */
     void (*start)();
+
+    /**
+     * @brief Set the time between two consecutive humidity samples.
+     *
+     * Can be called before or after @ref start. If the sensor is already started, the next sample is generated @p
+     * period_ms ms after this call.
+     *
+     * @param period_ms Readout period in ms. Must not be 0.
+     */
+    void (*set_readout_period)(uint32_t period_ms);
 } HumiditySensor;
 
 #ifdef __cplusplus
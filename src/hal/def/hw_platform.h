@@ -11,6 +11,7 @@ extern "C"
 #include "pressure_sensor.h"
 #include "humidity_sensor.h"
 #include "light_intensity_sensor.h"
+#include "multi_sample.h"
 #include "transceiver.h"
 
 /**
@@ -81,6 +82,22 @@ const HumiditySensor *const hw_platform_get_humidity_sensor();
  */
 const LightIntensitySensor *const hw_platform_get_light_intensity_sensor();
 
+/**
+ * @brief Register a callback to execute whenever samples of several variables are read out together.
+ *
+ * Sensors that read out several variables in one transaction report their samples through this callback instead of
+ * through the new sample callbacks of the individual sensor interfaces, as long as one is registered. All other
+ * samples are still reported through the new sample callbacks of the individual sensor interfaces.
+ *
+ * The implementation is allowed to execute the callback from any context, the same way as new sample callbacks of the
+ * individual sensor interfaces. The implementation can ignore the callback if none of its sensors measures more than
+ * one variable.
+ *
+ * @param cb Callback to register.
+ * @param user_data User data to pass to the callback when invoked.
+ */
+void hw_platform_register_new_multi_sample_cb(MultiSampleNewSampleCb cb, void *user_data);
+
 /**
  * @brief Get transceiver instance from hardware platform.
  *
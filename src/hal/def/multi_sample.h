@@ -0,0 +1,51 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_HAL_DEF_MULTI_SAMPLE_H
+#define ENV_ALERT_SYSTEM_SRC_HAL_DEF_MULTI_SAMPLE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+#include "temperature.h"
+#include "pressure.h"
+#include "humidity.h"
+#include "light_intensity.h"
+
+/** Bits of MultiSample.variables, one for every variable. */
+#define MULTI_SAMPLE_TEMPERATURE ((uint8_t)1 << 0)
+#define MULTI_SAMPLE_PRESSURE ((uint8_t)1 << 1)
+#define MULTI_SAMPLE_HUMIDITY ((uint8_t)1 << 2)
+#define MULTI_SAMPLE_LIGHT_INTENSITY ((uint8_t)1 << 3)
+
+/**
+ * @brief Samples of several variables that were read out together.
+ *
+ * Sensors that measure more than one variable, such as SHT31 that measures temperature and humidity, read out all of
+ * them in one transaction. Reporting the samples together lets the application handle them as one update of the
+ * environment, instead of as several updates where only some of the variables have their new values.
+ */
+typedef struct MultiSample {
+    /** Bitmask of MULTI_SAMPLE_<variable> bits of the variables that have a sample. Samples of the other variables are
+     * not valid. */
+    uint8_t variables;
+    Temperature temperature;
+    Pressure pressure;
+    Humidity humidity;
+    LightIntensity light_intensity;
+} MultiSample;
+
+/**
+ * @brief Callback type definition to execute when new samples of several variables become available.
+ *
+ * @param multi_sample Samples. Only valid during the callback execution.
+ * @param user_data User data.
+ */
+typedef void (*MultiSampleNewSampleCb)(const MultiSample *const multi_sample, void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_HAL_DEF_MULTI_SAMPLE_H */
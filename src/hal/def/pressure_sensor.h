@@ -6,6 +6,8 @@ extern "C"
 {
 #endif
 
+#include <stdint.h>
+
 #include "pressure.h"
 
 /**
@@ -37,6 +39,16 @@ typedef struct PressureSensor {
      * If new sample callback is registered, it will start being invoked whenever a new sample becomes generated.
      */
     void (*start)();
+
+    /**
+     * @brief Set the time between two consecutive pressure samples.
+     *
+     * Can be called before or after @ref start. If the sensor is already started, the next sample is generated @p
+     * period_ms ms after this call.
+     *
+     * @param period_ms Readout period in ms. Must not be 0.
+     */
+    void (*set_readout_period)(uint32_t period_ms);
 } PressureSensor;
 
 #ifdef __cplusplus
@@ -6,6 +6,8 @@ extern "C"
 {
 #endif
 
+#include <stdint.h>
+
 #include "temperature.h"
 
 /**
@@ -39,6 +41,16 @@ typedef struct TemperatureSensor {
      * This function must only be called once. If this function is called for the second time, an assert is raised.
      */
     void (*start)();
+
+    /**
+     * @brief Set the time between two consecutive temperature samples.
+     *
+     * Can be called before or after @ref start. If the sensor is already started, the next sample is generated @p
+     * period_ms ms after this call.
+     *
+     * @param period_ms Readout period in ms. Must not be 0.
+     */
+    void (*set_readout_period)(uint32_t period_ms);
 } TemperatureSensor;
 
 #ifdef __cplusplus
@@ -32,7 +32,7 @@ void bh1750_driver_i2c_read(uint8_t *data, size_t length, uint8_t i2c_addr, void
     i2c_op.twim_xfer_desc.p_primary_buf = data;
     i2c_op.twim_xfer_desc.p_secondary_buf = NULL;
 
-    ops_queue_add_op(*i2c_queue_p, &i2c_op);
+    ops_queue_add_op_with_priority(*i2c_queue_p, &i2c_op, I2C_OP_PRIORITY_READ);
 }
 
 void bh1750_driver_i2c_write(uint8_t *data, size_t length, uint8_t i2c_addr, void *user_data, BH1750_I2CCompleteCb cb,
@@ -64,7 +64,7 @@ void bh1750_driver_i2c_write(uint8_t *data, size_t length, uint8_t i2c_addr, voi
     i2c_op.twim_xfer_desc.p_primary_buf = write_buf;
     i2c_op.twim_xfer_desc.p_secondary_buf = NULL;
 
-    ops_queue_add_op(*i2c_queue_p, &i2c_op);
+    ops_queue_add_op_with_priority(*i2c_queue_p, &i2c_op, I2C_OP_PRIORITY_WRITE);
 }
 
 void bh1750_driver_timer_start(uint32_t duration_ms, void *user_data, BH1750TimerExpiredCb cb, void *cb_user_data)
@@ -38,6 +38,7 @@
 #include "bmp280/interface.h"
 #include "eas_log.h"
 #include "ops_queue.h"
+#include "init_graph.h"
 #include "eass.h"
 
 EAS_LOG_ENABLE_IN_FILE();
@@ -508,168 +509,172 @@ static void init_nrfx_twim()
     nrfx_twim_enable(&twim_inst);
 }
 
-static void hw_platform_init_part_12(void *user_data)
-{
-    bt_conn_cb_register(&connection_callbacks);
-    submit_start_advertising_event();
-
-    SHT31VirtualInterfaces sht31_interfaces = virtual_sht31_initialize(&sht3x_inst);
-    temperature_sensor = sht31_interfaces.temperature_sensor;
-    humidity_sensor = sht31_interfaces.humidity_sensor;
-
-    BMP280VirtualInterfaces bmp280_interfaces = virtual_bmp280_initialize(&bmp280_inst);
-    pressure_sensor = bmp280_interfaces.pressure_sensor;
-
-    BH1750VirtualInterfaces bh1750_interfaces = virtual_bh1750_initialize(&bh1750_inst);
-    light_intensity_sensor = bh1750_interfaces.light_intensity_sensor;
+/**
+ * @brief Hardware platform init steps.
+ *
+ * Steps of the same device depend on each other. Steps of different devices do not, so SHT31 and BH1750 (I2C - the
+ * I2C queue interleaves their transactions), BMP280 (SPI), and Bluetooth are initialized at the same time. Virtual
+ * devices are initialized last, once all devices are ready.
+ */
+typedef enum {
+    INIT_STEP_SENSOR_POWER_ON,
+    INIT_STEP_SHT31_RESET,
+    INIT_STEP_BH1750_INIT,
+    INIT_STEP_BH1750_SET_MEAS_TIME,
+    INIT_STEP_BMP280_GET_CHIP_ID,
+    INIT_STEP_BMP280_RESET,
+    INIT_STEP_BMP280_INIT_MEAS,
+    INIT_STEP_BMP280_SET_FILTER_COEFFICIENT,
+    INIT_STEP_BMP280_SET_SPI_3_WIRE_INTERFACE,
+    INIT_STEP_BMP280_SET_TEMP_OVERSAMPLING,
+    INIT_STEP_BMP280_SET_PRES_OVERSAMPLING,
+    INIT_STEP_BT_ENABLE,
+    INIT_STEP_INIT_VIRTUAL_DEVICES,
+    INIT_NUM_STEPS,
+} InitStep;
 
-    Nrf52840LedVirtualInterfaces nrf_led_interfaces = virtual_led_nrf52840_initialize(&zephyr_pwms);
-    led = nrf_led_interfaces.led;
+/** Init steps are passed to driver callbacks as user data, see sht3x/bh1750/bmp280_init_step_complete */
+#define INIT_STEP_USER_DATA(step) ((void *)(uintptr_t)(step))
 
-    NrfBleTransceiverVirtualInterfaces ble_interfaces = virtual_transceiver_nrf_ble_initialize();
-    transceiver = ble_interfaces.transceiver;
-
-    execute_hw_init_complete_cb(HW_PLATFORM_INIT_SUCCESS);
-    EAS_LOG_INF("Hw platform init complete");
-}
+static InitGraph init_graph;
 
-static void init_part_11_complete(int err)
+static void handle_init_step_success(uint8_t step)
 {
-    if (err == 0) {
-        central_event_queue_submit_void_cb_with_user_data_event(hw_platform_init_part_12, NULL);
-    } else {
-        EAS_LOG_INF("Failed to enable Bluetooth");
-        execute_hw_init_complete_cb(HW_PLATFORM_INIT_FAILURE);
-    }
+    init_graph_step_complete(init_graph, step, true);
 }
 
-static void hw_platform_init_part_11(void *user_data)
+static void handle_init_step_failure(uint8_t step)
 {
-    int err = bt_enable(init_part_11_complete);
-    if (err) {
-        EAS_LOG_INF("Bluetooth init failed (err %d)", err);
-        execute_hw_init_complete_cb(HW_PLATFORM_INIT_FAILURE);
-        return;
-    }
+    init_graph_step_complete(init_graph, step, false);
 }
 
-static void init_part_10_complete(uint8_t rc, void *user_data)
+/**
+ * @brief Report the result of an init step to the init graph.
+ *
+ * The result is reported from the central event queue context, so that the next init steps are not started from
+ * inside of driver callbacks.
+ *
+ * @param step Init step, one of @ref InitStep.
+ * @param result True if the step was successful, false otherwise.
+ */
+static void submit_init_step_result(uint8_t step, bool result)
 {
-    if (rc == BMP280_RESULT_CODE_OK) {
-        central_event_queue_submit_void_cb_with_user_data_event(hw_platform_init_part_11, NULL);
-    } else {
-        execute_hw_init_complete_cb(HW_PLATFORM_INIT_FAILURE);
-    }
+    central_event_queue_submit_void_cb_with_uint8_event(result ? handle_init_step_success : handle_init_step_failure,
+                                                        step);
 }
 
-static void hw_platform_init_part_10(void *user_data)
+/**
+ * @brief Completion callback of SHT3X driver functions that are init steps.
+ *
+ * @param result_code SHT3X result code.
+ * @param user_data Init step, one of @ref InitStep, cast to a pointer.
+ */
+static void sht3x_init_step_complete(uint8_t result_code, void *user_data)
 {
-    uint8_t rc = bmp280_set_pres_oversampling(bmp280_inst, BMP280_OVERSAMPLING_1, init_part_10_complete, NULL);
-    EAS_ASSERT(rc == BMP280_RESULT_CODE_OK);
+    submit_init_step_result((uint8_t)(uintptr_t)user_data, result_code == SHT3X_RESULT_CODE_OK);
 }
 
-static void init_part_9_complete(uint8_t rc, void *user_data)
+/**
+ * @brief Completion callback of BH1750 driver functions that are init steps.
+ *
+ * @param result_code BH1750 result code.
+ * @param user_data Init step, one of @ref InitStep, cast to a pointer.
+ */
+static void bh1750_init_step_complete(uint8_t result_code, void *user_data)
 {
-    if (rc == BMP280_RESULT_CODE_OK) {
-        central_event_queue_submit_void_cb_with_user_data_event(hw_platform_init_part_10, NULL);
-    } else {
-        execute_hw_init_complete_cb(HW_PLATFORM_INIT_FAILURE);
-    }
+    submit_init_step_result((uint8_t)(uintptr_t)user_data, result_code == BH1750_RESULT_CODE_OK);
 }
 
-static void hw_platform_init_part_9(void *user_data)
+/**
+ * @brief Completion callback of BMP280 driver functions that are init steps.
+ *
+ * @param result_code BMP280 result code.
+ * @param user_data Init step, one of @ref InitStep, cast to a pointer.
+ */
+static void bmp280_init_step_complete(uint8_t result_code, void *user_data)
 {
-    uint8_t rc = bmp280_set_temp_oversampling(bmp280_inst, BMP280_OVERSAMPLING_1, init_part_9_complete, NULL);
-    EAS_ASSERT(rc == BMP280_RESULT_CODE_OK);
+    submit_init_step_result((uint8_t)(uintptr_t)user_data, result_code == BMP280_RESULT_CODE_OK);
 }
 
-static void init_part_8_complete(uint8_t rc, void *user_data)
+static void sensor_power_on_complete(void *user_data)
 {
-    if (rc == BMP280_RESULT_CODE_OK) {
-        central_event_queue_submit_void_cb_with_user_data_event(hw_platform_init_part_9, NULL);
-    } else {
-        execute_hw_init_complete_cb(HW_PLATFORM_INIT_FAILURE);
-    }
+    submit_init_step_result(INIT_STEP_SENSOR_POWER_ON, true);
 }
 
-static void hw_platform_init_part_8(void *user_data)
+static void init_step_sensor_power_on(void *user_data)
 {
-    uint8_t rc = bmp280_set_spi_3_wire_interface(bmp280_inst, BMP280_SPI_3_WIRE_DIS, init_part_8_complete, NULL);
-    EAS_ASSERT(rc == BMP280_RESULT_CODE_OK);
+    hw_platform_timer =
+        eas_timer_create(HW_PLATFORM_MAX_SENSOR_POWER_ON_TIME_MS, EAS_TIMER_ONE_SHOT, sensor_power_on_complete, NULL);
+    eas_timer_start(hw_platform_timer);
 }
 
-static void init_part_7_complete(uint8_t rc, void *user_data)
+static void init_step_sht31_reset(void *user_data)
 {
-    if (rc == BMP280_RESULT_CODE_OK) {
-        central_event_queue_submit_void_cb_with_user_data_event(hw_platform_init_part_8, NULL);
-    } else {
-        execute_hw_init_complete_cb(HW_PLATFORM_INIT_FAILURE);
-    }
-}
+    uint8_t rc;
+    SHT3XInitConfig sht3x_cfg = {
+        .get_instance_memory = sht3x_driver_get_instance_memory,
+        .get_instance_memory_user_data = NULL,
+        .i2c_write = sht3x_driver_i2c_write,
+        .i2c_write_user_data = (void *)&i2c_queue,
+        .i2c_read = sht3x_driver_i2c_read,
+        .i2c_read_user_data = (void *)&i2c_queue,
+        .start_timer = sht3x_driver_timer_start,
+        .start_timer_user_data = (void *)&sht3x_timer_data,
+        .i2c_addr = SHT31_I2C_ADDR,
+    };
+    rc = sht3x_create(&sht3x_inst, &sht3x_cfg);
+    EAS_ASSERT(rc == SHT3X_RESULT_CODE_OK);
 
-static void hw_platform_init_part_7(void *user_data)
-{
-    uint8_t rc = bmp280_set_filter_coefficient(bmp280_inst, BMP280_FILTER_COEFF_FILTER_OFF, init_part_7_complete, NULL);
-    EAS_ASSERT(rc == BMP280_RESULT_CODE_OK);
+    /* Put SHT31 device into a known default state */
+    rc = sht3x_soft_reset_with_delay(sht3x_inst, sht3x_init_step_complete, INIT_STEP_USER_DATA(INIT_STEP_SHT31_RESET));
+    EAS_ASSERT(rc == SHT3X_RESULT_CODE_OK);
 }
 
-static void init_part_6_complete(uint8_t rc, void *user_data)
+static void init_step_bh1750_init(void *user_data)
 {
-    if (rc == BMP280_RESULT_CODE_OK) {
-        central_event_queue_submit_void_cb_with_user_data_event(hw_platform_init_part_7, NULL);
-    } else {
-        execute_hw_init_complete_cb(HW_PLATFORM_INIT_FAILURE);
-    }
-}
+    uint8_t rc;
+    BH1750InitConfig bh1750_cfg = {
+        .get_instance_memory = bh1750_driver_get_instance_memory,
+        .get_instance_memory_user_data = NULL,
+        .i2c_write = bh1750_driver_i2c_write,
+        /* So that i2c_write pushes I2C operations to I2C queue */
+        .i2c_write_user_data = (void *)&i2c_queue,
+        .i2c_read = bh1750_driver_i2c_read,
+        /* So that i2c_read pushes I2C operations to I2C queue */
+        .i2c_read_user_data = (void *)&i2c_queue,
+        .start_timer = bh1750_driver_timer_start,
+        .start_timer_user_data = (void *)&bh1750_timer_data,
+        .i2c_addr = BH1750_I2C_ADDR,
+    };
+    rc = bh1750_create(&bh1750_inst, &bh1750_cfg);
+    EAS_ASSERT(rc == BH1750_RESULT_CODE_OK);
 
-static void hw_platform_init_part_6(void *user_data)
-{
-    uint8_t rc = bmp280_init_meas(bmp280_inst, init_part_6_complete, NULL);
-    EAS_ASSERT(rc == BMP280_RESULT_CODE_OK);
+    rc = bh1750_init(bh1750_inst, bh1750_init_step_complete, INIT_STEP_USER_DATA(INIT_STEP_BH1750_INIT));
+    EAS_ASSERT(rc == BH1750_RESULT_CODE_OK);
 }
 
-static void init_part_5_complete(uint8_t rc, void *user_data)
+static void init_step_bh1750_set_meas_time(void *user_data)
 {
-    if (rc == BMP280_RESULT_CODE_OK) {
-        central_event_queue_submit_void_cb_with_user_data_event(hw_platform_init_part_6, NULL);
-    } else {
-        execute_hw_init_complete_cb(HW_PLATFORM_INIT_FAILURE);
-    }
+    /* Lowest possible to capture the widest possible range of lx measurements */
+    uint8_t meas_time = 31;
+    uint8_t rc = bh1750_set_measurement_time(bh1750_inst, meas_time, bh1750_init_step_complete,
+                                             INIT_STEP_USER_DATA(INIT_STEP_BH1750_SET_MEAS_TIME));
+    EAS_ASSERT(rc == BH1750_RESULT_CODE_OK);
 }
 
-static void hw_platform_init_part_5(void *user_data)
-{
-    uint8_t *bmp280_chip_id_p = (uint8_t *)user_data;
-    EAS_ASSERT(bmp280_chip_id_p);
+static uint8_t bmp280_chip_id;
 
-    if (*bmp280_chip_id_p != BMP280_CHIP_ID) {
-        EAS_LOG_INF("Unexpected BMP280 chip id: 0x%2X, expected 0x%2X", *bmp280_chip_id_p, BMP280_CHIP_ID);
-        execute_hw_init_complete_cb(HW_PLATFORM_INIT_FAILURE);
-        return;
-    }
-
-    uint8_t rc = bmp280_reset_with_delay(bmp280_inst, init_part_5_complete, NULL);
-    EAS_ASSERT(rc == BMP280_RESULT_CODE_OK);
-}
-
-static void init_part_4_complete(uint8_t rc, void *user_data)
+static void bmp280_get_chip_id_complete(uint8_t result_code, void *user_data)
 {
-    if (rc == BMP280_RESULT_CODE_OK) {
-        uint8_t *bmp280_chip_id_p = (uint8_t *)user_data;
-        EAS_ASSERT(bmp280_chip_id_p);
-        central_event_queue_submit_void_cb_with_user_data_event(hw_platform_init_part_5, (void *)bmp280_chip_id_p);
-    } else {
-        execute_hw_init_complete_cb(HW_PLATFORM_INIT_FAILURE);
+    bool result = (result_code == BMP280_RESULT_CODE_OK);
+    if (result && (bmp280_chip_id != BMP280_CHIP_ID)) {
+        EAS_LOG_INF("Unexpected BMP280 chip id: 0x%2X, expected 0x%2X", bmp280_chip_id, BMP280_CHIP_ID);
+        result = false;
     }
+    submit_init_step_result(INIT_STEP_BMP280_GET_CHIP_ID, result);
 }
 
-/**
- * @brief Hardware platform initialization part 4.
- *
- * @param user_data This parameter is only here so that the function signature complies with what can be submitted to
- * event queue as a callback. It is not used in the implementation.
- */
-static void hw_platform_init_part_4(void *user_data)
+static void init_step_bmp280_get_chip_id(void *user_data)
 {
     uint8_t rc;
     BMP280InitCfg bmp280_cfg = {
@@ -685,131 +690,148 @@ static void hw_platform_init_part_4(void *user_data)
     rc = bmp280_create(&bmp280_inst, &bmp280_cfg);
     EAS_ASSERT(rc == BMP280_RESULT_CODE_OK);
 
-    static uint8_t chip_id;
-    /* Passing chip_id as user data to verify that the correct chip id was read out */
-    rc = bmp280_get_chip_id(bmp280_inst, &chip_id, init_part_4_complete, (void *)&chip_id);
+    rc = bmp280_get_chip_id(bmp280_inst, &bmp280_chip_id, bmp280_get_chip_id_complete, NULL);
     EAS_ASSERT(rc == BMP280_RESULT_CODE_OK);
 }
 
-/**
- * @brief Callback to execute once part 3 of hw platform init is complete.
- *
- * This submits part 4 of hw platform init to the central event queue as a callback to execute.
- *
- * @param result_code Signifies whether BH1750 measurement time was set successfully.
- * @param user_data User data, unused in this callback.
- */
-static void init_part_3_complete(uint8_t result_code, void *user_data)
+static void init_step_bmp280_reset(void *user_data)
 {
-    if (result_code == SHT3X_RESULT_CODE_OK) {
-        central_event_queue_submit_void_cb_with_user_data_event(hw_platform_init_part_4, NULL);
-    } else {
-        execute_hw_init_complete_cb(HW_PLATFORM_INIT_FAILURE);
-    }
+    uint8_t rc =
+        bmp280_reset_with_delay(bmp280_inst, bmp280_init_step_complete, INIT_STEP_USER_DATA(INIT_STEP_BMP280_RESET));
+    EAS_ASSERT(rc == BMP280_RESULT_CODE_OK);
 }
 
-/**
- * @brief Hardware platform initialization part 3.
- *
- * @param user_data This parameter is only here so that the function signature complies with what can be submitted to
- * event queue as a callback. It is not used in the implementation.
- */
-static void hw_platform_init_part_3(void *user_data)
+static void init_step_bmp280_init_meas(void *user_data)
 {
-    /* Lowest possible to capture the widest possible range of lx measurements */
-    uint8_t meas_time = 31;
-    uint8_t rc = bh1750_set_measurement_time(bh1750_inst, meas_time, init_part_3_complete, NULL);
-    EAS_ASSERT(rc == BH1750_RESULT_CODE_OK);
+    uint8_t rc =
+        bmp280_init_meas(bmp280_inst, bmp280_init_step_complete, INIT_STEP_USER_DATA(INIT_STEP_BMP280_INIT_MEAS));
+    EAS_ASSERT(rc == BMP280_RESULT_CODE_OK);
 }
 
-/**
- * @brief Callback to execute once part 2 of hw platform init is complete.
- *
- * This submits part 3 of hw platform init to the central event queue as a callback to execute.
- *
- * @param result_code Signifies whether BH1750 initialization was successful.
- * @param user_data User data, unused in this callback.
- */
-static void init_part_2_complete(uint8_t result_code, void *user_data)
+static void init_step_bmp280_set_filter_coefficient(void *user_data)
 {
-    if (result_code == SHT3X_RESULT_CODE_OK) {
-        central_event_queue_submit_void_cb_with_user_data_event(hw_platform_init_part_3, NULL);
-    } else {
-        execute_hw_init_complete_cb(HW_PLATFORM_INIT_FAILURE);
-    }
+    uint8_t rc = bmp280_set_filter_coefficient(bmp280_inst, BMP280_FILTER_COEFF_FILTER_OFF, bmp280_init_step_complete,
+                                               INIT_STEP_USER_DATA(INIT_STEP_BMP280_SET_FILTER_COEFFICIENT));
+    EAS_ASSERT(rc == BMP280_RESULT_CODE_OK);
 }
 
-/**
- * @brief Hardware platform initialization part 2.
- *
- * @param user_data This parameter is only here so that the function signature complies with what can be submitted to
- * event queue as a callback. It is not used in the implementation.
- */
-static void hw_platform_init_part_2(void *user_data)
+static void init_step_bmp280_set_spi_3_wire_interface(void *user_data)
 {
-    uint8_t rc;
-    BH1750InitConfig bh1750_cfg = {
-        .get_instance_memory = bh1750_driver_get_instance_memory,
-        .get_instance_memory_user_data = NULL,
-        .i2c_write = bh1750_driver_i2c_write,
-        /* So that i2c_write pushes I2C operations to I2C queue */
-        .i2c_write_user_data = (void *)&i2c_queue,
-        .i2c_read = bh1750_driver_i2c_read,
-        /* So that i2c_read pushes I2C operations to I2C queue */
-        .i2c_read_user_data = (void *)&i2c_queue,
-        .start_timer = bh1750_driver_timer_start,
-        .start_timer_user_data = (void *)&bh1750_timer_data,
-        .i2c_addr = BH1750_I2C_ADDR,
-    };
-    rc = bh1750_create(&bh1750_inst, &bh1750_cfg);
-    EAS_ASSERT(rc == BH1750_RESULT_CODE_OK);
+    uint8_t rc = bmp280_set_spi_3_wire_interface(bmp280_inst, BMP280_SPI_3_WIRE_DIS, bmp280_init_step_complete,
+                                                 INIT_STEP_USER_DATA(INIT_STEP_BMP280_SET_SPI_3_WIRE_INTERFACE));
+    EAS_ASSERT(rc == BMP280_RESULT_CODE_OK);
+}
 
-    rc = bh1750_init(bh1750_inst, init_part_2_complete, NULL);
-    EAS_ASSERT(rc == BH1750_RESULT_CODE_OK);
+static void init_step_bmp280_set_temp_oversampling(void *user_data)
+{
+    uint8_t rc = bmp280_set_temp_oversampling(bmp280_inst, BMP280_OVERSAMPLING_1, bmp280_init_step_complete,
+                                              INIT_STEP_USER_DATA(INIT_STEP_BMP280_SET_TEMP_OVERSAMPLING));
+    EAS_ASSERT(rc == BMP280_RESULT_CODE_OK);
 }
 
-/**
- * @brief Callback to execute once part 1 of hw platform init is complete.
- *
- * This submits part 2 of hw platform init to the central event queue as a callback to execute.
- *
- * @param result_code Signifies whether the SHT3X reset was successful.
- * @param user_data User data, unused in this callback.
- */
-static void init_part_1_complete(uint8_t result_code, void *user_data)
+static void init_step_bmp280_set_pres_oversampling(void *user_data)
+{
+    uint8_t rc = bmp280_set_pres_oversampling(bmp280_inst, BMP280_OVERSAMPLING_1, bmp280_init_step_complete,
+                                              INIT_STEP_USER_DATA(INIT_STEP_BMP280_SET_PRES_OVERSAMPLING));
+    EAS_ASSERT(rc == BMP280_RESULT_CODE_OK);
+}
+
+static void bt_enable_complete(int err)
 {
-    if (result_code == SHT3X_RESULT_CODE_OK) {
-        central_event_queue_submit_void_cb_with_user_data_event(hw_platform_init_part_2, NULL);
-    } else {
-        execute_hw_init_complete_cb(HW_PLATFORM_INIT_FAILURE);
+    if (err != 0) {
+        EAS_LOG_INF("Failed to enable Bluetooth");
     }
+    submit_init_step_result(INIT_STEP_BT_ENABLE, err == 0);
 }
 
-static void hw_platform_init_part_1(void *user_data)
+static void init_step_bt_enable(void *user_data)
 {
-    uint8_t rc;
-    SHT3XInitConfig sht3x_cfg = {
-        .get_instance_memory = sht3x_driver_get_instance_memory,
-        .get_instance_memory_user_data = NULL,
-        .i2c_write = sht3x_driver_i2c_write,
-        .i2c_write_user_data = (void *)&i2c_queue,
-        .i2c_read = sht3x_driver_i2c_read,
-        .i2c_read_user_data = (void *)&i2c_queue,
-        .start_timer = sht3x_driver_timer_start,
-        .start_timer_user_data = (void *)&sht3x_timer_data,
-        .i2c_addr = SHT31_I2C_ADDR,
-    };
-    rc = sht3x_create(&sht3x_inst, &sht3x_cfg);
-    EAS_ASSERT(rc == SHT3X_RESULT_CODE_OK);
+    int err = bt_enable(bt_enable_complete);
+    if (err) {
+        EAS_LOG_INF("Bluetooth init failed (err %d)", err);
+        submit_init_step_result(INIT_STEP_BT_ENABLE, false);
+    }
+}
 
-    /* Put SHT31 device into a known default state */
-    rc = sht3x_soft_reset_with_delay(sht3x_inst, init_part_1_complete, NULL);
-    EAS_ASSERT(rc == SHT3X_RESULT_CODE_OK);
+static void init_step_init_virtual_devices(void *user_data)
+{
+    bt_conn_cb_register(&connection_callbacks);
+    submit_start_advertising_event();
+
+    SHT31VirtualInterfaces sht31_interfaces = virtual_sht31_initialize(&sht3x_inst);
+    temperature_sensor = sht31_interfaces.temperature_sensor;
+    humidity_sensor = sht31_interfaces.humidity_sensor;
+
+    BMP280VirtualInterfaces bmp280_interfaces = virtual_bmp280_initialize(&bmp280_inst);
+    pressure_sensor = bmp280_interfaces.pressure_sensor;
+
+    BH1750VirtualInterfaces bh1750_interfaces = virtual_bh1750_initialize(&bh1750_inst);
+    light_intensity_sensor = bh1750_interfaces.light_intensity_sensor;
+
+    Nrf52840LedVirtualInterfaces nrf_led_interfaces = virtual_led_nrf52840_initialize(&zephyr_pwms);
+    led = nrf_led_interfaces.led;
+
+    NrfBleTransceiverVirtualInterfaces ble_interfaces = virtual_transceiver_nrf_ble_initialize();
+    transceiver = ble_interfaces.transceiver;
+
+    init_graph_step_complete(init_graph, INIT_STEP_INIT_VIRTUAL_DEVICES, true);
 }
 
-static void init_part_0_complete(void *user_data)
+#define SENSOR_POWER_ON_DEPENDENCY INIT_GRAPH_DEPENDENCY(INIT_STEP_SENSOR_POWER_ON)
+
+// clang-format off
+static const InitGraphStep init_steps[INIT_NUM_STEPS] = {
+    [INIT_STEP_SENSOR_POWER_ON] = {.start = init_step_sensor_power_on, .dependencies = 0},
+    [INIT_STEP_SHT31_RESET] = {.start = init_step_sht31_reset, .dependencies = SENSOR_POWER_ON_DEPENDENCY},
+    [INIT_STEP_BH1750_INIT] = {.start = init_step_bh1750_init, .dependencies = SENSOR_POWER_ON_DEPENDENCY},
+    [INIT_STEP_BH1750_SET_MEAS_TIME] = {
+        .start = init_step_bh1750_set_meas_time,
+        .dependencies = INIT_GRAPH_DEPENDENCY(INIT_STEP_BH1750_INIT),
+    },
+    [INIT_STEP_BMP280_GET_CHIP_ID] = {
+        .start = init_step_bmp280_get_chip_id,
+        .dependencies = SENSOR_POWER_ON_DEPENDENCY,
+    },
+    [INIT_STEP_BMP280_RESET] = {
+        .start = init_step_bmp280_reset,
+        .dependencies = INIT_GRAPH_DEPENDENCY(INIT_STEP_BMP280_GET_CHIP_ID),
+    },
+    [INIT_STEP_BMP280_INIT_MEAS] = {
+        .start = init_step_bmp280_init_meas,
+        .dependencies = INIT_GRAPH_DEPENDENCY(INIT_STEP_BMP280_RESET),
+    },
+    [INIT_STEP_BMP280_SET_FILTER_COEFFICIENT] = {
+        .start = init_step_bmp280_set_filter_coefficient,
+        .dependencies = INIT_GRAPH_DEPENDENCY(INIT_STEP_BMP280_INIT_MEAS),
+    },
+    [INIT_STEP_BMP280_SET_SPI_3_WIRE_INTERFACE] = {
+        .start = init_step_bmp280_set_spi_3_wire_interface,
+        .dependencies = INIT_GRAPH_DEPENDENCY(INIT_STEP_BMP280_SET_FILTER_COEFFICIENT),
+    },
+    [INIT_STEP_BMP280_SET_TEMP_OVERSAMPLING] = {
+        .start = init_step_bmp280_set_temp_oversampling,
+        .dependencies = INIT_GRAPH_DEPENDENCY(INIT_STEP_BMP280_SET_SPI_3_WIRE_INTERFACE),
+    },
+    [INIT_STEP_BMP280_SET_PRES_OVERSAMPLING] = {
+        .start = init_step_bmp280_set_pres_oversampling,
+        .dependencies = INIT_GRAPH_DEPENDENCY(INIT_STEP_BMP280_SET_TEMP_OVERSAMPLING),
+    },
+    /* Bluetooth does not need the sensors to be powered on */
+    [INIT_STEP_BT_ENABLE] = {.start = init_step_bt_enable, .dependencies = 0},
+    /* Depends on all other steps */
+    [INIT_STEP_INIT_VIRTUAL_DEVICES] = {
+        .start = init_step_init_virtual_devices,
+        .dependencies = INIT_GRAPH_DEPENDENCY(INIT_STEP_INIT_VIRTUAL_DEVICES) - 1,
+    },
+};
+// clang-format on
+
+static void init_graph_complete_cb(bool result, void *user_data)
 {
-    central_event_queue_submit_void_cb_with_user_data_event(hw_platform_init_part_1, NULL);
+    if (result) {
+        EAS_LOG_INF("Hw platform init complete");
+    }
+    execute_hw_init_complete_cb(result ? HW_PLATFORM_INIT_SUCCESS : HW_PLATFORM_INIT_FAILURE);
 }
 
 void hw_platform_init(HwPlatformCompleteCb cb, void *user_data)
@@ -831,9 +853,8 @@ void hw_platform_init(HwPlatformCompleteCb cb, void *user_data)
     EAS_ASSERT(pwm_is_ready_dt(&zephyr_pwms.green_pwm_led));
     EAS_ASSERT(pwm_is_ready_dt(&zephyr_pwms.blue_pwm_led));
 
-    hw_platform_timer =
-        eas_timer_create(HW_PLATFORM_MAX_SENSOR_POWER_ON_TIME_MS, EAS_TIMER_ONE_SHOT, init_part_0_complete, NULL);
-    eas_timer_start(hw_platform_timer);
+    init_graph = init_graph_create(init_steps, INIT_NUM_STEPS, init_graph_complete_cb, NULL);
+    init_graph_start(init_graph);
 }
 
 const Led *const hw_platform_get_led()
@@ -866,6 +887,13 @@ const LightIntensitySensor *const hw_platform_get_light_intensity_sensor()
     return light_intensity_sensor;
 }
 
+void hw_platform_register_new_multi_sample_cb(MultiSampleNewSampleCb cb, void *user_data)
+{
+    /* BMP280 measures temperature together with pressure, but its temperature is only used for pressure compensation.
+     * SHT31 is the only sensor that reads out several of the reported variables together. */
+    virtual_sht31_register_new_multi_sample_cb(cb, user_data);
+}
+
 const Transceiver *const hw_platform_get_transceiver()
 {
     EAS_ASSERT(transceiver);
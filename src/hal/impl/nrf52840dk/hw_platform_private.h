@@ -14,6 +14,7 @@ extern "C"
 #include "bh1750.h"
 #include "bmp280.h"
 #include "eas_timer.h"
+#include "ops_queue.h"
 
 typedef enum {
     /** Callback is of type SHT3X_I2CTransactionCompleteCb. */
@@ -38,6 +39,12 @@ typedef struct {
     uint8_t cb_type;
 } I2cCompleteCbData;
 
+/** Priorities of I2C operations in the I2C operations queue. A read fetches the result of a measurement that the sensor
+ * has already taken, so reads are started before writes that start new measurements. Otherwise, a slow I2C bus delays
+ * the read, and the sample is older by the time it is reported. */
+#define I2C_OP_PRIORITY_WRITE OPS_QUEUE_PRIORITY_LOWEST
+#define I2C_OP_PRIORITY_READ (OPS_QUEUE_PRIORITY_LOWEST + 1)
+
 /**
  * @brief All data related to a I2C operation.
  *
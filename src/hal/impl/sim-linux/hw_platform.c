@@ -0,0 +1,69 @@
+#include <stddef.h>
+
+#include "hw_platform.h"
+#include "virtual_sensors_sim.h"
+#include "virtual_transceiver_sim.h"
+#include "virtual_led_sim.h"
+#include "eas_assert.h"
+
+/* Macro to use as result parameter of hw platform init cb - for readability */
+#define HW_PLATFORM_INIT_SUCCESS true
+
+static const Led *led = NULL;
+static const TemperatureSensor *temperature_sensor = NULL;
+static const PressureSensor *pressure_sensor = NULL;
+static const HumiditySensor *humidity_sensor = NULL;
+static const LightIntensitySensor *light_intensity_sensor = NULL;
+static const Transceiver *transceiver = NULL;
+
+/* There is no hardware to wait for, so initialization completes immediately */
+void hw_platform_init(HwPlatformCompleteCb cb, void *user_data)
+{
+    EAS_ASSERT(cb);
+
+    VirtualSensorsSimVirtualInterfaces sensors = virtual_sensors_sim_initialize();
+    temperature_sensor = sensors.temperature_sensor;
+    pressure_sensor = sensors.pressure_sensor;
+    humidity_sensor = sensors.humidity_sensor;
+    light_intensity_sensor = sensors.light_intensity_sensor;
+    led = virtual_led_sim_initialize().led;
+    transceiver = virtual_transceiver_sim_initialize().transceiver;
+
+    cb(HW_PLATFORM_INIT_SUCCESS, user_data);
+}
+
+const Led *const hw_platform_get_led()
+{
+    return led;
+}
+
+const TemperatureSensor *const hw_platform_get_temperature_sensor()
+{
+    return temperature_sensor;
+}
+
+const PressureSensor *const hw_platform_get_pressure_sensor()
+{
+    return pressure_sensor;
+}
+
+const HumiditySensor *const hw_platform_get_humidity_sensor()
+{
+    return humidity_sensor;
+}
+
+const LightIntensitySensor *const hw_platform_get_light_intensity_sensor()
+{
+    return light_intensity_sensor;
+}
+
+void hw_platform_register_new_multi_sample_cb(MultiSampleNewSampleCb cb, void *user_data)
+{
+    /* Scripted temperature and humidity sensors are read out together, like SHT31 in the nrf52840dk port */
+    virtual_sensors_sim_register_new_multi_sample_cb(cb, user_data);
+}
+
+const Transceiver *const hw_platform_get_transceiver()
+{
+    return transceiver;
+}
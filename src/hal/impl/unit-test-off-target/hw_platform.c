@@ -2,6 +2,7 @@
 
 #include "hw_platform.h"
 #include "virtual_transceiver_mock.h"
+#include "virtual_sensors_mock.h"
 
 /* Unused in unit test port */
 void hw_platform_init(HwPlatformCompleteCb cb, void *user_data)
@@ -13,28 +14,29 @@ const Led *const hw_platform_get_led()
     return NULL;
 }
 
-/* Unused in unit test port */
 const TemperatureSensor *const hw_platform_get_temperature_sensor()
 {
-    return NULL;
+    return virtual_temperature_sensor_mock_get();
 }
 
-/* Unused in unit test port */
 const PressureSensor *const hw_platform_get_pressure_sensor()
 {
-    return NULL;
+    return virtual_pressure_sensor_mock_get();
 }
 
-/* Unused in unit test port */
 const HumiditySensor *const hw_platform_get_humidity_sensor()
 {
-    return NULL;
+    return virtual_humidity_sensor_mock_get();
 }
 
-/* Unused in unit test port */
 const LightIntensitySensor *const hw_platform_get_light_intensity_sensor()
 {
-    return NULL;
+    return virtual_light_intensity_sensor_mock_get();
+}
+
+void hw_platform_register_new_multi_sample_cb(MultiSampleNewSampleCb cb, void *user_data)
+{
+    virtual_sensors_mock_register_new_multi_sample_cb(cb, user_data);
 }
 
 const Transceiver *const hw_platform_get_transceiver()
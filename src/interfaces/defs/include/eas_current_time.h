@@ -6,6 +6,8 @@ extern "C"
 {
 #endif
 
+#include <stdint.h>
+
 #include "utils/eas_time_defs.h"
 
 /**
@@ -15,6 +17,16 @@ extern "C"
  */
 EasTime eas_current_time_get();
 
+/**
+ * @brief Get current value of the hardware cycle counter.
+ *
+ * Meant for measuring short durations, such as the execution time of a function. The counter wraps around, so the
+ * duration is the difference between two values, computed with unsigned arithmetic.
+ *
+ * @return uint32_t Current cycle count.
+ */
+uint32_t eas_current_time_get_cycles();
+
 #ifdef __cplusplus
 }
 #endif
@@ -33,13 +33,21 @@ extern "C"
  * from the context of a dedicated thread. This means that we cannot directly call EasTimerCb from that context.
  *
  * Instead, we call this EasTimerExecuteTimerExpiryFunctionCb callback from that context. To reiterate, it is allowed to
- * call this callback from any context - any thread or ISR. As parameters, this function gets the EasTimerCb and its
- * user_data that were passed to @ref eas_timer_create.
+ * call this callback from any context - any thread or ISR. As parameters, this function gets a callback that executes
+ * the EasTimerCb callbacks of expired timers, and user data for that callback.
+ *
+ * This callback is not called once per expiry. Instead, implementations mark expired timers as pending, and only call
+ * this callback for the first pending expiry. The callback it gets then executes the EasTimerCb callbacks of all timers
+ * that have expired until then, so a burst of expiries needs only one pending execution, e.g. one event in the event
+ * queue. If a timer expires again before its pending expiry is executed, its EasTimerCb is executed once.
+ *
+ * The EasTimerCb callbacks of pending expiries are executed in the order in which their timers were created, not in the
+ * order in which they expired.
  *
  * The implementation of this callback is responsible for ensuring that the EasTimerCb is executed from the same
  * context/thread as the application module that is using the timer. An example implementation of this callback is to
  * submit an event to the event queue that handles all events in the system. As payload to that event, we pass the
- * EasTimerCb and user_data. Since the event queue handles all events in the system, the context from which EasTimer cb
+ * callback and user_data. Since the event queue handles all events in the system, the context from which EasTimer cb
  * is called is the same context from which all application module APIs are called.
  *
  * This is just an example implementation. Any other implementation is allowed, as long as EasTimerCb gets executed from
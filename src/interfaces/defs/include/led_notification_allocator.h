@@ -1,38 +0,0 @@
-#ifndef ENV_ALERT_SYSTEM_SRC_INTERFACES_DEFS_INCLUDE_LED_NOTIFICATION_ALLOCATOR_H
-#define ENV_ALERT_SYSTEM_SRC_INTERFACES_DEFS_INCLUDE_LED_NOTIFICATION_ALLOCATOR_H
-
-#ifdef __cplusplus
-extern "C"
-{
-#endif
-
-#include "led_manager_private.h"
-
-/**
- * @brief Block memory allocator for led notifications.
- *
- * The implementation of this interface must be able to simulatensously allocate
- * CONFIG_LED_NOTIFICATION_ALLOCATOR_NUM_NOTIFICATIONS memory blocks of size sizeof(LedNotification) bytes. Each memory
- * block is one led notification.
- */
-
-/**
- * @brief Allocate memory for a led notification.
- *
- * @return LedNotification* If successful, points to allocated memory for led notification. If failed due to being out
- * of memory, returns NULL.
- */
-LedNotification *led_notification_allocator_alloc();
-
-/**
- * @brief Free a previously allocated led notification.
- *
- * @param led_notification Led notification buffer previously returned by @ref led_notification_allocator_alloc.
- */
-void led_notification_allocator_free(LedNotification *led_notification);
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* ENV_ALERT_SYSTEM_SRC_INTERFACES_DEFS_INCLUDE_LED_NOTIFICATION_ALLOCATOR_H */
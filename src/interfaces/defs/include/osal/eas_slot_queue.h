@@ -0,0 +1,119 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_INTERFACES_DEFS_INCLUDE_OSAL_EAS_SLOT_QUEUE_H
+#define ENV_ALERT_SYSTEM_SRC_INTERFACES_DEFS_INCLUDE_OSAL_EAS_SLOT_QUEUE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Multiple producer, single consumer queue of fixed-size slots.
+ *
+ * Messages are written and read in place, without copying them in or out of the queue. A producer reserves a slot,
+ * writes the message directly into it and commits it. The consumer gets the oldest committed slot, handles the message
+ * directly from the slot and releases it, which makes the slot available to producers again.
+ *
+ * Slots are handed to the consumer in the order in which they were reserved. If a producer is preempted between
+ * reserving and committing a slot, slots reserved and committed after it are held back until it commits its slot.
+ *
+ * Usage:
+ * @code
+ * // Producer
+ * MyMessage *message = (MyMessage *)eas_slot_queue_reserve(queue);
+ * if (message) {
+ *     message->field = value;
+ *     eas_slot_queue_commit(queue, message);
+ * }
+ *
+ * // Consumer
+ * const MyMessage *message = (const MyMessage *)eas_slot_queue_get(queue);
+ * handle_message(message);
+ * eas_slot_queue_release(queue);
+ * @endcode
+ */
+
+typedef struct EasSlotQueueStruct *EasSlotQueue;
+
+/**
+ * @brief Create a slot queue instance.
+ *
+ * @param buf Memory buffer for the slots. Must be at least @p slot_size * @p num_slots bytes long, and aligned for the
+ * messages that are going to be stored in the slots.
+ * @param slot_size Size of one slot in bytes. Must be a multiple of the alignment of the stored messages, so that every
+ * slot is aligned.
+ * @param num_slots Number of slots.
+ *
+ * @return EasSlotQueue Created slot queue instance.
+ */
+EasSlotQueue eas_slot_queue_create(uint8_t *const buf, size_t slot_size, size_t num_slots);
+
+/**
+ * @brief Reserve a slot for writing a message.
+ *
+ * This function does not block. If all slots are occupied, returns NULL immediately instead of blocking.
+ *
+ * This function is thread-safe - it is allowed to reserve slots in the same queue from different contexts - both
+ * threads and ISRs.
+ *
+ * @param self Slot queue instance returned by @ref eas_slot_queue_create.
+ *
+ * @return void* Reserved slot of slot_size bytes, or NULL if there are no free slots.
+ */
+void *eas_slot_queue_reserve(EasSlotQueue self);
+
+/**
+ * @brief Commit a slot, making its message available to the consumer.
+ *
+ * Same as @ref eas_slot_queue_reserve, can be called from threads and ISRs.
+ *
+ * @param self Slot queue instance returned by @ref eas_slot_queue_create.
+ * @param slot Slot returned by @ref eas_slot_queue_reserve. The message must be fully written to the slot before this
+ * function is called. The slot must not be accessed by the producer after this function is called.
+ */
+void eas_slot_queue_commit(EasSlotQueue self, void *const slot);
+
+/**
+ * @brief Get the oldest committed slot.
+ *
+ * This is a blocking function. The calling thread is blocked until the oldest reserved slot is committed.
+ *
+ * The returned slot stays valid until @ref eas_slot_queue_release is called. Calling this function again before
+ * releasing the slot returns the same slot.
+ *
+ * @param self Slot queue instance returned by @ref eas_slot_queue_create.
+ *
+ * @return void* Oldest committed slot.
+ *
+ * @warning Do not call from ISRs - ISRs are not allowed to block. Only one thread is allowed to consume from a queue.
+ */
+void *eas_slot_queue_get(EasSlotQueue self);
+
+/**
+ * @brief Release the slot returned by @ref eas_slot_queue_get, so that it can be reserved by producers again.
+ *
+ * @param self Slot queue instance returned by @ref eas_slot_queue_create.
+ */
+void eas_slot_queue_release(EasSlotQueue self);
+
+/**
+ * @brief Get the highest number of slots that have been occupied at the same time.
+ *
+ * A slot is occupied from the moment it is reserved until it is released. Useful for sizing the queue from data: if
+ * the high-watermark never gets close to the number of slots, the queue can be made smaller.
+ *
+ * Can be called from any context.
+ *
+ * @param self Slot queue instance returned by @ref eas_slot_queue_create.
+ *
+ * @return size_t Highest number of occupied slots since the queue was created.
+ */
+size_t eas_slot_queue_get_high_watermark(EasSlotQueue self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_INTERFACES_DEFS_INCLUDE_OSAL_EAS_SLOT_QUEUE_H */
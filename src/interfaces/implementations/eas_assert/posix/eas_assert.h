@@ -0,0 +1,13 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_INTERFACES_IMPLEMENTATIONS_EAS_ASSERT_POSIX_EAS_ASSERT_H
+#define ENV_ALERT_SYSTEM_SRC_INTERFACES_IMPLEMENTATIONS_EAS_ASSERT_POSIX_EAS_ASSERT_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Prints the failed expression and its location, then aborts, so that a debugger or a core dump shows the call stack.
+ */
+#define EAS_ASSERT(expr)                                                                                               \
+    ((expr) ? (void)(0)                                                                                                \
+            : (fprintf(stderr, "Assertion failed: %s, %s:%d, %s\n", #expr, __FILE__, __LINE__, __func__), abort()))
+
+#endif /* ENV_ALERT_SYSTEM_SRC_INTERFACES_IMPLEMENTATIONS_EAS_ASSERT_POSIX_EAS_ASSERT_H */
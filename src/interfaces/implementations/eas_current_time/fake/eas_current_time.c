@@ -1,6 +1,7 @@
 #include "eas_current_time.h"
 
 static EasTime current_time = 0;
+static uint32_t current_cycles = 0;
 
 EasTime eas_current_time_get()
 {
@@ -11,3 +12,13 @@ void fake_eas_current_time_set(EasTime time)
 {
     current_time = time;
 }
+
+uint32_t eas_current_time_get_cycles()
+{
+    return current_cycles;
+}
+
+void fake_eas_current_time_set_cycles(uint32_t cycles)
+{
+    current_cycles = cycles;
+}
@@ -11,13 +11,15 @@ extern "C"
 /**
  * @brief Defines an extension to the eas_current_time interface.
  *
- * This extension interface defines a function to set current time, so that unit tests can control the time. Since this
- * function should not be a part of the eas_current_time interface definition, it is defined here in this extension
- * header. Unit tests should include this header instead of the eas_current_time.h one.
+ * This extension interface defines functions to set current time and cycle count, so that unit tests can control the
+ * time. Since these functions should not be a part of the eas_current_time interface definition, they are defined here
+ * in this extension header. Unit tests should include this header instead of the eas_current_time.h one.
  */
 
 void fake_eas_current_time_set(EasTime time);
 
+void fake_eas_current_time_set_cycles(uint32_t cycles);
+
 #ifdef __cplusplus
 }
 #endif
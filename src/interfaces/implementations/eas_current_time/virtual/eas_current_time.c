@@ -0,0 +1,32 @@
+#include <stdatomic.h>
+#include <time.h>
+
+#include "virtual_eas_current_time.h"
+#include "eas_assert.h"
+
+/* Set by the simulation thread and read by the application thread */
+static _Atomic uint64_t current_time = 0;
+
+EasTime eas_current_time_get()
+{
+    /* Wraps around after ~49 days, same as the zephyr implementation. EasTime module takes this into account. */
+    return (EasTime)atomic_load(&current_time);
+}
+
+uint32_t eas_current_time_get_cycles()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)(((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec);
+}
+
+void virtual_eas_current_time_set(uint64_t time)
+{
+    EAS_ASSERT(time >= atomic_load(&current_time));
+    atomic_store(&current_time, time);
+}
+
+uint64_t virtual_eas_current_time_get_uptime()
+{
+    return atomic_load(&current_time);
+}
@@ -0,0 +1,42 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_INTERFACES_IMPLEMENTATIONS_EAS_CURRENT_TIME_VIRTUAL_VIRTUAL_EAS_CURRENT_TIME_H
+#define ENV_ALERT_SYSTEM_SRC_INTERFACES_IMPLEMENTATIONS_EAS_CURRENT_TIME_VIRTUAL_VIRTUAL_EAS_CURRENT_TIME_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+#include "eas_current_time.h"
+
+/**
+ * @brief Defines an extension to the eas_current_time interface for simulations.
+ *
+ * Current time is a virtual clock that only moves when it is set. The simulation advances it, so that it can run
+ * faster than real time. The virtual clock never wraps around, unlike EasTime returned by @ref eas_current_time_get.
+ *
+ * The cycle counter is not virtual: it counts ns of the host monotonic clock, so that event handling times are
+ * measured in real time.
+ */
+
+/**
+ * @brief Set the virtual clock.
+ *
+ * @param time Time in ms since the simulated device was booted. Must not be smaller than the current value of the
+ * virtual clock - time cannot go backwards.
+ */
+void virtual_eas_current_time_set(uint64_t time);
+
+/**
+ * @brief Get the virtual clock.
+ *
+ * @return uint64_t Time in ms since the simulated device was booted.
+ */
+uint64_t virtual_eas_current_time_get_uptime();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_INTERFACES_IMPLEMENTATIONS_EAS_CURRENT_TIME_VIRTUAL_VIRTUAL_EAS_CURRENT_TIME_H */
@@ -9,3 +9,8 @@ EasTime eas_current_time_get()
      * implemented to operate on 32-bit time variables. */
     return k_uptime_get_32();
 }
+
+uint32_t eas_current_time_get_cycles()
+{
+    return k_cycle_get_32();
+}
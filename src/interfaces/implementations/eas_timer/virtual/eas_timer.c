@@ -0,0 +1,180 @@
+#include <stddef.h>
+#include <pthread.h>
+
+#include "virtual_eas_timer.h"
+#include "virtual_eas_current_time.h"
+#include "config.h"
+#include "eas_assert.h"
+#include "util.h"
+
+#ifndef CONFIG_EAS_TIMER_MAX_NUM_INSTANCES
+#define CONFIG_EAS_TIMER_MAX_NUM_INSTANCES 1
+#endif
+
+/* Every instance has one bit in pending_expiries */
+EAS_STATIC_ASSERT(CONFIG_EAS_TIMER_MAX_NUM_INSTANCES <= 32);
+
+struct EasTimerStruct {
+    uint32_t period_ms;
+    bool periodic;
+    EasTimerCb cb;
+    void *user_data;
+    /* Fields below are protected by mutex */
+    bool is_running;
+    /** Virtual uptime in ms at which the timer expires next, if it is running */
+    uint64_t expiry_time;
+};
+
+static struct EasTimerStruct instances[CONFIG_EAS_TIMER_MAX_NUM_INSTANCES];
+static size_t instance_idx = 0;
+
+/* Timers are started and stopped from the application thread and expired from the simulation thread */
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static EasTimerExecuteTimerExpiryFunctionCb execute_timer_expiry_function_cb = NULL;
+
+/** Bit i is set if instances[i] has expired, and its cb has not been executed yet. Protected by mutex. */
+static uint32_t pending_expiries = 0;
+
+/**
+ * @brief Find the running timer that expires first. Must be called with the mutex locked.
+ *
+ * Out of the timers with the same expiry time, the one that was created first is returned, so that simulations are
+ * deterministic.
+ *
+ * @return struct EasTimerStruct* Timer that expires first, or NULL if no timers are running.
+ */
+static struct EasTimerStruct *get_next_expiring_timer()
+{
+    struct EasTimerStruct *next = NULL;
+    for (size_t i = 0; i < instance_idx; i++) {
+        struct EasTimerStruct *instance = &instances[i];
+        if (instance->is_running && (!next || (instance->expiry_time < next->expiry_time))) {
+            next = instance;
+        }
+    }
+    return next;
+}
+
+/**
+ * @brief Execute the callbacks of all timers that have expired since the last time this function was executed.
+ *
+ * This is the only callback that is passed to the execute timer expiry function cb.
+ *
+ * @param user_data Not used.
+ */
+static void execute_pending_expiries(void *user_data)
+{
+    pthread_mutex_lock(&mutex);
+    /* Timers that expire from now on set their bits again, and the first of them passes this function to the execute
+     * timer expiry function cb again */
+    uint32_t pending = pending_expiries;
+    pending_expiries = 0;
+    size_t num_instances = instance_idx;
+    pthread_mutex_unlock(&mutex);
+
+    for (size_t i = 0; i < num_instances; i++) {
+        if (pending & ((uint32_t)1 << i)) {
+            instances[i].cb(instances[i].user_data);
+        }
+    }
+}
+
+void eas_timer_set_execute_timer_expiry_function_cb(EasTimerExecuteTimerExpiryFunctionCb cb)
+{
+    EAS_ASSERT(cb);
+    execute_timer_expiry_function_cb = cb;
+}
+
+EasTimer eas_timer_create(uint32_t period_ms, bool periodic, EasTimerCb cb, void *user_data)
+{
+    /* The only way to notify the caller about timer expiry is via cb, so it does not make sense to create a timer
+     * without a defined cb. */
+    EAS_ASSERT(cb);
+
+    EAS_ASSERT(instance_idx < CONFIG_EAS_TIMER_MAX_NUM_INSTANCES);
+    struct EasTimerStruct *instance = &instances[instance_idx];
+
+    instance->period_ms = period_ms;
+    instance->periodic = periodic;
+    instance->cb = cb;
+    instance->user_data = user_data;
+    instance->is_running = false;
+    instance->expiry_time = 0;
+
+    pthread_mutex_lock(&mutex);
+    /* Incremented under the mutex, because the simulation thread iterates over the created instances */
+    instance_idx++;
+    pthread_mutex_unlock(&mutex);
+    return instance;
+}
+
+void eas_timer_set_period(EasTimer self, uint32_t period_ms)
+{
+    EAS_ASSERT(self);
+    self->period_ms = period_ms;
+}
+
+void eas_timer_start(EasTimer self)
+{
+    /* Starting a timer is only allowed after the execute_timer_expiry_function_cb has been set, because
+     * execute_timer_expiry_function_cb will be called as a part of the timer's expiry. */
+    EAS_ASSERT(execute_timer_expiry_function_cb);
+    EAS_ASSERT(self);
+    /* This timer API is only for scheduling functions to execute in the future */
+    EAS_ASSERT(self->period_ms != 0);
+
+    pthread_mutex_lock(&mutex);
+    self->expiry_time = virtual_eas_current_time_get_uptime() + self->period_ms;
+    self->is_running = true;
+    pthread_mutex_unlock(&mutex);
+}
+
+void eas_timer_stop(EasTimer self)
+{
+    EAS_ASSERT(self);
+
+    pthread_mutex_lock(&mutex);
+    self->is_running = false;
+    pthread_mutex_unlock(&mutex);
+}
+
+bool virtual_eas_timer_get_next_expiry_time(uint64_t *const time)
+{
+    EAS_ASSERT(time);
+
+    pthread_mutex_lock(&mutex);
+    const struct EasTimerStruct *next = get_next_expiring_timer();
+    if (next) {
+        *time = next->expiry_time;
+    }
+    pthread_mutex_unlock(&mutex);
+    return (next != NULL);
+}
+
+void virtual_eas_timer_expire(uint64_t time)
+{
+    EAS_ASSERT(execute_timer_expiry_function_cb);
+
+    while (true) {
+        pthread_mutex_lock(&mutex);
+        struct EasTimerStruct *next = get_next_expiring_timer();
+        if (!next || (next->expiry_time > time)) {
+            pthread_mutex_unlock(&mutex);
+            break;
+        }
+        if (next->periodic) {
+            next->expiry_time += next->period_ms;
+        } else {
+            next->is_running = false;
+        }
+        bool is_first_pending_expiry = (pending_expiries == 0);
+        pending_expiries |= (uint32_t)1 << (next - instances);
+        pthread_mutex_unlock(&mutex);
+
+        /* Only the first expiry after the pending expiries have been executed needs to schedule their execution */
+        if (is_first_pending_expiry) {
+            execute_timer_expiry_function_cb(execute_pending_expiries, NULL);
+        }
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_INTERFACES_IMPLEMENTATIONS_EAS_TIMER_VIRTUAL_VIRTUAL_EAS_TIMER_H
+#define ENV_ALERT_SYSTEM_SRC_INTERFACES_IMPLEMENTATIONS_EAS_TIMER_VIRTUAL_VIRTUAL_EAS_TIMER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "eas_timer.h"
+
+/**
+ * @brief Defines an extension to the eas_timer interface for simulations.
+ *
+ * Timers run on the virtual clock of the virtual eas_current_time implementation. Nothing expires on its own: the
+ * simulation asks for the next expiry time, advances the virtual clock to it, and expires the timers.
+ */
+
+/**
+ * @brief Get the time at which the next running timer expires.
+ *
+ * @param[out] time If true is returned, the expiry time in ms of virtual uptime is written to this parameter.
+ *
+ * @return true There is at least one running timer.
+ * @return false No timers are running.
+ */
+bool virtual_eas_timer_get_next_expiry_time(uint64_t *const time);
+
+/**
+ * @brief Expire all timers that expire at or before @p time.
+ *
+ * Expired timers are marked as pending, in the order of their expiry times. The execute timer expiry function cb is
+ * executed from the context of the caller for the first pending expiry only, and executes the callbacks of all pending
+ * timers in one go, in the order in which the timers were created. Periodic timers are restarted, one-shot timers are
+ * stopped.
+ *
+ * @param time Time in ms of virtual uptime.
+ */
+void virtual_eas_timer_expire(uint64_t time);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_INTERFACES_IMPLEMENTATIONS_EAS_TIMER_VIRTUAL_VIRTUAL_EAS_TIMER_H */
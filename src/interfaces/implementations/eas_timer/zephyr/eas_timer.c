@@ -1,13 +1,18 @@
 #include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
 
 #include "eas_timer.h"
 #include "config.h"
 #include "eas_assert.h"
+#include "util.h"
 
 #ifndef CONFIG_EAS_TIMER_MAX_NUM_INSTANCES
 #define CONFIG_EAS_TIMER_MAX_NUM_INSTANCES 1
 #endif
 
+/* Every instance has one bit in pending_expiries */
+EAS_STATIC_ASSERT(CONFIG_EAS_TIMER_MAX_NUM_INSTANCES <= 32);
+
 struct EasTimerStruct {
     struct k_timer timer;
     uint32_t period_ms;
@@ -21,9 +26,36 @@ static size_t instance_idx = 0;
 
 static EasTimerExecuteTimerExpiryFunctionCb execute_timer_expiry_function_cb = NULL;
 
+/** Bit i is set if instances[i] has expired, and its cb has not been executed yet. Set from ISR context, cleared from
+ * the context in which the execute timer expiry function cb executes the expiry callbacks. */
+static atomic_t pending_expiries = ATOMIC_INIT(0);
+
+/**
+ * @brief Execute the callbacks of all timers that have expired since the last time this function was executed.
+ *
+ * This is the only callback that is passed to the execute timer expiry function cb.
+ *
+ * @param user_data Not used.
+ */
+static void execute_pending_expiries(void *user_data)
+{
+    /* Timers that expire from now on set their bits again, and the first of them passes this function to the execute
+     * timer expiry function cb again */
+    uint32_t pending = (uint32_t)atomic_clear(&pending_expiries);
+    for (size_t i = 0; i < instance_idx; i++) {
+        if (pending & BIT(i)) {
+            instances[i].cb(instances[i].user_data);
+        }
+    }
+}
+
 /**
  * @brief This function serves as expiry function for every zephyr timer.
  *
+ * Marks the timer as expired. Only the first expiry after the pending expiries have been executed calls the execute
+ * timer expiry function cb, so there is at most one pending call to execute_pending_expiries, however many timers
+ * expire at the same time. If a timer expires again before its pending expiry is executed, its cb is executed once.
+ *
  * @param timer Address of zephyr timer which is a part of our EasTimerStruct.
  *
  * @note This function is executed from ISR context.
@@ -34,7 +66,11 @@ static void zephyr_timer_expiry_function(struct k_timer *timer)
     EAS_ASSERT(self);
     EAS_ASSERT(self->cb);
     EAS_ASSERT(execute_timer_expiry_function_cb);
-    execute_timer_expiry_function_cb(self->cb, self->user_data);
+    atomic_val_t instance_bit = (atomic_val_t)BIT(self - instances);
+    atomic_val_t previous_pending_expiries = atomic_or(&pending_expiries, instance_bit);
+    if (previous_pending_expiries == 0) {
+        execute_timer_expiry_function_cb(execute_pending_expiries, NULL);
+    }
 }
 
 void eas_timer_set_execute_timer_expiry_function_cb(EasTimerExecuteTimerExpiryFunctionCb cb)
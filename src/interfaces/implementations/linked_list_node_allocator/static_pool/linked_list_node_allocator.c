@@ -0,0 +1,56 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "linked_list_node_allocator.h"
+#include "config.h"
+#include "eas_assert.h"
+
+/* Host implementation of the zephyr memory blocks allocator: a fixed pool of blocks and a stack of free block ids.
+ * Only used from the central event queue thread, so no locking is needed. */
+
+static LinkedListNode blocks[CONFIG_LINKED_LIST_NODE_ALLOCATOR_NUM_NODES];
+static size_t free_block_ids[CONFIG_LINKED_LIST_NODE_ALLOCATOR_NUM_NODES];
+static size_t num_free_blocks = 0;
+static bool is_block_allocated[CONFIG_LINKED_LIST_NODE_ALLOCATOR_NUM_NODES];
+static bool is_initialized = false;
+
+/** Push all blocks to the stack of free blocks. Done on the first allocation, because there is no init function. */
+static void initialize()
+{
+    for (size_t i = 0; i < CONFIG_LINKED_LIST_NODE_ALLOCATOR_NUM_NODES; i++) {
+        /* Reversed, so that blocks are allocated in the order of their addresses */
+        free_block_ids[i] = CONFIG_LINKED_LIST_NODE_ALLOCATOR_NUM_NODES - 1 - i;
+    }
+    num_free_blocks = CONFIG_LINKED_LIST_NODE_ALLOCATOR_NUM_NODES;
+    is_initialized = true;
+}
+
+static LinkedListNode *static_pool_linked_list_node_allocator_alloc()
+{
+    if (!is_initialized) {
+        initialize();
+    }
+    if (num_free_blocks == 0) {
+        return NULL;
+    }
+    size_t block_id = free_block_ids[--num_free_blocks];
+    is_block_allocated[block_id] = true;
+    return &blocks[block_id];
+}
+
+static void static_pool_linked_list_node_allocator_free(LinkedListNode *linked_list_node)
+{
+    EAS_ASSERT(is_initialized);
+    uintptr_t offset = (uintptr_t)linked_list_node - (uintptr_t)blocks;
+    EAS_ASSERT((offset % sizeof(LinkedListNode)) == 0);
+    size_t block_id = offset / sizeof(LinkedListNode);
+    EAS_ASSERT(block_id < CONFIG_LINKED_LIST_NODE_ALLOCATOR_NUM_NODES);
+    EAS_ASSERT(is_block_allocated[block_id]);
+
+    is_block_allocated[block_id] = false;
+    free_block_ids[num_free_blocks++] = block_id;
+}
+
+LinkedListNode *(*linked_list_node_allocator_alloc)() = static_pool_linked_list_node_allocator_alloc;
+void (*linked_list_node_allocator_free)(LinkedListNode *linked_list_node) = static_pool_linked_list_node_allocator_free;
@@ -0,0 +1,175 @@
+#include <stdbool.h>
+#include <pthread.h>
+
+#include "osal/eas_slot_queue.h"
+#include "config.h"
+#include "eas_assert.h"
+
+/* Host implementation. There are no ISRs on the host, so producers are threads (or the consumer thread itself), and
+ * all shared state is protected by a mutex. */
+
+#ifndef CONFIG_EAS_SLOT_QUEUE_MAX_NUM_INSTANCES
+#define CONFIG_EAS_SLOT_QUEUE_MAX_NUM_INSTANCES 1
+#endif
+
+#ifndef CONFIG_EAS_SLOT_QUEUE_MAX_NUM_SLOTS
+#define CONFIG_EAS_SLOT_QUEUE_MAX_NUM_SLOTS 1
+#endif
+
+struct EasSlotQueueStruct {
+    uint8_t *buf;
+    size_t slot_size;
+    size_t num_slots;
+    /* Fields below are protected by mutex */
+    pthread_mutex_t mutex;
+    /** Signaled whenever a slot is committed */
+    pthread_cond_t commit_cond;
+    /** Index of the oldest reserved slot */
+    size_t head;
+    /** Index of the slot that is going to be reserved next */
+    size_t tail;
+    size_t num_reserved_slots;
+    /** Highest value num_reserved_slots has ever had */
+    size_t high_watermark;
+    bool is_committed[CONFIG_EAS_SLOT_QUEUE_MAX_NUM_SLOTS];
+};
+
+static struct EasSlotQueueStruct instances[CONFIG_EAS_SLOT_QUEUE_MAX_NUM_INSTANCES];
+static size_t instance_idx = 0;
+
+/**
+ * @brief Check whether a queue can be created with a number of slots.
+ *
+ * @param num_slots Number of slots.
+ *
+ * @return true Number of slots is valid.
+ * @return false Number of slots is 0 or exceeds CONFIG_EAS_SLOT_QUEUE_MAX_NUM_SLOTS.
+ */
+static bool is_valid_num_slots(size_t num_slots)
+{
+    return ((num_slots > 0) && (num_slots <= CONFIG_EAS_SLOT_QUEUE_MAX_NUM_SLOTS));
+}
+
+/**
+ * @brief Get slot address.
+ *
+ * @param self Slot queue instance.
+ * @param slot_idx Slot index.
+ *
+ * @return uint8_t* Address of the first byte of the slot.
+ */
+static uint8_t *get_slot(EasSlotQueue self, size_t slot_idx)
+{
+    return &(self->buf[slot_idx * self->slot_size]);
+}
+
+/**
+ * @brief Check whether the oldest reserved slot is committed. Must be called with the mutex locked.
+ *
+ * @param self Slot queue instance.
+ *
+ * @return true The oldest reserved slot is committed.
+ * @return false There are no reserved slots, or the oldest reserved slot is not committed yet.
+ */
+static bool is_head_committed(EasSlotQueue self)
+{
+    return ((self->num_reserved_slots > 0) && self->is_committed[self->head]);
+}
+
+EasSlotQueue eas_slot_queue_create(uint8_t *const buf, size_t slot_size, size_t num_slots)
+{
+    EAS_ASSERT(buf);
+    EAS_ASSERT(slot_size > 0);
+    EAS_ASSERT(is_valid_num_slots(num_slots));
+
+    EAS_ASSERT(instance_idx < CONFIG_EAS_SLOT_QUEUE_MAX_NUM_INSTANCES);
+    struct EasSlotQueueStruct *instance = &instances[instance_idx];
+    instance_idx++;
+
+    instance->buf = buf;
+    instance->slot_size = slot_size;
+    instance->num_slots = num_slots;
+    instance->head = 0;
+    instance->tail = 0;
+    instance->num_reserved_slots = 0;
+    instance->high_watermark = 0;
+    for (size_t i = 0; i < num_slots; i++) {
+        instance->is_committed[i] = false;
+    }
+    pthread_mutex_init(&(instance->mutex), NULL);
+    pthread_cond_init(&(instance->commit_cond), NULL);
+
+    return instance;
+}
+
+void *eas_slot_queue_reserve(EasSlotQueue self)
+{
+    EAS_ASSERT(self);
+
+    void *slot = NULL;
+    pthread_mutex_lock(&(self->mutex));
+    if (self->num_reserved_slots < self->num_slots) {
+        slot = get_slot(self, self->tail);
+        self->tail = (self->tail + 1) % self->num_slots;
+        self->num_reserved_slots++;
+        if (self->num_reserved_slots > self->high_watermark) {
+            self->high_watermark = self->num_reserved_slots;
+        }
+    }
+    pthread_mutex_unlock(&(self->mutex));
+    return slot;
+}
+
+void eas_slot_queue_commit(EasSlotQueue self, void *const slot)
+{
+    EAS_ASSERT(self);
+    EAS_ASSERT(slot);
+    size_t offset = (size_t)((uint8_t *)slot - self->buf);
+    EAS_ASSERT((offset % self->slot_size) == 0);
+    size_t slot_idx = offset / self->slot_size;
+    EAS_ASSERT(slot_idx < self->num_slots);
+
+    pthread_mutex_lock(&(self->mutex));
+    self->is_committed[slot_idx] = true;
+    pthread_cond_signal(&(self->commit_cond));
+    pthread_mutex_unlock(&(self->mutex));
+}
+
+void *eas_slot_queue_get(EasSlotQueue self)
+{
+    EAS_ASSERT(self);
+
+    pthread_mutex_lock(&(self->mutex));
+    while (!is_head_committed(self)) {
+        pthread_cond_wait(&(self->commit_cond), &(self->mutex));
+    }
+    void *slot = get_slot(self, self->head);
+    pthread_mutex_unlock(&(self->mutex));
+    return slot;
+}
+
+void eas_slot_queue_release(EasSlotQueue self)
+{
+    EAS_ASSERT(self);
+
+    pthread_mutex_lock(&(self->mutex));
+    bool is_slot_to_release_committed = is_head_committed(self);
+    if (is_slot_to_release_committed) {
+        self->is_committed[self->head] = false;
+        self->head = (self->head + 1) % self->num_slots;
+        self->num_reserved_slots--;
+    }
+    pthread_mutex_unlock(&(self->mutex));
+    /* Releasing a slot that was not returned by eas_slot_queue_get */
+    EAS_ASSERT(is_slot_to_release_committed);
+}
+
+size_t eas_slot_queue_get_high_watermark(EasSlotQueue self)
+{
+    EAS_ASSERT(self);
+
+    pthread_mutex_lock(&(self->mutex));
+    size_t high_watermark = self->high_watermark;
+    pthread_mutex_unlock(&(self->mutex));
+    return high_watermark;
+}
@@ -0,0 +1,180 @@
+#include <stdbool.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+
+#include "osal/eas_slot_queue.h"
+#include "config.h"
+#include "eas_assert.h"
+
+#ifndef CONFIG_EAS_SLOT_QUEUE_MAX_NUM_INSTANCES
+#define CONFIG_EAS_SLOT_QUEUE_MAX_NUM_INSTANCES 1
+#endif
+
+#ifndef CONFIG_EAS_SLOT_QUEUE_MAX_NUM_SLOTS
+#define CONFIG_EAS_SLOT_QUEUE_MAX_NUM_SLOTS 1
+#endif
+
+struct EasSlotQueueStruct {
+    uint8_t *buf;
+    size_t slot_size;
+    size_t num_slots;
+    /* Fields below are protected by lock */
+    struct k_spinlock lock;
+    /** Index of the oldest reserved slot */
+    size_t head;
+    /** Index of the slot that is going to be reserved next */
+    size_t tail;
+    size_t num_reserved_slots;
+    /** Highest value num_reserved_slots has ever had */
+    size_t high_watermark;
+    bool is_committed[CONFIG_EAS_SLOT_QUEUE_MAX_NUM_SLOTS];
+    /** Given whenever a slot is committed. Used as a binary semaphore: the consumer always checks whether the oldest
+     * slot is committed before blocking on it, so it is enough to remember that at least one commit happened. */
+    struct k_sem commit_sem;
+};
+
+static struct EasSlotQueueStruct instances[CONFIG_EAS_SLOT_QUEUE_MAX_NUM_INSTANCES];
+static size_t instance_idx = 0;
+
+/**
+ * @brief Check whether a queue can be created with a number of slots.
+ *
+ * @param num_slots Number of slots.
+ *
+ * @return true Number of slots is valid.
+ * @return false Number of slots is 0 or exceeds CONFIG_EAS_SLOT_QUEUE_MAX_NUM_SLOTS.
+ */
+static bool is_valid_num_slots(size_t num_slots)
+{
+    return ((num_slots > 0) && (num_slots <= CONFIG_EAS_SLOT_QUEUE_MAX_NUM_SLOTS));
+}
+
+/**
+ * @brief Get slot address.
+ *
+ * @param self Slot queue instance.
+ * @param slot_idx Slot index.
+ *
+ * @return uint8_t* Address of the first byte of the slot.
+ */
+static uint8_t *get_slot(EasSlotQueue self, size_t slot_idx)
+{
+    return &(self->buf[slot_idx * self->slot_size]);
+}
+
+/**
+ * @brief Check whether the oldest reserved slot is committed. Must be called with the lock held.
+ *
+ * @param self Slot queue instance.
+ *
+ * @return true The oldest reserved slot is committed.
+ * @return false There are no reserved slots, or the oldest reserved slot is not committed yet.
+ */
+static bool is_head_committed(EasSlotQueue self)
+{
+    return ((self->num_reserved_slots > 0) && self->is_committed[self->head]);
+}
+
+EasSlotQueue eas_slot_queue_create(uint8_t *const buf, size_t slot_size, size_t num_slots)
+{
+    EAS_ASSERT(buf);
+    EAS_ASSERT(slot_size > 0);
+    EAS_ASSERT(is_valid_num_slots(num_slots));
+
+    EAS_ASSERT(instance_idx < CONFIG_EAS_SLOT_QUEUE_MAX_NUM_INSTANCES);
+    struct EasSlotQueueStruct *instance = &instances[instance_idx];
+    instance_idx++;
+
+    instance->buf = buf;
+    instance->slot_size = slot_size;
+    instance->num_slots = num_slots;
+    instance->head = 0;
+    instance->tail = 0;
+    instance->num_reserved_slots = 0;
+    instance->high_watermark = 0;
+    for (size_t i = 0; i < num_slots; i++) {
+        instance->is_committed[i] = false;
+    }
+    k_sem_init(&(instance->commit_sem), 0, 1);
+
+    return instance;
+}
+
+void *eas_slot_queue_reserve(EasSlotQueue self)
+{
+    EAS_ASSERT(self);
+
+    void *slot = NULL;
+    k_spinlock_key_t key = k_spin_lock(&(self->lock));
+    if (self->num_reserved_slots < self->num_slots) {
+        slot = get_slot(self, self->tail);
+        self->tail = (self->tail + 1) % self->num_slots;
+        self->num_reserved_slots++;
+        if (self->num_reserved_slots > self->high_watermark) {
+            self->high_watermark = self->num_reserved_slots;
+        }
+    }
+    k_spin_unlock(&(self->lock), key);
+    return slot;
+}
+
+void eas_slot_queue_commit(EasSlotQueue self, void *const slot)
+{
+    EAS_ASSERT(self);
+    EAS_ASSERT(slot);
+    size_t offset = (size_t)((uint8_t *)slot - self->buf);
+    EAS_ASSERT((offset % self->slot_size) == 0);
+    size_t slot_idx = offset / self->slot_size;
+    EAS_ASSERT(slot_idx < self->num_slots);
+
+    k_spinlock_key_t key = k_spin_lock(&(self->lock));
+    self->is_committed[slot_idx] = true;
+    k_spin_unlock(&(self->lock), key);
+    k_sem_give(&(self->commit_sem));
+}
+
+void *eas_slot_queue_get(EasSlotQueue self)
+{
+    EAS_ASSERT(self);
+
+    while (1) {
+        k_spinlock_key_t key = k_spin_lock(&(self->lock));
+        bool is_slot_committed = is_head_committed(self);
+        uint8_t *slot = get_slot(self, self->head);
+        k_spin_unlock(&(self->lock), key);
+
+        if (is_slot_committed) {
+            return slot;
+        }
+        /* Blocks until the next commit. If a commit happened after the check above, this returns immediately and the
+         * slot is checked again. */
+        k_sem_take(&(self->commit_sem), K_FOREVER);
+    }
+}
+
+void eas_slot_queue_release(EasSlotQueue self)
+{
+    EAS_ASSERT(self);
+
+    k_spinlock_key_t key = k_spin_lock(&(self->lock));
+    bool is_slot_to_release_committed = is_head_committed(self);
+    if (is_slot_to_release_committed) {
+        self->is_committed[self->head] = false;
+        self->head = (self->head + 1) % self->num_slots;
+        self->num_reserved_slots--;
+    }
+    k_spin_unlock(&(self->lock), key);
+    /* Releasing a slot that was not returned by eas_slot_queue_get */
+    EAS_ASSERT(is_slot_to_release_committed);
+}
+
+size_t eas_slot_queue_get_high_watermark(EasSlotQueue self)
+{
+    EAS_ASSERT(self);
+
+    k_spinlock_key_t key = k_spin_lock(&(self->lock));
+    size_t high_watermark = self->high_watermark;
+    k_spin_unlock(&(self->lock), key);
+    return high_watermark;
+}
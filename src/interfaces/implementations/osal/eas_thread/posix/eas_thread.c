@@ -0,0 +1,34 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <pthread.h>
+
+#include "osal/eas_thread.h"
+#include "eas_assert.h"
+
+/* Host implementation. Stack size and priority configs of the zephyr implementation are not used - the default pthread
+ * attributes are good enough on the host. */
+
+static pthread_t thread;
+
+static EasThreadRunFunction eas_thread_run_function;
+static bool is_created = false;
+
+static void *eas_thread_entry_point(void *arg)
+{
+    EAS_ASSERT(eas_thread_run_function);
+    eas_thread_run_function();
+    return NULL;
+}
+
+void eas_thread_create(EasThreadRunFunction run_function)
+{
+    EAS_ASSERT(run_function);
+    /* The implementation currently only supports creating one thread, assert if this function is called more than once
+     */
+    EAS_ASSERT(!is_created);
+
+    eas_thread_run_function = run_function;
+    is_created = true;
+    int ret = pthread_create(&thread, NULL, eas_thread_entry_point, NULL);
+    EAS_ASSERT(ret == 0);
+}
@@ -0,0 +1,60 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "variable_requirement_allocator.h"
+#include "config.h"
+#include "eas_assert.h"
+
+/* Host implementation of the zephyr memory blocks allocator: a fixed pool of blocks and a stack of free block ids.
+ * Only used from the central event queue thread, so no locking is needed. */
+
+/** Aligned for any type, same as memory returned by malloc, so that every variable requirement implementation can be
+ * stored in it. */
+typedef union VariableRequirementAllocatorBlock {
+    uint8_t buf[CONFIG_VARIABLE_REQUIREMENT_MAX_SIZE];
+    max_align_t alignment;
+} VariableRequirementAllocatorBlock;
+
+static VariableRequirementAllocatorBlock blocks[CONFIG_VARIABLE_REQUIREMENT_ALLOCATOR_NUM_REQUIREMENTS];
+static size_t free_block_ids[CONFIG_VARIABLE_REQUIREMENT_ALLOCATOR_NUM_REQUIREMENTS];
+static size_t num_free_blocks = 0;
+static bool is_block_allocated[CONFIG_VARIABLE_REQUIREMENT_ALLOCATOR_NUM_REQUIREMENTS];
+static bool is_initialized = false;
+
+/** Push all blocks to the stack of free blocks. Done on the first allocation, because there is no init function. */
+static void initialize()
+{
+    for (size_t i = 0; i < CONFIG_VARIABLE_REQUIREMENT_ALLOCATOR_NUM_REQUIREMENTS; i++) {
+        /* Reversed, so that blocks are allocated in the order of their addresses */
+        free_block_ids[i] = CONFIG_VARIABLE_REQUIREMENT_ALLOCATOR_NUM_REQUIREMENTS - 1 - i;
+    }
+    num_free_blocks = CONFIG_VARIABLE_REQUIREMENT_ALLOCATOR_NUM_REQUIREMENTS;
+    is_initialized = true;
+}
+
+void *variable_requirement_allocator_alloc()
+{
+    if (!is_initialized) {
+        initialize();
+    }
+    if (num_free_blocks == 0) {
+        return NULL;
+    }
+    size_t block_id = free_block_ids[--num_free_blocks];
+    is_block_allocated[block_id] = true;
+    return &blocks[block_id];
+}
+
+void variable_requirement_allocator_free(void *buf)
+{
+    EAS_ASSERT(is_initialized);
+    uintptr_t offset = (uintptr_t)buf - (uintptr_t)blocks;
+    EAS_ASSERT((offset % sizeof(VariableRequirementAllocatorBlock)) == 0);
+    size_t block_id = offset / sizeof(VariableRequirementAllocatorBlock);
+    EAS_ASSERT(block_id < CONFIG_VARIABLE_REQUIREMENT_ALLOCATOR_NUM_REQUIREMENTS);
+    EAS_ASSERT(is_block_allocated[block_id]);
+
+    is_block_allocated[block_id] = false;
+    free_block_ids[num_free_blocks++] = block_id;
+}
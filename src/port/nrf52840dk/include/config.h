@@ -9,27 +9,34 @@
 #define CONFIG_PRESSURE_VALUE_MAX_NUM_INSTANCES 1
 #define CONFIG_HUMIDITY_VALUE_MAX_NUM_INSTANCES 1
 #define CONFIG_LIGHT_INTENSITY_VALUE_MAX_NUM_INSTANCES 1
-/* One for led manager, one for each variable requirement list (four lists, one for each variable) */
-#define CONFIG_LINKED_LIST_MAX_NUM_INSTANCES 5
+/* Linked lists are not used by the application. 1 so that the linked list module compiles. */
+#define CONFIG_LINKED_LIST_MAX_NUM_INSTANCES 1
 /* One for each variable */
 #define CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_INSTANCES 4
 #define CONFIG_ALERT_CONDITION_MAX_NUM_INSTANCES CONFIG_MAX_NUM_ALERTS
 #define CONFIG_ALERT_RAISER_MAX_NUM_INSTANCES CONFIG_MAX_NUM_ALERTS
-/* Each alert raiser creates two timer instances - warmup timer and cooldown timer. +8 is for:
- *   1. LedManager - it uses one timer instance to switch between LED notifications.
- *   2. HwPlatform - uses one timer to implement timer interface for SHT3X driver.
- *   3. VirtualSHT31 - uses a timer to periodically read out measurements from SHT31 sensor.
- *   4. HwPlatform - uses one timer to implement timer interface for BH1750 driver.
- *   5. VirtualBH1750 - uses a timer to periodically read out measurements from BH1750 sensor.
- *   6. HwPlatform - uses one timer to implement timer interface for BMP280 driver.
- *   7. VirtualBMP280 - uses a timer to periodically read out measurements from BMP280 sensor.
- *   8. HwPlatform - internal timer to use during initialization.
+/* Each alert raiser creates two timer wheel timers - warmup timer and cooldown timer. */
+#define CONFIG_TIMER_WHEEL_MAX_NUM_TIMERS (CONFIG_ALERT_RAISER_MAX_NUM_INSTANCES * 2)
+/* 9 timers:
+ *   1. TimerWheel - one timer drives all timer wheel timers.
+ *   2. LedManager - it uses one timer instance to switch between LED notifications.
+ *   3. HwPlatform - uses one timer to implement timer interface for SHT3X driver.
+ *   4. VirtualSHT31 - uses a timer to periodically read out measurements from SHT31 sensor.
+ *   5. HwPlatform - uses one timer to implement timer interface for BH1750 driver.
+ *   6. VirtualBH1750 - uses a timer to periodically read out measurements from BH1750 sensor.
+ *   7. HwPlatform - uses one timer to implement timer interface for BMP280 driver.
+ *   8. VirtualBMP280 - uses a timer to periodically read out measurements from BMP280 sensor.
+ *   9. HwPlatform - internal timer to use during initialization.
  */
-#define CONFIG_EAS_TIMER_MAX_NUM_INSTANCES ((CONFIG_ALERT_RAISER_MAX_NUM_INSTANCES * 2) + 8)
+#define CONFIG_EAS_TIMER_MAX_NUM_INSTANCES 9
 /* One for queue of I2C operations in hw_platform */
 #define CONFIG_OPS_QUEUE_MAX_NUM_INSTANCES 1
-/* Used by the ops_queue instance */
+/* Used by sample history */
 #define CONFIG_EAS_RING_BUF_MAX_NUM_INSTANCES 1
+/* I2C queue in hw_platform holds at most 3 pending operations */
+#define CONFIG_OPS_QUEUE_MAX_NUM_PENDING_OPS 3
+/* One for hw_platform init steps */
+#define CONFIG_INIT_GRAPH_MAX_NUM_INSTANCES 1
 
 /* Chosen through trial and error. If set too low, static asserts will fire. */
 #define CONFIG_VARIABLE_REQUIREMENT_MAX_SIZE 16
@@ -41,20 +48,38 @@
 #define CONFIG_MSG_TRANSCEIVER_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION                                        \
     CONFIG_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION
 
+#define CONFIG_MAX_ALERT_CONDITION_EXPRESSION_DEPTH 4
+
+#define CONFIG_ALERT_CONDITION_MAX_EXPRESSION_DEPTH CONFIG_MAX_ALERT_CONDITION_EXPRESSION_DEPTH
+
+#define CONFIG_MSG_TRANSCEIVER_MAX_EXPRESSION_DEPTH CONFIG_MAX_ALERT_CONDITION_EXPRESSION_DEPTH
+
 #define CONFIG_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS                                                                     \
     (CONFIG_MAX_NUM_ALERTS * CONFIG_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION)
 
+/* Two band requirements per alert on average. Every variable requirement list reserves an entry for each of them. */
+#define CONFIG_MAX_TOTAL_NUM_BAND_REQUIREMENTS (2 * CONFIG_MAX_NUM_ALERTS)
+
+#define CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS CONFIG_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS
+
+#define CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_BAND_REQUIREMENTS CONFIG_MAX_TOTAL_NUM_BAND_REQUIREMENTS
+
 #define CONFIG_VARIABLE_REQUIREMENT_ALLOCATOR_NUM_REQUIREMENTS CONFIG_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS
 
+#define CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_REQUIREMENTS                                                          \
+    (CONFIG_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS + CONFIG_MAX_TOTAL_NUM_BAND_REQUIREMENTS)
+
+#define CONFIG_ALERT_SLOTS_NUM_SLOTS CONFIG_MAX_NUM_ALERTS
+
 #define CONFIG_ALERT_CONDITIONS_NUM_INSTANCES_TO_CREATE CONFIG_MAX_NUM_ALERTS
 
 #define CONFIG_ALERT_RAISERS_NUM_INSTANCES_TO_CREATE CONFIG_MAX_NUM_ALERTS
 
-#define CONFIG_ALERT_VALIDATOR_MAX_ALLOWED_ALERT_ID (CONFIG_MAX_NUM_ALERTS - 1)
+#define CONFIG_ALERT_VALIDATOR_MAX_ALLOWED_ALERT_ID UINT16_MAX
 
-#define CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS CONFIG_MAX_NUM_ALERTS
+#define CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS CONFIG_ALERT_SLOTS_NUM_SLOTS
 
-#define CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS CONFIG_MAX_NUM_ALERTS
+#define CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS CONFIG_ALERT_SLOTS_NUM_SLOTS
 
 #define CONFIG_LED_MANAGER_NOTIFICATION_DURATION_SECONDS 5
 
@@ -63,19 +88,70 @@
 /** Set to CONFIG_MAX_NUM_ALERTS * 2, since in theory every registered alert can change status at the same time.
  * Multiplied by 2 to be on the safe side and allow for a margin.
  */
-#define CONFIG_MSG_TRANSCEIVER_MAX_NUM_CONCURRENT_ALERT_STATUS_CHANGE_MESSAGES (CONFIG_MAX_NUM_ALERTS * 2)
-
-/** Should be plenty to store all events that can in theory happen at the same time */
-#define CONFIG_CENTRAL_EVENT_QUEUE_MESSAGE_QUEUE_BUF_SIZE 1024
+#define CONFIG_MSG_TRANSCEIVER_NUM_RESERVED_MESSAGE_SLOTS (CONFIG_MAX_NUM_ALERTS * 2)
 
-#define CONFIG_LINKED_LIST_NODE_ALLOCATOR_NUM_NODES (CONFIG_MAX_NUM_ALERTS + CONFIG_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS)
-
-#define CONFIG_LED_NOTIFICATION_ALLOCATOR_NUM_NOTIFICATIONS CONFIG_MAX_NUM_ALERTS
+/** The reserved slots, plus one slot for the stats report and one for the sample history read-out. Each of them has at
+ * most one message in progress.
+ */
+#define CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS (CONFIG_MSG_TRANSCEIVER_NUM_RESERVED_MESSAGE_SLOTS + 2)
+
+/* With the default ATT MTU of 23 bytes, a BLE notification carries at most 20 bytes: 2 header bytes and 6 records. */
+#define CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERT_STATUS_CHANGES_IN_MESSAGE 6
+
+#define CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERTS_IN_REPLACE_ALL_ALERTS_MESSAGE CONFIG_MAX_NUM_ALERTS
+
+/** Should be plenty to store all events that can in theory happen at the same time. Check the high-watermark reported
+ * in the "event queue stats" message before making it smaller. */
+#define CONFIG_CENTRAL_EVENT_QUEUE_NUM_SLOTS 64
+
+/** Alerts are evaluated on the current values of the variables, so samples that were already replaced by newer ones do
+ * not need to be handled. */
+#define CONFIG_CENTRAL_EVENT_QUEUE_COALESCE_SAMPLES 1
+
+/* Linked lists are not used by the application */
+#define CONFIG_LINKED_LIST_NODE_ALLOCATOR_NUM_NODES 1
+
+/** Warmup and cooldown periods are configured in ms, but are expected to be at least several seconds long in practice.
+ * 100 ms precision is plenty for them. */
+#define CONFIG_TIMER_WHEEL_TICK_MS 100
+
+/** One revolution takes 6.4 seconds */
+#define CONFIG_TIMER_WHEEL_NUM_SLOTS 64
+
+/** 4 KB of sample history. Temperature, pressure and humidity are recorded in steps of 0.5 °C, 0.5 hPa and 2% RH,
+ * light intensity in steps of 100 lx, and each variable at most once a minute. The 24 h sim run keeps the last 12.5 h,
+ * with about 930 records of 4.4 bytes each. When every variable changes every minute, it still keeps about 3.5 h. */
+#define CONFIG_SAMPLE_HISTORY_BLOCK_SIZE 128
+#define CONFIG_SAMPLE_HISTORY_NUM_BLOCKS 32
+#define CONFIG_SAMPLE_HISTORY_MIN_INTERVAL_MS 60000
+#define CONFIG_SAMPLE_HISTORY_TEMPERATURE_MIN_CHANGE 5
+#define CONFIG_SAMPLE_HISTORY_PRESSURE_MIN_CHANGE 5
+#define CONFIG_SAMPLE_HISTORY_HUMIDITY_MIN_CHANGE 20
+#define CONFIG_SAMPLE_HISTORY_LIGHT_INTENSITY_MIN_CHANGE 100
+
+/** Temperature and humidity change slowly, unless the device is moved - 0.5 degrees and 2 % per second are generous
+ * upper bounds. Far from requirement values, they are read out every 10 seconds. */
+#define CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MIN_PERIOD_MS 250
+#define CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_PERIOD_MS 10000
+#define CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_RATE_OF_CHANGE 5
+#define CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MIN_PERIOD_MS 250
+#define CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MAX_PERIOD_MS 10000
+#define CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MAX_RATE_OF_CHANGE 20
+/** 0.5 hPa per second */
+#define CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MIN_PERIOD_MS 1000
+#define CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MAX_PERIOD_MS 30000
+#define CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MAX_RATE_OF_CHANGE 5
+/** Light intensity changes instantly when a light is switched on or off, so its readout period is fixed */
+#define CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MIN_PERIOD_MS 1000
+#define CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MAX_PERIOD_MS 1000
+#define CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MAX_RATE_OF_CHANGE 1
 
 /* Configs for port-specific modules */
 
-/** Only one message queue is used - in the central event queue. */
-#define CONFIG_EAS_MESSAGE_QUEUE_MAX_NUM_INSTANCES 1
+/** Only one slot queue is used - in the central event queue. */
+#define CONFIG_EAS_SLOT_QUEUE_MAX_NUM_INSTANCES 1
+
+#define CONFIG_EAS_SLOT_QUEUE_MAX_NUM_SLOTS CONFIG_CENTRAL_EVENT_QUEUE_NUM_SLOTS
 
 /** Default value, kind of random */
 #define CONFIG_EAS_THREAD_STACK_SIZE 1024
@@ -0,0 +1,564 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "config.h"
+#include "central_event_queue.h"
+#include "msg_transceiver.h"
+#include "sim_driver.h"
+#include "sim_script.h"
+#include "virtual_sensors_sim.h"
+#include "virtual_transceiver_sim.h"
+#include "virtual_eas_current_time.h"
+#include "util.h"
+
+/* Linux simulation of the environment alert system.
+ *
+ * Runs the whole application - central event queue, init handler and everything behind them - against scripted
+ * sensors, on a virtual clock that runs as fast as the host allows. Registers alerts with random alert conditions by
+ * sending "add alert" messages through the simulated transceiver, the same way the phone app does, and checks the alert
+ * status change messages that come back. Reports what happened every virtual day.
+ *
+ * Usage: eas_sim [-t hours] [-a num_alerts] [-r num_requirements_per_alert] [-s seed] [-x speed] [-f script] [-v]
+ */
+
+#define SIM_DEFAULT_DURATION_HOURS (7 * 24)
+#define SIM_DEFAULT_NUM_ALERTS CONFIG_MAX_NUM_ALERTS
+#define SIM_DEFAULT_NUM_REQUIREMENTS_PER_ALERT 4
+#define SIM_DEFAULT_SEED 1
+
+/* Warmup and cooldown periods of generated alerts are multiples of 100 ms, up to this value */
+#define SIM_MAX_WARMUP_COOLDOWN_PERIOD_MS 60000
+/* One out of this many generated alerts has an LED notification */
+#define SIM_LED_NOTIFICATION_ONE_IN 8
+/* Generated alert ids are multiples of this value, spread over the uint16_t range instead of being contiguous */
+#define SIM_ALERT_ID_STRIDE 251
+
+/* Large enough for an "add alert" message with the maximum number of variable requirements */
+#define SIM_MAX_MESSAGE_NUM_BYTES 256
+
+/* Message ids of the messages that the simulation sends and checks */
+#define SIM_MESSAGE_ID_ALERT_STATUS_CHANGE 0
+#define SIM_MESSAGE_ID_ADD_ALERT 2
+#define SIM_MESSAGE_ID_ALERT_STATUS_CHANGES 3
+#define SIM_MESSAGE_ID_GET_SAMPLE_HISTORY 8
+#define SIM_MESSAGE_ID_SAMPLE_HISTORY 9
+
+#define MS_IN_S 1000ULL
+#define MS_IN_HOUR (3600ULL * MS_IN_S)
+#define MS_IN_DAY (24ULL * MS_IN_HOUR)
+
+typedef struct {
+    bool is_added;
+    bool is_raised;
+} SimAlert;
+
+static SimAlert alerts[CONFIG_MAX_NUM_ALERTS];
+/* All generated alert ids must fit into uint16_t */
+EAS_STATIC_ASSERT(((CONFIG_MAX_NUM_ALERTS - 1) * SIM_ALERT_ID_STRIDE) <= UINT16_MAX);
+
+static uint32_t num_status_messages = 0;
+static uint32_t num_raised = 0;
+static uint32_t num_silenced = 0;
+/** Status changes that do not change the status, or that are reported for alerts that were never added */
+static uint32_t num_inconsistent = 0;
+
+static bool verbose = false;
+
+/* Sample history block that is being read out. Fragments are written here until the next block starts. */
+static uint8_t history_block[CONFIG_SAMPLE_HISTORY_BLOCK_SIZE];
+static size_t history_block_num_bytes = 0;
+static uint32_t num_history_blocks = 0;
+static uint32_t num_history_bytes = 0;
+static uint32_t num_history_records = 0;
+/** Time of the first read out block, and of the last read out record */
+static uint32_t history_start_time = 0;
+static uint32_t history_end_time = 0;
+/** Malformed blocks, and records with values outside of the range of the sensor script */
+static uint32_t num_invalid_history_records = 0;
+
+static uint64_t rng_state;
+
+/**
+ * @brief Generate a pseudo-random number using xorshift64.
+ *
+ * @return uint64_t Pseudo-random number.
+ */
+static uint64_t rng_next()
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/**
+ * @brief Generate a pseudo-random number in the inclusive range [min, max].
+ */
+static int64_t rng_in_range(int64_t min, int64_t max)
+{
+    return min + (int64_t)(rng_next() % (uint64_t)(max - min + 1));
+}
+
+static uint64_t get_real_time_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Print the current virtual time in the format "day hh:mm:ss.mmm".
+ */
+static void print_virtual_time()
+{
+    uint64_t time = virtual_eas_current_time_get_uptime();
+    printf("[%llu %02llu:%02llu:%02llu.%03llu] ", (unsigned long long)(time / MS_IN_DAY),
+           (unsigned long long)((time % MS_IN_DAY) / MS_IN_HOUR), (unsigned long long)((time % MS_IN_HOUR) / 60000),
+           (unsigned long long)((time % 60000) / MS_IN_S), (unsigned long long)(time % MS_IN_S));
+}
+
+/**
+ * @brief Record an alert status change reported by the system.
+ */
+static void record_status_change(uint16_t alert_id, bool is_raised)
+{
+    if (verbose) {
+        print_virtual_time();
+        printf("alert %u %s\n", alert_id, is_raised ? "raised" : "silenced");
+    }
+    if (is_raised) {
+        num_raised++;
+    } else {
+        num_silenced++;
+    }
+    size_t idx = alert_id / SIM_ALERT_ID_STRIDE;
+    if (((alert_id % SIM_ALERT_ID_STRIDE) != 0) || (idx >= CONFIG_MAX_NUM_ALERTS) || !alerts[idx].is_added ||
+        (alerts[idx].is_raised == is_raised)) {
+        num_inconsistent++;
+        return;
+    }
+    alerts[idx].is_raised = is_raised;
+}
+
+/**
+ * @brief Decode a varint (LEB128).
+ *
+ * @return true A varint was decoded from @p bytes, starting at @p pos.
+ * @return false The varint does not end within @p num_bytes.
+ */
+static bool decode_varint(const uint8_t *bytes, size_t num_bytes, size_t *pos, uint64_t *value)
+{
+    *value = 0;
+    for (unsigned shift = 0; (*pos < num_bytes) && (shift < 64); shift += 7) {
+        uint8_t byte = bytes[(*pos)++];
+        *value |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Decode a sample history block and check that all values are within the range of the sensor script.
+ */
+static void decode_history_block(const uint8_t *bytes, size_t num_bytes)
+{
+    if (num_bytes < 4) {
+        num_invalid_history_records++;
+        return;
+    }
+    uint32_t time = (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) |
+                    ((uint32_t)bytes[3] << 24);
+    if (num_history_blocks == 0) {
+        history_start_time = time;
+    }
+    num_history_blocks++;
+    num_history_bytes += num_bytes;
+
+    int64_t values[VIRTUAL_SENSORS_SIM_NUM_VARIABLES] = {0};
+    size_t pos = 4;
+    while (pos < num_bytes) {
+        uint64_t tag;
+        uint64_t zigzag_difference;
+        if (!decode_varint(bytes, num_bytes, &pos, &tag) ||
+            !decode_varint(bytes, num_bytes, &pos, &zigzag_difference)) {
+            num_invalid_history_records++;
+            return;
+        }
+        size_t variable = tag & 0x03;
+        time += (uint32_t)(tag >> 2);
+        values[variable] += (int64_t)(zigzag_difference >> 1) ^ -(int64_t)(zigzag_difference & 1);
+        num_history_records++;
+
+        int64_t min = 0;
+        int64_t max = 0;
+        sim_script_get_range((VirtualSensorsSimVariable)variable, &min, &max);
+        if ((values[variable] < min) || (values[variable] > max)) {
+            num_invalid_history_records++;
+        }
+    }
+    history_end_time = time;
+}
+
+/**
+ * @brief Collect a fragment of a sample history message.
+ *
+ * Fragments of a block come in order, so a fragment at offset 0 means that the previous block is complete. A fragment
+ * without bytes ends the read-out.
+ */
+static void record_sample_history_fragment(const uint8_t *bytes, size_t num_bytes)
+{
+    uint8_t offset = bytes[3];
+    size_t num_fragment_bytes = num_bytes - 4;
+    if (((num_fragment_bytes == 0) || (offset == 0)) && (history_block_num_bytes > 0)) {
+        decode_history_block(history_block, history_block_num_bytes);
+        history_block_num_bytes = 0;
+    }
+    if ((offset + num_fragment_bytes) > sizeof(history_block)) {
+        num_invalid_history_records++;
+        return;
+    }
+    memcpy(&history_block[offset], &bytes[4], num_fragment_bytes);
+    history_block_num_bytes = offset + num_fragment_bytes;
+}
+
+static uint16_t read_uint16(const uint8_t *bytes)
+{
+    return (uint16_t)(bytes[0] | (bytes[1] << 8));
+}
+
+/* Executed for every message that the system transmits, from the central event queue context */
+static void transmit_observer_cb(const uint8_t *bytes, size_t num_bytes, void *user_data)
+{
+    if ((num_bytes == 4) && (bytes[0] == SIM_MESSAGE_ID_ALERT_STATUS_CHANGE)) {
+        num_status_messages++;
+        record_status_change(read_uint16(&bytes[1]), bytes[3]);
+    } else if ((num_bytes >= 2) && (bytes[0] == SIM_MESSAGE_ID_ALERT_STATUS_CHANGES) &&
+               (num_bytes == (2 + ((size_t)bytes[1] * 3)))) {
+        num_status_messages++;
+        for (size_t i = 0; i < bytes[1]; i++) {
+            record_status_change(read_uint16(&bytes[2 + (i * 3)]), bytes[4 + (i * 3)]);
+        }
+    } else if ((num_bytes >= 4) && (bytes[0] == SIM_MESSAGE_ID_SAMPLE_HISTORY)) {
+        record_sample_history_fragment(bytes, num_bytes);
+    }
+}
+
+static size_t write_uint16(uint8_t *bytes, uint16_t value)
+{
+    bytes[0] = (uint8_t)(value & 0xFF);
+    bytes[1] = (uint8_t)(value >> 8);
+    return 2;
+}
+
+static size_t write_uint32(uint8_t *bytes, uint32_t value)
+{
+    for (size_t i = 0; i < 4; i++) {
+        bytes[i] = (uint8_t)(value >> (8 * i));
+    }
+    return 4;
+}
+
+/**
+ * @brief Encode an "add alert" message.
+ *
+ * @param alert Alert.
+ * @param[out] bytes The message is written here. Must have space for SIM_MAX_MESSAGE_NUM_BYTES bytes.
+ *
+ * @return size_t Number of bytes in the message.
+ */
+static size_t encode_add_alert_message(const MsgTransceiverAlert *const alert, uint8_t *bytes)
+{
+    size_t num_bytes = 0;
+    bytes[num_bytes++] = SIM_MESSAGE_ID_ADD_ALERT;
+    num_bytes += write_uint16(&bytes[num_bytes], alert->alert_id);
+    num_bytes += write_uint32(&bytes[num_bytes], alert->warmup_period);
+    num_bytes += write_uint32(&bytes[num_bytes], alert->cooldown_period);
+    bytes[num_bytes++] = (uint8_t)(alert->notification_type.connectivity | (alert->notification_type.led << 1));
+    if (alert->notification_type.led) {
+        bytes[num_bytes++] = alert->led_color;
+        bytes[num_bytes++] = alert->led_pattern;
+    }
+
+    const MsgTransceiverAlertCondition *const condition = &alert->alert_condition;
+    size_t num_ored_requirements_idx = num_bytes++;
+    bytes[num_ored_requirements_idx] = 0;
+    size_t num_variable_requirements_idx = 0;
+    for (size_t i = 0; i < condition->num_variable_requirements; i++) {
+        if ((i == 0) || condition->variable_requirements[i - 1].is_last_in_ored_requirement) {
+            /* Start of an ORed requirement */
+            bytes[num_ored_requirements_idx]++;
+            num_variable_requirements_idx = num_bytes++;
+            bytes[num_variable_requirements_idx] = 0;
+        }
+        const MsgTransceiverVariableRequirement *const requirement = &condition->variable_requirements[i];
+        bytes[num_variable_requirements_idx]++;
+        bytes[num_bytes++] = requirement->variable_identifier;
+        bytes[num_bytes++] = requirement->operator;
+        switch (requirement->variable_identifier) {
+        case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_TEMPERATURE:
+            num_bytes += write_uint16(&bytes[num_bytes], (uint16_t)requirement->constraint_value.temperature);
+            break;
+        case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_PRESSURE:
+            num_bytes += write_uint16(&bytes[num_bytes], requirement->constraint_value.pressure);
+            break;
+        case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_HUMIDITY:
+            num_bytes += write_uint16(&bytes[num_bytes], requirement->constraint_value.humidity);
+            break;
+        default:
+            num_bytes += write_uint32(&bytes[num_bytes], requirement->constraint_value.light_intensity);
+            break;
+        }
+    }
+    return num_bytes;
+}
+
+/**
+ * @brief Generate a random variable requirement whose constraint value is within the range of the sensor script.
+ *
+ * @param variable Variable.
+ * @param[out] requirement Generated requirement is written here.
+ */
+static void generate_variable_requirement(VirtualSensorsSimVariable variable,
+                                          MsgTransceiverVariableRequirement *const requirement)
+{
+    int64_t min = 0;
+    int64_t max = 0;
+    sim_script_get_range(variable, &min, &max);
+    int64_t constraint_value = rng_in_range(min, max);
+
+    requirement->operator = (rng_next() & 1) ? MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_GEQ
+                                             : MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_LEQ;
+    switch (variable) {
+    case VIRTUAL_SENSORS_SIM_VARIABLE_TEMPERATURE:
+        requirement->variable_identifier = MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_TEMPERATURE;
+        requirement->constraint_value.temperature = (MsgTransceiverTemperature)constraint_value;
+        break;
+    case VIRTUAL_SENSORS_SIM_VARIABLE_PRESSURE:
+        requirement->variable_identifier = MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_PRESSURE;
+        requirement->constraint_value.pressure = (MsgTransceiverPressure)constraint_value;
+        break;
+    case VIRTUAL_SENSORS_SIM_VARIABLE_HUMIDITY:
+        requirement->variable_identifier = MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_HUMIDITY;
+        requirement->constraint_value.humidity = (MsgTransceiverHumidity)constraint_value;
+        break;
+    default:
+        requirement->variable_identifier = MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_LIGHT_INTENSITY;
+        requirement->constraint_value.light_intensity = (MsgTransceiverLightIntensity)constraint_value;
+        break;
+    }
+}
+
+/**
+ * @brief Generate an alert with a random alert condition, warmup and cooldown periods.
+ *
+ * The alert condition consists of ORed requirements of two variable requirements each, ANDed together.
+ *
+ * @param alert_id Alert id.
+ * @param num_requirements Number of variable requirements in the alert condition.
+ * @param[out] alert Generated alert is written here.
+ */
+static void generate_alert(uint16_t alert_id, size_t num_requirements, MsgTransceiverAlert *const alert)
+{
+    memset(alert, 0, sizeof(MsgTransceiverAlert));
+    alert->alert_id = alert_id;
+    alert->warmup_period = (uint32_t)rng_in_range(0, SIM_MAX_WARMUP_COOLDOWN_PERIOD_MS / 100) * 100;
+    alert->cooldown_period = (uint32_t)rng_in_range(0, SIM_MAX_WARMUP_COOLDOWN_PERIOD_MS / 100) * 100;
+    alert->notification_type.connectivity = 1;
+    if ((rng_next() % SIM_LED_NOTIFICATION_ONE_IN) == 0) {
+        alert->notification_type.led = 1;
+        alert->led_color = (uint8_t)rng_in_range(MSG_TRANSCEIVER_LED_COLOR_RED, MSG_TRANSCEIVER_LED_COLOR_BLUE);
+        alert->led_pattern =
+            (uint8_t)rng_in_range(MSG_TRANSCEIVER_LED_PATTERN_STATIC, MSG_TRANSCEIVER_LED_PATTERN_ALERT);
+    }
+    alert->alert_condition.num_variable_requirements = num_requirements;
+    for (size_t i = 0; i < num_requirements; i++) {
+        MsgTransceiverVariableRequirement *requirement = &alert->alert_condition.variable_requirements[i];
+        VirtualSensorsSimVariable variable =
+            (VirtualSensorsSimVariable)(rng_next() % VIRTUAL_SENSORS_SIM_NUM_VARIABLES);
+        generate_variable_requirement(variable, requirement);
+        requirement->is_last_in_ored_requirement = ((i % 2) == 1) || (i == (num_requirements - 1));
+    }
+}
+
+/**
+ * @brief Add alerts with random alert conditions by sending "add alert" messages to the system.
+ *
+ * @return true All messages were received by the system.
+ * @return false The system is not receiving messages.
+ */
+static bool add_alerts(size_t num_alerts, size_t num_requirements_per_alert)
+{
+    for (size_t i = 0; i < num_alerts; i++) {
+        MsgTransceiverAlert alert;
+        generate_alert((uint16_t)(i * SIM_ALERT_ID_STRIDE), num_requirements_per_alert, &alert);
+        uint8_t bytes[SIM_MAX_MESSAGE_NUM_BYTES];
+        size_t num_bytes = encode_add_alert_message(&alert, bytes);
+        if (!virtual_transceiver_sim_receive(bytes, num_bytes)) {
+            return false;
+        }
+        alerts[i].is_added = true;
+        sim_driver_run_until_idle();
+    }
+    return true;
+}
+
+static uint32_t get_num_currently_raised()
+{
+    uint32_t num_currently_raised = 0;
+    for (size_t i = 0; i < CONFIG_MAX_NUM_ALERTS; i++) {
+        num_currently_raised += alerts[i].is_raised ? 1 : 0;
+    }
+    return num_currently_raised;
+}
+
+static void print_event_stats()
+{
+    printf("event queue: high watermark %zu of %zu slots\n", central_event_queue_get_high_watermark(),
+           central_event_queue_get_num_slots());
+    printf("event id  handled     avg us    max us\n");
+    for (uint8_t event_id = 0; event_id < central_event_queue_get_num_event_ids(); event_id++) {
+        CentralEventQueueEventStats stats;
+        central_event_queue_get_event_stats(event_id, &stats);
+        if (stats.num_handled == 0) {
+            continue;
+        }
+        /* The cycle counter of the simulation counts ns */
+        printf("%8u  %10lu  %8.2f  %8.2f\n", event_id, (unsigned long)stats.num_handled,
+               ((double)stats.total_handler_cycles / stats.num_handled) / 1000.0,
+               (double)stats.max_handler_cycles / 1000.0);
+    }
+}
+
+static void print_usage(const char *program_name)
+{
+    fprintf(stderr,
+            "Usage: %s [-t hours] [-a num_alerts] [-r num_requirements_per_alert] [-s seed] [-x speed] [-f script] "
+            "[-v]\n",
+            program_name);
+    fprintf(stderr, "  -t  Virtual duration of the simulation in hours. Default: %u.\n", SIM_DEFAULT_DURATION_HOURS);
+    fprintf(stderr, "  -a  Number of alerts to register, 0 to %u. Default: %u.\n", (unsigned)CONFIG_MAX_NUM_ALERTS,
+            (unsigned)SIM_DEFAULT_NUM_ALERTS);
+    fprintf(stderr, "  -r  Number of variable requirements in every alert condition, 1 to %u. Default: %u.\n",
+            (unsigned)CONFIG_MSG_TRANSCEIVER_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION,
+            (unsigned)SIM_DEFAULT_NUM_REQUIREMENTS_PER_ALERT);
+    fprintf(stderr, "  -s  Seed of the random number generators, non-zero. Default: %u.\n", SIM_DEFAULT_SEED);
+    fprintf(stderr, "  -x  Run this many times faster than real time. Default: 0, as fast as possible.\n");
+    fprintf(stderr, "  -f  Sensor script file. Default: built-in daily and weekly cycles.\n");
+    fprintf(stderr, "  -v  Print every alert status change.\n");
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t duration_hours = SIM_DEFAULT_DURATION_HOURS;
+    size_t num_alerts = SIM_DEFAULT_NUM_ALERTS;
+    size_t num_requirements_per_alert = SIM_DEFAULT_NUM_REQUIREMENTS_PER_ALERT;
+    uint64_t seed = SIM_DEFAULT_SEED;
+    uint32_t speed = 0;
+    const char *script_path = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "t:a:r:s:x:f:v")) != -1) {
+        switch (opt) {
+        case 't':
+            duration_hours = strtoull(optarg, NULL, 10);
+            break;
+        case 'a':
+            num_alerts = strtoul(optarg, NULL, 10);
+            break;
+        case 'r':
+            num_requirements_per_alert = strtoul(optarg, NULL, 10);
+            break;
+        case 's':
+            seed = strtoull(optarg, NULL, 10);
+            break;
+        case 'x':
+            speed = (uint32_t)strtoul(optarg, NULL, 10);
+            break;
+        case 'f':
+            script_path = optarg;
+            break;
+        case 'v':
+            verbose = true;
+            break;
+        default:
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    bool valid_num_requirements =
+        (num_requirements_per_alert >= 1) &&
+        (num_requirements_per_alert <= CONFIG_MSG_TRANSCEIVER_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION);
+    if ((num_alerts > CONFIG_MAX_NUM_ALERTS) || !valid_num_requirements || (seed == 0)) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (!sim_script_load(script_path)) {
+        return EXIT_FAILURE;
+    }
+    rng_state = seed;
+    virtual_sensors_sim_set_seed(seed);
+    virtual_transceiver_sim_set_transmit_observer_cb(transmit_observer_cb, NULL);
+
+    uint64_t real_start_time_ns = get_real_time_ns();
+    central_event_queue_init();
+    sim_driver_init(speed);
+    central_event_queue_submit_init_event();
+    sim_driver_run_until_idle();
+
+    if (!add_alerts(num_alerts, num_requirements_per_alert)) {
+        fprintf(stderr, "System does not receive messages, initialization failed\n");
+        return EXIT_FAILURE;
+    }
+    printf("alerts: %zu, requirements per alert: %zu, seed: %llu\n", num_alerts, num_requirements_per_alert,
+           (unsigned long long)seed);
+
+    uint64_t end_time = duration_hours * MS_IN_HOUR;
+    uint64_t report_time = 0;
+    uint32_t reported_num_raised = 0;
+    uint32_t reported_num_silenced = 0;
+    while (report_time < end_time) {
+        report_time = ((report_time + MS_IN_DAY) < end_time) ? (report_time + MS_IN_DAY) : end_time;
+        sim_driver_run_until(report_time);
+        print_virtual_time();
+        printf("%lu raised, %lu silenced, %lu alerts raised now\n", (unsigned long)(num_raised - reported_num_raised),
+               (unsigned long)(num_silenced - reported_num_silenced), (unsigned long)get_num_currently_raised());
+        reported_num_raised = num_raised;
+        reported_num_silenced = num_silenced;
+    }
+
+    double real_time_s = (double)(get_real_time_ns() - real_start_time_ns) / 1e9;
+    printf("virtual time: %llu h, real time: %.2f s, speedup: %.0fx\n", (unsigned long long)duration_hours,
+           real_time_s, (real_time_s > 0) ? ((double)end_time / 1000.0 / real_time_s) : 0.0);
+    printf("samples: temperature %lu, pressure %lu, humidity %lu, light intensity %lu\n",
+           (unsigned long)virtual_sensors_sim_get_num_samples(VIRTUAL_SENSORS_SIM_VARIABLE_TEMPERATURE),
+           (unsigned long)virtual_sensors_sim_get_num_samples(VIRTUAL_SENSORS_SIM_VARIABLE_PRESSURE),
+           (unsigned long)virtual_sensors_sim_get_num_samples(VIRTUAL_SENSORS_SIM_VARIABLE_HUMIDITY),
+           (unsigned long)virtual_sensors_sim_get_num_samples(VIRTUAL_SENSORS_SIM_VARIABLE_LIGHT_INTENSITY));
+    printf("status messages: %lu, raised: %lu, silenced: %lu, inconsistent: %lu\n",
+           (unsigned long)num_status_messages, (unsigned long)num_raised, (unsigned long)num_silenced,
+           (unsigned long)num_inconsistent);
+    print_event_stats();
+
+    /* Read out the sample history the same way the phone app does */
+    uint8_t get_sample_history_message = SIM_MESSAGE_ID_GET_SAMPLE_HISTORY;
+    if (virtual_transceiver_sim_receive(&get_sample_history_message, 1)) {
+        sim_driver_run_until_idle();
+    }
+    printf("sample history: %lu blocks, %lu bytes, %lu records over the last %.1f min, %.2f bytes per record, %lu "
+           "invalid\n",
+           (unsigned long)num_history_blocks, (unsigned long)num_history_bytes, (unsigned long)num_history_records,
+           (double)(history_end_time - history_start_time) / 60000.0,
+           (num_history_records > 0) ? ((double)num_history_bytes / num_history_records) : 0.0,
+           (unsigned long)num_invalid_history_records);
+
+    bool success = (num_inconsistent == 0) && (num_invalid_history_records == 0);
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,161 @@
+#include <stdbool.h>
+#include <errno.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "sim_driver.h"
+#include "central_event_queue.h"
+#include "virtual_eas_current_time.h"
+#include "virtual_eas_timer.h"
+#include "virtual_transceiver_sim.h"
+#include "eas_assert.h"
+
+#define NS_IN_MS 1000000ULL
+#define NS_IN_S 1000000000ULL
+
+static uint32_t speed_factor = 0;
+/* Real time and virtual time at which the simulation started, used when speed_factor is not 0 */
+static uint64_t real_start_time_ns = 0;
+static uint64_t virtual_start_time_ms = 0;
+
+/* Protect the fields below, which are written by the central event queue thread and read by the main thread */
+static pthread_mutex_t barrier_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t barrier_cond = PTHREAD_COND_INITIALIZER;
+static bool is_barrier_handled = false;
+/** Number of events handled before the barrier event */
+static uint64_t barrier_num_handled_events = 0;
+
+static bool is_initialized = false;
+
+/**
+ * @brief Get host monotonic time.
+ *
+ * @return uint64_t Time in ns.
+ */
+static uint64_t get_real_time_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * NS_IN_S) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Get the total number of events handled by the central event queue.
+ *
+ * @return uint64_t Sum of handled events over all event ids.
+ */
+static uint64_t get_num_handled_events()
+{
+    uint64_t num_handled_events = 0;
+    for (uint8_t event_id = 0; event_id < central_event_queue_get_num_event_ids(); event_id++) {
+        CentralEventQueueEventStats stats;
+        central_event_queue_get_event_stats(event_id, &stats);
+        num_handled_events += stats.num_handled;
+    }
+    return num_handled_events;
+}
+
+/* Executed from the central event queue context */
+static void barrier_cb(void *user_data)
+{
+    /* Statistics of an event are recorded after it is handled, so this barrier event is not counted yet */
+    uint64_t num_handled_events = get_num_handled_events();
+
+    pthread_mutex_lock(&barrier_mutex);
+    barrier_num_handled_events = num_handled_events;
+    is_barrier_handled = true;
+    pthread_cond_signal(&barrier_cond);
+    pthread_mutex_unlock(&barrier_mutex);
+}
+
+/**
+ * @brief Submit a barrier event and wait until it is handled.
+ *
+ * @return uint64_t Number of events handled before the barrier event.
+ */
+static uint64_t run_barrier()
+{
+    pthread_mutex_lock(&barrier_mutex);
+    is_barrier_handled = false;
+    pthread_mutex_unlock(&barrier_mutex);
+
+    central_event_queue_submit_void_cb_with_user_data_event(barrier_cb, NULL);
+
+    pthread_mutex_lock(&barrier_mutex);
+    while (!is_barrier_handled) {
+        pthread_cond_wait(&barrier_cond, &barrier_mutex);
+    }
+    uint64_t num_handled_events = barrier_num_handled_events;
+    pthread_mutex_unlock(&barrier_mutex);
+    return num_handled_events;
+}
+
+/**
+ * @brief Wait until the central event queue has handled all events, including the events submitted by the handlers.
+ */
+static void drain_central_event_queue()
+{
+    uint64_t previous = run_barrier();
+    while (true) {
+        uint64_t current = run_barrier();
+        /* Only the previous barrier event was handled in between */
+        if (current == (previous + 1)) {
+            break;
+        }
+        previous = current;
+    }
+}
+
+/**
+ * @brief If the simulation is slowed down to a multiple of real time, sleep until it is time to move the virtual
+ * clock to @p time.
+ *
+ * @param time Virtual uptime in ms.
+ */
+static void wait_for_real_time(uint64_t time)
+{
+    if (speed_factor == 0) {
+        return;
+    }
+    uint64_t target_ns = real_start_time_ns + (((time - virtual_start_time_ms) * NS_IN_MS) / speed_factor);
+    struct timespec ts = {
+        .tv_sec = (time_t)(target_ns / NS_IN_S),
+        .tv_nsec = (long)(target_ns % NS_IN_S),
+    };
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR) {
+        /* Interrupted by a signal, sleep again */
+    }
+}
+
+void sim_driver_init(uint32_t speed)
+{
+    EAS_ASSERT(!is_initialized);
+    speed_factor = speed;
+    real_start_time_ns = get_real_time_ns();
+    virtual_start_time_ms = virtual_eas_current_time_get_uptime();
+    is_initialized = true;
+}
+
+void sim_driver_run_until_idle()
+{
+    EAS_ASSERT(is_initialized);
+    do {
+        drain_central_event_queue();
+    } while (virtual_transceiver_sim_complete_transmissions() > 0);
+}
+
+void sim_driver_run_until(uint64_t time)
+{
+    EAS_ASSERT(is_initialized);
+    EAS_ASSERT(time >= virtual_eas_current_time_get_uptime());
+
+    uint64_t expiry_time = 0;
+    while (virtual_eas_timer_get_next_expiry_time(&expiry_time) && (expiry_time <= time)) {
+        wait_for_real_time(expiry_time);
+        virtual_eas_current_time_set(expiry_time);
+        virtual_eas_timer_expire(expiry_time);
+        sim_driver_run_until_idle();
+    }
+    wait_for_real_time(time);
+    virtual_eas_current_time_set(time);
+}
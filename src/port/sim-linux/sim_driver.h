@@ -0,0 +1,59 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_PORT_SIM_LINUX_SIM_DRIVER_H
+#define ENV_ALERT_SYSTEM_SRC_PORT_SIM_LINUX_SIM_DRIVER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+/**
+ * @brief Drives the simulation forward in virtual time.
+ *
+ * The simulation is a discrete-event simulation. The central event queue thread handles events as usual, while the
+ * main thread, which calls the functions of this module, plays the role of the hardware: it expires timers and
+ * completes transmissions. The main thread only does that when the central event queue is idle, so that the virtual
+ * clock never moves while an event is being handled. When the system is idle, the virtual clock jumps directly to the
+ * next timer expiry, which is what makes the simulation faster than real time.
+ *
+ * The central event queue is idle when it has handled all submitted events and there are no events that can be
+ * submitted without an action of the main thread. This is detected with barrier events: the main thread submits an
+ * event and waits until it is handled. If the only event handled between two consecutive barrier events is the first
+ * barrier event, the queue is idle.
+ *
+ * Optionally, the simulation is slowed down to a fixed multiple of real time, e.g. to watch it.
+ */
+
+/**
+ * @brief Initialize the simulation driver.
+ *
+ * @pre Central event queue is initialized.
+ *
+ * @param speed Virtual time runs @p speed times faster than real time. If 0, virtual time runs as fast as possible.
+ */
+void sim_driver_init(uint32_t speed);
+
+/**
+ * @brief Wait until the system is idle.
+ *
+ * Handles everything that can happen without the virtual clock moving: events in the central event queue and
+ * transmissions in progress, including everything that they trigger.
+ */
+void sim_driver_run_until_idle();
+
+/**
+ * @brief Run the simulation until the virtual clock reaches @p time.
+ *
+ * Expires all timers that expire at or before @p time, in the order of their expiry, and waits until the system is
+ * idle after every expiry.
+ *
+ * @param time Virtual uptime in ms. Must not be smaller than the current virtual uptime.
+ */
+void sim_driver_run_until(uint64_t time);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_PORT_SIM_LINUX_SIM_DRIVER_H */
@@ -0,0 +1,233 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sim_script.h"
+#include "eas_assert.h"
+
+#define SIM_SCRIPT_MAX_NUM_WAYPOINTS 64
+#define SIM_SCRIPT_MAX_LINE_LENGTH 256
+
+#define MS_IN_S 1000ULL
+#define MS_IN_HOUR (3600ULL * MS_IN_S)
+#define MS_IN_DAY (24ULL * MS_IN_HOUR)
+
+typedef struct {
+    VirtualSensorsSimWaypoint waypoints[SIM_SCRIPT_MAX_NUM_WAYPOINTS];
+    size_t num_waypoints;
+    uint32_t noise;
+} SimScript;
+
+static const char *const variable_names[VIRTUAL_SENSORS_SIM_NUM_VARIABLES] = {
+    [VIRTUAL_SENSORS_SIM_VARIABLE_TEMPERATURE] = "temperature",
+    [VIRTUAL_SENSORS_SIM_VARIABLE_PRESSURE] = "pressure",
+    [VIRTUAL_SENSORS_SIM_VARIABLE_HUMIDITY] = "humidity",
+    [VIRTUAL_SENSORS_SIM_VARIABLE_LIGHT_INTENSITY] = "light_intensity",
+};
+
+/* Temperature in 0.1 degrees Celsius: cool nights, warm afternoons */
+static const VirtualSensorsSimWaypoint default_temperature_waypoints[] = {
+    {0, 160}, {6 * MS_IN_HOUR, 140}, {15 * MS_IN_HOUR, 290}, {MS_IN_DAY, 160},
+};
+
+/* Pressure in 0.1 hPa: a low pressure system passes once a week */
+static const VirtualSensorsSimWaypoint default_pressure_waypoints[] = {
+    {0, 10150}, {3 * MS_IN_DAY, 9900}, {4 * MS_IN_DAY, 9950}, {7 * MS_IN_DAY, 10150},
+};
+
+/* Humidity in 0.1 %: highest at night, lowest in the afternoon */
+static const VirtualSensorsSimWaypoint default_humidity_waypoints[] = {
+    {0, 650}, {6 * MS_IN_HOUR, 700}, {15 * MS_IN_HOUR, 350}, {MS_IN_DAY, 650},
+};
+
+/* Light intensity in lx: dark at night, daylight through a window during the day */
+static const VirtualSensorsSimWaypoint default_light_intensity_waypoints[] = {
+    {0, 0},
+    {6 * MS_IN_HOUR, 0},
+    {7 * MS_IN_HOUR, 2000},
+    {13 * MS_IN_HOUR, 30000},
+    {19 * MS_IN_HOUR, 2000},
+    {20 * MS_IN_HOUR, 0},
+    {MS_IN_DAY, 0},
+};
+
+static SimScript scripts[VIRTUAL_SENSORS_SIM_NUM_VARIABLES];
+
+/**
+ * @brief Replace the script of a variable with a default script.
+ *
+ * @param variable Variable.
+ * @param waypoints Waypoints of the default script.
+ * @param num_waypoints Number of waypoints in @p waypoints.
+ * @param noise Noise amplitude.
+ */
+static void set_default_script(VirtualSensorsSimVariable variable, const VirtualSensorsSimWaypoint *waypoints,
+                               size_t num_waypoints, uint32_t noise)
+{
+    EAS_ASSERT(num_waypoints <= SIM_SCRIPT_MAX_NUM_WAYPOINTS);
+    memcpy(scripts[variable].waypoints, waypoints, num_waypoints * sizeof(VirtualSensorsSimWaypoint));
+    scripts[variable].num_waypoints = num_waypoints;
+    scripts[variable].noise = noise;
+}
+
+/** Replace the scripts of all variables with the default scripts. */
+static void set_default_scripts()
+{
+    set_default_script(VIRTUAL_SENSORS_SIM_VARIABLE_TEMPERATURE, default_temperature_waypoints,
+                       sizeof(default_temperature_waypoints) / sizeof(VirtualSensorsSimWaypoint), 3);
+    set_default_script(VIRTUAL_SENSORS_SIM_VARIABLE_PRESSURE, default_pressure_waypoints,
+                       sizeof(default_pressure_waypoints) / sizeof(VirtualSensorsSimWaypoint), 2);
+    set_default_script(VIRTUAL_SENSORS_SIM_VARIABLE_HUMIDITY, default_humidity_waypoints,
+                       sizeof(default_humidity_waypoints) / sizeof(VirtualSensorsSimWaypoint), 10);
+    set_default_script(VIRTUAL_SENSORS_SIM_VARIABLE_LIGHT_INTENSITY, default_light_intensity_waypoints,
+                       sizeof(default_light_intensity_waypoints) / sizeof(VirtualSensorsSimWaypoint), 50);
+}
+
+/**
+ * @brief Find variable by name.
+ *
+ * @param name Variable name.
+ * @param[out] variable If true is returned, the variable is written to this parameter.
+ *
+ * @return true @p name is a valid variable name.
+ * @return false @p name is not a valid variable name.
+ */
+static bool parse_variable(const char *name, VirtualSensorsSimVariable *const variable)
+{
+    for (size_t i = 0; i < VIRTUAL_SENSORS_SIM_NUM_VARIABLES; i++) {
+        if (strcmp(name, variable_names[i]) == 0) {
+            *variable = (VirtualSensorsSimVariable)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Parse one line of a script file.
+ *
+ * @param line Line without the trailing newline.
+ * @param is_replaced Indexed by variable. Set to true for a variable when its default script is replaced by the first
+ * waypoint from the file.
+ *
+ * @return const char* NULL if the line is valid, otherwise the description of the error.
+ */
+static const char *parse_line(const char *line, bool *const is_replaced)
+{
+    char first[32];
+    char second[32];
+    unsigned long long time_s = 0;
+    long long value = 0;
+    VirtualSensorsSimVariable variable;
+
+    if (sscanf(line, " %31s", first) != 1 || first[0] == '#') {
+        /* Empty line or comment */
+        return NULL;
+    }
+    if (strcmp(first, "noise") == 0) {
+        if (sscanf(line, " noise %31s %lld", second, &value) != 2) {
+            return "expected \"noise <variable> <amplitude>\"";
+        }
+        if (!parse_variable(second, &variable)) {
+            return "unknown variable";
+        }
+        if ((value < 0) || (value > UINT32_MAX)) {
+            return "invalid noise amplitude";
+        }
+        scripts[variable].noise = (uint32_t)value;
+        return NULL;
+    }
+
+    if (sscanf(line, " %31s %llu %lld", first, &time_s, &value) != 3) {
+        return "expected \"<variable> <time_s> <value>\"";
+    }
+    if (!parse_variable(first, &variable)) {
+        return "unknown variable";
+    }
+    SimScript *const script = &scripts[variable];
+    if (!is_replaced[variable]) {
+        script->num_waypoints = 0;
+        is_replaced[variable] = true;
+    }
+    uint64_t time = time_s * MS_IN_S;
+    if ((script->num_waypoints == 0) && (time != 0)) {
+        return "the first waypoint must be at time 0";
+    }
+    if ((script->num_waypoints > 0) && (time <= script->waypoints[script->num_waypoints - 1].time)) {
+        return "waypoint times must be strictly increasing";
+    }
+    if (script->num_waypoints == SIM_SCRIPT_MAX_NUM_WAYPOINTS) {
+        return "too many waypoints";
+    }
+    script->waypoints[script->num_waypoints].time = time;
+    script->waypoints[script->num_waypoints].value = value;
+    script->num_waypoints++;
+    return NULL;
+}
+
+/**
+ * @brief Parse a script file.
+ *
+ * @param path Path of the script file.
+ *
+ * @return true The file was parsed successfully.
+ * @return false Failed to read or parse the file.
+ */
+static bool parse_file(const char *path)
+{
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "%s: failed to open script file\n", path);
+        return false;
+    }
+
+    bool is_replaced[VIRTUAL_SENSORS_SIM_NUM_VARIABLES] = {false};
+    char line[SIM_SCRIPT_MAX_LINE_LENGTH];
+    size_t line_number = 0;
+    bool result = true;
+    while (fgets(line, sizeof(line), file)) {
+        line_number++;
+        const char *error = parse_line(line, is_replaced);
+        if (error) {
+            fprintf(stderr, "%s:%zu: %s\n", path, line_number, error);
+            result = false;
+            break;
+        }
+    }
+    fclose(file);
+    return result;
+}
+
+bool sim_script_load(const char *path)
+{
+    set_default_scripts();
+    if (path && !parse_file(path)) {
+        return false;
+    }
+    for (size_t i = 0; i < VIRTUAL_SENSORS_SIM_NUM_VARIABLES; i++) {
+        virtual_sensors_sim_set_script((VirtualSensorsSimVariable)i, scripts[i].waypoints, scripts[i].num_waypoints,
+                                       scripts[i].noise);
+    }
+    return true;
+}
+
+void sim_script_get_range(VirtualSensorsSimVariable variable, int64_t *const min, int64_t *const max)
+{
+    EAS_ASSERT(variable < VIRTUAL_SENSORS_SIM_NUM_VARIABLES);
+    EAS_ASSERT(min);
+    EAS_ASSERT(max);
+
+    const SimScript *const script = &scripts[variable];
+    *min = script->waypoints[0].value;
+    *max = script->waypoints[0].value;
+    for (size_t i = 1; i < script->num_waypoints; i++) {
+        if (script->waypoints[i].value < *min) {
+            *min = script->waypoints[i].value;
+        }
+        if (script->waypoints[i].value > *max) {
+            *max = script->waypoints[i].value;
+        }
+    }
+    *min -= script->noise;
+    *max += script->noise;
+}
@@ -0,0 +1,52 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_PORT_SIM_LINUX_SIM_SCRIPT_H
+#define ENV_ALERT_SYSTEM_SRC_PORT_SIM_LINUX_SIM_SCRIPT_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "virtual_sensors_sim.h"
+
+/**
+ * @brief Scripts of the simulated sensors.
+ *
+ * Every variable has a default script: temperature, humidity and light intensity follow a daily cycle, and pressure
+ * follows a weekly cycle. A script file replaces the default scripts of the variables that it mentions.
+ *
+ * Script file format, one statement per line. Empty lines and lines starting with '#' are ignored.
+ * - "<variable> <time_s> <value>" adds a waypoint to the script of the variable. Time is in seconds since the
+ *   beginning of the script repetition, value is in the units of the sample type of the variable. The first waypoint
+ *   of every variable must be at time 0, and times must be strictly increasing.
+ * - "noise <variable> <amplitude>" sets the noise amplitude of the variable, in the units of its sample type.
+ *
+ * Variables are "temperature", "pressure", "humidity" and "light_intensity".
+ */
+
+/**
+ * @brief Load scripts and pass them to the scripted sensors.
+ *
+ * @param path Path of the script file. If NULL, only the default scripts are used.
+ *
+ * @return true Scripts were loaded.
+ * @return false Failed to read the script file or the script file is invalid. The reason is printed to stderr.
+ */
+bool sim_script_load(const char *path);
+
+/**
+ * @brief Get the range of values that the script of a variable can produce, including noise.
+ *
+ * @param variable Variable.
+ * @param[out] min Smallest value.
+ * @param[out] max Largest value.
+ */
+void sim_script_get_range(VirtualSensorsSimVariable variable, int64_t *const min, int64_t *const max);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_PORT_SIM_LINUX_SIM_SCRIPT_H */
@@ -7,15 +7,22 @@
 #define CONFIG_HUMIDITY_VALUE_MAX_NUM_INSTANCES 8
 #define CONFIG_LIGHT_INTENSITY_VALUE_MAX_NUM_INSTANCES 8
 #define CONFIG_LINKED_LIST_MAX_NUM_INSTANCES 49
-#define CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_INSTANCES 10
-#define CONFIG_ALERT_CONDITION_MAX_NUM_INSTANCES 1
+#define CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_INSTANCES 43
+/* Two instances, so that tests can check that only one alert condition can have open expressions at a time */
+#define CONFIG_ALERT_CONDITION_MAX_NUM_INSTANCES 2
 #define CONFIG_ALERT_RAISER_MAX_NUM_INSTANCES 27
-/* This config has no effect on the behavior of the unit test port. The eas timer implementation for this port is a
- * mock, so it does not define a static array of size equal to the maximum number of instances. */
-#define CONFIG_EAS_TIMER_MAX_NUM_INSTANCES 1
-/* Every ops queue uses one ring buffer */
-#define CONFIG_OPS_QUEUE_MAX_NUM_INSTANCES 12
-#define CONFIG_EAS_RING_BUF_MAX_NUM_INSTANCES CONFIG_OPS_QUEUE_MAX_NUM_INSTANCES
+/* The eas timer implementation for this port is a mock, which does not use this config. Should correspond to the number
+ * of timers created in virtual eas timer tests, which link the virtual implementation instead. */
+#define CONFIG_EAS_TIMER_MAX_NUM_INSTANCES 3
+/* Should correspond to the number of times timer_wheel_timer_create() is called in timer wheel tests */
+#define CONFIG_TIMER_WHEEL_MAX_NUM_TIMERS 32
+#define CONFIG_OPS_QUEUE_MAX_NUM_INSTANCES 15
+/* Largest num_ops - 1 passed to ops_queue_create in ops queue tests */
+#define CONFIG_OPS_QUEUE_MAX_NUM_PENDING_OPS 3
+/* Should correspond to the number of init graphs created in init graph tests */
+#define CONFIG_INIT_GRAPH_MAX_NUM_INSTANCES 9
+/* Used by sample history */
+#define CONFIG_EAS_RING_BUF_MAX_NUM_INSTANCES 1
 
 /** For the off-target unit test build, this config is used in mock variable requirement allocator to determine the size
  * of the buffer for one variable requirement. */
@@ -28,25 +35,45 @@
 #define CONFIG_MSG_TRANSCEIVER_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION                                        \
     CONFIG_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION
 
+#define CONFIG_MAX_ALERT_CONDITION_EXPRESSION_DEPTH 4
+
+#define CONFIG_ALERT_CONDITION_MAX_EXPRESSION_DEPTH CONFIG_MAX_ALERT_CONDITION_EXPRESSION_DEPTH
+
+#define CONFIG_MSG_TRANSCEIVER_MAX_EXPRESSION_DEPTH CONFIG_MAX_ALERT_CONDITION_EXPRESSION_DEPTH
+
 #define CONFIG_MAX_NUM_ALERTS 10
 
 #define CONFIG_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS                                                                     \
     (CONFIG_MAX_NUM_ALERTS * CONFIG_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION)
 
+#define CONFIG_MAX_TOTAL_NUM_BAND_REQUIREMENTS (2 * CONFIG_MAX_NUM_ALERTS)
+
+/* Alert condition tests use one alert condition instance with up to the maximum number of variable requirements */
+#define CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS
+
+/* Fewer than the maximum number of variable requirements, so that alert condition tests can use up the budget */
+#define CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_BAND_REQUIREMENTS 2
+
 /* This config has no effect on the behavior of the unit test port. This port implements two version of variable
  * requirement allocator: mock and fake. Mock simply records function calls, so it does not define any memory for the
  * allocated requirements. The fake uses its own config, CONFIG_FAKE_VARIABLE_REQUIREMENT_ALLOCATOR_NUM_REQUIREMENTS. */
 #define CONFIG_VARIABLE_REQUIREMENT_ALLOCATOR_NUM_REQUIREMENTS 1
 
+/** Matches the number of requirements used in variable requirement list tests, so that the tests can fill up a list. */
+#define CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_REQUIREMENTS 7
+
+/* This config has no effect on the behavior of the unit test port. New sample handler is not unit tested. */
+#define CONFIG_ALERT_SLOTS_NUM_SLOTS CONFIG_MAX_NUM_ALERTS
+
 #define CONFIG_ALERT_CONDITIONS_NUM_INSTANCES_TO_CREATE CONFIG_MAX_NUM_ALERTS
 
 #define CONFIG_ALERT_RAISERS_NUM_INSTANCES_TO_CREATE CONFIG_MAX_NUM_ALERTS
 
 #define CONFIG_ALERT_VALIDATOR_MAX_ALLOWED_ALERT_ID (CONFIG_MAX_NUM_ALERTS - 1)
 
-#define CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS CONFIG_MAX_NUM_ALERTS
+#define CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS CONFIG_ALERT_SLOTS_NUM_SLOTS
 
-#define CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS CONFIG_MAX_NUM_ALERTS
+#define CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS CONFIG_ALERT_SLOTS_NUM_SLOTS
 
 #define CONFIG_LED_MANAGER_NOTIFICATION_DURATION_SECONDS 5
 
@@ -55,25 +82,71 @@
 /** Set to CONFIG_MAX_NUM_ALERTS * 2, since in theory every registered alert can change status at the same time.
  * Multiplied by 2 to be on the safe side and allow for a margin.
  */
-#define CONFIG_MSG_TRANSCEIVER_MAX_NUM_CONCURRENT_ALERT_STATUS_CHANGE_MESSAGES (CONFIG_MAX_NUM_ALERTS * 2)
+#define CONFIG_MSG_TRANSCEIVER_NUM_RESERVED_MESSAGE_SLOTS (CONFIG_MAX_NUM_ALERTS * 2)
+
+/** The reserved slots, plus one slot for the stats report and one for the sample history read-out. Each of them has at
+ * most one message in progress.
+ */
+#define CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS (CONFIG_MSG_TRANSCEIVER_NUM_RESERVED_MESSAGE_SLOTS + 2)
+
+/** Small, so that tests can easily produce more alert status changes than fit into one message. */
+#define CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERT_STATUS_CHANGES_IN_MESSAGE 3
+
+/** Small, so that tests can easily produce a "replace all alerts" message with too many alerts. */
+#define CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERTS_IN_REPLACE_ALL_ALERTS_MESSAGE 3
 
-/** It is defined here, but not actually used since central event queue is not used in the unit test port. */
-#define CONFIG_CENTRAL_EVENT_QUEUE_MESSAGE_QUEUE_BUF_SIZE 1024
+/** One slot, so that tests can check that coalesced samples only occupy one slot. */
+#define CONFIG_CENTRAL_EVENT_QUEUE_NUM_SLOTS 1
+
+#define CONFIG_CENTRAL_EVENT_QUEUE_COALESCE_SAMPLES 1
 
 /* This config has no effect on the behavior of the unit test port. This port implements two version of linked list node
  * allocator: mock and fake. Mock simply records function calls, so it does not define any memory for the allocated
  * nodes. The fake uses its own config, CONFIG_FAKE_LINKED_LIST_NODE_ALLOCATOR_NUM_NODES. */
 #define CONFIG_LINKED_LIST_NODE_ALLOCATOR_NUM_NODES 1
 
-/* This config has no effect on the behavior of the unit test port. This port implements a mock object for the
- * led_notification_allocator interface. The mock does not define any memory for the allocated notifications. */
-#define CONFIG_LED_NOTIFICATION_ALLOCATOR_NUM_NOTIFICATIONS 1
+#define CONFIG_TIMER_WHEEL_TICK_MS 100
+
+/** Small number of slots, so that timer wheel tests can easily cover timers that take more than one revolution. */
+#define CONFIG_TIMER_WHEEL_NUM_SLOTS 8
+
+/** Smallest allowed block size and few blocks, so that sample history tests can easily fill blocks and the ring buffer.
+ */
+#define CONFIG_SAMPLE_HISTORY_BLOCK_SIZE 44
+#define CONFIG_SAMPLE_HISTORY_NUM_BLOCKS 3
+/** Records every change of every variable but light intensity, so that sample history tests can tell the minimum change
+ * apart from the minimum interval */
+#define CONFIG_SAMPLE_HISTORY_MIN_INTERVAL_MS 10
+#define CONFIG_SAMPLE_HISTORY_TEMPERATURE_MIN_CHANGE 1
+#define CONFIG_SAMPLE_HISTORY_PRESSURE_MIN_CHANGE 1
+#define CONFIG_SAMPLE_HISTORY_HUMIDITY_MIN_CHANGE 1
+#define CONFIG_SAMPLE_HISTORY_LIGHT_INTENSITY_MIN_CHANGE 10
+
+/** Distinct limits and rates of change for every variable, so that sensor readout scheduler tests can tell the
+ * variables apart and easily reach both limits of every readout period. */
+#define CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MIN_PERIOD_MS 250
+#define CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_PERIOD_MS 10000
+#define CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_RATE_OF_CHANGE 5
+#define CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MIN_PERIOD_MS 1000
+#define CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MAX_PERIOD_MS 30000
+#define CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MAX_RATE_OF_CHANGE 5
+#define CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MIN_PERIOD_MS 500
+#define CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MAX_PERIOD_MS 10000
+#define CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MAX_RATE_OF_CHANGE 20
+#define CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MIN_PERIOD_MS 2000
+#define CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MAX_PERIOD_MS 4000
+#define CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MAX_RATE_OF_CHANGE 1000
 
 /* Configs for port-specific modules */
 
 /** Should correspond to the number of times <module_name>_create() will be called in the unit test program. */
 #define CONFIG_MEMORY_BLOCK_ALLOCATOR_MAX_NUM_INSTANCES 8
 
+/** Every slot queue test creates a new slot queue instance. */
+#define CONFIG_EAS_SLOT_QUEUE_MAX_NUM_INSTANCES 16
+
+#define CONFIG_EAS_SLOT_QUEUE_MAX_NUM_SLOTS 4
+
 /** The maximal number of nodes that the fake linked list node allocator module can allocate at the same time. */
 #define CONFIG_FAKE_LINKED_LIST_NODE_ALLOCATOR_NUM_NODES 7
 
@@ -0,0 +1,131 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "init_graph.h"
+#include "eas_assert.h"
+#include "config.h"
+
+#ifndef CONFIG_INIT_GRAPH_MAX_NUM_INSTANCES
+#define CONFIG_INIT_GRAPH_MAX_NUM_INSTANCES 1
+#endif
+
+struct InitGraphStruct {
+    const InitGraphStep *steps;
+    size_t num_steps;
+    InitGraphCompleteCb complete_cb;
+    void *complete_cb_user_data;
+    /** Bitmask of steps that have been started */
+    uint32_t started_steps;
+    /** Bitmask of steps that have completed successfully */
+    uint32_t completed_steps;
+    bool is_started;
+    /** Set once the complete callback has been executed */
+    bool is_finished;
+};
+
+static struct InitGraphStruct instances[CONFIG_INIT_GRAPH_MAX_NUM_INSTANCES];
+static size_t instance_idx = 0;
+
+/**
+ * @brief Execute the complete callback, unless it has already been executed.
+ *
+ * @param self Init graph instance.
+ * @param result Result to pass to the complete callback.
+ */
+static void finish(InitGraph self, bool result)
+{
+    if (self->is_finished) {
+        return;
+    }
+    self->is_finished = true;
+    if (self->complete_cb) {
+        self->complete_cb(result, self->complete_cb_user_data);
+    }
+}
+
+/**
+ * @brief Start all steps that have not been started yet, and whose dependencies are complete.
+ *
+ * @param self Init graph instance.
+ */
+static void start_ready_steps(InitGraph self)
+{
+    for (size_t i = 0; i < self->num_steps; i++) {
+        /* A step can complete from inside its start callback, which can finish the init graph */
+        if (self->is_finished) {
+            return;
+        }
+        uint32_t step = INIT_GRAPH_DEPENDENCY(i);
+        const InitGraphStep *const init_step = &self->steps[i];
+        bool is_ready = ((init_step->dependencies & self->completed_steps) == init_step->dependencies);
+        if (!(self->started_steps & step) && is_ready) {
+            /* Marked before starting, so that nested calls to this function do not start the step again */
+            self->started_steps |= step;
+            init_step->start(init_step->user_data);
+        }
+    }
+}
+
+InitGraph init_graph_create(const InitGraphStep *const steps, size_t num_steps, InitGraphCompleteCb complete_cb,
+                            void *complete_cb_user_data)
+{
+    EAS_ASSERT(steps);
+    EAS_ASSERT(num_steps > 0);
+    EAS_ASSERT(num_steps <= INIT_GRAPH_MAX_NUM_STEPS);
+    for (size_t i = 0; i < num_steps; i++) {
+        EAS_ASSERT(steps[i].start);
+        /* Only depending on steps with lower indices rules out cycles and dependencies on nonexistent steps */
+        bool are_dependencies_valid = ((steps[i].dependencies >> i) == 0);
+        EAS_ASSERT(are_dependencies_valid);
+    }
+
+    EAS_ASSERT(instance_idx < CONFIG_INIT_GRAPH_MAX_NUM_INSTANCES);
+    struct InitGraphStruct *instance = &instances[instance_idx];
+    instance_idx++;
+
+    instance->steps = steps;
+    instance->num_steps = num_steps;
+    instance->complete_cb = complete_cb;
+    instance->complete_cb_user_data = complete_cb_user_data;
+    instance->started_steps = 0;
+    instance->completed_steps = 0;
+    instance->is_started = false;
+    instance->is_finished = false;
+
+    return instance;
+}
+
+void init_graph_start(InitGraph self)
+{
+    EAS_ASSERT(self);
+    EAS_ASSERT(!self->is_started);
+    self->is_started = true;
+    start_ready_steps(self);
+}
+
+void init_graph_step_complete(InitGraph self, size_t step_idx, bool result)
+{
+    EAS_ASSERT(self);
+    EAS_ASSERT(step_idx < self->num_steps);
+    uint32_t step = INIT_GRAPH_DEPENDENCY(step_idx);
+    EAS_ASSERT(self->started_steps & step);
+    EAS_ASSERT(!(self->completed_steps & step));
+
+    if (self->is_finished) {
+        /* Another step has failed */
+        return;
+    }
+    if (!result) {
+        finish(self, false);
+        return;
+    }
+
+    self->completed_steps |= step;
+    uint32_t all_steps = (self->num_steps == INIT_GRAPH_MAX_NUM_STEPS) ? UINT32_MAX
+                                                                      : (INIT_GRAPH_DEPENDENCY(self->num_steps) - 1);
+    if (self->completed_steps == all_steps) {
+        finish(self, true);
+    } else {
+        start_ready_steps(self);
+    }
+}
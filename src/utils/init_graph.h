@@ -0,0 +1,96 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_UTILS_INIT_GRAPH_H
+#define ENV_ALERT_SYSTEM_SRC_UTILS_INIT_GRAPH_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** Maximum number of steps in one init graph. Dependencies of a step are a bitmask of step indices. */
+#define INIT_GRAPH_MAX_NUM_STEPS 32
+
+/** Use in InitGraphStep.dependencies to make a step depend on the step with index @p step_idx. */
+#define INIT_GRAPH_DEPENDENCY(step_idx) ((uint32_t)1 << (step_idx))
+
+typedef struct InitGraphStruct *InitGraph;
+
+/**
+ * @brief Start an init step.
+ *
+ * User-defined callback that must start the init step. Once the step is complete, @ref init_graph_step_complete must be
+ * called with the index of the step. It can be called from inside this callback if the step completes right away.
+ *
+ * @param user_data "user_data" of the step.
+ */
+typedef void (*InitGraphStartStep)(void *user_data);
+
+/**
+ * @brief Callback to execute once all init steps are complete, or once any of them fails.
+ *
+ * @param result True if all init steps completed successfully, false if any of them failed.
+ * @param user_data "complete_cb_user_data" parameter that was passed to @ref init_graph_create.
+ */
+typedef void (*InitGraphCompleteCb)(bool result, void *user_data);
+
+typedef struct {
+    /** Starts the step. */
+    InitGraphStartStep start;
+    /** User data to pass to start. */
+    void *user_data;
+    /** Bitmask of INIT_GRAPH_DEPENDENCY() of all steps that must be complete before this step is started. A step can
+     * only depend on steps with lower indices, which guarantees that the graph has no cycles. */
+    uint32_t dependencies;
+} InitGraphStep;
+
+/**
+ * @brief Create an init graph instance.
+ *
+ * An init graph runs init steps in the order given by their dependencies. Every step is started as soon as all of its
+ * dependencies are complete, so steps that do not depend on each other run at the same time. For example, the
+ * initialization of devices on different buses does not have to wait for each other.
+ *
+ * @param steps Init steps. Must stay valid until the init graph is complete.
+ * @param num_steps Number of steps in @p steps. Must be > 0 and <= INIT_GRAPH_MAX_NUM_STEPS.
+ * @param complete_cb Callback to execute once all steps are complete, or once any of them fails. Can be NULL.
+ * @param complete_cb_user_data User data to pass to @p complete_cb.
+ *
+ * @return InitGraph Created init graph instance.
+ */
+InitGraph init_graph_create(const InitGraphStep *const steps, size_t num_steps, InitGraphCompleteCb complete_cb,
+                            void *complete_cb_user_data);
+
+/**
+ * @brief Start all steps that have no dependencies.
+ *
+ * @param self Init graph instance returned by @ref init_graph_create.
+ *
+ * @note Fires an assert if the init graph has already been started.
+ */
+void init_graph_start(InitGraph self);
+
+/**
+ * @brief Notify the init graph that a step is complete.
+ *
+ * If @p result is true, starts all steps whose dependencies are now complete. Once all steps are complete, executes
+ * the complete callback with result true.
+ *
+ * If @p result is false, executes the complete callback with result false. No more steps are started after that, and
+ * later calls to this function are ignored, so that the steps that are already running can still complete.
+ *
+ * @param self Init graph instance returned by @ref init_graph_create.
+ * @param step_idx Index of the step in the "steps" array that was passed to @ref init_graph_create.
+ * @param result True if the step completed successfully, false otherwise.
+ *
+ * @note Fires an assert if the step has not been started, or if it has already completed.
+ */
+void init_graph_step_complete(InitGraph self, size_t step_idx, bool result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_UTILS_INIT_GRAPH_H */
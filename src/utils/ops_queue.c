@@ -1,18 +1,29 @@
 #include <stddef.h>
+#include <stdint.h>
+#include <string.h>
 
 #include "ops_queue.h"
 #include "eas_assert.h"
 #include "config.h"
-#include "eas_ring_buf.h"
 
 #ifndef CONFIG_OPS_QUEUE_MAX_NUM_INSTANCES
 #define CONFIG_OPS_QUEUE_MAX_NUM_INSTANCES 1
 #endif
 
+#ifndef CONFIG_OPS_QUEUE_MAX_NUM_PENDING_OPS
+#define CONFIG_OPS_QUEUE_MAX_NUM_PENDING_OPS 3
+#endif
+
 struct OpsQueueStruct {
     OpsQueueStartOp start_op;
     void *start_op_user_data;
-    EasRingBuf ops_ring_buf;
+    size_t op_size;
+    /** Pending ops, in the order in which they are started: higher priority first, and in the order in which they were
+     * added within the same priority. */
+    uint8_t *ops_buf;
+    uint8_t priorities[CONFIG_OPS_QUEUE_MAX_NUM_PENDING_OPS];
+    size_t num_pending_ops;
+    size_t max_num_pending_ops;
     void *op_buf;
     bool op_in_progress;
 };
@@ -20,11 +31,64 @@ struct OpsQueueStruct {
 static struct OpsQueueStruct instances[CONFIG_OPS_QUEUE_MAX_NUM_INSTANCES];
 static size_t instance_idx = 0;
 
+static uint8_t *get_pending_op(OpsQueue self, size_t idx)
+{
+    return &self->ops_buf[idx * self->op_size];
+}
+
+/**
+ * @brief Remove a pending op, shifting all pending ops after it one position forward.
+ *
+ * @param self Operations queue instance.
+ * @param idx Index of the pending op to remove.
+ */
+static void remove_pending_op(OpsQueue self, size_t idx)
+{
+    size_t num_ops_after = self->num_pending_ops - idx - 1;
+    memmove(get_pending_op(self, idx), get_pending_op(self, idx + 1), num_ops_after * self->op_size);
+    memmove(&self->priorities[idx], &self->priorities[idx + 1], num_ops_after * sizeof(self->priorities[0]));
+    self->num_pending_ops--;
+}
+
+/**
+ * @brief Insert a pending op after all pending ops with the same or higher priority.
+ *
+ * @param self Operations queue instance.
+ * @param op Op to insert.
+ * @param priority Op priority.
+ *
+ * @return true The op was inserted.
+ * @return false All pending op slots are taken.
+ */
+static bool insert_pending_op(OpsQueue self, const void *const op, uint8_t priority)
+{
+    if (self->num_pending_ops >= self->max_num_pending_ops) {
+        return false;
+    }
+
+    size_t idx = 0;
+    while ((idx < self->num_pending_ops) && (self->priorities[idx] >= priority)) {
+        idx++;
+    }
+    size_t num_ops_after = self->num_pending_ops - idx;
+    memmove(get_pending_op(self, idx + 1), get_pending_op(self, idx), num_ops_after * self->op_size);
+    memmove(&self->priorities[idx + 1], &self->priorities[idx], num_ops_after * sizeof(self->priorities[0]));
+
+    memcpy(get_pending_op(self, idx), op, self->op_size);
+    self->priorities[idx] = priority;
+    self->num_pending_ops++;
+    return true;
+}
+
 OpsQueue ops_queue_create(size_t op_size, size_t num_ops, void *ops_buf, void *op_buf, OpsQueueStartOp start_op,
                           void *start_op_user_data)
 {
     EAS_ASSERT(op_size > 0);
     EAS_ASSERT(num_ops > 1);
+    /* Every instance only has space for the priorities of this many pending ops */
+    bool is_num_pending_ops_supported = ((num_ops - 1) <= CONFIG_OPS_QUEUE_MAX_NUM_PENDING_OPS);
+    EAS_ASSERT(is_num_pending_ops_supported);
+    EAS_ASSERT(ops_buf);
     EAS_ASSERT(op_buf);
     EAS_ASSERT(start_op);
 
@@ -34,23 +98,53 @@ OpsQueue ops_queue_create(size_t op_size, size_t num_ops, void *ops_buf, void *o
 
     instance->start_op = start_op;
     instance->start_op_user_data = start_op_user_data;
-    instance->ops_ring_buf = eas_ring_buf_create(op_size, num_ops - 1, ops_buf);
+    instance->op_size = op_size;
+    instance->ops_buf = (uint8_t *)ops_buf;
+    instance->num_pending_ops = 0;
+    instance->max_num_pending_ops = num_ops - 1;
     instance->op_buf = op_buf;
     instance->op_in_progress = false;
 
     return instance;
 }
 
+/**
+ * @brief Start @p op right away if no op is in progress.
+ *
+ * @param self Operations queue instance.
+ * @param op Op to start.
+ *
+ * @return true @p op was started.
+ * @return false An op is in progress, @p op was not started.
+ */
+static bool start_op_if_idle(OpsQueue self, void *op)
+{
+    if (self->op_in_progress) {
+        return false;
+    }
+    self->start_op(op, self->start_op_user_data);
+    self->op_in_progress = true;
+    return true;
+}
+
 void ops_queue_add_op(OpsQueue self, void *op)
 {
     EAS_ASSERT(self);
     EAS_ASSERT(op);
 
-    if (!self->op_in_progress) {
-        self->start_op(op, self->start_op_user_data);
-        self->op_in_progress = true;
-    } else {
-        bool pushed = eas_ring_buf_push(self->ops_ring_buf, op);
+    if (!start_op_if_idle(self, op)) {
+        bool pushed = insert_pending_op(self, op, OPS_QUEUE_PRIORITY_LOWEST);
+        EAS_ASSERT(pushed);
+    }
+}
+
+void ops_queue_add_op_with_priority(OpsQueue self, void *op, uint8_t priority)
+{
+    EAS_ASSERT(self);
+    EAS_ASSERT(op);
+
+    if (!start_op_if_idle(self, op)) {
+        bool pushed = insert_pending_op(self, op, priority);
         EAS_ASSERT(pushed);
     }
 }
@@ -60,12 +154,14 @@ void ops_queue_op_complete(OpsQueue self)
     EAS_ASSERT(self);
     EAS_ASSERT(self->op_in_progress);
 
-    bool popped = eas_ring_buf_pop(self->ops_ring_buf, self->op_buf);
-    if (popped) {
+    if (self->num_pending_ops > 0) {
+        /* Copy the op out of ops_buf, so that start_op can add new ops while this one is in progress */
+        memcpy(self->op_buf, get_pending_op(self, 0), self->op_size);
+        remove_pending_op(self, 0);
         self->start_op(self->op_buf, self->start_op_user_data);
     } else {
-        /* No more ops pending. When the next op is added, it will be started right away instead of pushing it into the
-         * ring buffer. */
+        /* No more ops pending. When the next op is added, it will be started right away instead of storing it as a
+         * pending op. */
         self->op_in_progress = false;
     }
 }
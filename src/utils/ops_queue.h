@@ -6,7 +6,12 @@ extern "C"
 {
 #endif
 
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+
+/** Priority of operations added with @ref ops_queue_add_op. */
+#define OPS_QUEUE_PRIORITY_LOWEST 0
 
 typedef struct OpsQueueStruct *OpsQueue;
 
@@ -25,9 +30,9 @@ typedef void (*OpsQueueStartOp)(void *op, void *user_data);
  * @brief Create an operations queue instance.
  *
  * @param[in] op_size Size of one operation in bytes. Must be > 0.
- * @param[in] num_ops Number of operations that can be in progress at the same time. Must be > 1. This is the number of
- * times @p ops_queue_add_op can be called before it fires an assert (given that @p ops_queue_op_complete is not called
- * at all).
+ * @param[in] num_ops Number of operations that can be in progress at the same time. Must be > 1, and num_ops - 1 must
+ * be <= CONFIG_OPS_QUEUE_MAX_NUM_PENDING_OPS. This is the number of times @p ops_queue_add_op can be called before it
+ * fires an assert (given that @p ops_queue_op_complete is not called at all).
  * @param[in] ops_buf Must be of size ( @p op_size * ( @p num_ops - 1 )). -1 because the first operation never needs to
  * be stored anywhere - it can be started immediately.
  * @param[in] op_buf Buffer of size @p op_size. Needed for internal implementation of the operations queue.
@@ -42,11 +47,26 @@ OpsQueue ops_queue_create(size_t op_size, size_t num_ops, void *ops_buf, void *o
 /**
  * @brief Add an operation to the operations queue.
  *
+ * Same as @ref ops_queue_add_op_with_priority with priority OPS_QUEUE_PRIORITY_LOWEST.
+ *
  * @param self Operations queue instance returned by @ref ops_queue_create.
  * @param op Operation to add.
  */
 void ops_queue_add_op(OpsQueue self, void *op);
 
+/**
+ * @brief Add an operation with a priority to the operations queue.
+ *
+ * If no operation is in progress, the operation is started right away. Otherwise, it is stored as a pending operation.
+ * Pending operations with higher priority are started first. Pending operations with the same priority are started in
+ * the order in which they were added.
+ *
+ * @param self Operations queue instance returned by @ref ops_queue_create.
+ * @param op Operation to add.
+ * @param priority Operation priority. Higher value means higher priority.
+ */
+void ops_queue_add_op_with_priority(OpsQueue self, void *op, uint8_t priority);
+
 /**
  * @brief Notify the operations queue that the in progress operation is complete.
  *
@@ -0,0 +1,38 @@
+#include "virtual_led_sim.h"
+#include "eas_assert.h"
+
+static bool is_on = false;
+static LedColor color = LED_COLOR_RED;
+
+static void led_set(LedColor led_color);
+static void led_turn_off();
+
+static Led led = {
+    .set = led_set,
+    .turn_off = led_turn_off,
+};
+
+static void led_set(LedColor led_color)
+{
+    is_on = true;
+    color = led_color;
+}
+
+static void led_turn_off()
+{
+    is_on = false;
+}
+
+bool virtual_led_sim_get_state(LedColor *const led_color)
+{
+    EAS_ASSERT(led_color);
+    if (is_on) {
+        *led_color = color;
+    }
+    return is_on;
+}
+
+VirtualLedSimVirtualInterfaces virtual_led_sim_initialize()
+{
+    return (VirtualLedSimVirtualInterfaces){&led};
+}
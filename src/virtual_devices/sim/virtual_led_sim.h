@@ -0,0 +1,45 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_VIRTUAL_DEVICES_SIM_VIRTUAL_LED_SIM_H
+#define ENV_ALERT_SYSTEM_SRC_VIRTUAL_DEVICES_SIM_VIRTUAL_LED_SIM_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "led.h"
+
+/**
+ * @brief LED for the simulation.
+ *
+ * Remembers the state of the LED and counts how many times it was changed.
+ */
+
+typedef struct VirtualLedSimVirtualInterfaces {
+    const Led *const led;
+} VirtualLedSimVirtualInterfaces;
+
+/**
+ * @brief Get the current state of the LED.
+ *
+ * @param[out] led_color If true is returned, the color the LED is displaying is written to this parameter.
+ *
+ * @return true The LED is on.
+ * @return false The LED is off.
+ */
+bool virtual_led_sim_get_state(LedColor *const led_color);
+
+/**
+ * @brief Initialize virtual device.
+ *
+ * @return VirtualLedSimVirtualInterfaces Virtual device interfaces.
+ */
+VirtualLedSimVirtualInterfaces virtual_led_sim_initialize();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_VIRTUAL_DEVICES_SIM_VIRTUAL_LED_SIM_H */
@@ -0,0 +1,444 @@
+#include <stdbool.h>
+
+#include "virtual_sensors_sim.h"
+#include "virtual_eas_current_time.h"
+#include "eas_timer.h"
+#include "eas_assert.h"
+
+/* Same initial readout periods as virtual_sht31, virtual_bmp280 and virtual_bh1750 */
+#define VIRTUAL_SENSORS_SIM_TEMPERATURE_READOUT_PERIOD_MS 250
+#define VIRTUAL_SENSORS_SIM_PRESSURE_READOUT_PERIOD_MS 1000
+#define VIRTUAL_SENSORS_SIM_HUMIDITY_READOUT_PERIOD_MS 250
+#define VIRTUAL_SENSORS_SIM_LIGHT_INTENSITY_READOUT_PERIOD_MS 1000
+
+/* Representation limits of the sample types */
+#define VIRTUAL_SENSORS_SIM_MIN_TEMPERATURE INT16_MIN
+#define VIRTUAL_SENSORS_SIM_MAX_TEMPERATURE INT16_MAX
+#define VIRTUAL_SENSORS_SIM_MAX_PRESSURE UINT16_MAX
+#define VIRTUAL_SENSORS_SIM_MAX_HUMIDITY 1000
+#define VIRTUAL_SENSORS_SIM_MAX_LIGHT_INTENSITY UINT32_MAX
+
+typedef struct {
+    const VirtualSensorsSimWaypoint *waypoints;
+    size_t num_waypoints;
+    uint32_t noise;
+    int64_t min_value;
+    int64_t max_value;
+    EasTimer readout_timer;
+    uint32_t readout_period_ms;
+    uint32_t num_samples;
+    bool is_started;
+} VirtualSensorsSimSensor;
+
+static VirtualSensorsSimSensor sensors[VIRTUAL_SENSORS_SIM_NUM_VARIABLES] = {
+    [VIRTUAL_SENSORS_SIM_VARIABLE_TEMPERATURE] =
+        {.min_value = VIRTUAL_SENSORS_SIM_MIN_TEMPERATURE, .max_value = VIRTUAL_SENSORS_SIM_MAX_TEMPERATURE},
+    [VIRTUAL_SENSORS_SIM_VARIABLE_PRESSURE] = {.min_value = 0, .max_value = VIRTUAL_SENSORS_SIM_MAX_PRESSURE},
+    [VIRTUAL_SENSORS_SIM_VARIABLE_HUMIDITY] = {.min_value = 0, .max_value = VIRTUAL_SENSORS_SIM_MAX_HUMIDITY},
+    [VIRTUAL_SENSORS_SIM_VARIABLE_LIGHT_INTENSITY] =
+        {.min_value = 0, .max_value = VIRTUAL_SENSORS_SIM_MAX_LIGHT_INTENSITY},
+};
+
+static uint64_t rng_state = 1;
+
+static TemperatureSensorNewSampleCb temperature_new_sample_cb = NULL;
+static void *temperature_new_sample_cb_user_data = NULL;
+static PressureSensorNewSampleCb pressure_new_sample_cb = NULL;
+static void *pressure_new_sample_cb_user_data = NULL;
+static HumiditySensorNewSampleCb humidity_new_sample_cb = NULL;
+static void *humidity_new_sample_cb_user_data = NULL;
+static LightIntensitySensorNewSampleCb light_intensity_new_sample_cb = NULL;
+static void *light_intensity_new_sample_cb_user_data = NULL;
+
+/* If registered, temperature and humidity are read out together by the temperature readout timer, and reported
+ * through this callback */
+static MultiSampleNewSampleCb multi_sample_new_sample_cb = NULL;
+static void *multi_sample_new_sample_cb_user_data = NULL;
+/* Current period of the temperature readout timer while it reads out both temperature and humidity, 0 if the timer is
+ * not running */
+static uint32_t paired_readout_period_ms = 0;
+
+static void temperature_register_new_sample_cb(TemperatureSensorNewSampleCb cb, void *user_data);
+static void temperature_start();
+static void pressure_register_new_sample_cb(PressureSensorNewSampleCb cb, void *user_data);
+static void pressure_start();
+static void humidity_register_new_sample_cb(HumiditySensorNewSampleCb cb, void *user_data);
+static void humidity_start();
+static void light_intensity_register_new_sample_cb(LightIntensitySensorNewSampleCb cb, void *user_data);
+static void light_intensity_start();
+static void temperature_set_readout_period(uint32_t period_ms);
+static void pressure_set_readout_period(uint32_t period_ms);
+static void humidity_set_readout_period(uint32_t period_ms);
+static void light_intensity_set_readout_period(uint32_t period_ms);
+
+static TemperatureSensor temperature_sensor = {
+    .register_new_sample_cb = temperature_register_new_sample_cb,
+    .start = temperature_start,
+    .set_readout_period = temperature_set_readout_period,
+};
+
+static PressureSensor pressure_sensor = {
+    .register_new_sample_cb = pressure_register_new_sample_cb,
+    .start = pressure_start,
+    .set_readout_period = pressure_set_readout_period,
+};
+
+static HumiditySensor humidity_sensor = {
+    .register_new_sample_cb = humidity_register_new_sample_cb,
+    .start = humidity_start,
+    .set_readout_period = humidity_set_readout_period,
+};
+
+static LightIntensitySensor light_intensity_sensor = {
+    .register_new_sample_cb = light_intensity_register_new_sample_cb,
+    .start = light_intensity_start,
+    .set_readout_period = light_intensity_set_readout_period,
+};
+
+/**
+ * @brief Generate a pseudo-random number using xorshift64.
+ *
+ * @return uint64_t Pseudo-random number.
+ */
+static uint64_t rng_next()
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/**
+ * @brief Get the value of the script of a sensor at a point in time.
+ *
+ * @param sensor Sensor.
+ * @param time Virtual uptime in ms.
+ *
+ * @return int64_t Value interpolated between the two waypoints around @p time.
+ */
+static int64_t get_script_value(const VirtualSensorsSimSensor *const sensor, uint64_t time)
+{
+    if (sensor->num_waypoints == 0) {
+        return 0;
+    }
+    const VirtualSensorsSimWaypoint *waypoints = sensor->waypoints;
+    size_t last = sensor->num_waypoints - 1;
+    if (last == 0) {
+        return waypoints[0].value;
+    }
+
+    uint64_t time_in_script = time % waypoints[last].time;
+    size_t i = 0;
+    while (waypoints[i + 1].time <= time_in_script) {
+        i++;
+    }
+    const VirtualSensorsSimWaypoint *from = &waypoints[i];
+    const VirtualSensorsSimWaypoint *to = &waypoints[i + 1];
+    int64_t elapsed = (int64_t)(time_in_script - from->time);
+    int64_t duration = (int64_t)(to->time - from->time);
+    return from->value + (((to->value - from->value) * elapsed) / duration);
+}
+
+/**
+ * @brief Generate a new sample of a sensor.
+ *
+ * @param variable Variable measured by the sensor.
+ *
+ * @return int64_t Script value at the current virtual time with noise, clamped to the limits of the sample type.
+ */
+static int64_t generate_sample(VirtualSensorsSimVariable variable)
+{
+    VirtualSensorsSimSensor *const sensor = &sensors[variable];
+    int64_t sample = get_script_value(sensor, virtual_eas_current_time_get_uptime());
+    if (sensor->noise > 0) {
+        uint64_t noise_range = ((uint64_t)sensor->noise * 2) + 1;
+        sample += (int64_t)(rng_next() % noise_range) - (int64_t)sensor->noise;
+    }
+    if (sample < sensor->min_value) {
+        sample = sensor->min_value;
+    } else if (sample > sensor->max_value) {
+        sample = sensor->max_value;
+    }
+    sensor->num_samples++;
+    return sample;
+}
+
+/**
+ * @brief Create the readout timer of a sensor.
+ *
+ * @param variable Variable measured by the sensor.
+ * @param period_ms Initial readout period.
+ * @param cb Readout timer callback.
+ */
+static void create_readout_timer(VirtualSensorsSimVariable variable, uint32_t period_ms, EasTimerCb cb)
+{
+    VirtualSensorsSimSensor *const sensor = &sensors[variable];
+    sensor->readout_timer = eas_timer_create(period_ms, EAS_TIMER_PERIODIC, cb, NULL);
+    sensor->readout_period_ms = period_ms;
+}
+
+/**
+ * @brief Check whether a sensor is read out together with the other sensor of the temperature and humidity pair.
+ *
+ * @param variable Variable measured by the sensor.
+ *
+ * @retval true The sensor is read out by the temperature readout timer, together with the other sensor of the pair.
+ * @retval false The sensor is read out by its own readout timer.
+ */
+static bool is_paired_sensor(VirtualSensorsSimVariable variable)
+{
+    return (multi_sample_new_sample_cb != NULL) && ((variable == VIRTUAL_SENSORS_SIM_VARIABLE_TEMPERATURE) ||
+                                                     (variable == VIRTUAL_SENSORS_SIM_VARIABLE_HUMIDITY));
+}
+
+/**
+ * @brief Set the period of the temperature readout timer to the shorter one of the readout periods of the started
+ * sensors of the temperature and humidity pair, and start the timer if it is not running yet.
+ */
+static void update_paired_readout_timer()
+{
+    const VirtualSensorsSimSensor *const temperature = &sensors[VIRTUAL_SENSORS_SIM_VARIABLE_TEMPERATURE];
+    const VirtualSensorsSimSensor *const humidity = &sensors[VIRTUAL_SENSORS_SIM_VARIABLE_HUMIDITY];
+    uint32_t period_ms = UINT32_MAX;
+    if (temperature->is_started) {
+        period_ms = temperature->readout_period_ms;
+    }
+    if (humidity->is_started && (humidity->readout_period_ms < period_ms)) {
+        period_ms = humidity->readout_period_ms;
+    }
+    if ((period_ms == UINT32_MAX) || (period_ms == paired_readout_period_ms)) {
+        return;
+    }
+    /* Timer period can only be set while the timer is not running */
+    if (paired_readout_period_ms != 0) {
+        eas_timer_stop(temperature->readout_timer);
+    }
+    eas_timer_set_period(temperature->readout_timer, period_ms);
+    eas_timer_start(temperature->readout_timer);
+    paired_readout_period_ms = period_ms;
+}
+
+/**
+ * @brief Start periodic readouts of a sensor.
+ *
+ * @param variable Variable measured by the sensor.
+ */
+static void start_sensor(VirtualSensorsSimVariable variable)
+{
+    VirtualSensorsSimSensor *const sensor = &sensors[variable];
+    EAS_ASSERT(!sensor->is_started);
+    sensor->is_started = true;
+    if (is_paired_sensor(variable)) {
+        update_paired_readout_timer();
+        return;
+    }
+    eas_timer_start(sensor->readout_timer);
+}
+
+/**
+ * @brief Change the readout period of a sensor.
+ *
+ * @param variable Variable measured by the sensor.
+ * @param period_ms New readout period.
+ */
+static void set_sensor_readout_period(VirtualSensorsSimVariable variable, uint32_t period_ms)
+{
+    VirtualSensorsSimSensor *const sensor = &sensors[variable];
+    EAS_ASSERT(period_ms != 0);
+    if (period_ms == sensor->readout_period_ms) {
+        return;
+    }
+    sensor->readout_period_ms = period_ms;
+    if (is_paired_sensor(variable)) {
+        update_paired_readout_timer();
+        return;
+    }
+    /* Timer period can only be set while the timer is not running */
+    if (sensor->is_started) {
+        eas_timer_stop(sensor->readout_timer);
+    }
+    eas_timer_set_period(sensor->readout_timer, period_ms);
+    if (sensor->is_started) {
+        eas_timer_start(sensor->readout_timer);
+    }
+}
+
+/* Readout timer callbacks are executed from the central event queue context */
+
+/**
+ * @brief Read out temperature and humidity together, and report them as one multi sample.
+ *
+ * Only started sensors are read out.
+ */
+static void read_out_paired_sensors()
+{
+    MultiSample multi_sample = {.variables = 0};
+    if (sensors[VIRTUAL_SENSORS_SIM_VARIABLE_TEMPERATURE].is_started) {
+        multi_sample.temperature = (Temperature)generate_sample(VIRTUAL_SENSORS_SIM_VARIABLE_TEMPERATURE);
+        multi_sample.variables |= MULTI_SAMPLE_TEMPERATURE;
+    }
+    if (sensors[VIRTUAL_SENSORS_SIM_VARIABLE_HUMIDITY].is_started) {
+        multi_sample.humidity = (Humidity)generate_sample(VIRTUAL_SENSORS_SIM_VARIABLE_HUMIDITY);
+        multi_sample.variables |= MULTI_SAMPLE_HUMIDITY;
+    }
+    multi_sample_new_sample_cb(&multi_sample, multi_sample_new_sample_cb_user_data);
+}
+
+static void temperature_readout_timer_cb(void *user_data)
+{
+    if (multi_sample_new_sample_cb) {
+        read_out_paired_sensors();
+        return;
+    }
+    Temperature sample = (Temperature)generate_sample(VIRTUAL_SENSORS_SIM_VARIABLE_TEMPERATURE);
+    if (temperature_new_sample_cb) {
+        temperature_new_sample_cb(sample, temperature_new_sample_cb_user_data);
+    }
+}
+
+static void pressure_readout_timer_cb(void *user_data)
+{
+    Pressure sample = (Pressure)generate_sample(VIRTUAL_SENSORS_SIM_VARIABLE_PRESSURE);
+    if (pressure_new_sample_cb) {
+        pressure_new_sample_cb(sample, pressure_new_sample_cb_user_data);
+    }
+}
+
+static void humidity_readout_timer_cb(void *user_data)
+{
+    Humidity sample = (Humidity)generate_sample(VIRTUAL_SENSORS_SIM_VARIABLE_HUMIDITY);
+    if (humidity_new_sample_cb) {
+        humidity_new_sample_cb(sample, humidity_new_sample_cb_user_data);
+    }
+}
+
+static void light_intensity_readout_timer_cb(void *user_data)
+{
+    LightIntensity sample = (LightIntensity)generate_sample(VIRTUAL_SENSORS_SIM_VARIABLE_LIGHT_INTENSITY);
+    if (light_intensity_new_sample_cb) {
+        light_intensity_new_sample_cb(sample, light_intensity_new_sample_cb_user_data);
+    }
+}
+
+void virtual_sensors_sim_set_script(VirtualSensorsSimVariable variable, const VirtualSensorsSimWaypoint *waypoints,
+                                    size_t num_waypoints, uint32_t noise)
+{
+    EAS_ASSERT(variable < VIRTUAL_SENSORS_SIM_NUM_VARIABLES);
+    EAS_ASSERT(waypoints);
+    EAS_ASSERT(num_waypoints > 0);
+    EAS_ASSERT(waypoints[0].time == 0);
+    for (size_t i = 1; i < num_waypoints; i++) {
+        EAS_ASSERT(waypoints[i].time > waypoints[i - 1].time);
+    }
+    EAS_ASSERT(!sensors[variable].is_started);
+
+    sensors[variable].waypoints = waypoints;
+    sensors[variable].num_waypoints = num_waypoints;
+    sensors[variable].noise = noise;
+}
+
+void virtual_sensors_sim_register_new_multi_sample_cb(MultiSampleNewSampleCb cb, void *user_data)
+{
+    EAS_ASSERT(cb);
+    /* The readout timers of already started sensors could not be paired anymore */
+    bool is_pair_stopped = !sensors[VIRTUAL_SENSORS_SIM_VARIABLE_TEMPERATURE].is_started &&
+                           !sensors[VIRTUAL_SENSORS_SIM_VARIABLE_HUMIDITY].is_started;
+    EAS_ASSERT(is_pair_stopped);
+    multi_sample_new_sample_cb = cb;
+    multi_sample_new_sample_cb_user_data = user_data;
+}
+
+void virtual_sensors_sim_set_seed(uint64_t seed)
+{
+    /* xorshift gets stuck at 0 */
+    EAS_ASSERT(seed != 0);
+    rng_state = seed;
+}
+
+uint32_t virtual_sensors_sim_get_num_samples(VirtualSensorsSimVariable variable)
+{
+    EAS_ASSERT(variable < VIRTUAL_SENSORS_SIM_NUM_VARIABLES);
+    return sensors[variable].num_samples;
+}
+
+VirtualSensorsSimVirtualInterfaces virtual_sensors_sim_initialize()
+{
+    create_readout_timer(VIRTUAL_SENSORS_SIM_VARIABLE_TEMPERATURE, VIRTUAL_SENSORS_SIM_TEMPERATURE_READOUT_PERIOD_MS,
+                         temperature_readout_timer_cb);
+    create_readout_timer(VIRTUAL_SENSORS_SIM_VARIABLE_PRESSURE, VIRTUAL_SENSORS_SIM_PRESSURE_READOUT_PERIOD_MS,
+                         pressure_readout_timer_cb);
+    create_readout_timer(VIRTUAL_SENSORS_SIM_VARIABLE_HUMIDITY, VIRTUAL_SENSORS_SIM_HUMIDITY_READOUT_PERIOD_MS,
+                         humidity_readout_timer_cb);
+    create_readout_timer(VIRTUAL_SENSORS_SIM_VARIABLE_LIGHT_INTENSITY,
+                         VIRTUAL_SENSORS_SIM_LIGHT_INTENSITY_READOUT_PERIOD_MS, light_intensity_readout_timer_cb);
+    return (VirtualSensorsSimVirtualInterfaces){
+        &temperature_sensor, &pressure_sensor, &humidity_sensor, &light_intensity_sensor};
+}
+
+static void temperature_register_new_sample_cb(TemperatureSensorNewSampleCb cb, void *user_data)
+{
+    EAS_ASSERT(cb);
+    temperature_new_sample_cb = cb;
+    temperature_new_sample_cb_user_data = user_data;
+}
+
+static void temperature_start()
+{
+    start_sensor(VIRTUAL_SENSORS_SIM_VARIABLE_TEMPERATURE);
+}
+
+static void temperature_set_readout_period(uint32_t period_ms)
+{
+    set_sensor_readout_period(VIRTUAL_SENSORS_SIM_VARIABLE_TEMPERATURE, period_ms);
+}
+
+static void pressure_register_new_sample_cb(PressureSensorNewSampleCb cb, void *user_data)
+{
+    EAS_ASSERT(cb);
+    pressure_new_sample_cb = cb;
+    pressure_new_sample_cb_user_data = user_data;
+}
+
+static void pressure_start()
+{
+    start_sensor(VIRTUAL_SENSORS_SIM_VARIABLE_PRESSURE);
+}
+
+static void pressure_set_readout_period(uint32_t period_ms)
+{
+    set_sensor_readout_period(VIRTUAL_SENSORS_SIM_VARIABLE_PRESSURE, period_ms);
+}
+
+static void humidity_register_new_sample_cb(HumiditySensorNewSampleCb cb, void *user_data)
+{
+    EAS_ASSERT(cb);
+    humidity_new_sample_cb = cb;
+    humidity_new_sample_cb_user_data = user_data;
+}
+
+static void humidity_start()
+{
+    start_sensor(VIRTUAL_SENSORS_SIM_VARIABLE_HUMIDITY);
+}
+
+static void humidity_set_readout_period(uint32_t period_ms)
+{
+    set_sensor_readout_period(VIRTUAL_SENSORS_SIM_VARIABLE_HUMIDITY, period_ms);
+}
+
+static void light_intensity_register_new_sample_cb(LightIntensitySensorNewSampleCb cb, void *user_data)
+{
+    EAS_ASSERT(cb);
+    light_intensity_new_sample_cb = cb;
+    light_intensity_new_sample_cb_user_data = user_data;
+}
+
+static void light_intensity_start()
+{
+    start_sensor(VIRTUAL_SENSORS_SIM_VARIABLE_LIGHT_INTENSITY);
+}
+
+static void light_intensity_set_readout_period(uint32_t period_ms)
+{
+    set_sensor_readout_period(VIRTUAL_SENSORS_SIM_VARIABLE_LIGHT_INTENSITY, period_ms);
+}
@@ -0,0 +1,116 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_VIRTUAL_DEVICES_SIM_VIRTUAL_SENSORS_SIM_H
+#define ENV_ALERT_SYSTEM_SRC_VIRTUAL_DEVICES_SIM_VIRTUAL_SENSORS_SIM_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "temperature_sensor.h"
+#include "pressure_sensor.h"
+#include "humidity_sensor.h"
+#include "light_intensity_sensor.h"
+#include "multi_sample.h"
+
+/**
+ * @brief Scripted sensors for the simulation.
+ *
+ * Every sensor periodically generates samples, with the same initial readout periods as the sensors of the nrf52840dk
+ * port. The application can change them through set_readout_period, like with the real sensors.
+ * Sample values follow a script: a list of waypoints, each of which is a point in time and the value of the variable
+ * at that point in time. The value between two waypoints is interpolated linearly. The script repeats itself, and the
+ * time of the last waypoint is the length of one repetition. For example, a script with waypoints at 0 h and 24 h
+ * describes a daily cycle that can drive a simulation of several weeks.
+ *
+ * Optionally, uniformly distributed noise is added to every sample, so that alert conditions near their thresholds
+ * flap the way they do with real sensors.
+ *
+ * Like SHT31 in the nrf52840dk port, temperature and humidity are read out together and reported as one multi sample
+ * once a multi sample callback is registered. The shorter one of their readout periods is used for both of them.
+ *
+ * Samples are generated from the central event queue context, driven by eas_timer.
+ */
+
+typedef enum {
+    VIRTUAL_SENSORS_SIM_VARIABLE_TEMPERATURE,
+    VIRTUAL_SENSORS_SIM_VARIABLE_PRESSURE,
+    VIRTUAL_SENSORS_SIM_VARIABLE_HUMIDITY,
+    VIRTUAL_SENSORS_SIM_VARIABLE_LIGHT_INTENSITY,
+    VIRTUAL_SENSORS_SIM_NUM_VARIABLES,
+} VirtualSensorsSimVariable;
+
+/** Point of a sensor script */
+typedef struct VirtualSensorsSimWaypoint {
+    /** Time in ms since the beginning of the script repetition */
+    uint64_t time;
+    /** Value of the variable at @ref time, in the units of the variable's sample type */
+    int64_t value;
+} VirtualSensorsSimWaypoint;
+
+/** All scripted sensors */
+typedef struct VirtualSensorsSimVirtualInterfaces {
+    const TemperatureSensor *const temperature_sensor;
+    const PressureSensor *const pressure_sensor;
+    const HumiditySensor *const humidity_sensor;
+    const LightIntensitySensor *const light_intensity_sensor;
+} VirtualSensorsSimVirtualInterfaces;
+
+/**
+ * @brief Set the script of a sensor.
+ *
+ * Must be called before the sensor is started. A sensor without a script generates samples with value 0.
+ *
+ * @param variable Variable measured by the sensor.
+ * @param waypoints Waypoints of the script. Must persist for the whole lifetime of this module - this module accesses
+ * the pointer without making a local copy. The first waypoint must be at time 0, and times must be strictly
+ * increasing.
+ * @param num_waypoints Number of waypoints in @p waypoints. Must be at least 1. With one waypoint, the value is
+ * constant.
+ * @param noise Every sample is offset by a pseudo-random value in the range [-noise, noise].
+ */
+void virtual_sensors_sim_set_script(VirtualSensorsSimVariable variable, const VirtualSensorsSimWaypoint *waypoints,
+                                    size_t num_waypoints, uint32_t noise);
+
+/**
+ * @brief Register a callback to execute whenever temperature and humidity samples are read out together.
+ *
+ * Must be called before the temperature and humidity sensors are started. Afterwards, their samples are only reported
+ * through @p cb, and not through the new sample callbacks of the temperature and humidity sensors.
+ *
+ * @param cb Callback to register.
+ * @param user_data User data to pass to @p cb.
+ */
+void virtual_sensors_sim_register_new_multi_sample_cb(MultiSampleNewSampleCb cb, void *user_data);
+
+/**
+ * @brief Set the seed of the pseudo-random noise generator.
+ *
+ * @param seed Seed. Must not be 0.
+ */
+void virtual_sensors_sim_set_seed(uint64_t seed);
+
+/**
+ * @brief Get the number of samples a sensor has generated.
+ *
+ * @param variable Variable measured by the sensor.
+ *
+ * @return uint32_t Number of generated samples.
+ */
+uint32_t virtual_sensors_sim_get_num_samples(VirtualSensorsSimVariable variable);
+
+/**
+ * @brief Initialize scripted sensors.
+ *
+ * @return VirtualSensorsSimVirtualInterfaces Initialized virtual device interfaces that contain valid, ready-to-use
+ * function pointers.
+ */
+VirtualSensorsSimVirtualInterfaces virtual_sensors_sim_initialize();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_VIRTUAL_DEVICES_SIM_VIRTUAL_SENSORS_SIM_H */
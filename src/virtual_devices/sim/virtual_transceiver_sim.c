@@ -0,0 +1,108 @@
+#include <pthread.h>
+
+#include "virtual_transceiver_sim.h"
+#include "config.h"
+#include "eas_assert.h"
+
+#ifndef CONFIG_VIRTUAL_TRANSCEIVER_SIM_MAX_NUM_TRANSMISSIONS_IN_PROGRESS
+#define CONFIG_VIRTUAL_TRANSCEIVER_SIM_MAX_NUM_TRANSMISSIONS_IN_PROGRESS 1
+#endif
+
+/* Macro for readability */
+#define TRANSMIT_SUCCESS true
+
+typedef struct {
+    TransceiverTransmitCompleteCb cb;
+    void *user_data;
+} VirtualTransceiverSimTransmission;
+
+static TransceiverReceiveCb receive_cb = NULL;
+static void *receive_cb_user_data = NULL;
+
+static VirtualTransceiverSimTransmitObserverCb transmit_observer_cb = NULL;
+static void *transmit_observer_cb_user_data = NULL;
+
+/* Transmissions are started from the central event queue thread and completed from the simulation thread */
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static VirtualTransceiverSimTransmission
+    transmissions[CONFIG_VIRTUAL_TRANSCEIVER_SIM_MAX_NUM_TRANSMISSIONS_IN_PROGRESS];
+static size_t num_transmissions = 0;
+
+static void transceiver_transmit(const uint8_t *const bytes, size_t num_bytes, TransceiverTransmitCompleteCb cb,
+                                 void *user_data);
+static void transceiver_set_receive_cb(TransceiverReceiveCb cb, void *user_data);
+static void transceiver_unset_receive_cb();
+
+static Transceiver transceiver = {
+    .transmit = transceiver_transmit,
+    .set_receive_cb = transceiver_set_receive_cb,
+    .unset_receive_cb = transceiver_unset_receive_cb,
+};
+
+static void transceiver_transmit(const uint8_t *const bytes, size_t num_bytes, TransceiverTransmitCompleteCb cb,
+                                 void *user_data)
+{
+    if (transmit_observer_cb) {
+        transmit_observer_cb(bytes, num_bytes, transmit_observer_cb_user_data);
+    }
+
+    pthread_mutex_lock(&mutex);
+    EAS_ASSERT(num_transmissions < CONFIG_VIRTUAL_TRANSCEIVER_SIM_MAX_NUM_TRANSMISSIONS_IN_PROGRESS);
+    transmissions[num_transmissions].cb = cb;
+    transmissions[num_transmissions].user_data = user_data;
+    num_transmissions++;
+    pthread_mutex_unlock(&mutex);
+}
+
+static void transceiver_set_receive_cb(TransceiverReceiveCb cb, void *user_data)
+{
+    receive_cb = cb;
+    receive_cb_user_data = user_data;
+}
+
+static void transceiver_unset_receive_cb()
+{
+    receive_cb = NULL;
+    receive_cb_user_data = NULL;
+}
+
+void virtual_transceiver_sim_set_transmit_observer_cb(VirtualTransceiverSimTransmitObserverCb cb, void *user_data)
+{
+    transmit_observer_cb = cb;
+    transmit_observer_cb_user_data = user_data;
+}
+
+bool virtual_transceiver_sim_receive(const uint8_t *const bytes, size_t num_bytes)
+{
+    EAS_ASSERT(bytes);
+    if (!receive_cb) {
+        return false;
+    }
+    receive_cb(bytes, num_bytes, receive_cb_user_data);
+    return true;
+}
+
+size_t virtual_transceiver_sim_complete_transmissions()
+{
+    /* Callbacks are executed without holding the mutex, because they are allowed to start new transmissions */
+    VirtualTransceiverSimTransmission completed[CONFIG_VIRTUAL_TRANSCEIVER_SIM_MAX_NUM_TRANSMISSIONS_IN_PROGRESS];
+    pthread_mutex_lock(&mutex);
+    size_t num_completed = num_transmissions;
+    for (size_t i = 0; i < num_completed; i++) {
+        completed[i] = transmissions[i];
+    }
+    num_transmissions = 0;
+    pthread_mutex_unlock(&mutex);
+
+    for (size_t i = 0; i < num_completed; i++) {
+        if (completed[i].cb) {
+            completed[i].cb(TRANSMIT_SUCCESS, completed[i].user_data);
+        }
+    }
+    return num_completed;
+}
+
+VirtualTransceiverSimVirtualInterfaces virtual_transceiver_sim_initialize()
+{
+    return (VirtualTransceiverSimVirtualInterfaces){&transceiver};
+}
@@ -0,0 +1,80 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_VIRTUAL_DEVICES_SIM_VIRTUAL_TRANSCEIVER_SIM_H
+#define ENV_ALERT_SYSTEM_SRC_VIRTUAL_DEVICES_SIM_VIRTUAL_TRANSCEIVER_SIM_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "transceiver.h"
+
+/**
+ * @brief Transceiver for the simulation.
+ *
+ * Plays the role of the BLE central: the simulation injects received messages and observes transmitted ones.
+ * Transmissions do not complete on their own. Their transmit complete callbacks are executed when the simulation calls
+ * @ref virtual_transceiver_sim_complete_transmissions, the same way the BLE stack completes them from its own thread.
+ */
+
+/**
+ * @brief Callback executed for every transmitted message.
+ *
+ * Executed from the context of the caller of the transmit function.
+ *
+ * @param bytes Transmitted bytes. Only valid for the duration of the callback.
+ * @param num_bytes Number of bytes in @p bytes.
+ * @param user_data User data.
+ */
+typedef void (*VirtualTransceiverSimTransmitObserverCb)(const uint8_t *bytes, size_t num_bytes, void *user_data);
+
+typedef struct VirtualTransceiverSimVirtualInterfaces {
+    const Transceiver *const transceiver;
+} VirtualTransceiverSimVirtualInterfaces;
+
+/**
+ * @brief Set callback to execute for every transmitted message.
+ *
+ * @param cb Callback.
+ * @param user_data User data to pass to @p cb.
+ */
+void virtual_transceiver_sim_set_transmit_observer_cb(VirtualTransceiverSimTransmitObserverCb cb, void *user_data);
+
+/**
+ * @brief Receive a message.
+ *
+ * Executes the receive callback from the context of the caller.
+ *
+ * @param bytes Received bytes.
+ * @param num_bytes Number of bytes in @p bytes.
+ *
+ * @return true The message was passed to the receive callback.
+ * @return false The message was dropped, because no receive callback is set.
+ */
+bool virtual_transceiver_sim_receive(const uint8_t *const bytes, size_t num_bytes);
+
+/**
+ * @brief Complete all transmissions that are in progress.
+ *
+ * Transmit complete callbacks are executed with a successful result from the context of the caller, in the order in
+ * which the transmissions were started. Transmissions started by the callbacks are not completed by this call.
+ *
+ * @return size_t Number of completed transmissions.
+ */
+size_t virtual_transceiver_sim_complete_transmissions();
+
+/**
+ * @brief Initialize virtual device.
+ *
+ * @return VirtualTransceiverSimVirtualInterfaces Virtual device interfaces.
+ */
+VirtualTransceiverSimVirtualInterfaces virtual_transceiver_sim_initialize();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_VIRTUAL_DEVICES_SIM_VIRTUAL_TRANSCEIVER_SIM_H */
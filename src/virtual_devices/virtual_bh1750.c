@@ -7,19 +7,26 @@
 
 EAS_LOG_ENABLE_IN_FILE();
 
+/* Readout period until it is changed by set_readout_period */
 #define BH1750_READOUT_PERIOD_MS 1000
 
 static void light_intensity_register_new_sample_cb(LightIntensitySensorNewSampleCb cb, void *user_data);
 static void light_intensity_start();
+static void light_intensity_set_readout_period(uint32_t period_ms);
 
 static LightIntensitySensor light_intensity_sensor = {
     .register_new_sample_cb = light_intensity_register_new_sample_cb,
     .start = light_intensity_start,
+    .set_readout_period = light_intensity_set_readout_period,
 };
 
 static EasTimer bh1750_readout_timer;
+static uint32_t bh1750_readout_period_ms = BH1750_READOUT_PERIOD_MS;
+static bool is_started = false;
 static BH1750 *bh1750_inst_p;
 static uint32_t meas_lx;
+/* True from starting a readout until its measurement is complete */
+static bool is_readout_in_progress = false;
 
 static LightIntensitySensorNewSampleCb light_intensity_new_sample_cb = NULL;
 static void *light_intensity_new_sample_cb_user_data = NULL;
@@ -44,6 +51,7 @@ static void execute_new_sample_cb(LightIntensity sample)
  */
 static void one_time_meas_complete_cb(uint8_t result_code, void *user_data)
 {
+    is_readout_in_progress = false;
     if (result_code != BH1750_RESULT_CODE_OK) {
         EAS_LOG_INF("Failed to read BH1750 meas");
         return;
@@ -56,6 +64,11 @@ static void one_time_meas_complete_cb(uint8_t result_code, void *user_data)
 /* This callback will be executed from the central event queue context */
 static void bh1750_readout_timer_cb(void *user_data)
 {
+    if (is_readout_in_progress) {
+        EAS_LOG_INF("BH1750 readout skipped, previous readout in progress");
+        return;
+    }
+    is_readout_in_progress = true;
     /* Pass &meas_lx as user data, so that we can pass the measurement sample to the new light intensity sample cb */
     uint8_t rc = bh1750_read_one_time_measurement(*bh1750_inst_p, BH1750_MEAS_MODE_H_RES, &meas_lx,
                                                   one_time_meas_complete_cb, &meas_lx);
@@ -81,8 +94,24 @@ static void light_intensity_register_new_sample_cb(LightIntensitySensorNewSample
 
 static void light_intensity_start()
 {
-    static bool is_started = false;
     EAS_ASSERT(!is_started);
     eas_timer_start(bh1750_readout_timer);
     is_started = true;
 }
+
+static void light_intensity_set_readout_period(uint32_t period_ms)
+{
+    EAS_ASSERT(period_ms != 0);
+    if (period_ms == bh1750_readout_period_ms) {
+        return;
+    }
+    bh1750_readout_period_ms = period_ms;
+    /* Timer period can only be set while the timer is not running */
+    if (is_started) {
+        eas_timer_stop(bh1750_readout_timer);
+    }
+    eas_timer_set_period(bh1750_readout_timer, period_ms);
+    if (is_started) {
+        eas_timer_start(bh1750_readout_timer);
+    }
+}
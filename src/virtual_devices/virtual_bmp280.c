@@ -20,20 +20,26 @@ EAS_STATIC_ASSERT(sizeof(Pressure) == sizeof(uint16_t));
 
 static void pressure_register_new_sample_cb(PressureSensorNewSampleCb cb, void *user_data);
 static void pressure_start();
+static void pressure_set_readout_period(uint32_t period_ms);
 
 static PressureSensor pressure_sensor = {
     .register_new_sample_cb = pressure_register_new_sample_cb,
     .start = pressure_start,
+    .set_readout_period = pressure_set_readout_period,
 };
 
 static EasTimer bmp280_readout_timer;
 static BMP280 *bmp280_inst_p;
+static bool is_started = false;
 
 static PressureSensorNewSampleCb pressure_new_sample_cb = NULL;
 static void *pressure_new_sample_cb_user_data = NULL;
 
+/* Readout period until it is changed by set_readout_period */
 #define BMP280_READOUT_PERIOD_MS 1000
 
+static uint32_t bmp280_readout_period_ms = BMP280_READOUT_PERIOD_MS;
+
 /**
  * @brief Execute a new pressure sample callback, if one is registered.
  *
@@ -129,8 +135,24 @@ static void pressure_register_new_sample_cb(PressureSensorNewSampleCb cb, void *
 
 static void pressure_start()
 {
-    static bool is_started = false;
     EAS_ASSERT(!is_started);
     eas_timer_start(bmp280_readout_timer);
     is_started = true;
 }
+
+static void pressure_set_readout_period(uint32_t period_ms)
+{
+    EAS_ASSERT(period_ms != 0);
+    if (period_ms == bmp280_readout_period_ms) {
+        return;
+    }
+    bmp280_readout_period_ms = period_ms;
+    /* Timer period can only be set while the timer is not running */
+    if (is_started) {
+        eas_timer_stop(bmp280_readout_timer);
+    }
+    eas_timer_set_period(bmp280_readout_timer, period_ms);
+    if (is_started) {
+        eas_timer_start(bmp280_readout_timer);
+    }
+}
@@ -0,0 +1,139 @@
+#include "virtual_sensors_mock.h"
+#include "CppUTestExt/MockSupport.h"
+
+static void temperature_sensor_register_new_sample_cb(TemperatureSensorNewSampleCb cb, void *user_data);
+static void temperature_sensor_start();
+static void temperature_sensor_set_readout_period(uint32_t period_ms);
+static void pressure_sensor_register_new_sample_cb(PressureSensorNewSampleCb cb, void *user_data);
+static void pressure_sensor_start();
+static void pressure_sensor_set_readout_period(uint32_t period_ms);
+static void humidity_sensor_register_new_sample_cb(HumiditySensorNewSampleCb cb, void *user_data);
+static void humidity_sensor_start();
+static void humidity_sensor_set_readout_period(uint32_t period_ms);
+static void light_intensity_sensor_register_new_sample_cb(LightIntensitySensorNewSampleCb cb, void *user_data);
+static void light_intensity_sensor_start();
+static void light_intensity_sensor_set_readout_period(uint32_t period_ms);
+
+static TemperatureSensor temperature_sensor = {
+    .register_new_sample_cb = temperature_sensor_register_new_sample_cb,
+    .start = temperature_sensor_start,
+    .set_readout_period = temperature_sensor_set_readout_period,
+};
+
+static PressureSensor pressure_sensor = {
+    .register_new_sample_cb = pressure_sensor_register_new_sample_cb,
+    .start = pressure_sensor_start,
+    .set_readout_period = pressure_sensor_set_readout_period,
+};
+
+static HumiditySensor humidity_sensor = {
+    .register_new_sample_cb = humidity_sensor_register_new_sample_cb,
+    .start = humidity_sensor_start,
+    .set_readout_period = humidity_sensor_set_readout_period,
+};
+
+static LightIntensitySensor light_intensity_sensor = {
+    .register_new_sample_cb = light_intensity_sensor_register_new_sample_cb,
+    .start = light_intensity_sensor_start,
+    .set_readout_period = light_intensity_sensor_set_readout_period,
+};
+
+void temperature_sensor_register_new_sample_cb(TemperatureSensorNewSampleCb cb, void *user_data)
+{
+    mock()
+        .actualCall("temperature_sensor_register_new_sample_cb")
+        .withParameter("cb", (void *)cb)
+        .withParameter("user_data", user_data);
+}
+
+void temperature_sensor_start()
+{
+    mock().actualCall("temperature_sensor_start");
+}
+
+void temperature_sensor_set_readout_period(uint32_t period_ms)
+{
+    mock().actualCall("temperature_sensor_set_readout_period").withParameter("period_ms", period_ms);
+}
+
+void pressure_sensor_register_new_sample_cb(PressureSensorNewSampleCb cb, void *user_data)
+{
+    mock()
+        .actualCall("pressure_sensor_register_new_sample_cb")
+        .withParameter("cb", (void *)cb)
+        .withParameter("user_data", user_data);
+}
+
+void pressure_sensor_start()
+{
+    mock().actualCall("pressure_sensor_start");
+}
+
+void pressure_sensor_set_readout_period(uint32_t period_ms)
+{
+    mock().actualCall("pressure_sensor_set_readout_period").withParameter("period_ms", period_ms);
+}
+
+void humidity_sensor_register_new_sample_cb(HumiditySensorNewSampleCb cb, void *user_data)
+{
+    mock()
+        .actualCall("humidity_sensor_register_new_sample_cb")
+        .withParameter("cb", (void *)cb)
+        .withParameter("user_data", user_data);
+}
+
+void humidity_sensor_start()
+{
+    mock().actualCall("humidity_sensor_start");
+}
+
+void humidity_sensor_set_readout_period(uint32_t period_ms)
+{
+    mock().actualCall("humidity_sensor_set_readout_period").withParameter("period_ms", period_ms);
+}
+
+void light_intensity_sensor_register_new_sample_cb(LightIntensitySensorNewSampleCb cb, void *user_data)
+{
+    mock()
+        .actualCall("light_intensity_sensor_register_new_sample_cb")
+        .withParameter("cb", (void *)cb)
+        .withParameter("user_data", user_data);
+}
+
+void light_intensity_sensor_start()
+{
+    mock().actualCall("light_intensity_sensor_start");
+}
+
+void light_intensity_sensor_set_readout_period(uint32_t period_ms)
+{
+    mock().actualCall("light_intensity_sensor_set_readout_period").withParameter("period_ms", period_ms);
+}
+
+const TemperatureSensor *const virtual_temperature_sensor_mock_get()
+{
+    return &temperature_sensor;
+}
+
+const PressureSensor *const virtual_pressure_sensor_mock_get()
+{
+    return &pressure_sensor;
+}
+
+const HumiditySensor *const virtual_humidity_sensor_mock_get()
+{
+    return &humidity_sensor;
+}
+
+const LightIntensitySensor *const virtual_light_intensity_sensor_mock_get()
+{
+    return &light_intensity_sensor;
+}
+
+void virtual_sensors_mock_register_new_multi_sample_cb(MultiSampleNewSampleCb cb, void *user_data)
+{
+    mock()
+        .actualCall("register_new_multi_sample_cb")
+        .withParameter("cb", (void *)cb)
+        .withParameter("user_data", user_data);
+}
@@ -0,0 +1,59 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_VIRTUAL_DEVICES_VIRTUAL_SENSORS_MOCK_H
+#define ENV_ALERT_SYSTEM_SRC_VIRTUAL_DEVICES_VIRTUAL_SENSORS_MOCK_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "temperature_sensor.h"
+#include "pressure_sensor.h"
+#include "humidity_sensor.h"
+#include "light_intensity_sensor.h"
+#include "multi_sample.h"
+
+/**
+ * @brief Returns the temperature sensor interface with function pointers initialized to functions that implement the
+ * temperature sensor interface using mock CppUMock functions.
+ *
+ * @return const TemperatureSensor* const Mock temperature sensor interface.
+ */
+const TemperatureSensor *const virtual_temperature_sensor_mock_get();
+
+/**
+ * @brief Returns the pressure sensor interface with function pointers initialized to functions that implement the
+ * pressure sensor interface using mock CppUMock functions.
+ *
+ * @return const PressureSensor* const Mock pressure sensor interface.
+ */
+const PressureSensor *const virtual_pressure_sensor_mock_get();
+
+/**
+ * @brief Returns the humidity sensor interface with function pointers initialized to functions that implement the
+ * humidity sensor interface using mock CppUMock functions.
+ *
+ * @return const HumiditySensor* const Mock humidity sensor interface.
+ */
+const HumiditySensor *const virtual_humidity_sensor_mock_get();
+
+/**
+ * @brief Returns the light intensity sensor interface with function pointers initialized to functions that implement
+ * the light intensity sensor interface using mock CppUMock functions.
+ *
+ * @return const LightIntensitySensor* const Mock light intensity sensor interface.
+ */
+const LightIntensitySensor *const virtual_light_intensity_sensor_mock_get();
+
+/**
+ * @brief Mock implementation of registering a multi sample callback, using mock CppUMock functions.
+ *
+ * @param cb Callback to register.
+ * @param user_data User data to pass to @p cb.
+ */
+void virtual_sensors_mock_register_new_multi_sample_cb(MultiSampleNewSampleCb cb, void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_VIRTUAL_DEVICES_VIRTUAL_SENSORS_MOCK_H */
@@ -10,6 +10,7 @@
 
 EAS_LOG_ENABLE_IN_FILE();
 
+/* Readout periods until they are changed by set_readout_period */
 #define SHT31_TEMPERATURE_READOUT_PERIOD_MS 250
 #define SHT31_HUMIDITY_READOUT_PERIOD_MS 250
 EAS_STATIC_ASSERT(SHT31_TEMPERATURE_READOUT_PERIOD_MS == SHT31_HUMIDITY_READOUT_PERIOD_MS);
@@ -17,34 +18,48 @@ EAS_STATIC_ASSERT(SHT31_TEMPERATURE_READOUT_PERIOD_MS == SHT31_HUMIDITY_READOUT_
 /* Temperature sensor section */
 static void temperature_register_new_sample_cb(TemperatureSensorNewSampleCb cb, void *user_data);
 static void temperature_start();
+static void temperature_set_readout_period(uint32_t period_ms);
 
 /* Humidity sensor section */
 static void humidity_register_new_sample_cb(HumiditySensorNewSampleCb cb, void *user_data);
 static void humidity_start();
+static void humidity_set_readout_period(uint32_t period_ms);
 
 static TemperatureSensor temperature_sensor = {
     .register_new_sample_cb = temperature_register_new_sample_cb,
     .start = temperature_start,
+    .set_readout_period = temperature_set_readout_period,
 };
 
 static HumiditySensor humidity_sensor = {
     .register_new_sample_cb = humidity_register_new_sample_cb,
     .start = humidity_start,
+    .set_readout_period = humidity_set_readout_period,
 };
 
 /* Common private data */
 static EasTimer sht31_readout_timer;
+/* Current period of sht31_readout_timer */
+static uint32_t sht31_readout_period_ms = SHT31_TEMPERATURE_READOUT_PERIOD_MS;
 static SHT3X *sht3x_inst;
+/* True from starting a readout until its measurement is complete */
+static bool is_readout_in_progress = false;
 
 /* Temperature sensor private data */
 static TemperatureSensorNewSampleCb temperature_new_sample_cb = NULL;
 static void *temperature_new_sample_cb_user_data = NULL;
 static bool temperature_started = false;
+static uint32_t temperature_readout_period_ms = SHT31_TEMPERATURE_READOUT_PERIOD_MS;
 
 /* Humidity sensor private data */
 static HumiditySensorNewSampleCb humidity_new_sample_cb = NULL;
 static void *humidity_new_sample_cb_user_data = NULL;
 static bool humidity_started = false;
+static uint32_t humidity_readout_period_ms = SHT31_HUMIDITY_READOUT_PERIOD_MS;
+
+/* If registered, temperature and humidity samples are reported together through this callback */
+static MultiSampleNewSampleCb multi_sample_new_sample_cb = NULL;
+static void *multi_sample_new_sample_cb_user_data = NULL;
 
 /**
  * @brief Execute temperature new sample callback, if one is registered.
@@ -72,6 +87,7 @@ static void humidity_execute_new_sample_cb(Humidity sample)
 
 static void sht3x_meas_complete_cb(uint8_t result_code, SHT3XMeasurement *meas, void *user_data)
 {
+    is_readout_in_progress = false;
     if (result_code == SHT3X_RESULT_CODE_CRC_MISMATCH) {
         EAS_LOG_INF("Temperature or humidity CRC mismatch");
         return;
@@ -81,21 +97,65 @@ static void sht3x_meas_complete_cb(uint8_t result_code, SHT3XMeasurement *meas,
     }
     EAS_ASSERT(meas);
 
+    MultiSample multi_sample = {.variables = 0};
     if (temperature_started) {
         /* One decimal point precision */
-        Temperature temperature = lroundf(meas->temperature * 10.0f);
-        temperature_execute_new_sample_cb(temperature);
+        multi_sample.temperature = lroundf(meas->temperature * 10.0f);
+        multi_sample.variables |= MULTI_SAMPLE_TEMPERATURE;
     }
     if (humidity_started) {
         /* One decimal point precision */
-        Humidity humidity = lroundf(meas->humidity * 10.0f);
-        humidity_execute_new_sample_cb(humidity);
+        multi_sample.humidity = lroundf(meas->humidity * 10.0f);
+        multi_sample.variables |= MULTI_SAMPLE_HUMIDITY;
+    }
+
+    if (multi_sample_new_sample_cb) {
+        /* Both samples come from the same measurement, report them together */
+        multi_sample_new_sample_cb(&multi_sample, multi_sample_new_sample_cb_user_data);
+        return;
+    }
+    if (multi_sample.variables & MULTI_SAMPLE_TEMPERATURE) {
+        temperature_execute_new_sample_cb(multi_sample.temperature);
+    }
+    if (multi_sample.variables & MULTI_SAMPLE_HUMIDITY) {
+        humidity_execute_new_sample_cb(multi_sample.humidity);
+    }
+}
+
+/**
+ * @brief Set the period of the readout timer to the shorter one of temperature and humidity readout periods.
+ *
+ * Temperature and humidity are always read out together, so the variable that needs to be read out more often
+ * determines the period.
+ */
+static void update_sht31_readout_period()
+{
+    uint32_t period_ms = (temperature_readout_period_ms < humidity_readout_period_ms) ? temperature_readout_period_ms
+                                                                                      : humidity_readout_period_ms;
+    if (period_ms == sht31_readout_period_ms) {
+        return;
+    }
+    sht31_readout_period_ms = period_ms;
+    /* Timer period can only be set while the timer is not running */
+    bool is_running = temperature_started || humidity_started;
+    if (is_running) {
+        eas_timer_stop(sht31_readout_timer);
+    }
+    eas_timer_set_period(sht31_readout_timer, period_ms);
+    if (is_running) {
+        eas_timer_start(sht31_readout_timer);
     }
 }
 
 /* This callback will be executed from the central event queue context */
 static void sht31_readout_timer_cb(void *user_data)
 {
+    if (is_readout_in_progress) {
+        /* A readout queued behind a busy I2C bus would only report stale samples late */
+        EAS_LOG_INF("SHT31 readout skipped, previous readout in progress");
+        return;
+    }
+    is_readout_in_progress = true;
     /* Read both temperature and humidity and verify their CRCs */
     static const uint8_t flags =
         SHT3X_FLAG_READ_TEMP | SHT3X_FLAG_READ_HUM | SHT3X_FLAG_VERIFY_CRC_TEMP | SHT3X_FLAG_VERIFY_CRC_HUM;
@@ -117,6 +177,13 @@ SHT31VirtualInterfaces virtual_sht31_initialize(SHT3X *const sht3x_driver_inst)
     return (SHT31VirtualInterfaces){&temperature_sensor, &humidity_sensor};
 }
 
+void virtual_sht31_register_new_multi_sample_cb(MultiSampleNewSampleCb cb, void *user_data)
+{
+    EAS_ASSERT(cb);
+    multi_sample_new_sample_cb = cb;
+    multi_sample_new_sample_cb_user_data = user_data;
+}
+
 /* Virtual temperature sensor functions */
 
 static void temperature_register_new_sample_cb(TemperatureSensorNewSampleCb cb, void *user_data)
@@ -135,6 +202,13 @@ static void temperature_start()
     temperature_started = true;
 }
 
+static void temperature_set_readout_period(uint32_t period_ms)
+{
+    EAS_ASSERT(period_ms != 0);
+    temperature_readout_period_ms = period_ms;
+    update_sht31_readout_period();
+}
+
 /* Virtual humidity sensor functions */
 
 static void humidity_register_new_sample_cb(HumiditySensorNewSampleCb cb, void *user_data)
@@ -152,3 +226,10 @@ static void humidity_start()
     }
     humidity_started = true;
 }
+
+static void humidity_set_readout_period(uint32_t period_ms)
+{
+    EAS_ASSERT(period_ms != 0);
+    humidity_readout_period_ms = period_ms;
+    update_sht31_readout_period();
+}
@@ -8,6 +8,7 @@ extern "C"
 
 #include "temperature_sensor.h"
 #include "humidity_sensor.h"
+#include "multi_sample.h"
 #include "sht3x.h"
 
 /** All virtual devices that are based on SHT31. */
@@ -29,6 +30,18 @@ typedef struct SHT31VirtualInterfaces {
  */
 SHT31VirtualInterfaces virtual_sht31_initialize(SHT3X *const sht3x_driver_inst);
 
+/**
+ * @brief Register a callback to report temperature and humidity samples together.
+ *
+ * SHT31 reads out temperature and humidity in one measurement. Once this callback is registered, the samples of every
+ * measurement are reported through it, instead of through the new sample callbacks of the temperature and humidity
+ * sensors. Only the samples of the started sensors are included.
+ *
+ * @param cb Callback to register.
+ * @param user_data User data to pass to the callback when invoked.
+ */
+void virtual_sht31_register_new_multi_sample_cb(MultiSampleNewSampleCb cb, void *user_data);
+
 #ifdef __cplusplus
 }
 #endif
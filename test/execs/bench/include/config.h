@@ -0,0 +1,128 @@
+#ifndef ENV_ALERT_SYSTEM_TEST_EXECS_BENCH_INCLUDE_CONFIG_H
+#define ENV_ALERT_SYSTEM_TEST_EXECS_BENCH_INCLUDE_CONFIG_H
+
+/* Configuration used by the benchmark executable instead of the unit test port configuration. Unit test configs are
+ * sized for what the unit tests need, while the benchmark needs to register many more alerts than an actual port. */
+
+/** Set from CMake through the EAS_BENCH_MAX_NUM_ALERTS cache variable. */
+#ifndef EAS_BENCH_MAX_NUM_ALERTS
+#define EAS_BENCH_MAX_NUM_ALERTS 256
+#endif
+
+#define CONFIG_MAX_NUM_ALERTS EAS_BENCH_MAX_NUM_ALERTS
+
+/* One for each variable */
+#define CONFIG_VALUE_HOLDER_MAX_NUM_INSTANCES 4
+#define CONFIG_TEMPERATURE_VALUE_MAX_NUM_INSTANCES 1
+#define CONFIG_PRESSURE_VALUE_MAX_NUM_INSTANCES 1
+#define CONFIG_HUMIDITY_VALUE_MAX_NUM_INSTANCES 1
+#define CONFIG_LIGHT_INTENSITY_VALUE_MAX_NUM_INSTANCES 1
+/* Linked lists are not used by the application */
+#define CONFIG_LINKED_LIST_MAX_NUM_INSTANCES 1
+/* One for each variable */
+#define CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_INSTANCES 4
+#define CONFIG_ALERT_CONDITION_MAX_NUM_INSTANCES CONFIG_MAX_NUM_ALERTS
+#define CONFIG_ALERT_RAISER_MAX_NUM_INSTANCES CONFIG_MAX_NUM_ALERTS
+/* Each alert raiser creates two timer wheel timers - warmup timer and cooldown timer. */
+#define CONFIG_TIMER_WHEEL_MAX_NUM_TIMERS (CONFIG_ALERT_RAISER_MAX_NUM_INSTANCES * 2)
+/* One for the timer wheel */
+#define CONFIG_EAS_TIMER_MAX_NUM_INSTANCES 1
+#define CONFIG_OPS_QUEUE_MAX_NUM_INSTANCES 1
+/* Used by sample history */
+#define CONFIG_EAS_RING_BUF_MAX_NUM_INSTANCES 1
+
+/** Used by the fake variable requirement allocator to determine the size of the buffer for one variable requirement.
+ * Same as in the unit test port, since the benchmark also runs on the development machine. */
+#define CONFIG_VARIABLE_REQUIREMENT_MAX_SIZE 24
+
+#define CONFIG_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION 10
+
+#define CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS CONFIG_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION
+
+#define CONFIG_MSG_TRANSCEIVER_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION                                        \
+    CONFIG_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION
+
+#define CONFIG_MAX_ALERT_CONDITION_EXPRESSION_DEPTH 4
+
+#define CONFIG_ALERT_CONDITION_MAX_EXPRESSION_DEPTH CONFIG_MAX_ALERT_CONDITION_EXPRESSION_DEPTH
+
+#define CONFIG_MSG_TRANSCEIVER_MAX_EXPRESSION_DEPTH CONFIG_MAX_ALERT_CONDITION_EXPRESSION_DEPTH
+
+#define CONFIG_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS                                                                     \
+    (CONFIG_MAX_NUM_ALERTS * CONFIG_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION)
+
+/* Two band requirements per alert on average. Every variable requirement list reserves an entry for each of them. */
+#define CONFIG_MAX_TOTAL_NUM_BAND_REQUIREMENTS (2 * CONFIG_MAX_NUM_ALERTS)
+
+#define CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS CONFIG_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS
+
+#define CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_BAND_REQUIREMENTS CONFIG_MAX_TOTAL_NUM_BAND_REQUIREMENTS
+
+/* This config has no effect on the behavior of the benchmark. The benchmark uses the fake variable requirement
+ * allocator, which uses its own config, CONFIG_FAKE_VARIABLE_REQUIREMENT_ALLOCATOR_NUM_REQUIREMENTS. */
+#define CONFIG_VARIABLE_REQUIREMENT_ALLOCATOR_NUM_REQUIREMENTS 1
+
+#define CONFIG_VARIABLE_REQUIREMENT_LIST_MAX_NUM_REQUIREMENTS                                                          \
+    (CONFIG_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS + CONFIG_MAX_TOTAL_NUM_BAND_REQUIREMENTS)
+
+#define CONFIG_ALERT_SLOTS_NUM_SLOTS CONFIG_MAX_NUM_ALERTS
+
+#define CONFIG_ALERT_CONDITIONS_NUM_INSTANCES_TO_CREATE CONFIG_MAX_NUM_ALERTS
+
+#define CONFIG_ALERT_RAISERS_NUM_INSTANCES_TO_CREATE CONFIG_MAX_NUM_ALERTS
+
+#define CONFIG_ALERT_VALIDATOR_MAX_ALLOWED_ALERT_ID UINT16_MAX
+
+#define CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS CONFIG_ALERT_SLOTS_NUM_SLOTS
+
+#define CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS CONFIG_ALERT_SLOTS_NUM_SLOTS
+
+#define CONFIG_LED_MANAGER_NOTIFICATION_DURATION_SECONDS 5
+
+#define CONFIG_LED_MANAGER_IGNORE_TIMER_MARGIN_MS 10
+
+#define CONFIG_MSG_TRANSCEIVER_NUM_RESERVED_MESSAGE_SLOTS (CONFIG_MAX_NUM_ALERTS * 2)
+
+#define CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS (CONFIG_MSG_TRANSCEIVER_NUM_RESERVED_MESSAGE_SLOTS + 2)
+
+#define CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERT_STATUS_CHANGES_IN_MESSAGE 6
+
+#define CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERTS_IN_REPLACE_ALL_ALERTS_MESSAGE CONFIG_MAX_NUM_ALERTS
+
+/** It is defined here, but not actually used since central event queue is not used in the benchmark. */
+#define CONFIG_CENTRAL_EVENT_QUEUE_NUM_SLOTS 1
+
+#define CONFIG_CENTRAL_EVENT_QUEUE_COALESCE_SAMPLES 0
+
+/* This config has no effect on the behavior of the benchmark. Linked lists are not used by the application. */
+#define CONFIG_LINKED_LIST_NODE_ALLOCATOR_NUM_NODES 1
+
+#define CONFIG_TIMER_WHEEL_TICK_MS 100
+
+#define CONFIG_TIMER_WHEEL_NUM_SLOTS 64
+
+/* Same as on target, so that the benchmark includes the cost of recording samples */
+#define CONFIG_SAMPLE_HISTORY_BLOCK_SIZE 128
+#define CONFIG_SAMPLE_HISTORY_NUM_BLOCKS 32
+#define CONFIG_SAMPLE_HISTORY_MIN_INTERVAL_MS 60000
+#define CONFIG_SAMPLE_HISTORY_TEMPERATURE_MIN_CHANGE 5
+#define CONFIG_SAMPLE_HISTORY_PRESSURE_MIN_CHANGE 5
+#define CONFIG_SAMPLE_HISTORY_HUMIDITY_MIN_CHANGE 20
+#define CONFIG_SAMPLE_HISTORY_LIGHT_INTENSITY_MIN_CHANGE 100
+
+/* Configs for test-specific modules */
+
+/** Only the fake variable requirement allocator creates a memory block allocator instance. */
+#define CONFIG_MEMORY_BLOCK_ALLOCATOR_MAX_NUM_INSTANCES 1
+
+/** Not used by the benchmark, defined so that the fake linked list node allocator compiles. */
+#define CONFIG_FAKE_LINKED_LIST_NODE_ALLOCATOR_NUM_NODES 1
+
+/** Every registered alert can have the maximum number of variable requirements. */
+#define CONFIG_FAKE_VARIABLE_REQUIREMENT_ALLOCATOR_NUM_REQUIREMENTS CONFIG_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS
+
+/* This is the number of instances of the external ring_buffer dependency. Each eas_ring_buf instance uses an external
+ * ring_buffer instance. */
+#define CONFIG_RING_BUFFER_MAX_NUM_INSTANCES CONFIG_EAS_RING_BUF_MAX_NUM_INSTANCES
+
+#endif /* ENV_ALERT_SYSTEM_TEST_EXECS_BENCH_INCLUDE_CONFIG_H */
@@ -0,0 +1,338 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "config.h"
+#include "msg_transceiver.h"
+#include "alert_adder.h"
+#include "alert_conditions.h"
+#include "alert_slots.h"
+#include "alert_raisers.h"
+#include "alert_raiser.h"
+#include "new_sample_handler.h"
+#include "fake_eas_current_time.h"
+#include "stub_connectivity_notification_sender.h"
+
+/* Host benchmark of the sample handling path.
+ *
+ * Registers a configurable number of alerts with randomly generated alert conditions and drives a stream of synthetic
+ * samples through new_sample_handler_temperature/pressure/humidity/light_intensity. Every sample value is a random
+ * walk step from the previous value of that variable, so that alert conditions are satisfied and unsatisfied over time
+ * the way they would be with real sensor readings. Alternatively, every sample value is the middle of the range of its
+ * variable plus sensor jitter of a few units. Reports handler throughput and latency percentiles.
+ *
+ * Usage: app_bench [-a num_alerts] [-r num_requirements_per_alert] [-n num_samples] [-s seed] [-j jitter]
+ */
+
+#define BENCH_DEFAULT_NUM_ALERTS CONFIG_MAX_NUM_ALERTS
+#define BENCH_DEFAULT_NUM_REQUIREMENTS_PER_ALERT 4
+#define BENCH_DEFAULT_NUM_SAMPLES 2000000UL
+#define BENCH_DEFAULT_SEED 1
+
+/* Same as the constraint value limits in alert_validator.c, so that every generated alert is valid. Samples are
+ * generated in the same range, so that every requirement is satisfied for some sample values. */
+#define BENCH_MIN_TEMPERATURE -500
+#define BENCH_MAX_TEMPERATURE 700
+#define BENCH_MAX_PRESSURE 15000
+#define BENCH_MAX_HUMIDITY 1000
+#define BENCH_MAX_LIGHT_INTENSITY 130000
+
+/** Largest step of the random walk, as a fraction of the whole range of the variable. */
+#define BENCH_RANDOM_WALK_STEP_DIVISOR 50
+
+#define BENCH_NUM_VARIABLES 4
+
+typedef struct BenchVariable {
+    int64_t min;
+    int64_t max;
+    int64_t value;
+} BenchVariable;
+
+static uint64_t rng_state;
+
+/**
+ * @brief Generate a pseudo-random number using xorshift64.
+ *
+ * @return uint64_t Pseudo-random number.
+ */
+static uint64_t rng_next()
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+/**
+ * @brief Generate a pseudo-random number in the inclusive range [min, max].
+ */
+static int64_t rng_in_range(int64_t min, int64_t max)
+{
+    return min + (int64_t)(rng_next() % (uint64_t)(max - min + 1));
+}
+
+static uint64_t get_time_ns()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Generate a random variable requirement for a variable.
+ *
+ * @param variable_identifier One of the values from @ref MsgTransceiverVariableIdentifier.
+ * @param variable Range of values of that variable.
+ * @param requirement Generated requirement is written here.
+ */
+static void generate_variable_requirement(uint8_t variable_identifier, const BenchVariable *variable,
+                                          MsgTransceiverVariableRequirement *requirement)
+{
+    requirement->variable_identifier = variable_identifier;
+    requirement->operator = (rng_next() & 1) ? MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_GEQ
+                                             : MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_LEQ;
+    int64_t constraint_value = rng_in_range(variable->min, variable->max);
+    switch (variable_identifier) {
+    case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_TEMPERATURE:
+        requirement->constraint_value.temperature = (MsgTransceiverTemperature)constraint_value;
+        break;
+    case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_PRESSURE:
+        requirement->constraint_value.pressure = (MsgTransceiverPressure)constraint_value;
+        break;
+    case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_HUMIDITY:
+        requirement->constraint_value.humidity = (MsgTransceiverHumidity)constraint_value;
+        break;
+    default:
+        requirement->constraint_value.light_intensity = (MsgTransceiverLightIntensity)constraint_value;
+        break;
+    }
+}
+
+/**
+ * @brief Register alerts with random alert conditions.
+ *
+ * Every alert condition consists of ORed requirements of two variable requirements each, ANDed together. Alerts have
+ * zero warmup and cooldown periods, so that every alert condition result change is immediately reported to the
+ * connectivity notification sender.
+ *
+ * @return true All alerts were registered.
+ * @return false At least one alert was rejected by the alert adder.
+ */
+static bool add_alerts(size_t num_alerts, size_t num_requirements_per_alert, const BenchVariable *variables)
+{
+    for (size_t i = 0; i < num_alerts; i++) {
+        MsgTransceiverAlert alert;
+        memset(&alert, 0, sizeof(alert));
+        alert.alert_id = (uint16_t)i;
+        alert.warmup_period = 0;
+        alert.cooldown_period = 0;
+        alert.notification_type.connectivity = 1;
+        alert.alert_condition.num_variable_requirements = num_requirements_per_alert;
+        for (size_t j = 0; j < num_requirements_per_alert; j++) {
+            uint8_t variable_identifier = (uint8_t)(rng_next() % BENCH_NUM_VARIABLES);
+            MsgTransceiverVariableRequirement *requirement = &alert.alert_condition.variable_requirements[j];
+            generate_variable_requirement(variable_identifier, &variables[variable_identifier], requirement);
+            requirement->is_last_in_ored_requirement = ((j % 2) == 1) || (j == (num_requirements_per_alert - 1));
+        }
+
+        alert_adder_add_alert(&alert, NULL);
+        if (alert_slots_get_slot(alert.alert_id) == ALERT_SLOTS_NO_SLOT) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Pass the current value of a variable to the new sample handler of that variable.
+ */
+static void handle_sample(uint8_t variable_identifier, int64_t value)
+{
+    switch (variable_identifier) {
+    case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_TEMPERATURE:
+        new_sample_handler_temperature((Temperature)value);
+        break;
+    case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_PRESSURE:
+        new_sample_handler_pressure((Pressure)value);
+        break;
+    case MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_HUMIDITY:
+        new_sample_handler_humidity((Humidity)value);
+        break;
+    default:
+        new_sample_handler_light_intensity((LightIntensity)value);
+        break;
+    }
+}
+
+/**
+ * @brief Move a variable one random walk step away from its current value, staying within its range.
+ */
+static void random_walk_step(BenchVariable *variable)
+{
+    int64_t max_step = (variable->max - variable->min) / BENCH_RANDOM_WALK_STEP_DIVISOR;
+    int64_t value = variable->value + rng_in_range(-max_step, max_step);
+    if (value < variable->min) {
+        value = variable->min;
+    } else if (value > variable->max) {
+        value = variable->max;
+    }
+    variable->value = value;
+}
+
+/**
+ * @brief Get a sample value that differs from the value of a variable by random jitter.
+ *
+ * @param variable Variable. Its value does not change.
+ * @param jitter Largest difference between the sample value and the value of the variable.
+ */
+static int64_t get_jittered_value(const BenchVariable *variable, int64_t jitter)
+{
+    return variable->value + rng_in_range(-jitter, jitter);
+}
+
+static int compare_latencies(const void *a, const void *b)
+{
+    uint64_t latency_a = *(const uint64_t *)a;
+    uint64_t latency_b = *(const uint64_t *)b;
+    return (latency_a > latency_b) - (latency_a < latency_b);
+}
+
+/**
+ * @brief Get a percentile from a sorted array of latencies.
+ */
+static uint64_t get_percentile(const uint64_t *sorted_latencies, size_t num_latencies, unsigned percentile)
+{
+    size_t idx = (num_latencies * percentile) / 100;
+    if (idx >= num_latencies) {
+        idx = num_latencies - 1;
+    }
+    return sorted_latencies[idx];
+}
+
+static void print_usage(const char *program_name)
+{
+    fprintf(stderr,
+            "Usage: %s [-a num_alerts] [-r num_requirements_per_alert] [-n num_samples] [-s seed] [-j jitter]\n",
+            program_name);
+    fprintf(stderr, "  -a  Number of alerts to register, 1 to %u. Default: %u.\n", (unsigned)CONFIG_MAX_NUM_ALERTS,
+            (unsigned)BENCH_DEFAULT_NUM_ALERTS);
+    fprintf(stderr, "  -r  Number of variable requirements in every alert condition, 1 to %u. Default: %u.\n",
+            (unsigned)CONFIG_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION,
+            (unsigned)BENCH_DEFAULT_NUM_REQUIREMENTS_PER_ALERT);
+    fprintf(stderr, "  -n  Number of samples to handle. Default: %lu.\n", BENCH_DEFAULT_NUM_SAMPLES);
+    fprintf(stderr, "  -s  Seed of the random number generator, non-zero. Default: %u.\n", BENCH_DEFAULT_SEED);
+    fprintf(stderr, "  -j  Instead of a random walk, jitter every sample by up to this many units around the middle of "
+                    "the range. Default: 0, random walk.\n");
+}
+
+int main(int argc, char **argv)
+{
+    size_t num_alerts = BENCH_DEFAULT_NUM_ALERTS;
+    size_t num_requirements_per_alert = BENCH_DEFAULT_NUM_REQUIREMENTS_PER_ALERT;
+    size_t num_samples = BENCH_DEFAULT_NUM_SAMPLES;
+    uint64_t seed = BENCH_DEFAULT_SEED;
+    int64_t jitter = 0;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "a:r:n:s:j:")) != -1) {
+        switch (opt) {
+        case 'a':
+            num_alerts = strtoul(optarg, NULL, 10);
+            break;
+        case 'r':
+            num_requirements_per_alert = strtoul(optarg, NULL, 10);
+            break;
+        case 'n':
+            num_samples = strtoul(optarg, NULL, 10);
+            break;
+        case 's':
+            seed = strtoull(optarg, NULL, 10);
+            break;
+        case 'j':
+            jitter = strtoll(optarg, NULL, 10);
+            break;
+        default:
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    bool valid_num_alerts = (num_alerts >= 1) && (num_alerts <= CONFIG_MAX_NUM_ALERTS);
+    bool valid_num_requirements =
+        (num_requirements_per_alert >= 1) &&
+        (num_requirements_per_alert <= CONFIG_MAX_NUM_VARIABLE_REQUIREMENTS_IN_ALERT_CONDITION);
+    if (!valid_num_alerts || !valid_num_requirements || (num_samples == 0) || (seed == 0) || (jitter < 0)) {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    rng_state = seed;
+
+    uint64_t *latencies = malloc(num_samples * sizeof(uint64_t));
+    if (!latencies) {
+        fprintf(stderr, "Failed to allocate memory for %zu latencies\n", num_samples);
+        return EXIT_FAILURE;
+    }
+
+    /* Indexed by MsgTransceiverVariableIdentifier. Every variable starts in the middle of its range. */
+    BenchVariable variables[BENCH_NUM_VARIABLES] = {
+        {.min = BENCH_MIN_TEMPERATURE, .max = BENCH_MAX_TEMPERATURE},
+        {.min = 0, .max = BENCH_MAX_PRESSURE},
+        {.min = 0, .max = BENCH_MAX_HUMIDITY},
+        {.min = 0, .max = BENCH_MAX_LIGHT_INTENSITY},
+    };
+    for (size_t i = 0; i < BENCH_NUM_VARIABLES; i++) {
+        variables[i].value = variables[i].min + ((variables[i].max - variables[i].min) / 2);
+    }
+
+    alert_conditions_create_instances();
+    alert_raisers_create_instances();
+    if (!add_alerts(num_alerts, num_requirements_per_alert, variables)) {
+        fprintf(stderr, "Failed to add alerts\n");
+        free(latencies);
+        return EXIT_FAILURE;
+    }
+
+    /* Not measured: the first sample of each variable makes alert evaluation ready, which evaluates all requirements */
+    for (uint8_t i = 0; i < BENCH_NUM_VARIABLES; i++) {
+        handle_sample(i, variables[i].value);
+    }
+
+    uint64_t total_ns = 0;
+    for (size_t i = 0; i < num_samples; i++) {
+        uint8_t variable_identifier = (uint8_t)(i % BENCH_NUM_VARIABLES);
+        int64_t value;
+        if (jitter > 0) {
+            value = get_jittered_value(&variables[variable_identifier], jitter);
+        } else {
+            random_walk_step(&variables[variable_identifier]);
+            value = variables[variable_identifier].value;
+        }
+        /* One sample every millisecond */
+        fake_eas_current_time_set((EasTime)i);
+
+        uint64_t start_ns = get_time_ns();
+        handle_sample(variable_identifier, value);
+        latencies[i] = get_time_ns() - start_ns;
+        total_ns += latencies[i];
+    }
+
+    qsort(latencies, num_samples, sizeof(uint64_t), compare_latencies);
+
+    printf("alerts: %zu, requirements per alert: %zu, samples: %zu, seed: %llu\n", num_alerts,
+           num_requirements_per_alert, num_samples, (unsigned long long)seed);
+    printf("alerts raised: %llu, alerts silenced: %llu\n",
+           (unsigned long long)stub_connectivity_notification_sender_get_num_raised(),
+           (unsigned long long)stub_connectivity_notification_sender_get_num_silenced());
+    printf("samples/sec: %.0f\n", (total_ns > 0) ? ((double)num_samples * 1e9 / (double)total_ns) : 0.0);
+    printf("latency ns: p50 %llu, p99 %llu, max %llu\n",
+           (unsigned long long)get_percentile(latencies, num_samples, 50),
+           (unsigned long long)get_percentile(latencies, num_samples, 99),
+           (unsigned long long)latencies[num_samples - 1]);
+
+    free(latencies);
+    return EXIT_SUCCESS;
+}
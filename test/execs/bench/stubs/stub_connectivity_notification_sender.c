@@ -0,0 +1,28 @@
+#include "stub_connectivity_notification_sender.h"
+
+static uint64_t num_raised = 0;
+static uint64_t num_silenced = 0;
+
+void connectivity_notification_sender_send(uint16_t alert_id, bool is_raised)
+{
+    if (is_raised) {
+        num_raised++;
+    } else {
+        num_silenced++;
+    }
+}
+
+void connectivity_notification_sender_flush()
+{
+    /* Notifications are counted when they are requested, there is nothing to send */
+}
+
+uint64_t stub_connectivity_notification_sender_get_num_raised()
+{
+    return num_raised;
+}
+
+uint64_t stub_connectivity_notification_sender_get_num_silenced()
+{
+    return num_silenced;
+}
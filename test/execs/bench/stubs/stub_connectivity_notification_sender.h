@@ -0,0 +1,41 @@
+#ifndef ENV_ALERT_SYSTEM_TEST_EXECS_BENCH_STUBS_STUB_CONNECTIVITY_NOTIFICATION_SENDER_H
+#define ENV_ALERT_SYSTEM_TEST_EXECS_BENCH_STUBS_STUB_CONNECTIVITY_NOTIFICATION_SENDER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Stub connectivity notification sender that counts alert status changes instead of sending them.
+ *
+ * This is the last module in the chain that starts in new sample handler, so every alert status change that the
+ * application would transmit is counted here.
+ */
+
+void connectivity_notification_sender_send(uint16_t alert_id, bool is_raised);
+
+void connectivity_notification_sender_flush();
+
+/**
+ * @brief Get the number of "alert raised" notifications sent so far.
+ *
+ * @return uint64_t Number of notifications.
+ */
+uint64_t stub_connectivity_notification_sender_get_num_raised();
+
+/**
+ * @brief Get the number of "alert silenced" notifications sent so far.
+ *
+ * @return uint64_t Number of notifications.
+ */
+uint64_t stub_connectivity_notification_sender_get_num_silenced();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_TEST_EXECS_BENCH_STUBS_STUB_CONNECTIVITY_NOTIFICATION_SENDER_H */
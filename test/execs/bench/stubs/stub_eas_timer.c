@@ -0,0 +1,45 @@
+#include <stddef.h>
+
+#include "eas_timer.h"
+#include "config.h"
+#include "eas_assert.h"
+
+/**
+ * @brief Timer instance that never expires.
+ *
+ * The benchmark registers alerts with zero warmup and cooldown periods, so alert raisers never start their timers and
+ * the timer wheel tick timer is never started either. Timers only need to be distinct, valid instances.
+ */
+struct EasTimerStruct {
+    uint32_t period_ms;
+};
+
+static struct EasTimerStruct instances[CONFIG_EAS_TIMER_MAX_NUM_INSTANCES];
+static size_t instance_idx = 0;
+
+void eas_timer_set_execute_timer_expiry_function_cb(EasTimerExecuteTimerExpiryFunctionCb cb)
+{
+}
+
+EasTimer eas_timer_create(uint32_t period_ms, bool periodic, EasTimerCb cb, void *user_data)
+{
+    EAS_ASSERT(instance_idx < CONFIG_EAS_TIMER_MAX_NUM_INSTANCES);
+    struct EasTimerStruct *instance = &instances[instance_idx];
+    instance_idx++;
+
+    instance->period_ms = period_ms;
+    return instance;
+}
+
+void eas_timer_set_period(EasTimer self, uint32_t period_ms)
+{
+    self->period_ms = period_ms;
+}
+
+void eas_timer_start(EasTimer self)
+{
+}
+
+void eas_timer_stop(EasTimer self)
+{
+}
@@ -0,0 +1,39 @@
+#include <stddef.h>
+
+#include "hw_platform.h"
+
+/**
+ * @brief Sensors that only accept readout periods.
+ *
+ * The benchmark feeds samples to the new sample handlers directly, and the new sample handlers schedule the next
+ * sensor readout after every sample. The sensors are never started, so setting a readout period has no effect.
+ */
+
+static void set_readout_period(uint32_t period_ms)
+{
+}
+
+static const TemperatureSensor temperature_sensor = {.set_readout_period = set_readout_period};
+static const PressureSensor pressure_sensor = {.set_readout_period = set_readout_period};
+static const HumiditySensor humidity_sensor = {.set_readout_period = set_readout_period};
+static const LightIntensitySensor light_intensity_sensor = {.set_readout_period = set_readout_period};
+
+const TemperatureSensor *const hw_platform_get_temperature_sensor()
+{
+    return &temperature_sensor;
+}
+
+const PressureSensor *const hw_platform_get_pressure_sensor()
+{
+    return &pressure_sensor;
+}
+
+const HumiditySensor *const hw_platform_get_humidity_sensor()
+{
+    return &humidity_sensor;
+}
+
+const LightIntensitySensor *const hw_platform_get_light_intensity_sensor()
+{
+    return &light_intensity_sensor;
+}
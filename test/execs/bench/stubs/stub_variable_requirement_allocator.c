@@ -0,0 +1,15 @@
+#include "variable_requirement_allocator.h"
+#include "fake_variable_requirement_allocator.h"
+
+/* The benchmark allocates real variable requirements without expecting mock calls, so the allocator interface is
+ * forwarded to the fake allocator. */
+
+void *variable_requirement_allocator_alloc()
+{
+    return fake_variable_requirement_allocator_alloc();
+}
+
+void variable_requirement_allocator_free(void *buf)
+{
+    fake_variable_requirement_allocator_free(buf);
+}
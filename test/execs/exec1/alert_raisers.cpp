@@ -4,6 +4,7 @@
 #include "CppUTestExt/MockSupport.h"
 
 #include "alert_raisers.h"
+#include "alert_slots.h"
 #include "config.h"
 #include "eas_assert.h"
 
@@ -23,14 +24,26 @@ static void initialize_expected_instances()
     }
 }
 
-TEST_GROUP(AlertRaisers){};
+// clang-format off
+TEST_GROUP(AlertRaisers)
+{
+    void setup()
+    {
+        /* Slots are assigned in ascending order, so alert id i gets slot i */
+        alert_slots_reset();
+        for (size_t i = 0; i < CONFIG_ALERT_RAISERS_NUM_INSTANCES_TO_CREATE; i++) {
+            alert_slots_add(i);
+        }
+    }
+};
+// clang-format on
 
 /* Ordered test group 0. These tests are executed before ordered test group 1, because we want to test the state before
  * alert_raisers_create_instances is called, which happens in a group 1 test. */
 
 TEST_ORDERED(AlertRaisers, GetAssertsIfCalledBeforeCreateInstancesId0, 0)
 {
-    uint8_t alert_id = 0;
+    uint16_t alert_id = 0;
     EAS_ASSERT(alert_id < CONFIG_ALERT_RAISERS_NUM_INSTANCES_TO_CREATE);
     TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("alert_raiser", "alert_raisers_get_alert_raiser");
 
@@ -39,7 +52,7 @@ TEST_ORDERED(AlertRaisers, GetAssertsIfCalledBeforeCreateInstancesId0, 0)
 
 TEST_ORDERED(AlertRaisers, GetAssertsIfCalledBeforeCreateInstancesId2, 0)
 {
-    uint8_t alert_id = 2;
+    uint16_t alert_id = 2;
     EAS_ASSERT(alert_id < CONFIG_ALERT_RAISERS_NUM_INSTANCES_TO_CREATE);
     TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("alert_raiser", "alert_raisers_get_alert_raiser");
 
@@ -75,12 +88,27 @@ TEST_ORDERED(AlertRaisers, GetReturnsCreatedInstances, 1)
 
 TEST_ORDERED(AlertRaisers, GetAssertsInvalidAlertId, 2)
 {
-    uint8_t invalid_alert_id = CONFIG_ALERT_RAISERS_NUM_INSTANCES_TO_CREATE;
+    uint16_t invalid_alert_id = CONFIG_ALERT_RAISERS_NUM_INSTANCES_TO_CREATE;
     TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_alert_id", "alert_raisers_get_alert_raiser");
 
     AlertRaiser alert_raiser = alert_raisers_get_alert_raiser(invalid_alert_id);
 }
 
+TEST_ORDERED(AlertRaisers, GetInSlotReturnsCreatedInstances, 2)
+{
+    for (size_t i = 0; i < CONFIG_ALERT_RAISERS_NUM_INSTANCES_TO_CREATE; i++) {
+        CHECK_EQUAL(map_expected_instance_index_to_instance(i), alert_raisers_get_alert_raiser_in_slot(i));
+    }
+}
+
+TEST_ORDERED(AlertRaisers, GetInSlotAssertsInvalidSlot, 2)
+{
+    size_t invalid_slot = CONFIG_ALERT_RAISERS_NUM_INSTANCES_TO_CREATE;
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_slot", "alert_raisers_get_alert_raiser_in_slot");
+
+    AlertRaiser alert_raiser = alert_raisers_get_alert_raiser_in_slot(invalid_slot);
+}
+
 /* alert_raisers_create_instances is already called as a part of ordered test group 1, so we only need to call it
  * once in this test to trigger an assert. */
 TEST_ORDERED(AlertRaisers, CreateInstancesAssertsIfCalledAgain, 2)
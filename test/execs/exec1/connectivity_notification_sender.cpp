@@ -0,0 +1,143 @@
+#include "CppUTest/TestHarness.h"
+#include "CppUTestExt/MockSupport.h"
+
+#include "connectivity_notification_sender.h"
+#include "mocks/mock_msg_transceiver.h"
+#include "config.h"
+#include "eas_assert.h"
+
+static void expect_alert_status_change_message(uint16_t alert_id, bool is_raised)
+{
+    mock()
+        .expectOneCall("msg_transceiver_send_alert_status_change_message")
+        .withParameter("alert_id", alert_id)
+        .withParameter("is_raised", is_raised)
+        .ignoreOtherParameters();
+}
+
+static void expect_alert_status_changes_message(const MsgTransceiverAlertStatusChange *const changes,
+                                                size_t num_changes)
+{
+    mock()
+        .expectOneCall("msg_transceiver_send_alert_status_changes_message")
+        .withMemoryBufferParameter("changes", (const unsigned char *)changes,
+                                   num_changes * sizeof(MsgTransceiverAlertStatusChange))
+        .withParameter("num_changes", num_changes)
+        .ignoreOtherParameters();
+}
+
+/* Every test flushes all notifications it sends, so that no pending notifications are left for the next test */
+TEST_GROUP(ConnectivityNotificationSender)
+{
+    void setup()
+    {
+        mock().strictOrder();
+    }
+};
+
+TEST(ConnectivityNotificationSender, NotificationNotSentUntilFlush)
+{
+    connectivity_notification_sender_send(4, true);
+    /* Nothing should have been sent yet */
+    mock().checkExpectations();
+
+    expect_alert_status_change_message(4, true);
+    connectivity_notification_sender_flush();
+}
+
+TEST(ConnectivityNotificationSender, FlushOneNotificationSendsAlertStatusChangeMessage)
+{
+    expect_alert_status_change_message(2, false);
+
+    connectivity_notification_sender_send(2, false);
+    connectivity_notification_sender_flush();
+}
+
+TEST(ConnectivityNotificationSender, FlushSeveralNotificationsSendsAlertStatusChangesMessage)
+{
+    MsgTransceiverAlertStatusChange expected_changes[] = {
+        {.alert_id = 5, .is_raised = true},
+        {.alert_id = 1, .is_raised = false},
+    };
+    expect_alert_status_changes_message(expected_changes, 2);
+
+    connectivity_notification_sender_send(5, true);
+    connectivity_notification_sender_send(1, false);
+    connectivity_notification_sender_flush();
+}
+
+TEST(ConnectivityNotificationSender, SameAlertTwiceIsSentTwice)
+{
+    MsgTransceiverAlertStatusChange expected_changes[] = {
+        {.alert_id = 3, .is_raised = true},
+        {.alert_id = 3, .is_raised = false},
+    };
+    expect_alert_status_changes_message(expected_changes, 2);
+
+    connectivity_notification_sender_send(3, true);
+    connectivity_notification_sender_send(3, false);
+    connectivity_notification_sender_flush();
+}
+
+TEST(ConnectivityNotificationSender, FlushWithoutNotificationsSendsNothing)
+{
+    connectivity_notification_sender_flush();
+}
+
+TEST(ConnectivityNotificationSender, FlushClearsSentNotifications)
+{
+    expect_alert_status_change_message(0, true);
+    expect_alert_status_change_message(1, true);
+
+    connectivity_notification_sender_send(0, true);
+    connectivity_notification_sender_flush();
+    /* Notification for alert 0 was already sent, so it should not be sent again */
+    connectivity_notification_sender_flush();
+    connectivity_notification_sender_send(1, true);
+    connectivity_notification_sender_flush();
+}
+
+TEST(ConnectivityNotificationSender, MaxNumNotificationsSentInOneMessage)
+{
+    EAS_ASSERT(CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERT_STATUS_CHANGES_IN_MESSAGE == 3);
+    MsgTransceiverAlertStatusChange expected_changes[] = {
+        {.alert_id = 0, .is_raised = true},
+        {.alert_id = 1, .is_raised = true},
+        {.alert_id = 2, .is_raised = false},
+    };
+
+    connectivity_notification_sender_send(0, true);
+    connectivity_notification_sender_send(1, true);
+    connectivity_notification_sender_send(2, false);
+    /* All notifications fit into one message, so nothing should have been sent yet */
+    mock().checkExpectations();
+
+    expect_alert_status_changes_message(expected_changes, 3);
+    connectivity_notification_sender_flush();
+}
+
+TEST(ConnectivityNotificationSender, NotificationsThatDoNotFitIntoOneMessageAreSplit)
+{
+    EAS_ASSERT(CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERT_STATUS_CHANGES_IN_MESSAGE == 3);
+    MsgTransceiverAlertStatusChange expected_changes_0[] = {
+        {.alert_id = 6, .is_raised = true},
+        {.alert_id = 7, .is_raised = false},
+        {.alert_id = 8, .is_raised = true},
+    };
+    MsgTransceiverAlertStatusChange expected_changes_1[] = {
+        {.alert_id = 9, .is_raised = false},
+        {.alert_id = 10, .is_raised = true},
+    };
+    /* Sent when the fourth notification does not fit into the message anymore */
+    expect_alert_status_changes_message(expected_changes_0, 3);
+
+    connectivity_notification_sender_send(6, true);
+    connectivity_notification_sender_send(7, false);
+    connectivity_notification_sender_send(8, true);
+    connectivity_notification_sender_send(9, false);
+    connectivity_notification_sender_send(10, true);
+    mock().checkExpectations();
+
+    expect_alert_status_changes_message(expected_changes_1, 2);
+    connectivity_notification_sender_flush();
+}
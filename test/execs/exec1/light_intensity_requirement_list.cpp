@@ -6,8 +6,9 @@
 TEST_GROUP(LightIntensityRequirementList){};
 
 /* Tests that variable_requirement_list_create() is called only once. Also tests that all wrapper functions - add,
- * for_each, remove_all_for_alert - use the instance returned by variable_requirement_list_create() and correctly
- * propagate function calls to its variable_requirement_list counterparts.
+ * for_each, evaluate, evaluate_in_range, remove_all_for_alert - use the instance returned by
+ * variable_requirement_list_create() and correctly propagate function calls to its variable_requirement_list
+ * counterparts.
  *
  * It is all in one test because the order of execution of different tests is not guaranteed, so we would have no way of
  * knowing which test would actually call variable_requirement_list_create(), since it only gets called when a
@@ -16,12 +17,16 @@ TEST(LightIntensityRequirementList, CreateIsCalledOnlyOnceAndWrappersPropagateCa
 {
     /* We are only verifying that light_intensity_requirement functions propagate the function arguments to
      * variable_requirement_list functions, so it is not necessary to create proper instances of VariableRequirement
-     * or VariableRequirementListForEachCb. */
+     * or the callbacks. */
     void *variable_requirement_list_instance_address = (void *)0x1234;
     VariableRequirement light_intensity_requirement = (VariableRequirement)0x5678;
     VariableRequirementListForEachCb for_each_cb = (VariableRequirementListForEachCb)0x9ABC;
+    VariableRequirementListResultChangedCb result_changed_cb = (VariableRequirementListResultChangedCb)0xDEF0;
 
-    uint8_t alert_id = 43;
+    LightIntensity previous_value = 4000000000;
+    LightIntensity value = 10;
+    VariableRequirementThreshold distance = 17;
+    uint16_t alert_id = 43;
 
     mock().expectOneCall("variable_requirement_list_create").andReturnValue(variable_requirement_list_instance_address);
     mock()
@@ -32,6 +37,22 @@ TEST(LightIntensityRequirementList, CreateIsCalledOnlyOnceAndWrappersPropagateCa
         .expectOneCall("variable_requirement_list_for_each")
         .withParameter("self", variable_requirement_list_instance_address)
         .withParameterOfType("VariableRequirementListForEachCb", "cb", (const void *)for_each_cb);
+    mock()
+        .expectOneCall("variable_requirement_list_evaluate")
+        .withParameter("self", variable_requirement_list_instance_address)
+        .withLongLongIntParameter("value", value)
+        .withParameterOfType("VariableRequirementListResultChangedCb", "cb", (const void *)result_changed_cb);
+    mock()
+        .expectOneCall("variable_requirement_list_evaluate_in_range")
+        .withParameter("self", variable_requirement_list_instance_address)
+        .withLongLongIntParameter("previous_value", previous_value)
+        .withLongLongIntParameter("value", value)
+        .withParameterOfType("VariableRequirementListResultChangedCb", "cb", (const void *)result_changed_cb);
+    mock()
+        .expectOneCall("variable_requirement_list_get_distance_to_nearest")
+        .withParameter("self", variable_requirement_list_instance_address)
+        .withLongLongIntParameter("value", value)
+        .andReturnValue((long long int)distance);
     mock()
         .expectOneCall("variable_requirement_list_remove_all_for_alert")
         .withParameter("self", variable_requirement_list_instance_address)
@@ -39,5 +60,8 @@ TEST(LightIntensityRequirementList, CreateIsCalledOnlyOnceAndWrappersPropagateCa
 
     light_intensity_requirement_list_add(light_intensity_requirement);
     light_intensity_requirement_list_for_each((VariableRequirementListForEachCb)for_each_cb);
+    light_intensity_requirement_list_evaluate(value, result_changed_cb);
+    light_intensity_requirement_list_evaluate_in_range(previous_value, value, result_changed_cb);
+    CHECK_EQUAL(distance, light_intensity_requirement_list_get_distance_to_nearest(value));
     light_intensity_requirement_list_remove_all_for_alert(alert_id);
 }
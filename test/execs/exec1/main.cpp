@@ -28,6 +28,8 @@ int main(int ac, char **av)
     /* Install comparator for VariableRequirementListForEachCb type */
     VariableRequirementListForEachCbComparator variableRequirementListForEachCbComparator;
     mockPlugin.installComparator("VariableRequirementListForEachCb", variableRequirementListForEachCbComparator);
+    /* VariableRequirementListResultChangedCb is a function pointer as well, so it can be compared the same way */
+    mockPlugin.installComparator("VariableRequirementListResultChangedCb", variableRequirementListForEachCbComparator);
 
     return CommandLineTestRunner::RunAllTests(ac, av);
 }
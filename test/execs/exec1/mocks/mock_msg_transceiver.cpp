@@ -0,0 +1,26 @@
+#include "CppUTestExt/MockSupport.h"
+#include "mock_msg_transceiver.h"
+
+void msg_transceiver_send_alert_status_change_message(uint16_t alert_id, bool is_raised, MsgTransceiverMessageSentCb cb,
+                                                      void *user_data)
+{
+    mock()
+        .actualCall("msg_transceiver_send_alert_status_change_message")
+        .withParameter("alert_id", alert_id)
+        .withParameter("is_raised", is_raised)
+        .withParameter("cb", cb)
+        .withParameter("user_data", user_data);
+}
+
+void msg_transceiver_send_alert_status_changes_message(const MsgTransceiverAlertStatusChange *const changes,
+                                                       size_t num_changes, MsgTransceiverMessageSentCb cb,
+                                                       void *user_data)
+{
+    mock()
+        .actualCall("msg_transceiver_send_alert_status_changes_message")
+        .withMemoryBufferParameter("changes", (const unsigned char *)changes,
+                                   num_changes * sizeof(MsgTransceiverAlertStatusChange))
+        .withParameter("num_changes", num_changes)
+        .withParameter("cb", cb)
+        .withParameter("user_data", user_data);
+}
@@ -0,0 +1,26 @@
+#ifndef ENV_ALERT_SYSTEM_TEST_EXECS_EXEC1_MOCKS_MOCK_MSG_TRANSCEIVER_H
+#define ENV_ALERT_SYSTEM_TEST_EXECS_EXEC1_MOCKS_MOCK_MSG_TRANSCEIVER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "msg_transceiver.h"
+
+void msg_transceiver_send_alert_status_change_message(uint16_t alert_id, bool is_raised, MsgTransceiverMessageSentCb cb,
+                                                      void *user_data);
+
+void msg_transceiver_send_alert_status_changes_message(const MsgTransceiverAlertStatusChange *const changes,
+                                                       size_t num_changes, MsgTransceiverMessageSentCb cb,
+                                                       void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_TEST_EXECS_EXEC1_MOCKS_MOCK_MSG_TRANSCEIVER_H */
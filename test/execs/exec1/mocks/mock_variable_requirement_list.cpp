@@ -25,7 +25,40 @@ void variable_requirement_list_for_each(VariableRequirementList self, VariableRe
         .withParameterOfType("VariableRequirementListForEachCb", "cb", (const void *)cb);
 }
 
-void variable_requirement_list_remove_all_for_alert(VariableRequirementList self, uint8_t alert_id)
+void variable_requirement_list_evaluate(VariableRequirementList self, VariableRequirementThreshold value,
+                                        VariableRequirementListResultChangedCb cb)
+{
+    mock()
+        .actualCall("variable_requirement_list_evaluate")
+        .withParameter("self", self)
+        .withLongLongIntParameter("value", value)
+        .withParameterOfType("VariableRequirementListResultChangedCb", "cb", (const void *)cb);
+}
+
+void variable_requirement_list_evaluate_in_range(VariableRequirementList self,
+                                                 VariableRequirementThreshold previous_value,
+                                                 VariableRequirementThreshold value,
+                                                 VariableRequirementListResultChangedCb cb)
+{
+    mock()
+        .actualCall("variable_requirement_list_evaluate_in_range")
+        .withParameter("self", self)
+        .withLongLongIntParameter("previous_value", previous_value)
+        .withLongLongIntParameter("value", value)
+        .withParameterOfType("VariableRequirementListResultChangedCb", "cb", (const void *)cb);
+}
+
+VariableRequirementThreshold variable_requirement_list_get_distance_to_nearest(VariableRequirementList self,
+                                                                               VariableRequirementThreshold value)
+{
+    mock()
+        .actualCall("variable_requirement_list_get_distance_to_nearest")
+        .withParameter("self", self)
+        .withLongLongIntParameter("value", value);
+    return mock().longLongIntReturnValue();
+}
+
+void variable_requirement_list_remove_all_for_alert(VariableRequirementList self, uint16_t alert_id)
 {
     mock()
         .actualCall("variable_requirement_list_remove_all_for_alert")
@@ -17,7 +17,15 @@ void variable_requirement_list_add(VariableRequirementList self, VariableRequire
 
 void variable_requirement_list_for_each(VariableRequirementList self, VariableRequirementListForEachCb cb);
 
-void variable_requirement_list_remove_all_for_alert(VariableRequirementList self, uint8_t alert_id);
+void variable_requirement_list_evaluate(VariableRequirementList self, VariableRequirementThreshold value,
+                                        VariableRequirementListResultChangedCb cb);
+
+void variable_requirement_list_evaluate_in_range(VariableRequirementList self,
+                                                 VariableRequirementThreshold previous_value,
+                                                 VariableRequirementThreshold value,
+                                                 VariableRequirementListResultChangedCb cb);
+
+void variable_requirement_list_remove_all_for_alert(VariableRequirementList self, uint16_t alert_id);
 
 #ifdef __cplusplus
 }
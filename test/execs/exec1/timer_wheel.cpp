@@ -0,0 +1,377 @@
+#include "CppUTest/TestHarness.h"
+#include "CppUTestExt/MockSupport.h"
+#include "CppUTestExt/OrderedTest.h"
+#include "CppUTestExt/TestAssertPlugin.h"
+
+#include "utils/timer_wheel.h"
+#include "config.h"
+#include "eas_timer_defs.h"
+#include "fake_eas_current_time.h"
+
+/* The implementation of eas_timer_create in EasTimer mock object populates these with the tick timer callback and its
+ * user data. This is needed in the test so that we can call the callback to simulate the tick timer expiring. */
+static EasTimerCb tick_timer_cb;
+static void *tick_timer_cb_user_data;
+
+static EasTimer tick_timer = (EasTimer)0x61;
+
+/* Passed as user data to timer wheel timers, so that the tests can tell which timer expired */
+static uint8_t timer_user_data_0;
+static uint8_t timer_user_data_1;
+static uint8_t timer_user_data_2;
+
+static EasTime current_time = 0;
+
+static void reset_current_time()
+{
+    current_time = 0;
+    fake_eas_current_time_set(current_time);
+}
+
+/**
+ * @brief Advance current time by @p offset_ms without executing the tick timer callback.
+ */
+static void advance_time(uint32_t offset_ms)
+{
+    current_time += offset_ms;
+    fake_eas_current_time_set(current_time);
+}
+
+/**
+ * @brief Advance current time by @p offset_ms, and then execute the tick timer callback.
+ *
+ * Simulates the tick timer expiring, either on time or late.
+ */
+static void advance_time_and_tick(uint32_t offset_ms)
+{
+    advance_time(offset_ms);
+    tick_timer_cb(tick_timer_cb_user_data);
+}
+
+/**
+ * @brief Expect the tick timer to be started so that it expires after @p period_ms.
+ */
+static void expect_tick_timer_start(uint32_t period_ms)
+{
+    mock().expectOneCall("eas_timer_stop").withParameter("self", tick_timer);
+    mock()
+        .expectOneCall("eas_timer_set_period")
+        .withParameter("self", tick_timer)
+        .withParameter("period_ms", period_ms);
+    mock().expectOneCall("eas_timer_start").withParameter("self", tick_timer);
+}
+
+static void timer_cb(void *user_data)
+{
+    mock().actualCall("timer_cb").withParameter("user_data", user_data);
+}
+
+/* Timer that is restarted from its own expiry callback */
+static TimerWheelTimer restarting_timer;
+
+static void restarting_timer_cb(void *user_data)
+{
+    mock().actualCall("timer_cb").withParameter("user_data", user_data);
+    timer_wheel_timer_start(restarting_timer);
+}
+
+// clang-format off
+TEST_GROUP(TimerWheel)
+{
+    void setup() {
+        /* Order of expected calls is important for these tests. Fail the test if the expected mock calls do not happen
+        in the specified order. */
+        mock().strictOrder();
+
+        /* Pass pointers so that the mock object populates them with tick timer callback and user data */
+        mock().setData("timerCbs", (void *)&tick_timer_cb);
+        mock().setData("timerCbsUserData", &tick_timer_cb_user_data);
+        mock().setData("numTimerCbs", (unsigned int)1);
+
+        /* Time starts from 0 at the beginning of each test. Each test can advance time however it needs. */
+        reset_current_time();
+    }
+};
+// clang-format on
+
+/* This is the first test - it expects a call to eas_timer_create when the first timer is started. The tick timer only
+ * needs to be created once, so subsequent tests will not expect a call to eas_timer_create. */
+TEST_ORDERED(TimerWheel, TimerExpiresAfterPeriod, 0)
+{
+    mock()
+        .expectOneCall("eas_timer_create")
+        .withParameter("period_ms", CONFIG_TIMER_WHEEL_TICK_MS)
+        .withParameter("periodic", false)
+        .ignoreOtherParameters()
+        .andReturnValue(tick_timer);
+    expect_tick_timer_start(300);
+
+    TimerWheelTimer timer = timer_wheel_timer_create(300, timer_cb, &timer_user_data_0);
+    timer_wheel_timer_start(timer);
+    advance_time(200);
+    mock().checkExpectations();
+
+    /* No more timers running, so the tick timer is not started again */
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_0);
+    advance_time_and_tick(100);
+}
+
+TEST_ORDERED(TimerWheel, PeriodNotMultipleOfTickIsRoundedUp, 1)
+{
+    expect_tick_timer_start(300);
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_0);
+
+    TimerWheelTimer timer = timer_wheel_timer_create(250, timer_cb, &timer_user_data_0);
+    timer_wheel_timer_start(timer);
+    advance_time_and_tick(300);
+}
+
+TEST_ORDERED(TimerWheel, PeriodShorterThanTickExpiresOnFirstTick, 1)
+{
+    expect_tick_timer_start(CONFIG_TIMER_WHEEL_TICK_MS);
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_0);
+
+    TimerWheelTimer timer = timer_wheel_timer_create(1, timer_cb, &timer_user_data_0);
+    timer_wheel_timer_start(timer);
+    advance_time_and_tick(CONFIG_TIMER_WHEEL_TICK_MS);
+}
+
+TEST_ORDERED(TimerWheel, TimerLongerThanOneRevolutionExpiresOnSingleTick, 1)
+{
+    /* More than two full revolutions of the wheel. The tick timer does not expire on the ticks in between. */
+    uint32_t period_ms = (CONFIG_TIMER_WHEEL_NUM_SLOTS * CONFIG_TIMER_WHEEL_TICK_MS * 2) + 300;
+    expect_tick_timer_start(period_ms);
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_0);
+
+    TimerWheelTimer timer = timer_wheel_timer_create(period_ms, timer_cb, &timer_user_data_0);
+    timer_wheel_timer_start(timer);
+    advance_time_and_tick(period_ms);
+}
+
+TEST_ORDERED(TimerWheel, SetPeriodTakesEffectOnStart, 1)
+{
+    expect_tick_timer_start(500);
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_0);
+
+    TimerWheelTimer timer = timer_wheel_timer_create(0, timer_cb, &timer_user_data_0);
+    timer_wheel_timer_set_period(timer, 500);
+    timer_wheel_timer_start(timer);
+    advance_time_and_tick(500);
+}
+
+TEST_ORDERED(TimerWheel, StoppedTimerDoesNotExpire, 1)
+{
+    expect_tick_timer_start(300);
+    mock().expectOneCall("eas_timer_stop").withParameter("self", tick_timer);
+
+    TimerWheelTimer timer = timer_wheel_timer_create(300, timer_cb, &timer_user_data_0);
+    timer_wheel_timer_start(timer);
+    advance_time(200);
+    timer_wheel_timer_stop(timer);
+    /* Tick timer callback can still get executed after the tick timer is stopped. It should have no effect. */
+    advance_time_and_tick(100);
+}
+
+TEST_ORDERED(TimerWheel, StopTimerThatIsNotRunningHasNoEffect, 1)
+{
+    TimerWheelTimer timer = timer_wheel_timer_create(300, timer_cb, &timer_user_data_0);
+    timer_wheel_timer_stop(timer);
+}
+
+TEST_ORDERED(TimerWheel, RestartPostponesExpiry, 1)
+{
+    expect_tick_timer_start(300);
+    /* The restarted timer is the only running timer, so ticks are counted from the restart */
+    expect_tick_timer_start(300);
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_0);
+
+    TimerWheelTimer timer = timer_wheel_timer_create(300, timer_cb, &timer_user_data_0);
+    timer_wheel_timer_start(timer);
+    advance_time(200);
+    timer_wheel_timer_start(timer);
+    advance_time_and_tick(300);
+}
+
+TEST_ORDERED(TimerWheel, RestartToLaterDeadlineDoesNotRestartTickTimer, 1)
+{
+    expect_tick_timer_start(1000);
+    /* timer_1 expires before the scheduled tick */
+    expect_tick_timer_start(300);
+
+    TimerWheelTimer timer_0 = timer_wheel_timer_create(1000, timer_cb, &timer_user_data_0);
+    TimerWheelTimer timer_1 = timer_wheel_timer_create(300, timer_cb, &timer_user_data_1);
+    timer_wheel_timer_start(timer_0);
+    timer_wheel_timer_start(timer_1);
+    advance_time(200);
+    timer_wheel_timer_start(timer_1);
+    mock().checkExpectations();
+
+    /* timer_1 was restarted at 200 ms, so it expires at 500 ms. The tick at 300 ms expires nothing, and only schedules
+     * the next tick. */
+    expect_tick_timer_start(200);
+    advance_time_and_tick(100);
+    mock().checkExpectations();
+
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_1);
+    expect_tick_timer_start(500);
+    advance_time_and_tick(200);
+    mock().checkExpectations();
+
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_0);
+    advance_time_and_tick(500);
+}
+
+TEST_ORDERED(TimerWheel, TimersExpireInOrderOfDeadlines, 1)
+{
+    expect_tick_timer_start(1200);
+    expect_tick_timer_start(200);
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_1);
+    expect_tick_timer_start(100);
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_2);
+    /* timer_0 expires after the next revolution */
+    expect_tick_timer_start(900);
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_0);
+
+    TimerWheelTimer timer_0 = timer_wheel_timer_create(1200, timer_cb, &timer_user_data_0);
+    TimerWheelTimer timer_1 = timer_wheel_timer_create(200, timer_cb, &timer_user_data_1);
+    TimerWheelTimer timer_2 = timer_wheel_timer_create(300, timer_cb, &timer_user_data_2);
+    timer_wheel_timer_start(timer_0);
+    timer_wheel_timer_start(timer_1);
+    timer_wheel_timer_start(timer_2);
+    advance_time_and_tick(200);
+    advance_time_and_tick(100);
+    advance_time_and_tick(900);
+}
+
+TEST_ORDERED(TimerWheel, TimersWithSameDeadlineExpireOnSameTick, 1)
+{
+    /* The second timer does not expire before the scheduled tick, so the tick timer is only started once */
+    expect_tick_timer_start(300);
+    /* Both timers are in the same slot. The most recently started timer is found first. */
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_1);
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_0);
+
+    TimerWheelTimer timer_0 = timer_wheel_timer_create(300, timer_cb, &timer_user_data_0);
+    TimerWheelTimer timer_1 = timer_wheel_timer_create(300, timer_cb, &timer_user_data_1);
+    timer_wheel_timer_start(timer_0);
+    timer_wheel_timer_start(timer_1);
+    advance_time_and_tick(300);
+}
+
+TEST_ORDERED(TimerWheel, TickTimerStoppedOnlyWhenLastTimerStopped, 1)
+{
+    expect_tick_timer_start(300);
+    mock().expectOneCall("eas_timer_stop").withParameter("self", tick_timer);
+
+    TimerWheelTimer timer_0 = timer_wheel_timer_create(300, timer_cb, &timer_user_data_0);
+    TimerWheelTimer timer_1 = timer_wheel_timer_create(300, timer_cb, &timer_user_data_1);
+    timer_wheel_timer_start(timer_0);
+    timer_wheel_timer_start(timer_1);
+    timer_wheel_timer_stop(timer_0);
+    timer_wheel_timer_stop(timer_1);
+}
+
+TEST_ORDERED(TimerWheel, LateTickExpiresAllOverdueTimers, 1)
+{
+    expect_tick_timer_start(200);
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_0);
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_1);
+
+    TimerWheelTimer timer_0 = timer_wheel_timer_create(200, timer_cb, &timer_user_data_0);
+    TimerWheelTimer timer_1 = timer_wheel_timer_create(400, timer_cb, &timer_user_data_1);
+    timer_wheel_timer_start(timer_0);
+    timer_wheel_timer_start(timer_1);
+    /* The tick timer callback is executed 300 ms late */
+    advance_time_and_tick(500);
+}
+
+TEST_ORDERED(TimerWheel, LateTickMoreThanOneRevolutionExpiresAllOverdueTimers, 1)
+{
+    expect_tick_timer_start(300);
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_0);
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_1);
+    /* timer_2 is not overdue yet, and keeps running */
+    uint32_t late_tick_ms = (CONFIG_TIMER_WHEEL_NUM_SLOTS * CONFIG_TIMER_WHEEL_TICK_MS) + 200;
+    expect_tick_timer_start(5000 - late_tick_ms);
+
+    TimerWheelTimer timer_0 = timer_wheel_timer_create(300, timer_cb, &timer_user_data_0);
+    TimerWheelTimer timer_1 = timer_wheel_timer_create(700, timer_cb, &timer_user_data_1);
+    TimerWheelTimer timer_2 = timer_wheel_timer_create(5000, timer_cb, &timer_user_data_2);
+    timer_wheel_timer_start(timer_0);
+    timer_wheel_timer_start(timer_1);
+    timer_wheel_timer_start(timer_2);
+    advance_time_and_tick(late_tick_ms);
+    mock().checkExpectations();
+
+    mock().expectOneCall("eas_timer_stop").withParameter("self", tick_timer);
+    timer_wheel_timer_stop(timer_2);
+}
+
+TEST_ORDERED(TimerWheel, LateTickSchedulesNextTickOnTime, 1)
+{
+    expect_tick_timer_start(200);
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_0);
+    /* The tick for timer_1 is still at 400 ms */
+    expect_tick_timer_start(150);
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_1);
+
+    TimerWheelTimer timer_0 = timer_wheel_timer_create(200, timer_cb, &timer_user_data_0);
+    TimerWheelTimer timer_1 = timer_wheel_timer_create(400, timer_cb, &timer_user_data_1);
+    timer_wheel_timer_start(timer_0);
+    timer_wheel_timer_start(timer_1);
+    advance_time_and_tick(250);
+    advance_time_and_tick(150);
+}
+
+TEST_ORDERED(TimerWheel, TimerCanBeRestartedFromItsCallback, 1)
+{
+    expect_tick_timer_start(300);
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_0);
+    /* The tick for the restarted timer is scheduled after the callback returns */
+    expect_tick_timer_start(300);
+    mock().expectOneCall("timer_cb").withParameter("user_data", &timer_user_data_0);
+    expect_tick_timer_start(300);
+    mock().expectOneCall("eas_timer_stop").withParameter("self", tick_timer);
+
+    restarting_timer = timer_wheel_timer_create(300, restarting_timer_cb, &timer_user_data_0);
+    timer_wheel_timer_start(restarting_timer);
+    advance_time_and_tick(300);
+    advance_time_and_tick(300);
+    timer_wheel_timer_stop(restarting_timer);
+}
+
+TEST_ORDERED(TimerWheel, CreateAssertsIfCbNull, 1)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("cb", "timer_wheel_timer_create");
+
+    TimerWheelTimer timer = timer_wheel_timer_create(300, NULL, NULL);
+}
+
+TEST_ORDERED(TimerWheel, StartAssertsIfPeriod0, 1)
+{
+    TimerWheelTimer timer = timer_wheel_timer_create(0, timer_cb, NULL);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self->period_ms > 0", "timer_wheel_timer_start");
+    timer_wheel_timer_start(timer);
+}
+
+TEST_ORDERED(TimerWheel, SetPeriodAssertsIfSelfNull, 1)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self", "timer_wheel_timer_set_period");
+
+    timer_wheel_timer_set_period(NULL, 300);
+}
+
+TEST_ORDERED(TimerWheel, StartAssertsIfSelfNull, 1)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self", "timer_wheel_timer_start");
+
+    timer_wheel_timer_start(NULL);
+}
+
+TEST_ORDERED(TimerWheel, StopAssertsIfSelfNull, 1)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self", "timer_wheel_timer_stop");
+
+    timer_wheel_timer_stop(NULL);
+}
@@ -36,6 +36,22 @@ static void for_each_verify(size_t expected_count)
     CHECK_EQUAL(expected_count, for_each_count);
 }
 
+/* Replace a variable requirement with a band requirement. It is destroyed in teardown, like the other requirements. */
+static void replace_with_band_requirement(size_t idx)
+{
+    variable_requirement_destroy(variable_requirements[idx]);
+    variable_requirements[idx] = fake_variable_requirement_create_band();
+}
+
+/* Report results of the first num_requirements variable requirements. Bit i of results is the result of req_i */
+static void set_variable_requirement_results(size_t num_requirements, unsigned int results)
+{
+    for (size_t i = 0; i < num_requirements; i++) {
+        bool result = results & (1U << i);
+        alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[i], result);
+    }
+}
+
 // clang-format off
 TEST_GROUP(AlertCondition)
 {
@@ -69,7 +85,7 @@ TEST_GROUP(AlertCondition)
 
 TEST(AlertCondition, EvaluateAssertsNoVariableRequirementsAdded)
 {
-    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self->num_items_in_reqs_array > 0", "alert_condition_evaluate");
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self->num_requirements > 0", "alert_condition_evaluate");
 
     bool unused = alert_condition_evaluate(alert_condition);
 }
@@ -593,6 +609,282 @@ TEST(AlertCondition, EvaluateAndOrMix2)
     CHECK_EQUAL(true, actual_evaluate_result);
 }
 
+TEST(AlertCondition, GetResultFalseBeforeResultsAreReported)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 2);
+
+    /* Fake requirements would evaluate to true, but they are not evaluated by get_result */
+    fake_variable_requirement_set_evaluate_result(variable_requirements[0], true);
+    fake_variable_requirement_set_evaluate_result(variable_requirements[1], true);
+
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[1]);
+
+    CHECK_EQUAL(false, alert_condition_get_result(alert_condition));
+}
+
+TEST(AlertCondition, GetResultAfterEvaluateReturnsEvaluateResult)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 3);
+
+    /* true <=> (false OR true) AND true */
+    fake_variable_requirement_set_evaluate_result(variable_requirements[0], false);
+    fake_variable_requirement_set_evaluate_result(variable_requirements[1], true);
+    fake_variable_requirement_set_evaluate_result(variable_requirements[2], true);
+
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[1]);
+    alert_condition_start_new_ored_requirement(alert_condition);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[2]);
+    bool evaluate_result = alert_condition_evaluate(alert_condition);
+
+    CHECK_EQUAL(true, evaluate_result);
+    CHECK_EQUAL(true, alert_condition_get_result(alert_condition));
+}
+
+TEST(AlertCondition, SetVariableRequirementResultOneReq)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 1);
+
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[0], true);
+    CHECK_EQUAL(true, alert_condition_get_result(alert_condition));
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[0], false);
+    CHECK_EQUAL(false, alert_condition_get_result(alert_condition));
+}
+
+TEST(AlertCondition, SetVariableRequirementResultOredReqSatisfiedWhileOneReqTrue)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 2);
+
+    /* req_0 OR req_1 */
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[1]);
+
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[0], true);
+    CHECK_EQUAL(true, alert_condition_get_result(alert_condition));
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[1], true);
+    CHECK_EQUAL(true, alert_condition_get_result(alert_condition));
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[0], false);
+    CHECK_EQUAL(true, alert_condition_get_result(alert_condition));
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[1], false);
+    CHECK_EQUAL(false, alert_condition_get_result(alert_condition));
+}
+
+TEST(AlertCondition, SetVariableRequirementResultAndedReqsAllMustBeTrue)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 3);
+
+    /* req_0 AND req_1 AND req_2 */
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+    alert_condition_start_new_ored_requirement(alert_condition);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[1]);
+    alert_condition_start_new_ored_requirement(alert_condition);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[2]);
+
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[0], true);
+    CHECK_EQUAL(false, alert_condition_get_result(alert_condition));
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[2], true);
+    CHECK_EQUAL(false, alert_condition_get_result(alert_condition));
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[1], true);
+    CHECK_EQUAL(true, alert_condition_get_result(alert_condition));
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[2], false);
+    CHECK_EQUAL(false, alert_condition_get_result(alert_condition));
+}
+
+TEST(AlertCondition, SetVariableRequirementResultSameResultTwiceHasNoEffect)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 2);
+
+    /* req_0 OR req_1 */
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[1]);
+
+    /* If the second call counted req_0 as satisfied twice, the ORed requirement would stay satisfied after req_0 is
+     * reported as false once. */
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[0], true);
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[0], true);
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[0], false);
+    CHECK_EQUAL(false, alert_condition_get_result(alert_condition));
+
+    /* Reporting false for a requirement that is already false must not make the ORed requirement unsatisfied twice */
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[1], false);
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[1], true);
+    CHECK_EQUAL(true, alert_condition_get_result(alert_condition));
+}
+
+TEST(AlertCondition, SetVariableRequirementResultDoesNotEvaluateOtherReqs)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 2);
+
+    /* req_0 AND req_1 */
+    fake_variable_requirement_set_evaluate_result(variable_requirements[0], true);
+    fake_variable_requirement_set_evaluate_result(variable_requirements[1], false);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+    alert_condition_start_new_ored_requirement(alert_condition);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[1]);
+    bool evaluate_result = alert_condition_evaluate(alert_condition);
+
+    /* If req_0 was evaluated again, it would now evaluate to false, and the condition would evaluate to false */
+    fake_variable_requirement_set_evaluate_result(variable_requirements[0], false);
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[1], true);
+
+    CHECK_EQUAL(false, evaluate_result);
+    CHECK_EQUAL(true, alert_condition_get_result(alert_condition));
+}
+
+TEST(AlertCondition, SetVariableRequirementResultMaxNumVariableReqsAnded)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >=
+               CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS);
+
+    for (size_t i = 0; i < CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS; i++) {
+        alert_condition_add_variable_requirement(alert_condition, variable_requirements[i]);
+        alert_condition_start_new_ored_requirement(alert_condition);
+    }
+
+    for (size_t i = 0; i < CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS; i++) {
+        CHECK_EQUAL(false, alert_condition_get_result(alert_condition));
+        alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[i], true);
+    }
+    CHECK_EQUAL(true, alert_condition_get_result(alert_condition));
+}
+
+TEST(AlertCondition, ExpressionAndOredWithReq)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 3);
+
+    /* (req_0 AND req_1) OR req_2 */
+    alert_condition_begin_expression(alert_condition, ALERT_CONDITION_OPERATOR_AND);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[1]);
+    alert_condition_end_expression(alert_condition);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[2]);
+
+    for (unsigned int results = 0; results < 8; results++) {
+        bool req_0 = results & 0x1U;
+        bool req_1 = results & 0x2U;
+        bool req_2 = results & 0x4U;
+        set_variable_requirement_results(3, results);
+        CHECK_EQUAL((req_0 && req_1) || req_2, alert_condition_get_result(alert_condition));
+    }
+}
+
+TEST(AlertCondition, ExpressionNotAndedWithReq)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 2);
+
+    /* (NOT req_0) AND req_1 */
+    alert_condition_begin_expression(alert_condition, ALERT_CONDITION_OPERATOR_NOT);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+    alert_condition_end_expression(alert_condition);
+    alert_condition_start_new_ored_requirement(alert_condition);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[1]);
+
+    for (unsigned int results = 0; results < 4; results++) {
+        bool req_0 = results & 0x1U;
+        bool req_1 = results & 0x2U;
+        set_variable_requirement_results(2, results);
+        CHECK_EQUAL(!req_0 && req_1, alert_condition_get_result(alert_condition));
+    }
+}
+
+TEST(AlertCondition, ExpressionsNested)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 6);
+    EAS_ASSERT(CONFIG_ALERT_CONDITION_MAX_EXPRESSION_DEPTH >= 3);
+
+    /* (NOT ((req_0 OR req_1) AND req_2) OR req_3) AND (req_4 OR NOT req_5) */
+    alert_condition_begin_expression(alert_condition, ALERT_CONDITION_OPERATOR_NOT);
+    alert_condition_begin_expression(alert_condition, ALERT_CONDITION_OPERATOR_AND);
+    alert_condition_begin_expression(alert_condition, ALERT_CONDITION_OPERATOR_OR);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[1]);
+    alert_condition_end_expression(alert_condition);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[2]);
+    alert_condition_end_expression(alert_condition);
+    alert_condition_end_expression(alert_condition);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[3]);
+    alert_condition_start_new_ored_requirement(alert_condition);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[4]);
+    alert_condition_begin_expression(alert_condition, ALERT_CONDITION_OPERATOR_NOT);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[5]);
+    alert_condition_end_expression(alert_condition);
+
+    for (unsigned int results = 0; results < 64; results++) {
+        bool req[6];
+        for (size_t i = 0; i < 6; i++) {
+            req[i] = results & (1U << i);
+        }
+        set_variable_requirement_results(6, results);
+        bool expected_result = (!((req[0] || req[1]) && req[2]) || req[3]) && (req[4] || !req[5]);
+        CHECK_EQUAL(expected_result, alert_condition_get_result(alert_condition));
+    }
+}
+
+TEST(AlertCondition, ExpressionEvaluate)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 3);
+
+    /* req_0 OR (req_1 AND req_2) */
+    fake_variable_requirement_set_evaluate_result(variable_requirements[0], false);
+    fake_variable_requirement_set_evaluate_result(variable_requirements[1], true);
+    fake_variable_requirement_set_evaluate_result(variable_requirements[2], true);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+    alert_condition_begin_expression(alert_condition, ALERT_CONDITION_OPERATOR_AND);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[1]);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[2]);
+    alert_condition_end_expression(alert_condition);
+
+    CHECK_EQUAL(true, alert_condition_evaluate(alert_condition));
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[2], false);
+    CHECK_EQUAL(false, alert_condition_get_result(alert_condition));
+}
+
+TEST(AlertCondition, ExpressionForEachCallsCbInOrderOfAdding)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 3);
+
+    /* NOT (req_0 OR req_1) OR req_2 */
+    alert_condition_begin_expression(alert_condition, ALERT_CONDITION_OPERATOR_NOT);
+    alert_condition_begin_expression(alert_condition, ALERT_CONDITION_OPERATOR_OR);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[1]);
+    alert_condition_end_expression(alert_condition);
+    alert_condition_end_expression(alert_condition);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[2]);
+    alert_condition_for_each(alert_condition, for_each_cb);
+
+    for_each_verify(3);
+}
+
+TEST(AlertCondition, ResetDropsOpenExpressions)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 2);
+
+    alert_condition_begin_expression(alert_condition, ALERT_CONDITION_OPERATOR_AND);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+    alert_condition_reset(alert_condition);
+
+    /* If the AND expression was still open, req_1 would be its operand and get_result would assert */
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[1]);
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[1], true);
+    CHECK_EQUAL(true, alert_condition_get_result(alert_condition));
+}
+
+TEST(AlertCondition, ResetClearsReportedResults)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 2);
+
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[0], true);
+    alert_condition_reset(alert_condition);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[1]);
+
+    CHECK_EQUAL(false, alert_condition_get_result(alert_condition));
+}
+
 TEST(AlertCondition, ResetRemovesAllVariableRequirements)
 {
     EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >=
@@ -608,6 +900,60 @@ TEST(AlertCondition, ResetRemovesAllVariableRequirements)
     for_each_verify(0);
 }
 
+TEST(AlertCondition, ResetReturnsVariableRequirementsToPool)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >=
+               CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS);
+
+    /* More variable requirements are added in total than the pool can hold at once */
+    for (size_t i = 0; i < CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS + 1; i++) {
+        for (size_t j = 0; j < CONFIG_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS; j++) {
+            alert_condition_add_variable_requirement(alert_condition, variable_requirements[j]);
+        }
+        alert_condition_reset(alert_condition);
+    }
+
+    CHECK_EQUAL(CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS,
+                alert_condition_get_num_free_variable_requirements());
+}
+
+TEST(AlertCondition, GetNumFreeVariableRequirements)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 2);
+
+    size_t max_total = alert_condition_get_max_total_num_variable_requirements();
+    CHECK_EQUAL(CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_VARIABLE_REQUIREMENTS, max_total);
+    CHECK_EQUAL(max_total, alert_condition_get_num_free_variable_requirements());
+
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+    alert_condition_start_new_ored_requirement(alert_condition);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[1]);
+    CHECK_EQUAL(max_total - 2, alert_condition_get_num_free_variable_requirements());
+
+    alert_condition_reset(alert_condition);
+    CHECK_EQUAL(max_total, alert_condition_get_num_free_variable_requirements());
+}
+
+TEST(AlertCondition, GetNumFreeBandRequirements)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 3);
+    EAS_ASSERT(CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_BAND_REQUIREMENTS >= 2);
+
+    size_t max_total = alert_condition_get_max_total_num_band_requirements();
+    CHECK_EQUAL(CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_BAND_REQUIREMENTS, max_total);
+    CHECK_EQUAL(max_total, alert_condition_get_num_free_band_requirements());
+
+    replace_with_band_requirement(0);
+    replace_with_band_requirement(2);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[1]);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[2]);
+    CHECK_EQUAL(max_total - 2, alert_condition_get_num_free_band_requirements());
+
+    alert_condition_reset(alert_condition);
+    CHECK_EQUAL(max_total, alert_condition_get_num_free_band_requirements());
+}
+
 TEST(AlertCondition, ResetKeepsConditionEmpty)
 {
     alert_condition_reset(alert_condition);
@@ -720,8 +1066,144 @@ TEST(AlertCondition, AddVariableRequirementAssertsIfInstanceNull)
     alert_condition_add_variable_requirement(NULL, variable_requirements[0]);
 }
 
+TEST(AlertCondition, AddVariableRequirementAssertsIfBandBudgetExceeded)
+{
+    const size_t max_total = CONFIG_ALERT_CONDITION_MAX_TOTAL_NUM_BAND_REQUIREMENTS;
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS > max_total);
+
+    for (size_t i = 0; i < max_total + 1; i++) {
+        replace_with_band_requirement(i);
+    }
+    for (size_t i = 0; i < max_total; i++) {
+        alert_condition_add_variable_requirement(alert_condition, variable_requirements[i]);
+    }
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("!is_band_budget_exceeded", "alert_condition_add_variable_requirement");
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[max_total]);
+}
+
 TEST(AlertCondition, AddVariableRequirementAssertsIfRequirementNull)
 {
     TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("variable_requirement", "alert_condition_add_variable_requirement");
     alert_condition_add_variable_requirement(alert_condition, NULL);
 }
+
+TEST(AlertCondition, GetResultAssertsNoVariableRequirementsAdded)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self->num_requirements > 0", "alert_condition_get_result");
+    bool unused = alert_condition_get_result(alert_condition);
+}
+
+TEST(AlertCondition, GetResultAssertsIfInstanceNull)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self", "alert_condition_get_result");
+    alert_condition_get_result(NULL);
+}
+
+TEST(AlertCondition, SetVariableRequirementResultAssertsIfInstanceNull)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 1);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self", "alert_condition_set_variable_requirement_result");
+    alert_condition_set_variable_requirement_result(NULL, variable_requirements[0], true);
+}
+
+TEST(AlertCondition, SetVariableRequirementResultAssertsIfRequirementNull)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("variable_requirement", "alert_condition_set_variable_requirement_result");
+    alert_condition_set_variable_requirement_result(alert_condition, NULL, true);
+}
+
+TEST(AlertCondition, SetVariableRequirementResultAssertsIfRequirementNotInCondition)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 2);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("false", "alert_condition_set_variable_requirement_result");
+    alert_condition_set_variable_requirement_result(alert_condition, variable_requirements[1], true);
+}
+
+TEST(AlertCondition, BeginExpressionAssertsIfInstanceNull)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self", "alert_condition_begin_expression");
+    alert_condition_begin_expression(NULL, ALERT_CONDITION_OPERATOR_AND);
+}
+
+TEST(AlertCondition, BeginExpressionAssertsIfInvalidOperator)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_operator", "alert_condition_begin_expression");
+    alert_condition_begin_expression(alert_condition, (AlertConditionOperator)3);
+}
+
+TEST(AlertCondition, BeginExpressionAssertsIfMaxDepthExceeded)
+{
+    CHECK_EQUAL(CONFIG_ALERT_CONDITION_MAX_EXPRESSION_DEPTH, alert_condition_get_max_expression_depth());
+    for (size_t i = 0; i < alert_condition_get_max_expression_depth(); i++) {
+        alert_condition_begin_expression(alert_condition, ALERT_CONDITION_OPERATOR_OR);
+    }
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("!is_max_expression_depth_exceeded", "alert_condition_begin_expression");
+    alert_condition_begin_expression(alert_condition, ALERT_CONDITION_OPERATOR_OR);
+}
+
+TEST(AlertCondition, BeginExpressionAssertsIfOtherConditionHasOpenExpressions)
+{
+    EAS_ASSERT(CONFIG_ALERT_CONDITION_MAX_NUM_INSTANCES >= 2);
+    static AlertCondition other_alert_condition = alert_condition_create();
+
+    /* Memory for open expressions is shared by all alert conditions */
+    alert_condition_begin_expression(alert_condition, ALERT_CONDITION_OPERATOR_AND);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("!is_other_condition_populated", "start_operand");
+    alert_condition_begin_expression(other_alert_condition, ALERT_CONDITION_OPERATOR_AND);
+}
+
+TEST(AlertCondition, AddVariableRequirementAssertsIfSecondNotOperand)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 2);
+
+    alert_condition_begin_expression(alert_condition, ALERT_CONDITION_OPERATOR_NOT);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("!is_not_with_multiple_operands", "start_operand");
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[1]);
+}
+
+TEST(AlertCondition, EndExpressionAssertsIfInstanceNull)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self", "alert_condition_end_expression");
+    alert_condition_end_expression(NULL);
+}
+
+TEST(AlertCondition, EndExpressionAssertsIfNoOpenExpression)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("has_open_expressions(self)", "alert_condition_end_expression");
+    alert_condition_end_expression(alert_condition);
+}
+
+TEST(AlertCondition, EndExpressionAssertsIfNoOperands)
+{
+    alert_condition_begin_expression(alert_condition, ALERT_CONDITION_OPERATOR_AND);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("has_operands", "alert_condition_end_expression");
+    alert_condition_end_expression(alert_condition);
+}
+
+TEST(AlertCondition, GetResultAssertsIfOpenExpression)
+{
+    EAS_ASSERT(TEST_ALERT_CONDITION_MAX_NUM_VARIABLE_REQUIREMENTS >= 1);
+
+    alert_condition_begin_expression(alert_condition, ALERT_CONDITION_OPERATOR_AND);
+    alert_condition_add_variable_requirement(alert_condition, variable_requirements[0]);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("!has_open_expressions(self)", "alert_condition_get_result");
+    bool unused = alert_condition_get_result(alert_condition);
+}
+
+TEST(AlertCondition, StartNewOredRequirementAssertsIfOpenExpression)
+{
+    alert_condition_begin_expression(alert_condition, ALERT_CONDITION_OPERATOR_OR);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("!has_open_expressions(self)", "alert_condition_start_new_ored_requirement");
+    alert_condition_start_new_ored_requirement(alert_condition);
+}
@@ -3,18 +3,18 @@
 #include "CppUTestExt/TestAssertPlugin.h"
 
 #include "alert_raiser.h"
-#include "eas_timer_defs.h"
+#include "mocks/mock_timer_wheel.h"
 
 #define TEST_ALERT_RAISER_MAX_NUM_TIMER_CBS 2
 
-/* The implementation of eas_timer_create in EasTimer mock object populates these with the warmup and cooldown
+/* The implementation of timer_wheel_timer_create in TimerWheel mock object populates these with the warmup and cooldown
  * callbacks and their user data. This is needed in the test so that we can call these callback to simulate
  * warmup/cooldown periods expiring. */
-static EasTimerCb timer_cbs[TEST_ALERT_RAISER_MAX_NUM_TIMER_CBS];
+static TimerWheelTimerCb timer_cbs[TEST_ALERT_RAISER_MAX_NUM_TIMER_CBS];
 static void *timer_cbs_user_data[TEST_ALERT_RAISER_MAX_NUM_TIMER_CBS];
 
-static EasTimer warmup_timer = (EasTimer)0x42;
-static EasTimer cooldown_timer = (EasTimer)0x43;
+static TimerWheelTimer warmup_timer = (TimerWheelTimer)0x42;
+static TimerWheelTimer cooldown_timer = (TimerWheelTimer)0x43;
 
 // clang-format off
 TEST_GROUP(AlertRaiser)
@@ -35,20 +35,18 @@ TEST_GROUP(AlertRaiser)
 
 TEST(AlertRaiser, Warmup0ImmediatelyNotifiesWhenAlertConditionBecomesTrue)
 {
-    uint8_t alert_id = 0;
+    uint16_t alert_id = 0;
     uint32_t warmup_period_ms = 0;
     uint32_t cooldown_period_ms = 0;
     /* alert_raiser_create */
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     /* alert_raiser_set_alert_condition_result(true) */
@@ -61,20 +59,18 @@ TEST(AlertRaiser, Warmup0ImmediatelyNotifiesWhenAlertConditionBecomesTrue)
 
 TEST(AlertRaiser, Warmup0Cooldown0ImmediatelyNotify)
 {
-    uint8_t alert_id = 0;
+    uint16_t alert_id = 0;
     uint32_t warmup_period_ms = 0;
     uint32_t cooldown_period_ms = 0;
     /* alert_raiser_create */
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     /* alert_raiser_set_alert_condition_result(true) */
@@ -90,37 +86,35 @@ TEST(AlertRaiser, Warmup0Cooldown0ImmediatelyNotify)
 
 TEST(AlertRaiser, WarmupNot0Cooldown0)
 {
-    uint8_t alert_id = 0;
+    uint16_t alert_id = 0;
     uint32_t warmup_period_ms = 1000;
     uint32_t cooldown_period_ms = 0;
 
     /* alert_raiser_create */
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     /* alert_raiser_set_alert */
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", warmup_timer)
         .withParameter("period_ms", warmup_period_ms);
     /* alert_raiser_set_alert_condition_result(true) */
-    mock().expectOneCall("eas_timer_start").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", warmup_timer);
     /* Inside warmup callback */
     mock().expectOneCall("alert_notifier_notify").withParameter("alert_id", alert_id).withParameter("is_raised", true);
     /* alert_raiser_set_alert_condition_result(false) */
     mock().expectOneCall("alert_notifier_notify").withParameter("alert_id", alert_id).withParameter("is_raised", false);
 
     AlertRaiser alert_raiser = alert_raiser_create();
-    EasTimerCb warmup_cb = timer_cbs[0];
+    TimerWheelTimerCb warmup_cb = timer_cbs[0];
     void *warmup_cb_user_data = timer_cbs_user_data[0];
     alert_raiser_set_alert(alert_raiser, alert_id, warmup_period_ms, cooldown_period_ms);
     alert_raiser_set_alert_condition_result(alert_raiser, true);
@@ -131,37 +125,35 @@ TEST(AlertRaiser, WarmupNot0Cooldown0)
 
 TEST(AlertRaiser, Warmup0CooldownNot0)
 {
-    uint8_t alert_id = 0;
+    uint16_t alert_id = 0;
     uint32_t warmup_period_ms = 0;
     uint32_t cooldown_period_ms = 1000;
 
     /* alert_raiser_create */
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     /* alert_raiser_set_alert */
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", cooldown_timer)
         .withParameter("period_ms", cooldown_period_ms);
     /* alert_raiser_set_alert_condition_result(true) */
     mock().expectOneCall("alert_notifier_notify").withParameter("alert_id", alert_id).withParameter("is_raised", true);
     /* alert_raiser_set_alert_condition_result(false) */
-    mock().expectOneCall("eas_timer_start").withParameter("self", cooldown_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", cooldown_timer);
     /* Inside cooldown callback */
     mock().expectOneCall("alert_notifier_notify").withParameter("alert_id", alert_id).withParameter("is_raised", false);
 
     AlertRaiser alert_raiser = alert_raiser_create();
-    EasTimerCb cooldown_cb = timer_cbs[1];
+    TimerWheelTimerCb cooldown_cb = timer_cbs[1];
     void *cooldown_cb_user_data = timer_cbs_user_data[1];
     alert_raiser_set_alert(alert_raiser, alert_id, warmup_period_ms, cooldown_period_ms);
     alert_raiser_set_alert_condition_result(alert_raiser, true);
@@ -172,21 +164,19 @@ TEST(AlertRaiser, Warmup0CooldownNot0)
 
 TEST(AlertRaiser, Warmup0Cooldown0ConditionResultSetSeveralTimes)
 {
-    uint8_t alert_id = 1;
+    uint16_t alert_id = 1;
     uint32_t warmup_period_ms = 0;
     uint32_t cooldown_period_ms = 0;
 
     /* alert_raiser_create */
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     /* First three calls to alert_raiser_set_alert_condition_result(true) */
@@ -217,53 +207,51 @@ TEST(AlertRaiser, Warmup0Cooldown0ConditionResultSetSeveralTimes)
 
 TEST(AlertRaiser, WarmupNot0CooldownNot0ConditionResultSetSeveralTimes)
 {
-    uint8_t alert_id = 99;
+    uint16_t alert_id = 99;
     uint32_t warmup_period_ms = 2002;
     uint32_t cooldown_period_ms = 10001;
 
     /* alert_raiser_create */
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     /* alert_raiser_set_alert */
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", warmup_timer)
         .withParameter("period_ms", warmup_period_ms);
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", cooldown_timer)
         .withParameter("period_ms", cooldown_period_ms);
     /* First four calls to alert_raiser_set_alert_condition_result(true) */
-    mock().expectOneCall("eas_timer_start").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", warmup_timer);
     /* Warmup cb 1 */
     mock().expectOneCall("alert_notifier_notify").withParameter("alert_id", alert_id).withParameter("is_raised", true);
     /* First three calls to alert_raiser_set_alert_condition_result(false) */
-    mock().expectOneCall("eas_timer_start").withParameter("self", cooldown_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", cooldown_timer);
     /* Cooldown cb 1 */
     mock().expectOneCall("alert_notifier_notify").withParameter("alert_id", alert_id).withParameter("is_raised", false);
     /* Fifth call to alert_raiser_set_alert_condition_result(true) */
-    mock().expectOneCall("eas_timer_start").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", warmup_timer);
     /* Warmup cb 2 */
     mock().expectOneCall("alert_notifier_notify").withParameter("alert_id", alert_id).withParameter("is_raised", true);
     /* Fifth call to alert_raiser_set_alert_condition_result(false) */
-    mock().expectOneCall("eas_timer_start").withParameter("self", cooldown_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", cooldown_timer);
     /* Cooldown cb 2 */
     mock().expectOneCall("alert_notifier_notify").withParameter("alert_id", alert_id).withParameter("is_raised", false);
 
     AlertRaiser alert_raiser = alert_raiser_create();
-    EasTimerCb warmup_cb = timer_cbs[0];
+    TimerWheelTimerCb warmup_cb = timer_cbs[0];
     void *warmup_cb_user_data = timer_cbs_user_data[0];
-    EasTimerCb cooldown_cb = timer_cbs[1];
+    TimerWheelTimerCb cooldown_cb = timer_cbs[1];
     void *cooldown_cb_user_data = timer_cbs_user_data[1];
     alert_raiser_set_alert(alert_raiser, alert_id, warmup_period_ms, cooldown_period_ms);
     alert_raiser_set_alert_condition_result(alert_raiser, true);
@@ -283,60 +271,58 @@ TEST(AlertRaiser, WarmupNot0CooldownNot0ConditionResultSetSeveralTimes)
 
 TEST(AlertRaiser, AlertConditionSetBeforeTimerExpires)
 {
-    uint8_t alert_id = 24;
+    uint16_t alert_id = 24;
     uint32_t warmup_period_ms = 5000;
     uint32_t cooldown_period_ms = 3000;
 
     /* alert_raiser_create */
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     /* alert_raiser_set_alert */
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", warmup_timer)
         .withParameter("period_ms", warmup_period_ms);
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", cooldown_timer)
         .withParameter("period_ms", cooldown_period_ms);
     /* First call to alert_raiser_set_alert_condition_result(true) */
-    mock().expectOneCall("eas_timer_start").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", warmup_timer);
     /* Two calls to alert_raiser_set_alert_condition_result(false) */
-    mock().expectOneCall("eas_timer_stop").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_stop").withParameter("self", warmup_timer);
     /* Second and third calls to alert_raiser_set_alert_condition_result(true) */
-    mock().expectOneCall("eas_timer_start").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", warmup_timer);
     /* Warmup cb */
     mock().expectOneCall("alert_notifier_notify").withParameter("alert_id", alert_id).withParameter("is_raised", true);
     /* Third call to alert_raiser_set_alert_condition_result(false) */
-    mock().expectOneCall("eas_timer_start").withParameter("self", cooldown_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", cooldown_timer);
     /* Fourth call to alert_raiser_set_alert_condition_result(true) */
-    mock().expectOneCall("eas_timer_stop").withParameter("self", cooldown_timer);
+    mock().expectOneCall("timer_wheel_timer_stop").withParameter("self", cooldown_timer);
 
     AlertRaiser alert_raiser = alert_raiser_create();
-    EasTimerCb warmup_cb = timer_cbs[0];
+    TimerWheelTimerCb warmup_cb = timer_cbs[0];
     void *warmup_cb_user_data = timer_cbs_user_data[0];
     alert_raiser_set_alert(alert_raiser, alert_id, warmup_period_ms, cooldown_period_ms);
     /* This will start the warmup timer */
     alert_raiser_set_alert_condition_result(alert_raiser, true);
     /* Condition result changed to false before warmup timer expired. This should stop the warmup timer. */
     alert_raiser_set_alert_condition_result(alert_raiser, false);
-    /* The second call to alert_raiser_set_alert_condition_result(false) here checks that the call to eas_timer_stop
-     * happens only once. Nothing should happen as a result of this call. */
+    /* The second call to alert_raiser_set_alert_condition_result(false) here checks that the call to
+     * timer_wheel_timer_stop happens only once. Nothing should happen as a result of this call. */
     alert_raiser_set_alert_condition_result(alert_raiser, false);
     /* This start the warmup timer again*/
     alert_raiser_set_alert_condition_result(alert_raiser, true);
-    /* The second call to alert_raiser_set_alert_condition_result(true) here checks that the call to eas_timer_start
-     * happens only once */
+    /* The second call to alert_raiser_set_alert_condition_result(true) here checks that the call to
+     * timer_wheel_timer_start happens only once */
     alert_raiser_set_alert_condition_result(alert_raiser, true);
     /* Simulate warmup timer expiring. Should call alert_notifier_notify(true) */
     warmup_cb(warmup_cb_user_data);
@@ -352,33 +338,31 @@ TEST(AlertRaiser, AlertConditionSetBeforeTimerExpires)
 
 TEST(AlertRaiser, WarmupTimerCbExecutedAfterTimerStopped)
 {
-    uint8_t alert_id = 42;
+    uint16_t alert_id = 42;
     uint32_t warmup_period_ms = 10000;
     uint32_t cooldown_period_ms = 0;
 
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", warmup_timer)
         .withParameter("period_ms", warmup_period_ms);
-    mock().expectOneCall("eas_timer_start").withParameter("self", warmup_timer);
-    mock().expectOneCall("eas_timer_stop").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_stop").withParameter("self", warmup_timer);
     /* Do not expect the call to alert_notifier_notify(true) from within the warmup timer cb */
 
     /* Creates warmup and cooldown timer instances*/
     AlertRaiser alert_raiser = alert_raiser_create();
-    EasTimerCb warmup_cb = timer_cbs[0];
+    TimerWheelTimerCb warmup_cb = timer_cbs[0];
     void *warmup_cb_user_data = timer_cbs_user_data[0];
     /* Sets the period of the warmup timer */
     alert_raiser_set_alert(alert_raiser, alert_id, warmup_period_ms, cooldown_period_ms);
@@ -393,34 +377,32 @@ TEST(AlertRaiser, WarmupTimerCbExecutedAfterTimerStopped)
 
 TEST(AlertRaiser, CooldownTimerCbExecutedAfterTimerStopped)
 {
-    uint8_t alert_id = 9;
+    uint16_t alert_id = 9;
     uint32_t warmup_period_ms = 0;
     uint32_t cooldown_period_ms = 20000;
 
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", cooldown_timer)
         .withParameter("period_ms", cooldown_period_ms);
     mock().expectOneCall("alert_notifier_notify").withParameter("alert_id", alert_id).withParameter("is_raised", true);
-    mock().expectOneCall("eas_timer_start").withParameter("self", cooldown_timer);
-    mock().expectOneCall("eas_timer_stop").withParameter("self", cooldown_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", cooldown_timer);
+    mock().expectOneCall("timer_wheel_timer_stop").withParameter("self", cooldown_timer);
     /* Do not expect the call to alert_notifier_notify(false) from within the cooldown timer cb */
 
     /* Creates warmup and cooldown timer instances*/
     AlertRaiser alert_raiser = alert_raiser_create();
-    EasTimerCb cooldown_cb = timer_cbs[1];
+    TimerWheelTimerCb cooldown_cb = timer_cbs[1];
     void *cooldown_cb_user_data = timer_cbs_user_data[1];
     /* Sets the period of the cooldown timer */
     alert_raiser_set_alert(alert_raiser, alert_id, warmup_period_ms, cooldown_period_ms);
@@ -438,33 +420,31 @@ TEST(AlertRaiser, CooldownTimerCbExecutedAfterTimerStopped)
 
 TEST(AlertRaiser, SetAlertConditionTrueAfterWarmupExpiredHasNoEffect)
 {
-    uint8_t alert_id = 3;
+    uint16_t alert_id = 3;
     uint32_t warmup_period_ms = 5000;
     uint32_t cooldown_period_ms = 0;
 
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", warmup_timer)
         .withParameter("period_ms", warmup_period_ms);
-    mock().expectOneCall("eas_timer_start").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", warmup_timer);
     mock().expectOneCall("alert_notifier_notify").withParameter("alert_id", alert_id).withParameter("is_raised", true);
     /* Do not expect another alert_notifier_notify(true) call */
 
     /* Creates warmup and cooldown timer instances */
     AlertRaiser alert_raiser = alert_raiser_create();
-    EasTimerCb warmup_cb = timer_cbs[0];
+    TimerWheelTimerCb warmup_cb = timer_cbs[0];
     void *warmup_cb_user_data = timer_cbs_user_data[0];
     /* Sets timer period */
     alert_raiser_set_alert(alert_raiser, alert_id, warmup_period_ms, cooldown_period_ms);
@@ -478,41 +458,39 @@ TEST(AlertRaiser, SetAlertConditionTrueAfterWarmupExpiredHasNoEffect)
 
 TEST(AlertRaiser, SetAlertConditionTrueAfterCooldownExpiredHasNoEffect)
 {
-    uint8_t alert_id = 4;
+    uint16_t alert_id = 4;
     uint32_t warmup_period_ms = 4321;
     uint32_t cooldown_period_ms = 1234;
 
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", warmup_timer)
         .withParameter("period_ms", warmup_period_ms);
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", cooldown_timer)
         .withParameter("period_ms", cooldown_period_ms);
-    mock().expectOneCall("eas_timer_start").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", warmup_timer);
     mock().expectOneCall("alert_notifier_notify").withParameter("alert_id", alert_id).withParameter("is_raised", true);
-    mock().expectOneCall("eas_timer_start").withParameter("self", cooldown_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", cooldown_timer);
     mock().expectOneCall("alert_notifier_notify").withParameter("alert_id", alert_id).withParameter("is_raised", false);
     /* Do not expect another alert_notifier_notify(false) call */
 
     /* Creates warmup and cooldown timer instances */
     AlertRaiser alert_raiser = alert_raiser_create();
-    EasTimerCb warmup_cb = timer_cbs[0];
+    TimerWheelTimerCb warmup_cb = timer_cbs[0];
     void *warmup_cb_user_data = timer_cbs_user_data[0];
-    EasTimerCb cooldown_cb = timer_cbs[1];
+    TimerWheelTimerCb cooldown_cb = timer_cbs[1];
     void *cooldown_cb_user_data = timer_cbs_user_data[1];
     /* Sets timer period */
     alert_raiser_set_alert(alert_raiser, alert_id, warmup_period_ms, cooldown_period_ms);
@@ -539,38 +517,36 @@ TEST(AlertRaiser, AlertIdAndTimerPeriodsAreOverwrittenWhenNewAlertIsSet)
     uint32_t alert_1_cooldown_period_ms = 0;
 
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     /* Expected calls for alert 0 */
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", warmup_timer)
         .withParameter("period_ms", alert_0_warmup_period_ms);
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", cooldown_timer)
         .withParameter("period_ms", alert_0_cooldown_period_ms);
-    mock().expectOneCall("eas_timer_start").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", warmup_timer);
     mock()
         .expectOneCall("alert_notifier_notify")
         .withParameter("alert_id", alert_0_id)
         .withParameter("is_raised", true);
-    mock().expectOneCall("eas_timer_start").withParameter("self", cooldown_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", cooldown_timer);
     mock()
         .expectOneCall("alert_notifier_notify")
         .withParameter("alert_id", alert_0_id)
         .withParameter("is_raised", false);
     /* Expected calls for alert 1 */
-    /* No expected calls to eas_timer_set_period, since both warmup and cooldown periods are 0 */
+    /* No expected calls to timer_wheel_timer_set_period, since both warmup and cooldown periods are 0 */
     mock()
         .expectOneCall("alert_notifier_notify")
         .withParameter("alert_id", alert_1_id)
@@ -582,9 +558,9 @@ TEST(AlertRaiser, AlertIdAndTimerPeriodsAreOverwrittenWhenNewAlertIsSet)
 
     /* Creates warmup and cooldown timer instances */
     AlertRaiser alert_raiser = alert_raiser_create();
-    EasTimerCb warmup_cb = timer_cbs[0];
+    TimerWheelTimerCb warmup_cb = timer_cbs[0];
     void *warmup_cb_user_data = timer_cbs_user_data[0];
-    EasTimerCb cooldown_cb = timer_cbs[1];
+    TimerWheelTimerCb cooldown_cb = timer_cbs[1];
     void *cooldown_cb_user_data = timer_cbs_user_data[1];
     /* Sets timer period */
     alert_raiser_set_alert(alert_raiser, alert_0_id, alert_0_warmup_period_ms, alert_0_cooldown_period_ms);
@@ -618,53 +594,51 @@ TEST(AlertRaiser, CooldownTimerRunningWhenNewAlarmIsSet)
     uint32_t alert_1_cooldown_period_ms = 2;
 
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     /* Expected calls for alert 0 */
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", warmup_timer)
         .withParameter("period_ms", alert_0_warmup_period_ms);
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", cooldown_timer)
         .withParameter("period_ms", alert_0_cooldown_period_ms);
-    mock().expectOneCall("eas_timer_start").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", warmup_timer);
     mock()
         .expectOneCall("alert_notifier_notify")
         .withParameter("alert_id", alert_0_id)
         .withParameter("is_raised", true);
-    mock().expectOneCall("eas_timer_start").withParameter("self", cooldown_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", cooldown_timer);
     /* Expected calls from unset_alert */
-    mock().expectOneCall("eas_timer_stop").withParameter("self", cooldown_timer);
+    mock().expectOneCall("timer_wheel_timer_stop").withParameter("self", cooldown_timer);
     mock()
         .expectOneCall("alert_notifier_notify")
         .withParameter("alert_id", alert_0_id)
         .withParameter("is_raised", false);
     /* Expected calls for alert 1 */
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", warmup_timer)
         .withParameter("period_ms", alert_1_warmup_period_ms);
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", cooldown_timer)
         .withParameter("period_ms", alert_1_cooldown_period_ms);
-    mock().expectOneCall("eas_timer_start").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", warmup_timer);
     mock()
         .expectOneCall("alert_notifier_notify")
         .withParameter("alert_id", alert_1_id)
         .withParameter("is_raised", true);
-    mock().expectOneCall("eas_timer_start").withParameter("self", cooldown_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", cooldown_timer);
     mock()
         .expectOneCall("alert_notifier_notify")
         .withParameter("alert_id", alert_1_id)
@@ -672,9 +646,9 @@ TEST(AlertRaiser, CooldownTimerRunningWhenNewAlarmIsSet)
 
     /* Creates warmup and cooldown timer instances */
     AlertRaiser alert_raiser = alert_raiser_create();
-    EasTimerCb warmup_cb = timer_cbs[0];
+    TimerWheelTimerCb warmup_cb = timer_cbs[0];
     void *warmup_cb_user_data = timer_cbs_user_data[0];
-    EasTimerCb cooldown_cb = timer_cbs[1];
+    TimerWheelTimerCb cooldown_cb = timer_cbs[1];
     void *cooldown_cb_user_data = timer_cbs_user_data[1];
     /* Sets timer period */
     alert_raiser_set_alert(alert_raiser, alert_0_id, alert_0_warmup_period_ms, alert_0_cooldown_period_ms);
@@ -711,34 +685,32 @@ TEST(AlertRaiser, UnsetAlertStopsCooldownTimer)
     uint32_t alert_0_cooldown_period_ms = 430;
 
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     /* Expected calls for alert 0 */
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", warmup_timer)
         .withParameter("period_ms", alert_0_warmup_period_ms);
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", cooldown_timer)
         .withParameter("period_ms", alert_0_cooldown_period_ms);
-    mock().expectOneCall("eas_timer_start").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", warmup_timer);
     mock()
         .expectOneCall("alert_notifier_notify")
         .withParameter("alert_id", alert_0_id)
         .withParameter("is_raised", true);
-    mock().expectOneCall("eas_timer_start").withParameter("self", cooldown_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", cooldown_timer);
     /* Expected calls from unset_alert */
-    mock().expectOneCall("eas_timer_stop").withParameter("self", cooldown_timer);
+    mock().expectOneCall("timer_wheel_timer_stop").withParameter("self", cooldown_timer);
     mock()
         .expectOneCall("alert_notifier_notify")
         .withParameter("alert_id", alert_0_id)
@@ -746,9 +718,9 @@ TEST(AlertRaiser, UnsetAlertStopsCooldownTimer)
 
     /* Creates warmup and cooldown timer instances */
     AlertRaiser alert_raiser = alert_raiser_create();
-    EasTimerCb warmup_cb = timer_cbs[0];
+    TimerWheelTimerCb warmup_cb = timer_cbs[0];
     void *warmup_cb_user_data = timer_cbs_user_data[0];
-    EasTimerCb cooldown_cb = timer_cbs[1];
+    TimerWheelTimerCb cooldown_cb = timer_cbs[1];
     void *cooldown_cb_user_data = timer_cbs_user_data[1];
     /* Sets timer period */
     alert_raiser_set_alert(alert_raiser, alert_0_id, alert_0_warmup_period_ms, alert_0_cooldown_period_ms);
@@ -774,39 +746,37 @@ TEST(AlertRaiser, WarmupTimerRunningWhenAlertIsUnset)
     uint32_t alert_1_cooldown_period_ms = 98;
 
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     /* Expected calls for alert 0 */
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", warmup_timer)
         .withParameter("period_ms", alert_0_warmup_period_ms);
-    mock().expectOneCall("eas_timer_start").withParameter("self", warmup_timer);
-    mock().expectOneCall("eas_timer_stop").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_stop").withParameter("self", warmup_timer);
     /* Expected calls for alert 1 */
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", warmup_timer)
         .withParameter("period_ms", alert_1_warmup_period_ms);
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", cooldown_timer)
         .withParameter("period_ms", alert_1_cooldown_period_ms);
-    mock().expectOneCall("eas_timer_start").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", warmup_timer);
     mock()
         .expectOneCall("alert_notifier_notify")
         .withParameter("alert_id", alert_1_id)
         .withParameter("is_raised", true);
-    mock().expectOneCall("eas_timer_start").withParameter("self", cooldown_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", cooldown_timer);
     mock()
         .expectOneCall("alert_notifier_notify")
         .withParameter("alert_id", alert_1_id)
@@ -814,9 +784,9 @@ TEST(AlertRaiser, WarmupTimerRunningWhenAlertIsUnset)
 
     /* Creates warmup and cooldown timer instances */
     AlertRaiser alert_raiser = alert_raiser_create();
-    EasTimerCb warmup_cb = timer_cbs[0];
+    TimerWheelTimerCb warmup_cb = timer_cbs[0];
     void *warmup_cb_user_data = timer_cbs_user_data[0];
-    EasTimerCb cooldown_cb = timer_cbs[1];
+    TimerWheelTimerCb cooldown_cb = timer_cbs[1];
     void *cooldown_cb_user_data = timer_cbs_user_data[1];
     /* Sets timer period */
     alert_raiser_set_alert(alert_raiser, alert_0_id, alert_0_warmup_period_ms, alert_0_cooldown_period_ms);
@@ -848,29 +818,27 @@ TEST(AlertRaiser, UnsetAlertStopsWarmupTimer)
     uint32_t alert_0_cooldown_period_ms = 0;
 
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", warmup_timer)
         .withParameter("period_ms", alert_0_warmup_period_ms);
-    mock().expectOneCall("eas_timer_start").withParameter("self", warmup_timer);
-    mock().expectOneCall("eas_timer_stop").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_start").withParameter("self", warmup_timer);
+    mock().expectOneCall("timer_wheel_timer_stop").withParameter("self", warmup_timer);
 
     /* Creates warmup and cooldown timer instances */
     AlertRaiser alert_raiser = alert_raiser_create();
-    EasTimerCb warmup_cb = timer_cbs[0];
+    TimerWheelTimerCb warmup_cb = timer_cbs[0];
     void *warmup_cb_user_data = timer_cbs_user_data[0];
-    EasTimerCb cooldown_cb = timer_cbs[1];
+    TimerWheelTimerCb cooldown_cb = timer_cbs[1];
     void *cooldown_cb_user_data = timer_cbs_user_data[1];
     /* Sets timer period */
     alert_raiser_set_alert(alert_raiser, alert_0_id, alert_0_warmup_period_ms, alert_0_cooldown_period_ms);
@@ -883,13 +851,12 @@ TEST(AlertRaiser, UnsetAlertStopsWarmupTimer)
 TEST(AlertRaiser, SetAlertConditionAssertsIfCalledBeforeSetAlert)
 {
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
@@ -901,27 +868,25 @@ TEST(AlertRaiser, SetAlertConditionAssertsIfCalledBeforeSetAlert)
 
 TEST(AlertRaiser, AlertIsInitiallySilenced)
 {
-    uint8_t alert_id = 12;
+    uint16_t alert_id = 12;
     uint32_t warmup_period_ms = 13;
     uint32_t cooldown_period_ms = 14;
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", warmup_timer)
         .withParameter("period_ms", warmup_period_ms);
     mock()
-        .expectOneCall("eas_timer_set_period")
+        .expectOneCall("timer_wheel_timer_set_period")
         .withParameter("self", cooldown_timer)
         .withParameter("period_ms", cooldown_period_ms);
 
@@ -936,15 +901,13 @@ TEST(AlertRaiser, AlertIsInitiallySilenced)
 TEST(AlertRaiser, IsAlertSetIsInitiallyFalse)
 {
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
 
@@ -955,20 +918,18 @@ TEST(AlertRaiser, IsAlertSetIsInitiallyFalse)
 
 TEST(AlertRaiser, IsAlertSetTrueAfterAlertIsSet)
 {
-    uint8_t alert_id = 0;
+    uint16_t alert_id = 0;
     uint32_t warmup_period_ms = 0;
     uint32_t cooldown_period_ms = 0;
     /* alert_raiser_create */
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
 
@@ -980,20 +941,18 @@ TEST(AlertRaiser, IsAlertSetTrueAfterAlertIsSet)
 
 TEST(AlertRaiser, IsAlertSetFalseAfterAlertIsSetAndUnset)
 {
-    uint8_t alert_id = 0;
+    uint16_t alert_id = 0;
     uint32_t warmup_period_ms = 0;
     uint32_t cooldown_period_ms = 0;
     /* alert_raiser_create */
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
 
@@ -1009,20 +968,18 @@ TEST(AlertRaiser, IsAlertSetFalseAfterAlertIsSetAndUnset)
 
 TEST(AlertRaiser, UnsetAlertHasNoEffectWhenAlertIsNotSet)
 {
-    uint8_t alert_id = 5;
+    uint16_t alert_id = 5;
     uint32_t warmup_period_ms = 0;
     uint32_t cooldown_period_ms = 0;
     /* alert_raiser_create */
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
 
@@ -1058,15 +1015,13 @@ TEST(AlertRaiser, SetAlertAssertsIfUnsetIsNotCalled)
     uint32_t alert_1_cooldown_period_ms = 0;
     /* alert_raiser_create */
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("!self->is_alert_set", "alert_raiser_set_alert");
@@ -1078,20 +1033,18 @@ TEST(AlertRaiser, SetAlertAssertsIfUnsetIsNotCalled)
 
 TEST(AlertRaiser, SetAlertAssertsIfInstanceNull)
 {
-    uint8_t alert_id = 0;
+    uint16_t alert_id = 0;
     uint32_t warmup_period_ms = 132;
     uint32_t cooldown_period_ms = 267;
 
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self", "alert_raiser_set_alert");
@@ -1102,20 +1055,18 @@ TEST(AlertRaiser, SetAlertAssertsIfInstanceNull)
 
 TEST(AlertRaiser, UnsetAlertAssertsIfInstanceNull)
 {
-    uint8_t alert_id = 6;
+    uint16_t alert_id = 6;
     uint32_t warmup_period_ms = 0;
     uint32_t cooldown_period_ms = 0;
 
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self", "alert_raiser_unset_alert");
@@ -1127,20 +1078,18 @@ TEST(AlertRaiser, UnsetAlertAssertsIfInstanceNull)
 
 TEST(AlertRaiser, IsAlertSetAssertsIfInstanceNull)
 {
-    uint8_t alert_id = 9;
+    uint16_t alert_id = 9;
     uint32_t warmup_period_ms = 0;
     uint32_t cooldown_period_ms = 0;
 
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self", "alert_raiser_is_alert_set");
@@ -1151,19 +1100,17 @@ TEST(AlertRaiser, IsAlertSetAssertsIfInstanceNull)
 
 TEST(AlertRaiser, SetAlertConditionResultAssertsIfInstanceNull)
 {
-    uint8_t alert_id = 57;
+    uint16_t alert_id = 57;
     uint32_t warmup_period_ms = 0;
     uint32_t cooldown_period_ms = 0;
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(warmup_timer);
     mock()
-        .expectOneCall("eas_timer_create")
+        .expectOneCall("timer_wheel_timer_create")
         .withParameter("period_ms", 0)
-        .withParameter("periodic", false)
         .ignoreOtherParameters()
         .andReturnValue(cooldown_timer);
     TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self", "alert_raiser_set_alert_condition_result");
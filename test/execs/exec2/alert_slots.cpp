@@ -0,0 +1,130 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTestExt/TestAssertPlugin.h"
+
+#include "alert_slots.h"
+#include "config.h"
+
+// clang-format off
+TEST_GROUP(AlertSlots)
+{
+    void setup()
+    {
+        alert_slots_reset();
+    }
+};
+// clang-format on
+
+TEST(AlertSlots, NoSlotsInitially)
+{
+    CHECK_EQUAL(ALERT_SLOTS_NO_SLOT, alert_slots_get_slot(0));
+    CHECK_EQUAL(ALERT_SLOTS_NO_SLOT, alert_slots_get_slot(UINT16_MAX));
+    CHECK_EQUAL(0, alert_slots_get_num_alert_ids());
+}
+
+TEST(AlertSlots, SlotsAssignedInAscendingOrder)
+{
+    CHECK_TRUE(alert_slots_add(1000));
+    CHECK_TRUE(alert_slots_add(7));
+    CHECK_TRUE(alert_slots_add(UINT16_MAX));
+
+    CHECK_EQUAL(0, alert_slots_get_slot(1000));
+    CHECK_EQUAL(1, alert_slots_get_slot(7));
+    CHECK_EQUAL(2, alert_slots_get_slot(UINT16_MAX));
+    /* Alert ids next to the added ones have no slot */
+    CHECK_EQUAL(ALERT_SLOTS_NO_SLOT, alert_slots_get_slot(999));
+    CHECK_EQUAL(ALERT_SLOTS_NO_SLOT, alert_slots_get_slot(1001));
+    CHECK_EQUAL(ALERT_SLOTS_NO_SLOT, alert_slots_get_slot(8));
+}
+
+TEST(AlertSlots, AddReturnsFalseIfAllSlotsOccupied)
+{
+    for (size_t i = 0; i < CONFIG_ALERT_SLOTS_NUM_SLOTS; i++) {
+        CHECK_TRUE(alert_slots_add((uint16_t)(i * 100)));
+    }
+
+    CHECK_FALSE(alert_slots_add(1));
+    CHECK_EQUAL(ALERT_SLOTS_NO_SLOT, alert_slots_get_slot(1));
+    CHECK_EQUAL(CONFIG_ALERT_SLOTS_NUM_SLOTS, alert_slots_get_num_alert_ids());
+}
+
+TEST(AlertSlots, RemovedSlotIsReused)
+{
+    alert_slots_add(5);
+    alert_slots_add(6);
+    alert_slots_add(7);
+
+    alert_slots_remove(6);
+    CHECK_EQUAL(ALERT_SLOTS_NO_SLOT, alert_slots_get_slot(6));
+    /* Slots of the other alert ids do not change */
+    CHECK_EQUAL(0, alert_slots_get_slot(5));
+    CHECK_EQUAL(2, alert_slots_get_slot(7));
+
+    alert_slots_add(60000);
+    CHECK_EQUAL(1, alert_slots_get_slot(60000));
+}
+
+TEST(AlertSlots, SlotsCanBeReusedAfterAllSlotsOccupied)
+{
+    for (size_t i = 0; i < CONFIG_ALERT_SLOTS_NUM_SLOTS; i++) {
+        alert_slots_add((uint16_t)i);
+    }
+    alert_slots_remove(3);
+
+    CHECK_TRUE(alert_slots_add(3000));
+    CHECK_EQUAL(3, alert_slots_get_slot(3000));
+}
+
+TEST(AlertSlots, GetAlertIdReturnsAlertIdsInAscendingOrder)
+{
+    alert_slots_add(300);
+    alert_slots_add(2);
+    alert_slots_add(40);
+    alert_slots_add(1);
+    alert_slots_remove(40);
+
+    CHECK_EQUAL(3, alert_slots_get_num_alert_ids());
+    CHECK_EQUAL(1, alert_slots_get_alert_id(0));
+    CHECK_EQUAL(2, alert_slots_get_alert_id(1));
+    CHECK_EQUAL(300, alert_slots_get_alert_id(2));
+}
+
+TEST(AlertSlots, ResetRemovesAllAlertIds)
+{
+    alert_slots_add(10);
+    alert_slots_add(20);
+
+    alert_slots_reset();
+
+    CHECK_EQUAL(0, alert_slots_get_num_alert_ids());
+    CHECK_EQUAL(ALERT_SLOTS_NO_SLOT, alert_slots_get_slot(10));
+    /* Slots are assigned starting from 0 again */
+    alert_slots_add(20);
+    CHECK_EQUAL(0, alert_slots_get_slot(20));
+}
+
+TEST(AlertSlots, AddAssertsIfAlertIdAlreadyHasSlot)
+{
+    alert_slots_add(10);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("!has_slot", "alert_slots_add");
+    alert_slots_add(10);
+}
+
+TEST(AlertSlots, RemoveAssertsIfAlertIdHasNoSlot)
+{
+    alert_slots_add(10);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("has_slot", "alert_slots_remove");
+    alert_slots_remove(11);
+}
+
+TEST(AlertSlots, GetAlertIdAssertsIfInvalidIdx)
+{
+    alert_slots_add(10);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("idx < num_alert_ids", "alert_slots_get_alert_id");
+    alert_slots_get_alert_id(1);
+}
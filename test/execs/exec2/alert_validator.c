@@ -20,6 +20,8 @@ static void populate_valid_variable_requirement(MsgTransceiverVariableRequiremen
     requirement->operator = MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_GEQ;
     requirement->constraint_value.temperature = 200; // 20.0 degrees Celsius
     requirement->is_last_in_ored_requirement = true;
+    requirement->num_begun_expressions = 0;
+    requirement->num_ended_expressions = 0;
 }
 
 /**
@@ -210,7 +212,7 @@ TEST_C(AlertValidator, InvalidAlertIdInvalid)
 {
     MsgTransceiverAlert alert;
     populate_valid_alert(&alert);
-    uint8_t invalid_alert_id = CONFIG_ALERT_VALIDATOR_MAX_ALLOWED_ALERT_ID + 1;
+    uint16_t invalid_alert_id = CONFIG_ALERT_VALIDATOR_MAX_ALLOWED_ALERT_ID + 1;
     alert.alert_id = invalid_alert_id;
     bool is_valid_alert = alert_validator_is_alert_valid(&alert);
     CHECK_C(!is_valid_alert);
@@ -536,8 +538,221 @@ TEST_C(AlertValidator, HumidityConstraintValueAboveAllowedRangeThirdRequirement)
     CHECK_C(!is_valid_alert);
 }
 
+TEST_C(AlertValidator, RequirementOperatorInsideValid)
+{
+    MsgTransceiverAlert alert;
+    populate_valid_alert(&alert);
+    alert.alert_condition.variable_requirements[0].variable_identifier =
+        MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_TEMPERATURE;
+    alert.alert_condition.variable_requirements[0].operator = MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_INSIDE;
+    alert.alert_condition.variable_requirements[0].constraint_value.temperature = -100;
+    alert.alert_condition.variable_requirements[0].upper_constraint_value.temperature = 300;
+
+    bool is_valid_alert = alert_validator_is_alert_valid(&alert);
+    CHECK_C(is_valid_alert);
+}
+
+TEST_C(AlertValidator, RequirementOperatorOutsideValid)
+{
+    MsgTransceiverAlert alert;
+    populate_valid_alert(&alert);
+    alert.alert_condition.variable_requirements[0].variable_identifier =
+        MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_TEMPERATURE;
+    alert.alert_condition.variable_requirements[0].operator = MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_OUTSIDE;
+    alert.alert_condition.variable_requirements[0].constraint_value.temperature = -100;
+    alert.alert_condition.variable_requirements[0].upper_constraint_value.temperature = 300;
+
+    bool is_valid_alert = alert_validator_is_alert_valid(&alert);
+    CHECK_C(is_valid_alert);
+}
+
+TEST_C(AlertValidator, BandUpperConstraintValueAboveAllowedRange)
+{
+    MsgTransceiverAlert alert;
+    populate_valid_alert(&alert);
+    alert.alert_condition.variable_requirements[0].variable_identifier = MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_PRESSURE;
+    alert.alert_condition.variable_requirements[0].operator = MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_INSIDE;
+    alert.alert_condition.variable_requirements[0].constraint_value.pressure = 9800;
+    alert.alert_condition.variable_requirements[0].upper_constraint_value.pressure = 15001;
+
+    bool is_valid_alert = alert_validator_is_alert_valid(&alert);
+    CHECK_C(!is_valid_alert);
+}
+
+TEST_C(AlertValidator, BandUpperConstraintValueEqualToLowerConstraintValue)
+{
+    MsgTransceiverAlert alert;
+    populate_valid_alert(&alert);
+    alert.alert_condition.variable_requirements[0].variable_identifier = MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_HUMIDITY;
+    alert.alert_condition.variable_requirements[0].operator = MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_OUTSIDE;
+    alert.alert_condition.variable_requirements[0].constraint_value.humidity = 500;
+    alert.alert_condition.variable_requirements[0].upper_constraint_value.humidity = 500;
+
+    bool is_valid_alert = alert_validator_is_alert_valid(&alert);
+    CHECK_C(!is_valid_alert);
+}
+
+TEST_C(AlertValidator, BandUpperConstraintValueBelowLowerConstraintValue)
+{
+    MsgTransceiverAlert alert;
+    populate_valid_alert(&alert);
+    alert.alert_condition.variable_requirements[0].variable_identifier =
+        MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_LIGHT_INTENSITY;
+    alert.alert_condition.variable_requirements[0].operator = MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_INSIDE;
+    alert.alert_condition.variable_requirements[0].constraint_value.light_intensity = 1000;
+    alert.alert_condition.variable_requirements[0].upper_constraint_value.light_intensity = 999;
+
+    bool is_valid_alert = alert_validator_is_alert_valid(&alert);
+    CHECK_C(!is_valid_alert);
+}
+
+TEST_C(AlertValidator, ExpressionsValid)
+{
+    MsgTransceiverAlert alert;
+    populate_valid_alert(&alert);
+    add_valid_variable_requirement(&(alert.alert_condition));
+    add_valid_variable_requirement(&(alert.alert_condition));
+    MsgTransceiverVariableRequirement *requirements = alert.alert_condition.variable_requirements;
+    /* (req0 AND (NOT req1) AND req2) */
+    requirements[0].is_last_in_ored_requirement = false;
+    requirements[0].num_begun_expressions = 1;
+    requirements[0].begun_expression_operators[0] = MSG_TRANSCEIVER_EXPRESSION_OPERATOR_AND;
+    requirements[1].is_last_in_ored_requirement = false;
+    requirements[1].num_begun_expressions = 1;
+    requirements[1].begun_expression_operators[0] = MSG_TRANSCEIVER_EXPRESSION_OPERATOR_NOT;
+    requirements[1].num_ended_expressions = 1;
+    requirements[2].num_ended_expressions = 1;
+
+    bool is_valid_alert = alert_validator_is_alert_valid(&alert);
+    CHECK_C(is_valid_alert);
+}
+
+TEST_C(AlertValidator, ExpressionInvalidOperator)
+{
+    MsgTransceiverAlert alert;
+    populate_valid_alert(&alert);
+    MsgTransceiverVariableRequirement *requirement = &(alert.alert_condition.variable_requirements[0]);
+    requirement->num_begun_expressions = 1;
+    requirement->begun_expression_operators[0] = 3;
+    requirement->num_ended_expressions = 1;
+
+    bool is_valid_alert = alert_validator_is_alert_valid(&alert);
+    CHECK_C(!is_valid_alert);
+}
+
+TEST_C(AlertValidator, ExpressionMaxDepthExceeded)
+{
+    MsgTransceiverAlert alert;
+    populate_valid_alert(&alert);
+    add_valid_variable_requirement(&(alert.alert_condition));
+    MsgTransceiverVariableRequirement *requirements = alert.alert_condition.variable_requirements;
+    /* One expression begins with the first requirement, and the maximum number of expressions with the second one */
+    requirements[0].is_last_in_ored_requirement = false;
+    requirements[0].num_begun_expressions = 1;
+    requirements[0].begun_expression_operators[0] = MSG_TRANSCEIVER_EXPRESSION_OPERATOR_OR;
+    requirements[1].num_begun_expressions = CONFIG_MSG_TRANSCEIVER_MAX_EXPRESSION_DEPTH;
+    for (size_t i = 0; i < CONFIG_MSG_TRANSCEIVER_MAX_EXPRESSION_DEPTH; i++) {
+        requirements[1].begun_expression_operators[i] = MSG_TRANSCEIVER_EXPRESSION_OPERATOR_OR;
+    }
+    requirements[1].num_ended_expressions = CONFIG_MSG_TRANSCEIVER_MAX_EXPRESSION_DEPTH + 1;
+
+    bool is_valid_alert = alert_validator_is_alert_valid(&alert);
+    CHECK_C(!is_valid_alert);
+}
+
+TEST_C(AlertValidator, ExpressionNotWithTwoOperands)
+{
+    MsgTransceiverAlert alert;
+    populate_valid_alert(&alert);
+    add_valid_variable_requirement(&(alert.alert_condition));
+    MsgTransceiverVariableRequirement *requirements = alert.alert_condition.variable_requirements;
+    requirements[0].is_last_in_ored_requirement = false;
+    requirements[0].num_begun_expressions = 1;
+    requirements[0].begun_expression_operators[0] = MSG_TRANSCEIVER_EXPRESSION_OPERATOR_NOT;
+    requirements[1].num_ended_expressions = 1;
+
+    bool is_valid_alert = alert_validator_is_alert_valid(&alert);
+    CHECK_C(!is_valid_alert);
+}
+
+TEST_C(AlertValidator, ExpressionEndsInNextOredRequirement)
+{
+    MsgTransceiverAlert alert;
+    populate_valid_alert(&alert);
+    add_valid_variable_requirement(&(alert.alert_condition));
+    MsgTransceiverVariableRequirement *requirements = alert.alert_condition.variable_requirements;
+    /* The first requirement is the last one in its ORed requirement */
+    requirements[0].num_begun_expressions = 1;
+    requirements[0].begun_expression_operators[0] = MSG_TRANSCEIVER_EXPRESSION_OPERATOR_AND;
+    requirements[1].num_ended_expressions = 1;
+
+    bool is_valid_alert = alert_validator_is_alert_valid(&alert);
+    CHECK_C(!is_valid_alert);
+}
+
+TEST_C(AlertValidator, ExpressionEndedWithoutBeginning)
+{
+    MsgTransceiverAlert alert;
+    populate_valid_alert(&alert);
+    alert.alert_condition.variable_requirements[0].num_ended_expressions = 1;
+
+    bool is_valid_alert = alert_validator_is_alert_valid(&alert);
+    CHECK_C(!is_valid_alert);
+}
+
 TEST_C(AlertValidator, isAlertValidRaisesAssertAlertNull)
 {
     TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("alert", "alert_validator_is_alert_valid");
     bool is_valid_alert = alert_validator_is_alert_valid(NULL);
 }
+
+TEST_C(AlertValidator, AreAlertsValidEmptySetValid)
+{
+    bool are_valid_alerts = alert_validator_are_alerts_valid(NULL, 0);
+    CHECK_C(are_valid_alerts);
+}
+
+TEST_C(AlertValidator, AreAlertsValidAllAlertsValid)
+{
+    MsgTransceiverAlert alerts[3];
+    for (uint8_t i = 0; i < 3; i++) {
+        populate_valid_alert(&alerts[i]);
+        alerts[i].alert_id = i;
+    }
+
+    bool are_valid_alerts = alert_validator_are_alerts_valid(alerts, 3);
+    CHECK_C(are_valid_alerts);
+}
+
+TEST_C(AlertValidator, AreAlertsValidOneAlertInvalid)
+{
+    MsgTransceiverAlert alerts[3];
+    for (uint8_t i = 0; i < 3; i++) {
+        populate_valid_alert(&alerts[i]);
+        alerts[i].alert_id = i;
+    }
+    alerts[2].led_color = 0xFF;
+
+    bool are_valid_alerts = alert_validator_are_alerts_valid(alerts, 3);
+    CHECK_C(!are_valid_alerts);
+}
+
+TEST_C(AlertValidator, AreAlertsValidDuplicateAlertIdInvalid)
+{
+    MsgTransceiverAlert alerts[3];
+    for (uint8_t i = 0; i < 3; i++) {
+        populate_valid_alert(&alerts[i]);
+    }
+    alerts[0].alert_id = 4;
+    alerts[1].alert_id = 1;
+    alerts[2].alert_id = 4;
+
+    bool are_valid_alerts = alert_validator_are_alerts_valid(alerts, 3);
+    CHECK_C(!are_valid_alerts);
+}
+
+TEST_C(AlertValidator, AreAlertsValidRaisesAssertAlertsNull)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("alerts || (num_alerts == 0)", "alert_validator_are_alerts_valid");
+    bool are_valid_alerts = alert_validator_are_alerts_valid(NULL, 2);
+}
@@ -47,4 +47,20 @@ TEST_C_WRAPPER(AlertValidator, LightIntensityConstraintValueWithinAllowedRange1)
 TEST_C_WRAPPER(AlertValidator, LightIntensityConstraintValueWithinAllowedRange2);
 TEST_C_WRAPPER(AlertValidator, LightIntensityConstraintValueWithinAllowedRange3);
 TEST_C_WRAPPER(AlertValidator, HumidityConstraintValueAboveAllowedRangeThirdRequirement);
+TEST_C_WRAPPER(AlertValidator, RequirementOperatorInsideValid);
+TEST_C_WRAPPER(AlertValidator, RequirementOperatorOutsideValid);
+TEST_C_WRAPPER(AlertValidator, BandUpperConstraintValueAboveAllowedRange);
+TEST_C_WRAPPER(AlertValidator, BandUpperConstraintValueEqualToLowerConstraintValue);
+TEST_C_WRAPPER(AlertValidator, BandUpperConstraintValueBelowLowerConstraintValue);
+TEST_C_WRAPPER(AlertValidator, ExpressionsValid);
+TEST_C_WRAPPER(AlertValidator, ExpressionInvalidOperator);
+TEST_C_WRAPPER(AlertValidator, ExpressionMaxDepthExceeded);
+TEST_C_WRAPPER(AlertValidator, ExpressionNotWithTwoOperands);
+TEST_C_WRAPPER(AlertValidator, ExpressionEndsInNextOredRequirement);
+TEST_C_WRAPPER(AlertValidator, ExpressionEndedWithoutBeginning);
 TEST_C_WRAPPER(AlertValidator, isAlertValidRaisesAssertAlertNull);
+TEST_C_WRAPPER(AlertValidator, AreAlertsValidEmptySetValid);
+TEST_C_WRAPPER(AlertValidator, AreAlertsValidAllAlertsValid);
+TEST_C_WRAPPER(AlertValidator, AreAlertsValidOneAlertInvalid);
+TEST_C_WRAPPER(AlertValidator, AreAlertsValidDuplicateAlertIdInvalid);
+TEST_C_WRAPPER(AlertValidator, AreAlertsValidRaisesAssertAlertsNull);
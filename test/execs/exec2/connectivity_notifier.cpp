@@ -4,10 +4,23 @@
 #include "CppUTestExt/TestAssertPlugin.h"
 
 #include "connectivity_notifier.h"
+#include "alert_slots.h"
 #include "config.h"
 #include "eas_assert.h"
 
-TEST_GROUP(ConnectivityNotifier){};
+// clang-format off
+TEST_GROUP(ConnectivityNotifier)
+{
+    void setup()
+    {
+        /* Slots are assigned in ascending order, so alert id i gets slot i */
+        alert_slots_reset();
+        for (size_t i = 0; i < CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS; i++) {
+            alert_slots_add(i);
+        }
+    }
+};
+// clang-format on
 
 /* This test is always the first test to be executed out of a group, so that we can test that initially all
  * notifications are disabled - connectivity_notification_sender function is not called for any alert ids. */
@@ -22,7 +35,7 @@ TEST_ORDERED(ConnectivityNotifier, AllNotificationsInitiallyDisabled, 0)
 
 TEST_ORDERED(ConnectivityNotifier, EnabledNotificationCallsSenderId0, 1)
 {
-    uint8_t alert_id = 0;
+    uint16_t alert_id = 0;
     EAS_ASSERT(alert_id < CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS);
 
     mock()
@@ -40,7 +53,7 @@ TEST_ORDERED(ConnectivityNotifier, EnabledNotificationCallsSenderId0, 1)
 
 TEST_ORDERED(ConnectivityNotifier, EnabledNotificationCallsSenderId1, 1)
 {
-    uint8_t alert_id = 1;
+    uint16_t alert_id = 1;
     EAS_ASSERT(alert_id < CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS);
 
     mock()
@@ -58,7 +71,7 @@ TEST_ORDERED(ConnectivityNotifier, EnabledNotificationCallsSenderId1, 1)
 
 TEST_ORDERED(ConnectivityNotifier, DisabledNotificationDoesNotCallSender, 1)
 {
-    uint8_t alert_id = 2;
+    uint16_t alert_id = 2;
     EAS_ASSERT(alert_id < CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS);
 
     /* This should not call connectivity_notification_sender_send, since notifications are disabled */
@@ -67,7 +80,7 @@ TEST_ORDERED(ConnectivityNotifier, DisabledNotificationDoesNotCallSender, 1)
 
 TEST_ORDERED(ConnectivityNotifier, DisablePreviouslyEnabledNotificationDoesNotCallSender, 1)
 {
-    uint8_t alert_id = 1;
+    uint16_t alert_id = 1;
     EAS_ASSERT(alert_id < CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS);
 
     connectivity_notifier_enable_notifications(alert_id);
@@ -79,7 +92,7 @@ TEST_ORDERED(ConnectivityNotifier, DisablePreviouslyEnabledNotificationDoesNotCa
 
 TEST_ORDERED(ConnectivityNotifier, IsRaisedTruePropagated, 1)
 {
-    uint8_t alert_id = 0;
+    uint16_t alert_id = 0;
     bool is_raised = true;
     EAS_ASSERT(alert_id < CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS);
     mock()
@@ -96,7 +109,7 @@ TEST_ORDERED(ConnectivityNotifier, IsRaisedTruePropagated, 1)
 
 TEST_ORDERED(ConnectivityNotifier, IsRaisedFalsePropagated, 1)
 {
-    uint8_t alert_id = 0;
+    uint16_t alert_id = 0;
     bool is_raised = false;
     EAS_ASSERT(alert_id < CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS);
     mock()
@@ -113,24 +126,24 @@ TEST_ORDERED(ConnectivityNotifier, IsRaisedFalsePropagated, 1)
 
 TEST_ORDERED(ConnectivityNotifier, EnableNotificationAssertsIfAlertIdInvalid, 1)
 {
-    uint8_t alert_id = CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS;
-    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_alert_id(alert_id)", "connectivity_notifier_enable_notifications");
+    uint16_t alert_id = CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS;
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_alert_id", "get_slot");
 
     connectivity_notifier_enable_notifications(alert_id);
 }
 
 TEST_ORDERED(ConnectivityNotifier, DisableNotificationAssertsIfAlertIdInvalid, 1)
 {
-    uint8_t alert_id = CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS;
-    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_alert_id(alert_id)", "connectivity_notifier_disable_notifications");
+    uint16_t alert_id = CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS;
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_alert_id", "get_slot");
 
     connectivity_notifier_disable_notifications(alert_id);
 }
 
 TEST_ORDERED(ConnectivityNotifier, NotifyAssertsIfAlertIdInvalid, 1)
 {
-    uint8_t alert_id = CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS;
-    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_alert_id(alert_id)", "connectivity_notifier_notify");
+    uint16_t alert_id = CONFIG_CONNECTIVITY_NOTIFIER_MAX_NUM_ALERTS;
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_alert_id", "get_slot");
 
     connectivity_notifier_notify(alert_id, true);
 }
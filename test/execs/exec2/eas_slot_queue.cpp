@@ -0,0 +1,200 @@
+#include <string.h>
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTestExt/TestAssertPlugin.h"
+
+#include "osal/eas_slot_queue.h"
+#include "config.h"
+#include "eas_assert.h"
+
+/* These tests cover the host implementation of the slot queue. Only non-blocking scenarios are tested:
+ * eas_slot_queue_get is only called when the oldest reserved slot is already committed. */
+
+#define TEST_EAS_SLOT_QUEUE_SLOT_SIZE 8
+
+static uint8_t buf[TEST_EAS_SLOT_QUEUE_SLOT_SIZE * CONFIG_EAS_SLOT_QUEUE_MAX_NUM_SLOTS];
+
+static uint8_t *get_expected_slot(size_t slot_idx)
+{
+    return &buf[slot_idx * TEST_EAS_SLOT_QUEUE_SLOT_SIZE];
+}
+
+TEST_GROUP(EasSlotQueue)
+{
+    void setup()
+    {
+        memset(buf, 0, sizeof(buf));
+    }
+};
+
+TEST(EasSlotQueue, ReserveReturnsSlotsInBufferOrder)
+{
+    EasSlotQueue queue = eas_slot_queue_create(buf, TEST_EAS_SLOT_QUEUE_SLOT_SIZE, 3);
+
+    POINTERS_EQUAL(get_expected_slot(0), eas_slot_queue_reserve(queue));
+    POINTERS_EQUAL(get_expected_slot(1), eas_slot_queue_reserve(queue));
+    POINTERS_EQUAL(get_expected_slot(2), eas_slot_queue_reserve(queue));
+}
+
+TEST(EasSlotQueue, ReserveReturnsNullIfAllSlotsReserved)
+{
+    EasSlotQueue queue = eas_slot_queue_create(buf, TEST_EAS_SLOT_QUEUE_SLOT_SIZE, 2);
+
+    CHECK(eas_slot_queue_reserve(queue) != NULL);
+    CHECK(eas_slot_queue_reserve(queue) != NULL);
+    POINTERS_EQUAL(NULL, eas_slot_queue_reserve(queue));
+}
+
+TEST(EasSlotQueue, GetReturnsCommittedSlotWithMessage)
+{
+    EasSlotQueue queue = eas_slot_queue_create(buf, TEST_EAS_SLOT_QUEUE_SLOT_SIZE, 2);
+
+    uint8_t *slot = (uint8_t *)eas_slot_queue_reserve(queue);
+    slot[0] = 0x12;
+    slot[7] = 0x34;
+    eas_slot_queue_commit(queue, slot);
+
+    uint8_t *received_slot = (uint8_t *)eas_slot_queue_get(queue);
+    POINTERS_EQUAL(slot, received_slot);
+    BYTES_EQUAL(0x12, received_slot[0]);
+    BYTES_EQUAL(0x34, received_slot[7]);
+}
+
+TEST(EasSlotQueue, GetReturnsSameSlotUntilReleased)
+{
+    EasSlotQueue queue = eas_slot_queue_create(buf, TEST_EAS_SLOT_QUEUE_SLOT_SIZE, 2);
+    void *slot_0 = eas_slot_queue_reserve(queue);
+    void *slot_1 = eas_slot_queue_reserve(queue);
+    eas_slot_queue_commit(queue, slot_0);
+    eas_slot_queue_commit(queue, slot_1);
+
+    POINTERS_EQUAL(slot_0, eas_slot_queue_get(queue));
+    POINTERS_EQUAL(slot_0, eas_slot_queue_get(queue));
+    eas_slot_queue_release(queue);
+    POINTERS_EQUAL(slot_1, eas_slot_queue_get(queue));
+}
+
+TEST(EasSlotQueue, SlotsReceivedInReservationOrderWhenCommittedOutOfOrder)
+{
+    EasSlotQueue queue = eas_slot_queue_create(buf, TEST_EAS_SLOT_QUEUE_SLOT_SIZE, 3);
+    void *slot_0 = eas_slot_queue_reserve(queue);
+    void *slot_1 = eas_slot_queue_reserve(queue);
+    void *slot_2 = eas_slot_queue_reserve(queue);
+
+    eas_slot_queue_commit(queue, slot_2);
+    eas_slot_queue_commit(queue, slot_1);
+    eas_slot_queue_commit(queue, slot_0);
+
+    POINTERS_EQUAL(slot_0, eas_slot_queue_get(queue));
+    eas_slot_queue_release(queue);
+    POINTERS_EQUAL(slot_1, eas_slot_queue_get(queue));
+    eas_slot_queue_release(queue);
+    POINTERS_EQUAL(slot_2, eas_slot_queue_get(queue));
+    eas_slot_queue_release(queue);
+}
+
+TEST(EasSlotQueue, ReleasedSlotCanBeReservedAgain)
+{
+    EasSlotQueue queue = eas_slot_queue_create(buf, TEST_EAS_SLOT_QUEUE_SLOT_SIZE, 2);
+    void *slot_0 = eas_slot_queue_reserve(queue);
+    void *slot_1 = eas_slot_queue_reserve(queue);
+    eas_slot_queue_commit(queue, slot_0);
+    /* All slots are reserved */
+    POINTERS_EQUAL(NULL, eas_slot_queue_reserve(queue));
+
+    eas_slot_queue_get(queue);
+    eas_slot_queue_release(queue);
+
+    /* Wraps around to the first slot */
+    POINTERS_EQUAL(slot_0, eas_slot_queue_reserve(queue));
+    POINTERS_EQUAL(NULL, eas_slot_queue_reserve(queue));
+}
+
+TEST(EasSlotQueue, ManyMessagesWrapAround)
+{
+    EasSlotQueue queue = eas_slot_queue_create(buf, TEST_EAS_SLOT_QUEUE_SLOT_SIZE, 3);
+
+    for (uint8_t i = 0; i < 20; i++) {
+        uint8_t *slot = (uint8_t *)eas_slot_queue_reserve(queue);
+        POINTERS_EQUAL(get_expected_slot(i % 3), slot);
+        slot[0] = i;
+        eas_slot_queue_commit(queue, slot);
+
+        uint8_t *received_slot = (uint8_t *)eas_slot_queue_get(queue);
+        BYTES_EQUAL(i, received_slot[0]);
+        eas_slot_queue_release(queue);
+    }
+}
+
+TEST(EasSlotQueue, HighWatermarkIs0AfterCreate)
+{
+    EasSlotQueue queue = eas_slot_queue_create(buf, TEST_EAS_SLOT_QUEUE_SLOT_SIZE, 3);
+
+    LONGS_EQUAL(0, eas_slot_queue_get_high_watermark(queue));
+}
+
+TEST(EasSlotQueue, HighWatermarkIsMaxNumOccupiedSlots)
+{
+    EasSlotQueue queue = eas_slot_queue_create(buf, TEST_EAS_SLOT_QUEUE_SLOT_SIZE, 3);
+    void *slot_0 = eas_slot_queue_reserve(queue);
+    void *slot_1 = eas_slot_queue_reserve(queue);
+    eas_slot_queue_commit(queue, slot_0);
+    eas_slot_queue_commit(queue, slot_1);
+    LONGS_EQUAL(2, eas_slot_queue_get_high_watermark(queue));
+
+    /* Releasing slots does not lower the high-watermark */
+    eas_slot_queue_get(queue);
+    eas_slot_queue_release(queue);
+    eas_slot_queue_get(queue);
+    eas_slot_queue_release(queue);
+    LONGS_EQUAL(2, eas_slot_queue_get_high_watermark(queue));
+
+    /* Reserving when the queue is empty again does not raise it either */
+    eas_slot_queue_reserve(queue);
+    LONGS_EQUAL(2, eas_slot_queue_get_high_watermark(queue));
+    eas_slot_queue_reserve(queue);
+    eas_slot_queue_reserve(queue);
+    LONGS_EQUAL(3, eas_slot_queue_get_high_watermark(queue));
+
+    /* Failed reservation is not counted */
+    POINTERS_EQUAL(NULL, eas_slot_queue_reserve(queue));
+    LONGS_EQUAL(3, eas_slot_queue_get_high_watermark(queue));
+}
+
+TEST(EasSlotQueue, CreateAssertsIfNumSlots0)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_num_slots(num_slots)", "eas_slot_queue_create");
+    eas_slot_queue_create(buf, TEST_EAS_SLOT_QUEUE_SLOT_SIZE, 0);
+}
+
+TEST(EasSlotQueue, CreateAssertsIfTooManySlots)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_num_slots(num_slots)", "eas_slot_queue_create");
+    eas_slot_queue_create(buf, TEST_EAS_SLOT_QUEUE_SLOT_SIZE, CONFIG_EAS_SLOT_QUEUE_MAX_NUM_SLOTS + 1);
+}
+
+TEST(EasSlotQueue, CommitAssertsIfSlotNotAtSlotBoundary)
+{
+    EasSlotQueue queue = eas_slot_queue_create(buf, TEST_EAS_SLOT_QUEUE_SLOT_SIZE, 2);
+    uint8_t *slot = (uint8_t *)eas_slot_queue_reserve(queue);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("(offset % self->slot_size) == 0", "eas_slot_queue_commit");
+    eas_slot_queue_commit(queue, &slot[1]);
+}
+
+TEST(EasSlotQueue, CommitAssertsIfSlotOutsideOfQueue)
+{
+    EasSlotQueue queue = eas_slot_queue_create(buf, TEST_EAS_SLOT_QUEUE_SLOT_SIZE, 2);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("slot_idx < self->num_slots", "eas_slot_queue_commit");
+    eas_slot_queue_commit(queue, get_expected_slot(2));
+}
+
+TEST(EasSlotQueue, ReleaseAssertsIfNoSlotCommitted)
+{
+    EasSlotQueue queue = eas_slot_queue_create(buf, TEST_EAS_SLOT_QUEUE_SLOT_SIZE, 2);
+    eas_slot_queue_reserve(queue);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_slot_to_release_committed", "eas_slot_queue_release");
+    eas_slot_queue_release(queue);
+}
@@ -23,6 +23,21 @@ static void test_evaluate(Humidity current_humidity, uint8_t operator, Humidity
     variable_requirement_destroy(humidity_requirement);
 }
 
+static void test_evaluate_band(Humidity current_humidity, uint8_t operator, Humidity lower_value, Humidity upper_value,
+                               bool expected_result)
+{
+    mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
+    mock_c()->expectOneCall("current_humidity_get")->andReturnUnsignedIntValue(current_humidity);
+    mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
+
+    humidity_requirement = humidity_requirement_create_band(0, operator, lower_value, upper_value);
+    bool result = variable_requirement_evaluate(humidity_requirement);
+    CHECK_EQUAL_C_BOOL(expected_result, result);
+
+    /* Clean up */
+    variable_requirement_destroy(humidity_requirement);
+}
+
 TEST_GROUP_C_SETUP(HumidityRequirement)
 {
     requirement_buffer = fake_variable_requirement_allocator_alloc();
@@ -80,10 +95,10 @@ TEST_C(HumidityRequirement, getAlertIdReturnsAlertId5PassedToCreate)
 {
     mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
     mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
-    uint8_t expected_alert_id = 5;
+    uint16_t expected_alert_id = 5;
 
     humidity_requirement = humidity_requirement_create(expected_alert_id, VARIABLE_REQUIREMENT_OPERATOR_GEQ, 200);
-    uint8_t actual_alert_id = variable_requirement_get_alert_id(humidity_requirement);
+    uint16_t actual_alert_id = variable_requirement_get_alert_id(humidity_requirement);
 
     CHECK_EQUAL_C_UINT(expected_alert_id, actual_alert_id);
 
@@ -95,10 +110,10 @@ TEST_C(HumidityRequirement, getAlertIdReturnsAlertId6PassedToCreate)
 {
     mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
     mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
-    uint8_t expected_alert_id = 6;
+    uint16_t expected_alert_id = 6;
 
     humidity_requirement = humidity_requirement_create(expected_alert_id, VARIABLE_REQUIREMENT_OPERATOR_LEQ, 300);
-    uint8_t actual_alert_id = variable_requirement_get_alert_id(humidity_requirement);
+    uint16_t actual_alert_id = variable_requirement_get_alert_id(humidity_requirement);
 
     CHECK_EQUAL_C_UINT(expected_alert_id, actual_alert_id);
 
@@ -106,6 +121,21 @@ TEST_C(HumidityRequirement, getAlertIdReturnsAlertId6PassedToCreate)
     variable_requirement_destroy(humidity_requirement);
 }
 
+TEST_C(HumidityRequirement, getThresholdReturnsValuePassedToCreate)
+{
+    mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
+    mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
+    Humidity requirement_value = 85;
+
+    humidity_requirement = humidity_requirement_create(0, VARIABLE_REQUIREMENT_OPERATOR_GEQ, requirement_value);
+    VariableRequirementThreshold threshold = variable_requirement_get_threshold(humidity_requirement);
+
+    CHECK_EQUAL_C_LONGLONG(requirement_value, threshold);
+
+    /* Clean up */
+    variable_requirement_destroy(humidity_requirement);
+}
+
 TEST_C(HumidityRequirement, createRaisesAssertIfMemoryAllocationFailed)
 {
     mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue((void *)NULL);
@@ -113,3 +143,44 @@ TEST_C(HumidityRequirement, createRaisesAssertIfMemoryAllocationFailed)
 
     humidity_requirement_create(0, VARIABLE_REQUIREMENT_OPERATOR_GEQ, 0);
 }
+
+TEST_C(HumidityRequirement, evaluateReturnsTrueOperatorINSIDEValueEqualToUpper)
+{
+    test_evaluate_band(600, VARIABLE_REQUIREMENT_OPERATOR_INSIDE, 300, 600, true);
+}
+
+TEST_C(HumidityRequirement, evaluateReturnsFalseOperatorINSIDEValueBelow)
+{
+    test_evaluate_band(299, VARIABLE_REQUIREMENT_OPERATOR_INSIDE, 300, 600, false);
+}
+
+TEST_C(HumidityRequirement, evaluateReturnsTrueOperatorOUTSIDEValueBelow)
+{
+    test_evaluate_band(299, VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE, 300, 600, true);
+}
+
+TEST_C(HumidityRequirement, evaluateReturnsFalseOperatorOUTSIDEValueInside)
+{
+    test_evaluate_band(450, VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE, 300, 600, false);
+}
+
+TEST_C(HumidityRequirement, getUpperThresholdReturnsUpperValuePassedToCreateBand)
+{
+    mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
+    mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
+
+    humidity_requirement = humidity_requirement_create_band(0, VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE, 300, 600);
+
+    CHECK_EQUAL_C_LONGLONG(300, variable_requirement_get_threshold(humidity_requirement));
+    CHECK_EQUAL_C_LONGLONG(600, variable_requirement_get_upper_threshold(humidity_requirement));
+
+    /* Clean up */
+    variable_requirement_destroy(humidity_requirement);
+}
+
+TEST_C(HumidityRequirement, createBandRaisesAssertIfLowerValueNotBelowUpperValue)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("is_valid_band", "humidity_requirement_create_band");
+
+    humidity_requirement_create_band(0, VARIABLE_REQUIREMENT_OPERATOR_INSIDE, 300, 300);
+}
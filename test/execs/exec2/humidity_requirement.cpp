@@ -17,4 +17,11 @@ TEST_C_WRAPPER(HumidityRequirement, evaluateReturnsTrueOperatorGEQBothValuesEqua
 TEST_C_WRAPPER(HumidityRequirement, evaluateReturnsTrueOperatorLEQBothValuesEqualZero);
 TEST_C_WRAPPER(HumidityRequirement, getAlertIdReturnsAlertId5PassedToCreate);
 TEST_C_WRAPPER(HumidityRequirement, getAlertIdReturnsAlertId6PassedToCreate);
+TEST_C_WRAPPER(HumidityRequirement, getThresholdReturnsValuePassedToCreate);
 TEST_C_WRAPPER(HumidityRequirement, createRaisesAssertIfMemoryAllocationFailed);
+TEST_C_WRAPPER(HumidityRequirement, evaluateReturnsTrueOperatorINSIDEValueEqualToUpper);
+TEST_C_WRAPPER(HumidityRequirement, evaluateReturnsFalseOperatorINSIDEValueBelow);
+TEST_C_WRAPPER(HumidityRequirement, evaluateReturnsTrueOperatorOUTSIDEValueBelow);
+TEST_C_WRAPPER(HumidityRequirement, evaluateReturnsFalseOperatorOUTSIDEValueInside);
+TEST_C_WRAPPER(HumidityRequirement, getUpperThresholdReturnsUpperValuePassedToCreateBand);
+TEST_C_WRAPPER(HumidityRequirement, createBandRaisesAssertIfLowerValueNotBelowUpperValue);
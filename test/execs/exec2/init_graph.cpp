@@ -0,0 +1,223 @@
+#include <stddef.h>
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTestExt/MockSupport.h"
+#include "CppUTestExt/TestAssertPlugin.h"
+
+#include "init_graph.h"
+#include "mocks/mock_init_graph_start_step.h"
+
+static InitGraph inst = NULL;
+static void *complete_cb_user_data = (void *)0x3;
+
+/* Step user data, used to identify which step is started */
+static void *step_0 = (void *)0x10;
+static void *step_1 = (void *)0x11;
+static void *step_2 = (void *)0x12;
+
+static void complete_cb(bool result, void *user_data)
+{
+    mock().actualCall("complete_cb").withParameter("result", result).withParameter("user_data", user_data);
+}
+
+static void expect_step_started(void *step)
+{
+    mock().expectOneCall("mock_init_graph_start_step").withParameter("user_data", step);
+}
+
+static void expect_complete_cb(bool result)
+{
+    mock().expectOneCall("complete_cb").withParameter("result", result).withParameter("user_data", complete_cb_user_data);
+}
+
+/* Completes step 0 right away, from inside its start callback */
+static void start_step_0_completes_immediately(void *user_data)
+{
+    mock().actualCall("mock_init_graph_start_step").withParameter("user_data", user_data);
+    init_graph_step_complete(inst, 0, true);
+}
+
+// clang-format off
+TEST_GROUP(InitGraph)
+{
+    void setup()
+    {
+        inst = NULL;
+    }
+};
+// clang-format on
+
+TEST(InitGraph, StartStartsStepsWithoutDependencies)
+{
+    static const InitGraphStep steps[] = {
+        {.start = mock_init_graph_start_step, .user_data = step_0, .dependencies = 0},
+        {.start = mock_init_graph_start_step, .user_data = step_1, .dependencies = INIT_GRAPH_DEPENDENCY(0)},
+        {.start = mock_init_graph_start_step, .user_data = step_2, .dependencies = 0},
+    };
+    inst = init_graph_create(steps, 3, complete_cb, complete_cb_user_data);
+
+    expect_step_started(step_0);
+    expect_step_started(step_2);
+    init_graph_start(inst);
+}
+
+TEST(InitGraph, StepStartedOnceAllDependenciesComplete)
+{
+    static const InitGraphStep steps[] = {
+        {.start = mock_init_graph_start_step, .user_data = step_0, .dependencies = 0},
+        {.start = mock_init_graph_start_step, .user_data = step_1, .dependencies = 0},
+        {.start = mock_init_graph_start_step,
+         .user_data = step_2,
+         .dependencies = INIT_GRAPH_DEPENDENCY(0) | INIT_GRAPH_DEPENDENCY(1)},
+    };
+    inst = init_graph_create(steps, 3, complete_cb, complete_cb_user_data);
+
+    expect_step_started(step_0);
+    expect_step_started(step_1);
+    init_graph_start(inst);
+
+    /* Step 2 still waits for step 1 */
+    init_graph_step_complete(inst, 0, true);
+
+    expect_step_started(step_2);
+    init_graph_step_complete(inst, 1, true);
+
+    expect_complete_cb(true);
+    init_graph_step_complete(inst, 2, true);
+}
+
+TEST(InitGraph, StepCompletesInsideStartCallback)
+{
+    static const InitGraphStep steps[] = {
+        {.start = start_step_0_completes_immediately, .user_data = step_0, .dependencies = 0},
+        {.start = mock_init_graph_start_step, .user_data = step_1, .dependencies = INIT_GRAPH_DEPENDENCY(0)},
+    };
+    inst = init_graph_create(steps, 2, complete_cb, complete_cb_user_data);
+
+    expect_step_started(step_0);
+    expect_step_started(step_1);
+    init_graph_start(inst);
+
+    expect_complete_cb(true);
+    init_graph_step_complete(inst, 1, true);
+}
+
+TEST(InitGraph, FailedStepFinishesInitGraph)
+{
+    static const InitGraphStep steps[] = {
+        {.start = mock_init_graph_start_step, .user_data = step_0, .dependencies = 0},
+        {.start = mock_init_graph_start_step, .user_data = step_1, .dependencies = 0},
+        {.start = mock_init_graph_start_step, .user_data = step_2, .dependencies = INIT_GRAPH_DEPENDENCY(1)},
+    };
+    inst = init_graph_create(steps, 3, complete_cb, complete_cb_user_data);
+
+    expect_step_started(step_0);
+    expect_step_started(step_1);
+    init_graph_start(inst);
+
+    expect_complete_cb(false);
+    init_graph_step_complete(inst, 0, false);
+
+    /* Step 2 is not started, and the complete callback is not executed again */
+    init_graph_step_complete(inst, 1, true);
+}
+
+TEST(InitGraph, CompleteCbNull)
+{
+    static const InitGraphStep steps[] = {
+        {.start = mock_init_graph_start_step, .user_data = step_0, .dependencies = 0},
+    };
+    inst = init_graph_create(steps, 1, NULL, NULL);
+
+    expect_step_started(step_0);
+    init_graph_start(inst);
+    init_graph_step_complete(inst, 0, true);
+}
+
+TEST(InitGraph, CreateStepsNull)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("steps", "init_graph_create");
+    init_graph_create(NULL, 1, complete_cb, complete_cb_user_data);
+}
+
+TEST(InitGraph, CreateNumSteps0)
+{
+    static const InitGraphStep steps[] = {
+        {.start = mock_init_graph_start_step, .user_data = step_0, .dependencies = 0},
+    };
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("num_steps > 0", "init_graph_create");
+    init_graph_create(steps, 0, complete_cb, complete_cb_user_data);
+}
+
+TEST(InitGraph, CreateStartNull)
+{
+    static const InitGraphStep steps[] = {
+        {.start = NULL, .user_data = step_0, .dependencies = 0},
+    };
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("steps[i].start", "init_graph_create");
+    init_graph_create(steps, 1, complete_cb, complete_cb_user_data);
+}
+
+TEST(InitGraph, CreateDependencyOnLaterStep)
+{
+    static const InitGraphStep steps[] = {
+        {.start = mock_init_graph_start_step, .user_data = step_0, .dependencies = INIT_GRAPH_DEPENDENCY(1)},
+        {.start = mock_init_graph_start_step, .user_data = step_1, .dependencies = 0},
+    };
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("are_dependencies_valid", "init_graph_create");
+    init_graph_create(steps, 2, complete_cb, complete_cb_user_data);
+}
+
+TEST(InitGraph, StartTwice)
+{
+    static const InitGraphStep steps[] = {
+        {.start = mock_init_graph_start_step, .user_data = step_0, .dependencies = 0},
+    };
+    inst = init_graph_create(steps, 1, complete_cb, complete_cb_user_data);
+    expect_step_started(step_0);
+    init_graph_start(inst);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("!self->is_started", "init_graph_start");
+    init_graph_start(inst);
+}
+
+TEST(InitGraph, StepCompleteStepNotStarted)
+{
+    static const InitGraphStep steps[] = {
+        {.start = mock_init_graph_start_step, .user_data = step_0, .dependencies = 0},
+        {.start = mock_init_graph_start_step, .user_data = step_1, .dependencies = INIT_GRAPH_DEPENDENCY(0)},
+    };
+    inst = init_graph_create(steps, 2, complete_cb, complete_cb_user_data);
+    expect_step_started(step_0);
+    init_graph_start(inst);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self->started_steps & step", "init_graph_step_complete");
+    init_graph_step_complete(inst, 1, true);
+}
+
+TEST(InitGraph, StepCompleteTwice)
+{
+    static const InitGraphStep steps[] = {
+        {.start = mock_init_graph_start_step, .user_data = step_0, .dependencies = 0},
+        {.start = mock_init_graph_start_step, .user_data = step_1, .dependencies = 0},
+    };
+    inst = init_graph_create(steps, 2, complete_cb, complete_cb_user_data);
+    expect_step_started(step_0);
+    expect_step_started(step_1);
+    init_graph_start(inst);
+    init_graph_step_complete(inst, 0, true);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("!(self->completed_steps & step)", "init_graph_step_complete");
+    init_graph_step_complete(inst, 0, true);
+}
+
+TEST(InitGraph, StepCompleteInvalidStepIdx)
+{
+    static const InitGraphStep steps[] = {
+        {.start = mock_init_graph_start_step, .user_data = step_0, .dependencies = 0},
+    };
+    inst = init_graph_create(steps, 1, complete_cb, complete_cb_user_data);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("step_idx < self->num_steps", "init_graph_step_complete");
+    init_graph_step_complete(inst, 1, true);
+}
@@ -4,11 +4,8 @@
 #include "CppUTestExt/TestAssertPlugin.h"
 
 #include "led_manager.h"
-#include "led_manager_private.h"
 #include "config.h"
 #include "eas_timer_defs.h"
-#include "linked_list_node_allocator.h"
-#include "fake_linked_list_node_allocator.h"
 #include "fake_eas_current_time.h"
 
 /* Notification duration is defined in seconds in the config. The expected timer period is equal to the notification
@@ -28,12 +25,6 @@ static void *timer_cb_user_data;
 
 static EasTimer timer = (EasTimer)0x51;
 
-/* Buffers for led notifications to return from mocked calls to led_notification_allocator_alloc */
-static LedNotification led_notification_0;
-static LedNotification led_notification_1;
-static LedNotification led_notification_2;
-static LedNotification led_notification_3;
-
 static EasTime current_time = 0;
 
 void reset_current_time()
@@ -60,12 +51,6 @@ TEST_GROUP(LedManager)
         mock().setData("timerCbs", (void *)&timer_cb);
         mock().setData("timerCbsUserData", &timer_cb_user_data);
         mock().setData("numTimerCbs", (unsigned int)1);
-        
-        /* Linked list will directly call fake linked list node allocator which uses the memory block allocator. If we use 
-         * the mock linked list node allocator, the tests will need to expect calls to it. This is not relevant for LedManager
-         * tests - they are testing the LedManager behavior, not the way it stores notifications internally. */
-        UT_PTR_SET(linked_list_node_allocator_alloc, fake_linked_list_node_allocator_alloc);
-        UT_PTR_SET(linked_list_node_allocator_free, fake_linked_list_node_allocator_free);
 
         /* Time starts from 0 at the beginning of each test. Each test can advance time however it needs. */
         reset_current_time();
@@ -81,12 +66,10 @@ TEST_ORDERED(LedManager, PeriodicallySwitchBetweenTwoNotifications, 0)
     LedPattern led_pattern_0 = LED_PATTERN_STATIC;
     LedColor led_color_1 = LED_COLOR_RED;
     LedPattern led_pattern_1 = LED_PATTERN_ALERT;
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_0);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_0)
         .withParameter("led_pattern", led_pattern_0);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_1);
     mock()
         .expectOneCall("eas_timer_create")
         .withParameter("period_ms", LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD)
@@ -110,9 +93,7 @@ TEST_ORDERED(LedManager, PeriodicallySwitchBetweenTwoNotifications, 0)
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_0)
         .withParameter("led_pattern", led_pattern_0);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_1);
     mock().expectOneCall("eas_timer_stop").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_0);
     mock().expectOneCall("led_setter_turn_off");
 
     /* Calls led_set */
@@ -146,12 +127,10 @@ TEST_ORDERED(LedManager, AddNotificationSetsLed, 1)
 {
     LedColor led_color = LED_COLOR_RED;
     LedPattern led_pattern = LED_PATTERN_STATIC;
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_0);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color)
         .withParameter("led_pattern", led_pattern);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_0);
     mock().expectOneCall("led_setter_turn_off");
 
     /* Calls led_set */
@@ -167,12 +146,10 @@ TEST_ORDERED(LedManager, AddNotificationSetsLedGreenAlert, 1)
 {
     LedColor led_color = LED_COLOR_GREEN;
     LedPattern led_pattern = LED_PATTERN_ALERT;
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_0);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color)
         .withParameter("led_pattern", led_pattern);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_0);
     mock().expectOneCall("led_setter_turn_off");
 
     /* Calls led_set */
@@ -192,14 +169,11 @@ TEST_ORDERED(LedManager, PeriodicallySwitchBetweenThreeNotifications, 1)
     LedPattern led_pattern_1 = LED_PATTERN_ALERT;
     LedColor led_color_2 = LED_COLOR_RED;
     LedPattern led_pattern_2 = LED_PATTERN_STATIC;
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_0);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_0)
         .withParameter("led_pattern", led_pattern_0);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_1);
     mock().expectOneCall("eas_timer_start").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_2);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_1)
@@ -236,10 +210,7 @@ TEST_ORDERED(LedManager, PeriodicallySwitchBetweenThreeNotifications, 1)
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_0)
         .withParameter("led_pattern", led_pattern_0);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_2);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_1);
     mock().expectOneCall("eas_timer_stop").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_0);
     mock().expectOneCall("led_setter_turn_off");
 
     /* Calls led_set */
@@ -300,14 +271,11 @@ TEST_ORDERED(LedManager, RemoveOneOfSeveralNotifications, 1)
     LedPattern led_pattern_1 = LED_PATTERN_STATIC;
     LedColor led_color_2 = LED_COLOR_GREEN;
     LedPattern led_pattern_2 = LED_PATTERN_ALERT;
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_0);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_0)
         .withParameter("led_pattern", led_pattern_0);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_1);
     mock().expectOneCall("eas_timer_start").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_2);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_1)
@@ -320,7 +288,6 @@ TEST_ORDERED(LedManager, RemoveOneOfSeveralNotifications, 1)
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_0)
         .withParameter("led_pattern", led_pattern_0);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_1);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_2)
@@ -337,9 +304,7 @@ TEST_ORDERED(LedManager, RemoveOneOfSeveralNotifications, 1)
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_0)
         .withParameter("led_pattern", led_pattern_0);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_2);
     mock().expectOneCall("eas_timer_stop").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_0);
     mock().expectOneCall("led_setter_turn_off");
 
     /* Just so that one of the tests does not start time from 0 */
@@ -360,7 +325,7 @@ TEST_ORDERED(LedManager, RemoveOneOfSeveralNotifications, 1)
     advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
     /* Period for notification 2 expired, should call led_set to start displaying notification 0 */
     timer_cb(timer_cb_user_data);
-    /* Frees led notification 1 memory */
+    /* Removes notification 1 */
     bool removed_notification1 = led_manager_remove_notification(led_color_1, led_pattern_1);
     advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
     /* Period for notification 0 expired. Since notification 1 was removed, this should start displaying
@@ -395,15 +360,11 @@ TEST_ORDERED(LedManager, CurrentlyDisplayedNotificationIsRemoved, 1)
     LedPattern led_pattern_1 = LED_PATTERN_ALERT;
     LedColor led_color_2 = LED_COLOR_BLUE;
     LedPattern led_pattern_2 = LED_PATTERN_STATIC;
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_0);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_0)
         .withParameter("led_pattern", led_pattern_0);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_1);
     mock().expectOneCall("eas_timer_start").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_2);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_0);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_1)
@@ -422,14 +383,12 @@ TEST_ORDERED(LedManager, CurrentlyDisplayedNotificationIsRemoved, 1)
         .withParameter("led_color", led_color_2)
         .withParameter("led_pattern", led_pattern_2);
 
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_2);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_1)
         .withParameter("led_pattern", led_pattern_1);
     mock().expectOneCall("eas_timer_stop").withParameter("self", timer);
 
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_1);
     mock().expectOneCall("led_setter_turn_off");
 
     /* Calls led_set */
@@ -452,8 +411,7 @@ TEST_ORDERED(LedManager, CurrentlyDisplayedNotificationIsRemoved, 1)
     timer_cb(timer_cb_user_data);
 
     /* Notification 2 is being disaplyed, but it is now being removed. This should start displaying notification 1 - the
-     * last one left. It should also free notification 2 memory and stop the timer, since there is only one notification
-     * left. */
+     * last one left. It should also stop the timer, since there is only one notification left. */
     bool removed_notification2 = led_manager_remove_notification(led_color_2, led_pattern_2);
     /* The last notification is removed. Should turn off the led. */
     bool removed_notification1 = led_manager_remove_notification(led_color_1, led_pattern_1);
@@ -479,12 +437,10 @@ TEST_ORDERED(LedManager, RemoveNotificationReturnsFalseOneNotificationAdded, 1)
     LedPattern led_pattern_0 = LED_PATTERN_ALERT;
     LedColor led_color_1 = LED_COLOR_BLUE;
     LedPattern led_pattern_1 = LED_PATTERN_STATIC;
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_0);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_0)
         .withParameter("led_pattern", led_pattern_0);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_0);
     mock().expectOneCall("led_setter_turn_off");
 
     led_manager_add_notification(led_color_0, led_pattern_0);
@@ -506,22 +462,18 @@ TEST_ORDERED(LedManager, RemoveNotificationReturnsFalseTwoNotificationsAdded, 1)
     LedPattern led_pattern_1 = LED_PATTERN_STATIC;
     LedColor led_color_2 = LED_COLOR_BLUE;
     LedPattern led_pattern_2 = LED_PATTERN_ALERT;
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_0);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_0)
         .withParameter("led_pattern", led_pattern_0);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_1);
     mock().expectOneCall("eas_timer_start").withParameter("self", timer);
     /* Clean up */
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_1);
     mock().expectOneCall("eas_timer_stop").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_0);
     mock().expectOneCall("led_setter_turn_off");
 
-    /* Allocates notification 0 and sets led to notification 0 */
+    /* Adds notification 0 and sets led to notification 0 */
     led_manager_add_notification(led_color_0, led_pattern_0);
-    /* Allocates notification 1 and starts notification timer */
+    /* Adds notification 1 and starts notification timer */
     led_manager_add_notification(led_color_1, led_pattern_1);
 
     bool removed_notification2 = led_manager_remove_notification(led_color_2, led_pattern_2);
@@ -545,26 +497,20 @@ TEST_ORDERED(LedManager, RemoveNotificationReturnsFalseThreeNotificationsAdded,
     LedPattern led_pattern_2 = LED_PATTERN_STATIC;
     LedColor led_color_3 = LED_COLOR_RED;
     LedPattern led_pattern_3 = LED_PATTERN_ALERT;
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_0);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_0)
         .withParameter("led_pattern", led_pattern_0);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_1);
     mock().expectOneCall("eas_timer_start").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_2);
     /* Clean up */
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_2);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_1);
     mock().expectOneCall("eas_timer_stop").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_0);
     mock().expectOneCall("led_setter_turn_off");
 
-    /* Allocates notification 0 and sets led to notification 0 */
+    /* Adds notification 0 and sets led to notification 0 */
     led_manager_add_notification(led_color_0, led_pattern_0);
-    /* Allocates notification 1 and starts notification timer */
+    /* Adds notification 1 and starts notification timer */
     led_manager_add_notification(led_color_1, led_pattern_1);
-    /* Allocates notification 2 */
+    /* Adds notification 2 */
     led_manager_add_notification(led_color_2, led_pattern_2);
 
     bool removed_notification3 = led_manager_remove_notification(led_color_3, led_pattern_3);
@@ -590,12 +536,10 @@ TEST_ORDERED(LedManager, AddOneRemoveOneAddTwoMore, 1)
     LedPattern led_pattern_2 = LED_PATTERN_STATIC;
     LedColor led_color_3 = LED_COLOR_GREEN;
     LedPattern led_pattern_3 = LED_PATTERN_ALERT;
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_0);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_0)
         .withParameter("led_pattern", led_pattern_0);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_1);
     mock().expectOneCall("eas_timer_start").withParameter("self", timer);
     mock()
         .expectOneCall("led_setter_set")
@@ -609,11 +553,8 @@ TEST_ORDERED(LedManager, AddOneRemoveOneAddTwoMore, 1)
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_1)
         .withParameter("led_pattern", led_pattern_1);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_0);
     mock().expectOneCall("eas_timer_stop").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_2);
     mock().expectOneCall("eas_timer_start").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_3);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_2)
@@ -634,7 +575,6 @@ TEST_ORDERED(LedManager, AddOneRemoveOneAddTwoMore, 1)
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_3)
         .withParameter("led_pattern", led_pattern_3);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_3);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_1)
@@ -648,14 +588,12 @@ TEST_ORDERED(LedManager, AddOneRemoveOneAddTwoMore, 1)
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_1)
         .withParameter("led_pattern", led_pattern_1);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_2);
     mock().expectOneCall("eas_timer_stop").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_1);
     mock().expectOneCall("led_setter_turn_off");
 
-    /* Allocates notification 0 and sets led to notification 0 */
+    /* Adds notification 0 and sets led to notification 0 */
     led_manager_add_notification(led_color_0, led_pattern_0);
-    /* Allocates notification 1 and starts notification timer */
+    /* Adds notification 1 and starts notification timer */
     led_manager_add_notification(led_color_1, led_pattern_1);
     advance_current_time_by(LED_MANAGER_TEST_IGNORE_TIMER_PERIOD_MS);
     /* Callback should still be accepted if exactly timer ignore period elapsed since timer is started */
@@ -667,11 +605,11 @@ TEST_ORDERED(LedManager, AddOneRemoveOneAddTwoMore, 1)
     advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
     /* Sets led to notification 1 */
     timer_cb(timer_cb_user_data);
-    /* Frees notification 0 and stops the timer. Already dispalying notification 1, so led_set is not called. */
+    /* Removes notification 0 and stops the timer. Already dispalying notification 1, so led_set is not called. */
     bool removed_notification0 = led_manager_remove_notification(led_color_0, led_pattern_0);
-    /* Allocates notification 2 and starts notification timer */
+    /* Adds notification 2 and starts notification timer */
     led_manager_add_notification(led_color_2, led_pattern_2);
-    /* Allocates notification 3 */
+    /* Adds notification 3 */
     led_manager_add_notification(led_color_3, led_pattern_3);
     advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
     /* Sets led to notification 2 */
@@ -688,8 +626,8 @@ TEST_ORDERED(LedManager, AddOneRemoveOneAddTwoMore, 1)
     advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
     /* Sets led to notification 3 */
     timer_cb(timer_cb_user_data);
-    /* Frees notification 3, sets led to notification 1, and restarts the timer so that notification 1 is displayed for
-     * the full period */
+    /* Removes notification 3, sets led to notification 1, and restarts the timer so that notification 1 is displayed
+     * for the full period */
     bool removed_notification3 = led_manager_remove_notification(led_color_3, led_pattern_3);
     advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
     /* Sets led to notification 2 */
@@ -697,9 +635,9 @@ TEST_ORDERED(LedManager, AddOneRemoveOneAddTwoMore, 1)
     advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
     /* Sets led to notification 1 */
     timer_cb(timer_cb_user_data);
-    /* Frees notification 2 and stops the timer */
+    /* Removes notification 2 and stops the timer */
     bool removed_notification2 = led_manager_remove_notification(led_color_2, led_pattern_2);
-    /* Frees notification 1 and turns off the led */
+    /* Removes notification 1 and turns off the led */
     bool removed_notification1 = led_manager_remove_notification(led_color_1, led_pattern_1);
 
     CHECK_TRUE(removed_notification0);
@@ -715,15 +653,11 @@ TEST_ORDERED(LedManager, TimerCbFiresWhenRestarted, 1)
     LedPattern led_pattern_1 = LED_PATTERN_ALERT;
     LedColor led_color_2 = LED_COLOR_GREEN;
     LedPattern led_pattern_2 = LED_PATTERN_STATIC;
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_0);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_0)
         .withParameter("led_pattern", led_pattern_0);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_1);
     mock().expectOneCall("eas_timer_start").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_2);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_0);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_1)
@@ -737,7 +671,6 @@ TEST_ORDERED(LedManager, TimerCbFiresWhenRestarted, 1)
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_1)
         .withParameter("led_pattern", led_pattern_1);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_0);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_2)
@@ -750,7 +683,6 @@ TEST_ORDERED(LedManager, TimerCbFiresWhenRestarted, 1)
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_1)
         .withParameter("led_pattern", led_pattern_1);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_1);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_2)
@@ -768,23 +700,21 @@ TEST_ORDERED(LedManager, TimerCbFiresWhenRestarted, 1)
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_0)
         .withParameter("led_pattern", led_pattern_0);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_0);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_2)
         .withParameter("led_pattern", led_pattern_2);
     mock().expectOneCall("eas_timer_stop").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_2);
     mock().expectOneCall("led_setter_turn_off");
 
-    /* Allocates notification 0 and sets led to notification 0 */
+    /* Adds notification 0 and sets led to notification 0 */
     led_manager_add_notification(led_color_0, led_pattern_0);
-    /* Allocates notification 1 and starts notification timer */
+    /* Adds notification 1 and starts notification timer */
     led_manager_add_notification(led_color_1, led_pattern_1);
-    /* Allocates notification 2 */
+    /* Adds notification 2 */
     led_manager_add_notification(led_color_2, led_pattern_2);
-    /* Frees notification 0, sets led to notification 1, restarts the timer so that notification 1 is displayed for the
-     * full period */
+    /* Removes notification 0, sets led to notification 1, restarts the timer so that notification 1 is displayed for
+     * the full period */
     bool removed_notification0_1 = led_manager_remove_notification(led_color_0, led_pattern_0);
     advance_current_time_by(1);
     /* This timer callback was scheduled before we restarted the timer, but it still got executed. Only 1 ms passed
@@ -796,7 +726,7 @@ TEST_ORDERED(LedManager, TimerCbFiresWhenRestarted, 1)
     advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
     /* Sets led to notification 1 */
     timer_cb(timer_cb_user_data);
-    /* Allocates notification 0 */
+    /* Adds notification 0 */
     led_manager_add_notification(led_color_0, led_pattern_0);
     advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
     /* Sets led to notification 2 */
@@ -807,8 +737,8 @@ TEST_ORDERED(LedManager, TimerCbFiresWhenRestarted, 1)
     advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
     /* Sets led to notification 1 */
     timer_cb(timer_cb_user_data);
-    /* Frees notification 1, sets led to notification 2, restarts the timer so that notification 2 is displayed for the
-     * full period */
+    /* Removes notification 1, sets led to notification 2, restarts the timer so that notification 2 is displayed for
+     * the full period */
     bool removed_notification1 = led_manager_remove_notification(led_color_1, led_pattern_1);
     /* Here the unexpected timer callback fires 1 ms before the ignore timer period expires, so seconds after the timer
      * was restarted. This is not a realistic scenario - if a callback fires before the expected timer period elapses,
@@ -831,9 +761,9 @@ TEST_ORDERED(LedManager, TimerCbFiresWhenRestarted, 1)
     /* Sets led to notification 0 */
     timer_cb(timer_cb_user_data);
 
-    /* Frees notification 0, sets led to notification 2, and stops the timer */
+    /* Removes notification 0, sets led to notification 2, and stops the timer */
     bool removed_notification0_2 = led_manager_remove_notification(led_color_0, led_pattern_0);
-    /* Frees notification 2 and turns off the led */
+    /* Removes notification 2 and turns off the led */
     bool removed_notification2 = led_manager_remove_notification(led_color_2, led_pattern_2);
 
     CHECK_TRUE(removed_notification0_1);
@@ -848,31 +778,27 @@ TEST_ORDERED(LedManager, TimerCbFiresWhenStopped, 1)
     LedPattern led_pattern_0 = LED_PATTERN_ALERT;
     LedColor led_color_1 = LED_COLOR_RED;
     LedPattern led_pattern_1 = LED_PATTERN_STATIC;
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_0);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_0)
         .withParameter("led_pattern", led_pattern_0);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_1);
     mock().expectOneCall("eas_timer_start").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_1);
     mock().expectOneCall("eas_timer_stop").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_0);
     mock().expectOneCall("led_setter_turn_off");
 
-    /* Allocates notification 0 and sets led to notification 0 */
+    /* Adds notification 0 and sets led to notification 0 */
     led_manager_add_notification(led_color_0, led_pattern_0);
-    /* Allocates notification 1 and starts notification timer */
+    /* Adds notification 1 and starts notification timer */
     led_manager_add_notification(led_color_1, led_pattern_1);
     /* Timer period almost expired when we remove notification 1 */
     advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD - 1);
-    /* Frees notification 1 and stops the timer */
+    /* Removes notification 1 and stops the timer */
     bool removed_notification1 = led_manager_remove_notification(led_color_1, led_pattern_1);
     advance_current_time_by(1);
     /* The timer was stopped right before its expiry time, so its expiry callback still gets executed. Led manager is
      * expected to detect that the timer is stopped and ignore this callback. */
     timer_cb(timer_cb_user_data);
-    /* Frees notification 0 and turns off the led */
+    /* Removes notification 0 and turns off the led */
     bool removed_notification0 = led_manager_remove_notification(led_color_0, led_pattern_0);
 
     CHECK_TRUE(removed_notification1);
@@ -883,70 +809,30 @@ TEST_ORDERED(LedManager, SeveralNotificationsSameColorPattern, 1)
 {
     LedColor led_color = LED_COLOR_GREEN;
     LedPattern led_pattern = LED_PATTERN_ALERT;
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_0);
-    mock()
-        .expectOneCall("led_setter_set")
-        .withParameter("led_color", led_color)
-        .withParameter("led_pattern", led_pattern);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_1);
-    mock().expectOneCall("eas_timer_start").withParameter("self", timer);
-    mock()
-        .expectOneCall("led_setter_set")
-        .withParameter("led_color", led_color)
-        .withParameter("led_pattern", led_pattern);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_2);
-    mock()
-        .expectOneCall("led_setter_set")
-        .withParameter("led_color", led_color)
-        .withParameter("led_pattern", led_pattern);
-    mock()
-        .expectOneCall("led_setter_set")
-        .withParameter("led_color", led_color)
-        .withParameter("led_pattern", led_pattern);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color)
         .withParameter("led_pattern", led_pattern);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_0);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_1);
-    mock()
-        .expectOneCall("led_setter_set")
-        .withParameter("led_color", led_color)
-        .withParameter("led_pattern", led_pattern);
-    mock().expectOneCall("eas_timer_stop").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_2);
     mock().expectOneCall("led_setter_turn_off");
 
-    /* Allocates notification 0 and sets led to notification 0 */
+    /* Sets led to the notification */
     led_manager_add_notification(led_color, led_pattern);
-    /* Allocates notification 1 and starts notification timer */
+    /* Notifications with the same color and pattern are displayed as one notification. No calls to led or timer. */
     led_manager_add_notification(led_color, led_pattern);
-    advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
-    /* Sets led to notification 1 */
-    timer_cb(timer_cb_user_data);
-    /* Allocates notification 2 */
     led_manager_add_notification(led_color, led_pattern);
     advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
-    /* Sets led to notification 2 */
-    timer_cb(timer_cb_user_data);
-    advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
-    /* Sets led to notification 0 */
-    timer_cb(timer_cb_user_data);
-    advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
-    /* Sets led to notification 1 */
-    timer_cb(timer_cb_user_data);
-    /* Frees notification 0. Led manager will remove the first notification in the list that has the requested color and
-     * pattern. */
+    /* The notification stays displayed until it is removed as many times as it was added */
     bool removed_notification0 = led_manager_remove_notification(led_color, led_pattern);
-    /* Frees notification 1, since it is now the first one in the list with the requested color and pattern. Sets led to
-     * notification 0. Stops the timer. */
     bool removed_notification1 = led_manager_remove_notification(led_color, led_pattern);
-    /* Frees notification 2 and turns off the led */
+    /* Turns off the led */
     bool removed_notification2 = led_manager_remove_notification(led_color, led_pattern);
+    /* Nothing left to remove */
+    bool removed_notification3 = led_manager_remove_notification(led_color, led_pattern);
 
     CHECK_TRUE(removed_notification0);
     CHECK_TRUE(removed_notification1);
     CHECK_TRUE(removed_notification2);
+    CHECK_FALSE(removed_notification3);
 }
 
 TEST_ORDERED(LedManager, SameColorPatternNotificationsMixedWithOtherColorPatterns, 1)
@@ -955,109 +841,55 @@ TEST_ORDERED(LedManager, SameColorPatternNotificationsMixedWithOtherColorPattern
     LedPattern led_pattern_static = LED_PATTERN_STATIC;
     LedColor led_color_1 = LED_COLOR_GREEN;
     LedPattern led_pattern_1 = LED_PATTERN_ALERT;
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_0);
-    /* Notification 0 */
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_red)
         .withParameter("led_pattern", led_pattern_static);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_1);
     mock().expectOneCall("eas_timer_start").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_2);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_3);
-    /* Notification 1 */
-    mock()
-        .expectOneCall("led_setter_set")
-        .withParameter("led_color", led_color_1)
-        .withParameter("led_pattern", led_pattern_1);
-    /* Notification 2 */
-    mock()
-        .expectOneCall("led_setter_set")
-        .withParameter("led_color", led_color_red)
-        .withParameter("led_pattern", led_pattern_static);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_0);
-    /* Notification 3 */
-    mock()
-        .expectOneCall("led_setter_set")
-        .withParameter("led_color", led_color_red)
-        .withParameter("led_pattern", led_pattern_static);
-    /* Notification 1 */
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_1)
         .withParameter("led_pattern", led_pattern_1);
-    /* Notification 2 */
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_red)
         .withParameter("led_pattern", led_pattern_static);
-    /* Notification 3 */
-    mock()
-        .expectOneCall("led_setter_set")
-        .withParameter("led_color", led_color_red)
-        .withParameter("led_pattern", led_pattern_static);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_2);
-    /* Notification 1 */
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_1)
         .withParameter("led_pattern", led_pattern_1);
-    /* Notification 3 */
-    mock()
-        .expectOneCall("led_setter_set")
-        .withParameter("led_color", led_color_red)
-        .withParameter("led_pattern", led_pattern_static);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_1);
     mock().expectOneCall("eas_timer_stop").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_3);
     mock().expectOneCall("led_setter_turn_off");
 
-    /* Allocates notification 0 and sets led to notification 0 */
+    /* Sets led to the red notification */
     led_manager_add_notification(led_color_red, led_pattern_static);
-    /* Allocates notification 1 and starts notification timer */
+    /* Starts notification timer */
     led_manager_add_notification(led_color_1, led_pattern_1);
-    /* Allocates notification 2 */
+    /* No calls to led or timer - the red notification is already being displayed in turns with notification 1 */
     led_manager_add_notification(led_color_red, led_pattern_static);
-    /* Allocates notification 3 */
     led_manager_add_notification(led_color_red, led_pattern_static);
 
     advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
     /* Sets led to notification 1 */
     timer_cb(timer_cb_user_data);
     advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
-    /* Sets led to notification 2 */
-    timer_cb(timer_cb_user_data);
-    /* Frees notification 0 */
-    bool removed_notification0 = led_manager_remove_notification(led_color_red, led_pattern_static);
-    advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
-    /* Sets led to notification 3 */
-    timer_cb(timer_cb_user_data);
-    advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
-    /* Sets led to notification 1 */
-    timer_cb(timer_cb_user_data);
-    advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
-    /* Sets led to notification 2 */
+    /* Sets led to the red notification */
     timer_cb(timer_cb_user_data);
-    advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
-    /* Sets led to notification 3 */
-    timer_cb(timer_cb_user_data);
-    /* Frees notification 2 */
-    bool removed_notification2 = led_manager_remove_notification(led_color_red, led_pattern_static);
+    /* The red notification was added 3 times, so it is still displayed */
+    bool removed_red_0 = led_manager_remove_notification(led_color_red, led_pattern_static);
     advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
     /* Sets led to notification 1 */
     timer_cb(timer_cb_user_data);
-    advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD);
-    /* Sets led to notification 3 */
-    timer_cb(timer_cb_user_data);
-    /* Frees notification 1 and stops the timer */
+    bool removed_red_1 = led_manager_remove_notification(led_color_red, led_pattern_static);
+    /* The red notification is now removed. Notification 1 is already being displayed, so only stops the timer. */
+    bool removed_red_2 = led_manager_remove_notification(led_color_red, led_pattern_static);
+    /* Turns off the led */
     bool removed_notification1 = led_manager_remove_notification(led_color_1, led_pattern_1);
-    /* Frees notification 3 and turns off the led */
-    bool removed_notification3 = led_manager_remove_notification(led_color_red, led_pattern_static);
 
-    CHECK_TRUE(removed_notification0);
-    CHECK_TRUE(removed_notification2);
+    CHECK_TRUE(removed_red_0);
+    CHECK_TRUE(removed_red_1);
+    CHECK_TRUE(removed_red_2);
     CHECK_TRUE(removed_notification1);
-    CHECK_TRUE(removed_notification3);
 }
 
 TEST_ORDERED(LedManager, StoppedTimerCbFiresWhenStoppedAndImmediatelyStarted, 1)
@@ -1066,20 +898,16 @@ TEST_ORDERED(LedManager, StoppedTimerCbFiresWhenStoppedAndImmediatelyStarted, 1)
     LedPattern led_pattern_0 = LED_PATTERN_STATIC;
     LedColor led_color_1 = LED_COLOR_BLUE;
     LedPattern led_pattern_1 = LED_PATTERN_ALERT;
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_0);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_0)
         .withParameter("led_pattern", led_pattern_0);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_1);
     mock().expectOneCall("eas_timer_start").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_0);
     mock()
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_1)
         .withParameter("led_pattern", led_pattern_1);
     mock().expectOneCall("eas_timer_stop").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue(&led_notification_0);
     mock().expectOneCall("eas_timer_start").withParameter("self", timer);
     mock()
         .expectOneCall("led_setter_set")
@@ -1089,20 +917,18 @@ TEST_ORDERED(LedManager, StoppedTimerCbFiresWhenStoppedAndImmediatelyStarted, 1)
         .expectOneCall("led_setter_set")
         .withParameter("led_color", led_color_1)
         .withParameter("led_pattern", led_pattern_1);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_0);
     mock().expectOneCall("eas_timer_stop").withParameter("self", timer);
-    mock().expectOneCall("led_notification_allocator_free").withParameter("led_notification", &led_notification_1);
     mock().expectOneCall("led_setter_turn_off");
 
-    /* Allocates notification 0 and sets led to notification 0 */
+    /* Adds notification 0 and sets led to notification 0 */
     led_manager_add_notification(led_color_0, led_pattern_0);
-    /* Allocates notification 1 and starts notification timer */
+    /* Adds notification 1 and starts notification timer */
     led_manager_add_notification(led_color_1, led_pattern_1);
     /* Timer period almost expired when we remove notification 0 */
     advance_current_time_by(LED_MANAGER_TEST_EXPECTED_TIMER_PERIOD - 1);
-    /* Frees notification 0, sets led to notification 1, and stops the timer */
+    /* Removes notification 0, sets led to notification 1, and stops the timer */
     bool removed_notification0_1 = led_manager_remove_notification(led_color_0, led_pattern_0);
-    /* Allocates notification 0 and starts the timer */
+    /* Adds notification 0 and starts the timer */
     led_manager_add_notification(led_color_0, led_pattern_0);
     advance_current_time_by(1);
     /* The timer was stopped right before its expiry time, so its expiry callback still gets executed. The timer has
@@ -1115,9 +941,9 @@ TEST_ORDERED(LedManager, StoppedTimerCbFiresWhenStoppedAndImmediatelyStarted, 1)
     /* Sets led to notification 1 */
     timer_cb(timer_cb_user_data);
 
-    /* Frees notification 0 and stops the timer */
+    /* Removes notification 0 and stops the timer */
     bool removed_notification0_2 = led_manager_remove_notification(led_color_0, led_pattern_0);
-    /* Frees notification 1 and turns off the led */
+    /* Removes notification 1 and turns off the led */
     bool removed_notification1 = led_manager_remove_notification(led_color_1, led_pattern_1);
 
     CHECK_TRUE(removed_notification0_1);
@@ -1125,10 +951,23 @@ TEST_ORDERED(LedManager, StoppedTimerCbFiresWhenStoppedAndImmediatelyStarted, 1)
     CHECK_TRUE(removed_notification1);
 }
 
-TEST_ORDERED(LedManager, AddNotificationAssertsIfFailedToAlloc, 1)
+TEST_ORDERED(LedManager, AddNotificationAssertsIfInvalidColor, 1)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_notification", "get_slot");
+
+    led_manager_add_notification((LedColor)(LED_COLOR_BLUE + 1), LED_PATTERN_ALERT);
+}
+
+TEST_ORDERED(LedManager, AddNotificationAssertsIfInvalidPattern, 1)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_notification", "get_slot");
+
+    led_manager_add_notification(LED_COLOR_BLUE, (LedPattern)(LED_PATTERN_ALERT + 1));
+}
+
+TEST_ORDERED(LedManager, RemoveNotificationAssertsIfInvalidColor, 1)
 {
-    mock().expectOneCall("led_notification_allocator_alloc").andReturnValue((void *)NULL);
-    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("led_notification", "led_manager_add_notification");
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_notification", "get_slot");
 
-    led_manager_add_notification(LED_COLOR_BLUE, LED_PATTERN_ALERT);
+    led_manager_remove_notification((LedColor)(LED_COLOR_BLUE + 1), LED_PATTERN_STATIC);
 }
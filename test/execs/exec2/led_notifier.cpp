@@ -4,10 +4,23 @@
 #include "CppUTestExt/TestAssertPlugin.h"
 
 #include "led_notifier.h"
+#include "alert_slots.h"
 #include "config.h"
 #include "eas_assert.h"
 
-TEST_GROUP(LedNotifier){};
+// clang-format off
+TEST_GROUP(LedNotifier)
+{
+    void setup()
+    {
+        /* Slots are assigned in ascending order, so alert id i gets slot i */
+        alert_slots_reset();
+        for (size_t i = 0; i < CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS; i++) {
+            alert_slots_add(i);
+        }
+    }
+};
+// clang-format on
 
 /* This test is always the first test to be executed out of a group, so that we can test that initially all
  * notifications are disabled - led_notification_executor_execute is not called for any alert ids. */
@@ -22,7 +35,7 @@ TEST_ORDERED(LedNotifier, AllNotificationsInitiallyDisabled, 0)
 
 TEST_ORDERED(LedNotifier, EnabledNotificationCallsExecutorId0, 1)
 {
-    uint8_t alert_id = 0;
+    uint16_t alert_id = 0;
     LedColor led_color = LED_COLOR_RED;
     LedPattern led_pattern = LED_PATTERN_STATIC;
     EAS_ASSERT(alert_id < CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS);
@@ -43,7 +56,7 @@ TEST_ORDERED(LedNotifier, EnabledNotificationCallsExecutorId0, 1)
 
 TEST_ORDERED(LedNotifier, EnabledNotificationCallsExecutorId2, 1)
 {
-    uint8_t alert_id = 2;
+    uint16_t alert_id = 2;
     LedColor led_color = LED_COLOR_GREEN;
     LedPattern led_pattern = LED_PATTERN_ALERT;
     EAS_ASSERT(alert_id < CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS);
@@ -64,7 +77,7 @@ TEST_ORDERED(LedNotifier, EnabledNotificationCallsExecutorId2, 1)
 
 TEST_ORDERED(LedNotifier, DisabledNotificationDoesNotCallExecutor, 1)
 {
-    uint8_t alert_id = 1;
+    uint16_t alert_id = 1;
     EAS_ASSERT(alert_id < CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS);
 
     /* This should not call led_notification_executor_execute, since notifications are disabled */
@@ -73,7 +86,7 @@ TEST_ORDERED(LedNotifier, DisabledNotificationDoesNotCallExecutor, 1)
 
 TEST_ORDERED(LedNotifier, IsRaisedPropagatedToExecutorCall, 1)
 {
-    uint8_t alert_id = 0;
+    uint16_t alert_id = 0;
     LedColor led_color = LED_COLOR_BLUE;
     LedPattern led_pattern = LED_PATTERN_STATIC;
     EAS_ASSERT(alert_id < CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS);
@@ -101,7 +114,7 @@ TEST_ORDERED(LedNotifier, IsRaisedPropagatedToExecutorCall, 1)
 
 TEST_ORDERED(LedNotifier, DisablePreviouslyEnabledNotificationDoesNotCallExecutor, 1)
 {
-    uint8_t alert_id = 1;
+    uint16_t alert_id = 1;
     LedColor led_color = LED_COLOR_RED;
     LedPattern led_pattern = LED_PATTERN_ALERT;
     EAS_ASSERT(alert_id < CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS);
@@ -114,7 +127,7 @@ TEST_ORDERED(LedNotifier, DisablePreviouslyEnabledNotificationDoesNotCallExecuto
 
 TEST_ORDERED(LedNotifier, EnablePreviouslyDisabledNotificationCallsExecutor, 1)
 {
-    uint8_t alert_id = 0;
+    uint16_t alert_id = 0;
     LedColor led_color = LED_COLOR_GREEN;
     LedPattern led_pattern = LED_PATTERN_STATIC;
     EAS_ASSERT(alert_id < CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS);
@@ -137,26 +150,26 @@ TEST_ORDERED(LedNotifier, EnablePreviouslyDisabledNotificationCallsExecutor, 1)
 
 TEST_ORDERED(LedNotifier, EnableNotificationAssertsIfAlertIdInvalid, 1)
 {
-    uint8_t alert_id = CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS;
+    uint16_t alert_id = CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS;
     LedColor led_color = LED_COLOR_BLUE;
     LedPattern led_pattern = LED_PATTERN_ALERT;
-    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_alert_id(alert_id)", "led_notifier_enable_notifications");
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_alert_id", "get_slot");
 
     led_notifier_enable_notifications(alert_id, led_color, led_pattern);
 }
 
 TEST_ORDERED(LedNotifier, DisableNotificationAssertsIfAlertIdInvalid, 1)
 {
-    uint8_t alert_id = CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS;
-    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_alert_id(alert_id)", "led_notifier_disable_notifications");
+    uint16_t alert_id = CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS;
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_alert_id", "get_slot");
 
     led_notifier_disable_notifications(alert_id);
 }
 
 TEST_ORDERED(LedNotifier, NotifyAssertsIfAlertIdInvalid, 1)
 {
-    uint8_t alert_id = CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS;
-    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_alert_id(alert_id)", "led_notifier_notify");
+    uint16_t alert_id = CONFIG_LED_NOTIFIER_MAX_NUM_ALERTS;
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_valid_alert_id", "get_slot");
 
     led_notifier_notify(alert_id, false);
 }
@@ -24,6 +24,21 @@ static void test_evaluate(LightIntensity current_light_intensity, uint8_t operat
     variable_requirement_destroy(light_intensity_requirement);
 }
 
+static void test_evaluate_band(LightIntensity current_light_intensity, uint8_t operator, LightIntensity lower_value,
+                               LightIntensity upper_value, bool expected_result)
+{
+    mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
+    mock_c()->expectOneCall("current_light_intensity_get")->andReturnUnsignedIntValue(current_light_intensity);
+    mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
+
+    light_intensity_requirement = light_intensity_requirement_create_band(0, operator, lower_value, upper_value);
+    bool result = variable_requirement_evaluate(light_intensity_requirement);
+    CHECK_EQUAL_C_BOOL(expected_result, result);
+
+    /* Clean up */
+    variable_requirement_destroy(light_intensity_requirement);
+}
+
 TEST_GROUP_C_SETUP(LightIntensityRequirement)
 {
     requirement_buffer = fake_variable_requirement_allocator_alloc();
@@ -81,11 +96,11 @@ TEST_C(LightIntensityRequirement, getAlertIdReturnsAlertId3PassedToCreate)
 {
     mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
     mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
-    uint8_t expected_alert_id = 3;
+    uint16_t expected_alert_id = 3;
 
     light_intensity_requirement =
         light_intensity_requirement_create(expected_alert_id, VARIABLE_REQUIREMENT_OPERATOR_GEQ, 200);
-    uint8_t actual_alert_id = variable_requirement_get_alert_id(light_intensity_requirement);
+    uint16_t actual_alert_id = variable_requirement_get_alert_id(light_intensity_requirement);
 
     CHECK_EQUAL_C_UINT(expected_alert_id, actual_alert_id);
 
@@ -97,11 +112,11 @@ TEST_C(LightIntensityRequirement, getAlertIdReturnsAlertId8PassedToCreate)
 {
     mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
     mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
-    uint8_t expected_alert_id = 8;
+    uint16_t expected_alert_id = 8;
 
     light_intensity_requirement =
         light_intensity_requirement_create(expected_alert_id, VARIABLE_REQUIREMENT_OPERATOR_LEQ, 10000);
-    uint8_t actual_alert_id = variable_requirement_get_alert_id(light_intensity_requirement);
+    uint16_t actual_alert_id = variable_requirement_get_alert_id(light_intensity_requirement);
 
     CHECK_EQUAL_C_UINT(expected_alert_id, actual_alert_id);
 
@@ -109,6 +124,23 @@ TEST_C(LightIntensityRequirement, getAlertIdReturnsAlertId8PassedToCreate)
     variable_requirement_destroy(light_intensity_requirement);
 }
 
+/* Tests that a requirement value that does not fit into int32_t is preserved. */
+TEST_C(LightIntensityRequirement, getThresholdReturnsValuePassedToCreate)
+{
+    mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
+    mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
+    LightIntensity requirement_value = 4000000000;
+
+    light_intensity_requirement =
+        light_intensity_requirement_create(0, VARIABLE_REQUIREMENT_OPERATOR_GEQ, requirement_value);
+    VariableRequirementThreshold threshold = variable_requirement_get_threshold(light_intensity_requirement);
+
+    CHECK_EQUAL_C_LONGLONG(requirement_value, threshold);
+
+    /* Clean up */
+    variable_requirement_destroy(light_intensity_requirement);
+}
+
 TEST_C(LightIntensityRequirement, createRaisesAssertIfMemoryAllocationFailed)
 {
     mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue((void *)NULL);
@@ -116,3 +148,45 @@ TEST_C(LightIntensityRequirement, createRaisesAssertIfMemoryAllocationFailed)
 
     light_intensity_requirement = light_intensity_requirement_create(0, VARIABLE_REQUIREMENT_OPERATOR_GEQ, 0);
 }
+
+TEST_C(LightIntensityRequirement, evaluateReturnsTrueOperatorINSIDEValueEqualToUpper)
+{
+    test_evaluate_band(4000000000, VARIABLE_REQUIREMENT_OPERATOR_INSIDE, 1000, 4000000000, true);
+}
+
+TEST_C(LightIntensityRequirement, evaluateReturnsFalseOperatorINSIDEValueBelow)
+{
+    test_evaluate_band(999, VARIABLE_REQUIREMENT_OPERATOR_INSIDE, 1000, 4000000000, false);
+}
+
+TEST_C(LightIntensityRequirement, evaluateReturnsTrueOperatorOUTSIDEValueBelow)
+{
+    test_evaluate_band(999, VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE, 1000, 4000000000, true);
+}
+
+TEST_C(LightIntensityRequirement, evaluateReturnsFalseOperatorOUTSIDEValueInside)
+{
+    test_evaluate_band(2000000500, VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE, 1000, 4000000000, false);
+}
+
+TEST_C(LightIntensityRequirement, getUpperThresholdReturnsUpperValuePassedToCreateBand)
+{
+    mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
+    mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
+
+    light_intensity_requirement =
+        light_intensity_requirement_create_band(0, VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE, 1000, 4000000000);
+
+    CHECK_EQUAL_C_LONGLONG(1000, variable_requirement_get_threshold(light_intensity_requirement));
+    CHECK_EQUAL_C_LONGLONG(4000000000, variable_requirement_get_upper_threshold(light_intensity_requirement));
+
+    /* Clean up */
+    variable_requirement_destroy(light_intensity_requirement);
+}
+
+TEST_C(LightIntensityRequirement, createBandRaisesAssertIfLowerValueNotBelowUpperValue)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("is_valid_band", "light_intensity_requirement_create_band");
+
+    light_intensity_requirement_create_band(0, VARIABLE_REQUIREMENT_OPERATOR_INSIDE, 1000, 1000);
+}
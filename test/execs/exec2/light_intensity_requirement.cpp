@@ -17,4 +17,11 @@ TEST_C_WRAPPER(LightIntensityRequirement, evaluateReturnsTrueOperatorGEQBothValu
 TEST_C_WRAPPER(LightIntensityRequirement, evaluateReturnsTrueOperatorLEQBothValuesEqualZero);
 TEST_C_WRAPPER(LightIntensityRequirement, getAlertIdReturnsAlertId3PassedToCreate);
 TEST_C_WRAPPER(LightIntensityRequirement, getAlertIdReturnsAlertId8PassedToCreate);
+TEST_C_WRAPPER(LightIntensityRequirement, getThresholdReturnsValuePassedToCreate);
 TEST_C_WRAPPER(LightIntensityRequirement, createRaisesAssertIfMemoryAllocationFailed);
+TEST_C_WRAPPER(LightIntensityRequirement, evaluateReturnsTrueOperatorINSIDEValueEqualToUpper);
+TEST_C_WRAPPER(LightIntensityRequirement, evaluateReturnsFalseOperatorINSIDEValueBelow);
+TEST_C_WRAPPER(LightIntensityRequirement, evaluateReturnsTrueOperatorOUTSIDEValueBelow);
+TEST_C_WRAPPER(LightIntensityRequirement, evaluateReturnsFalseOperatorOUTSIDEValueInside);
+TEST_C_WRAPPER(LightIntensityRequirement, getUpperThresholdReturnsUpperValuePassedToCreateBand);
+TEST_C_WRAPPER(LightIntensityRequirement, createBandRaisesAssertIfLowerValueNotBelowUpperValue);
@@ -1,7 +1,7 @@
 #include "CppUTestExt/MockSupport.h"
 #include "mock_alert_notifier.h"
 
-void alert_notifier_notify(uint8_t alert_id, bool is_raised)
+void alert_notifier_notify(uint16_t alert_id, bool is_raised)
 {
     mock()
         .actualCall("alert_notifier_notify")
@@ -9,7 +9,7 @@ extern "C"
 #include <stdint.h>
 #include <stdbool.h>
 
-void alert_notifier_notify(uint8_t alert_id, bool is_raised);
+void alert_notifier_notify(uint16_t alert_id, bool is_raised);
 
 #ifdef __cplusplus
 }
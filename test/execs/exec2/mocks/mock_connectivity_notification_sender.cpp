@@ -1,7 +1,7 @@
 #include "CppUTestExt/MockSupport.h"
 #include "mock_connectivity_notification_sender.h"
 
-void connectivity_notification_sender_send(uint8_t alert_id, bool is_raised)
+void connectivity_notification_sender_send(uint16_t alert_id, bool is_raised)
 {
     mock()
         .actualCall("connectivity_notification_sender_send")
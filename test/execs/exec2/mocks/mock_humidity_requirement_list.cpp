@@ -0,0 +1,8 @@
+#include "CppUTestExt/MockSupport.h"
+#include "mock_humidity_requirement_list.h"
+
+VariableRequirementThreshold humidity_requirement_list_get_distance_to_nearest(Humidity value)
+{
+    mock().actualCall("humidity_requirement_list_get_distance_to_nearest").withParameter("value", value);
+    return mock().longIntReturnValue();
+}
@@ -0,0 +1,18 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC2_MOCKS_MOCK_HUMIDITY_REQUIREMENT_LIST_H
+#define ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC2_MOCKS_MOCK_HUMIDITY_REQUIREMENT_LIST_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "humidity.h"
+#include "variable_requirement_defs.h"
+
+VariableRequirementThreshold humidity_requirement_list_get_distance_to_nearest(Humidity value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC2_MOCKS_MOCK_HUMIDITY_REQUIREMENT_LIST_H */
@@ -0,0 +1,7 @@
+#include "CppUTestExt/MockSupport.h"
+#include "mock_init_graph_start_step.h"
+
+void mock_init_graph_start_step(void *user_data)
+{
+    mock().actualCall("mock_init_graph_start_step").withParameter("user_data", user_data);
+}
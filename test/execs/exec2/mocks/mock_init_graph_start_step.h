@@ -0,0 +1,15 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC2_MOCKS_MOCK_INIT_GRAPH_START_STEP_H
+#define ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC2_MOCKS_MOCK_INIT_GRAPH_START_STEP_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+void mock_init_graph_start_step(void *user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC2_MOCKS_MOCK_INIT_GRAPH_START_STEP_H */
@@ -0,0 +1,8 @@
+#include "CppUTestExt/MockSupport.h"
+#include "mock_light_intensity_requirement_list.h"
+
+VariableRequirementThreshold light_intensity_requirement_list_get_distance_to_nearest(LightIntensity value)
+{
+    mock().actualCall("light_intensity_requirement_list_get_distance_to_nearest").withParameter("value", value);
+    return mock().longIntReturnValue();
+}
@@ -0,0 +1,8 @@
+#include "CppUTestExt/MockSupport.h"
+#include "mock_pressure_requirement_list.h"
+
+VariableRequirementThreshold pressure_requirement_list_get_distance_to_nearest(Pressure value)
+{
+    mock().actualCall("pressure_requirement_list_get_distance_to_nearest").withParameter("value", value);
+    return mock().longIntReturnValue();
+}
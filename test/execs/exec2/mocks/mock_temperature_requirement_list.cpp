@@ -0,0 +1,8 @@
+#include "CppUTestExt/MockSupport.h"
+#include "mock_temperature_requirement_list.h"
+
+VariableRequirementThreshold temperature_requirement_list_get_distance_to_nearest(Temperature value)
+{
+    mock().actualCall("temperature_requirement_list_get_distance_to_nearest").withParameter("value", value);
+    return mock().longIntReturnValue();
+}
@@ -0,0 +1,40 @@
+#include "CppUTestExt/MockSupport.h"
+#include "mock_timer_wheel.h"
+#include "eas_assert.h"
+
+/* Same as the EasTimer mock object: the test passes arrays via mock data, and timer_wheel_timer_create populates them
+ * with the timer callbacks and their user data. This way, the test can call the callbacks to simulate timer expiry. */
+TimerWheelTimer timer_wheel_timer_create(uint32_t period_ms, TimerWheelTimerCb cb, void *user_data)
+{
+    TimerWheelTimerCb *timer_cbs = (TimerWheelTimerCb *)mock().getData("timerCbs").getPointerValue();
+    void **timer_cbs_user_data = (void **)mock().getData("timerCbsUserData").getPointerValue();
+    size_t num_timer_cbs = mock().getData("numTimerCbs").getUnsignedIntValue();
+
+    static size_t timer_cbs_index = 0;
+    EAS_ASSERT(timer_cbs_index < num_timer_cbs);
+    timer_cbs[timer_cbs_index] = cb;
+    timer_cbs_user_data[timer_cbs_index] = user_data;
+    timer_cbs_index = (timer_cbs_index + 1) % num_timer_cbs;
+
+    mock()
+        .actualCall("timer_wheel_timer_create")
+        .withParameter("period_ms", period_ms)
+        .withParameter("cb", cb)
+        .withParameter("user_data", user_data);
+    return (TimerWheelTimer)mock().pointerReturnValue();
+}
+
+void timer_wheel_timer_set_period(TimerWheelTimer self, uint32_t period_ms)
+{
+    mock().actualCall("timer_wheel_timer_set_period").withParameter("self", self).withParameter("period_ms", period_ms);
+}
+
+void timer_wheel_timer_start(TimerWheelTimer self)
+{
+    mock().actualCall("timer_wheel_timer_start").withParameter("self", self);
+}
+
+void timer_wheel_timer_stop(TimerWheelTimer self)
+{
+    mock().actualCall("timer_wheel_timer_stop").withParameter("self", self);
+}
@@ -0,0 +1,27 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC2_MOCKS_MOCK_TIMER_WHEEL_H
+#define ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC2_MOCKS_MOCK_TIMER_WHEEL_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+typedef struct TimerWheelTimerStruct *TimerWheelTimer;
+
+typedef void (*TimerWheelTimerCb)(void *user_data);
+
+TimerWheelTimer timer_wheel_timer_create(uint32_t period_ms, TimerWheelTimerCb cb, void *user_data);
+
+void timer_wheel_timer_set_period(TimerWheelTimer self, uint32_t period_ms);
+
+void timer_wheel_timer_start(TimerWheelTimer self);
+
+void timer_wheel_timer_stop(TimerWheelTimer self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC2_MOCKS_MOCK_TIMER_WHEEL_H */
@@ -19,20 +19,30 @@ EAS_STATIC_ASSERT(sizeof(struct MockVariableRequirementStruct) <= CONFIG_VARIABL
 // Forward declarations of interface functions to define the interface.
 static bool evaluate(VariableRequirement base);
 static void destroy(VariableRequirement base);
+static VariableRequirementThreshold get_threshold(VariableRequirement base);
 
 static VariableRequirementInterfaceStruct valid_interface = {
     .evaluate = evaluate,
     .destroy = destroy,
+    .get_threshold = get_threshold,
 };
 
 static VariableRequirementInterfaceStruct interface_with_evaluate_null = {
     .evaluate = NULL,
     .destroy = destroy,
+    .get_threshold = get_threshold,
 };
 
 static VariableRequirementInterfaceStruct interface_with_destroy_null = {
     .evaluate = evaluate,
     .destroy = NULL,
+    .get_threshold = get_threshold,
+};
+
+static VariableRequirementInterfaceStruct interface_with_get_threshold_null = {
+    .evaluate = evaluate,
+    .destroy = destroy,
+    .get_threshold = NULL,
 };
 
 static bool evaluate(VariableRequirement base)
@@ -46,6 +56,11 @@ static void destroy(VariableRequirement base)
     variable_requirement_allocator_free(base);
 }
 
+static VariableRequirementThreshold get_threshold(VariableRequirement base)
+{
+    return 0;
+}
+
 VariableRequirement mock_variable_requirement_create(bool pass_null_instance_to_var_req_create,
                                                      bool pass_invalid_operator_to_var_req_create,
                                                      uint8_t vtable_parameter)
@@ -73,6 +88,9 @@ VariableRequirement mock_variable_requirement_create(bool pass_null_instance_to_
     case MOCK_VARIABLE_REQUIREMENT_PASS_NULL_DESTROY_TO_VAR_REQ_CREATE:
         vtable = &interface_with_destroy_null;
         break;
+    case MOCK_VARIABLE_REQUIREMENT_PASS_NULL_GET_THRESHOLD_TO_VAR_REQ_CREATE:
+        vtable = &interface_with_get_threshold_null;
+        break;
     default:
         break;
     }
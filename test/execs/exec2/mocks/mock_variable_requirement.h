@@ -21,7 +21,8 @@ typedef enum MockVariableRequirementVtableParameter {
     MOCK_VARIABLE_REQUIREMENT_PASS_NULL_VTABLE_TO_VAR_REQ_CREATE,
     MOCK_VARIABLE_REQUIREMENT_PASS_VALID_VTABLE_TO_VAR_REQ_CREATE,
     MOCK_VARIABLE_REQUIREMENT_PASS_NULL_EVALUATE_TO_VAR_REQ_CREATE,
-    MOCK_VARIABLE_REQUIREMENT_PASS_NULL_DESTROY_TO_VAR_REQ_CREATE
+    MOCK_VARIABLE_REQUIREMENT_PASS_NULL_DESTROY_TO_VAR_REQ_CREATE,
+    MOCK_VARIABLE_REQUIREMENT_PASS_NULL_GET_THRESHOLD_TO_VAR_REQ_CREATE
 } MockVariableRequirementVtableParameter;
 
 /**
@@ -40,6 +41,10 @@ typedef enum MockVariableRequirementVtableParameter {
  * evaluate().
  *   - MOCK_VARIABLE_REQUIREMENT_PASS_NULL_EVALUATE_TO_VAR_REQ_CREATE - vtable that has a NULL pointer instead of the
  * evaluate() implementation.
+ *   - MOCK_VARIABLE_REQUIREMENT_PASS_NULL_DESTROY_TO_VAR_REQ_CREATE - vtable that has a NULL pointer instead of the
+ * destroy() implementation.
+ *   - MOCK_VARIABLE_REQUIREMENT_PASS_NULL_GET_THRESHOLD_TO_VAR_REQ_CREATE - vtable that has a NULL pointer instead of
+ * the get_threshold() implementation.
  *
  * @return VariableRequirement Created variable requirement instance.
  */
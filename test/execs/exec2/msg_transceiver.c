@@ -9,9 +9,9 @@
 #include "config.h"
 #include "eas_assert.h"
 
-/* In the ReuseAlertStatusChangeMessageSlot test, we send alert status change message this number of times. */
+/* In the ReuseMessageSlot test, we send alert status change message this number of times. */
 #define TEST_MSG_TRANSCEIVER_MAX_NUM_TRANSMIT_COMPLETE_CBS                                                             \
-    (CONFIG_MSG_TRANSCEIVER_MAX_NUM_CONCURRENT_ALERT_STATUS_CHANGE_MESSAGES + 1)
+    (CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS + 1)
 
 /* Transceiver mock object populates these every time msg_transceiver implementation calls transceiver_transmit */
 static TransceiverTransmitCompleteCb transmit_complete_cbs[TEST_MSG_TRANSCEIVER_MAX_NUM_TRANSMIT_COMPLETE_CBS];
@@ -29,13 +29,25 @@ static bool message_sent_cb_1_result = false;
 static void *message_sent_cb_1_user_data = NULL;
 /* Populated from inside remove_alert_cb */
 static bool remove_alert_cb_called = false;
-static uint8_t remove_alert_cb_alert_id = false;
+static uint16_t remove_alert_cb_alert_id = 0;
 static void *remove_alert_cb_user_data = NULL;
 /* Populated from inside add_alert_cb */
 static bool add_alert_cb_called = false;
 static MsgTransceiverAlert add_alert_cb_alert;
 static void *add_alert_cb_user_data = NULL;
 
+static bool get_stats_cb_called = false;
+static void *get_stats_cb_user_data = NULL;
+
+static bool get_sample_history_cb_called = false;
+static void *get_sample_history_cb_user_data = NULL;
+
+static bool replace_all_alerts_cb_called = false;
+static MsgTransceiverAlert
+    replace_all_alerts_cb_alerts[CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERTS_IN_REPLACE_ALL_ALERTS_MESSAGE];
+static size_t replace_all_alerts_cb_num_alerts = 0;
+static void *replace_all_alerts_cb_user_data = NULL;
+
 static void message_sent_cb(bool result, void *user_data)
 {
     message_sent_cb_called = true;
@@ -50,7 +62,7 @@ static void message_sent_cb_1(bool result, void *user_data)
     message_sent_cb_1_user_data = user_data;
 }
 
-static void remove_alert_cb(uint8_t alert_id, void *user_data)
+static void remove_alert_cb(uint16_t alert_id, void *user_data)
 {
     remove_alert_cb_called = true;
     remove_alert_cb_alert_id = alert_id;
@@ -64,6 +76,26 @@ static void add_alert_cb(const MsgTransceiverAlert *const alert, void *user_data
     add_alert_cb_user_data = user_data;
 }
 
+static void get_stats_cb(void *user_data)
+{
+    get_stats_cb_called = true;
+    get_stats_cb_user_data = user_data;
+}
+
+static void get_sample_history_cb(void *user_data)
+{
+    get_sample_history_cb_called = true;
+    get_sample_history_cb_user_data = user_data;
+}
+
+static void replace_all_alerts_cb(const MsgTransceiverAlert *const alerts, size_t num_alerts, void *user_data)
+{
+    replace_all_alerts_cb_called = true;
+    memcpy(replace_all_alerts_cb_alerts, alerts, num_alerts * sizeof(MsgTransceiverAlert));
+    replace_all_alerts_cb_num_alerts = num_alerts;
+    replace_all_alerts_cb_user_data = user_data;
+}
+
 TEST_GROUP_C_SETUP(MsgTransceiver)
 {
     memset(transmit_complete_cbs, 0,
@@ -84,6 +116,14 @@ TEST_GROUP_C_SETUP(MsgTransceiver)
     /* Some tests test for 0 values, so the tests are more reliable if the alert memory is initially set to 0xFF*/
     memset(&add_alert_cb_alert, 0xFF, sizeof(MsgTransceiverAlert));
     add_alert_cb_user_data = NULL;
+    get_stats_cb_called = false;
+    get_stats_cb_user_data = NULL;
+    get_sample_history_cb_called = false;
+    get_sample_history_cb_user_data = NULL;
+    replace_all_alerts_cb_called = false;
+    memset(replace_all_alerts_cb_alerts, 0xFF, sizeof(replace_all_alerts_cb_alerts));
+    replace_all_alerts_cb_num_alerts = 0xFF;
+    replace_all_alerts_cb_user_data = NULL;
     /* So that transceiver mock starts populating transmitCompleteCbs and their user data at index 0 at the beginning of
      * each test */
     virtual_transceiver_mock_reset_cbs_index();
@@ -110,6 +150,9 @@ TEST_GROUP_C_SETUP(MsgTransceiver)
     msg_transceiver_init();
     msg_transceiver_set_add_alert_cb(add_alert_cb, NULL);
     msg_transceiver_set_remove_alert_cb(remove_alert_cb, NULL);
+    msg_transceiver_set_get_stats_cb(get_stats_cb, NULL);
+    msg_transceiver_set_replace_all_alerts_cb(replace_all_alerts_cb, NULL);
+    msg_transceiver_set_get_sample_history_cb(get_sample_history_cb, NULL);
 }
 
 TEST_GROUP_C_TEARDOWN(MsgTransceiver)
@@ -122,8 +165,8 @@ TEST_GROUP_C_TEARDOWN(MsgTransceiver)
 
 TEST_C(MsgTransceiver, Alert0Silenced)
 {
-    size_t expected_num_bytes = 3;
-    uint8_t expected_payload[] = {0x0, 0x0, 0x0};
+    size_t expected_num_bytes = 4;
+    uint8_t expected_payload[] = {0x0, 0x0, 0x0, 0x0};
     /* msg_transceiver_send_alert_status_change_message */
     mock_c()
         ->expectOneCall("transceiver_transmit")
@@ -142,8 +185,8 @@ TEST_C(MsgTransceiver, Alert0Silenced)
 
 TEST_C(MsgTransceiver, Alert0Raised)
 {
-    size_t expected_num_bytes = 3;
-    uint8_t expected_payload[] = {0x0, 0x0, 0x1};
+    size_t expected_num_bytes = 4;
+    uint8_t expected_payload[] = {0x0, 0x0, 0x0, 0x1};
     /* msg_transceiver_send_alert_status_change_message */
     mock_c()
         ->expectOneCall("transceiver_transmit")
@@ -162,8 +205,8 @@ TEST_C(MsgTransceiver, Alert0Raised)
 
 TEST_C(MsgTransceiver, Alert1Silenced)
 {
-    size_t expected_num_bytes = 3;
-    uint8_t expected_payload[] = {0x0, 0x1, 0x0};
+    size_t expected_num_bytes = 4;
+    uint8_t expected_payload[] = {0x0, 0x1, 0x0, 0x0};
     /* msg_transceiver_send_alert_status_change_message */
     mock_c()
         ->expectOneCall("transceiver_transmit")
@@ -182,8 +225,8 @@ TEST_C(MsgTransceiver, Alert1Silenced)
 
 TEST_C(MsgTransceiver, Alert8RaisedFailed)
 {
-    size_t expected_num_bytes = 3;
-    uint8_t expected_payload[] = {0x0, 0x8, 0x1};
+    size_t expected_num_bytes = 4;
+    uint8_t expected_payload[] = {0x0, 0x8, 0x0, 0x1};
     /* msg_transceiver_send_alert_status_change_message */
     mock_c()
         ->expectOneCall("transceiver_transmit")
@@ -200,11 +243,32 @@ TEST_C(MsgTransceiver, Alert8RaisedFailed)
     CHECK_C(!message_sent_cb_result);
 }
 
+TEST_C(MsgTransceiver, Alert300Raised)
+{
+    size_t expected_num_bytes = 4;
+    /* Alert id is two bytes in little endian */
+    uint8_t expected_payload[] = {0x0, 0x2C, 0x1, 0x1};
+    /* msg_transceiver_send_alert_status_change_message */
+    mock_c()
+        ->expectOneCall("transceiver_transmit")
+        ->withMemoryBufferParameter("bytes", expected_payload, expected_num_bytes)
+        ->withUnsignedLongIntParameters("num_bytes", expected_num_bytes)
+        ->ignoreOtherParameters();
+
+    msg_transceiver_send_alert_status_change_message(300, true, message_sent_cb, NULL);
+    /* Mock transmission success */
+    (transmit_complete_cbs[0])(true, transmit_complete_cbs_user_data[0]);
+
+    /* message_sent_cb should have been called with result == true */
+    CHECK_C(message_sent_cb_called);
+    CHECK_C(message_sent_cb_result);
+}
+
 TEST_C(MsgTransceiver, MessageSentCbCalledWithUserData)
 {
     void *user_data = (void *)0x42;
-    size_t expected_num_bytes = 3;
-    uint8_t expected_payload[] = {0x0, 20, 0x0};
+    size_t expected_num_bytes = 4;
+    uint8_t expected_payload[] = {0x0, 20, 0x0, 0x0};
     /* msg_transceiver_send_alert_status_change_message */
     mock_c()
         ->expectOneCall("transceiver_transmit")
@@ -224,8 +288,8 @@ TEST_C(MsgTransceiver, MessageSentCbCalledWithUserData)
 TEST_C(MsgTransceiver, RemoveAlert0)
 {
     /* Mock receiving a "remove alert" message. 0x1 - message id, 0 - alert id */
-    uint8_t remove_alert_bytes[2] = {0x1, 0};
-    receive_cb(remove_alert_bytes, 2, receive_cb_user_data);
+    uint8_t remove_alert_bytes[3] = {0x1, 0, 0};
+    receive_cb(remove_alert_bytes, 3, receive_cb_user_data);
 
     /* remove_alert_cb should have been called with alert_id 0 and user_data NULL */
     CHECK_C(remove_alert_cb_called);
@@ -236,8 +300,8 @@ TEST_C(MsgTransceiver, RemoveAlert0)
 TEST_C(MsgTransceiver, RemoveAlert1)
 {
     /* Mock receiving a "remove alert" message. 0x1 - message id, 1 - alert id */
-    uint8_t remove_alert_bytes[2] = {0x1, 1};
-    receive_cb(remove_alert_bytes, 2, receive_cb_user_data);
+    uint8_t remove_alert_bytes[3] = {0x1, 1, 0};
+    receive_cb(remove_alert_bytes, 3, receive_cb_user_data);
 
     /* remove_alert_cb should have been called with alert_id 1 and user_data NULL */
     CHECK_C(remove_alert_cb_called);
@@ -245,6 +309,18 @@ TEST_C(MsgTransceiver, RemoveAlert1)
     CHECK_EQUAL_C_POINTER(NULL, remove_alert_cb_user_data);
 }
 
+TEST_C(MsgTransceiver, RemoveAlert1000)
+{
+    /* Mock receiving a "remove alert" message. 0x1 - message id, 1000 - alert id in little endian */
+    uint8_t remove_alert_bytes[3] = {0x1, 0xE8, 0x3};
+    receive_cb(remove_alert_bytes, 3, receive_cb_user_data);
+
+    /* remove_alert_cb should have been called with alert_id 1000 and user_data NULL */
+    CHECK_C(remove_alert_cb_called);
+    CHECK_EQUAL_C_UINT(1000, remove_alert_cb_alert_id);
+    CHECK_EQUAL_C_POINTER(NULL, remove_alert_cb_user_data);
+}
+
 TEST_C(MsgTransceiver, ReceiveCbCalledWithNumBytes0)
 {
     /* Not giving a NULL pointer as receive_bytes, because there is a separate check for that - we want to specifically
@@ -259,8 +335,8 @@ TEST_C(MsgTransceiver, ReceiveCbCalledWithNumBytes0)
 
 TEST_C(MsgTransceiver, RemoveAlertMessageWithNoAlertId)
 {
-    /* 0x1 is the message id for "remove alert" message. The payload should also contain the second byte - alert id, but
-     * it does not. */
+    /* 0x1 is the message id for "remove alert" message. The payload should also contain two bytes of alert id, but it
+     * does not. */
     uint8_t receive_bytes[1] = {0x1};
     receive_cb(receive_bytes, 1, receive_cb_user_data);
 
@@ -268,12 +344,22 @@ TEST_C(MsgTransceiver, RemoveAlertMessageWithNoAlertId)
     CHECK_C(!remove_alert_cb_called);
 }
 
+TEST_C(MsgTransceiver, RemoveAlertMessageOneAlertIdByte)
+{
+    /* Only the first of the two alert id bytes */
+    uint8_t receive_bytes[2] = {0x1, 5};
+    receive_cb(receive_bytes, 2, receive_cb_user_data);
+
+    /* No callbacks should be called - message payload structure is invalid. */
+    CHECK_C(!remove_alert_cb_called);
+}
+
 TEST_C(MsgTransceiver, RemoveAlertMessageTooManyBytes)
 {
-    /* "Remove alert" message should have only two bytes - message id and alert id. Here it has three bytes, so message
-     * should be ignored. */
-    uint8_t receive_bytes[3] = {0x1, 5, 0xFF};
-    receive_cb(receive_bytes, 3, receive_cb_user_data);
+    /* "Remove alert" message should have only three bytes - message id and two bytes of alert id. Here it has four
+     * bytes, so message should be ignored. */
+    uint8_t receive_bytes[4] = {0x1, 5, 0, 0xFF};
+    receive_cb(receive_bytes, 4, receive_cb_user_data);
 
     /* No callbacks should be called - message payload structure is invalid. */
     CHECK_C(!remove_alert_cb_called);
@@ -293,8 +379,8 @@ TEST_C(MsgTransceiver, RemoveAlertCbExecutedWithUserData)
     void *user_data = (void *)0xAB;
     msg_transceiver_set_remove_alert_cb(remove_alert_cb, user_data);
     /* Mock receiving a "remove alert" message. 0x1 - message id, 10 - alert id */
-    uint8_t remove_alert_bytes[2] = {0x1, 10};
-    receive_cb(remove_alert_bytes, 2, receive_cb_user_data);
+    uint8_t remove_alert_bytes[3] = {0x1, 10, 0};
+    receive_cb(remove_alert_bytes, 3, receive_cb_user_data);
 
     CHECK_C(remove_alert_cb_called);
     CHECK_EQUAL_C_UINT(10, remove_alert_cb_alert_id);
@@ -304,9 +390,9 @@ TEST_C(MsgTransceiver, RemoveAlertCbExecutedWithUserData)
 TEST_C(MsgTransceiver, AddAlert0)
 {
     /* Mock receiving a "add alert" message */
-    uint8_t add_alert_bytes[17] = {
+    uint8_t add_alert_bytes[18] = {
         0x2,                /* message id */
-        0x0,                /* alert id */
+        0x0, 0x0,           /* alert id */
         0x0, 0x0, 0x0, 0x0, /* Warmup period - 0 ms */
         0x0, 0x0, 0x0, 0x0, /* Cooldown period - 0 ms */
         0x1,                /* notification type - connectivity enabled, LED disabled */
@@ -317,12 +403,12 @@ TEST_C(MsgTransceiver, AddAlert0)
         0x0,     /* Operator - greater than or equal to */
         0x0, 0x0 /* Constraint value - 0 degrees Celsius */
     };
-    receive_cb(add_alert_bytes, 17, receive_cb_user_data);
+    receive_cb(add_alert_bytes, 18, receive_cb_user_data);
 
     CHECK_C(add_alert_cb_called);
     /* Validate constructed alert */
     const MsgTransceiverAlert *const alert = &add_alert_cb_alert;
-    CHECK_EQUAL_C_UBYTE(0, alert->alert_id);
+    CHECK_EQUAL_C_UINT(0, alert->alert_id);
     CHECK_EQUAL_C_ULONG(0, alert->warmup_period);
     CHECK_EQUAL_C_ULONG(0, alert->cooldown_period);
     CHECK_C(alert->notification_type.connectivity);
@@ -338,9 +424,9 @@ TEST_C(MsgTransceiver, AddAlert0)
 TEST_C(MsgTransceiver, AddAlert1)
 {
     /* Mock receiving a "add alert" message */
-    uint8_t add_alert_bytes[19] = {
+    uint8_t add_alert_bytes[20] = {
         0x2,                 /* message id */
-        0x1,                 /* alert id */
+        0x1, 0x0,            /* alert id */
         0xE8, 0x3, 0x0, 0x0, /* Warmup period - 1000 ms */
         0xD0, 0x7, 0x0, 0x0, /* Cooldown period - 2000 ms */
         0x2,                 /* notification type - connectivity disabled, LED enabled */
@@ -353,12 +439,12 @@ TEST_C(MsgTransceiver, AddAlert1)
         0x1,      /* Operator - less than or equal to */
         0xE7, 0x3 /* Constraint value - 999 hPa */
     };
-    receive_cb(add_alert_bytes, 19, receive_cb_user_data);
+    receive_cb(add_alert_bytes, 20, receive_cb_user_data);
 
     CHECK_C(add_alert_cb_called);
     /* Validate constructed alert */
     const MsgTransceiverAlert *const alert = &add_alert_cb_alert;
-    CHECK_EQUAL_C_UBYTE(1, alert->alert_id);
+    CHECK_EQUAL_C_UINT(1, alert->alert_id);
     CHECK_EQUAL_C_ULONG(1000, alert->warmup_period);
     CHECK_EQUAL_C_ULONG(2000, alert->cooldown_period);
     CHECK_C(!(alert->notification_type.connectivity));
@@ -376,9 +462,9 @@ TEST_C(MsgTransceiver, AddAlert1)
 TEST_C(MsgTransceiver, AddAlert2)
 {
     /* Mock receiving a "add alert" message */
-    uint8_t add_alert_bytes[25] = {
+    uint8_t add_alert_bytes[26] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2, 0x0,             /* alert id */
         0xC0, 0xD4, 0x1, 0x0, /* Warmup period - 120,000 ms */
         0xB3, 0x15, 0x0, 0x0, /* Cooldown period - 5555 ms */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
@@ -395,12 +481,12 @@ TEST_C(MsgTransceiver, AddAlert2)
         0x1,               /* Operator - less than or equal to */
         0x1, 0x0, 0x0, 0x0 /* Constraint value 1 lx */
     };
-    receive_cb(add_alert_bytes, 25, receive_cb_user_data);
+    receive_cb(add_alert_bytes, 26, receive_cb_user_data);
 
     CHECK_C(add_alert_cb_called);
     /* Validate constructed alert */
     const MsgTransceiverAlert *const alert = &add_alert_cb_alert;
-    CHECK_EQUAL_C_UBYTE(2, alert->alert_id);
+    CHECK_EQUAL_C_UINT(2, alert->alert_id);
     CHECK_EQUAL_C_ULONG(120000, alert->warmup_period);
     CHECK_EQUAL_C_ULONG(5555, alert->cooldown_period);
     CHECK_C(alert->notification_type.connectivity);
@@ -423,9 +509,9 @@ TEST_C(MsgTransceiver, AddAlert2)
 TEST_C(MsgTransceiver, AddAlert3)
 {
     /* Mock receiving a "add alert" message */
-    uint8_t add_alert_bytes[36] = {
+    uint8_t add_alert_bytes[37] = {
         0x2,                 /* message id */
-        0x3,                 /* alert id */
+        0x3, 0x0,            /* alert id */
         0xA, 0x0, 0x0, 0x0,  /* Warmup period - 10 ms */
         0x14, 0x0, 0x0, 0x0, /* Cooldown period - 20 ms */
         0x0,                 /* notification type - connectivity disabled, LED disabled */
@@ -459,12 +545,12 @@ TEST_C(MsgTransceiver, AddAlert3)
         0x1,        /* Operator - less than or equal to */
         0xD3, 0xFE, /* Constraint value -301 -> -30.1 degrees Celsius */
     };
-    receive_cb(add_alert_bytes, 36, receive_cb_user_data);
+    receive_cb(add_alert_bytes, 37, receive_cb_user_data);
 
     CHECK_C(add_alert_cb_called);
     /* Validate constructed alert */
     const MsgTransceiverAlert *const alert = &add_alert_cb_alert;
-    CHECK_EQUAL_C_UBYTE(3, alert->alert_id);
+    CHECK_EQUAL_C_UINT(3, alert->alert_id);
     CHECK_EQUAL_C_ULONG(10, alert->warmup_period);
     CHECK_EQUAL_C_ULONG(20, alert->cooldown_period);
     CHECK_C(!(alert->notification_type.connectivity));
@@ -524,7 +610,7 @@ TEST_C(MsgTransceiver, AddAlertMessage2ValidBytes)
 {
     uint8_t bytes[2] = {
         0x2, /* message id */
-        0x1, /* alert id */
+        0x1, /* First byte of alert id */
     };
     receive_cb(bytes, 2, receive_cb_user_data);
 
@@ -535,9 +621,8 @@ TEST_C(MsgTransceiver, AddAlertMessage2ValidBytes)
 TEST_C(MsgTransceiver, AddAlertMessage3ValidBytes)
 {
     uint8_t bytes[3] = {
-        0x2, /* message id */
-        0x2, /* alert id */
-        0x1  /* First byte of warmup period */
+        0x2,      /* message id */
+        0x1, 0x0, /* alert id */
     };
     receive_cb(bytes, 3, receive_cb_user_data);
 
@@ -548,9 +633,9 @@ TEST_C(MsgTransceiver, AddAlertMessage3ValidBytes)
 TEST_C(MsgTransceiver, AddAlertMessage4ValidBytes)
 {
     uint8_t bytes[4] = {
-        0x2,     /* message id */
-        0x2,     /* alert id */
-        0x1, 0x5 /* First two bytes of warmup period */
+        0x2,      /* message id */
+        0x2, 0x0, /* alert id */
+        0x1       /* First byte of warmup period */
     };
     receive_cb(bytes, 4, receive_cb_user_data);
 
@@ -561,9 +646,9 @@ TEST_C(MsgTransceiver, AddAlertMessage4ValidBytes)
 TEST_C(MsgTransceiver, AddAlertMessage5ValidBytes)
 {
     uint8_t bytes[5] = {
-        0x2,          /* message id */
-        0x2,          /* alert id */
-        0x1, 0x5, 0x0 /* First three bytes of warmup period */
+        0x2,      /* message id */
+        0x2, 0x0, /* alert id */
+        0x1, 0x5  /* First two bytes of warmup period */
     };
     receive_cb(bytes, 5, receive_cb_user_data);
 
@@ -574,9 +659,9 @@ TEST_C(MsgTransceiver, AddAlertMessage5ValidBytes)
 TEST_C(MsgTransceiver, AddAlertMessage6ValidBytes)
 {
     uint8_t bytes[6] = {
-        0x2,               /* message id */
-        0x2,               /* alert id */
-        0x1, 0x5, 0x0, 0x0 /* warmup period */
+        0x2,          /* message id */
+        0x2, 0x0,     /* alert id */
+        0x1, 0x5, 0x0 /* First three bytes of warmup period */
     };
     receive_cb(bytes, 6, receive_cb_user_data);
 
@@ -587,10 +672,9 @@ TEST_C(MsgTransceiver, AddAlertMessage6ValidBytes)
 TEST_C(MsgTransceiver, AddAlertMessage7ValidBytes)
 {
     uint8_t bytes[7] = {
-        0x2,                 /* message id */
-        0x2,                 /* alert id */
-        0x1,  0x5, 0x0, 0x0, /* warmup period */
-        0x5A,                /* first byte of cooldown period */
+        0x2,               /* message id */
+        0x2, 0x0,          /* alert id */
+        0x1, 0x5, 0x0, 0x0 /* warmup period */
     };
     receive_cb(bytes, 7, receive_cb_user_data);
 
@@ -601,10 +685,10 @@ TEST_C(MsgTransceiver, AddAlertMessage7ValidBytes)
 TEST_C(MsgTransceiver, AddAlertMessage8ValidBytes)
 {
     uint8_t bytes[8] = {
-        0x2,                  /* message id */
-        0x2,                  /* alert id */
-        0x1,  0x5,  0x0, 0x0, /* warmup period */
-        0x5A, 0x11,           /* first two bytes of cooldown period */
+        0x2,                 /* message id */
+        0x2,  0x0,           /* alert id */
+        0x1,  0x5, 0x0, 0x0, /* warmup period */
+        0x5A,                /* first byte of cooldown period */
     };
     receive_cb(bytes, 8, receive_cb_user_data);
 
@@ -616,9 +700,9 @@ TEST_C(MsgTransceiver, AddAlertMessage9ValidBytes)
 {
     uint8_t bytes[9] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
-        0x5A, 0x11, 0x0,      /* first three bytes of cooldown period */
+        0x5A, 0x11,           /* first two bytes of cooldown period */
     };
     receive_cb(bytes, 9, receive_cb_user_data);
 
@@ -630,9 +714,9 @@ TEST_C(MsgTransceiver, AddAlertMessage10ValidBytes)
 {
     uint8_t bytes[10] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
-        0x5A, 0x11, 0x0, 0x0, /* cooldown period */
+        0x5A, 0x11, 0x0,      /* first three bytes of cooldown period */
     };
     receive_cb(bytes, 10, receive_cb_user_data);
 
@@ -644,10 +728,9 @@ TEST_C(MsgTransceiver, AddAlertMessage11ValidBytes)
 {
     uint8_t bytes[11] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period */
-        0x3,                  /* notification type - connectivity enabled, LED enabled */
     };
     receive_cb(bytes, 11, receive_cb_user_data);
 
@@ -659,11 +742,10 @@ TEST_C(MsgTransceiver, AddAlertMessage12ValidBytes)
 {
     uint8_t bytes[12] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
-        0x1,                  /* Led color - blue */
     };
     receive_cb(bytes, 12, receive_cb_user_data);
 
@@ -675,12 +757,11 @@ TEST_C(MsgTransceiver, AddAlertMessage13ValidBytes)
 {
     uint8_t bytes[13] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
         0x1,                  /* Led color - blue */
-        0x1,                  /* Led pattern - alert */
     };
     receive_cb(bytes, 13, receive_cb_user_data);
 
@@ -692,13 +773,12 @@ TEST_C(MsgTransceiver, AddAlertMessage14ValidBytes)
 {
     uint8_t bytes[14] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
         0x1,                  /* Led color - blue */
         0x1,                  /* Led pattern - alert */
-        0x1,                  /* Number of ORed requirements */
     };
     receive_cb(bytes, 14, receive_cb_user_data);
 
@@ -710,14 +790,13 @@ TEST_C(MsgTransceiver, AddAlertMessage15ValidBytes)
 {
     uint8_t bytes[15] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
         0x1,                  /* Led color - blue */
         0x1,                  /* Led pattern - alert */
         0x1,                  /* Number of ORed requirements */
-        0x1,                  /* Number of requirements in the first ORed requirement */
     };
     receive_cb(bytes, 15, receive_cb_user_data);
 
@@ -729,7 +808,7 @@ TEST_C(MsgTransceiver, AddAlertMessage16ValidBytes)
 {
     uint8_t bytes[16] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
@@ -737,7 +816,6 @@ TEST_C(MsgTransceiver, AddAlertMessage16ValidBytes)
         0x1,                  /* Led pattern - alert */
         0x1,                  /* Number of ORed requirements */
         0x1,                  /* Number of requirements in the first ORed requirement */
-        0x0,                  /* Start of var req 0: Temperature variable identifier */
     };
     receive_cb(bytes, 16, receive_cb_user_data);
 
@@ -749,7 +827,7 @@ TEST_C(MsgTransceiver, AddAlertMessage17ValidBytes)
 {
     uint8_t bytes[17] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
@@ -758,7 +836,6 @@ TEST_C(MsgTransceiver, AddAlertMessage17ValidBytes)
         0x1,                  /* Number of ORed requirements */
         0x1,                  /* Number of requirements in the first ORed requirement */
         0x0,                  /* Start of var req 0: Temperature variable identifier */
-        0x0,                  /* Operator - greater than or equal to */
     };
     receive_cb(bytes, 17, receive_cb_user_data);
 
@@ -770,7 +847,7 @@ TEST_C(MsgTransceiver, AddAlertMessage18ValidBytes)
 {
     uint8_t bytes[18] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
@@ -780,7 +857,6 @@ TEST_C(MsgTransceiver, AddAlertMessage18ValidBytes)
         0x1,                  /* Number of requirements in the first ORed requirement */
         0x0,                  /* Start of var req 0: Temperature variable identifier */
         0x0,                  /* Operator - greater than or equal to */
-        0x0,                  /* First byte of constraint value */
     };
     receive_cb(bytes, 18, receive_cb_user_data);
 
@@ -788,11 +864,33 @@ TEST_C(MsgTransceiver, AddAlertMessage18ValidBytes)
     CHECK_C(!remove_alert_cb_called);
 }
 
-TEST_C(MsgTransceiver, AddAlertMessage19ValidBytesValidAlert)
+TEST_C(MsgTransceiver, AddAlertMessage19ValidBytes)
 {
     uint8_t bytes[19] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
+        0x1,  0x5,  0x0, 0x0, /* warmup period */
+        0x5A, 0x11, 0x0, 0x0, /* cooldown period */
+        0x3,                  /* notification type - connectivity enabled, LED enabled */
+        0x1,                  /* Led color - blue */
+        0x1,                  /* Led pattern - alert */
+        0x1,                  /* Number of ORed requirements */
+        0x1,                  /* Number of requirements in the first ORed requirement */
+        0x0,                  /* Start of var req 0: Temperature variable identifier */
+        0x0,                  /* Operator - greater than or equal to */
+        0x0,                  /* First byte of constraint value */
+    };
+    receive_cb(bytes, 19, receive_cb_user_data);
+
+    CHECK_C(!add_alert_cb_called);
+    CHECK_C(!remove_alert_cb_called);
+}
+
+TEST_C(MsgTransceiver, AddAlertMessage20ValidBytesValidAlert)
+{
+    uint8_t bytes[20] = {
+        0x2,                  /* message id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period - 1281 ms */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period - 4442 ms */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
@@ -804,14 +902,14 @@ TEST_C(MsgTransceiver, AddAlertMessage19ValidBytesValidAlert)
         0x0,                  /* Operator - greater than or equal to */
         0x0,  0x0             /* Constraint value */
     };
-    receive_cb(bytes, 19, receive_cb_user_data);
+    receive_cb(bytes, 20, receive_cb_user_data);
 
     CHECK_C(add_alert_cb_called);
     CHECK_C(!remove_alert_cb_called);
 
     /* Validate constructed alert */
     const MsgTransceiverAlert *const alert = &add_alert_cb_alert;
-    CHECK_EQUAL_C_UBYTE(2, alert->alert_id);
+    CHECK_EQUAL_C_UINT(2, alert->alert_id);
     CHECK_EQUAL_C_ULONG(1281, alert->warmup_period);
     CHECK_EQUAL_C_ULONG(4442, alert->cooldown_period);
     CHECK_C(alert->notification_type.connectivity);
@@ -826,12 +924,12 @@ TEST_C(MsgTransceiver, AddAlertMessage19ValidBytesValidAlert)
     CHECK_C(requirement->is_last_in_ored_requirement);
 }
 
-TEST_C(MsgTransceiver, AddAlertMessage19ValidBytes)
+TEST_C(MsgTransceiver, AddAlertMessage20ValidBytes)
 {
     /* Invalid because there should be two requirements in the first ORed requirement, but there is only one */
-    uint8_t bytes[19] = {
+    uint8_t bytes[20] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
@@ -843,18 +941,18 @@ TEST_C(MsgTransceiver, AddAlertMessage19ValidBytes)
         0x0,                  /* Operator - greater than or equal to */
         0x0,  0x0             /* Constraint value */
     };
-    receive_cb(bytes, 19, receive_cb_user_data);
+    receive_cb(bytes, 20, receive_cb_user_data);
 
     CHECK_C(!add_alert_cb_called);
     CHECK_C(!remove_alert_cb_called);
 }
 
-TEST_C(MsgTransceiver, AddAlertMessage20ValidBytes)
+TEST_C(MsgTransceiver, AddAlertMessage21ValidBytes)
 {
     /* Invalid because there should be two requirements in the first ORed requirement, but there is only one */
-    uint8_t bytes[20] = {
+    uint8_t bytes[21] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
@@ -867,18 +965,18 @@ TEST_C(MsgTransceiver, AddAlertMessage20ValidBytes)
         0x0,  0x0,            /* Constraint value */
         0x1,                  /* Start of var req 1: Pressure variable identifier */
     };
-    receive_cb(bytes, 20, receive_cb_user_data);
+    receive_cb(bytes, 21, receive_cb_user_data);
 
     CHECK_C(!add_alert_cb_called);
     CHECK_C(!remove_alert_cb_called);
 }
 
-TEST_C(MsgTransceiver, AddAlertMessage21ValidBytes)
+TEST_C(MsgTransceiver, AddAlertMessage22ValidBytes)
 {
     /* Invalid because there should be two requirements in the first ORed requirement, but there is only one */
-    uint8_t bytes[21] = {
+    uint8_t bytes[22] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
@@ -892,18 +990,18 @@ TEST_C(MsgTransceiver, AddAlertMessage21ValidBytes)
         0x1,                  /* Start of var req 1: Pressure variable identifier */
         0x0,                  /* Operator - greater than or equal to */
     };
-    receive_cb(bytes, 21, receive_cb_user_data);
+    receive_cb(bytes, 22, receive_cb_user_data);
 
     CHECK_C(!add_alert_cb_called);
     CHECK_C(!remove_alert_cb_called);
 }
 
-TEST_C(MsgTransceiver, AddAlertMessage22ValidBytes)
+TEST_C(MsgTransceiver, AddAlertMessage23ValidBytes)
 {
     /* Invalid because there should be two requirements in the first ORed requirement, but there is only one */
-    uint8_t bytes[22] = {
+    uint8_t bytes[23] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
@@ -918,17 +1016,17 @@ TEST_C(MsgTransceiver, AddAlertMessage22ValidBytes)
         0x0,                  /* Operator - greater than or equal to */
         0x0,                  /* First byte of constraint value */
     };
-    receive_cb(bytes, 22, receive_cb_user_data);
+    receive_cb(bytes, 23, receive_cb_user_data);
 
     CHECK_C(!add_alert_cb_called);
     CHECK_C(!remove_alert_cb_called);
 }
 
-TEST_C(MsgTransceiver, AddAlertMessage17ValidBytesHumidity)
+TEST_C(MsgTransceiver, AddAlertMessage18ValidBytesHumidity)
 {
-    uint8_t bytes[17] = {
+    uint8_t bytes[18] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
@@ -939,17 +1037,17 @@ TEST_C(MsgTransceiver, AddAlertMessage17ValidBytesHumidity)
         0x2,                  /* Start of var req 0: Humidity variable identifier */
         0x1,                  /* Operator - less than or equal to */
     };
-    receive_cb(bytes, 17, receive_cb_user_data);
+    receive_cb(bytes, 18, receive_cb_user_data);
 
     CHECK_C(!add_alert_cb_called);
     CHECK_C(!remove_alert_cb_called);
 }
 
-TEST_C(MsgTransceiver, AddAlertMessage18ValidBytesHumidity)
+TEST_C(MsgTransceiver, AddAlertMessage19ValidBytesHumidity)
 {
-    uint8_t bytes[18] = {
+    uint8_t bytes[19] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
@@ -961,17 +1059,17 @@ TEST_C(MsgTransceiver, AddAlertMessage18ValidBytesHumidity)
         0x1,                  /* Operator - less than or equal to */
         0x0,                  /* First byte of constraint value */
     };
-    receive_cb(bytes, 18, receive_cb_user_data);
+    receive_cb(bytes, 19, receive_cb_user_data);
 
     CHECK_C(!add_alert_cb_called);
     CHECK_C(!remove_alert_cb_called);
 }
 
-TEST_C(MsgTransceiver, AddAlertMessage17ValidBytesLightIntensity)
+TEST_C(MsgTransceiver, AddAlertMessage18ValidBytesLightIntensity)
 {
-    uint8_t bytes[17] = {
+    uint8_t bytes[18] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
@@ -982,17 +1080,17 @@ TEST_C(MsgTransceiver, AddAlertMessage17ValidBytesLightIntensity)
         0x3,                  /* Start of var req 0: Light intensity variable identifier */
         0x1,                  /* Operator - less than or equal to */
     };
-    receive_cb(bytes, 17, receive_cb_user_data);
+    receive_cb(bytes, 18, receive_cb_user_data);
 
     CHECK_C(!add_alert_cb_called);
     CHECK_C(!remove_alert_cb_called);
 }
 
-TEST_C(MsgTransceiver, AddAlertMessage18ValidBytesLightIntensity)
+TEST_C(MsgTransceiver, AddAlertMessage19ValidBytesLightIntensity)
 {
-    uint8_t bytes[18] = {
+    uint8_t bytes[19] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
@@ -1004,17 +1102,17 @@ TEST_C(MsgTransceiver, AddAlertMessage18ValidBytesLightIntensity)
         0x1,                  /* Operator - less than or equal to */
         0x0,                  /* First byte of constraint value */
     };
-    receive_cb(bytes, 18, receive_cb_user_data);
+    receive_cb(bytes, 19, receive_cb_user_data);
 
     CHECK_C(!add_alert_cb_called);
     CHECK_C(!remove_alert_cb_called);
 }
 
-TEST_C(MsgTransceiver, AddAlertMessage19ValidBytesLightIntensity)
+TEST_C(MsgTransceiver, AddAlertMessage20ValidBytesLightIntensity)
 {
-    uint8_t bytes[19] = {
+    uint8_t bytes[20] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
@@ -1026,17 +1124,17 @@ TEST_C(MsgTransceiver, AddAlertMessage19ValidBytesLightIntensity)
         0x1,                  /* Operator - less than or equal to */
         0x0,  0xA5,           /* First two bytes of constraint value */
     };
-    receive_cb(bytes, 19, receive_cb_user_data);
+    receive_cb(bytes, 20, receive_cb_user_data);
 
     CHECK_C(!add_alert_cb_called);
     CHECK_C(!remove_alert_cb_called);
 }
 
-TEST_C(MsgTransceiver, AddAlertMessage20ValidBytesLightIntensity)
+TEST_C(MsgTransceiver, AddAlertMessage21ValidBytesLightIntensity)
 {
-    uint8_t bytes[20] = {
+    uint8_t bytes[21] = {
         0x2,                   /* message id */
-        0x2,                   /* alert id */
+        0x2,  0x0,             /* alert id */
         0x1,  0x5,  0x0,  0x0, /* warmup period */
         0x5A, 0x11, 0x0,  0x0, /* cooldown period */
         0x3,                   /* notification type - connectivity enabled, LED enabled */
@@ -1048,7 +1146,7 @@ TEST_C(MsgTransceiver, AddAlertMessage20ValidBytesLightIntensity)
         0x1,                   /* Operator - less than or equal to */
         0x0,  0xA5, 0x05,      /* First three bytes of constraint value */
     };
-    receive_cb(bytes, 20, receive_cb_user_data);
+    receive_cb(bytes, 21, receive_cb_user_data);
 
     CHECK_C(!add_alert_cb_called);
     CHECK_C(!remove_alert_cb_called);
@@ -1056,9 +1154,9 @@ TEST_C(MsgTransceiver, AddAlertMessage20ValidBytesLightIntensity)
 
 TEST_C(MsgTransceiver, AddAlertInvalidNotificationType)
 {
-    uint8_t add_alert_bytes[19] = {
+    uint8_t add_alert_bytes[20] = {
         0x2,                 /* message id */
-        0x1,                 /* alert id */
+        0x1, 0x0,            /* alert id */
         0xE8, 0x3, 0x0, 0x0, /* Warmup period - 1000 ms */
         0xD0, 0x7, 0x0, 0x0, /* Cooldown period - 2000 ms */
         0x13,                /* Invalid notification type - bit other than 0 and 1 is set */
@@ -1071,7 +1169,7 @@ TEST_C(MsgTransceiver, AddAlertInvalidNotificationType)
         0x1,      /* Operator - less than or equal to */
         0xE7, 0x3 /* Constraint value - 999 hPa */
     };
-    receive_cb(add_alert_bytes, 19, receive_cb_user_data);
+    receive_cb(add_alert_bytes, 20, receive_cb_user_data);
 
     CHECK_C(!add_alert_cb_called);
     CHECK_C(!remove_alert_cb_called);
@@ -1079,9 +1177,9 @@ TEST_C(MsgTransceiver, AddAlertInvalidNotificationType)
 
 TEST_C(MsgTransceiver, AddAlertInvalidVariableIdentifier)
 {
-    uint8_t add_alert_bytes[19] = {
+    uint8_t add_alert_bytes[20] = {
         0x2,                 /* message id */
-        0x1,                 /* alert id */
+        0x1, 0x0,            /* alert id */
         0xE8, 0x3, 0x0, 0x0, /* Warmup period - 1000 ms */
         0xD0, 0x7, 0x0, 0x0, /* Cooldown period - 2000 ms */
         0x3,                 /* notification type - connectivity enabled, LED enabled */
@@ -1094,7 +1192,7 @@ TEST_C(MsgTransceiver, AddAlertInvalidVariableIdentifier)
         0x1,     /* Operator - less than or equal to */
         0x0, 0x0 /* Some constraint value, number of bytes is random since we do not know variable identifier */
     };
-    receive_cb(add_alert_bytes, 19, receive_cb_user_data);
+    receive_cb(add_alert_bytes, 20, receive_cb_user_data);
 
     CHECK_C(!add_alert_cb_called);
     CHECK_C(!remove_alert_cb_called);
@@ -1103,9 +1201,9 @@ TEST_C(MsgTransceiver, AddAlertInvalidVariableIdentifier)
 TEST_C(MsgTransceiver, AddAlertNumBytesTooLarge)
 {
     /* The structure is valid, but has one extra byte at the end */
-    uint8_t bytes[20] = {
+    uint8_t bytes[21] = {
         0x2,                  /* message id */
-        0x2,                  /* alert id */
+        0x2,  0x0,            /* alert id */
         0x1,  0x5,  0x0, 0x0, /* warmup period */
         0x5A, 0x11, 0x0, 0x0, /* cooldown period */
         0x3,                  /* notification type - connectivity enabled, LED enabled */
@@ -1118,93 +1216,492 @@ TEST_C(MsgTransceiver, AddAlertNumBytesTooLarge)
         0x0,  0x0,            /* Constraint value */
         0x0                   /* Random excess byte */
     };
-    receive_cb(bytes, 20, receive_cb_user_data);
+    receive_cb(bytes, 21, receive_cb_user_data);
 
     CHECK_C(!add_alert_cb_called);
     CHECK_C(!remove_alert_cb_called);
 }
 
-TEST_C(MsgTransceiver, DeinitClearsRemoveAlertCb)
+TEST_C(MsgTransceiver, AddAlertExpression)
 {
-    /* Expected to be called in msg_transceiver_deinit */
-    mock_c()->expectOneCall("transceiver_unset_receive_cb");
-    /* Expected to be called in msg_transceiver_init */
-    mock_c()->expectOneCall("transceiver_set_receive_cb")->ignoreOtherParameters();
+    /* (Temperature >= 25.0 AND Humidity >= 70.0) OR Pressure <= 980.0 */
+    uint8_t add_alert_bytes[28] = {
+        0x2,                /* message id */
+        0x3, 0x0,           /* alert id */
+        0x0, 0x0, 0x0, 0x0, /* Warmup period - 0 ms */
+        0x0, 0x0, 0x0, 0x0, /* Cooldown period - 0 ms */
+        0x1,                /* notification type - connectivity enabled, LED disabled */
+        0x1,                /* Number of ORed requirements */
+        0x2,                /* Number of operands in the first ORed requirement */
+        0x80,               /* Start of operand 0: AND expression */
+        0x2,                /* Number of operands of the AND expression */
+        /* Start of variable requirement 0 */
+        0x0,       /* Temperature variable identifier */
+        0x0,       /* Operator - greater than or equal to */
+        0xFA, 0x0, /* Constraint value - 25.0 degrees Celsius */
+        /* Start of variable requirement 1 */
+        0x2,       /* Humidity variable identifier */
+        0x0,       /* Operator - greater than or equal to */
+        0xBC, 0x2, /* Constraint value - 70.0 % */
+        /* Start of operand 1: variable requirement 2 */
+        0x1,       /* Pressure variable identifier */
+        0x1,       /* Operator - less than or equal to */
+        0x48, 0x26 /* Constraint value - 980.0 hPa */
+    };
+    receive_cb(add_alert_bytes, 28, receive_cb_user_data);
 
-    /* msg_transceiver_set_remove_alert_cb is called as a part of the test setup, so remove alert callback is initially
-     * set */
+    CHECK_C(add_alert_cb_called);
+    const MsgTransceiverAlertCondition *const alert_condition = &add_alert_cb_alert.alert_condition;
+    CHECK_EQUAL_C_UBYTE(3, alert_condition->num_variable_requirements);
 
-    /* Mock receiving a "remove alert" message. 0x1 - message id, 0 - alert id */
-    uint8_t remove_alert_bytes[2] = {0x1, 0};
-    receive_cb(remove_alert_bytes, 2, receive_cb_user_data);
-    /* remove_alert_cb should have been called, since the callback is set */
-    CHECK_C(remove_alert_cb_called);
+    const MsgTransceiverVariableRequirement *requirement = &(alert_condition->variable_requirements[0]);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_TEMPERATURE, requirement->variable_identifier);
+    CHECK_EQUAL_C_LONG(250, requirement->constraint_value.temperature);
+    CHECK_EQUAL_C_UBYTE(1, requirement->num_begun_expressions);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_EXPRESSION_OPERATOR_AND, requirement->begun_expression_operators[0]);
+    CHECK_EQUAL_C_UBYTE(0, requirement->num_ended_expressions);
+    CHECK_C(!requirement->is_last_in_ored_requirement);
+
+    requirement = &(alert_condition->variable_requirements[1]);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_HUMIDITY, requirement->variable_identifier);
+    CHECK_EQUAL_C_UINT(700, requirement->constraint_value.humidity);
+    CHECK_EQUAL_C_UBYTE(0, requirement->num_begun_expressions);
+    CHECK_EQUAL_C_UBYTE(1, requirement->num_ended_expressions);
+    CHECK_C(!requirement->is_last_in_ored_requirement);
+
+    requirement = &(alert_condition->variable_requirements[2]);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_PRESSURE, requirement->variable_identifier);
+    CHECK_EQUAL_C_UINT(9800, requirement->constraint_value.pressure);
+    CHECK_EQUAL_C_UBYTE(0, requirement->num_begun_expressions);
+    CHECK_EQUAL_C_UBYTE(0, requirement->num_ended_expressions);
+    CHECK_C(requirement->is_last_in_ored_requirement);
+}
 
-    msg_transceiver_deinit();
-    msg_transceiver_init();
+TEST_C(MsgTransceiver, AddAlertNestedExpressions)
+{
+    /* NOT (Temperature >= 0 OR Light intensity <= 100) AND Humidity >= 0 */
+    uint8_t add_alert_bytes[32] = {
+        0x2,                 /* message id */
+        0x4, 0x0,            /* alert id */
+        0x0, 0x0, 0x0, 0x0,  /* Warmup period - 0 ms */
+        0x0, 0x0, 0x0, 0x0,  /* Cooldown period - 0 ms */
+        0x1,                 /* notification type - connectivity enabled, LED disabled */
+        0x2,                 /* Number of ORed requirements */
+        0x1,                 /* Number of operands in the first ORed requirement */
+        0x82,                /* Start of operand 0: NOT expression */
+        0x81,                /* Operand of the NOT expression: OR expression */
+        0x2,                 /* Number of operands of the OR expression */
+        0x0,                 /* Start of var req 0: Temperature variable identifier */
+        0x0,                 /* Operator - greater than or equal to */
+        0x0,  0x0,           /* Constraint value */
+        0x3,                 /* Start of var req 1: Light intensity variable identifier */
+        0x1,                 /* Operator - less than or equal to */
+        0x64, 0x0, 0x0, 0x0, /* Constraint value - 100 lux */
+        0x1,                 /* Number of operands in the second ORed requirement */
+        0x2,                 /* Start of var req 2: Humidity variable identifier */
+        0x0,                 /* Operator - greater than or equal to */
+        0x0,  0x0            /* Constraint value */
+    };
+    receive_cb(add_alert_bytes, 32, receive_cb_user_data);
 
-    /* deinit should have cleared the callback, so now we expect remove alert cb to not be called */
-    remove_alert_cb_called = false;
-    receive_cb(remove_alert_bytes, 2, receive_cb_user_data);
-    CHECK_C(!remove_alert_cb_called);
+    CHECK_C(add_alert_cb_called);
+    const MsgTransceiverAlertCondition *const alert_condition = &add_alert_cb_alert.alert_condition;
+    CHECK_EQUAL_C_UBYTE(3, alert_condition->num_variable_requirements);
+
+    const MsgTransceiverVariableRequirement *requirement = &(alert_condition->variable_requirements[0]);
+    CHECK_EQUAL_C_UBYTE(2, requirement->num_begun_expressions);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_EXPRESSION_OPERATOR_NOT, requirement->begun_expression_operators[0]);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_EXPRESSION_OPERATOR_OR, requirement->begun_expression_operators[1]);
+    CHECK_EQUAL_C_UBYTE(0, requirement->num_ended_expressions);
+    CHECK_C(!requirement->is_last_in_ored_requirement);
+
+    requirement = &(alert_condition->variable_requirements[1]);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_LIGHT_INTENSITY, requirement->variable_identifier);
+    CHECK_EQUAL_C_ULONG(100, requirement->constraint_value.light_intensity);
+    CHECK_EQUAL_C_UBYTE(0, requirement->num_begun_expressions);
+    CHECK_EQUAL_C_UBYTE(2, requirement->num_ended_expressions);
+    CHECK_C(requirement->is_last_in_ored_requirement);
+
+    requirement = &(alert_condition->variable_requirements[2]);
+    CHECK_EQUAL_C_UBYTE(0, requirement->num_begun_expressions);
+    CHECK_EQUAL_C_UBYTE(0, requirement->num_ended_expressions);
+    CHECK_C(requirement->is_last_in_ored_requirement);
 }
 
-TEST_C(MsgTransceiver, DeinitClearsAddAlertCb)
+TEST_C(MsgTransceiver, AddAlertExpressionInvalidOperator)
 {
-    /* Expected to be called in msg_transceiver_deinit */
-    mock_c()->expectOneCall("transceiver_unset_receive_cb");
-    /* Expected to be called in msg_transceiver_init */
-    mock_c()->expectOneCall("transceiver_set_receive_cb")->ignoreOtherParameters();
+    uint8_t add_alert_bytes[19] = {
+        0x2,                /* message id */
+        0x0, 0x0,           /* alert id */
+        0x0, 0x0, 0x0, 0x0, /* Warmup period - 0 ms */
+        0x0, 0x0, 0x0, 0x0, /* Cooldown period - 0 ms */
+        0x1,                /* notification type - connectivity enabled, LED disabled */
+        0x1,                /* Number of ORed requirements */
+        0x1,                /* Number of operands in the first ORed requirement */
+        0x83,               /* Invalid expression operator */
+        0x0,                /* Start of var req 0: Temperature variable identifier */
+        0x0,                /* Operator - greater than or equal to */
+        0x0,  0x0           /* Constraint value */
+    };
+    receive_cb(add_alert_bytes, 19, receive_cb_user_data);
 
-    /* msg_transceiver_set_add_alert_cb is called as a part of the test setup, so add alert callback is initially set */
+    CHECK_C(!add_alert_cb_called);
+}
 
-    /* Mock receiving a "add alert" message */
-    uint8_t add_alert_bytes[17] = {
+TEST_C(MsgTransceiver, AddAlertExpressionZeroOperands)
+{
+    uint8_t add_alert_bytes[20] = {
         0x2,                /* message id */
-        0x0,                /* alert id */
+        0x0, 0x0,           /* alert id */
         0x0, 0x0, 0x0, 0x0, /* Warmup period - 0 ms */
         0x0, 0x0, 0x0, 0x0, /* Cooldown period - 0 ms */
         0x1,                /* notification type - connectivity enabled, LED disabled */
         0x1,                /* Number of ORed requirements */
-        0x1,                /* Number of variable requirements in the first ORed requirement */
-        /* Start of variable requirement 0 */
-        0x0,     /* Temperature variable identifier */
-        0x0,     /* Operator - greater than or equal to */
-        0x0, 0x0 /* Constraint value - 0 degrees Celsius */
+        0x2,                /* Number of operands in the first ORed requirement */
+        0x80,               /* Start of operand 0: AND expression */
+        0x0,                /* Number of operands of the AND expression - invalid */
+        0x0,                /* Start of operand 1: Temperature variable identifier */
+        0x0,                /* Operator - greater than or equal to */
+        0x0,  0x0           /* Constraint value */
     };
-    receive_cb(add_alert_bytes, 17, receive_cb_user_data);
-    /* add_alert_cb should have been called, since the callback is set */
-    CHECK_C(add_alert_cb_called);
+    receive_cb(add_alert_bytes, 20, receive_cb_user_data);
 
-    msg_transceiver_deinit();
-    msg_transceiver_init();
-
-    /* deinit should have cleared the callback, so now we expect add alert cb to not be called */
-    add_alert_cb_called = false;
-    receive_cb(add_alert_bytes, 17, receive_cb_user_data);
     CHECK_C(!add_alert_cb_called);
 }
 
-TEST_C(MsgTransceiver, AddAlertTooManyVariableRequirements)
+TEST_C(MsgTransceiver, AddAlertExpressionMaxDepthExceeded)
 {
-    /* Mock receiving a "add alert" message */
-    uint8_t add_alert_bytes[60] = {
-        0x2,                 /* message id */
-        0x3,                 /* alert id */
-        0xA, 0x0, 0x0, 0x0,  /* Warmup period - 10 ms */
-        0x14, 0x0, 0x0, 0x0, /* Cooldown period - 20 ms */
-        0x0,                 /* notification type - connectivity disabled, LED disabled */
-        0x2,                 /* Number of ORed requirements */
+    /* One NOT expression more than allowed, nested */
+    uint8_t add_alert_bytes[14 + CONFIG_MSG_TRANSCEIVER_MAX_EXPRESSION_DEPTH + 1 + 4] = {
+        0x2,                /* message id */
+        0x0, 0x0,           /* alert id */
+        0x0, 0x0, 0x0, 0x0, /* Warmup period - 0 ms */
+        0x0, 0x0, 0x0, 0x0, /* Cooldown period - 0 ms */
+        0x1,                /* notification type - connectivity enabled, LED disabled */
+        0x1,                /* Number of ORed requirements */
+        0x1                 /* Number of operands in the first ORed requirement */
+    };
+    size_t index = 14;
+    for (size_t i = 0; i < CONFIG_MSG_TRANSCEIVER_MAX_EXPRESSION_DEPTH + 1; i++) {
+        add_alert_bytes[index++] = 0x82; /* NOT expression */
+    }
+    add_alert_bytes[index++] = 0x0; /* Temperature variable identifier */
+    add_alert_bytes[index++] = 0x0; /* Operator - greater than or equal to */
+    add_alert_bytes[index++] = 0x0; /* Constraint value */
+    add_alert_bytes[index++] = 0x0;
+    receive_cb(add_alert_bytes, index, receive_cb_user_data);
 
-        /* Start of first ORed requirement */
-        0x2, /* Number of variable requirements in the first ORed requirement */
+    CHECK_C(!add_alert_cb_called);
+}
 
+TEST_C(MsgTransceiver, AddAlertBandRequirements)
+{
+    /* Temperature inside [18.0, 24.0] AND Light intensity outside [100, 5000] */
+    uint8_t add_alert_bytes[31] = {
+        0x2,                /* message id */
+        0x4, 0x0,           /* alert id */
+        0x0, 0x0, 0x0, 0x0, /* Warmup period - 0 ms */
+        0x0, 0x0, 0x0, 0x0, /* Cooldown period - 0 ms */
+        0x1,                /* notification type - connectivity enabled, LED disabled */
+        0x2,                /* Number of ORed requirements */
+        0x1,                /* Number of operands in the first ORed requirement */
         /* Start of variable requirement 0 */
         0x0,       /* Temperature variable identifier */
-        0x0,       /* Operator - greater than or equal to */
-        0xCD, 0x0, /* Constraint value 205 -> 20.5 degrees Celsius */
+        0x2,       /* Operator - inside */
+        0xB4, 0x0, /* Lower constraint value - 18.0 degrees Celsius */
+        0xF0, 0x0, /* Upper constraint value - 24.0 degrees Celsius */
+        0x1,       /* Number of operands in the second ORed requirement */
         /* Start of variable requirement 1 */
-        0x1,        /* Pressure variable identifier */
+        0x3,                 /* Light intensity variable identifier */
+        0x3,                 /* Operator - outside */
+        0x64, 0x0, 0x0, 0x0, /* Lower constraint value - 100 lx */
+        0x88, 0x13, 0x0, 0x0 /* Upper constraint value - 5000 lx */
+    };
+    receive_cb(add_alert_bytes, 31, receive_cb_user_data);
+
+    CHECK_C(add_alert_cb_called);
+    const MsgTransceiverAlertCondition *const alert_condition = &add_alert_cb_alert.alert_condition;
+    CHECK_EQUAL_C_UBYTE(2, alert_condition->num_variable_requirements);
+
+    const MsgTransceiverVariableRequirement *requirement = &(alert_condition->variable_requirements[0]);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_TEMPERATURE, requirement->variable_identifier);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_INSIDE, requirement->operator);
+    CHECK_EQUAL_C_LONG(180, requirement->constraint_value.temperature);
+    CHECK_EQUAL_C_LONG(240, requirement->upper_constraint_value.temperature);
+    CHECK_C(requirement->is_last_in_ored_requirement);
+
+    requirement = &(alert_condition->variable_requirements[1]);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_LIGHT_INTENSITY, requirement->variable_identifier);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_OUTSIDE, requirement->operator);
+    CHECK_EQUAL_C_ULONG(100, requirement->constraint_value.light_intensity);
+    CHECK_EQUAL_C_ULONG(5000, requirement->upper_constraint_value.light_intensity);
+    CHECK_C(requirement->is_last_in_ored_requirement);
+}
+
+TEST_C(MsgTransceiver, AddAlertBandRequirementWithoutUpperConstraintValue)
+{
+    uint8_t add_alert_bytes[19] = {
+        0x2,                /* message id */
+        0x4, 0x0,           /* alert id */
+        0x0, 0x0, 0x0, 0x0, /* Warmup period - 0 ms */
+        0x0, 0x0, 0x0, 0x0, /* Cooldown period - 0 ms */
+        0x1,                /* notification type - connectivity enabled, LED disabled */
+        0x1,                /* Number of ORed requirements */
+        0x1,                /* Number of operands in the first ORed requirement */
+        0x0,                /* Start of var req 0: Temperature variable identifier */
+        0x2,                /* Operator - inside */
+        0xB4, 0x0           /* Lower constraint value - 18.0 degrees Celsius */
+    };
+    receive_cb(add_alert_bytes, 19, receive_cb_user_data);
+
+    /* The alert is incomplete until the upper constraint value is received */
+    CHECK_C(!add_alert_cb_called);
+}
+
+TEST_C(MsgTransceiver, AddAlertSplitIntoContinuationMessages)
+{
+    /* The alert is split into three fragments. The split between the first two fragments is in the middle of the
+     * warmup period field. */
+    uint8_t add_alert_bytes[6] = {
+        0x2,            /* message id */
+        0x7,  0x1,      /* alert id */
+        0x10, 0x27, 0x0 /* First three bytes of warmup period */
+    };
+    uint8_t continuation_0_bytes[8] = {
+        0xA,                  /* message id */
+        0x0,                  /* Last byte of warmup period - 10000 ms */
+        0x20, 0x4E, 0x0, 0x0, /* Cooldown period - 20000 ms */
+        0x1,                  /* notification type - connectivity enabled, LED disabled */
+        0x1                   /* Number of ORed requirements */
+    };
+    uint8_t continuation_1_bytes[8] = {
+        0xA, /* message id */
+        0x1, /* Number of variable requirements in the first ORed requirement */
+        /* Start of variable requirement 0 */
+        0x3,                 /* Light intensity variable identifier */
+        0x1,                 /* Operator - less than or equal to */
+        0x40, 0xE2, 0x1, 0x0 /* Constraint value - 123456 lux */
+    };
+
+    receive_cb(add_alert_bytes, 6, receive_cb_user_data);
+    CHECK_C(!add_alert_cb_called);
+    receive_cb(continuation_0_bytes, 8, receive_cb_user_data);
+    CHECK_C(!add_alert_cb_called);
+    receive_cb(continuation_1_bytes, 8, receive_cb_user_data);
+
+    CHECK_C(add_alert_cb_called);
+    /* Validate constructed alert */
+    const MsgTransceiverAlert *const alert = &add_alert_cb_alert;
+    CHECK_EQUAL_C_UINT(263, alert->alert_id);
+    CHECK_EQUAL_C_ULONG(10000, alert->warmup_period);
+    CHECK_EQUAL_C_ULONG(20000, alert->cooldown_period);
+    CHECK_C(alert->notification_type.connectivity);
+    CHECK_C(!(alert->notification_type.led));
+    CHECK_EQUAL_C_UBYTE(1, alert->alert_condition.num_variable_requirements);
+    const MsgTransceiverVariableRequirement *requirement = &(alert->alert_condition.variable_requirements[0]);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_LIGHT_INTENSITY, requirement->variable_identifier);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_LEQ, requirement->operator);
+    CHECK_EQUAL_C_ULONG(123456, requirement->constraint_value.light_intensity);
+    CHECK_C(requirement->is_last_in_ored_requirement);
+}
+
+TEST_C(MsgTransceiver, AddAlertContinuationWithoutAddAlert)
+{
+    /* A valid alert, but there is no "add alert" message that the continuation belongs to */
+    uint8_t continuation_bytes[18] = {
+        0xA,                /* message id */
+        0x0, 0x0,           /* alert id */
+        0x0, 0x0, 0x0, 0x0, /* Warmup period - 0 ms */
+        0x0, 0x0, 0x0, 0x0, /* Cooldown period - 0 ms */
+        0x1,                /* notification type - connectivity enabled, LED disabled */
+        0x1,                /* Number of ORed requirements */
+        0x1,                /* Number of variable requirements in the first ORed requirement */
+        /* Start of variable requirement 0 */
+        0x0,     /* Temperature variable identifier */
+        0x0,     /* Operator - greater than or equal to */
+        0x0, 0x0 /* Constraint value - 0 degrees Celsius */
+    };
+    receive_cb(continuation_bytes, 18, receive_cb_user_data);
+
+    CHECK_C(!add_alert_cb_called);
+}
+
+TEST_C(MsgTransceiver, AddAlertContinuationAfterInvalidAddAlert)
+{
+    uint8_t add_alert_bytes[12] = {
+        0x2,                /* message id */
+        0x0, 0x0,           /* alert id */
+        0x0, 0x0, 0x0, 0x0, /* Warmup period - 0 ms */
+        0x0, 0x0, 0x0, 0x0, /* Cooldown period - 0 ms */
+        0x4                 /* Invalid notification type */
+    };
+    uint8_t continuation_bytes[7] = {
+        0xA,     /* message id */
+        0x1,     /* Number of ORed requirements */
+        0x1,     /* Number of variable requirements in the first ORed requirement */
+        0x0,     /* Start of var req 0: Temperature variable identifier */
+        0x0,     /* Operator - greater than or equal to */
+        0x0, 0x0 /* Constraint value */
+    };
+    receive_cb(add_alert_bytes, 12, receive_cb_user_data);
+    receive_cb(continuation_bytes, 7, receive_cb_user_data);
+
+    CHECK_C(!add_alert_cb_called);
+}
+
+TEST_C(MsgTransceiver, AddAlertContinuationNumBytesTooLarge)
+{
+    uint8_t add_alert_bytes[12] = {
+        0x2,                /* message id */
+        0x0, 0x0,           /* alert id */
+        0x0, 0x0, 0x0, 0x0, /* Warmup period - 0 ms */
+        0x0, 0x0, 0x0, 0x0, /* Cooldown period - 0 ms */
+        0x1                 /* notification type - connectivity enabled, LED disabled */
+    };
+    /* The alert is complete after the constraint value, but there is one extra byte at the end */
+    uint8_t continuation_bytes[8] = {
+        0xA,      /* message id */
+        0x1,      /* Number of ORed requirements */
+        0x1,      /* Number of variable requirements in the first ORed requirement */
+        0x0,      /* Start of var req 0: Temperature variable identifier */
+        0x0,      /* Operator - greater than or equal to */
+        0x0, 0x0, /* Constraint value */
+        0x0       /* Random excess byte */
+    };
+    receive_cb(add_alert_bytes, 12, receive_cb_user_data);
+    receive_cb(continuation_bytes, 8, receive_cb_user_data);
+
+    CHECK_C(!add_alert_cb_called);
+}
+
+TEST_C(MsgTransceiver, AddAlertDropsIncompleteAlert)
+{
+    /* Incomplete alert with id 5 */
+    uint8_t incomplete_add_alert_bytes[5] = {
+        0x2,      /* message id */
+        0x5, 0x0, /* alert id */
+        0x0, 0x0  /* First two bytes of warmup period */
+    };
+    uint8_t add_alert_bytes[18] = {
+        0x2,                /* message id */
+        0x6, 0x0,           /* alert id */
+        0x0, 0x0, 0x0, 0x0, /* Warmup period - 0 ms */
+        0x0, 0x0, 0x0, 0x0, /* Cooldown period - 0 ms */
+        0x1,                /* notification type - connectivity enabled, LED disabled */
+        0x1,                /* Number of ORed requirements */
+        0x1,                /* Number of variable requirements in the first ORed requirement */
+        /* Start of variable requirement 0 */
+        0x2,      /* Humidity variable identifier */
+        0x0,      /* Operator - greater than or equal to */
+        0x32, 0x0 /* Constraint value - 50 % */
+    };
+    /* Would complete the alert with id 5, if it was not dropped */
+    uint8_t continuation_bytes[16] = {
+        0xA,                /* message id */
+        0x0, 0x0,           /* Last two bytes of warmup period */
+        0x0, 0x0, 0x0, 0x0, /* Cooldown period - 0 ms */
+        0x1,                /* notification type - connectivity enabled, LED disabled */
+        0x1,                /* Number of ORed requirements */
+        0x1,                /* Number of variable requirements in the first ORed requirement */
+        0x0,                /* Start of var req 0: Temperature variable identifier */
+        0x0,                /* Operator - greater than or equal to */
+        0x0, 0x0,           /* Constraint value */
+        0x0, 0x0            /* Excess bytes, unless the alert with id 5 was dropped */
+    };
+    receive_cb(incomplete_add_alert_bytes, 5, receive_cb_user_data);
+    receive_cb(add_alert_bytes, 18, receive_cb_user_data);
+
+    CHECK_C(add_alert_cb_called);
+    CHECK_EQUAL_C_UINT(6, add_alert_cb_alert.alert_id);
+    CHECK_EQUAL_C_ULONG(50, add_alert_cb_alert.alert_condition.variable_requirements[0].constraint_value.humidity);
+
+    /* The alert with id 6 is complete, so there is no alert that the continuation belongs to */
+    add_alert_cb_called = false;
+    receive_cb(continuation_bytes, 16, receive_cb_user_data);
+    CHECK_C(!add_alert_cb_called);
+}
+
+TEST_C(MsgTransceiver, DeinitClearsRemoveAlertCb)
+{
+    /* Expected to be called in msg_transceiver_deinit */
+    mock_c()->expectOneCall("transceiver_unset_receive_cb");
+    /* Expected to be called in msg_transceiver_init */
+    mock_c()->expectOneCall("transceiver_set_receive_cb")->ignoreOtherParameters();
+
+    /* msg_transceiver_set_remove_alert_cb is called as a part of the test setup, so remove alert callback is initially
+     * set */
+
+    /* Mock receiving a "remove alert" message. 0x1 - message id, 0 - alert id */
+    uint8_t remove_alert_bytes[3] = {0x1, 0, 0};
+    receive_cb(remove_alert_bytes, 3, receive_cb_user_data);
+    /* remove_alert_cb should have been called, since the callback is set */
+    CHECK_C(remove_alert_cb_called);
+
+    msg_transceiver_deinit();
+    msg_transceiver_init();
+
+    /* deinit should have cleared the callback, so now we expect remove alert cb to not be called */
+    remove_alert_cb_called = false;
+    receive_cb(remove_alert_bytes, 3, receive_cb_user_data);
+    CHECK_C(!remove_alert_cb_called);
+}
+
+TEST_C(MsgTransceiver, DeinitClearsAddAlertCb)
+{
+    /* Expected to be called in msg_transceiver_deinit */
+    mock_c()->expectOneCall("transceiver_unset_receive_cb");
+    /* Expected to be called in msg_transceiver_init */
+    mock_c()->expectOneCall("transceiver_set_receive_cb")->ignoreOtherParameters();
+
+    /* msg_transceiver_set_add_alert_cb is called as a part of the test setup, so add alert callback is initially set */
+
+    /* Mock receiving a "add alert" message */
+    uint8_t add_alert_bytes[18] = {
+        0x2,                /* message id */
+        0x0, 0x0,           /* alert id */
+        0x0, 0x0, 0x0, 0x0, /* Warmup period - 0 ms */
+        0x0, 0x0, 0x0, 0x0, /* Cooldown period - 0 ms */
+        0x1,                /* notification type - connectivity enabled, LED disabled */
+        0x1,                /* Number of ORed requirements */
+        0x1,                /* Number of variable requirements in the first ORed requirement */
+        /* Start of variable requirement 0 */
+        0x0,     /* Temperature variable identifier */
+        0x0,     /* Operator - greater than or equal to */
+        0x0, 0x0 /* Constraint value - 0 degrees Celsius */
+    };
+    receive_cb(add_alert_bytes, 18, receive_cb_user_data);
+    /* add_alert_cb should have been called, since the callback is set */
+    CHECK_C(add_alert_cb_called);
+
+    msg_transceiver_deinit();
+    msg_transceiver_init();
+
+    /* deinit should have cleared the callback, so now we expect add alert cb to not be called */
+    add_alert_cb_called = false;
+    receive_cb(add_alert_bytes, 17, receive_cb_user_data);
+    CHECK_C(!add_alert_cb_called);
+}
+
+TEST_C(MsgTransceiver, AddAlertTooManyVariableRequirements)
+{
+    /* Mock receiving a "add alert" message */
+    uint8_t add_alert_bytes[61] = {
+        0x2,                 /* message id */
+        0x3, 0x0,            /* alert id */
+        0xA, 0x0, 0x0, 0x0,  /* Warmup period - 10 ms */
+        0x14, 0x0, 0x0, 0x0, /* Cooldown period - 20 ms */
+        0x0,                 /* notification type - connectivity disabled, LED disabled */
+        0x2,                 /* Number of ORed requirements */
+
+        /* Start of first ORed requirement */
+        0x2, /* Number of variable requirements in the first ORed requirement */
+
+        /* Start of variable requirement 0 */
+        0x0,       /* Temperature variable identifier */
+        0x0,       /* Operator - greater than or equal to */
+        0xCD, 0x0, /* Constraint value 205 -> 20.5 degrees Celsius */
+        /* Start of variable requirement 1 */
+        0x1,        /* Pressure variable identifier */
         0x0,        /* Operator - greater than or equal to */
         0x67, 0x2B, /* Constraint value 11111 -> 1111.1 hPa */
 
@@ -1248,7 +1745,7 @@ TEST_C(MsgTransceiver, AddAlertTooManyVariableRequirements)
         0x1,      /* Operator - less than or equal to */
         0x0, 0x0, /* Constraint value */
     };
-    receive_cb(add_alert_bytes, 60, receive_cb_user_data);
+    receive_cb(add_alert_bytes, 61, receive_cb_user_data);
 
     CHECK_C(!add_alert_cb_called);
     CHECK_C(!remove_alert_cb_called);
@@ -1259,9 +1756,9 @@ TEST_C(MsgTransceiver, AddAlertCbExecutedWithUserData)
     void *user_data = (void *)0x5A;
     msg_transceiver_set_add_alert_cb(add_alert_cb, user_data);
     /* Mock receiving a "add alert" message */
-    uint8_t add_alert_bytes[17] = {
+    uint8_t add_alert_bytes[18] = {
         0x2,                /* message id */
-        0x0,                /* alert id */
+        0x0, 0x0,           /* alert id */
         0x0, 0x0, 0x0, 0x0, /* Warmup period - 0 ms */
         0x0, 0x0, 0x0, 0x0, /* Cooldown period - 0 ms */
         0x1,                /* notification type - connectivity enabled, LED disabled */
@@ -1272,7 +1769,7 @@ TEST_C(MsgTransceiver, AddAlertCbExecutedWithUserData)
         0x0,     /* Operator - greater than or equal to */
         0x0, 0x0 /* Constraint value - 0 degrees Celsius */
     };
-    receive_cb(add_alert_bytes, 17, receive_cb_user_data);
+    receive_cb(add_alert_bytes, 18, receive_cb_user_data);
 
     /* Not verifying the alert contents - the purpose of this test is to only verify the user data in the callback.
      * Other tests verify alert contents. */
@@ -1291,9 +1788,9 @@ TEST_C(MsgTransceiver, ReceiveCbCalledBeforeAddAlertCbSet)
     msg_transceiver_deinit();
     msg_transceiver_init();
 
-    uint8_t add_alert_bytes[17] = {
+    uint8_t add_alert_bytes[18] = {
         0x2,                /* message id */
-        0x0,                /* alert id */
+        0x0, 0x0,           /* alert id */
         0x0, 0x0, 0x0, 0x0, /* Warmup period - 0 ms */
         0x0, 0x0, 0x0, 0x0, /* Cooldown period - 0 ms */
         0x1,                /* notification type - connectivity enabled, LED disabled */
@@ -1304,7 +1801,7 @@ TEST_C(MsgTransceiver, ReceiveCbCalledBeforeAddAlertCbSet)
         0x0,     /* Operator - greater than or equal to */
         0x0, 0x0 /* Constraint value - 0 degrees Celsius */
     };
-    receive_cb(add_alert_bytes, 17, receive_cb_user_data);
+    receive_cb(add_alert_bytes, 18, receive_cb_user_data);
 
     /* We are mostly checking that the program does not crash by running this test */
     CHECK_C(!remove_alert_cb_called);
@@ -1322,8 +1819,8 @@ TEST_C(MsgTransceiver, ReceiveCbCalledBeforeRemoveAlertCbSet)
     msg_transceiver_init();
 
     /* Mock receiving a "remove alert" message. 0x1 - message id, 0 - alert id */
-    uint8_t remove_alert_bytes[2] = {0x1, 0};
-    receive_cb(remove_alert_bytes, 2, receive_cb_user_data);
+    uint8_t remove_alert_bytes[3] = {0x1, 0, 0};
+    receive_cb(remove_alert_bytes, 3, receive_cb_user_data);
 
     /* We are mostly checking that the program does not crash by running this test */
     CHECK_C(!remove_alert_cb_called);
@@ -1351,12 +1848,12 @@ TEST_C(MsgTransceiver, ReceiveCbCalledBeforeCbsSet)
 
 TEST_C(MsgTransceiver, SendAlertStatusChangeMessageCbNull)
 {
-    uint8_t expected_payload[] = {0x0, 0x2, 0x1};
+    uint8_t expected_payload[] = {0x0, 0x2, 0x0, 0x1};
     /* msg_transceiver_send_alert_status_change_message */
     mock_c()
         ->expectOneCall("transceiver_transmit")
-        ->withMemoryBufferParameter("bytes", expected_payload, 3)
-        ->withUnsignedLongIntParameters("num_bytes", 3)
+        ->withMemoryBufferParameter("bytes", expected_payload, 4)
+        ->withUnsignedLongIntParameters("num_bytes", 4)
         ->ignoreOtherParameters();
     msg_transceiver_send_alert_status_change_message(2, true, NULL, NULL);
 
@@ -1381,20 +1878,20 @@ TEST_C(MsgTransceiver, SetRemoveAlertCbCbNull)
 
 TEST_C(MsgTransceiver, SendTwoSuccessfulAlertStatusChangeMessages)
 {
-    uint8_t expected_payload_0[] = {0x0, 0x0, 0x0};
-    uint8_t expected_payload_1[] = {0x0, 0x1, 0x1};
+    uint8_t expected_payload_0[] = {0x0, 0x0, 0x0, 0x0};
+    uint8_t expected_payload_1[] = {0x0, 0x1, 0x0, 0x1};
     /* First call to msg_transceiver_send_alert_status_change_message */
     mock_c()
         ->expectOneCall("transceiver_transmit")
-        ->withMemoryBufferParameter("bytes", expected_payload_0, 3)
-        ->withUnsignedLongIntParameters("num_bytes", 3)
+        ->withMemoryBufferParameter("bytes", expected_payload_0, 4)
+        ->withUnsignedLongIntParameters("num_bytes", 4)
         ->ignoreOtherParameters();
 
     /* Second call to msg_transceiver_send_alert_status_change_message */
     mock_c()
         ->expectOneCall("transceiver_transmit")
-        ->withMemoryBufferParameter("bytes", expected_payload_1, 3)
-        ->withUnsignedLongIntParameters("num_bytes", 3)
+        ->withMemoryBufferParameter("bytes", expected_payload_1, 4)
+        ->withUnsignedLongIntParameters("num_bytes", 4)
         ->ignoreOtherParameters();
 
     void *user_data_0 = (void *)0x34;
@@ -1415,16 +1912,16 @@ TEST_C(MsgTransceiver, SendTwoSuccessfulAlertStatusChangeMessages)
 
 TEST_C(MsgTransceiver, TooManyConcurrentAlertStatusChangeMessages)
 {
-    uint8_t expected_payload[] = {0x0, 0x3, 0x0};
-    for (size_t i = 0; i < CONFIG_MSG_TRANSCEIVER_MAX_NUM_CONCURRENT_ALERT_STATUS_CHANGE_MESSAGES; i++) {
+    uint8_t expected_payload[] = {0x0, 0x3, 0x0, 0x0};
+    for (size_t i = 0; i < CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS; i++) {
         mock_c()
             ->expectOneCall("transceiver_transmit")
-            ->withMemoryBufferParameter("bytes", expected_payload, 3)
-            ->withUnsignedLongIntParameters("num_bytes", 3)
+            ->withMemoryBufferParameter("bytes", expected_payload, 4)
+            ->withUnsignedLongIntParameters("num_bytes", 4)
             ->ignoreOtherParameters();
     }
 
-    for (size_t i = 0; i < CONFIG_MSG_TRANSCEIVER_MAX_NUM_CONCURRENT_ALERT_STATUS_CHANGE_MESSAGES; i++) {
+    for (size_t i = 0; i < CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS; i++) {
         msg_transceiver_send_alert_status_change_message(3, false, message_sent_cb, NULL);
     }
 
@@ -1438,38 +1935,38 @@ TEST_C(MsgTransceiver, TooManyConcurrentAlertStatusChangeMessages)
     CHECK_EQUAL_C_POINTER(user_data, message_sent_cb_1_user_data);
 }
 
-TEST_C(MsgTransceiver, ReuseAlertStatusChangeMessageSlot)
+TEST_C(MsgTransceiver, ReuseMessageSlot)
 {
-    uint8_t expected_payload_0[] = {0x0, 0x4, 0x1};
-    uint8_t expected_payload_1[] = {0x0, 0x5, 0x0};
-    for (size_t i = 0; i < CONFIG_MSG_TRANSCEIVER_MAX_NUM_CONCURRENT_ALERT_STATUS_CHANGE_MESSAGES; i++) {
+    uint8_t expected_payload_0[] = {0x0, 0x4, 0x0, 0x1};
+    uint8_t expected_payload_1[] = {0x0, 0x5, 0x0, 0x0};
+    for (size_t i = 0; i < CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS; i++) {
         /* Calls to msg_transceiver_send_alert_status_change_message inside the for loop */
         mock_c()
             ->expectOneCall("transceiver_transmit")
-            ->withMemoryBufferParameter("bytes", expected_payload_0, 3)
-            ->withUnsignedLongIntParameters("num_bytes", 3)
+            ->withMemoryBufferParameter("bytes", expected_payload_0, 4)
+            ->withUnsignedLongIntParameters("num_bytes", 4)
             ->ignoreOtherParameters();
     }
     /* Call to msg_transceiver_send_alert_status_change_message after the for loop */
     mock_c()
         ->expectOneCall("transceiver_transmit")
-        ->withMemoryBufferParameter("bytes", expected_payload_1, 3)
-        ->withUnsignedLongIntParameters("num_bytes", 3)
+        ->withMemoryBufferParameter("bytes", expected_payload_1, 4)
+        ->withUnsignedLongIntParameters("num_bytes", 4)
         ->ignoreOtherParameters();
 
-    for (size_t i = 0; i < CONFIG_MSG_TRANSCEIVER_MAX_NUM_CONCURRENT_ALERT_STATUS_CHANGE_MESSAGES; i++) {
+    for (size_t i = 0; i < CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS; i++) {
         msg_transceiver_send_alert_status_change_message(4, true, message_sent_cb, NULL);
     }
 
     /* One slot should get freed */
-    EAS_ASSERT(6 < CONFIG_MSG_TRANSCEIVER_MAX_NUM_CONCURRENT_ALERT_STATUS_CHANGE_MESSAGES);
+    EAS_ASSERT(6 < CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS);
     (transmit_complete_cbs[6])(true, transmit_complete_cbs_user_data[6]);
 
     void *user_data = (void *)0x39;
     /* Different cb than the previous calls, so that we can verify that the callback passed to this function is actually
      * the one called */
     msg_transceiver_send_alert_status_change_message(5, false, message_sent_cb_1, user_data);
-    size_t idx = CONFIG_MSG_TRANSCEIVER_MAX_NUM_CONCURRENT_ALERT_STATUS_CHANGE_MESSAGES;
+    size_t idx = CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS;
     (transmit_complete_cbs[idx])(true, transmit_complete_cbs_user_data[idx]);
 
     CHECK_C(message_sent_cb_1_called);
@@ -1479,19 +1976,19 @@ TEST_C(MsgTransceiver, ReuseAlertStatusChangeMessageSlot)
 
 TEST_C(MsgTransceiver, AlertStatusChangeMessagesCbsExecutedInReverseOrder)
 {
-    uint8_t expected_payload_0[] = {0x0, 0x5, 0x1};
-    uint8_t expected_payload_1[] = {0x0, 0x2, 0x0};
+    uint8_t expected_payload_0[] = {0x0, 0x5, 0x0, 0x1};
+    uint8_t expected_payload_1[] = {0x0, 0x2, 0x0, 0x0};
     /* First call to msg_transceiver_send_alert_status_change_message */
     mock_c()
         ->expectOneCall("transceiver_transmit")
-        ->withMemoryBufferParameter("bytes", expected_payload_0, 3)
-        ->withUnsignedLongIntParameters("num_bytes", 3)
+        ->withMemoryBufferParameter("bytes", expected_payload_0, 4)
+        ->withUnsignedLongIntParameters("num_bytes", 4)
         ->ignoreOtherParameters();
     /* Second call to msg_transceiver_send_alert_status_change_message */
     mock_c()
         ->expectOneCall("transceiver_transmit")
-        ->withMemoryBufferParameter("bytes", expected_payload_1, 3)
-        ->withUnsignedLongIntParameters("num_bytes", 3)
+        ->withMemoryBufferParameter("bytes", expected_payload_1, 4)
+        ->withUnsignedLongIntParameters("num_bytes", 4)
         ->ignoreOtherParameters();
 
     void *user_data_0 = (void *)0xAB;
@@ -1512,12 +2009,12 @@ TEST_C(MsgTransceiver, AlertStatusChangeMessagesCbsExecutedInReverseOrder)
 
 TEST_C(MsgTransceiver, TransmissionCompleteAfterDeinit)
 {
-    uint8_t expected_payload_0[] = {0x0, 0x2, 0x0};
+    uint8_t expected_payload_0[] = {0x0, 0x2, 0x0, 0x0};
     /* msg_transceiver_send_alert_status_change_message */
     mock_c()
         ->expectOneCall("transceiver_transmit")
-        ->withMemoryBufferParameter("bytes", expected_payload_0, 3)
-        ->withUnsignedLongIntParameters("num_bytes", 3)
+        ->withMemoryBufferParameter("bytes", expected_payload_0, 4)
+        ->withUnsignedLongIntParameters("num_bytes", 4)
         ->ignoreOtherParameters();
     /* Expected to be called in msg_transceiver_deinit */
     mock_c()->expectOneCall("transceiver_unset_receive_cb");
@@ -1537,3 +2034,648 @@ TEST_C(MsgTransceiver, TransmissionCompleteAfterDeinit)
      * that, the module should be initialized at the end of the test. */
     msg_transceiver_init();
 }
+
+TEST_C(MsgTransceiver, AlertStatusChangesOneChange)
+{
+    MsgTransceiverAlertStatusChange changes[] = {{.alert_id = 7, .is_raised = true}};
+    size_t expected_num_bytes = 5;
+    uint8_t expected_payload[] = {0x3, 0x1, 0x7, 0x0, 0x1};
+    /* msg_transceiver_send_alert_status_changes_message */
+    mock_c()
+        ->expectOneCall("transceiver_transmit")
+        ->withMemoryBufferParameter("bytes", expected_payload, expected_num_bytes)
+        ->withUnsignedLongIntParameters("num_bytes", expected_num_bytes)
+        ->ignoreOtherParameters();
+
+    msg_transceiver_send_alert_status_changes_message(changes, 1, message_sent_cb, NULL);
+    /* Mock transmission success */
+    (transmit_complete_cbs[0])(true, transmit_complete_cbs_user_data[0]);
+
+    CHECK_C(message_sent_cb_called);
+    CHECK_C(message_sent_cb_result);
+}
+
+TEST_C(MsgTransceiver, AlertStatusChangesMaxNumChanges)
+{
+    EAS_ASSERT(CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERT_STATUS_CHANGES_IN_MESSAGE == 3);
+    MsgTransceiverAlertStatusChange changes[] = {
+        {.alert_id = 2, .is_raised = true},
+        {.alert_id = 0, .is_raised = false},
+        {.alert_id = 0x1234, .is_raised = true},
+    };
+    size_t expected_num_bytes = 11;
+    uint8_t expected_payload[] = {
+        0x3,             /* message id */
+        0x3,             /* number of records */
+        0x2,  0x0,  0x1, /* alert 2 raised */
+        0x0,  0x0,  0x0, /* alert 0 silenced */
+        0x34, 0x12, 0x1, /* alert 0x1234 raised */
+    };
+    /* msg_transceiver_send_alert_status_changes_message */
+    mock_c()
+        ->expectOneCall("transceiver_transmit")
+        ->withMemoryBufferParameter("bytes", expected_payload, expected_num_bytes)
+        ->withUnsignedLongIntParameters("num_bytes", expected_num_bytes)
+        ->ignoreOtherParameters();
+
+    void *user_data = (void *)0x5A;
+    msg_transceiver_send_alert_status_changes_message(changes, 3, message_sent_cb, user_data);
+    /* Mock transmission failure */
+    (transmit_complete_cbs[0])(false, transmit_complete_cbs_user_data[0]);
+
+    CHECK_C(message_sent_cb_called);
+    CHECK_C(!message_sent_cb_result);
+    CHECK_EQUAL_C_POINTER(user_data, message_sent_cb_user_data);
+}
+
+TEST_C(MsgTransceiver, AlertStatusChangesMessageSharesSlotsWithAlertStatusChangeMessage)
+{
+    uint8_t expected_payload[] = {0x0, 0x3, 0x0, 0x0};
+    for (size_t i = 0; i < CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS; i++) {
+        mock_c()
+            ->expectOneCall("transceiver_transmit")
+            ->withMemoryBufferParameter("bytes", expected_payload, 4)
+            ->withUnsignedLongIntParameters("num_bytes", 4)
+            ->ignoreOtherParameters();
+    }
+
+    for (size_t i = 0; i < CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS; i++) {
+        msg_transceiver_send_alert_status_change_message(3, false, message_sent_cb, NULL);
+    }
+
+    /* All slots are occupied, so this message fails to get sent */
+    MsgTransceiverAlertStatusChange changes[] = {
+        {.alert_id = 1, .is_raised = true},
+        {.alert_id = 4, .is_raised = true},
+    };
+    void *user_data = (void *)0x72;
+    msg_transceiver_send_alert_status_changes_message(changes, 2, message_sent_cb_1, user_data);
+
+    CHECK_C(message_sent_cb_1_called);
+    CHECK_C(!message_sent_cb_1_result);
+    CHECK_EQUAL_C_POINTER(user_data, message_sent_cb_1_user_data);
+}
+
+TEST_C(MsgTransceiver, AlertStatusChangesChangesNull)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("changes", "msg_transceiver_send_alert_status_changes_message");
+    msg_transceiver_send_alert_status_changes_message(NULL, 1, message_sent_cb, NULL);
+}
+
+TEST_C(MsgTransceiver, AlertStatusChangesNumChanges0)
+{
+    MsgTransceiverAlertStatusChange changes[] = {{.alert_id = 1, .is_raised = true}};
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("num_changes > 0", "msg_transceiver_send_alert_status_changes_message");
+    msg_transceiver_send_alert_status_changes_message(changes, 0, message_sent_cb, NULL);
+}
+
+TEST_C(MsgTransceiver, AlertStatusChangesTooManyChanges)
+{
+    EAS_ASSERT(CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERT_STATUS_CHANGES_IN_MESSAGE == 3);
+    MsgTransceiverAlertStatusChange changes[4] = {0};
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("is_valid_num_alert_status_changes(num_changes)",
+                                          "msg_transceiver_send_alert_status_changes_message");
+    msg_transceiver_send_alert_status_changes_message(changes, 4, message_sent_cb, NULL);
+}
+
+TEST_C(MsgTransceiver, GetStats)
+{
+    /* Mock receiving a "get stats" message. 0x4 - message id, no payload */
+    uint8_t get_stats_bytes[1] = {0x4};
+    receive_cb(get_stats_bytes, 1, receive_cb_user_data);
+
+    CHECK_C(get_stats_cb_called);
+    CHECK_EQUAL_C_POINTER(NULL, get_stats_cb_user_data);
+    CHECK_C(!remove_alert_cb_called);
+    CHECK_C(!add_alert_cb_called);
+}
+
+TEST_C(MsgTransceiver, GetStatsMessageTooManyBytes)
+{
+    /* "Get stats" message should only have the message id byte */
+    uint8_t get_stats_bytes[2] = {0x4, 0x0};
+    receive_cb(get_stats_bytes, 2, receive_cb_user_data);
+
+    /* No callbacks should be called - message payload structure is invalid. */
+    CHECK_C(!get_stats_cb_called);
+}
+
+TEST_C(MsgTransceiver, GetStatsCbExecutedWithUserData)
+{
+    void *user_data = (void *)0x3C;
+    msg_transceiver_set_get_stats_cb(get_stats_cb, user_data);
+    uint8_t get_stats_bytes[1] = {0x4};
+    receive_cb(get_stats_bytes, 1, receive_cb_user_data);
+
+    CHECK_C(get_stats_cb_called);
+    CHECK_EQUAL_C_POINTER(user_data, get_stats_cb_user_data);
+}
+
+TEST_C(MsgTransceiver, DeinitClearsGetStatsCb)
+{
+    /* Expected to be called in msg_transceiver_deinit */
+    mock_c()->expectOneCall("transceiver_unset_receive_cb");
+    /* Expected to be called in msg_transceiver_init */
+    mock_c()->expectOneCall("transceiver_set_receive_cb")->ignoreOtherParameters();
+
+    /* msg_transceiver_set_get_stats_cb is called as a part of the test setup, so get stats callback is initially set */
+    uint8_t get_stats_bytes[1] = {0x4};
+    receive_cb(get_stats_bytes, 1, receive_cb_user_data);
+    CHECK_C(get_stats_cb_called);
+
+    msg_transceiver_deinit();
+    msg_transceiver_init();
+
+    /* deinit should have cleared the callback, so now we expect get stats cb to not be called */
+    get_stats_cb_called = false;
+    receive_cb(get_stats_bytes, 1, receive_cb_user_data);
+    CHECK_C(!get_stats_cb_called);
+}
+
+TEST_C(MsgTransceiver, SetGetStatsCbCbNull)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("cb", "msg_transceiver_set_get_stats_cb");
+    msg_transceiver_set_get_stats_cb(NULL, NULL);
+}
+
+TEST_C(MsgTransceiver, EventQueueStats)
+{
+    MsgTransceiverEventQueueStats stats = {.num_slots = 64, .high_watermark = 5, .num_event_ids = 12};
+    size_t expected_num_bytes = 4;
+    uint8_t expected_payload[] = {
+        0x5, /* message id */
+        64,  /* number of slots */
+        5,   /* high-watermark */
+        12,  /* number of event ids */
+    };
+    /* msg_transceiver_send_event_queue_stats_message */
+    mock_c()
+        ->expectOneCall("transceiver_transmit")
+        ->withMemoryBufferParameter("bytes", expected_payload, expected_num_bytes)
+        ->withUnsignedLongIntParameters("num_bytes", expected_num_bytes)
+        ->ignoreOtherParameters();
+
+    void *user_data = (void *)0x61;
+    msg_transceiver_send_event_queue_stats_message(&stats, message_sent_cb, user_data);
+    /* Mock transmission success */
+    (transmit_complete_cbs[0])(true, transmit_complete_cbs_user_data[0]);
+
+    CHECK_C(message_sent_cb_called);
+    CHECK_C(message_sent_cb_result);
+    CHECK_EQUAL_C_POINTER(user_data, message_sent_cb_user_data);
+}
+
+TEST_C(MsgTransceiver, EventQueueStatsStatsNull)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("stats", "msg_transceiver_send_event_queue_stats_message");
+    msg_transceiver_send_event_queue_stats_message(NULL, message_sent_cb, NULL);
+}
+
+TEST_C(MsgTransceiver, EventStats)
+{
+    MsgTransceiverEventStats stats = {
+        .event_id = 3,
+        .num_handled = 0x12345678,
+        .total_handler_cycles = 0x0102030405060708,
+        .max_handler_cycles = 0xAABBCCDD,
+    };
+    size_t expected_num_bytes = 18;
+    uint8_t expected_payload[] = {
+        0x6,                                            /* message id */
+        0x3,                                            /* event id */
+        0x78, 0x56, 0x34, 0x12,                         /* number of handled events */
+        0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, /* total handler cycles */
+        0xDD, 0xCC, 0xBB, 0xAA,                         /* max handler cycles */
+    };
+    /* msg_transceiver_send_event_stats_message */
+    mock_c()
+        ->expectOneCall("transceiver_transmit")
+        ->withMemoryBufferParameter("bytes", expected_payload, expected_num_bytes)
+        ->withUnsignedLongIntParameters("num_bytes", expected_num_bytes)
+        ->ignoreOtherParameters();
+
+    void *user_data = (void *)0x62;
+    msg_transceiver_send_event_stats_message(&stats, message_sent_cb, user_data);
+    /* Mock transmission failure */
+    (transmit_complete_cbs[0])(false, transmit_complete_cbs_user_data[0]);
+
+    CHECK_C(message_sent_cb_called);
+    CHECK_C(!message_sent_cb_result);
+    CHECK_EQUAL_C_POINTER(user_data, message_sent_cb_user_data);
+}
+
+TEST_C(MsgTransceiver, EventStatsMessageSharesSlotsWithAlertStatusChangeMessage)
+{
+    uint8_t expected_payload[] = {0x0, 0x3, 0x0, 0x0};
+    for (size_t i = 0; i < CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS; i++) {
+        mock_c()
+            ->expectOneCall("transceiver_transmit")
+            ->withMemoryBufferParameter("bytes", expected_payload, 4)
+            ->withUnsignedLongIntParameters("num_bytes", 4)
+            ->ignoreOtherParameters();
+    }
+
+    for (size_t i = 0; i < CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS; i++) {
+        msg_transceiver_send_alert_status_change_message(3, false, message_sent_cb, NULL);
+    }
+
+    /* All slots are occupied, so this message fails to get sent */
+    MsgTransceiverEventStats stats = {0};
+    void *user_data = (void *)0x73;
+    msg_transceiver_send_event_stats_message(&stats, message_sent_cb_1, user_data);
+
+    CHECK_C(message_sent_cb_1_called);
+    CHECK_C(!message_sent_cb_1_result);
+    CHECK_EQUAL_C_POINTER(user_data, message_sent_cb_1_user_data);
+}
+
+TEST_C(MsgTransceiver, EventStatsMessageDoesNotUseReservedSlots)
+{
+    size_t num_unreserved_slots =
+        CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS - CONFIG_MSG_TRANSCEIVER_NUM_RESERVED_MESSAGE_SLOTS;
+    EAS_ASSERT(num_unreserved_slots > 0);
+    for (size_t i = 0; i < num_unreserved_slots; i++) {
+        mock_c()->expectOneCall("transceiver_transmit")->ignoreOtherParameters();
+    }
+    MsgTransceiverEventStats stats = {0};
+    for (size_t i = 0; i < num_unreserved_slots; i++) {
+        msg_transceiver_send_event_stats_message(&stats, message_sent_cb, NULL);
+    }
+
+    /* Only reserved slots are free, so this message fails to get sent */
+    void *user_data = (void *)0x74;
+    msg_transceiver_send_event_stats_message(&stats, message_sent_cb_1, user_data);
+
+    CHECK_C(message_sent_cb_1_called);
+    CHECK_C(!message_sent_cb_1_result);
+    CHECK_EQUAL_C_POINTER(user_data, message_sent_cb_1_user_data);
+
+    /* Alert status change messages still get a reserved slot */
+    uint8_t expected_payload[] = {0x0, 0x3, 0x0, 0x1};
+    mock_c()
+        ->expectOneCall("transceiver_transmit")
+        ->withMemoryBufferParameter("bytes", expected_payload, 4)
+        ->withUnsignedLongIntParameters("num_bytes", 4)
+        ->ignoreOtherParameters();
+    msg_transceiver_send_alert_status_change_message(3, true, message_sent_cb, NULL);
+}
+
+TEST_C(MsgTransceiver, EventStatsStatsNull)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("stats", "msg_transceiver_send_event_stats_message");
+    msg_transceiver_send_event_stats_message(NULL, message_sent_cb, NULL);
+}
+
+TEST_C(MsgTransceiver, ReplaceAllAlertsTwoAlerts)
+{
+    /* Mock receiving a "replace all alerts" message */
+    uint8_t bytes[38] = {
+        0x7, /* message id */
+        0x2, /* Number of alerts */
+        /* Start of alert 0 */
+        0x4, 0x0,            /* alert id */
+        0xE8, 0x3, 0x0, 0x0, /* Warmup period - 1000 ms */
+        0xD0, 0x7, 0x0, 0x0, /* Cooldown period - 2000 ms */
+        0x1,                 /* notification type - connectivity enabled, LED disabled */
+        0x1,                 /* Number of ORed requirements */
+        0x1,                 /* Number of variable requirements in the first ORed requirement */
+        0x0,                 /* Temperature variable identifier */
+        0x0,                 /* Operator - greater than or equal to */
+        0xFA, 0x0,           /* Constraint value - 25.0 degrees Celsius */
+        /* Start of alert 1 */
+        0x2, 0x0,            /* alert id */
+        0x0, 0x0, 0x0, 0x0,  /* Warmup period - 0 ms */
+        0x64, 0x0, 0x0, 0x0, /* Cooldown period - 100 ms */
+        0x2,                 /* notification type - connectivity disabled, LED enabled */
+        0x2,                 /* Led color - blue */
+        0x1,                 /* Led pattern - alert */
+        0x1,                 /* Number of ORed requirements */
+        0x1,                 /* Number of variable requirements in the first ORed requirement */
+        0x1,                 /* Pressure variable identifier */
+        0x1,                 /* Operator - less than or equal to */
+        0xE7, 0x3,           /* Constraint value - 999 hPa */
+    };
+    receive_cb(bytes, 38, receive_cb_user_data);
+
+    CHECK_C(replace_all_alerts_cb_called);
+    CHECK_EQUAL_C_ULONG(2, replace_all_alerts_cb_num_alerts);
+    CHECK_EQUAL_C_POINTER(NULL, replace_all_alerts_cb_user_data);
+
+    const MsgTransceiverAlert *alert = &replace_all_alerts_cb_alerts[0];
+    CHECK_EQUAL_C_UINT(4, alert->alert_id);
+    CHECK_EQUAL_C_ULONG(1000, alert->warmup_period);
+    CHECK_EQUAL_C_ULONG(2000, alert->cooldown_period);
+    CHECK_C(alert->notification_type.connectivity);
+    CHECK_C(!(alert->notification_type.led));
+    CHECK_EQUAL_C_UBYTE(1, alert->alert_condition.num_variable_requirements);
+    const MsgTransceiverVariableRequirement *requirement = &(alert->alert_condition.variable_requirements[0]);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_TEMPERATURE, requirement->variable_identifier);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_GEQ, requirement->operator);
+    CHECK_EQUAL_C_LONG(250, requirement->constraint_value.temperature);
+    CHECK_C(requirement->is_last_in_ored_requirement);
+
+    alert = &replace_all_alerts_cb_alerts[1];
+    CHECK_EQUAL_C_UINT(2, alert->alert_id);
+    CHECK_EQUAL_C_ULONG(0, alert->warmup_period);
+    CHECK_EQUAL_C_ULONG(100, alert->cooldown_period);
+    CHECK_C(!(alert->notification_type.connectivity));
+    CHECK_C(alert->notification_type.led);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_LED_COLOR_BLUE, alert->led_color);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_LED_PATTERN_ALERT, alert->led_pattern);
+    CHECK_EQUAL_C_UBYTE(1, alert->alert_condition.num_variable_requirements);
+    requirement = &(alert->alert_condition.variable_requirements[0]);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_VARIABLE_IDENTIFIER_PRESSURE, requirement->variable_identifier);
+    CHECK_EQUAL_C_UBYTE(MSG_TRANSCEIVER_REQUIREMENT_OPERATOR_LEQ, requirement->operator);
+    CHECK_EQUAL_C_ULONG(999, requirement->constraint_value.pressure);
+    CHECK_C(requirement->is_last_in_ored_requirement);
+
+    /* Only the "replace all alerts" callback should be called */
+    CHECK_C(!add_alert_cb_called);
+}
+
+TEST_C(MsgTransceiver, ReplaceAllAlertsNoAlerts)
+{
+    /* 0x7 - message id, 0 - number of alerts. Replacing all alerts with no alerts is valid. */
+    uint8_t bytes[2] = {0x7, 0x0};
+    receive_cb(bytes, 2, receive_cb_user_data);
+
+    CHECK_C(replace_all_alerts_cb_called);
+    CHECK_EQUAL_C_ULONG(0, replace_all_alerts_cb_num_alerts);
+}
+
+TEST_C(MsgTransceiver, ReplaceAllAlertsMessageOnlyMessageId)
+{
+    /* Number of alerts is missing */
+    uint8_t bytes[1] = {0x7};
+    receive_cb(bytes, 1, receive_cb_user_data);
+
+    CHECK_C(!replace_all_alerts_cb_called);
+}
+
+TEST_C(MsgTransceiver, ReplaceAllAlertsTooManyAlerts)
+{
+    EAS_ASSERT(CONFIG_MSG_TRANSCEIVER_MAX_NUM_ALERTS_IN_REPLACE_ALL_ALERTS_MESSAGE == 3);
+    /* Rejected based on the number of alerts alone, before parsing the alerts */
+    uint8_t bytes[2] = {0x7, 0x4};
+    receive_cb(bytes, 2, receive_cb_user_data);
+
+    CHECK_C(!replace_all_alerts_cb_called);
+}
+
+TEST_C(MsgTransceiver, ReplaceAllAlertsSecondAlertIncomplete)
+{
+    uint8_t bytes[24] = {
+        0x7, /* message id */
+        0x2, /* Number of alerts */
+        /* Start of alert 0 */
+        0x0, 0x0,           /* alert id */
+        0x0, 0x0, 0x0, 0x0, /* Warmup period - 0 ms */
+        0x0, 0x0, 0x0, 0x0, /* Cooldown period - 0 ms */
+        0x1,                /* notification type - connectivity enabled, LED disabled */
+        0x1,                /* Number of ORed requirements */
+        0x1,                /* Number of variable requirements in the first ORed requirement */
+        0x0,                /* Temperature variable identifier */
+        0x0,                /* Operator - greater than or equal to */
+        0x0, 0x0,           /* Constraint value - 0 degrees Celsius */
+        /* Start of alert 1 - cut off after the warmup period */
+        0x1, 0x0,      /* alert id */
+        0x0, 0x0, 0x0, /* Warmup period - one byte missing */
+    };
+    receive_cb(bytes, 24, receive_cb_user_data);
+
+    /* None of the alerts are passed on, not even the first one that was parsed successfully */
+    CHECK_C(!replace_all_alerts_cb_called);
+}
+
+TEST_C(MsgTransceiver, ReplaceAllAlertsTooManyBytes)
+{
+    uint8_t bytes[20] = {
+        0x7,                /* message id */
+        0x1,                /* Number of alerts */
+        0x0, 0x0,           /* alert id */
+        0x0, 0x0, 0x0, 0x0, /* Warmup period - 0 ms */
+        0x0, 0x0, 0x0, 0x0, /* Cooldown period - 0 ms */
+        0x1,                /* notification type - connectivity enabled, LED disabled */
+        0x1,                /* Number of ORed requirements */
+        0x1,                /* Number of variable requirements in the first ORed requirement */
+        0x0,                /* Temperature variable identifier */
+        0x0,                /* Operator - greater than or equal to */
+        0x0, 0x0,           /* Constraint value - 0 degrees Celsius */
+        0xAB,               /* Extra byte */
+    };
+    receive_cb(bytes, 20, receive_cb_user_data);
+
+    CHECK_C(!replace_all_alerts_cb_called);
+}
+
+TEST_C(MsgTransceiver, ReplaceAllAlertsCbExecutedWithUserData)
+{
+    void *user_data = (void *)0x5E;
+    msg_transceiver_set_replace_all_alerts_cb(replace_all_alerts_cb, user_data);
+    uint8_t bytes[2] = {0x7, 0x0};
+    receive_cb(bytes, 2, receive_cb_user_data);
+
+    CHECK_C(replace_all_alerts_cb_called);
+    CHECK_EQUAL_C_POINTER(user_data, replace_all_alerts_cb_user_data);
+}
+
+TEST_C(MsgTransceiver, DeinitClearsReplaceAllAlertsCb)
+{
+    /* Expected to be called in msg_transceiver_deinit */
+    mock_c()->expectOneCall("transceiver_unset_receive_cb");
+    /* Expected to be called in msg_transceiver_init */
+    mock_c()->expectOneCall("transceiver_set_receive_cb")->ignoreOtherParameters();
+
+    /* msg_transceiver_set_replace_all_alerts_cb is called as a part of the test setup, so the callback is initially
+     * set */
+    uint8_t bytes[2] = {0x7, 0x0};
+    receive_cb(bytes, 2, receive_cb_user_data);
+    CHECK_C(replace_all_alerts_cb_called);
+
+    msg_transceiver_deinit();
+    msg_transceiver_init();
+
+    /* deinit should have cleared the callback, so now we expect replace all alerts cb to not be called */
+    replace_all_alerts_cb_called = false;
+    receive_cb(bytes, 2, receive_cb_user_data);
+    CHECK_C(!replace_all_alerts_cb_called);
+}
+
+TEST_C(MsgTransceiver, SetReplaceAllAlertsCbCbNull)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("cb", "msg_transceiver_set_replace_all_alerts_cb");
+    msg_transceiver_set_replace_all_alerts_cb(NULL, NULL);
+}
+
+TEST_C(MsgTransceiver, GetSampleHistory)
+{
+    /* Mock receiving a "get sample history" message. 0x8 - message id, no payload */
+    uint8_t get_sample_history_bytes[1] = {0x8};
+    receive_cb(get_sample_history_bytes, 1, receive_cb_user_data);
+
+    CHECK_C(get_sample_history_cb_called);
+    CHECK_EQUAL_C_POINTER(NULL, get_sample_history_cb_user_data);
+    CHECK_C(!get_stats_cb_called);
+}
+
+TEST_C(MsgTransceiver, GetSampleHistoryMessageTooManyBytes)
+{
+    /* "Get sample history" message should only have the message id byte */
+    uint8_t get_sample_history_bytes[2] = {0x8, 0x0};
+    receive_cb(get_sample_history_bytes, 2, receive_cb_user_data);
+
+    /* No callbacks should be called - message payload structure is invalid. */
+    CHECK_C(!get_sample_history_cb_called);
+}
+
+TEST_C(MsgTransceiver, GetSampleHistoryCbExecutedWithUserData)
+{
+    void *user_data = (void *)0x3D;
+    msg_transceiver_set_get_sample_history_cb(get_sample_history_cb, user_data);
+    uint8_t get_sample_history_bytes[1] = {0x8};
+    receive_cb(get_sample_history_bytes, 1, receive_cb_user_data);
+
+    CHECK_C(get_sample_history_cb_called);
+    CHECK_EQUAL_C_POINTER(user_data, get_sample_history_cb_user_data);
+}
+
+TEST_C(MsgTransceiver, DeinitClearsGetSampleHistoryCb)
+{
+    /* Expected to be called in msg_transceiver_deinit */
+    mock_c()->expectOneCall("transceiver_unset_receive_cb");
+    /* Expected to be called in msg_transceiver_init */
+    mock_c()->expectOneCall("transceiver_set_receive_cb")->ignoreOtherParameters();
+
+    msg_transceiver_deinit();
+    msg_transceiver_init();
+
+    uint8_t get_sample_history_bytes[1] = {0x8};
+    receive_cb(get_sample_history_bytes, 1, receive_cb_user_data);
+    CHECK_C(!get_sample_history_cb_called);
+}
+
+TEST_C(MsgTransceiver, SetGetSampleHistoryCbCbNull)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("cb", "msg_transceiver_set_get_sample_history_cb");
+    msg_transceiver_set_get_sample_history_cb(NULL, NULL);
+}
+
+TEST_C(MsgTransceiver, SampleHistory)
+{
+    uint8_t block_bytes[3] = {0xAA, 0xBB, 0xCC};
+    MsgTransceiverSampleHistoryFragment fragment = {
+        .block_index = 0x0102,
+        .offset = 32,
+        .bytes = block_bytes,
+        .num_bytes = 3,
+    };
+    size_t expected_num_bytes = 7;
+    uint8_t expected_payload[] = {
+        0x9,              /* message id */
+        0x02, 0x01,       /* block index */
+        32,               /* offset */
+        0xAA, 0xBB, 0xCC, /* fragment bytes */
+    };
+    /* msg_transceiver_send_sample_history_message */
+    mock_c()
+        ->expectOneCall("transceiver_transmit")
+        ->withMemoryBufferParameter("bytes", expected_payload, expected_num_bytes)
+        ->withUnsignedLongIntParameters("num_bytes", expected_num_bytes)
+        ->ignoreOtherParameters();
+
+    void *user_data = (void *)0x63;
+    msg_transceiver_send_sample_history_message(&fragment, message_sent_cb, user_data);
+    /* Mock transmission success */
+    (transmit_complete_cbs[0])(true, transmit_complete_cbs_user_data[0]);
+
+    CHECK_C(message_sent_cb_called);
+    CHECK_C(message_sent_cb_result);
+    CHECK_EQUAL_C_POINTER(user_data, message_sent_cb_user_data);
+}
+
+TEST_C(MsgTransceiver, SampleHistoryMaxNumBytes)
+{
+    EAS_ASSERT(MSG_TRANSCEIVER_SAMPLE_HISTORY_MAX_NUM_BYTES_IN_MESSAGE == 16);
+    uint8_t block_bytes[16];
+    for (size_t i = 0; i < 16; i++) {
+        block_bytes[i] = (uint8_t)i;
+    }
+    MsgTransceiverSampleHistoryFragment fragment = {
+        .block_index = 3,
+        .offset = 0,
+        .bytes = block_bytes,
+        .num_bytes = 16,
+    };
+    size_t expected_num_bytes = 20;
+    uint8_t expected_payload[20] = {0x9, 0x03, 0x00, 0};
+    memcpy(&expected_payload[4], block_bytes, 16);
+    /* msg_transceiver_send_sample_history_message */
+    mock_c()
+        ->expectOneCall("transceiver_transmit")
+        ->withMemoryBufferParameter("bytes", expected_payload, expected_num_bytes)
+        ->withUnsignedLongIntParameters("num_bytes", expected_num_bytes)
+        ->ignoreOtherParameters();
+
+    msg_transceiver_send_sample_history_message(&fragment, message_sent_cb, NULL);
+}
+
+TEST_C(MsgTransceiver, SampleHistoryEndOfReadOut)
+{
+    MsgTransceiverSampleHistoryFragment fragment = {.block_index = 5, .offset = 0, .bytes = NULL, .num_bytes = 0};
+    size_t expected_num_bytes = 4;
+    uint8_t expected_payload[] = {
+        0x9,        /* message id */
+        0x05, 0x00, /* number of blocks in the read-out */
+        0,          /* offset */
+    };
+    /* msg_transceiver_send_sample_history_message */
+    mock_c()
+        ->expectOneCall("transceiver_transmit")
+        ->withMemoryBufferParameter("bytes", expected_payload, expected_num_bytes)
+        ->withUnsignedLongIntParameters("num_bytes", expected_num_bytes)
+        ->ignoreOtherParameters();
+
+    msg_transceiver_send_sample_history_message(&fragment, message_sent_cb, NULL);
+}
+
+TEST_C(MsgTransceiver, SampleHistoryMessageDoesNotUseReservedSlots)
+{
+    size_t num_unreserved_slots =
+        CONFIG_MSG_TRANSCEIVER_NUM_MESSAGE_SLOTS - CONFIG_MSG_TRANSCEIVER_NUM_RESERVED_MESSAGE_SLOTS;
+    for (size_t i = 0; i < num_unreserved_slots; i++) {
+        mock_c()->expectOneCall("transceiver_transmit")->ignoreOtherParameters();
+    }
+    for (size_t i = 0; i < num_unreserved_slots; i++) {
+        msg_transceiver_send_alert_status_change_message(3, false, message_sent_cb, NULL);
+    }
+
+    /* Only reserved slots are free, so this message fails to get sent */
+    MsgTransceiverSampleHistoryFragment fragment = {.block_index = 0, .offset = 0, .bytes = NULL, .num_bytes = 0};
+    void *user_data = (void *)0x75;
+    msg_transceiver_send_sample_history_message(&fragment, message_sent_cb_1, user_data);
+
+    CHECK_C(message_sent_cb_1_called);
+    CHECK_C(!message_sent_cb_1_result);
+    CHECK_EQUAL_C_POINTER(user_data, message_sent_cb_1_user_data);
+}
+
+TEST_C(MsgTransceiver, SampleHistoryFragmentNull)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("fragment", "msg_transceiver_send_sample_history_message");
+    msg_transceiver_send_sample_history_message(NULL, message_sent_cb, NULL);
+}
+
+TEST_C(MsgTransceiver, SampleHistoryTooManyBytes)
+{
+    uint8_t block_bytes[17] = {0};
+    MsgTransceiverSampleHistoryFragment fragment = {
+        .block_index = 0,
+        .offset = 0,
+        .bytes = block_bytes,
+        .num_bytes = 17,
+    };
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION(
+        "fragment->num_bytes <= MSG_TRANSCEIVER_SAMPLE_HISTORY_MAX_NUM_BYTES_IN_MESSAGE",
+        "msg_transceiver_send_sample_history_message");
+    msg_transceiver_send_sample_history_message(&fragment, message_sent_cb, NULL);
+}
@@ -11,11 +11,14 @@ TEST_C_WRAPPER(MsgTransceiver, Alert0Silenced);
 TEST_C_WRAPPER(MsgTransceiver, Alert0Raised);
 TEST_C_WRAPPER(MsgTransceiver, Alert1Silenced);
 TEST_C_WRAPPER(MsgTransceiver, Alert8RaisedFailed);
+TEST_C_WRAPPER(MsgTransceiver, Alert300Raised);
 TEST_C_WRAPPER(MsgTransceiver, MessageSentCbCalledWithUserData);
 TEST_C_WRAPPER(MsgTransceiver, RemoveAlert0);
 TEST_C_WRAPPER(MsgTransceiver, RemoveAlert1);
+TEST_C_WRAPPER(MsgTransceiver, RemoveAlert1000);
 TEST_C_WRAPPER(MsgTransceiver, ReceiveCbCalledWithNumBytes0);
 TEST_C_WRAPPER(MsgTransceiver, RemoveAlertMessageWithNoAlertId);
+TEST_C_WRAPPER(MsgTransceiver, RemoveAlertMessageOneAlertIdByte);
 TEST_C_WRAPPER(MsgTransceiver, RemoveAlertMessageTooManyBytes);
 TEST_C_WRAPPER(MsgTransceiver, ReceiveCbBytesNullPointerAssert);
 TEST_C_WRAPPER(MsgTransceiver, RemoveAlertCbExecutedWithUserData);
@@ -42,20 +45,33 @@ TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage15ValidBytes);
 TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage16ValidBytes);
 TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage17ValidBytes);
 TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage18ValidBytes);
-TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage19ValidBytesValidAlert);
 TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage19ValidBytes);
+TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage20ValidBytesValidAlert);
 TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage20ValidBytes);
 TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage21ValidBytes);
 TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage22ValidBytes);
-TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage17ValidBytesHumidity);
+TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage23ValidBytes);
 TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage18ValidBytesHumidity);
-TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage17ValidBytesLightIntensity);
+TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage19ValidBytesHumidity);
 TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage18ValidBytesLightIntensity);
 TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage19ValidBytesLightIntensity);
 TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage20ValidBytesLightIntensity);
+TEST_C_WRAPPER(MsgTransceiver, AddAlertMessage21ValidBytesLightIntensity);
 TEST_C_WRAPPER(MsgTransceiver, AddAlertInvalidNotificationType);
 TEST_C_WRAPPER(MsgTransceiver, AddAlertInvalidVariableIdentifier);
 TEST_C_WRAPPER(MsgTransceiver, AddAlertNumBytesTooLarge);
+TEST_C_WRAPPER(MsgTransceiver, AddAlertExpression);
+TEST_C_WRAPPER(MsgTransceiver, AddAlertNestedExpressions);
+TEST_C_WRAPPER(MsgTransceiver, AddAlertExpressionInvalidOperator);
+TEST_C_WRAPPER(MsgTransceiver, AddAlertExpressionZeroOperands);
+TEST_C_WRAPPER(MsgTransceiver, AddAlertExpressionMaxDepthExceeded);
+TEST_C_WRAPPER(MsgTransceiver, AddAlertBandRequirements);
+TEST_C_WRAPPER(MsgTransceiver, AddAlertBandRequirementWithoutUpperConstraintValue);
+TEST_C_WRAPPER(MsgTransceiver, AddAlertSplitIntoContinuationMessages);
+TEST_C_WRAPPER(MsgTransceiver, AddAlertContinuationWithoutAddAlert);
+TEST_C_WRAPPER(MsgTransceiver, AddAlertContinuationAfterInvalidAddAlert);
+TEST_C_WRAPPER(MsgTransceiver, AddAlertContinuationNumBytesTooLarge);
+TEST_C_WRAPPER(MsgTransceiver, AddAlertDropsIncompleteAlert);
 TEST_C_WRAPPER(MsgTransceiver, DeinitClearsRemoveAlertCb);
 TEST_C_WRAPPER(MsgTransceiver, DeinitClearsAddAlertCb);
 TEST_C_WRAPPER(MsgTransceiver, AddAlertTooManyVariableRequirements);
@@ -68,6 +84,43 @@ TEST_C_WRAPPER(MsgTransceiver, SetAddAlertCbCbNull);
 TEST_C_WRAPPER(MsgTransceiver, SetRemoveAlertCbCbNull);
 TEST_C_WRAPPER(MsgTransceiver, SendTwoSuccessfulAlertStatusChangeMessages);
 TEST_C_WRAPPER(MsgTransceiver, TooManyConcurrentAlertStatusChangeMessages);
-TEST_C_WRAPPER(MsgTransceiver, ReuseAlertStatusChangeMessageSlot);
+TEST_C_WRAPPER(MsgTransceiver, ReuseMessageSlot);
 TEST_C_WRAPPER(MsgTransceiver, AlertStatusChangeMessagesCbsExecutedInReverseOrder);
 TEST_C_WRAPPER(MsgTransceiver, TransmissionCompleteAfterDeinit);
+TEST_C_WRAPPER(MsgTransceiver, AlertStatusChangesOneChange);
+TEST_C_WRAPPER(MsgTransceiver, AlertStatusChangesMaxNumChanges);
+TEST_C_WRAPPER(MsgTransceiver, AlertStatusChangesMessageSharesSlotsWithAlertStatusChangeMessage);
+TEST_C_WRAPPER(MsgTransceiver, AlertStatusChangesChangesNull);
+TEST_C_WRAPPER(MsgTransceiver, AlertStatusChangesNumChanges0);
+TEST_C_WRAPPER(MsgTransceiver, AlertStatusChangesTooManyChanges);
+TEST_C_WRAPPER(MsgTransceiver, GetStats);
+TEST_C_WRAPPER(MsgTransceiver, GetStatsMessageTooManyBytes);
+TEST_C_WRAPPER(MsgTransceiver, GetStatsCbExecutedWithUserData);
+TEST_C_WRAPPER(MsgTransceiver, DeinitClearsGetStatsCb);
+TEST_C_WRAPPER(MsgTransceiver, SetGetStatsCbCbNull);
+TEST_C_WRAPPER(MsgTransceiver, EventQueueStats);
+TEST_C_WRAPPER(MsgTransceiver, EventQueueStatsStatsNull);
+TEST_C_WRAPPER(MsgTransceiver, EventStats);
+TEST_C_WRAPPER(MsgTransceiver, EventStatsMessageSharesSlotsWithAlertStatusChangeMessage);
+TEST_C_WRAPPER(MsgTransceiver, EventStatsMessageDoesNotUseReservedSlots);
+TEST_C_WRAPPER(MsgTransceiver, EventStatsStatsNull);
+TEST_C_WRAPPER(MsgTransceiver, ReplaceAllAlertsTwoAlerts);
+TEST_C_WRAPPER(MsgTransceiver, ReplaceAllAlertsNoAlerts);
+TEST_C_WRAPPER(MsgTransceiver, ReplaceAllAlertsMessageOnlyMessageId);
+TEST_C_WRAPPER(MsgTransceiver, ReplaceAllAlertsTooManyAlerts);
+TEST_C_WRAPPER(MsgTransceiver, ReplaceAllAlertsSecondAlertIncomplete);
+TEST_C_WRAPPER(MsgTransceiver, ReplaceAllAlertsTooManyBytes);
+TEST_C_WRAPPER(MsgTransceiver, ReplaceAllAlertsCbExecutedWithUserData);
+TEST_C_WRAPPER(MsgTransceiver, DeinitClearsReplaceAllAlertsCb);
+TEST_C_WRAPPER(MsgTransceiver, SetReplaceAllAlertsCbCbNull);
+TEST_C_WRAPPER(MsgTransceiver, GetSampleHistory);
+TEST_C_WRAPPER(MsgTransceiver, GetSampleHistoryMessageTooManyBytes);
+TEST_C_WRAPPER(MsgTransceiver, GetSampleHistoryCbExecutedWithUserData);
+TEST_C_WRAPPER(MsgTransceiver, DeinitClearsGetSampleHistoryCb);
+TEST_C_WRAPPER(MsgTransceiver, SetGetSampleHistoryCbCbNull);
+TEST_C_WRAPPER(MsgTransceiver, SampleHistory);
+TEST_C_WRAPPER(MsgTransceiver, SampleHistoryMaxNumBytes);
+TEST_C_WRAPPER(MsgTransceiver, SampleHistoryEndOfReadOut);
+TEST_C_WRAPPER(MsgTransceiver, SampleHistoryMessageDoesNotUseReservedSlots);
+TEST_C_WRAPPER(MsgTransceiver, SampleHistoryFragmentNull);
+TEST_C_WRAPPER(MsgTransceiver, SampleHistoryTooManyBytes);
@@ -19,7 +19,15 @@ static void add_alert_cb(const MsgTransceiverAlert *const alert, void *user_data
 {
 }
 
-static void remove_alert_cb(uint8_t alert_id, void *user_data)
+static void remove_alert_cb(uint16_t alert_id, void *user_data)
+{
+}
+
+static void get_stats_cb(void *user_data)
+{
+}
+
+static void replace_all_alerts_cb(const MsgTransceiverAlert *const alerts, size_t num_alerts, void *user_data)
 {
 }
 
@@ -51,6 +59,13 @@ TEST_C(MsgTransceiverNoSetup, SendAlertStatusChangeMessageCalledBeforeInit)
     msg_transceiver_send_alert_status_change_message(0, false, message_sent_cb, NULL);
 }
 
+TEST_C(MsgTransceiverNoSetup, SendAlertStatusChangesMessageCalledBeforeInit)
+{
+    MsgTransceiverAlertStatusChange changes[] = {{.alert_id = 0, .is_raised = false}};
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("initialized", "msg_transceiver_send_alert_status_changes_message");
+    msg_transceiver_send_alert_status_changes_message(changes, 1, message_sent_cb, NULL);
+}
+
 TEST_C(MsgTransceiverNoSetup, SetAddAlertCbCalledBeforeInit)
 {
     TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("initialized", "msg_transceiver_set_add_alert_cb");
@@ -63,6 +78,32 @@ TEST_C(MsgTransceiverNoSetup, SetRemoveAlertCbCalledBeforeInit)
     msg_transceiver_set_remove_alert_cb(remove_alert_cb, NULL);
 }
 
+TEST_C(MsgTransceiverNoSetup, SetGetStatsCbCalledBeforeInit)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("initialized", "msg_transceiver_set_get_stats_cb");
+    msg_transceiver_set_get_stats_cb(get_stats_cb, NULL);
+}
+
+TEST_C(MsgTransceiverNoSetup, SendEventQueueStatsMessageCalledBeforeInit)
+{
+    MsgTransceiverEventQueueStats stats = {0};
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("initialized", "msg_transceiver_send_event_queue_stats_message");
+    msg_transceiver_send_event_queue_stats_message(&stats, message_sent_cb, NULL);
+}
+
+TEST_C(MsgTransceiverNoSetup, SendEventStatsMessageCalledBeforeInit)
+{
+    MsgTransceiverEventStats stats = {0};
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("initialized", "msg_transceiver_send_event_stats_message");
+    msg_transceiver_send_event_stats_message(&stats, message_sent_cb, NULL);
+}
+
+TEST_C(MsgTransceiverNoSetup, SetReplaceAllAlertsCbCalledBeforeInit)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("initialized", "msg_transceiver_set_replace_all_alerts_cb");
+    msg_transceiver_set_replace_all_alerts_cb(replace_all_alerts_cb, NULL);
+}
+
 TEST_C(MsgTransceiverNoSetup, InitCalledTwice)
 {
     /* Expected to be called in the first call to msg_transceiver_init */
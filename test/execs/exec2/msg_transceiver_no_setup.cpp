@@ -8,7 +8,12 @@ TEST_GROUP_C_WRAPPER(MsgTransceiverNoSetup)
 };
 
 TEST_C_WRAPPER(MsgTransceiverNoSetup, SendAlertStatusChangeMessageCalledBeforeInit);
+TEST_C_WRAPPER(MsgTransceiverNoSetup, SendAlertStatusChangesMessageCalledBeforeInit);
 TEST_C_WRAPPER(MsgTransceiverNoSetup, SetAddAlertCbCalledBeforeInit);
 TEST_C_WRAPPER(MsgTransceiverNoSetup, SetRemoveAlertCbCalledBeforeInit);
+TEST_C_WRAPPER(MsgTransceiverNoSetup, SetGetStatsCbCalledBeforeInit);
+TEST_C_WRAPPER(MsgTransceiverNoSetup, SendEventQueueStatsMessageCalledBeforeInit);
+TEST_C_WRAPPER(MsgTransceiverNoSetup, SendEventStatsMessageCalledBeforeInit);
+TEST_C_WRAPPER(MsgTransceiverNoSetup, SetReplaceAllAlertsCbCalledBeforeInit);
 TEST_C_WRAPPER(MsgTransceiverNoSetup, InitCalledTwice);
 TEST_C_WRAPPER(MsgTransceiverNoSetup, DeinitDoesNothingIfAlreadyDeinitialized);
@@ -260,3 +260,77 @@ TEST(OpsQueue, OpCompleteSelfNull)
     TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self", "ops_queue_op_complete");
     ops_queue_op_complete(NULL);
 }
+
+TEST(OpsQueue, HigherPriorityOpStartedFirst)
+{
+    OpsQueueTestOp op1 = {.some_value = 23};
+    OpsQueueTestOp op2 = {.some_value = 24};
+    OpsQueueTestOp op3 = {.some_value = 25};
+
+    mock()
+        .expectOneCall("mock_ops_queue_start_op")
+        .withMemoryBufferParameter("op", (const uint8_t *)&op1, sizeof(OpsQueueTestOp))
+        .withParameter("user_data", start_op_user_data);
+    ops_queue_add_op(inst, &op1);
+    ops_queue_add_op(inst, &op2);
+    ops_queue_add_op_with_priority(inst, &op3, 1);
+
+    /* op3 was added after op2, but has higher priority */
+    mock()
+        .expectOneCall("mock_ops_queue_start_op")
+        .withMemoryBufferParameter("op", (const uint8_t *)&op3, sizeof(OpsQueueTestOp))
+        .withParameter("user_data", start_op_user_data);
+    ops_queue_op_complete(inst);
+
+    mock()
+        .expectOneCall("mock_ops_queue_start_op")
+        .withMemoryBufferParameter("op", (const uint8_t *)&op2, sizeof(OpsQueueTestOp))
+        .withParameter("user_data", start_op_user_data);
+    ops_queue_op_complete(inst);
+}
+
+TEST(OpsQueue, SamePriorityOpsStartedInOrder)
+{
+    OpsQueueTestOp op1 = {.some_value = 26};
+    OpsQueueTestOp op2 = {.some_value = 27};
+    OpsQueueTestOp op3 = {.some_value = 28};
+
+    mock()
+        .expectOneCall("mock_ops_queue_start_op")
+        .withMemoryBufferParameter("op", (const uint8_t *)&op1, sizeof(OpsQueueTestOp))
+        .withParameter("user_data", start_op_user_data);
+    ops_queue_add_op(inst, &op1);
+    ops_queue_add_op_with_priority(inst, &op2, 1);
+    ops_queue_add_op_with_priority(inst, &op3, 1);
+
+    mock()
+        .expectOneCall("mock_ops_queue_start_op")
+        .withMemoryBufferParameter("op", (const uint8_t *)&op2, sizeof(OpsQueueTestOp))
+        .withParameter("user_data", start_op_user_data);
+    ops_queue_op_complete(inst);
+
+    mock()
+        .expectOneCall("mock_ops_queue_start_op")
+        .withMemoryBufferParameter("op", (const uint8_t *)&op3, sizeof(OpsQueueTestOp))
+        .withParameter("user_data", start_op_user_data);
+    ops_queue_op_complete(inst);
+}
+
+TEST(OpsQueue, AddOpWithPriorityAssertsWhenQueueFull)
+{
+    OpsQueueTestOp op1 = {.some_value = 38};
+    OpsQueueTestOp op2 = {.some_value = 39};
+    OpsQueueTestOp op3 = {.some_value = 40};
+    OpsQueueTestOp op4 = {.some_value = 41};
+
+    mock()
+        .expectOneCall("mock_ops_queue_start_op")
+        .withMemoryBufferParameter("op", (const uint8_t *)&op1, sizeof(OpsQueueTestOp))
+        .withParameter("user_data", start_op_user_data);
+    ops_queue_add_op(inst, &op1);
+    ops_queue_add_op_with_priority(inst, &op2, 1);
+    ops_queue_add_op_with_priority(inst, &op3, 1);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("pushed", "ops_queue_add_op_with_priority");
+    ops_queue_add_op_with_priority(inst, &op4, 1);
+}
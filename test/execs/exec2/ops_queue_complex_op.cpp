@@ -5,6 +5,7 @@
 #include "CppUTestExt/TestAssertPlugin.h"
 
 #include "ops_queue.h"
+#include "config.h"
 #include "mocks/mock_ops_queue_start_op.h"
 
 struct OpsQueueComplexOp {
@@ -162,3 +163,10 @@ TEST(OpsQueueComplexOp, CreateOpBufNull)
     inst = ops_queue_create(sizeof(OpsQueueComplexOp), OPS_QUEUE_TEST_COMPLEX_OP_NUM_OPS, ops_buf, NULL,
                             mock_ops_queue_start_op, start_op_user_data);
 }
+
+TEST(OpsQueueComplexOp, CreateNumOpsTooLarge)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_num_pending_ops_supported", "ops_queue_create");
+    inst = ops_queue_create(sizeof(OpsQueueComplexOp), CONFIG_OPS_QUEUE_MAX_NUM_PENDING_OPS + 2, ops_buf, &op_buf,
+                            mock_ops_queue_start_op, start_op_user_data);
+}
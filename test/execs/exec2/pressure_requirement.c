@@ -23,6 +23,21 @@ static void test_evaluate(Pressure current_pressure, uint8_t operator, Pressure
     variable_requirement_destroy(pressure_requirement);
 }
 
+static void test_evaluate_band(Pressure current_pressure, uint8_t operator, Pressure lower_value, Pressure upper_value,
+                               bool expected_result)
+{
+    mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
+    mock_c()->expectOneCall("current_pressure_get")->andReturnUnsignedIntValue(current_pressure);
+    mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
+
+    pressure_requirement = pressure_requirement_create_band(0, operator, lower_value, upper_value);
+    bool result = variable_requirement_evaluate(pressure_requirement);
+    CHECK_EQUAL_C_BOOL(expected_result, result);
+
+    /* Clean up */
+    variable_requirement_destroy(pressure_requirement);
+}
+
 TEST_GROUP_C_SETUP(PressureRequirement)
 {
     requirement_buffer = fake_variable_requirement_allocator_alloc();
@@ -80,10 +95,10 @@ TEST_C(PressureRequirement, getAlertIdReturnsAlertId1PassedToCreate)
 {
     mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
     mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
-    uint8_t expected_alert_id = 1;
+    uint16_t expected_alert_id = 1;
 
     pressure_requirement = pressure_requirement_create(expected_alert_id, VARIABLE_REQUIREMENT_OPERATOR_GEQ, 200);
-    uint8_t actual_alert_id = variable_requirement_get_alert_id(pressure_requirement);
+    uint16_t actual_alert_id = variable_requirement_get_alert_id(pressure_requirement);
 
     CHECK_EQUAL_C_UINT(expected_alert_id, actual_alert_id);
 
@@ -95,10 +110,10 @@ TEST_C(PressureRequirement, getAlertIdReturnsAlertId2PassedToCreate)
 {
     mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
     mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
-    uint8_t expected_alert_id = 2;
+    uint16_t expected_alert_id = 2;
 
     pressure_requirement = pressure_requirement_create(expected_alert_id, VARIABLE_REQUIREMENT_OPERATOR_LEQ, 10000);
-    uint8_t actual_alert_id = variable_requirement_get_alert_id(pressure_requirement);
+    uint16_t actual_alert_id = variable_requirement_get_alert_id(pressure_requirement);
 
     CHECK_EQUAL_C_UINT(expected_alert_id, actual_alert_id);
 
@@ -106,6 +121,21 @@ TEST_C(PressureRequirement, getAlertIdReturnsAlertId2PassedToCreate)
     variable_requirement_destroy(pressure_requirement);
 }
 
+TEST_C(PressureRequirement, getThresholdReturnsValuePassedToCreate)
+{
+    mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
+    mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
+    Pressure requirement_value = 1013;
+
+    pressure_requirement = pressure_requirement_create(0, VARIABLE_REQUIREMENT_OPERATOR_GEQ, requirement_value);
+    VariableRequirementThreshold threshold = variable_requirement_get_threshold(pressure_requirement);
+
+    CHECK_EQUAL_C_LONGLONG(requirement_value, threshold);
+
+    /* Clean up */
+    variable_requirement_destroy(pressure_requirement);
+}
+
 TEST_C(PressureRequirement, createRaisesAssertIfMemoryAllocationFailed)
 {
     mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue((void *)NULL);
@@ -113,3 +143,44 @@ TEST_C(PressureRequirement, createRaisesAssertIfMemoryAllocationFailed)
 
     pressure_requirement_create(0, VARIABLE_REQUIREMENT_OPERATOR_GEQ, 0);
 }
+
+TEST_C(PressureRequirement, evaluateReturnsTrueOperatorINSIDEValueEqualToUpper)
+{
+    test_evaluate_band(10500, VARIABLE_REQUIREMENT_OPERATOR_INSIDE, 9500, 10500, true);
+}
+
+TEST_C(PressureRequirement, evaluateReturnsFalseOperatorINSIDEValueBelow)
+{
+    test_evaluate_band(9499, VARIABLE_REQUIREMENT_OPERATOR_INSIDE, 9500, 10500, false);
+}
+
+TEST_C(PressureRequirement, evaluateReturnsTrueOperatorOUTSIDEValueBelow)
+{
+    test_evaluate_band(9499, VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE, 9500, 10500, true);
+}
+
+TEST_C(PressureRequirement, evaluateReturnsFalseOperatorOUTSIDEValueInside)
+{
+    test_evaluate_band(10000, VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE, 9500, 10500, false);
+}
+
+TEST_C(PressureRequirement, getUpperThresholdReturnsUpperValuePassedToCreateBand)
+{
+    mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
+    mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
+
+    pressure_requirement = pressure_requirement_create_band(0, VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE, 9500, 10500);
+
+    CHECK_EQUAL_C_LONGLONG(9500, variable_requirement_get_threshold(pressure_requirement));
+    CHECK_EQUAL_C_LONGLONG(10500, variable_requirement_get_upper_threshold(pressure_requirement));
+
+    /* Clean up */
+    variable_requirement_destroy(pressure_requirement);
+}
+
+TEST_C(PressureRequirement, createBandRaisesAssertIfLowerValueNotBelowUpperValue)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("is_valid_band", "pressure_requirement_create_band");
+
+    pressure_requirement_create_band(0, VARIABLE_REQUIREMENT_OPERATOR_INSIDE, 9500, 9500);
+}
@@ -17,4 +17,11 @@ TEST_C_WRAPPER(PressureRequirement, evaluateReturnsTrueOperatorGEQBothValuesEqua
 TEST_C_WRAPPER(PressureRequirement, evaluateReturnsTrueOperatorLEQBothValuesEqualZero);
 TEST_C_WRAPPER(PressureRequirement, getAlertIdReturnsAlertId1PassedToCreate);
 TEST_C_WRAPPER(PressureRequirement, getAlertIdReturnsAlertId2PassedToCreate);
+TEST_C_WRAPPER(PressureRequirement, getThresholdReturnsValuePassedToCreate);
 TEST_C_WRAPPER(PressureRequirement, createRaisesAssertIfMemoryAllocationFailed);
+TEST_C_WRAPPER(PressureRequirement, evaluateReturnsTrueOperatorINSIDEValueEqualToUpper);
+TEST_C_WRAPPER(PressureRequirement, evaluateReturnsFalseOperatorINSIDEValueBelow);
+TEST_C_WRAPPER(PressureRequirement, evaluateReturnsTrueOperatorOUTSIDEValueBelow);
+TEST_C_WRAPPER(PressureRequirement, evaluateReturnsFalseOperatorOUTSIDEValueInside);
+TEST_C_WRAPPER(PressureRequirement, getUpperThresholdReturnsUpperValuePassedToCreateBand);
+TEST_C_WRAPPER(PressureRequirement, createBandRaisesAssertIfLowerValueNotBelowUpperValue);
@@ -0,0 +1,220 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTestExt/TestAssertPlugin.h"
+
+#include "sample_history.h"
+#include "config.h"
+#include "fake_eas_current_time.h"
+
+static uint8_t block[CONFIG_SAMPLE_HISTORY_BLOCK_SIZE];
+static size_t block_num_bytes;
+
+/**
+ * @brief Pop the oldest block and check that it has the expected bytes.
+ */
+static void check_pop_block(const uint8_t *const expected_block, size_t expected_num_bytes)
+{
+    CHECK_TRUE(sample_history_pop_block(block, &block_num_bytes));
+    CHECK_EQUAL(expected_num_bytes, block_num_bytes);
+    MEMCMP_EQUAL(expected_block, block, expected_num_bytes);
+}
+
+// clang-format off
+TEST_GROUP(SampleHistory)
+{
+    void setup()
+    {
+        sample_history_clear();
+        fake_eas_current_time_set(0);
+        memset(block, 0, sizeof(block));
+        block_num_bytes = 0;
+    }
+};
+// clang-format on
+
+TEST(SampleHistory, EmptyHistory)
+{
+    CHECK_FALSE(sample_history_pop_block(block, &block_num_bytes));
+}
+
+TEST(SampleHistory, OneTemperatureSample)
+{
+    fake_eas_current_time_set(1000);
+    sample_history_record_temperature(-5);
+
+    uint8_t expected_block[] = {
+        0xE8, 0x03, 0x00, 0x00, /* block time - 1000 ms */
+        0x00,                   /* 0 ms elapsed, temperature */
+        0x09,                   /* zigzag(-5 - 0) */
+    };
+    check_pop_block(expected_block, sizeof(expected_block));
+    CHECK_FALSE(sample_history_pop_block(block, &block_num_bytes));
+}
+
+TEST(SampleHistory, ValueDifferencesAndElapsedTime)
+{
+    sample_history_record_temperature(20);
+    fake_eas_current_time_set(250);
+    sample_history_record_temperature(21);
+    fake_eas_current_time_set(1000);
+    sample_history_record_temperature(19);
+
+    uint8_t expected_block[] = {
+        0x00, 0x00, 0x00, 0x00, /* block time - 0 ms */
+        0x00,                   /* 0 ms elapsed, temperature */
+        0x28,                   /* zigzag(20 - 0) */
+        0xE8, 0x07,             /* 250 ms elapsed, temperature */
+        0x02,                   /* zigzag(21 - 20) */
+        0xB8, 0x17,             /* 750 ms elapsed, temperature */
+        0x03,                   /* zigzag(19 - 21) */
+    };
+    check_pop_block(expected_block, sizeof(expected_block));
+}
+
+TEST(SampleHistory, UnchangedValueNotRecorded)
+{
+    sample_history_record_humidity(500);
+    fake_eas_current_time_set(250);
+    sample_history_record_humidity(500);
+
+    uint8_t expected_block[] = {
+        0x00, 0x00, 0x00, 0x00, /* block time - 0 ms */
+        0x02,                   /* 0 ms elapsed, humidity */
+        0xE8, 0x07,             /* zigzag(500 - 0) */
+    };
+    check_pop_block(expected_block, sizeof(expected_block));
+}
+
+TEST(SampleHistory, ChangeSmallerThanMinChangeNotRecorded)
+{
+    CHECK_EQUAL(10, CONFIG_SAMPLE_HISTORY_LIGHT_INTENSITY_MIN_CHANGE);
+    sample_history_record_light_intensity(1000);
+    fake_eas_current_time_set(10);
+    sample_history_record_light_intensity(1005);
+    /* The change is measured from the last recorded value, not from the last sample */
+    fake_eas_current_time_set(20);
+    sample_history_record_light_intensity(1009);
+    fake_eas_current_time_set(30);
+    sample_history_record_light_intensity(1010);
+
+    uint8_t expected_block[] = {
+        0x00, 0x00, 0x00, 0x00, /* block time - 0 ms */
+        0x03,                   /* 0 ms elapsed, light intensity */
+        0xD0, 0x0F,             /* zigzag(1000 - 0) */
+        0x7B,                   /* 30 ms elapsed, light intensity */
+        0x14,                   /* zigzag(1010 - 1000) */
+    };
+    check_pop_block(expected_block, sizeof(expected_block));
+}
+
+TEST(SampleHistory, SampleWithinMinIntervalNotRecorded)
+{
+    CHECK_EQUAL(10, CONFIG_SAMPLE_HISTORY_MIN_INTERVAL_MS);
+    fake_eas_current_time_set(100);
+    sample_history_record_temperature(20);
+    fake_eas_current_time_set(105);
+    sample_history_record_temperature(25);
+    fake_eas_current_time_set(109);
+    sample_history_record_temperature(22);
+    fake_eas_current_time_set(110);
+    sample_history_record_temperature(21);
+
+    uint8_t expected_block[] = {
+        0x64, 0x00, 0x00, 0x00, /* block time - 100 ms */
+        0x00,                   /* 0 ms elapsed, temperature */
+        0x28,                   /* zigzag(20 - 0) */
+        0x28,                   /* 10 ms elapsed, temperature */
+        0x02,                   /* zigzag(21 - 20) */
+    };
+    check_pop_block(expected_block, sizeof(expected_block));
+}
+
+TEST(SampleHistory, AllVariables)
+{
+    sample_history_record_temperature(1);
+    sample_history_record_pressure(2);
+    sample_history_record_humidity(3);
+    fake_eas_current_time_set(1);
+    sample_history_record_light_intensity(100000);
+
+    uint8_t expected_block[] = {
+        0x00, 0x00, 0x00, 0x00, /* block time - 0 ms */
+        0x00, 0x02,             /* 0 ms elapsed, temperature, zigzag(1) */
+        0x01, 0x04,             /* 0 ms elapsed, pressure, zigzag(2) */
+        0x02, 0x06,             /* 0 ms elapsed, humidity, zigzag(3) */
+        0x07, 0xC0, 0x9A, 0x0C, /* 1 ms elapsed, light intensity, zigzag(100000) */
+    };
+    check_pop_block(expected_block, sizeof(expected_block));
+}
+
+TEST(SampleHistory, NewBlockStartsWithValuesOfOtherVariables)
+{
+    sample_history_record_pressure(1000);
+    sample_history_record_temperature(7);
+    uint8_t expected_block_0[] = {
+        0x00, 0x00, 0x00, 0x00, /* block time - 0 ms */
+        0x01, 0xD0, 0x0F,       /* 0 ms elapsed, pressure, zigzag(1000) */
+        0x00, 0x0E,             /* 0 ms elapsed, temperature, zigzag(7) */
+    };
+    /* Pops the block that samples are recorded into, so the next recorded sample starts a new block */
+    check_pop_block(expected_block_0, sizeof(expected_block_0));
+
+    fake_eas_current_time_set(10);
+    sample_history_record_temperature(5);
+
+    uint8_t expected_block[] = {
+        0x0A, 0x00, 0x00, 0x00, /* block time - 10 ms */
+        0x01, 0xD0, 0x0F,       /* 0 ms elapsed, pressure, zigzag(1000) */
+        0x00, 0x0A,             /* 0 ms elapsed, temperature, zigzag(5) */
+    };
+    check_pop_block(expected_block, sizeof(expected_block));
+}
+
+TEST(SampleHistory, FullRingBufferDiscardsOldestBlock)
+{
+    /* Samples every minimum interval, so every sample is recorded. Every record takes two bytes, so 20 records fit into
+     * one block of 44 bytes. Record 5 blocks - the first one is discarded once the ring buffer holds 3 full blocks. */
+    CHECK_EQUAL(44, CONFIG_SAMPLE_HISTORY_BLOCK_SIZE);
+    CHECK_EQUAL(3, CONFIG_SAMPLE_HISTORY_NUM_BLOCKS);
+    CHECK_EQUAL(10, CONFIG_SAMPLE_HISTORY_MIN_INTERVAL_MS);
+    for (EasTime time = 0; time < 1000; time += 10) {
+        fake_eas_current_time_set(time);
+        sample_history_record_temperature((time % 20) ? 11 : 10);
+    }
+
+    for (EasTime block_time = 200; block_time < 1000; block_time += 200) {
+        CHECK_TRUE(sample_history_pop_block(block, &block_num_bytes));
+        CHECK_EQUAL(44, block_num_bytes);
+        CHECK_EQUAL(block_time, block[0] | (block[1] << 8));
+        /* The first record of a block is the difference from 0. Blocks start every 20 records, so value is 10. */
+        CHECK_EQUAL(0x00, block[4]);
+        CHECK_EQUAL(0x14, block[5]);
+    }
+    CHECK_FALSE(sample_history_pop_block(block, &block_num_bytes));
+}
+
+TEST(SampleHistory, ClearDiscardsSamplesAndValues)
+{
+    sample_history_record_pressure(1000);
+    sample_history_clear();
+    CHECK_FALSE(sample_history_pop_block(block, &block_num_bytes));
+
+    /* The new block does not start with the pressure value, because it was discarded */
+    sample_history_record_temperature(5);
+    uint8_t expected_block[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x0A};
+    check_pop_block(expected_block, sizeof(expected_block));
+}
+
+TEST(SampleHistory, PopBlockBlockNull)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("block", "sample_history_pop_block");
+    sample_history_pop_block(NULL, &block_num_bytes);
+}
+
+TEST(SampleHistory, PopBlockNumBytesNull)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("num_bytes", "sample_history_pop_block");
+    sample_history_pop_block(block, NULL);
+}
@@ -0,0 +1,206 @@
+#include <stdint.h>
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTestExt/MockSupport.h"
+#include "CppUTestExt/TestAssertPlugin.h"
+
+#include "sensor_readout_scheduler.h"
+#include "mocks/mock_temperature_requirement_list.h"
+#include "mocks/mock_pressure_requirement_list.h"
+#include "mocks/mock_humidity_requirement_list.h"
+#include "mocks/mock_light_intensity_requirement_list.h"
+#include "config.h"
+
+/* Distance at and above which a readout period is the maximum readout period */
+#define TEST_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_PERIOD_DISTANCE                                                  \
+    ((CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_PERIOD_MS *                                                      \
+      CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_RATE_OF_CHANGE) /                                                \
+     1000)
+
+static void expect_temperature_distance(Temperature temperature, VariableRequirementThreshold distance)
+{
+    mock()
+        .expectOneCall("temperature_requirement_list_get_distance_to_nearest")
+        .withParameter("value", temperature)
+        .andReturnValue((long)distance);
+}
+
+static void expect_temperature_readout_period(uint32_t period_ms)
+{
+    mock().expectOneCall("temperature_sensor_set_readout_period").withParameter("period_ms", period_ms);
+}
+
+static void expect_min_readout_periods()
+{
+    expect_temperature_readout_period(CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MIN_PERIOD_MS);
+    mock()
+        .expectOneCall("pressure_sensor_set_readout_period")
+        .withParameter("period_ms", (uint32_t)CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MIN_PERIOD_MS);
+    mock()
+        .expectOneCall("humidity_sensor_set_readout_period")
+        .withParameter("period_ms", (uint32_t)CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MIN_PERIOD_MS);
+    mock()
+        .expectOneCall("light_intensity_sensor_set_readout_period")
+        .withParameter("period_ms", (uint32_t)CONFIG_SENSOR_READOUT_SCHEDULER_LIGHT_INTENSITY_MIN_PERIOD_MS);
+}
+
+// clang-format off
+TEST_GROUP(SensorReadoutScheduler)
+{
+};
+// clang-format on
+
+TEST(SensorReadoutScheduler, ValueAtRequirementValueMinPeriod)
+{
+    expect_temperature_distance(220, 0);
+    expect_temperature_readout_period(CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MIN_PERIOD_MS);
+
+    sensor_readout_scheduler_schedule_temperature(220);
+}
+
+TEST(SensorReadoutScheduler, ValueCloseToRequirementValueClampedToMinPeriod)
+{
+    /* 1 / 5 per second = 200 ms, below the minimum period */
+    expect_temperature_distance(221, 1);
+    expect_temperature_readout_period(CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MIN_PERIOD_MS);
+
+    sensor_readout_scheduler_schedule_temperature(221);
+}
+
+TEST(SensorReadoutScheduler, PeriodScalesWithDistance)
+{
+    /* Distance / maximum rate of change of 5 per second */
+    expect_temperature_distance(230, 10);
+    expect_temperature_readout_period(2000);
+    expect_temperature_distance(240, 20);
+    expect_temperature_readout_period(4000);
+
+    sensor_readout_scheduler_schedule_temperature(230);
+    sensor_readout_scheduler_schedule_temperature(240);
+}
+
+TEST(SensorReadoutScheduler, PeriodJustBelowMaxPeriod)
+{
+    expect_temperature_distance(269, TEST_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_PERIOD_DISTANCE - 1);
+    expect_temperature_readout_period(CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_PERIOD_MS - 200);
+
+    sensor_readout_scheduler_schedule_temperature(269);
+}
+
+TEST(SensorReadoutScheduler, ValueFarFromRequirementValueClampedToMaxPeriod)
+{
+    expect_temperature_distance(270, TEST_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_PERIOD_DISTANCE);
+    expect_temperature_readout_period(CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_PERIOD_MS);
+    expect_temperature_distance(-1000, 1000000);
+    expect_temperature_readout_period(CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_PERIOD_MS);
+
+    sensor_readout_scheduler_schedule_temperature(270);
+    sensor_readout_scheduler_schedule_temperature(-1000);
+}
+
+TEST(SensorReadoutScheduler, NoRequirementsMaxPeriod)
+{
+    /* Distance of an empty list */
+    expect_temperature_distance(220, INT64_MAX);
+    expect_temperature_readout_period(CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_PERIOD_MS);
+
+    sensor_readout_scheduler_schedule_temperature(220);
+}
+
+TEST(SensorReadoutScheduler, NegativeDistance)
+{
+    expect_temperature_distance(220, -1);
+
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("distance >= 0", "get_readout_period");
+    sensor_readout_scheduler_schedule_temperature(220);
+}
+
+TEST(SensorReadoutScheduler, PressureUsesPressureLimitsAndRateOfChange)
+{
+    /* 10 / 5 per second */
+    mock()
+        .expectOneCall("pressure_requirement_list_get_distance_to_nearest")
+        .withParameter("value", 10100)
+        .andReturnValue((long)10);
+    mock().expectOneCall("pressure_sensor_set_readout_period").withParameter("period_ms", (uint32_t)2000);
+    mock()
+        .expectOneCall("pressure_requirement_list_get_distance_to_nearest")
+        .withParameter("value", 10200)
+        .andReturnValue((long)1000);
+    mock()
+        .expectOneCall("pressure_sensor_set_readout_period")
+        .withParameter("period_ms", (uint32_t)CONFIG_SENSOR_READOUT_SCHEDULER_PRESSURE_MAX_PERIOD_MS);
+
+    sensor_readout_scheduler_schedule_pressure(10100);
+    sensor_readout_scheduler_schedule_pressure(10200);
+}
+
+TEST(SensorReadoutScheduler, HumidityUsesHumidityLimitsAndRateOfChange)
+{
+    /* 100 / 20 per second */
+    mock()
+        .expectOneCall("humidity_requirement_list_get_distance_to_nearest")
+        .withParameter("value", 500)
+        .andReturnValue((long)100);
+    mock().expectOneCall("humidity_sensor_set_readout_period").withParameter("period_ms", (uint32_t)5000);
+    /* 5 / 20 per second = 250 ms, below the minimum period */
+    mock()
+        .expectOneCall("humidity_requirement_list_get_distance_to_nearest")
+        .withParameter("value", 405)
+        .andReturnValue((long)5);
+    mock()
+        .expectOneCall("humidity_sensor_set_readout_period")
+        .withParameter("period_ms", (uint32_t)CONFIG_SENSOR_READOUT_SCHEDULER_HUMIDITY_MIN_PERIOD_MS);
+
+    sensor_readout_scheduler_schedule_humidity(500);
+    sensor_readout_scheduler_schedule_humidity(405);
+}
+
+TEST(SensorReadoutScheduler, LightIntensityUsesLightIntensityLimitsAndRateOfChange)
+{
+    /* 3000 / 1000 per second */
+    mock()
+        .expectOneCall("light_intensity_requirement_list_get_distance_to_nearest")
+        .withParameter("value", (uint32_t)7000)
+        .andReturnValue((long)3000);
+    mock().expectOneCall("light_intensity_sensor_set_readout_period").withParameter("period_ms", (uint32_t)3000);
+
+    sensor_readout_scheduler_schedule_light_intensity(7000);
+}
+
+TEST(SensorReadoutScheduler, ResetSetsMinPeriods)
+{
+    expect_min_readout_periods();
+
+    sensor_readout_scheduler_reset();
+}
+
+TEST(SensorReadoutScheduler, RequirementAddedNearValue)
+{
+    /* Far from all requirement values */
+    expect_temperature_distance(220, 1000);
+    expect_temperature_readout_period(CONFIG_SENSOR_READOUT_SCHEDULER_TEMPERATURE_MAX_PERIOD_MS);
+    sensor_readout_scheduler_schedule_temperature(220);
+
+    /* A requirement is added 10 units away from the current value. The period is reset right away, without waiting for
+     * the long readout period to pass. */
+    expect_min_readout_periods();
+    sensor_readout_scheduler_reset();
+
+    /* Next sample schedules the period for the new requirement value */
+    expect_temperature_distance(220, 10);
+    expect_temperature_readout_period(2000);
+    sensor_readout_scheduler_schedule_temperature(220);
+}
+
+TEST(SensorReadoutScheduler, RequirementRemovedNearValue)
+{
+    expect_temperature_distance(220, 10);
+    expect_temperature_readout_period(2000);
+    sensor_readout_scheduler_schedule_temperature(220);
+
+    /* The nearest requirement is removed, so the next sample is far from all requirement values */
+    expect_temperature_distance(220, 30);
+    expect_temperature_readout_period(6000);
+    sensor_readout_scheduler_schedule_temperature(220);
+}
@@ -24,6 +24,21 @@ static void test_evaluate(Temperature current_temperature, uint8_t operator, Tem
     variable_requirement_destroy(temperature_requirement);
 }
 
+static void test_evaluate_band(Temperature current_temperature, uint8_t operator, Temperature lower_value,
+                               Temperature upper_value, bool expected_result)
+{
+    mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
+    mock_c()->expectOneCall("current_temperature_get")->andReturnUnsignedIntValue(current_temperature);
+    mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
+
+    temperature_requirement = temperature_requirement_create_band(0, operator, lower_value, upper_value);
+    bool result = variable_requirement_evaluate(temperature_requirement);
+    CHECK_EQUAL_C_BOOL(expected_result, result);
+
+    /* Clean up */
+    variable_requirement_destroy(temperature_requirement);
+}
+
 TEST_GROUP_C_SETUP(TemperatureRequirement)
 {
     requirement_buffer = fake_variable_requirement_allocator_alloc();
@@ -111,10 +126,10 @@ TEST_C(TemperatureRequirement, getAlertIdReturnsAlertId1PassedToCreate)
 {
     mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
     mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
-    uint8_t expected_alert_id = 1;
+    uint16_t expected_alert_id = 1;
 
     temperature_requirement = temperature_requirement_create(expected_alert_id, VARIABLE_REQUIREMENT_OPERATOR_GEQ, 200);
-    uint8_t actual_alert_id = variable_requirement_get_alert_id(temperature_requirement);
+    uint16_t actual_alert_id = variable_requirement_get_alert_id(temperature_requirement);
 
     CHECK_EQUAL_C_UINT(expected_alert_id, actual_alert_id);
 
@@ -126,11 +141,11 @@ TEST_C(TemperatureRequirement, getAlertIdReturnsAlertId2PassedToCreate)
 {
     mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
     mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
-    uint8_t expected_alert_id = 2;
+    uint16_t expected_alert_id = 2;
 
     temperature_requirement =
         temperature_requirement_create(expected_alert_id, VARIABLE_REQUIREMENT_OPERATOR_LEQ, -200);
-    uint8_t actual_alert_id = variable_requirement_get_alert_id(temperature_requirement);
+    uint16_t actual_alert_id = variable_requirement_get_alert_id(temperature_requirement);
 
     CHECK_EQUAL_C_UINT(expected_alert_id, actual_alert_id);
 
@@ -138,6 +153,36 @@ TEST_C(TemperatureRequirement, getAlertIdReturnsAlertId2PassedToCreate)
     variable_requirement_destroy(temperature_requirement);
 }
 
+TEST_C(TemperatureRequirement, getOperatorReturnsOperatorPassedToCreate)
+{
+    mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
+    mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
+
+    temperature_requirement = temperature_requirement_create(0, VARIABLE_REQUIREMENT_OPERATOR_LEQ, 200);
+    uint8_t operator = variable_requirement_get_operator(temperature_requirement);
+
+    CHECK_EQUAL_C_UINT(VARIABLE_REQUIREMENT_OPERATOR_LEQ, operator);
+
+    /* Clean up */
+    variable_requirement_destroy(temperature_requirement);
+}
+
+/* Tests that a negative requirement value is preserved. */
+TEST_C(TemperatureRequirement, getThresholdReturnsValuePassedToCreate)
+{
+    mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
+    mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
+    Temperature requirement_value = -200;
+
+    temperature_requirement = temperature_requirement_create(0, VARIABLE_REQUIREMENT_OPERATOR_LEQ, requirement_value);
+    VariableRequirementThreshold threshold = variable_requirement_get_threshold(temperature_requirement);
+
+    CHECK_EQUAL_C_LONGLONG(requirement_value, threshold);
+
+    /* Clean up */
+    variable_requirement_destroy(temperature_requirement);
+}
+
 TEST_C(TemperatureRequirement, createRaisesAssertIfMemoryAllocationFailed)
 {
     mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue((void *)NULL);
@@ -145,3 +190,96 @@ TEST_C(TemperatureRequirement, createRaisesAssertIfMemoryAllocationFailed)
 
     temperature_requirement_create(0, VARIABLE_REQUIREMENT_OPERATOR_GEQ, 0);
 }
+
+TEST_C(TemperatureRequirement, evaluateReturnsTrueOperatorINSIDEValueInside)
+{
+    test_evaluate_band(20, VARIABLE_REQUIREMENT_OPERATOR_INSIDE, -50, 100, true);
+}
+
+TEST_C(TemperatureRequirement, evaluateReturnsTrueOperatorINSIDEValueEqualToLower)
+{
+    test_evaluate_band(-50, VARIABLE_REQUIREMENT_OPERATOR_INSIDE, -50, 100, true);
+}
+
+TEST_C(TemperatureRequirement, evaluateReturnsTrueOperatorINSIDEValueEqualToUpper)
+{
+    test_evaluate_band(100, VARIABLE_REQUIREMENT_OPERATOR_INSIDE, -50, 100, true);
+}
+
+TEST_C(TemperatureRequirement, evaluateReturnsFalseOperatorINSIDEValueBelow)
+{
+    test_evaluate_band(-51, VARIABLE_REQUIREMENT_OPERATOR_INSIDE, -50, 100, false);
+}
+
+TEST_C(TemperatureRequirement, evaluateReturnsFalseOperatorINSIDEValueAbove)
+{
+    test_evaluate_band(101, VARIABLE_REQUIREMENT_OPERATOR_INSIDE, -50, 100, false);
+}
+
+TEST_C(TemperatureRequirement, evaluateReturnsTrueOperatorOUTSIDEValueBelow)
+{
+    test_evaluate_band(-51, VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE, -50, 100, true);
+}
+
+TEST_C(TemperatureRequirement, evaluateReturnsTrueOperatorOUTSIDEValueAbove)
+{
+    test_evaluate_band(101, VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE, -50, 100, true);
+}
+
+TEST_C(TemperatureRequirement, evaluateReturnsFalseOperatorOUTSIDEValueEqualToLower)
+{
+    test_evaluate_band(-50, VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE, -50, 100, false);
+}
+
+TEST_C(TemperatureRequirement, evaluateReturnsFalseOperatorOUTSIDEValueInside)
+{
+    test_evaluate_band(20, VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE, -50, 100, false);
+}
+
+TEST_C(TemperatureRequirement, getUpperThresholdReturnsUpperValuePassedToCreateBand)
+{
+    mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
+    mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
+
+    temperature_requirement = temperature_requirement_create_band(0, VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE, -50, 100);
+
+    CHECK_EQUAL_C_LONGLONG(-50, variable_requirement_get_threshold(temperature_requirement));
+    CHECK_EQUAL_C_LONGLONG(100, variable_requirement_get_upper_threshold(temperature_requirement));
+
+    /* Clean up */
+    variable_requirement_destroy(temperature_requirement);
+}
+
+TEST_C(TemperatureRequirement, getUpperThresholdReturnsValuePassedToCreate)
+{
+    mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
+    mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
+
+    temperature_requirement = temperature_requirement_create(0, VARIABLE_REQUIREMENT_OPERATOR_GEQ, -50);
+
+    CHECK_EQUAL_C_LONGLONG(-50, variable_requirement_get_upper_threshold(temperature_requirement));
+
+    /* Clean up */
+    variable_requirement_destroy(temperature_requirement);
+}
+
+TEST_C(TemperatureRequirement, createRaisesAssertIfOperatorIsBandOperator)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("!is_band_operator", "temperature_requirement_create");
+
+    temperature_requirement_create(0, VARIABLE_REQUIREMENT_OPERATOR_INSIDE, 0);
+}
+
+TEST_C(TemperatureRequirement, createBandRaisesAssertIfOperatorIsNotBandOperator)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("is_band_operator", "temperature_requirement_create_band");
+
+    temperature_requirement_create_band(0, VARIABLE_REQUIREMENT_OPERATOR_GEQ, -50, 100);
+}
+
+TEST_C(TemperatureRequirement, createBandRaisesAssertIfLowerValueNotBelowUpperValue)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("is_valid_band", "temperature_requirement_create_band");
+
+    temperature_requirement_create_band(0, VARIABLE_REQUIREMENT_OPERATOR_INSIDE, -50, -50);
+}
@@ -23,4 +23,20 @@ TEST_C_WRAPPER(TemperatureRequirement, evaluateReturnsTrueOperatorLEQValueLessBo
 TEST_C_WRAPPER(TemperatureRequirement, evaluateReturnsFalseOperatorLEQValueGreaterOneNegative);
 TEST_C_WRAPPER(TemperatureRequirement, getAlertIdReturnsAlertId1PassedToCreate);
 TEST_C_WRAPPER(TemperatureRequirement, getAlertIdReturnsAlertId2PassedToCreate);
+TEST_C_WRAPPER(TemperatureRequirement, getOperatorReturnsOperatorPassedToCreate);
+TEST_C_WRAPPER(TemperatureRequirement, getThresholdReturnsValuePassedToCreate);
 TEST_C_WRAPPER(TemperatureRequirement, createRaisesAssertIfMemoryAllocationFailed);
+TEST_C_WRAPPER(TemperatureRequirement, evaluateReturnsTrueOperatorINSIDEValueInside);
+TEST_C_WRAPPER(TemperatureRequirement, evaluateReturnsTrueOperatorINSIDEValueEqualToLower);
+TEST_C_WRAPPER(TemperatureRequirement, evaluateReturnsTrueOperatorINSIDEValueEqualToUpper);
+TEST_C_WRAPPER(TemperatureRequirement, evaluateReturnsFalseOperatorINSIDEValueBelow);
+TEST_C_WRAPPER(TemperatureRequirement, evaluateReturnsFalseOperatorINSIDEValueAbove);
+TEST_C_WRAPPER(TemperatureRequirement, evaluateReturnsTrueOperatorOUTSIDEValueBelow);
+TEST_C_WRAPPER(TemperatureRequirement, evaluateReturnsTrueOperatorOUTSIDEValueAbove);
+TEST_C_WRAPPER(TemperatureRequirement, evaluateReturnsFalseOperatorOUTSIDEValueEqualToLower);
+TEST_C_WRAPPER(TemperatureRequirement, evaluateReturnsFalseOperatorOUTSIDEValueInside);
+TEST_C_WRAPPER(TemperatureRequirement, getUpperThresholdReturnsUpperValuePassedToCreateBand);
+TEST_C_WRAPPER(TemperatureRequirement, getUpperThresholdReturnsValuePassedToCreate);
+TEST_C_WRAPPER(TemperatureRequirement, createRaisesAssertIfOperatorIsBandOperator);
+TEST_C_WRAPPER(TemperatureRequirement, createBandRaisesAssertIfOperatorIsNotBandOperator);
+TEST_C_WRAPPER(TemperatureRequirement, createBandRaisesAssertIfLowerValueNotBelowUpperValue);
@@ -27,7 +27,33 @@ TEST(VariableRequirement, isResultChangedRaisesAssertIfCalledWithNullPointer)
 TEST(VariableRequirement, getAlertIdRaisesAssertIfCalledWithNullPointer)
 {
     TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self", "variable_requirement_get_alert_id");
-    uint8_t unused = variable_requirement_get_alert_id(NULL);
+    uint16_t unused = variable_requirement_get_alert_id(NULL);
+}
+
+TEST(VariableRequirement, getOperatorRaisesAssertIfCalledWithNullPointer)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self", "variable_requirement_get_operator");
+    uint8_t unused = variable_requirement_get_operator(NULL);
+}
+
+TEST(VariableRequirement, getThresholdRaisesAssertIfCalledWithNullPointer)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self", "variable_requirement_get_threshold");
+    VariableRequirementThreshold unused = variable_requirement_get_threshold(NULL);
+}
+
+TEST(VariableRequirement, getUpperThresholdRaisesAssertIfCalledWithNullPointer)
+{
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("self", "variable_requirement_get_upper_threshold");
+    VariableRequirementThreshold unused = variable_requirement_get_upper_threshold(NULL);
+}
+
+TEST(VariableRequirement, isBandOperator)
+{
+    CHECK_FALSE(variable_requirement_is_band_operator(VARIABLE_REQUIREMENT_OPERATOR_GEQ));
+    CHECK_FALSE(variable_requirement_is_band_operator(VARIABLE_REQUIREMENT_OPERATOR_LEQ));
+    CHECK_TRUE(variable_requirement_is_band_operator(VARIABLE_REQUIREMENT_OPERATOR_INSIDE));
+    CHECK_TRUE(variable_requirement_is_band_operator(VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE));
 }
 
 TEST(VariableRequirement, destroyRaisesAssertIfCalledWithNullPointer)
@@ -265,3 +291,14 @@ TEST(VariableRequirementMockCreate, createRaisesAssertIfDestroyIsNull)
                                          MOCK_VARIABLE_REQUIREMENT_PASS_GEQ_OPERATOR_TO_VAR_REQ_CREATE,
                                          MOCK_VARIABLE_REQUIREMENT_PASS_NULL_DESTROY_TO_VAR_REQ_CREATE);
 }
+
+TEST(VariableRequirementMockCreate, createRaisesAssertIfGetThresholdIsNull)
+{
+    mock().expectOneCall("variable_requirement_allocator_alloc").andReturnValue(requirement_buffer);
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("vtable->get_threshold", "variable_requirement_create");
+
+    mock_variable_requirement_create_test_group =
+        mock_variable_requirement_create(MOCK_VARIABLE_REQUIREMENT_PASS_VALID_INSTANCE_TO_VAR_REQ_CREATE,
+                                         MOCK_VARIABLE_REQUIREMENT_PASS_GEQ_OPERATOR_TO_VAR_REQ_CREATE,
+                                         MOCK_VARIABLE_REQUIREMENT_PASS_NULL_GET_THRESHOLD_TO_VAR_REQ_CREATE);
+}
@@ -7,22 +7,28 @@
  * pressure requirements to add to the list. */
 #include "pressure_requirement.h"
 #include "fake_variable_requirement_allocator.h"
-#include "fake_linked_list_node_allocator.h"
 #include "eas_assert.h"
 
 #define TEST_VARIABLE_REQUIREMENT_LIST_MAX_NUM_EXPECTED_REQUIREMENTS 7
 
 typedef struct ExpectedVariableRequirement {
-    void *linked_list_node_buffer;
     void *requirement_buffer;
     VariableRequirement requirement;
     bool is_expected;
 } ExpectedVariableRequirement;
 
-static const uint8_t alert_ids_of_expected_requirements[TEST_VARIABLE_REQUIREMENT_LIST_MAX_NUM_EXPECTED_REQUIREMENTS] =
+static const uint16_t alert_ids_of_expected_requirements[TEST_VARIABLE_REQUIREMENT_LIST_MAX_NUM_EXPECTED_REQUIREMENTS] =
     {2, 1, 1, 1, 0, 3, 3};
+/* Requirement values are deliberately not in ascending order, and two of them are equal. */
+static const Pressure
+    requirement_values_of_expected_requirements[TEST_VARIABLE_REQUIREMENT_LIST_MAX_NUM_EXPECTED_REQUIREMENTS] = {
+        500, 100, 300, 300, 700, 200, 600};
 static ExpectedVariableRequirement expected_requirements[TEST_VARIABLE_REQUIREMENT_LIST_MAX_NUM_EXPECTED_REQUIREMENTS];
 
+/* Requirements in the order in which they were passed to for_each_cb_record_order */
+static VariableRequirement visited_requirements[TEST_VARIABLE_REQUIREMENT_LIST_MAX_NUM_EXPECTED_REQUIREMENTS];
+static size_t num_visited_requirements;
+
 static void expect_requirement_in_list(size_t index)
 {
     EAS_ASSERT(index < TEST_VARIABLE_REQUIREMENT_LIST_MAX_NUM_EXPECTED_REQUIREMENTS);
@@ -65,18 +71,85 @@ static void for_each_cb_expected_requirements(VariableRequirement variable_requi
     actual_requirement_detected_in_list(variable_requirement);
 }
 
+static void for_each_cb_record_order(VariableRequirement variable_requirement)
+{
+    EAS_ASSERT(num_visited_requirements < TEST_VARIABLE_REQUIREMENT_LIST_MAX_NUM_EXPECTED_REQUIREMENTS);
+    visited_requirements[num_visited_requirements] = variable_requirement;
+    num_visited_requirements++;
+}
+
+/* Alert ids and results in the order in which they were passed to result_changed_cb_record */
+static uint16_t reported_alert_ids[TEST_VARIABLE_REQUIREMENT_LIST_MAX_NUM_EXPECTED_REQUIREMENTS];
+static bool reported_results[TEST_VARIABLE_REQUIREMENT_LIST_MAX_NUM_EXPECTED_REQUIREMENTS];
+
+static void result_changed_cb_record(VariableRequirement variable_requirement, uint16_t alert_id, bool result)
+{
+    EAS_ASSERT(num_visited_requirements < TEST_VARIABLE_REQUIREMENT_LIST_MAX_NUM_EXPECTED_REQUIREMENTS);
+    visited_requirements[num_visited_requirements] = variable_requirement;
+    reported_alert_ids[num_visited_requirements] = alert_id;
+    reported_results[num_visited_requirements] = result;
+    num_visited_requirements++;
+}
+
+/**
+ * @brief Check the variable requirement, alert id and result passed to result_changed_cb_record in one of its calls.
+ *
+ * @param report_idx Index of the call to result_changed_cb_record.
+ * @param expected_requirement_idx Index of the expected requirement in expected_requirements.
+ * @param expected_result Expected result.
+ */
+static void check_reported_result(size_t report_idx, size_t expected_requirement_idx, bool expected_result)
+{
+    CHECK_EQUAL_C_POINTER(expected_requirements[expected_requirement_idx].requirement,
+                          visited_requirements[report_idx]);
+    CHECK_EQUAL_C_UBYTE(alert_ids_of_expected_requirements[expected_requirement_idx], reported_alert_ids[report_idx]);
+    CHECK_EQUAL_C_BOOL(expected_result, reported_results[report_idx]);
+}
+
+/* Band requirement created by create_band_requirement, destroyed in teardown */
+static void *band_requirement_buffer;
+static VariableRequirement band_requirement;
+
+/* Alert id of the band requirement, different from alert ids of all expected requirements */
+#define TEST_BAND_REQUIREMENT_ALERT_ID 4
+
+static void create_band_requirement(uint8_t operator, Pressure lower_value, Pressure upper_value)
+{
+    band_requirement_buffer = fake_variable_requirement_allocator_alloc();
+    mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(band_requirement_buffer);
+    band_requirement =
+        pressure_requirement_create_band(TEST_BAND_REQUIREMENT_ALERT_ID, operator, lower_value, upper_value);
+}
+
+static void check_reported_band_result(size_t report_idx, bool expected_result)
+{
+    CHECK_EQUAL_C_POINTER(band_requirement, visited_requirements[report_idx]);
+    CHECK_EQUAL_C_UBYTE(TEST_BAND_REQUIREMENT_ALERT_ID, reported_alert_ids[report_idx]);
+    CHECK_EQUAL_C_BOOL(expected_result, reported_results[report_idx]);
+}
+
+static void add_all_expected_requirements(VariableRequirementList list)
+{
+    for (size_t i = 0; i < TEST_VARIABLE_REQUIREMENT_LIST_MAX_NUM_EXPECTED_REQUIREMENTS; i++) {
+        variable_requirement_list_add(list, expected_requirements[i].requirement);
+    }
+}
+
 TEST_GROUP_C_SETUP(VariableRequirementList)
 {
     for (size_t i = 0; i < TEST_VARIABLE_REQUIREMENT_LIST_MAX_NUM_EXPECTED_REQUIREMENTS; i++) {
-        expected_requirements[i].linked_list_node_buffer = fake_linked_list_node_allocator_alloc();
         expected_requirements[i].requirement_buffer = fake_variable_requirement_allocator_alloc();
         mock_c()
             ->expectOneCall("variable_requirement_allocator_alloc")
             ->andReturnPointerValue(expected_requirements[i].requirement_buffer);
         expected_requirements[i].requirement =
-            pressure_requirement_create(alert_ids_of_expected_requirements[i], VARIABLE_REQUIREMENT_OPERATOR_GEQ, 0);
+            pressure_requirement_create(alert_ids_of_expected_requirements[i], VARIABLE_REQUIREMENT_OPERATOR_GEQ,
+                                        requirement_values_of_expected_requirements[i]);
         expected_requirements[i].is_expected = false;
     }
+    num_visited_requirements = 0;
+    band_requirement_buffer = NULL;
+    band_requirement = NULL;
 }
 
 TEST_GROUP_C_TEARDOWN(VariableRequirementList)
@@ -87,7 +160,13 @@ TEST_GROUP_C_TEARDOWN(VariableRequirementList)
             ->withPointerParameters("buf", expected_requirements[i].requirement_buffer);
         variable_requirement_destroy(expected_requirements[i].requirement);
         fake_variable_requirement_allocator_free(expected_requirements[i].requirement_buffer);
-        fake_linked_list_node_allocator_free(expected_requirements[i].linked_list_node_buffer);
+    }
+    if (band_requirement) {
+        mock_c()
+            ->expectOneCall("variable_requirement_allocator_free")
+            ->withPointerParameters("buf", band_requirement_buffer);
+        variable_requirement_destroy(band_requirement);
+        fake_variable_requirement_allocator_free(band_requirement_buffer);
     }
 }
 
@@ -101,9 +180,6 @@ TEST_C(VariableRequirementList, ListIsEmptyAfterCreate)
 
 TEST_C(VariableRequirementList, ListContainsOneVarWhenOneVarAdded)
 {
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[0].linked_list_node_buffer);
     expect_requirement_in_list(0);
 
     VariableRequirementList list = variable_requirement_list_create();
@@ -115,15 +191,6 @@ TEST_C(VariableRequirementList, ListContainsOneVarWhenOneVarAdded)
 
 TEST_C(VariableRequirementList, ListContainsThreeVarsWhenThreeVarsAdded)
 {
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[0].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[1].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[2].linked_list_node_buffer);
     expect_requirement_in_list(0);
     expect_requirement_in_list(1);
     expect_requirement_in_list(2);
@@ -140,7 +207,7 @@ TEST_C(VariableRequirementList, ListContainsThreeVarsWhenThreeVarsAdded)
 TEST_C(VariableRequirementList, RemoveAllVarsOfAlertEmptyList)
 {
     VariableRequirementList list = variable_requirement_list_create();
-    uint8_t alert_id = 0;
+    uint16_t alert_id = 0;
     variable_requirement_list_remove_all_for_alert(list, alert_id);
 
     variable_requirement_list_for_each(list, for_each_cb_expected_requirements);
@@ -149,13 +216,7 @@ TEST_C(VariableRequirementList, RemoveAllVarsOfAlertEmptyList)
 
 TEST_C(VariableRequirementList, RemoveAllVarsOfAlertRemovesTheOnlyRequirement)
 {
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[0].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_free")
-        ->withPointerParameters("linked_list_node", expected_requirements[0].linked_list_node_buffer);
-    uint8_t alert_id = 2;
+    uint16_t alert_id = 2;
     EAS_ASSERT((alert_id == alert_ids_of_expected_requirements[0]));
     /* Not expecting any requirements to be in the list, because variable_requirement_list_remove_all_for_alert should
      * remove the only requirement we add. */
@@ -170,13 +231,10 @@ TEST_C(VariableRequirementList, RemoveAllVarsOfAlertRemovesTheOnlyRequirement)
 
 TEST_C(VariableRequirementList, RemoveAllVarsOfAlertKeepsTheOnlyRequirement)
 {
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[0].linked_list_node_buffer);
     /* Expecting the requirement to still be in the list, because it has alert id 2, but we call
      * variable_requirement_list_remove_all_for_alert for alert id 1 */
     expect_requirement_in_list(0);
-    uint8_t alert_id = 1;
+    uint16_t alert_id = 1;
     EAS_ASSERT((alert_id != alert_ids_of_expected_requirements[0]));
 
     VariableRequirementList list = variable_requirement_list_create();
@@ -189,26 +247,8 @@ TEST_C(VariableRequirementList, RemoveAllVarsOfAlertKeepsTheOnlyRequirement)
 
 TEST_C(VariableRequirementList, RemoveAllVarsOfAlertRemovesAllRequirements)
 {
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[1].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[2].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[3].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_free")
-        ->withPointerParameters("linked_list_node", expected_requirements[1].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_free")
-        ->withPointerParameters("linked_list_node", expected_requirements[2].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_free")
-        ->withPointerParameters("linked_list_node", expected_requirements[3].linked_list_node_buffer);
-
-    uint8_t alert_id = 1;
+
+    uint16_t alert_id = 1;
     EAS_ASSERT((alert_id == alert_ids_of_expected_requirements[1]));
     EAS_ASSERT((alert_id == alert_ids_of_expected_requirements[2]));
     EAS_ASSERT((alert_id == alert_ids_of_expected_requirements[3]));
@@ -228,19 +268,7 @@ TEST_C(VariableRequirementList, RemoveAllVarsOfAlertRemovesAllRequirements)
 
 TEST_C(VariableRequirementList, RemoveAllVarsOfAlertKeepsAllRequirements)
 {
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[0].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[4].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[5].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[6].linked_list_node_buffer);
-    uint8_t alert_id = 1;
+    uint16_t alert_id = 1;
     EAS_ASSERT((alert_id != alert_ids_of_expected_requirements[0]));
     EAS_ASSERT((alert_id != alert_ids_of_expected_requirements[4]));
     EAS_ASSERT((alert_id != alert_ids_of_expected_requirements[5]));
@@ -266,34 +294,7 @@ TEST_C(VariableRequirementList, RemoveAllVarsOfAlertKeepsAllRequirements)
 TEST_C(VariableRequirementList, RemoveAllVarsOfAlertRemovesOnlyReqsWithMatchingAlertId)
 {
     /* Setup */
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[0].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[5].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[1].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[2].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[3].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[4].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[6].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_free")
-        ->withPointerParameters("linked_list_node", expected_requirements[5].linked_list_node_buffer);
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_free")
-        ->withPointerParameters("linked_list_node", expected_requirements[6].linked_list_node_buffer);
-    uint8_t alert_id = 3;
+    uint16_t alert_id = 3;
     EAS_ASSERT((alert_id != alert_ids_of_expected_requirements[0]));
     EAS_ASSERT((alert_id != alert_ids_of_expected_requirements[1]));
     EAS_ASSERT((alert_id != alert_ids_of_expected_requirements[2]));
@@ -338,9 +339,6 @@ TEST_C(VariableRequirementList, ForEachFiresAssertIfListIsNull)
 
 TEST_C(VariableRequirementList, ForEachFiresAssertIfCbIsNull)
 {
-    mock_c()
-        ->expectOneCall("linked_list_node_allocator_alloc")
-        ->andReturnPointerValue(expected_requirements[0].linked_list_node_buffer);
     TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("cb", "variable_requirement_list_for_each");
 
     VariableRequirementList list = variable_requirement_list_create();
@@ -353,3 +351,382 @@ TEST_C(VariableRequirementList, RemoveAllForAlertFiresAssertIfListIsNull)
     TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("self", "variable_requirement_list_remove_all_for_alert");
     variable_requirement_list_remove_all_for_alert(NULL, 0);
 }
+
+TEST_C(VariableRequirementList, AddFiresAssertIfListIsFull)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("!is_full(self)", "variable_requirement_list_add");
+
+    VariableRequirementList list = variable_requirement_list_create();
+    add_all_expected_requirements(list);
+    variable_requirement_list_add(list, expected_requirements[0].requirement);
+}
+
+TEST_C(VariableRequirementList, ForEachVisitsReqsInAscendingOrderOfRequirementValues)
+{
+    VariableRequirementList list = variable_requirement_list_create();
+    add_all_expected_requirements(list);
+
+    variable_requirement_list_for_each(list, for_each_cb_record_order);
+
+    /* Requirement values: 100, 200, 300, 300, 500, 600, 700. Requirements 2 and 3 have equal requirement values, so
+     * they are visited in the order in which they were added. */
+    CHECK_EQUAL_C_UINT(TEST_VARIABLE_REQUIREMENT_LIST_MAX_NUM_EXPECTED_REQUIREMENTS, num_visited_requirements);
+    CHECK_EQUAL_C_POINTER(expected_requirements[1].requirement, visited_requirements[0]);
+    CHECK_EQUAL_C_POINTER(expected_requirements[5].requirement, visited_requirements[1]);
+    CHECK_EQUAL_C_POINTER(expected_requirements[2].requirement, visited_requirements[2]);
+    CHECK_EQUAL_C_POINTER(expected_requirements[3].requirement, visited_requirements[3]);
+    CHECK_EQUAL_C_POINTER(expected_requirements[0].requirement, visited_requirements[4]);
+    CHECK_EQUAL_C_POINTER(expected_requirements[6].requirement, visited_requirements[5]);
+    CHECK_EQUAL_C_POINTER(expected_requirements[4].requirement, visited_requirements[6]);
+}
+
+TEST_C(VariableRequirementList, EvaluateReportsAllReqsOnFirstEvaluation)
+{
+    VariableRequirementList list = variable_requirement_list_create();
+    add_all_expected_requirements(list);
+
+    variable_requirement_list_evaluate(list, 300, result_changed_cb_record);
+
+    /* All requirements use the GEQ operator. Requirement values: 100, 200, 300, 300, 500, 600, 700. */
+    CHECK_EQUAL_C_UINT(TEST_VARIABLE_REQUIREMENT_LIST_MAX_NUM_EXPECTED_REQUIREMENTS, num_visited_requirements);
+    check_reported_result(0, 1, true);
+    check_reported_result(1, 5, true);
+    check_reported_result(2, 2, true);
+    check_reported_result(3, 3, true);
+    check_reported_result(4, 0, false);
+    check_reported_result(5, 6, false);
+    check_reported_result(6, 4, false);
+}
+
+TEST_C(VariableRequirementList, EvaluateReportsOnlyReqsWhoseResultChanged)
+{
+    VariableRequirementList list = variable_requirement_list_create();
+    add_all_expected_requirements(list);
+    variable_requirement_list_evaluate(list, 300, result_changed_cb_record);
+    num_visited_requirements = 0;
+
+    variable_requirement_list_evaluate(list, 550, result_changed_cb_record);
+
+    /* Only the requirement with requirement value 500 changed its result */
+    CHECK_EQUAL_C_UINT(1, num_visited_requirements);
+    check_reported_result(0, 0, true);
+}
+
+TEST_C(VariableRequirementList, EvaluateReportsNothingIfNoResultChanged)
+{
+    VariableRequirementList list = variable_requirement_list_create();
+    add_all_expected_requirements(list);
+    variable_requirement_list_evaluate(list, 300, result_changed_cb_record);
+    num_visited_requirements = 0;
+
+    variable_requirement_list_evaluate(list, 499, result_changed_cb_record);
+
+    CHECK_EQUAL_C_UINT(0, num_visited_requirements);
+}
+
+TEST_C(VariableRequirementList, EvaluateUsesOperatorOfReq)
+{
+    void *requirement_buffer = fake_variable_requirement_allocator_alloc();
+    mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
+    VariableRequirement leq_requirement = pressure_requirement_create(4, VARIABLE_REQUIREMENT_OPERATOR_LEQ, 400);
+
+    VariableRequirementList list = variable_requirement_list_create();
+    variable_requirement_list_add(list, leq_requirement);
+    variable_requirement_list_evaluate(list, 400, result_changed_cb_record);
+    variable_requirement_list_evaluate(list, 401, result_changed_cb_record);
+
+    CHECK_EQUAL_C_UINT(2, num_visited_requirements);
+    CHECK_EQUAL_C_POINTER(leq_requirement, visited_requirements[0]);
+    CHECK_EQUAL_C_UBYTE(4, reported_alert_ids[0]);
+    CHECK_EQUAL_C_BOOL(true, reported_results[0]);
+    CHECK_EQUAL_C_POINTER(leq_requirement, visited_requirements[1]);
+    CHECK_EQUAL_C_UBYTE(4, reported_alert_ids[1]);
+    CHECK_EQUAL_C_BOOL(false, reported_results[1]);
+
+    mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
+    variable_requirement_destroy(leq_requirement);
+    fake_variable_requirement_allocator_free(requirement_buffer);
+}
+
+TEST_C(VariableRequirementList, EvaluateKeepsResultsOfRemainingReqsAfterRemove)
+{
+    uint16_t alert_id = 1;
+    EAS_ASSERT((alert_id == alert_ids_of_expected_requirements[1]));
+    EAS_ASSERT((alert_id == alert_ids_of_expected_requirements[2]));
+    EAS_ASSERT((alert_id == alert_ids_of_expected_requirements[3]));
+
+    VariableRequirementList list = variable_requirement_list_create();
+    add_all_expected_requirements(list);
+    variable_requirement_list_evaluate(list, 300, result_changed_cb_record);
+    /* Removes requirements with requirement values 100, 300, 300 */
+    variable_requirement_list_remove_all_for_alert(list, alert_id);
+    num_visited_requirements = 0;
+
+    variable_requirement_list_evaluate(list, 550, result_changed_cb_record);
+
+    /* Results of the remaining requirements are not lost when the requirements are moved within the list */
+    CHECK_EQUAL_C_UINT(1, num_visited_requirements);
+    check_reported_result(0, 0, true);
+}
+
+TEST_C(VariableRequirementList, EvaluateFiresAssertIfListIsNull)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("self", "variable_requirement_list_evaluate");
+    variable_requirement_list_evaluate(NULL, 0, result_changed_cb_record);
+}
+
+TEST_C(VariableRequirementList, EvaluateFiresAssertIfCbIsNull)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("cb", "variable_requirement_list_evaluate");
+
+    VariableRequirementList list = variable_requirement_list_create();
+    variable_requirement_list_evaluate(list, 0, NULL);
+}
+
+TEST_C(VariableRequirementList, EvaluateInRangeEvaluatesOnlyReqsInRange)
+{
+    VariableRequirementList list = variable_requirement_list_create();
+    add_all_expected_requirements(list);
+
+    variable_requirement_list_evaluate_in_range(list, 250, 550, result_changed_cb_record);
+
+    /* Requirements with requirement values 300, 300, 500 are evaluated for the first time */
+    CHECK_EQUAL_C_UINT(3, num_visited_requirements);
+    check_reported_result(0, 2, true);
+    check_reported_result(1, 3, true);
+    check_reported_result(2, 0, true);
+}
+
+TEST_C(VariableRequirementList, EvaluateInRangeBoundsAreInclusive)
+{
+    VariableRequirementList list = variable_requirement_list_create();
+    add_all_expected_requirements(list);
+
+    variable_requirement_list_evaluate_in_range(list, 200, 500, result_changed_cb_record);
+
+    /* Requirements with requirement values 200, 300, 300, 500 */
+    CHECK_EQUAL_C_UINT(4, num_visited_requirements);
+    check_reported_result(0, 5, true);
+    check_reported_result(1, 2, true);
+    check_reported_result(2, 3, true);
+    check_reported_result(3, 0, true);
+}
+
+TEST_C(VariableRequirementList, EvaluateInRangeAcceptsPreviousValueAboveValue)
+{
+    VariableRequirementList list = variable_requirement_list_create();
+    add_all_expected_requirements(list);
+    variable_requirement_list_evaluate(list, 1000, result_changed_cb_record);
+    num_visited_requirements = 0;
+
+    variable_requirement_list_evaluate_in_range(list, 1000, 550, result_changed_cb_record);
+
+    /* Requirements with requirement values 600, 700 are no longer satisfied */
+    CHECK_EQUAL_C_UINT(2, num_visited_requirements);
+    check_reported_result(0, 6, false);
+    check_reported_result(1, 4, false);
+}
+
+TEST_C(VariableRequirementList, EvaluateInRangeReportsOnlyReqsWhoseResultChanged)
+{
+    VariableRequirementList list = variable_requirement_list_create();
+    add_all_expected_requirements(list);
+    variable_requirement_list_evaluate(list, 300, result_changed_cb_record);
+    num_visited_requirements = 0;
+
+    /* Requirements with requirement values 300, 300, 500 are in range, but only the result of 500 changed */
+    variable_requirement_list_evaluate_in_range(list, 300, 500, result_changed_cb_record);
+
+    CHECK_EQUAL_C_UINT(1, num_visited_requirements);
+    check_reported_result(0, 0, true);
+}
+
+TEST_C(VariableRequirementList, EvaluateInRangeReportsCrossingAfterChangesBetweenReqValues)
+{
+    VariableRequirementList list = variable_requirement_list_create();
+    add_all_expected_requirements(list);
+    variable_requirement_list_evaluate(list, 300, result_changed_cb_record);
+    num_visited_requirements = 0;
+
+    /* No requirement values in (300, 500) */
+    variable_requirement_list_evaluate_in_range(list, 300, 350, result_changed_cb_record);
+    variable_requirement_list_evaluate_in_range(list, 350, 340, result_changed_cb_record);
+    variable_requirement_list_evaluate_in_range(list, 340, 499, result_changed_cb_record);
+    CHECK_EQUAL_C_UINT(0, num_visited_requirements);
+
+    variable_requirement_list_evaluate_in_range(list, 499, 500, result_changed_cb_record);
+    CHECK_EQUAL_C_UINT(1, num_visited_requirements);
+    check_reported_result(0, 0, true);
+}
+
+TEST_C(VariableRequirementList, EvaluateInRangeReportsLeavingReqValue)
+{
+    void *requirement_buffer = fake_variable_requirement_allocator_alloc();
+    mock_c()->expectOneCall("variable_requirement_allocator_alloc")->andReturnPointerValue(requirement_buffer);
+    VariableRequirement leq_requirement = pressure_requirement_create(4, VARIABLE_REQUIREMENT_OPERATOR_LEQ, 400);
+
+    VariableRequirementList list = variable_requirement_list_create();
+    variable_requirement_list_add(list, leq_requirement);
+    variable_requirement_list_evaluate(list, 400, result_changed_cb_record);
+    variable_requirement_list_evaluate_in_range(list, 400, 401, result_changed_cb_record);
+
+    CHECK_EQUAL_C_UINT(2, num_visited_requirements);
+    CHECK_EQUAL_C_POINTER(leq_requirement, visited_requirements[1]);
+    CHECK_EQUAL_C_BOOL(false, reported_results[1]);
+
+    mock_c()->expectOneCall("variable_requirement_allocator_free")->withPointerParameters("buf", requirement_buffer);
+    variable_requirement_destroy(leq_requirement);
+    fake_variable_requirement_allocator_free(requirement_buffer);
+}
+
+TEST_C(VariableRequirementList, EvaluateInRangeReportsCrossingOfReqAddedAfterEvaluation)
+{
+    VariableRequirementList list = variable_requirement_list_create();
+    /* All requirements except the one with requirement value 600 */
+    for (size_t i = 0; i < (TEST_VARIABLE_REQUIREMENT_LIST_MAX_NUM_EXPECTED_REQUIREMENTS - 1); i++) {
+        variable_requirement_list_add(list, expected_requirements[i].requirement);
+    }
+    variable_requirement_list_evaluate(list, 550, result_changed_cb_record);
+    variable_requirement_list_add(list, expected_requirements[6].requirement);
+    num_visited_requirements = 0;
+
+    variable_requirement_list_evaluate_in_range(list, 550, 650, result_changed_cb_record);
+
+    CHECK_EQUAL_C_UINT(1, num_visited_requirements);
+    check_reported_result(0, 6, true);
+}
+
+TEST_C(VariableRequirementList, GetDistanceToNearestReturnsMaxIfListIsEmpty)
+{
+    VariableRequirementList list = variable_requirement_list_create();
+    CHECK_EQUAL_C_LONGLONG(INT64_MAX, variable_requirement_list_get_distance_to_nearest(list, 300));
+}
+
+TEST_C(VariableRequirementList, GetDistanceToNearestReqValueAboveOrBelow)
+{
+    VariableRequirementList list = variable_requirement_list_create();
+    add_all_expected_requirements(list);
+
+    /* Requirement values: 100, 200, 300, 300, 500, 600, 700 */
+    CHECK_EQUAL_C_LONGLONG(60, variable_requirement_list_get_distance_to_nearest(list, 440));
+    CHECK_EQUAL_C_LONGLONG(40, variable_requirement_list_get_distance_to_nearest(list, 460));
+    CHECK_EQUAL_C_LONGLONG(150, variable_requirement_list_get_distance_to_nearest(list, -50));
+    CHECK_EQUAL_C_LONGLONG(1000, variable_requirement_list_get_distance_to_nearest(list, 1700));
+}
+
+TEST_C(VariableRequirementList, GetDistanceToNearestIsZeroForReqValue)
+{
+    VariableRequirementList list = variable_requirement_list_create();
+    add_all_expected_requirements(list);
+
+    CHECK_EQUAL_C_LONGLONG(0, variable_requirement_list_get_distance_to_nearest(list, 300));
+}
+
+TEST_C(VariableRequirementList, GetDistanceToNearestFiresAssertIfListIsNull)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("self", "variable_requirement_list_get_distance_to_nearest");
+    variable_requirement_list_get_distance_to_nearest(NULL, 0);
+}
+
+TEST_C(VariableRequirementList, EvaluateInRangeFiresAssertIfListIsNull)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("self", "variable_requirement_list_evaluate_in_range");
+    variable_requirement_list_evaluate_in_range(NULL, 0, 0, result_changed_cb_record);
+}
+
+TEST_C(VariableRequirementList, EvaluateInRangeFiresAssertIfCbIsNull)
+{
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("cb", "variable_requirement_list_evaluate_in_range");
+
+    VariableRequirementList list = variable_requirement_list_create();
+    variable_requirement_list_evaluate_in_range(list, 0, 0, NULL);
+}
+
+TEST_C(VariableRequirementList, AddFiresAssertIfNoRoomForBothEntriesOfBandReq)
+{
+    create_band_requirement(VARIABLE_REQUIREMENT_OPERATOR_INSIDE, 150, 650);
+    VariableRequirementList list = variable_requirement_list_create();
+    /* Leaves room for one more entry */
+    for (size_t i = 0; i < (TEST_VARIABLE_REQUIREMENT_LIST_MAX_NUM_EXPECTED_REQUIREMENTS - 1); i++) {
+        variable_requirement_list_add(list, expected_requirements[i].requirement);
+    }
+
+    TEST_ASSERT_PLUGIN_C_EXPECT_ASSERTION("has_room_for_upper_entry", "variable_requirement_list_add");
+    variable_requirement_list_add(list, band_requirement);
+}
+
+TEST_C(VariableRequirementList, ForEachVisitsBandReqOnce)
+{
+    create_band_requirement(VARIABLE_REQUIREMENT_OPERATOR_INSIDE, 150, 650);
+    VariableRequirementList list = variable_requirement_list_create();
+    variable_requirement_list_add(list, band_requirement);
+    variable_requirement_list_add(list, expected_requirements[0].requirement);
+
+    variable_requirement_list_for_each(list, for_each_cb_record_order);
+
+    /* Requirement values: 150 (band), 500, 650 (band) */
+    CHECK_EQUAL_C_UINT(2, num_visited_requirements);
+    CHECK_EQUAL_C_POINTER(band_requirement, visited_requirements[0]);
+    CHECK_EQUAL_C_POINTER(expected_requirements[0].requirement, visited_requirements[1]);
+}
+
+TEST_C(VariableRequirementList, EvaluateReportsBandReqOnce)
+{
+    create_band_requirement(VARIABLE_REQUIREMENT_OPERATOR_INSIDE, 150, 650);
+    VariableRequirementList list = variable_requirement_list_create();
+    variable_requirement_list_add(list, band_requirement);
+
+    variable_requirement_list_evaluate(list, 300, result_changed_cb_record);
+    variable_requirement_list_evaluate(list, 700, result_changed_cb_record);
+
+    CHECK_EQUAL_C_UINT(2, num_visited_requirements);
+    check_reported_band_result(0, true);
+    check_reported_band_result(1, false);
+}
+
+TEST_C(VariableRequirementList, EvaluateInRangeReportsBandReqCrossingEitherReqValue)
+{
+    create_band_requirement(VARIABLE_REQUIREMENT_OPERATOR_OUTSIDE, 150, 650);
+    VariableRequirementList list = variable_requirement_list_create();
+    variable_requirement_list_add(list, band_requirement);
+    variable_requirement_list_evaluate(list, 100, result_changed_cb_record);
+
+    variable_requirement_list_evaluate_in_range(list, 100, 300, result_changed_cb_record);
+    variable_requirement_list_evaluate_in_range(list, 300, 651, result_changed_cb_record);
+    variable_requirement_list_evaluate_in_range(list, 651, 650, result_changed_cb_record);
+
+    CHECK_EQUAL_C_UINT(4, num_visited_requirements);
+    check_reported_band_result(0, true);
+    check_reported_band_result(1, false);
+    check_reported_band_result(2, true);
+    check_reported_band_result(3, false);
+}
+
+TEST_C(VariableRequirementList, EvaluateInRangeReportsNothingIfValueJumpsOverBandReq)
+{
+    create_band_requirement(VARIABLE_REQUIREMENT_OPERATOR_INSIDE, 150, 650);
+    VariableRequirementList list = variable_requirement_list_create();
+    variable_requirement_list_add(list, band_requirement);
+    variable_requirement_list_evaluate(list, 300, result_changed_cb_record);
+    /* Only crosses the lower requirement value. The result stored at the upper requirement value is updated too. */
+    variable_requirement_list_evaluate_in_range(list, 300, 100, result_changed_cb_record);
+    num_visited_requirements = 0;
+
+    variable_requirement_list_evaluate_in_range(list, 100, 700, result_changed_cb_record);
+
+    CHECK_EQUAL_C_UINT(0, num_visited_requirements);
+}
+
+TEST_C(VariableRequirementList, RemoveAllForAlertRemovesBothEntriesOfBandReq)
+{
+    create_band_requirement(VARIABLE_REQUIREMENT_OPERATOR_INSIDE, 150, 650);
+    VariableRequirementList list = variable_requirement_list_create();
+    variable_requirement_list_add(list, band_requirement);
+    variable_requirement_list_add(list, expected_requirements[0].requirement);
+
+    variable_requirement_list_remove_all_for_alert(list, TEST_BAND_REQUIREMENT_ALERT_ID);
+
+    variable_requirement_list_for_each(list, for_each_cb_record_order);
+    CHECK_EQUAL_C_UINT(1, num_visited_requirements);
+    CHECK_EQUAL_C_POINTER(expected_requirements[0].requirement, visited_requirements[0]);
+}
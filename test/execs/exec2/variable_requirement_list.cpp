@@ -20,3 +20,31 @@ TEST_C_WRAPPER(VariableRequirementList, AddFiresAssertIfListIsNull);
 TEST_C_WRAPPER(VariableRequirementList, ForEachFiresAssertIfListIsNull);
 TEST_C_WRAPPER(VariableRequirementList, ForEachFiresAssertIfCbIsNull);
 TEST_C_WRAPPER(VariableRequirementList, RemoveAllForAlertFiresAssertIfListIsNull);
+TEST_C_WRAPPER(VariableRequirementList, AddFiresAssertIfListIsFull);
+TEST_C_WRAPPER(VariableRequirementList, ForEachVisitsReqsInAscendingOrderOfRequirementValues);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateReportsAllReqsOnFirstEvaluation);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateReportsOnlyReqsWhoseResultChanged);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateReportsNothingIfNoResultChanged);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateUsesOperatorOfReq);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateKeepsResultsOfRemainingReqsAfterRemove);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateFiresAssertIfListIsNull);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateFiresAssertIfCbIsNull);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateInRangeEvaluatesOnlyReqsInRange);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateInRangeBoundsAreInclusive);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateInRangeAcceptsPreviousValueAboveValue);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateInRangeReportsOnlyReqsWhoseResultChanged);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateInRangeReportsCrossingAfterChangesBetweenReqValues);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateInRangeReportsLeavingReqValue);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateInRangeReportsCrossingOfReqAddedAfterEvaluation);
+TEST_C_WRAPPER(VariableRequirementList, GetDistanceToNearestReturnsMaxIfListIsEmpty);
+TEST_C_WRAPPER(VariableRequirementList, GetDistanceToNearestReqValueAboveOrBelow);
+TEST_C_WRAPPER(VariableRequirementList, GetDistanceToNearestIsZeroForReqValue);
+TEST_C_WRAPPER(VariableRequirementList, GetDistanceToNearestFiresAssertIfListIsNull);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateInRangeFiresAssertIfListIsNull);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateInRangeFiresAssertIfCbIsNull);
+TEST_C_WRAPPER(VariableRequirementList, AddFiresAssertIfNoRoomForBothEntriesOfBandReq);
+TEST_C_WRAPPER(VariableRequirementList, ForEachVisitsBandReqOnce);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateReportsBandReqOnce);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateInRangeReportsBandReqCrossingEitherReqValue);
+TEST_C_WRAPPER(VariableRequirementList, EvaluateInRangeReportsNothingIfValueJumpsOverBandReq);
+TEST_C_WRAPPER(VariableRequirementList, RemoveAllForAlertRemovesBothEntriesOfBandReq);
@@ -0,0 +1,26 @@
+#include "CppUTestExt/MockSupport.h"
+#include "mock_alert_condition.h"
+
+struct AlertConditionStruct {};
+
+AlertCondition alert_condition_create()
+{
+    mock().actualCall("alert_condition_create");
+    return (AlertCondition)mock().pointerReturnValue();
+}
+
+void alert_condition_set_variable_requirement_result(AlertCondition self, VariableRequirement variable_requirement,
+                                                     bool result)
+{
+    mock()
+        .actualCall("alert_condition_set_variable_requirement_result")
+        .withParameter("self", self)
+        .withParameter("variable_requirement", variable_requirement)
+        .withParameter("result", result);
+}
+
+bool alert_condition_get_result(AlertCondition self)
+{
+    mock().actualCall("alert_condition_get_result").withParameter("self", self);
+    return mock().boolReturnValue();
+}
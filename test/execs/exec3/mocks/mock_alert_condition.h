@@ -0,0 +1,26 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC3_MOCKS_MOCK_ALERT_CONDITION_H
+#define ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC3_MOCKS_MOCK_ALERT_CONDITION_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdbool.h>
+
+#include "variable_requirement.h"
+
+typedef struct AlertConditionStruct *AlertCondition;
+
+AlertCondition alert_condition_create();
+
+void alert_condition_set_variable_requirement_result(AlertCondition self, VariableRequirement variable_requirement,
+                                                     bool result);
+
+bool alert_condition_get_result(AlertCondition self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC3_MOCKS_MOCK_ALERT_CONDITION_H */
@@ -0,0 +1,18 @@
+#include "CppUTestExt/MockSupport.h"
+#include "mock_alert_raiser.h"
+
+struct AlertRaiserStruct {};
+
+AlertRaiser alert_raiser_create()
+{
+    mock().actualCall("alert_raiser_create");
+    return (AlertRaiser)mock().pointerReturnValue();
+}
+
+void alert_raiser_set_alert_condition_result(AlertRaiser self, bool alert_condition_result)
+{
+    mock()
+        .actualCall("alert_raiser_set_alert_condition_result")
+        .withParameter("self", self)
+        .withParameter("alert_condition_result", alert_condition_result);
+}
@@ -0,0 +1,21 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC3_MOCKS_MOCK_ALERT_RAISER_H
+#define ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC3_MOCKS_MOCK_ALERT_RAISER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdbool.h>
+
+typedef struct AlertRaiserStruct *AlertRaiser;
+
+AlertRaiser alert_raiser_create();
+
+void alert_raiser_set_alert_condition_result(AlertRaiser self, bool alert_condition_result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC3_MOCKS_MOCK_ALERT_RAISER_H */
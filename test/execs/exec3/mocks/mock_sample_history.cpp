@@ -0,0 +1,22 @@
+#include "CppUTestExt/MockSupport.h"
+#include "mock_sample_history.h"
+
+void sample_history_record_temperature(Temperature temperature)
+{
+    mock().actualCall("sample_history_record_temperature").withParameter("temperature", temperature);
+}
+
+void sample_history_record_pressure(Pressure pressure)
+{
+    mock().actualCall("sample_history_record_pressure").withParameter("pressure", pressure);
+}
+
+void sample_history_record_humidity(Humidity humidity)
+{
+    mock().actualCall("sample_history_record_humidity").withParameter("humidity", humidity);
+}
+
+void sample_history_record_light_intensity(LightIntensity light_intensity)
+{
+    mock().actualCall("sample_history_record_light_intensity").withParameter("light_intensity", light_intensity);
+}
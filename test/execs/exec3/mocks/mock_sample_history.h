@@ -0,0 +1,26 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC3_MOCKS_MOCK_SAMPLE_HISTORY_H
+#define ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC3_MOCKS_MOCK_SAMPLE_HISTORY_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "temperature.h"
+#include "pressure.h"
+#include "humidity.h"
+#include "light_intensity.h"
+
+void sample_history_record_temperature(Temperature temperature);
+
+void sample_history_record_pressure(Pressure pressure);
+
+void sample_history_record_humidity(Humidity humidity);
+
+void sample_history_record_light_intensity(LightIntensity light_intensity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC3_MOCKS_MOCK_SAMPLE_HISTORY_H */
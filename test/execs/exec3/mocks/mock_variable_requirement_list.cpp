@@ -0,0 +1,82 @@
+#include "CppUTestExt/MockSupport.h"
+#include "mock_variable_requirement_list.h"
+#include "eas_assert.h"
+
+/* One list per variable */
+#define MOCK_VARIABLE_REQUIREMENT_LIST_NUM_INSTANCES 4
+#define MOCK_VARIABLE_REQUIREMENT_LIST_MAX_NUM_QUEUED_CHANGE_SETS 4
+
+struct VariableRequirementListStruct {};
+
+typedef struct {
+    const MockVariableRequirementListResultChange *changes;
+    size_t num_changes;
+} ResultChangeSet;
+
+static struct VariableRequirementListStruct instances[MOCK_VARIABLE_REQUIREMENT_LIST_NUM_INSTANCES];
+static size_t num_instances = 0;
+static ResultChangeSet queued_change_sets[MOCK_VARIABLE_REQUIREMENT_LIST_MAX_NUM_QUEUED_CHANGE_SETS];
+static size_t num_queued_change_sets = 0;
+static size_t next_change_set_idx = 0;
+
+static void report_next_result_changes(VariableRequirementListResultChangedCb cb)
+{
+    if (next_change_set_idx >= num_queued_change_sets) {
+        return;
+    }
+    const ResultChangeSet *const change_set = &queued_change_sets[next_change_set_idx++];
+    for (size_t i = 0; i < change_set->num_changes; i++) {
+        const MockVariableRequirementListResultChange *const change = &change_set->changes[i];
+        cb(change->variable_requirement, change->alert_id, change->result);
+    }
+}
+
+VariableRequirementList variable_requirement_list_create()
+{
+    /* Lists are created on first use by the <variable name>_requirement_list modules, so creation is not recorded */
+    EAS_ASSERT(num_instances < MOCK_VARIABLE_REQUIREMENT_LIST_NUM_INSTANCES);
+    return &instances[num_instances++];
+}
+
+void variable_requirement_list_evaluate(VariableRequirementList self, VariableRequirementThreshold value,
+                                        VariableRequirementListResultChangedCb cb)
+{
+    mock().actualCall("variable_requirement_list_evaluate").withParameter("self", self).withLongLongIntParameter(
+        "value", value);
+    report_next_result_changes(cb);
+}
+
+void variable_requirement_list_evaluate_in_range(VariableRequirementList self,
+                                                 VariableRequirementThreshold previous_value,
+                                                 VariableRequirementThreshold value,
+                                                 VariableRequirementListResultChangedCb cb)
+{
+    mock()
+        .actualCall("variable_requirement_list_evaluate_in_range")
+        .withParameter("self", self)
+        .withLongLongIntParameter("previous_value", previous_value)
+        .withLongLongIntParameter("value", value);
+    report_next_result_changes(cb);
+}
+
+VariableRequirementThreshold variable_requirement_list_get_distance_to_nearest(VariableRequirementList self,
+                                                                               VariableRequirementThreshold value)
+{
+    /* Same as for an empty list */
+    return INT64_MAX;
+}
+
+void mock_variable_requirement_list_queue_result_changes(const MockVariableRequirementListResultChange *changes,
+                                                         size_t num_changes)
+{
+    EAS_ASSERT(num_queued_change_sets < MOCK_VARIABLE_REQUIREMENT_LIST_MAX_NUM_QUEUED_CHANGE_SETS);
+    queued_change_sets[num_queued_change_sets].changes = changes;
+    queued_change_sets[num_queued_change_sets].num_changes = num_changes;
+    num_queued_change_sets++;
+}
+
+void mock_variable_requirement_list_reset()
+{
+    num_queued_change_sets = 0;
+    next_change_set_idx = 0;
+}
@@ -0,0 +1,60 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC3_MOCKS_MOCK_VARIABLE_REQUIREMENT_LIST_H
+#define ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC3_MOCKS_MOCK_VARIABLE_REQUIREMENT_LIST_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "variable_requirement.h"
+#include "variable_requirement_list_defs.h"
+
+typedef struct VariableRequirementListStruct *VariableRequirementList;
+
+/** Variable requirement result change that the mock reports through VariableRequirementListResultChangedCb */
+typedef struct MockVariableRequirementListResultChange {
+    VariableRequirement variable_requirement;
+    uint16_t alert_id;
+    bool result;
+} MockVariableRequirementListResultChange;
+
+VariableRequirementList variable_requirement_list_create();
+
+void variable_requirement_list_evaluate(VariableRequirementList self, VariableRequirementThreshold value,
+                                        VariableRequirementListResultChangedCb cb);
+
+void variable_requirement_list_evaluate_in_range(VariableRequirementList self,
+                                                 VariableRequirementThreshold previous_value,
+                                                 VariableRequirementThreshold value,
+                                                 VariableRequirementListResultChangedCb cb);
+
+VariableRequirementThreshold variable_requirement_list_get_distance_to_nearest(VariableRequirementList self,
+                                                                               VariableRequirementThreshold value);
+
+/**
+ * @brief Queue result changes to report from an evaluation.
+ *
+ * Every call to variable_requirement_list_evaluate or variable_requirement_list_evaluate_in_range takes the oldest
+ * queued set of result changes, and executes its cb once for every change in the set. If the queue is empty, cb is not
+ * executed.
+ *
+ * @param changes Result changes. Must stay valid until they are reported.
+ * @param num_changes Number of elements in @p changes.
+ */
+void mock_variable_requirement_list_queue_result_changes(const MockVariableRequirementListResultChange *changes,
+                                                         size_t num_changes);
+
+/**
+ * @brief Drop all queued result changes.
+ */
+void mock_variable_requirement_list_reset();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC3_MOCKS_MOCK_VARIABLE_REQUIREMENT_LIST_H */
@@ -0,0 +1,272 @@
+#include <stddef.h>
+
+#include "CppUTest/TestHarness.h"
+#include "CppUTestExt/MockSupport.h"
+
+#include "new_sample_handler.h"
+#include "alert_conditions.h"
+#include "alert_raisers.h"
+#include "alert_slots.h"
+#include "alert_evaluation_readiness.h"
+#include "mocks/mock_variable_requirement_list.h"
+#include "config.h"
+
+#define TEST_NEW_SAMPLE_HANDLER_ALERT_ID_0 0
+#define TEST_NEW_SAMPLE_HANDLER_ALERT_ID_1 1
+
+/* Values with which all variables are initialized in setup, before every test */
+#define TEST_NEW_SAMPLE_HANDLER_INITIAL_TEMPERATURE 200
+#define TEST_NEW_SAMPLE_HANDLER_INITIAL_PRESSURE 1000
+#define TEST_NEW_SAMPLE_HANDLER_INITIAL_HUMIDITY 50
+#define TEST_NEW_SAMPLE_HANDLER_INITIAL_LIGHT_INTENSITY 300
+
+static AlertCondition map_alert_condition_index_to_instance(size_t index)
+{
+    /* Random formula. Alert conditions and alert raisers are mocked, they only need to be distinguishable. */
+    return (AlertCondition)((index * 2) + 3);
+}
+
+static AlertRaiser map_alert_raiser_index_to_instance(size_t index)
+{
+    return (AlertRaiser)((index * 2) + 1003);
+}
+
+static VariableRequirement map_variable_requirement_index_to_instance(size_t index)
+{
+    return (VariableRequirement)((index * 2) + 2003);
+}
+
+static void create_instances()
+{
+    static bool is_created = false;
+    if (is_created) {
+        return;
+    }
+    for (size_t i = 0; i < CONFIG_ALERT_CONDITIONS_NUM_INSTANCES_TO_CREATE; i++) {
+        mock().expectOneCall("alert_condition_create").andReturnValue((void *)map_alert_condition_index_to_instance(i));
+    }
+    alert_conditions_create_instances();
+    for (size_t i = 0; i < CONFIG_ALERT_RAISERS_NUM_INSTANCES_TO_CREATE; i++) {
+        mock().expectOneCall("alert_raiser_create").andReturnValue((void *)map_alert_raiser_index_to_instance(i));
+    }
+    alert_raisers_create_instances();
+    is_created = true;
+}
+
+static void expect_alert_condition_set_variable_requirement_result(size_t slot, size_t variable_requirement_idx,
+                                                                   bool result)
+{
+    VariableRequirement variable_requirement = map_variable_requirement_index_to_instance(variable_requirement_idx);
+    mock()
+        .expectOneCall("alert_condition_set_variable_requirement_result")
+        .withParameter("self", (void *)map_alert_condition_index_to_instance(slot))
+        .withParameter("variable_requirement", (void *)variable_requirement)
+        .withParameter("result", result);
+}
+
+static void expect_alert_raiser_update(size_t slot, bool alert_condition_result)
+{
+    mock()
+        .expectOneCall("alert_condition_get_result")
+        .withParameter("self", (void *)map_alert_condition_index_to_instance(slot))
+        .andReturnValue(alert_condition_result);
+    mock()
+        .expectOneCall("alert_raiser_set_alert_condition_result")
+        .withParameter("self", (void *)map_alert_raiser_index_to_instance(slot))
+        .withParameter("alert_condition_result", alert_condition_result);
+}
+
+static void expect_evaluate_in_range(VariableRequirementThreshold previous_value, VariableRequirementThreshold value)
+{
+    mock()
+        .expectOneCall("variable_requirement_list_evaluate_in_range")
+        .withLongLongIntParameter("previous_value", previous_value)
+        .withLongLongIntParameter("value", value)
+        .ignoreOtherParameters();
+}
+
+static void expect_evaluate(VariableRequirementThreshold value)
+{
+    mock()
+        .expectOneCall("variable_requirement_list_evaluate")
+        .withLongLongIntParameter("value", value)
+        .ignoreOtherParameters();
+}
+
+static void expect_no_alert_raiser_update()
+{
+    mock().expectNoCall("alert_condition_get_result");
+    mock().expectNoCall("alert_raiser_set_alert_condition_result");
+}
+
+// clang-format off
+TEST_GROUP(NewSampleHandler)
+{
+    void setup()
+    {
+        create_instances();
+
+        /* Slots are assigned in ascending order, so alert id i gets slot i */
+        alert_slots_reset();
+        alert_slots_add(TEST_NEW_SAMPLE_HANDLER_ALERT_ID_0);
+        alert_slots_add(TEST_NEW_SAMPLE_HANDLER_ALERT_ID_1);
+
+        /* Receive samples of all variables, so that alert conditions can be evaluated. No variable requirement result
+         * changes during this. */
+        alert_evaluation_readiness_reset();
+        mock_variable_requirement_list_reset();
+        mock().ignoreOtherCalls();
+        new_sample_handler_temperature(TEST_NEW_SAMPLE_HANDLER_INITIAL_TEMPERATURE);
+        new_sample_handler_pressure(TEST_NEW_SAMPLE_HANDLER_INITIAL_PRESSURE);
+        new_sample_handler_humidity(TEST_NEW_SAMPLE_HANDLER_INITIAL_HUMIDITY);
+        new_sample_handler_light_intensity(TEST_NEW_SAMPLE_HANDLER_INITIAL_LIGHT_INTENSITY);
+        mock().checkExpectations();
+        mock().clear();
+        mock().ignoreOtherCalls();
+        mock_variable_requirement_list_reset();
+    }
+};
+// clang-format on
+
+TEST(NewSampleHandler, TwoRequirementResultChangesOfSameAlertUpdateAlertRaiserOnce)
+{
+    /* For example "temperature >= 210 AND temperature <= 250", with temperature changing from 200 to 220 */
+    const MockVariableRequirementListResultChange changes[] = {
+        {map_variable_requirement_index_to_instance(0), TEST_NEW_SAMPLE_HANDLER_ALERT_ID_0, true},
+        {map_variable_requirement_index_to_instance(1), TEST_NEW_SAMPLE_HANDLER_ALERT_ID_0, false},
+    };
+    mock_variable_requirement_list_queue_result_changes(changes, 2);
+
+    expect_evaluate_in_range(TEST_NEW_SAMPLE_HANDLER_INITIAL_TEMPERATURE, 220);
+    expect_alert_condition_set_variable_requirement_result(0, 0, true);
+    expect_alert_condition_set_variable_requirement_result(0, 1, false);
+    expect_alert_raiser_update(0, false);
+
+    new_sample_handler_temperature(220);
+}
+
+TEST(NewSampleHandler, DirtySlotsClearedAfterSample)
+{
+    const MockVariableRequirementListResultChange changes[] = {
+        {map_variable_requirement_index_to_instance(0), TEST_NEW_SAMPLE_HANDLER_ALERT_ID_0, true},
+        {map_variable_requirement_index_to_instance(1), TEST_NEW_SAMPLE_HANDLER_ALERT_ID_0, true},
+    };
+    mock_variable_requirement_list_queue_result_changes(changes, 2);
+    expect_alert_raiser_update(0, true);
+    new_sample_handler_temperature(220);
+    mock().checkExpectations();
+
+    /* No variable requirement result changes, so the alert raiser of alert 0 must not be updated again */
+    expect_no_alert_raiser_update();
+    new_sample_handler_temperature(230);
+}
+
+TEST(NewSampleHandler, RequirementResultChangesOfTwoAlertsUpdateEachAlertRaiserOnce)
+{
+    const MockVariableRequirementListResultChange changes[] = {
+        {map_variable_requirement_index_to_instance(0), TEST_NEW_SAMPLE_HANDLER_ALERT_ID_1, true},
+        {map_variable_requirement_index_to_instance(1), TEST_NEW_SAMPLE_HANDLER_ALERT_ID_0, true},
+        {map_variable_requirement_index_to_instance(2), TEST_NEW_SAMPLE_HANDLER_ALERT_ID_1, true},
+    };
+    mock_variable_requirement_list_queue_result_changes(changes, 3);
+
+    expect_alert_condition_set_variable_requirement_result(1, 0, true);
+    expect_alert_condition_set_variable_requirement_result(0, 1, true);
+    expect_alert_condition_set_variable_requirement_result(1, 2, true);
+    /* Alert raisers are updated in slot order */
+    expect_alert_raiser_update(0, true);
+    expect_alert_raiser_update(1, false);
+
+    new_sample_handler_pressure(1010);
+}
+
+TEST(NewSampleHandler, NoRequirementResultChangeNoAlertRaiserUpdate)
+{
+    expect_no_alert_raiser_update();
+
+    new_sample_handler_humidity(55);
+}
+
+TEST(NewSampleHandler, UnchangedValueNotEvaluated)
+{
+    mock().expectNoCall("variable_requirement_list_evaluate_in_range");
+    expect_no_alert_raiser_update();
+
+    new_sample_handler_light_intensity(TEST_NEW_SAMPLE_HANDLER_INITIAL_LIGHT_INTENSITY);
+}
+
+TEST(NewSampleHandler, MultiSampleEvaluatesChangedVariablesInRange)
+{
+    expect_evaluate_in_range(TEST_NEW_SAMPLE_HANDLER_INITIAL_TEMPERATURE, 220);
+    expect_evaluate_in_range(TEST_NEW_SAMPLE_HANDLER_INITIAL_HUMIDITY, 60);
+
+    MultiSample multi_sample = {};
+    multi_sample.variables = MULTI_SAMPLE_TEMPERATURE | MULTI_SAMPLE_HUMIDITY;
+    multi_sample.temperature = 220;
+    multi_sample.humidity = 60;
+    new_sample_handler_multi_sample(&multi_sample);
+}
+
+TEST(NewSampleHandler, MultiSampleUnchangedVariableNotEvaluated)
+{
+    expect_evaluate_in_range(TEST_NEW_SAMPLE_HANDLER_INITIAL_HUMIDITY, 60);
+
+    MultiSample multi_sample = {};
+    multi_sample.variables = MULTI_SAMPLE_TEMPERATURE | MULTI_SAMPLE_HUMIDITY;
+    multi_sample.temperature = TEST_NEW_SAMPLE_HANDLER_INITIAL_TEMPERATURE;
+    multi_sample.humidity = 60;
+    new_sample_handler_multi_sample(&multi_sample);
+}
+
+TEST(NewSampleHandler, MultiSampleRequirementResultChangesOfSameAlertUpdateAlertRaiserOnce)
+{
+    /* For example "temperature > 210 AND humidity > 55", with temperature changing from 200 to 220 and humidity from 50
+     * to 60. The alert raiser must only see the result with both new values. */
+    const MockVariableRequirementListResultChange temperature_changes[] = {
+        {map_variable_requirement_index_to_instance(0), TEST_NEW_SAMPLE_HANDLER_ALERT_ID_0, true},
+    };
+    const MockVariableRequirementListResultChange humidity_changes[] = {
+        {map_variable_requirement_index_to_instance(1), TEST_NEW_SAMPLE_HANDLER_ALERT_ID_0, true},
+    };
+    mock_variable_requirement_list_queue_result_changes(temperature_changes, 1);
+    mock_variable_requirement_list_queue_result_changes(humidity_changes, 1);
+
+    expect_evaluate_in_range(TEST_NEW_SAMPLE_HANDLER_INITIAL_TEMPERATURE, 220);
+    expect_alert_condition_set_variable_requirement_result(0, 0, true);
+    expect_evaluate_in_range(TEST_NEW_SAMPLE_HANDLER_INITIAL_HUMIDITY, 60);
+    expect_alert_condition_set_variable_requirement_result(0, 1, true);
+    expect_alert_raiser_update(0, true);
+
+    MultiSample multi_sample = {};
+    multi_sample.variables = MULTI_SAMPLE_TEMPERATURE | MULTI_SAMPLE_HUMIDITY;
+    multi_sample.temperature = 220;
+    multi_sample.humidity = 60;
+    new_sample_handler_multi_sample(&multi_sample);
+}
+
+TEST(NewSampleHandler, MultiSampleThatCompletesReadinessEvaluatesAllVariables)
+{
+    alert_evaluation_readiness_reset();
+    new_sample_handler_pressure(1010);
+    new_sample_handler_light_intensity(310);
+    mock().checkExpectations();
+
+    const MockVariableRequirementListResultChange changes[] = {
+        {map_variable_requirement_index_to_instance(0), TEST_NEW_SAMPLE_HANDLER_ALERT_ID_1, true},
+    };
+    mock_variable_requirement_list_queue_result_changes(changes, 1);
+
+    /* All variables are evaluated with their current values, not in range */
+    expect_evaluate(220);
+    expect_alert_condition_set_variable_requirement_result(1, 0, true);
+    expect_evaluate(1010);
+    expect_evaluate(60);
+    expect_evaluate(310);
+    expect_alert_raiser_update(1, true);
+
+    MultiSample multi_sample = {};
+    multi_sample.variables = MULTI_SAMPLE_TEMPERATURE | MULTI_SAMPLE_HUMIDITY;
+    multi_sample.temperature = 220;
+    multi_sample.humidity = 60;
+    new_sample_handler_multi_sample(&multi_sample);
+}
@@ -0,0 +1,115 @@
+#include "CppUTest/TestHarness.h"
+#include "CppUTestExt/MockSupport.h"
+#include "CppUTestExt/TestAssertPlugin.h"
+
+#include "central_event_queue.h"
+#include "mocks/mock_eas_thread.h"
+#include "mocks/mock_new_sample_handler.h"
+#include "config.h"
+
+/* The tests rely on coalesced samples, and on the queue being full after one event is submitted */
+#if (CONFIG_CENTRAL_EVENT_QUEUE_COALESCE_SAMPLES != 1) || (CONFIG_CENTRAL_EVENT_QUEUE_NUM_SLOTS != 1)
+#error "Central event queue tests require coalesced samples and one event queue slot"
+#endif
+
+static void expect_multi_sample(uint8_t variables, Temperature temperature, Pressure pressure, Humidity humidity,
+                                LightIntensity light_intensity)
+{
+    mock()
+        .expectOneCall("new_sample_handler_multi_sample")
+        .withParameter("variables", variables)
+        .withParameter("temperature", temperature)
+        .withParameter("pressure", pressure)
+        .withParameter("humidity", humidity)
+        .withParameter("light_intensity", light_intensity);
+}
+
+/**
+ * @brief Handle all submitted events by executing the run function of the event queue thread.
+ *
+ * The run function never returns. The mock slot queue asserts once all submitted events have been handled, which ends
+ * the test. Must be the last statement of a test.
+ */
+static void handle_all_events()
+{
+    EasThreadRunFunction run = mock_eas_thread_get_run_function();
+    CHECK_TRUE(run);
+    TEST_ASSERT_PLUGIN_EXPECT_ASSERTION("is_slot_committed", "eas_slot_queue_get");
+    run();
+}
+
+// clang-format off
+TEST_GROUP(CentralEventQueue)
+{
+    void setup()
+    {
+        central_event_queue_init();
+        mock().ignoreOtherCalls();
+    }
+};
+// clang-format on
+
+TEST(CentralEventQueue, MultiSampleHandled)
+{
+    expect_multi_sample(MULTI_SAMPLE_TEMPERATURE | MULTI_SAMPLE_HUMIDITY, 215, 0, 455, 0);
+
+    MultiSample multi_sample = {};
+    multi_sample.variables = MULTI_SAMPLE_TEMPERATURE | MULTI_SAMPLE_HUMIDITY;
+    multi_sample.temperature = 215;
+    multi_sample.humidity = 455;
+    central_event_queue_submit_new_multi_sample_event(&multi_sample);
+    handle_all_events();
+}
+
+TEST(CentralEventQueue, MultiSampleNegativeTemperatureHandled)
+{
+    expect_multi_sample(MULTI_SAMPLE_TEMPERATURE, -125, 0, 0, 0);
+
+    MultiSample multi_sample = {};
+    multi_sample.variables = MULTI_SAMPLE_TEMPERATURE;
+    multi_sample.temperature = -125;
+    central_event_queue_submit_new_multi_sample_event(&multi_sample);
+    handle_all_events();
+}
+
+TEST(CentralEventQueue, MultiSamplesSubmittedBeforeHandlingMerged)
+{
+    /* Latest sample of every variable, handled as one multi sample that only occupies one event queue slot */
+    expect_multi_sample(MULTI_SAMPLE_TEMPERATURE | MULTI_SAMPLE_PRESSURE | MULTI_SAMPLE_HUMIDITY, 220, 1013, 400, 0);
+
+    MultiSample first = {};
+    first.variables = MULTI_SAMPLE_TEMPERATURE | MULTI_SAMPLE_HUMIDITY;
+    first.temperature = 210;
+    first.humidity = 400;
+    central_event_queue_submit_new_multi_sample_event(&first);
+    MultiSample second = {};
+    second.variables = MULTI_SAMPLE_TEMPERATURE;
+    second.temperature = 220;
+    central_event_queue_submit_new_multi_sample_event(&second);
+    MultiSample third = {};
+    third.variables = MULTI_SAMPLE_PRESSURE;
+    third.pressure = 1013;
+    central_event_queue_submit_new_multi_sample_event(&third);
+    handle_all_events();
+}
+
+TEST(CentralEventQueue, MultiSampleHandledWithoutSamplesOfPreviouslyHandledMultiSample)
+{
+    /* Other tests have handled multi samples with temperature and humidity before this one */
+    expect_multi_sample(MULTI_SAMPLE_LIGHT_INTENSITY, 0, 0, 0, 70000);
+
+    MultiSample multi_sample = {};
+    multi_sample.variables = MULTI_SAMPLE_LIGHT_INTENSITY;
+    multi_sample.light_intensity = 70000;
+    central_event_queue_submit_new_multi_sample_event(&multi_sample);
+    handle_all_events();
+}
+
+TEST(CentralEventQueue, TemperatureSamplesSubmittedBeforeHandlingCoalesced)
+{
+    mock().expectOneCall("new_sample_handler_temperature").withParameter("temperature", (Temperature)-30);
+
+    central_event_queue_submit_new_temperature_sample_event(-20);
+    central_event_queue_submit_new_temperature_sample_event(-30);
+    handle_all_events();
+}
@@ -0,0 +1,7 @@
+#include "CppUTestExt/MockSupport.h"
+#include "mock_connectivity_notification_sender.h"
+
+void connectivity_notification_sender_flush()
+{
+    mock().actualCall("connectivity_notification_sender_flush");
+}
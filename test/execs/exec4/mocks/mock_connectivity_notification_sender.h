@@ -0,0 +1,16 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC4_MOCKS_MOCK_CONNECTIVITY_NOTIFICATION_SENDER_H
+#define ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC4_MOCKS_MOCK_CONNECTIVITY_NOTIFICATION_SENDER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+void connectivity_notification_sender_flush();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC4_MOCKS_MOCK_CONNECTIVITY_NOTIFICATION_SENDER_H \
+        */
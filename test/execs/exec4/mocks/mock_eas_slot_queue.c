@@ -0,0 +1,71 @@
+#include <stdbool.h>
+
+#include "mock_eas_slot_queue.h"
+#include "eas_assert.h"
+
+struct EasSlotQueueStruct {
+    uint8_t *buf;
+    size_t slot_size;
+    size_t num_slots;
+    /** Index of the oldest reserved slot */
+    size_t head;
+    size_t num_reserved_slots;
+    size_t num_committed_slots;
+    size_t high_watermark;
+};
+
+static struct EasSlotQueueStruct instance;
+
+EasSlotQueue eas_slot_queue_create(uint8_t *const buf, size_t slot_size, size_t num_slots)
+{
+    EAS_ASSERT(buf);
+    instance = (struct EasSlotQueueStruct){.buf = buf, .slot_size = slot_size, .num_slots = num_slots};
+    return &instance;
+}
+
+void *eas_slot_queue_reserve(EasSlotQueue self)
+{
+    EAS_ASSERT(self);
+    if (self->num_reserved_slots == self->num_slots) {
+        return NULL;
+    }
+    size_t idx = (self->head + self->num_reserved_slots) % self->num_slots;
+    self->num_reserved_slots++;
+    if (self->num_reserved_slots > self->high_watermark) {
+        self->high_watermark = self->num_reserved_slots;
+    }
+    return self->buf + (idx * self->slot_size);
+}
+
+void eas_slot_queue_commit(EasSlotQueue self, void *const slot)
+{
+    EAS_ASSERT(self);
+    /* Slots are committed in the order in which they are reserved, since there is only one thread */
+    size_t idx = (self->head + self->num_committed_slots) % self->num_slots;
+    bool is_next_reserved_slot = (slot == self->buf + (idx * self->slot_size));
+    EAS_ASSERT(is_next_reserved_slot);
+    self->num_committed_slots++;
+}
+
+void *eas_slot_queue_get(EasSlotQueue self)
+{
+    EAS_ASSERT(self);
+    bool is_slot_committed = (self->num_committed_slots > 0);
+    EAS_ASSERT(is_slot_committed);
+    return self->buf + (self->head * self->slot_size);
+}
+
+void eas_slot_queue_release(EasSlotQueue self)
+{
+    EAS_ASSERT(self);
+    EAS_ASSERT(self->num_committed_slots > 0);
+    self->head = (self->head + 1) % self->num_slots;
+    self->num_reserved_slots--;
+    self->num_committed_slots--;
+}
+
+size_t eas_slot_queue_get_high_watermark(EasSlotQueue self)
+{
+    EAS_ASSERT(self);
+    return self->high_watermark;
+}
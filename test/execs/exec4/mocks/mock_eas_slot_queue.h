@@ -0,0 +1,26 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC4_MOCKS_MOCK_EAS_SLOT_QUEUE_H
+#define ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC4_MOCKS_MOCK_EAS_SLOT_QUEUE_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "osal/eas_slot_queue.h"
+
+/**
+ * @brief Single-threaded slot queue for tests of the slot queue consumer.
+ *
+ * Slots are reserved, committed, handed out and released in order, and reserve returns NULL if all slots are occupied,
+ * like in the real implementation. Instead of blocking, eas_slot_queue_get asserts if there is no committed slot, with
+ * the expression "is_slot_committed". A consumer thread run function that never returns can be tested by expecting
+ * this assertion, once the consumer has handled all committed slots.
+ *
+ * Only one instance is supported. Creating an instance again resets the queue.
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC4_MOCKS_MOCK_EAS_SLOT_QUEUE_H */
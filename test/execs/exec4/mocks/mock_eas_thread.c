@@ -0,0 +1,15 @@
+#include <stddef.h>
+
+#include "mock_eas_thread.h"
+
+static EasThreadRunFunction run_function = NULL;
+
+void eas_thread_create(EasThreadRunFunction run)
+{
+    run_function = run;
+}
+
+EasThreadRunFunction mock_eas_thread_get_run_function()
+{
+    return run_function;
+}
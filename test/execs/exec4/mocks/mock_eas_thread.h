@@ -0,0 +1,24 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC4_MOCKS_MOCK_EAS_THREAD_H
+#define ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC4_MOCKS_MOCK_EAS_THREAD_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "osal/eas_thread.h"
+
+/**
+ * @brief Get the run function passed to the last eas_thread_create call.
+ *
+ * The thread is not started by eas_thread_create. Tests execute the run function themselves.
+ *
+ * @return EasThreadRunFunction Run function, or NULL if eas_thread_create has not been called.
+ */
+EasThreadRunFunction mock_eas_thread_get_run_function();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC4_MOCKS_MOCK_EAS_THREAD_H */
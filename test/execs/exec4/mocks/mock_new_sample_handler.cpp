@@ -0,0 +1,35 @@
+#include "CppUTestExt/MockSupport.h"
+#include "mock_new_sample_handler.h"
+
+void new_sample_handler_temperature(Temperature temperature)
+{
+    mock().actualCall("new_sample_handler_temperature").withParameter("temperature", temperature);
+}
+
+void new_sample_handler_pressure(Pressure pressure)
+{
+    mock().actualCall("new_sample_handler_pressure").withParameter("pressure", pressure);
+}
+
+void new_sample_handler_humidity(Humidity humidity)
+{
+    mock().actualCall("new_sample_handler_humidity").withParameter("humidity", humidity);
+}
+
+void new_sample_handler_light_intensity(LightIntensity light_intensity)
+{
+    mock().actualCall("new_sample_handler_light_intensity").withParameter("light_intensity", light_intensity);
+}
+
+void new_sample_handler_multi_sample(const MultiSample *const multi_sample)
+{
+    const uint8_t variables = multi_sample->variables;
+    mock()
+        .actualCall("new_sample_handler_multi_sample")
+        .withParameter("variables", variables)
+        .withParameter("temperature", (variables & MULTI_SAMPLE_TEMPERATURE) ? multi_sample->temperature : 0)
+        .withParameter("pressure", (variables & MULTI_SAMPLE_PRESSURE) ? multi_sample->pressure : 0)
+        .withParameter("humidity", (variables & MULTI_SAMPLE_HUMIDITY) ? multi_sample->humidity : 0)
+        .withParameter("light_intensity",
+                       (variables & MULTI_SAMPLE_LIGHT_INTENSITY) ? multi_sample->light_intensity : 0);
+}
@@ -0,0 +1,30 @@
+#ifndef ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC4_MOCKS_MOCK_NEW_SAMPLE_HANDLER_H
+#define ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC4_MOCKS_MOCK_NEW_SAMPLE_HANDLER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "temperature.h"
+#include "pressure.h"
+#include "humidity.h"
+#include "light_intensity.h"
+#include "multi_sample.h"
+
+void new_sample_handler_temperature(Temperature temperature);
+
+void new_sample_handler_pressure(Pressure pressure);
+
+void new_sample_handler_humidity(Humidity humidity);
+
+void new_sample_handler_light_intensity(LightIntensity light_intensity);
+
+/* Samples of the variables that are not in multi_sample->variables are passed to the mock as 0 */
+void new_sample_handler_multi_sample(const MultiSample *const multi_sample);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENV_ALERT_SYSTEM_SRC_PORT_UNIT_TEST_OFF_TARGET_TEST_EXECS_EXEC4_MOCKS_MOCK_NEW_SAMPLE_HANDLER_H */
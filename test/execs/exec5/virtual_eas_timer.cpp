@@ -0,0 +1,139 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "CppUTest/TestHarness.h"
+
+#include "virtual_eas_timer.h"
+#include "virtual_eas_current_time.h"
+#include "config.h"
+
+#define VIRTUAL_EAS_TIMER_TEST_MAX_NUM_EXECUTED_CBS 8
+
+/* Timers can not be deleted, so every timer is created once and shared by all tests */
+static EasTimer timer_0;
+static EasTimer timer_1;
+static EasTimer periodic_timer;
+static bool timers_created = false;
+
+static int timer_user_data_0;
+static int timer_user_data_1;
+static int periodic_timer_user_data;
+
+/* Populated by execute_timer_expiry_function_cb, so that the tests can execute the pending expiries */
+static EasTimerCb submitted_cb;
+static void *submitted_cb_user_data;
+static size_t num_submissions;
+
+/* User data of every executed timer cb, in the order of execution */
+static void *executed_cb_user_data[VIRTUAL_EAS_TIMER_TEST_MAX_NUM_EXECUTED_CBS];
+static size_t num_executed_cbs;
+
+static void execute_timer_expiry_function_cb(EasTimerCb cb, void *user_data)
+{
+    submitted_cb = cb;
+    submitted_cb_user_data = user_data;
+    num_submissions++;
+}
+
+static void timer_cb(void *user_data)
+{
+    CHECK_TRUE(num_executed_cbs < VIRTUAL_EAS_TIMER_TEST_MAX_NUM_EXECUTED_CBS);
+    executed_cb_user_data[num_executed_cbs] = user_data;
+    num_executed_cbs++;
+}
+
+/**
+ * @brief Execute the expiries that are pending since the last submission.
+ */
+static void execute_submitted_cb()
+{
+    CHECK_TRUE(submitted_cb != NULL);
+    submitted_cb(submitted_cb_user_data);
+}
+
+// clang-format off
+TEST_GROUP(VirtualEasTimer)
+{
+    uint64_t start_time;
+
+    void setup()
+    {
+        eas_timer_set_execute_timer_expiry_function_cb(execute_timer_expiry_function_cb);
+        if (!timers_created) {
+            CHECK_EQUAL(3, CONFIG_EAS_TIMER_MAX_NUM_INSTANCES);
+            timer_0 = eas_timer_create(200, EAS_TIMER_ONE_SHOT, timer_cb, &timer_user_data_0);
+            timer_1 = eas_timer_create(100, EAS_TIMER_ONE_SHOT, timer_cb, &timer_user_data_1);
+            periodic_timer = eas_timer_create(100, EAS_TIMER_PERIODIC, timer_cb, &periodic_timer_user_data);
+            timers_created = true;
+        }
+        /* The virtual clock can not go backwards, so every test starts where the previous one stopped */
+        start_time = virtual_eas_current_time_get_uptime();
+
+        submitted_cb = NULL;
+        submitted_cb_user_data = NULL;
+        num_submissions = 0;
+        num_executed_cbs = 0;
+    }
+
+    void teardown()
+    {
+        eas_timer_stop(timer_0);
+        eas_timer_stop(timer_1);
+        eas_timer_stop(periodic_timer);
+    }
+
+    /**
+     * @brief Advance the virtual clock and expire the timers, like the simulation does.
+     */
+    void advance_time_and_expire(uint64_t offset_ms)
+    {
+        uint64_t time = virtual_eas_current_time_get_uptime() + offset_ms;
+        virtual_eas_current_time_set(time);
+        virtual_eas_timer_expire(time);
+    }
+};
+// clang-format on
+
+TEST(VirtualEasTimer, TimersExpiringInOneBurstSubmitOnce)
+{
+    eas_timer_start(timer_0);
+    eas_timer_start(timer_1);
+    advance_time_and_expire(200);
+    CHECK_EQUAL(1, num_submissions);
+    CHECK_EQUAL(0, num_executed_cbs);
+
+    /* timer_1 expired first, but the cbs are executed in the order in which the timers were created */
+    execute_submitted_cb();
+    CHECK_EQUAL(2, num_executed_cbs);
+    POINTERS_EQUAL(&timer_user_data_0, executed_cb_user_data[0]);
+    POINTERS_EQUAL(&timer_user_data_1, executed_cb_user_data[1]);
+}
+
+TEST(VirtualEasTimer, ExpiryAfterPendingExpiriesExecutedSubmitsAgain)
+{
+    eas_timer_start(timer_1);
+    advance_time_and_expire(100);
+    execute_submitted_cb();
+
+    eas_timer_start(timer_1);
+    advance_time_and_expire(100);
+    CHECK_EQUAL(2, num_submissions);
+    execute_submitted_cb();
+    CHECK_EQUAL(2, num_executed_cbs);
+}
+
+TEST(VirtualEasTimer, PeriodicTimerExpiringTwiceBeforeExecutionRunsCbOnce)
+{
+    eas_timer_start(periodic_timer);
+    advance_time_and_expire(250);
+    CHECK_EQUAL(1, num_submissions);
+
+    execute_submitted_cb();
+    CHECK_EQUAL(1, num_executed_cbs);
+    POINTERS_EQUAL(&periodic_timer_user_data, executed_cb_user_data[0]);
+
+    /* The timer keeps its period: it expired at 100 and 200 ms, and expires next at 300 ms */
+    uint64_t next_expiry_time;
+    CHECK_TRUE(virtual_eas_timer_get_next_expiry_time(&next_expiry_time));
+    CHECK_EQUAL(start_time + 300, next_expiry_time);
+}
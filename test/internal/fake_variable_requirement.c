@@ -17,10 +17,14 @@ EAS_STATIC_ASSERT(sizeof(struct FakeVariableRequirementStruct) <= CONFIG_VARIABL
 // Forward declarations of interface functions to define the interface.
 static bool evaluate(VariableRequirement base);
 static void destroy(VariableRequirement base);
+static VariableRequirementThreshold get_threshold(VariableRequirement base);
+static VariableRequirementThreshold get_upper_threshold(VariableRequirement base);
 
 static VariableRequirementInterfaceStruct interface = {
     .evaluate = evaluate,
     .destroy = destroy,
+    .get_threshold = get_threshold,
+    .get_upper_threshold = get_upper_threshold,
 };
 
 static bool evaluate(VariableRequirement base)
@@ -34,15 +38,42 @@ static void destroy(VariableRequirement base)
     fake_variable_requirement_allocator_free(base);
 }
 
-VariableRequirement fake_variable_requirement_create()
+static VariableRequirementThreshold get_threshold(VariableRequirement base)
+{
+    return 0;
+}
+
+static VariableRequirementThreshold get_upper_threshold(VariableRequirement base)
+{
+    return 1;
+}
+
+/**
+ * @brief Create fake variable requirement with the given operator.
+ *
+ * @param operator Operator of the requirement.
+ *
+ * @return VariableRequirement Created fake variable requirement instance.
+ */
+static VariableRequirement create(uint8_t operator)
 {
     FakeVariableRequirement self = (FakeVariableRequirement)fake_variable_requirement_allocator_alloc();
-    variable_requirement_create((VariableRequirement)self, &interface, VARIABLE_REQUIREMENT_OPERATOR_GEQ, 0);
+    variable_requirement_create((VariableRequirement)self, &interface, operator, 0);
 
     self->evaluate_result = false;
     return (VariableRequirement)self;
 }
 
+VariableRequirement fake_variable_requirement_create()
+{
+    return create(VARIABLE_REQUIREMENT_OPERATOR_GEQ);
+}
+
+VariableRequirement fake_variable_requirement_create_band()
+{
+    return create(VARIABLE_REQUIREMENT_OPERATOR_INSIDE);
+}
+
 void fake_variable_requirement_set_evaluate_result(VariableRequirement fake_variable_requirement, bool result)
 {
     FakeVariableRequirement self = (FakeVariableRequirement)fake_variable_requirement;
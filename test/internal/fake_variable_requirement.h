@@ -15,6 +15,16 @@ extern "C"
  */
 VariableRequirement fake_variable_requirement_create();
 
+/**
+ * @brief Create fake band requirement.
+ *
+ * Same as @ref fake_variable_requirement_create, but the created requirement has the
+ * VARIABLE_REQUIREMENT_OPERATOR_INSIDE operator.
+ *
+ * @return VariableRequirement Created fake variable requirement instance.
+ */
+VariableRequirement fake_variable_requirement_create_band();
+
 /**
  * @brief Set evaluate result for fake variable requirement.
  *